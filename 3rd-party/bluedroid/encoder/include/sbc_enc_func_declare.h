@@ -40,7 +40,7 @@ extern const SINT32 gas32CoeffFor8SBs[];
 extern void sbc_enc_bit_alloc_mono(SBC_ENC_PARAMS *CodecParams);
 extern void sbc_enc_bit_alloc_ste(SBC_ENC_PARAMS *CodecParams);
 
-extern void SbcAnalysisInit (void);
+extern void SbcAnalysisInit (SBC_ENC_PARAMS *strEncParams);
 
 extern void SbcAnalysisFilter4(SBC_ENC_PARAMS *strEncParams);
 extern void SbcAnalysisFilter8(SBC_ENC_PARAMS *strEncParams);
@@ -48,6 +48,34 @@ extern void SbcAnalysisFilter8(SBC_ENC_PARAMS *strEncParams);
 extern void SBC_FastIDCT8 (SINT32 *pInVect, SINT32 *pOutVect);
 extern void SBC_FastIDCT4 (SINT32 *x0, SINT32 *pOutVect);
 
+/* BK4BTSTACK_CHANGE START */
+/* SIMD analysis filter: windowing of one block/channel, DCT of a batch of windowed blocks */
+typedef struct
+{
+    void (*pfWindow4)(const SINT16 *ps16X, SINT32 *ps32Y);
+    void (*pfWindow8)(const SINT16 *ps16X, SINT32 *ps32Y);
+    void (*pfDct4)(SINT32 *ps32In, SINT32 *ps32Out, SINT32 s32NumOfVectors);
+    void (*pfDct8)(SINT32 *ps32In, SINT32 *ps32Out, SINT32 s32NumOfVectors);
+} tSBC_ANALYSIS_SIMD;
+
+/* SIMD code requires GCC/Clang with SSE2 and is bit-exact to the default C configuration only */
+#if (SBC_SIMD_OPT == TRUE) && defined(__GNUC__) && defined(__SSE2__) && (SBC_ARM_ASM_OPT == FALSE) && (SBC_DSP_OPT == FALSE) && (SBC_IPAQ_OPT == TRUE) && \
+    (SBC_IS_64_MULT_IN_WINDOW_ACCU == FALSE) && (SBC_FAST_DCT == TRUE) && (SBC_IS_64_MULT_IN_IDCT == FALSE)
+#define SBC_SIMD_SUPPORTED TRUE
+#else
+#define SBC_SIMD_SUPPORTED FALSE
+#endif
+
+#if (SBC_SIMD_SUPPORTED == TRUE)
+/* window coefficients gas16AnalysisWindowXX[j * 2 * XX + k] for s16X[ChOffset + j * 2 * XX + k] */
+extern const SINT16 gas16AnalysisWindow4[5 * 8];
+extern const SINT16 gas16AnalysisWindow8[5 * 16];
+#endif
+
+/* returns NULL if C implementation is used by encoder instance */
+extern const tSBC_ANALYSIS_SIMD * SbcAnalysisSimd(const SBC_ENC_PARAMS *pstrEncParams);
+/* BK4BTSTACK_CHANGE END */
+
 extern void EncPacking(SBC_ENC_PARAMS *strEncParams);
 extern void EncQuantizer(SBC_ENC_PARAMS *);
 #if (SBC_DSP_OPT==TRUE)
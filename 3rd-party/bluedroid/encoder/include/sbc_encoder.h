@@ -151,11 +151,42 @@
 #define SBC_FOR_EMBEDDED_LINUX FALSE
 #endif
 
+/* BK4BTSTACK_CHANGE START */
+/* Set SBC_SIMD_OPT to TRUE to use SSE2/AVX2 for windowing and DCT of the analysis filter if available. */
+/* The implementation is selected at runtime per encoder instance, its output is bit-exact to the C implementation. */
+/* Only used with the default configuration: SBC_IPAQ_OPT, SBC_FAST_DCT, 32 bit mult in windowing and DCT */
+#ifndef SBC_SIMD_OPT
+#define SBC_SIMD_OPT TRUE
+#endif
+
+#define SBC_ANALYSIS_IMPL_AUTO  0
+#define SBC_ANALYSIS_IMPL_C     1
+#define SBC_ANALYSIS_IMPL_SSE2  2
+#define SBC_ANALYSIS_IMPL_AVX2  3
+/* BK4BTSTACK_CHANGE END */
+
 /*constants used for index calculation*/
 #define SBC_BLK (SBC_MAX_NUM_OF_CHANNELS * SBC_MAX_NUM_OF_SUBBANDS)
 
 #include "sbc_types.h"
 
+/* BK4BTSTACK_CHANGE START */
+/* scramble control block, moved from sbc_encoder.c */
+typedef struct
+{
+    UINT8   use;
+    UINT8   idx;
+} tSBC_FR_CB;
+
+typedef struct
+{
+    tSBC_FR_CB      fr[2];
+    UINT8           init;
+    UINT8           index;
+    UINT8           base;
+} tSBC_PRTC_CB;
+/* BK4BTSTACK_CHANGE END */
+
 typedef struct SBC_ENC_PARAMS_TAG
 {
     SINT16 s16SamplingFreq;                         /* 16k, 32k, 44.1k or 48k*/
@@ -196,6 +227,14 @@ typedef struct SBC_ENC_PARAMS_TAG
     UINT16 u16PacketLength;
     /* BK4BTSTACK_CHANGE START */
     UINT8  mSBCEnabled;
+    /* analysis filter history, kept per encoder instance */
+    SINT32 as32AnalysisX[ENC_VX_BUFFER_SIZE/2];     /* accessed as SINT16, must be 32 bits aligned cf SHIFTUP_X8_2 */
+    SINT16 s16ShiftCounter;
+    SINT16 s16EncMaxShiftCounter;
+    /* scramble control block, kept per encoder instance */
+    tSBC_PRTC_CB sPrtcCb;
+    /* analysis filter implementation, see SBC_Encoder_SelectAnalysisImpl */
+    UINT8  u8AnalysisImpl;
     /* BK4BTSTACK_CHANGE END */
 }SBC_ENC_PARAMS;
 
@@ -205,6 +244,11 @@ extern "C"
 #endif
 SBC_API extern void SBC_Encoder(SBC_ENC_PARAMS *strEncParams);
 SBC_API extern void SBC_Encoder_Init(SBC_ENC_PARAMS *strEncParams);
+/* BK4BTSTACK_CHANGE START */
+/* select analysis filter implementation of encoder instance after SBC_Encoder_Init, returns FALSE if not supported */
+SBC_API extern UINT8 SBC_Encoder_SelectAnalysisImpl(SBC_ENC_PARAMS *pstrEncParams, UINT8 u8Impl);
+SBC_API extern UINT8 SBC_Encoder_GetAnalysisImpl(const SBC_ENC_PARAMS *pstrEncParams);
+/* BK4BTSTACK_CHANGE END */
 #ifdef __cplusplus
 }
 #endif
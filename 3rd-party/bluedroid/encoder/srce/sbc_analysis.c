@@ -153,15 +153,41 @@
 #define WIND_8_SUBBANDS_8_2 (SINT16)0x12CF  /* 40 = 0x12CF6C75 */
 #endif
 
-#if (SBC_USE_ARM_PRAGMA==TRUE)
-#pragma arm section zidata = "sbc_s32_analysis_section"
-#endif
-static SINT32   s32DCTY[16]  = {0};
-static SINT32   s32X[ENC_VX_BUFFER_SIZE/2];
-static SINT16   *s16X=(SINT16*) s32X;      /* s16X must be 32 bits aligned cf  SHIFTUP_X8_2*/
-#if (SBC_USE_ARM_PRAGMA==TRUE)
-#pragma arm section zidata
+/* BK4BTSTACK_CHANGE START */
+/* analysis history (s16X, ShiftCounter) lives in SBC_ENC_PARAMS to allow multiple encoder instances */
+/* BK4BTSTACK_CHANGE END */
+
+/* BK4BTSTACK_CHANGE START */
+#if (SBC_SIMD_SUPPORTED == TRUE)
+/* window coefficients of WINDOW_PARTIAL_4/8 as plain table: s32DCTY[k] = sum over j of table[j][k] * s16X[ChOffset + j * 2 * SB + k] */
+const SINT16 gas16AnalysisWindow4[5 * 8] =
+{
+    0,                    WIND_4_SUBBANDS_1_0, WIND_4_SUBBANDS_2_0, WIND_4_SUBBANDS_3_0, WIND_4_SUBBANDS_4_0, WIND_4_SUBBANDS_3_4, WIND_4_SUBBANDS_2_4, WIND_4_SUBBANDS_1_4,
+    WIND_4_SUBBANDS_0_1,  WIND_4_SUBBANDS_1_1, WIND_4_SUBBANDS_2_1, WIND_4_SUBBANDS_3_1, WIND_4_SUBBANDS_4_1, WIND_4_SUBBANDS_3_3, WIND_4_SUBBANDS_2_3, WIND_4_SUBBANDS_1_3,
+    WIND_4_SUBBANDS_0_2,  WIND_4_SUBBANDS_1_2, WIND_4_SUBBANDS_2_2, WIND_4_SUBBANDS_3_2, WIND_4_SUBBANDS_4_2, WIND_4_SUBBANDS_3_2, WIND_4_SUBBANDS_2_2, WIND_4_SUBBANDS_1_2,
+    -WIND_4_SUBBANDS_0_2, WIND_4_SUBBANDS_1_3, WIND_4_SUBBANDS_2_3, WIND_4_SUBBANDS_3_3, WIND_4_SUBBANDS_4_1, WIND_4_SUBBANDS_3_1, WIND_4_SUBBANDS_2_1, WIND_4_SUBBANDS_1_1,
+    -WIND_4_SUBBANDS_0_1, WIND_4_SUBBANDS_1_4, WIND_4_SUBBANDS_2_4, WIND_4_SUBBANDS_3_4, WIND_4_SUBBANDS_4_0, WIND_4_SUBBANDS_3_0, WIND_4_SUBBANDS_2_0, WIND_4_SUBBANDS_1_0,
+};
+
+const SINT16 gas16AnalysisWindow8[5 * 16] =
+{
+    0,                    WIND_8_SUBBANDS_1_0, WIND_8_SUBBANDS_2_0, WIND_8_SUBBANDS_3_0, WIND_8_SUBBANDS_4_0, WIND_8_SUBBANDS_5_0, WIND_8_SUBBANDS_6_0, WIND_8_SUBBANDS_7_0,
+    WIND_8_SUBBANDS_8_0,  WIND_8_SUBBANDS_7_4, WIND_8_SUBBANDS_6_4, WIND_8_SUBBANDS_5_4, WIND_8_SUBBANDS_4_4, WIND_8_SUBBANDS_3_4, WIND_8_SUBBANDS_2_4, WIND_8_SUBBANDS_1_4,
+
+    WIND_8_SUBBANDS_0_1,  WIND_8_SUBBANDS_1_1, WIND_8_SUBBANDS_2_1, WIND_8_SUBBANDS_3_1, WIND_8_SUBBANDS_4_1, WIND_8_SUBBANDS_5_1, WIND_8_SUBBANDS_6_1, WIND_8_SUBBANDS_7_1,
+    WIND_8_SUBBANDS_8_1,  WIND_8_SUBBANDS_7_3, WIND_8_SUBBANDS_6_3, WIND_8_SUBBANDS_5_3, WIND_8_SUBBANDS_4_3, WIND_8_SUBBANDS_3_3, WIND_8_SUBBANDS_2_3, WIND_8_SUBBANDS_1_3,
+
+    WIND_8_SUBBANDS_0_2,  WIND_8_SUBBANDS_1_2, WIND_8_SUBBANDS_2_2, WIND_8_SUBBANDS_3_2, WIND_8_SUBBANDS_4_2, WIND_8_SUBBANDS_5_2, WIND_8_SUBBANDS_6_2, WIND_8_SUBBANDS_7_2,
+    WIND_8_SUBBANDS_8_2,  WIND_8_SUBBANDS_7_2, WIND_8_SUBBANDS_6_2, WIND_8_SUBBANDS_5_2, WIND_8_SUBBANDS_4_2, WIND_8_SUBBANDS_3_2, WIND_8_SUBBANDS_2_2, WIND_8_SUBBANDS_1_2,
+
+    -WIND_8_SUBBANDS_0_2, WIND_8_SUBBANDS_1_3, WIND_8_SUBBANDS_2_3, WIND_8_SUBBANDS_3_3, WIND_8_SUBBANDS_4_3, WIND_8_SUBBANDS_5_3, WIND_8_SUBBANDS_6_3, WIND_8_SUBBANDS_7_3,
+    WIND_8_SUBBANDS_8_1,  WIND_8_SUBBANDS_7_1, WIND_8_SUBBANDS_6_1, WIND_8_SUBBANDS_5_1, WIND_8_SUBBANDS_4_1, WIND_8_SUBBANDS_3_1, WIND_8_SUBBANDS_2_1, WIND_8_SUBBANDS_1_1,
+
+    -WIND_8_SUBBANDS_0_1, WIND_8_SUBBANDS_1_4, WIND_8_SUBBANDS_2_4, WIND_8_SUBBANDS_3_4, WIND_8_SUBBANDS_4_4, WIND_8_SUBBANDS_5_4, WIND_8_SUBBANDS_6_4, WIND_8_SUBBANDS_7_4,
+    WIND_8_SUBBANDS_8_0,  WIND_8_SUBBANDS_7_0, WIND_8_SUBBANDS_6_0, WIND_8_SUBBANDS_5_0, WIND_8_SUBBANDS_4_0, WIND_8_SUBBANDS_3_0, WIND_8_SUBBANDS_2_0, WIND_8_SUBBANDS_1_0,
+};
 #endif
+/* BK4BTSTACK_CHANGE END */
 
 /* This macro is for 4 subbands */
 #define SHIFTUP_X4                                                               \
@@ -893,8 +919,6 @@ static SINT16   *s16X=(SINT16*) s32X;      /* s16X must be 32 bits aligned cf  S
 #endif
 #endif
 
-static SINT16 ShiftCounter=0;
-extern SINT16 EncMaxShiftCounter;
 /****************************************************************************
 * SbcAnalysisFilter - performs Analysis of the input audio stream
 *
@@ -902,6 +926,17 @@ extern SINT16 EncMaxShiftCounter;
 */
 void SbcAnalysisFilter4(SBC_ENC_PARAMS *pstrEncParams)
 {
+    /* BK4BTSTACK_CHANGE START */
+    SINT32  s32DCTY[16];
+    SINT16 *s16X = (SINT16 *) pstrEncParams->as32AnalysisX;
+    SINT16  ShiftCounter = pstrEncParams->s16ShiftCounter;
+    SINT16  EncMaxShiftCounter = pstrEncParams->s16EncMaxShiftCounter;
+#if (SBC_SIMD_SUPPORTED == TRUE)
+    const tSBC_ANALYSIS_SIMD *pstrSimd = SbcAnalysisSimd(pstrEncParams);
+    SINT32  as32DctIn[SBC_MAX_NUM_OF_BLOCKS * SBC_MAX_NUM_OF_CHANNELS * 2 * SUB_BANDS_4];
+    SINT32 *ps32DctIn = as32DctIn;
+#endif
+    /* BK4BTSTACK_CHANGE END */
     SINT16 *ps16PcmBuf;
     SINT32 *ps32SbBuf;
     SINT32  s32Blk,s32Ch;
@@ -960,6 +995,17 @@ void SbcAnalysisFilter4(SBC_ENC_PARAMS *pstrEncParams)
         for (s32Ch=0;s32Ch<s32NumOfChannels;s32Ch++)
         {
             ChOffset=(s32Ch*Offset2)+Offset;
+            /* BK4BTSTACK_CHANGE START */
+#if (SBC_SIMD_SUPPORTED == TRUE)
+            if (pstrSimd != NULL)
+            {
+                /* windowing only, DCT of all blocks is done below */
+                pstrSimd->pfWindow4(&s16X[ChOffset], ps32DctIn);
+                ps32DctIn += 2*SUB_BANDS_4;
+                continue;
+            }
+#endif
+            /* BK4BTSTACK_CHANGE END */
             
             WINDOW_PARTIAL_4
 
@@ -991,11 +1037,31 @@ void SbcAnalysisFilter4(SBC_ENC_PARAMS *pstrEncParams)
             }
         }
     }
+    /* BK4BTSTACK_CHANGE START */
+#if (SBC_SIMD_SUPPORTED == TRUE)
+    if (pstrSimd != NULL)
+    {
+        pstrSimd->pfDct4(as32DctIn, pstrEncParams->s32SbBuffer, s32NumOfBlocks * s32NumOfChannels);
+    }
+#endif
+    pstrEncParams->s16ShiftCounter = ShiftCounter;
+    /* BK4BTSTACK_CHANGE END */
 }
 
 /* //////////////////////////////////////////////////////////////////////////////////////////////////////////////////// */
 void SbcAnalysisFilter8 (SBC_ENC_PARAMS *pstrEncParams)
 {
+    /* BK4BTSTACK_CHANGE START */
+    SINT32  s32DCTY[16];
+    SINT16 *s16X = (SINT16 *) pstrEncParams->as32AnalysisX;
+    SINT16  ShiftCounter = pstrEncParams->s16ShiftCounter;
+    SINT16  EncMaxShiftCounter = pstrEncParams->s16EncMaxShiftCounter;
+#if (SBC_SIMD_SUPPORTED == TRUE)
+    const tSBC_ANALYSIS_SIMD *pstrSimd = SbcAnalysisSimd(pstrEncParams);
+    SINT32  as32DctIn[SBC_MAX_NUM_OF_BLOCKS * SBC_MAX_NUM_OF_CHANNELS * 2 * SUB_BANDS_8];
+    SINT32 *ps32DctIn = as32DctIn;
+#endif
+    /* BK4BTSTACK_CHANGE END */
     SINT16 *ps16PcmBuf;
     SINT32 *ps32SbBuf;
     SINT32  s32Blk,s32Ch;                                     /* counter for block*/
@@ -1063,6 +1129,17 @@ void SbcAnalysisFilter8 (SBC_ENC_PARAMS *pstrEncParams)
         for (s32Ch=0;s32Ch<s32NumOfChannels;s32Ch++)
         {
             ChOffset=(s32Ch*Offset2)+Offset;
+            /* BK4BTSTACK_CHANGE START */
+#if (SBC_SIMD_SUPPORTED == TRUE)
+            if (pstrSimd != NULL)
+            {
+                /* windowing only, DCT of all blocks is done below */
+                pstrSimd->pfWindow8(&s16X[ChOffset], ps32DctIn);
+                ps32DctIn += 2*SUB_BANDS_8;
+                continue;
+            }
+#endif
+            /* BK4BTSTACK_CHANGE END */
 
             WINDOW_PARTIAL_8
 
@@ -1095,10 +1172,22 @@ void SbcAnalysisFilter8 (SBC_ENC_PARAMS *pstrEncParams)
             }
         }
     }
+    /* BK4BTSTACK_CHANGE START */
+#if (SBC_SIMD_SUPPORTED == TRUE)
+    if (pstrSimd != NULL)
+    {
+        pstrSimd->pfDct8(as32DctIn, pstrEncParams->s32SbBuffer, s32NumOfBlocks * s32NumOfChannels);
+    }
+#endif
+    pstrEncParams->s16ShiftCounter = ShiftCounter;
+    /* BK4BTSTACK_CHANGE END */
 }
 
-void SbcAnalysisInit (void)
+void SbcAnalysisInit (SBC_ENC_PARAMS *pstrEncParams)
 {
-    memset(s16X,0,ENC_VX_BUFFER_SIZE*sizeof(SINT16));
-    ShiftCounter=0;
+    /* BK4BTSTACK_CHANGE START */
+    (void) SBC_Encoder_SelectAnalysisImpl(pstrEncParams, SBC_ANALYSIS_IMPL_AUTO);
+    /* BK4BTSTACK_CHANGE END */
+    memset(pstrEncParams->as32AnalysisX,0,sizeof(pstrEncParams->as32AnalysisX));
+    pstrEncParams->s16ShiftCounter=0;
 }
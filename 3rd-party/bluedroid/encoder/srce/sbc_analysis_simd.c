@@ -0,0 +1,548 @@
+/******************************************************************************
+ *
+ *  Copyright (C) 2026 BlueKitchen GmbH
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at:
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ *  SSE2/AVX2 versions of the analysis windowing and the fast DCT
+ *
+ *  Windowing is vectorized over the subband samples of one block. The DCT
+ *  is vectorized over blocks: all windowed blocks of a frame are collected
+ *  and transformed in groups of 4 (SSE2) or 8 (AVX2). All operations
+ *  match the 32 bit C implementation bit by bit.
+ *
+ ******************************************************************************/
+
+#include "sbc_encoder.h"
+#include "sbc_enc_func_declare.h"
+
+#if (SBC_SIMD_SUPPORTED == TRUE)
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#include <immintrin.h>
+#define SBC_SIMD_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+/* coefficients of SBC_FastIDCT4/8 for SBC_IS_64_MULT_IN_IDCT == FALSE */
+#define SBC_SIMD_COS_PI_SUR_4            (0x00005a82)
+#define SBC_SIMD_COS_PI_SUR_8            (0x00007641)
+#define SBC_SIMD_COS_3PI_SUR_8           (0x000030fb)
+#define SBC_SIMD_COS_PI_SUR_16           (0x00007d8a)
+#define SBC_SIMD_COS_3PI_SUR_16          (0x00006a6d)
+#define SBC_SIMD_COS_5PI_SUR_16          (0x0000471c)
+#define SBC_SIMD_COS_7PI_SUR_16          (0x000018f8)
+
+/*
+ * DCT butterflies of SBC_FastIDCT8/4 on vectors of blocks, using
+ * SIMD_VEC, SIMD_ADD, SIMD_SUB, SIMD_SRA1, SIMD_SHL1 and SIMD_MULT(coefficient, x)
+ */
+#define SBC_SIMD_DCT8(in, out)                                                      \
+{                                                                                   \
+    SIMD_VEC x0, x1, x2, x3, x4, x5, x6, x7, temp;                                  \
+    SIMD_VEC res_even0, res_even1, res_even2, res_even3;                            \
+    SIMD_VEC res_odd0, res_odd1, res_odd2, res_odd3;                                \
+    x0 = SIMD_MULT(SBC_SIMD_COS_PI_SUR_4, in[4]);                                   \
+    x1 = SIMD_SRA1(SIMD_ADD(in[3], in[5]));                                         \
+    x2 = SIMD_SRA1(SIMD_ADD(in[2], in[6]));                                         \
+    x3 = SIMD_SRA1(SIMD_ADD(in[1], in[7]));                                         \
+    x4 = SIMD_SRA1(SIMD_ADD(in[0], in[8]));                                         \
+    x5 = SIMD_SRA1(SIMD_SUB(in[9], in[15]));                                        \
+    x6 = SIMD_SRA1(SIMD_SUB(in[10], in[14]));                                       \
+    x7 = SIMD_SRA1(SIMD_SUB(in[11], in[13]));                                       \
+    temp = x0;                                                                      \
+    x0 = SIMD_MULT(SBC_SIMD_COS_PI_SUR_4, SIMD_ADD(x0, x4));                        \
+    x4 = SIMD_MULT(SBC_SIMD_COS_PI_SUR_4, SIMD_SUB(temp, x4));                      \
+    x2 = SIMD_SUB(x2, x6);                                                          \
+    x6 = SIMD_SHL1(x6);                                                             \
+    x6 = SIMD_MULT(SBC_SIMD_COS_PI_SUR_4, x6);                                      \
+    temp = x2;                                                                      \
+    x2 = SIMD_MULT(SBC_SIMD_COS_PI_SUR_8, SIMD_ADD(x2, x6));                        \
+    x6 = SIMD_MULT(SBC_SIMD_COS_3PI_SUR_8, SIMD_SUB(temp, x6));                     \
+    res_even0 = SIMD_ADD(x0, x2);                                                   \
+    res_even1 = SIMD_ADD(x4, x6);                                                   \
+    res_even2 = SIMD_SUB(x4, x6);                                                   \
+    res_even3 = SIMD_SUB(x0, x2);                                                   \
+    x7 = SIMD_SHL1(x7);                                                             \
+    x5 = SIMD_SUB(SIMD_SHL1(x5), x7);                                               \
+    x3 = SIMD_SUB(SIMD_SHL1(x3), x5);                                               \
+    x1 = SIMD_SUB(x1, SIMD_SRA1(x3));                                               \
+    x5 = SIMD_MULT(SBC_SIMD_COS_PI_SUR_4, x5);                                      \
+    temp = x1;                                                                      \
+    x1 = SIMD_ADD(x1, x5);                                                          \
+    x5 = SIMD_SUB(temp, x5);                                                        \
+    x3 = SIMD_SUB(x3, x7);                                                          \
+    x7 = SIMD_SHL1(x7);                                                             \
+    x7 = SIMD_MULT(SBC_SIMD_COS_PI_SUR_4, x7);                                      \
+    temp = x3;                                                                      \
+    x3 = SIMD_MULT(SBC_SIMD_COS_PI_SUR_8, SIMD_ADD(x3, x7));                        \
+    x7 = SIMD_MULT(SBC_SIMD_COS_3PI_SUR_8, SIMD_SUB(temp, x7));                     \
+    res_odd0 = SIMD_MULT(SBC_SIMD_COS_PI_SUR_16,  SIMD_ADD(x1, x3));                \
+    res_odd1 = SIMD_MULT(SBC_SIMD_COS_3PI_SUR_16, SIMD_ADD(x5, x7));                \
+    res_odd2 = SIMD_MULT(SBC_SIMD_COS_5PI_SUR_16, SIMD_SUB(x5, x7));                \
+    res_odd3 = SIMD_MULT(SBC_SIMD_COS_7PI_SUR_16, SIMD_SUB(x1, x3));                \
+    out[0] = SIMD_ADD(res_even0, res_odd0);                                         \
+    out[1] = SIMD_ADD(res_even1, res_odd1);                                         \
+    out[2] = SIMD_ADD(res_even2, res_odd2);                                         \
+    out[3] = SIMD_ADD(res_even3, res_odd3);                                         \
+    out[7] = SIMD_SUB(res_even0, res_odd0);                                         \
+    out[6] = SIMD_SUB(res_even1, res_odd1);                                         \
+    out[5] = SIMD_SUB(res_even2, res_odd2);                                         \
+    out[4] = SIMD_SUB(res_even3, res_odd3);                                         \
+}
+
+#define SBC_SIMD_DCT4(in, out)                                                      \
+{                                                                                   \
+    SIMD_VEC temp, x2, tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;              \
+    x2 = SIMD_SRA1(in[2]);                                                          \
+    temp = SIMD_ADD(in[0], in[4]);                                                  \
+    tmp0 = SIMD_MULT((SBC_SIMD_COS_PI_SUR_4>>1), temp);                             \
+    tmp1 = SIMD_SUB(x2, tmp0);                                                      \
+    tmp0 = SIMD_ADD(tmp0, x2);                                                      \
+    temp = SIMD_ADD(in[1], in[3]);                                                  \
+    tmp3 = SIMD_MULT((SBC_SIMD_COS_3PI_SUR_8>>1), temp);                            \
+    tmp2 = SIMD_MULT((SBC_SIMD_COS_PI_SUR_8>>1), temp);                             \
+    temp = SIMD_SUB(in[5], in[7]);                                                  \
+    tmp5 = SIMD_MULT((SBC_SIMD_COS_3PI_SUR_8>>1), temp);                            \
+    tmp4 = SIMD_MULT((SBC_SIMD_COS_PI_SUR_8>>1), temp);                             \
+    tmp6 = SIMD_ADD(tmp2, tmp5);                                                    \
+    tmp7 = SIMD_SUB(tmp3, tmp4);                                                    \
+    out[0] = SIMD_ADD(tmp0, tmp6);                                                  \
+    out[1] = SIMD_ADD(tmp1, tmp7);                                                  \
+    out[2] = SIMD_SUB(tmp1, tmp7);                                                  \
+    out[3] = SIMD_SUB(tmp0, tmp6);                                                  \
+}
+
+static void SbcAnalysisDctTail(SINT32 *ps32In, SINT32 *ps32Out, SINT32 s32NumOfVectors, SINT32 s32NumOfSubBands)
+{
+    SINT32 s32Vec;
+    for (s32Vec = 0; s32Vec < s32NumOfVectors; s32Vec++)
+    {
+        if (s32NumOfSubBands == SUB_BANDS_8)
+        {
+            SBC_FastIDCT8(ps32In, ps32Out);
+        }
+        else
+        {
+            SBC_FastIDCT4(ps32In, ps32Out);
+        }
+        ps32In  += 2 * s32NumOfSubBands;
+        ps32Out += s32NumOfSubBands;
+    }
+}
+
+#if defined(__SSE2__)
+
+/* window coefficient pairs (table[j][k], table[j+1][k]) for _mm_madd_epi16, per group of 8 subband samples */
+static SINT16 as16Window4PairsSSE2[1][6][8] __attribute__((aligned(16)));
+static SINT16 as16Window8PairsSSE2[2][6][8] __attribute__((aligned(16)));
+static SINT16 as16Window8PairsAVX2[6][16]   __attribute__((aligned(32)));
+
+static void SbcAnalysisBuildPairs(const SINT16 *ps16Table, SINT32 s32Stride, SINT32 s32Group, SINT16 as16Pairs[6][8])
+{
+    SINT32 s32Pair, s32Half, i, k;
+    for (s32Pair = 0; s32Pair < 3; s32Pair++)
+    {
+        for (s32Half = 0; s32Half < 2; s32Half++)
+        {
+            for (i = 0; i < 4; i++)
+            {
+                k = s32Group * 8 + s32Half * 4 + i;
+                as16Pairs[2 * s32Pair + s32Half][2 * i]     = ps16Table[(2 * s32Pair) * s32Stride + k];
+                as16Pairs[2 * s32Pair + s32Half][2 * i + 1] = (s32Pair < 2) ? ps16Table[(2 * s32Pair + 1) * s32Stride + k] : 0;
+            }
+        }
+    }
+}
+
+static void SbcAnalysisInitSSE2(void)
+{
+    SINT32 s32Vec, i;
+    SbcAnalysisBuildPairs(gas16AnalysisWindow4, 8,  0, as16Window4PairsSSE2[0]);
+    SbcAnalysisBuildPairs(gas16AnalysisWindow8, 16, 0, as16Window8PairsSSE2[0]);
+    SbcAnalysisBuildPairs(gas16AnalysisWindow8, 16, 1, as16Window8PairsSSE2[1]);
+    /* AVX2 unpack works per 128 bit lane: lane 0 holds subbands 0..7, lane 1 subbands 8..15 */
+    for (s32Vec = 0; s32Vec < 6; s32Vec++)
+    {
+        for (i = 0; i < 8; i++)
+        {
+            as16Window8PairsAVX2[s32Vec][i]     = as16Window8PairsSSE2[0][s32Vec][i];
+            as16Window8PairsAVX2[s32Vec][i + 8] = as16Window8PairsSSE2[1][s32Vec][i];
+        }
+    }
+}
+
+/* tables are shared by all encoder instances, build them only once */
+static void SbcAnalysisInitSSE2Once(void)
+{
+    static UINT8 u8State = 0;   /* 0: not built, 1: building, 2: built */
+    UINT8 u8Expected = 0;
+    if (__atomic_load_n(&u8State, __ATOMIC_ACQUIRE) == 2)
+    {
+        return;
+    }
+    if (__atomic_compare_exchange_n(&u8State, &u8Expected, 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    {
+        SbcAnalysisInitSSE2();
+        __atomic_store_n(&u8State, 2, __ATOMIC_RELEASE);
+        return;
+    }
+    while (__atomic_load_n(&u8State, __ATOMIC_ACQUIRE) != 2)
+    {
+    }
+}
+
+/* 8 window outputs from x[k], x[k + stride], .. x[k + 4 * stride] */
+static inline void SbcAnalysisWindowGroupSSE2(const SINT16 *ps16X, SINT32 s32Stride, const SINT16 (*as16Pairs)[8], SINT32 *ps32Y)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i x0 = _mm_loadu_si128((const __m128i *) &ps16X[0]);
+    __m128i x1 = _mm_loadu_si128((const __m128i *) &ps16X[s32Stride]);
+    __m128i x2 = _mm_loadu_si128((const __m128i *) &ps16X[2 * s32Stride]);
+    __m128i x3 = _mm_loadu_si128((const __m128i *) &ps16X[3 * s32Stride]);
+    __m128i x4 = _mm_loadu_si128((const __m128i *) &ps16X[4 * s32Stride]);
+    __m128i lo, hi;
+
+    lo = _mm_madd_epi16(_mm_unpacklo_epi16(x0, x1), _mm_load_si128((const __m128i *) as16Pairs[0]));
+    hi = _mm_madd_epi16(_mm_unpackhi_epi16(x0, x1), _mm_load_si128((const __m128i *) as16Pairs[1]));
+    lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(x2, x3), _mm_load_si128((const __m128i *) as16Pairs[2])));
+    hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(x2, x3), _mm_load_si128((const __m128i *) as16Pairs[3])));
+    lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(x4, zero), _mm_load_si128((const __m128i *) as16Pairs[4])));
+    hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(x4, zero), _mm_load_si128((const __m128i *) as16Pairs[5])));
+
+    _mm_storeu_si128((__m128i *) &ps32Y[0], lo);
+    _mm_storeu_si128((__m128i *) &ps32Y[4], hi);
+}
+
+static void SbcAnalysisWindow4SSE2(const SINT16 *ps16X, SINT32 *ps32Y)
+{
+    SbcAnalysisWindowGroupSSE2(ps16X, 8, (const SINT16 (*)[8]) as16Window4PairsSSE2[0], ps32Y);
+}
+
+static void SbcAnalysisWindow8SSE2(const SINT16 *ps16X, SINT32 *ps32Y)
+{
+    SbcAnalysisWindowGroupSSE2(&ps16X[0], 16, (const SINT16 (*)[8]) as16Window8PairsSSE2[0], &ps32Y[0]);
+    SbcAnalysisWindowGroupSSE2(&ps16X[8], 16, (const SINT16 (*)[8]) as16Window8PairsSSE2[1], &ps32Y[8]);
+}
+
+/* (SINT32)(((SINT64)c * x) >> 15) for 0 <= c < 0x8000, computed as 2 * c * (x >> 16) + ((c * (x & 0xffff)) >> 15) */
+static inline __m128i SbcMultSSE2(SINT32 s32Coeff, __m128i x)
+{
+    __m128i c  = _mm_set1_epi32(s32Coeff);
+    __m128i hi = _mm_slli_epi32(_mm_madd_epi16(_mm_srai_epi32(x, 16), c), 1);
+    __m128i lo = _mm_and_si128(x, _mm_set1_epi32(0xffff));
+    __m128i lo_prod = _mm_or_si128(_mm_mullo_epi16(lo, c), _mm_slli_epi32(_mm_mulhi_epu16(lo, c), 16));
+    return _mm_add_epi32(hi, _mm_srli_epi32(lo_prod, 15));
+}
+
+#define SBC_SIMD_TRANSPOSE_4X4_SSE2(r0, r1, r2, r3)                                 \
+{                                                                                   \
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1);                                        \
+    __m128i t1 = _mm_unpacklo_epi32(r2, r3);                                        \
+    __m128i t2 = _mm_unpackhi_epi32(r0, r1);                                        \
+    __m128i t3 = _mm_unpackhi_epi32(r2, r3);                                        \
+    r0 = _mm_unpacklo_epi64(t0, t1);                                                \
+    r1 = _mm_unpackhi_epi64(t0, t1);                                                \
+    r2 = _mm_unpacklo_epi64(t2, t3);                                                \
+    r3 = _mm_unpackhi_epi64(t2, t3);                                                \
+}
+
+#define SIMD_VEC        __m128i
+#define SIMD_ADD(a, b)  _mm_add_epi32(a, b)
+#define SIMD_SUB(a, b)  _mm_sub_epi32(a, b)
+#define SIMD_SRA1(a)    _mm_srai_epi32(a, 1)
+#define SIMD_SHL1(a)    _mm_slli_epi32(a, 1)
+#define SIMD_MULT(c, a) SbcMultSSE2(c, a)
+
+static void SbcAnalysisDct8SSE2(SINT32 *ps32In, SINT32 *ps32Out, SINT32 s32NumOfVectors)
+{
+    __m128i in[16], out[8];
+    SINT32 s32Vec, i;
+    for (s32Vec = 0; (s32Vec + 4) <= s32NumOfVectors; s32Vec += 4)
+    {
+        const SINT32 *ps32Src = &ps32In[s32Vec * 16];
+        SINT32 *ps32Dst = &ps32Out[s32Vec * 8];
+        for (i = 0; i < 16; i += 4)
+        {
+            in[i + 0] = _mm_loadu_si128((const __m128i *) &ps32Src[0 * 16 + i]);
+            in[i + 1] = _mm_loadu_si128((const __m128i *) &ps32Src[1 * 16 + i]);
+            in[i + 2] = _mm_loadu_si128((const __m128i *) &ps32Src[2 * 16 + i]);
+            in[i + 3] = _mm_loadu_si128((const __m128i *) &ps32Src[3 * 16 + i]);
+            SBC_SIMD_TRANSPOSE_4X4_SSE2(in[i + 0], in[i + 1], in[i + 2], in[i + 3]);
+        }
+        SBC_SIMD_DCT8(in, out);
+        for (i = 0; i < 8; i += 4)
+        {
+            SBC_SIMD_TRANSPOSE_4X4_SSE2(out[i + 0], out[i + 1], out[i + 2], out[i + 3]);
+            _mm_storeu_si128((__m128i *) &ps32Dst[0 * 8 + i], out[i + 0]);
+            _mm_storeu_si128((__m128i *) &ps32Dst[1 * 8 + i], out[i + 1]);
+            _mm_storeu_si128((__m128i *) &ps32Dst[2 * 8 + i], out[i + 2]);
+            _mm_storeu_si128((__m128i *) &ps32Dst[3 * 8 + i], out[i + 3]);
+        }
+    }
+    SbcAnalysisDctTail(&ps32In[s32Vec * 16], &ps32Out[s32Vec * 8], s32NumOfVectors - s32Vec, SUB_BANDS_8);
+}
+
+static void SbcAnalysisDct4SSE2(SINT32 *ps32In, SINT32 *ps32Out, SINT32 s32NumOfVectors)
+{
+    __m128i in[8], out[4];
+    SINT32 s32Vec, i;
+    for (s32Vec = 0; (s32Vec + 4) <= s32NumOfVectors; s32Vec += 4)
+    {
+        const SINT32 *ps32Src = &ps32In[s32Vec * 8];
+        SINT32 *ps32Dst = &ps32Out[s32Vec * 4];
+        for (i = 0; i < 8; i += 4)
+        {
+            in[i + 0] = _mm_loadu_si128((const __m128i *) &ps32Src[0 * 8 + i]);
+            in[i + 1] = _mm_loadu_si128((const __m128i *) &ps32Src[1 * 8 + i]);
+            in[i + 2] = _mm_loadu_si128((const __m128i *) &ps32Src[2 * 8 + i]);
+            in[i + 3] = _mm_loadu_si128((const __m128i *) &ps32Src[3 * 8 + i]);
+            SBC_SIMD_TRANSPOSE_4X4_SSE2(in[i + 0], in[i + 1], in[i + 2], in[i + 3]);
+        }
+        SBC_SIMD_DCT4(in, out);
+        SBC_SIMD_TRANSPOSE_4X4_SSE2(out[0], out[1], out[2], out[3]);
+        _mm_storeu_si128((__m128i *) &ps32Dst[0], out[0]);
+        _mm_storeu_si128((__m128i *) &ps32Dst[4], out[1]);
+        _mm_storeu_si128((__m128i *) &ps32Dst[8], out[2]);
+        _mm_storeu_si128((__m128i *) &ps32Dst[12], out[3]);
+    }
+    SbcAnalysisDctTail(&ps32In[s32Vec * 8], &ps32Out[s32Vec * 4], s32NumOfVectors - s32Vec, SUB_BANDS_4);
+}
+
+#undef SIMD_VEC
+#undef SIMD_ADD
+#undef SIMD_SUB
+#undef SIMD_SRA1
+#undef SIMD_SHL1
+#undef SIMD_MULT
+
+static const tSBC_ANALYSIS_SIMD strSbcAnalysisSSE2 =
+{
+    SbcAnalysisWindow4SSE2,
+    SbcAnalysisWindow8SSE2,
+    SbcAnalysisDct4SSE2,
+    SbcAnalysisDct8SSE2,
+};
+
+/* AVX2: 16 window outputs at once, DCT of 8 blocks at once */
+
+SBC_SIMD_AVX2_TARGET
+static void SbcAnalysisWindow8AVX2(const SINT16 *ps16X, SINT32 *ps32Y)
+{
+    __m256i zero = _mm256_setzero_si256();
+    __m256i x0 = _mm256_loadu_si256((const __m256i *) &ps16X[0]);
+    __m256i x1 = _mm256_loadu_si256((const __m256i *) &ps16X[16]);
+    __m256i x2 = _mm256_loadu_si256((const __m256i *) &ps16X[32]);
+    __m256i x3 = _mm256_loadu_si256((const __m256i *) &ps16X[48]);
+    __m256i x4 = _mm256_loadu_si256((const __m256i *) &ps16X[64]);
+    __m256i lo, hi;
+
+    /* lo: subbands 0..3 and 8..11, hi: subbands 4..7 and 12..15 */
+    lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(x0, x1), _mm256_load_si256((const __m256i *) as16Window8PairsAVX2[0]));
+    hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(x0, x1), _mm256_load_si256((const __m256i *) as16Window8PairsAVX2[1]));
+    lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(x2, x3), _mm256_load_si256((const __m256i *) as16Window8PairsAVX2[2])));
+    hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(x2, x3), _mm256_load_si256((const __m256i *) as16Window8PairsAVX2[3])));
+    lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(x4, zero), _mm256_load_si256((const __m256i *) as16Window8PairsAVX2[4])));
+    hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(x4, zero), _mm256_load_si256((const __m256i *) as16Window8PairsAVX2[5])));
+
+    _mm256_storeu_si256((__m256i *) &ps32Y[0], _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256((__m256i *) &ps32Y[8], _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+SBC_SIMD_AVX2_TARGET
+static inline __m256i SbcMultAVX2(SINT32 s32Coeff, __m256i x)
+{
+    __m256i c  = _mm256_set1_epi32(s32Coeff);
+    __m256i hi = _mm256_slli_epi32(_mm256_madd_epi16(_mm256_srai_epi32(x, 16), c), 1);
+    __m256i lo = _mm256_and_si256(x, _mm256_set1_epi32(0xffff));
+    __m256i lo_prod = _mm256_or_si256(_mm256_mullo_epi16(lo, c), _mm256_slli_epi32(_mm256_mulhi_epu16(lo, c), 16));
+    return _mm256_add_epi32(hi, _mm256_srli_epi32(lo_prod, 15));
+}
+
+SBC_SIMD_AVX2_TARGET
+static inline void SbcTranspose8x8AVX2(__m256i *r)
+{
+    __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+    __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+    __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+    __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+    __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+    __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+    __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+    __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+    __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+    __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+    __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+    __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+    __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+    __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+    __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+    __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+    r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+    r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+    r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+    r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+    r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+    r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+    r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+    r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+}
+
+#define SIMD_VEC        __m256i
+#define SIMD_ADD(a, b)  _mm256_add_epi32(a, b)
+#define SIMD_SUB(a, b)  _mm256_sub_epi32(a, b)
+#define SIMD_SRA1(a)    _mm256_srai_epi32(a, 1)
+#define SIMD_SHL1(a)    _mm256_slli_epi32(a, 1)
+#define SIMD_MULT(c, a) SbcMultAVX2(c, a)
+
+SBC_SIMD_AVX2_TARGET
+static void SbcAnalysisDct8AVX2(SINT32 *ps32In, SINT32 *ps32Out, SINT32 s32NumOfVectors)
+{
+    __m256i in[16], out[8];
+    SINT32 s32Vec, i;
+    for (s32Vec = 0; (s32Vec + 8) <= s32NumOfVectors; s32Vec += 8)
+    {
+        const SINT32 *ps32Src = &ps32In[s32Vec * 16];
+        SINT32 *ps32Dst = &ps32Out[s32Vec * 8];
+        for (i = 0; i < 8; i++)
+        {
+            in[i]     = _mm256_loadu_si256((const __m256i *) &ps32Src[i * 16]);
+            in[i + 8] = _mm256_loadu_si256((const __m256i *) &ps32Src[i * 16 + 8]);
+        }
+        SbcTranspose8x8AVX2(&in[0]);
+        SbcTranspose8x8AVX2(&in[8]);
+        SBC_SIMD_DCT8(in, out);
+        SbcTranspose8x8AVX2(out);
+        for (i = 0; i < 8; i++)
+        {
+            _mm256_storeu_si256((__m256i *) &ps32Dst[i * 8], out[i]);
+        }
+    }
+    SbcAnalysisDct8SSE2(&ps32In[s32Vec * 16], &ps32Out[s32Vec * 8], s32NumOfVectors - s32Vec);
+}
+
+SBC_SIMD_AVX2_TARGET
+static void SbcAnalysisDct4AVX2(SINT32 *ps32In, SINT32 *ps32Out, SINT32 s32NumOfVectors)
+{
+    __m256i in[8], out[8];
+    SINT32 s32Vec, i;
+    for (s32Vec = 0; (s32Vec + 8) <= s32NumOfVectors; s32Vec += 8)
+    {
+        const SINT32 *ps32Src = &ps32In[s32Vec * 8];
+        SINT32 *ps32Dst = &ps32Out[s32Vec * 4];
+        for (i = 0; i < 8; i++)
+        {
+            in[i] = _mm256_loadu_si256((const __m256i *) &ps32Src[i * 8]);
+        }
+        SbcTranspose8x8AVX2(in);
+        SBC_SIMD_DCT4(in, out);
+        for (i = 4; i < 8; i++)
+        {
+            out[i] = _mm256_setzero_si256();
+        }
+        SbcTranspose8x8AVX2(out);
+        for (i = 0; i < 8; i++)
+        {
+            _mm_storeu_si128((__m128i *) &ps32Dst[i * 4], _mm256_castsi256_si128(out[i]));
+        }
+    }
+    SbcAnalysisDct4SSE2(&ps32In[s32Vec * 8], &ps32Out[s32Vec * 4], s32NumOfVectors - s32Vec);
+}
+
+#undef SIMD_VEC
+#undef SIMD_ADD
+#undef SIMD_SUB
+#undef SIMD_SRA1
+#undef SIMD_SHL1
+#undef SIMD_MULT
+
+static const tSBC_ANALYSIS_SIMD strSbcAnalysisAVX2 =
+{
+    SbcAnalysisWindow4SSE2,
+    SbcAnalysisWindow8AVX2,
+    SbcAnalysisDct4AVX2,
+    SbcAnalysisDct8AVX2,
+};
+
+#endif /* __SSE2__ */
+
+#endif /* SBC_SIMD_SUPPORTED */
+
+static UINT8 SbcAnalysisImplSupported(UINT8 u8Impl)
+{
+    switch (u8Impl)
+    {
+        case SBC_ANALYSIS_IMPL_C:
+            return TRUE;
+#if (SBC_SIMD_SUPPORTED == TRUE)
+        case SBC_ANALYSIS_IMPL_SSE2:
+            return TRUE;
+        case SBC_ANALYSIS_IMPL_AVX2:
+            return __builtin_cpu_supports("avx2") ? TRUE : FALSE;
+#endif
+        default:
+            return FALSE;
+    }
+}
+
+UINT8 SBC_Encoder_SelectAnalysisImpl(SBC_ENC_PARAMS *pstrEncParams, UINT8 u8Impl)
+{
+    if (u8Impl == SBC_ANALYSIS_IMPL_AUTO)
+    {
+        u8Impl = SBC_ANALYSIS_IMPL_C;
+        if (SbcAnalysisImplSupported(SBC_ANALYSIS_IMPL_SSE2))
+        {
+            u8Impl = SBC_ANALYSIS_IMPL_SSE2;
+        }
+        if (SbcAnalysisImplSupported(SBC_ANALYSIS_IMPL_AVX2))
+        {
+            u8Impl = SBC_ANALYSIS_IMPL_AVX2;
+        }
+    }
+    if (SbcAnalysisImplSupported(u8Impl) == FALSE)
+    {
+        return FALSE;
+    }
+#if (SBC_SIMD_SUPPORTED == TRUE)
+    if (u8Impl != SBC_ANALYSIS_IMPL_C)
+    {
+        SbcAnalysisInitSSE2Once();
+    }
+#endif
+    pstrEncParams->u8AnalysisImpl = u8Impl;
+    return TRUE;
+}
+
+UINT8 SBC_Encoder_GetAnalysisImpl(const SBC_ENC_PARAMS *pstrEncParams)
+{
+    return pstrEncParams->u8AnalysisImpl;
+}
+
+const tSBC_ANALYSIS_SIMD * SbcAnalysisSimd(const SBC_ENC_PARAMS *pstrEncParams)
+{
+    switch (pstrEncParams->u8AnalysisImpl)
+    {
+#if (SBC_SIMD_SUPPORTED == TRUE)
+        case SBC_ANALYSIS_IMPL_SSE2:
+            return &strSbcAnalysisSSE2;
+        case SBC_ANALYSIS_IMPL_AVX2:
+            return &strSbcAnalysisAVX2;
+#endif
+        default:
+            return SBC_NULL;
+    }
+}
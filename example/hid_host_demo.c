@@ -55,6 +55,7 @@
 #include "btstack.h"
 
 #define MAX_ATTRIBUTE_VALUE_SIZE 300
+#define MAX_HID_FIELDS 32
 
 // MBP 2016 static const char * remote_addr_string = "F4-0F-24-3B-1B-E1";
 // iMpulse static const char * remote_addr_string = "64:6E:6C:C1:AA:B5";
@@ -116,6 +117,7 @@ static const uint8_t keytable_us_shift[] = {
 
 // SDP
 static uint8_t hid_descriptor_storage[MAX_ATTRIBUTE_VALUE_SIZE];
+static btstack_hid_field_t hid_field_storage[MAX_HID_FIELDS];
 
 // App
 static enum {
@@ -148,6 +150,7 @@ static void hid_host_setup(void){
 
     // Initialize HID Host
     hid_host_init(hid_descriptor_storage, sizeof(hid_descriptor_storage));
+    hid_host_init_field_storage(hid_field_storage, MAX_HID_FIELDS);
     hid_host_register_packet_handler(packet_handler);
 
     // Allow sniff mode requests by HID device and support role switch
@@ -168,8 +171,8 @@ static void hid_host_setup(void){
 /*
  * @section HID Report Handler
  * 
- * @text Use BTstack's compact HID Parser to process incoming HID Report in Report protocol mode. 
- * Iterate over all fields and process fields with usage page = 0x07 / Keyboard
+ * @text Use BTstack's HID Report decoder with the HID Descriptor compiled by the HID Host to process incoming
+ * HID Report in Report protocol mode, or BTstack's compact HID Parser if the HID Descriptor could not be compiled. Iterate over all fields and process fields with usage page = 0x07 / Keyboard
  * Check if SHIFT is down and process first character (don't handle multiple key presses)
  * 
  */
@@ -184,21 +187,33 @@ static void hid_host_handle_interrupt_report(const uint8_t * report, uint16_t re
     report++;
     report_len--;
     
+    // fall back to HID Parser if HID Descriptor could not be compiled, e.g. field storage too small
+    btstack_hid_field_table_t field_table;
+    btstack_hid_report_decoder_t decoder;
     btstack_hid_parser_t parser;
-    btstack_hid_parser_init(&parser, 
-        hid_descriptor_storage_get_descriptor_data(hid_host_cid), 
-        hid_descriptor_storage_get_descriptor_len(hid_host_cid), 
-        HID_REPORT_TYPE_INPUT, report, report_len);
+    bool use_decoder = hid_host_get_field_table(hid_host_cid, &field_table) == ERROR_CODE_SUCCESS;
+    if (use_decoder){
+        btstack_hid_report_decoder_init(&decoder, &field_table, HID_REPORT_TYPE_INPUT, report, report_len);
+    } else {
+        btstack_hid_parser_init(&parser, 
+            hid_descriptor_storage_get_descriptor_data(hid_host_cid), 
+            hid_descriptor_storage_get_descriptor_len(hid_host_cid), 
+            HID_REPORT_TYPE_INPUT, report, report_len);
+    }
 
     int shift = 0;
     uint8_t new_keys[NUM_KEYS];
     memset(new_keys, 0, sizeof(new_keys));
     int     new_keys_count = 0;
-    while (btstack_hid_parser_has_more(&parser)){
+    while (use_decoder ? btstack_hid_report_decoder_has_more(&decoder) : btstack_hid_parser_has_more(&parser)){
         uint16_t usage_page;
         uint16_t usage;
         int32_t  value;
-        btstack_hid_parser_get_field(&parser, &usage_page, &usage, &value);
+        if (use_decoder){
+            btstack_hid_report_decoder_get_field(&decoder, &usage_page, &usage, &value);
+        } else {
+            btstack_hid_parser_get_field(&parser, &usage_page, &usage, &value);
+        }
         if (usage_page != 0x07) continue;   
         switch (usage){
             case 0xe1:
@@ -71,6 +71,7 @@ static uint16_t host_max_latency = 1600;
 static uint16_t host_min_timeout = 3200;
 
 #define REPORT_ID 0x01
+#define MAX_HID_FIELDS 8
 
 // close to USB HID Specification 1.1, Appendix B.1
 const uint8_t hid_descriptor_keyboard[] = {
@@ -180,6 +181,7 @@ static const uint8_t keytable_us_shift[] = {
 // STATE
 
 static uint8_t hid_service_buffer[300];
+static btstack_hid_field_t hid_field_storage[MAX_HID_FIELDS];
 static uint8_t device_id_sdp_service_buffer[100];
 static const char hid_device_name[] = "BTstack HID Keyboard";
 static btstack_packet_callback_registration_t hci_event_callback_registration;
@@ -466,6 +468,7 @@ int btstack_main(int argc, const char * argv[]){
 
     // HID Device
     hid_device_init(hid_boot_device, sizeof(hid_descriptor_keyboard), hid_descriptor_keyboard);
+    hid_device_init_field_storage(hid_field_storage, MAX_HID_FIELDS);
        
     // register for HCI events
     hci_event_callback_registration.callback = &packet_handler;
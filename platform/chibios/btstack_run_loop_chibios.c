@@ -114,7 +114,7 @@ static void btstack_run_loop_chibios_execute(void) {
             if (callback_registration == NULL){
                 break;
             }
-            (*callback_registration->callback)(callback_registration->context);
+            btstack_run_loop_base_execute_callback(callback_registration);
         }
 
         // process timers
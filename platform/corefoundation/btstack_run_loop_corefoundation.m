@@ -68,9 +68,11 @@ typedef struct  {
     CFRunLoopSourceRef socket_run_loop;
 } btstack_corefoundation_data_source_helper_t;
 
+static uint32_t btstack_run_loop_corefoundation_get_time_ms(void);
+
 static void theCFRunLoopTimerCallBack (CFRunLoopTimerRef timer,void *info){
     btstack_timer_source_t * ts = (btstack_timer_source_t*)info;
-    ts->process(ts);
+    btstack_run_loop_base_process_timer(ts, btstack_run_loop_corefoundation_get_time_ms());
 }
 
 static void socketDataCallback (
@@ -84,11 +86,11 @@ static void socketDataCallback (
 
     if ((callbackType == kCFSocketReadCallBack) && (ds->flags & DATA_SOURCE_CALLBACK_READ)){
         // printf("btstack_run_loop_corefoundation_ds %x - fd %u, CFSocket %x, CFRunLoopSource %x\n", (int) ds, ds->source.fd, (int) s, (int) ds->item.next);
-        ds->process(ds, DATA_SOURCE_CALLBACK_READ);
+        btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_READ);
     }
     if ((callbackType == kCFSocketWriteCallBack) && (ds->flags & DATA_SOURCE_CALLBACK_WRITE)){
         // printf("btstack_run_loop_corefoundation_ds %x - fd %u, CFSocket %x, CFRunLoopSource %x\n", (int) ds, ds->source.fd, (int) s, (int) ds->item.next);
-        ds->process(ds, DATA_SOURCE_CALLBACK_WRITE);
+        btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_WRITE);
     }
 }
 
@@ -230,7 +232,7 @@ static void btstack_run_loop_corefoundation_pipe_process(btstack_data_source_t *
         if (callback_registration == NULL){
             break;
         }
-        (*callback_registration->callback)(callback_registration->context);
+        btstack_run_loop_base_execute_callback(callback_registration);
     }
 }
 
@@ -70,6 +70,7 @@
 #include <arpa/inet.h>
 #include <netdb.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/un.h>
 #endif
  
@@ -100,6 +101,19 @@ struct sockaddr_un {
 
 #define MAX_PENDING_CONNECTIONS 10
 
+// outgoing data queued per connection above which reading from the client is suspended
+#ifndef SOCKET_CONNECTION_HIGH_WATER_MARK
+#define SOCKET_CONNECTION_HIGH_WATER_MARK (64 * 1024)
+#endif
+
+// outgoing data queued per connection above which the connection is closed, 0 = no limit
+#ifndef SOCKET_CONNECTION_MAX_QUEUED_BYTES
+#define SOCKET_CONNECTION_MAX_QUEUED_BYTES (1024 * 1024)
+#endif
+
+// max number of queued packets written with a single writev
+#define SOCKET_CONNECTION_MAX_IOVEC 16
+
 /** prototypes */
 static void socket_connection_hci_process(btstack_data_source_t *ds, btstack_data_source_callback_type_t callback_type);
 static int socket_connection_dummy_handler(connection_t *connection, uint16_t packet_type, uint16_t channel, uint8_t *data, uint16_t length);
@@ -124,6 +138,20 @@ typedef struct linked_connection {
     connection_t * connection;
 } linked_connection_t;
 
+/** packet header + payload, shared by all connections it is queued on */
+typedef struct socket_connection_buffer {
+    uint16_t ref_count;
+    uint32_t size;
+    uint8_t  data[];
+} socket_connection_buffer_t;
+
+/** entry in outgoing queue of a connection */
+typedef struct socket_connection_queue_entry {
+    btstack_linked_item_t item;
+    socket_connection_buffer_t * buffer;
+    uint32_t offset;
+} socket_connection_queue_entry_t;
+
 struct connection {
     btstack_data_source_t ds;                // used for run loop
     linked_connection_t linked_connection;   // used for connection list
@@ -132,12 +160,20 @@ struct connection {
     uint16_t bytes_read;
     uint16_t bytes_to_read;
     uint8_t  buffer[6+HCI_ACL_BUFFER_SIZE]; // packet_header(6) + max packet: 3-DH5 = header(6) + payload (1021)
+    // outgoing queue
+    btstack_linked_list_t tx_queue;
+    uint32_t tx_queued_bytes;
+    uint8_t  tx_throttled;                   // reading suspended as tx_queued_bytes > high water mark
+    uint8_t  tx_overflow;                    // max queued bytes exceeded, connection gets closed
 };
 
 /** list of socket connections */
 static btstack_linked_list_t connections = NULL;
 static btstack_linked_list_t parked = NULL;
 
+static uint32_t socket_connection_high_water_mark  = SOCKET_CONNECTION_HIGH_WATER_MARK;
+static uint32_t socket_connection_max_queued_bytes = SOCKET_CONNECTION_MAX_QUEUED_BYTES;
+
 #ifdef _WIN32
 // workaround as btstack_data_source_t only stores windows event (instead of fd)
 static int tcp_socket_fd;
@@ -156,7 +192,26 @@ static int socket_connection_dummy_handler(connection_t *connection, uint16_t pa
     return 0;
 }
 
+static void socket_connection_buffer_release(socket_connection_buffer_t * buffer){
+    buffer->ref_count--;
+    if (buffer->ref_count == 0){
+        free(buffer);
+    }
+}
+
+static void socket_connection_tx_queue_clear(connection_t *conn){
+    while (conn->tx_queue != NULL){
+        socket_connection_queue_entry_t * entry = (socket_connection_queue_entry_t *) btstack_linked_list_pop(&conn->tx_queue);
+        socket_connection_buffer_release(entry->buffer);
+        free(entry);
+    }
+    conn->tx_queued_bytes = 0;
+}
+
 static void socket_connection_free_connection(connection_t *conn){
+    // drop pending outgoing data
+    socket_connection_tx_queue_clear(conn);
+
     // remove from run_loop 
     btstack_run_loop_remove_data_source(&conn->ds);
     
@@ -191,6 +246,14 @@ static connection_t * socket_connection_register_new_connection(int fd){
     // keep fd around
     conn->socket_fd = fd;
 
+#ifndef _WIN32
+    // use non-blocking io, outgoing data is queued if socket buffer is full
+    int flags = fcntl(fd, F_GETFL, 0);
+    if ((flags < 0) || (fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)){
+        log_error("socket_connection: failed to set O_NONBLOCK on fd %d, error: %s", fd, strerror(errno));
+    }
+#endif
+
 #ifdef _WIN32
     // wrap fd in windows event and configure for accept and close
     WSAEVENT event = WSACreateEvent();
@@ -238,12 +301,127 @@ void static socket_connection_emit_connection_closed(connection_t *connection){
     (*socket_connection_packet_callback)(connection, DAEMON_EVENT_PACKET, 0, (uint8_t *) &event, 1);
 }
 
+#ifndef _WIN32
+
+static void socket_connection_tx_update(connection_t *conn){
+    // get notified when socket becomes writable while data is queued
+    if (conn->tx_queue != NULL){
+        btstack_run_loop_enable_data_source_callbacks(&conn->ds, DATA_SOURCE_CALLBACK_WRITE);
+    } else {
+        btstack_run_loop_disable_data_source_callbacks(&conn->ds, DATA_SOURCE_CALLBACK_WRITE);
+    }
+
+    // backpressure: stop reading from client above high water mark, resume when drained to half of it
+    if (conn->tx_overflow) return;
+    if (conn->tx_throttled == 0){
+        if ((socket_connection_high_water_mark > 0) && (conn->tx_queued_bytes > socket_connection_high_water_mark)){
+            log_info("socket_connection fd %d: %u bytes queued -> suspend reading", conn->socket_fd, (unsigned int) conn->tx_queued_bytes);
+            conn->tx_throttled = 1;
+            btstack_run_loop_disable_data_source_callbacks(&conn->ds, DATA_SOURCE_CALLBACK_READ);
+        }
+    } else {
+        if (conn->tx_queued_bytes <= (socket_connection_high_water_mark / 2)){
+            log_info("socket_connection fd %d: %u bytes queued -> resume reading", conn->socket_fd, (unsigned int) conn->tx_queued_bytes);
+            conn->tx_throttled = 0;
+            btstack_run_loop_enable_data_source_callbacks(&conn->ds, DATA_SOURCE_CALLBACK_READ);
+        }
+    }
+}
+
+static void socket_connection_tx_overflow(connection_t *conn){
+    log_error("socket_connection fd %d: more than %u bytes queued -> close connection", conn->socket_fd,
+              (unsigned int) socket_connection_max_queued_bytes);
+    conn->tx_overflow = 1;
+    conn->tx_throttled = 0;
+    socket_connection_tx_queue_clear(conn);
+    // connection is closed when reading EOF from run loop, as caller might still use it
+    shutdown(conn->socket_fd, SHUT_RDWR);
+    btstack_run_loop_enable_data_source_callbacks(&conn->ds, DATA_SOURCE_CALLBACK_READ);
+    btstack_run_loop_disable_data_source_callbacks(&conn->ds, DATA_SOURCE_CALLBACK_WRITE);
+}
+
+static void socket_connection_tx_flush(connection_t *conn){
+    while (conn->tx_queue != NULL){
+        // collect queued packets
+        struct iovec iov[SOCKET_CONNECTION_MAX_IOVEC];
+        int iovcnt = 0;
+        size_t bytes_to_write = 0;
+        btstack_linked_item_t * it;
+        for (it = conn->tx_queue; (it != NULL) && (iovcnt < SOCKET_CONNECTION_MAX_IOVEC); it = it->next){
+            socket_connection_queue_entry_t * entry = (socket_connection_queue_entry_t *) it;
+            iov[iovcnt].iov_base = &entry->buffer->data[entry->offset];
+            iov[iovcnt].iov_len  = entry->buffer->size - entry->offset;
+            bytes_to_write += iov[iovcnt].iov_len;
+            iovcnt++;
+        }
+
+        ssize_t res = writev(conn->socket_fd, iov, iovcnt);
+        if (res < 0){
+            if (errno == EINTR) continue;
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)){
+                // connection broken, drop queued data. connection gets closed by read
+                log_info("socket_connection fd %d: writev failed, error: %s", conn->socket_fd, strerror(errno));
+                socket_connection_tx_queue_clear(conn);
+            }
+            break;
+        }
+
+        // drop written packets
+        size_t bytes_written = (size_t) res;
+        conn->tx_queued_bytes -= (uint32_t) bytes_written;
+        while (bytes_written > 0){
+            socket_connection_queue_entry_t * entry = (socket_connection_queue_entry_t *) conn->tx_queue;
+            uint32_t bytes_pending = entry->buffer->size - entry->offset;
+            if (bytes_written < bytes_pending){
+                entry->offset += (uint32_t) bytes_written;
+                break;
+            }
+            bytes_written -= bytes_pending;
+            (void) btstack_linked_list_pop(&conn->tx_queue);
+            socket_connection_buffer_release(entry->buffer);
+            free(entry);
+        }
+
+        // socket buffer full
+        if ((size_t) res < bytes_to_write) break;
+    }
+    socket_connection_tx_update(conn);
+}
+
+static void socket_connection_tx_enqueue(connection_t *conn, socket_connection_buffer_t * buffer, uint32_t offset){
+    uint32_t bytes_pending = buffer->size - offset;
+    if ((socket_connection_max_queued_bytes > 0) && ((conn->tx_queued_bytes + bytes_pending) > socket_connection_max_queued_bytes)){
+        socket_connection_tx_overflow(conn);
+        return;
+    }
+    socket_connection_queue_entry_t * entry = malloc(sizeof(socket_connection_queue_entry_t));
+    if (entry == NULL){
+        log_error("socket_connection fd %d: no memory to queue packet", conn->socket_fd);
+        return;
+    }
+    buffer->ref_count++;
+    entry->buffer = buffer;
+    entry->offset = offset;
+    btstack_linked_list_add_tail(&conn->tx_queue, &entry->item);
+    conn->tx_queued_bytes += bytes_pending;
+    socket_connection_tx_update(conn);
+}
+
+#endif
+
 void socket_connection_hci_process(btstack_data_source_t *socket_ds, btstack_data_source_callback_type_t callback_type) {
     UNUSED(callback_type);
     connection_t *conn = (connection_t *) socket_ds;
 
     log_debug("socket_connection_hci_process, callback %x", callback_type);
 
+#ifndef _WIN32
+    if (callback_type == DATA_SOURCE_CALLBACK_WRITE){
+        socket_connection_tx_flush(conn);
+        return;
+    }
+#endif
+
     // get socket_fd
     int socket_fd = conn->socket_fd;
 
@@ -267,6 +445,10 @@ void socket_connection_hci_process(btstack_data_source_t *socket_ds, btstack_dat
 #endif
 
     log_debug("socket_connection_hci_process fd %x, bytes read %d", socket_fd, bytes_read);
+#ifndef _WIN32
+    // non-blocking socket
+    if ((bytes_read < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR))) return;
+#endif
     if (bytes_read <= 0){
         // connection broken (no particular channel, no date yet)
         socket_connection_emit_connection_closed(conn);
@@ -323,6 +505,19 @@ void socket_connection_retry_parked(void){
     btstack_linked_item_t *it = (btstack_linked_item_t *) &parked;
     while (it->next) {
         connection_t * conn = (connection_t *) it->next;
+
+#ifndef _WIN32
+        // write callbacks are not delivered while parked
+        if (conn->tx_queue != NULL){
+            socket_connection_tx_flush(conn);
+        }
+        // let run loop close connection after queue overflow
+        if (conn->tx_overflow){
+            it->next = it->next->next;
+            btstack_run_loop_add_data_source( (btstack_data_source_t *) conn);
+            continue;
+        }
+#endif
         
         // dispatch packet !!! connection, type, channel, data, size
         uint16_t packet_type = little_endian_read_16( conn->buffer, 0);
@@ -556,37 +751,109 @@ void socket_connection_register_packet_callback( int (*packet_callback)(connecti
 }
 
 /**
- * send HCI packet to single connection
+ * set limits for outgoing data queued per connection
  */
-void socket_connection_send_packet(connection_t *conn, uint16_t type, uint16_t channel, uint8_t *packet, uint16_t size){
-    uint8_t header[sizeof(packet_header_t)];
-    little_endian_store_16(header, 0, type);
-    little_endian_store_16(header, 2, channel);
-    little_endian_store_16(header, 4, size);
+void socket_connection_set_tx_limits(uint32_t high_water_mark, uint32_t max_queued_bytes){
+    socket_connection_high_water_mark  = high_water_mark;
+    socket_connection_max_queued_bytes = max_queued_bytes;
+}
+
+/**
+ * send packet with prepared header. write directly if nothing is queued, otherwise queue shared buffer
+ * which is created on first use
+ */
+static void socket_connection_send_with_header(connection_t *conn, uint8_t *header, uint8_t *packet, uint16_t size, socket_connection_buffer_t ** shared_buffer){
+#ifdef _WIN32
+    UNUSED(shared_buffer);
     // avoid -Wunused-result
     int res;
-#ifdef _WIN32
     int flags = 0;
-    res = send(conn->socket_fd, (const char *) header, 6, flags);
+    res = send(conn->socket_fd, (const char *) header, sizeof(packet_header_t), flags);
     res = send(conn->socket_fd, (const char *) packet, size, flags);
+    UNUSED(res);
 #else
-    res = write(conn->socket_fd, header, 6);
-    res = write(conn->socket_fd, packet, size);
+    if (conn->tx_overflow) return;
+
+    uint32_t bytes_to_write = sizeof(packet_header_t) + size;
+    uint32_t offset = 0;
+    if (conn->tx_queue == NULL){
+        // zero-copy: header and payload from caller
+        struct iovec iov[2];
+        iov[0].iov_base = header;
+        iov[0].iov_len  = sizeof(packet_header_t);
+        iov[1].iov_base = packet;
+        iov[1].iov_len  = size;
+        ssize_t res;
+        do {
+            res = writev(conn->socket_fd, iov, 2);
+        } while ((res < 0) && (errno == EINTR));
+        if (res < 0){
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK)){
+                // connection broken, drop packet. connection gets closed by read
+                return;
+            }
+            res = 0;
+        }
+        offset = (uint32_t) res;
+        if (offset == bytes_to_write) return;
+    }
+
+    // copy packet once for all connections
+    socket_connection_buffer_t * buffer = *shared_buffer;
+    if (buffer == NULL){
+        buffer = malloc(sizeof(socket_connection_buffer_t) + bytes_to_write);
+        if (buffer == NULL){
+            log_error("socket_connection fd %d: no memory to queue packet", conn->socket_fd);
+            return;
+        }
+        buffer->ref_count = 0;
+        buffer->size = bytes_to_write;
+        (void) memcpy(&buffer->data[0], header, sizeof(packet_header_t));
+        (void) memcpy(&buffer->data[sizeof(packet_header_t)], packet, size);
+        *shared_buffer = buffer;
+    }
+    socket_connection_tx_enqueue(conn, buffer, offset);
 #endif
-    UNUSED(res);
+}
+
+static void socket_connection_store_header(uint8_t *header, uint16_t type, uint16_t channel, uint16_t size){
+    little_endian_store_16(header, 0, type);
+    little_endian_store_16(header, 2, channel);
+    little_endian_store_16(header, 4, size);
+}
+
+static void socket_connection_free_unused_buffer(socket_connection_buffer_t * buffer){
+    if ((buffer != NULL) && (buffer->ref_count == 0)){
+        free(buffer);
+    }
+}
+
+/**
+ * send HCI packet to single connection
+ */
+void socket_connection_send_packet(connection_t *conn, uint16_t type, uint16_t channel, uint8_t *packet, uint16_t size){
+    uint8_t header[sizeof(packet_header_t)];
+    socket_connection_store_header(header, type, channel, size);
+    socket_connection_buffer_t * buffer = NULL;
+    socket_connection_send_with_header(conn, header, packet, size, &buffer);
+    socket_connection_free_unused_buffer(buffer);
 }
 
 /**
  * send HCI packet to all connections 
  */
 void socket_connection_send_packet_all(uint16_t type, uint16_t channel, uint8_t *packet, uint16_t size){
+    uint8_t header[sizeof(packet_header_t)];
+    socket_connection_store_header(header, type, channel, size);
+    socket_connection_buffer_t * buffer = NULL;
     btstack_linked_item_t *next;
     btstack_linked_item_t *it;
     for (it = (btstack_linked_item_t *) connections; it ; it = next){
         next = it->next; // cache pointer to next connection_t to allow for removal
         linked_connection_t * linked_connection = (linked_connection_t *) it;
-        socket_connection_send_packet( linked_connection->connection, type, channel, packet, size);
+        socket_connection_send_with_header(linked_connection->connection, header, packet, size, &buffer);
     }
+    socket_connection_free_unused_buffer(buffer);
 }
 
 /**
@@ -107,6 +107,13 @@ int socket_connection_close_unix(connection_t *connection);
  */
 void socket_connection_register_packet_callback( int (*packet_callback)(connection_t *connection, uint16_t packet_type, uint16_t channel, uint8_t *data, uint16_t length) );
 
+/**
+ * set limits for outgoing data queued per connection if client does not read fast enough
+ * @param high_water_mark in bytes. reading from client is suspended until queue drained to half of it. 0 = disabled
+ * @param max_queued_bytes in bytes. connection is closed if exceeded. 0 = no limit
+ */
+void socket_connection_set_tx_limits(uint32_t high_water_mark, uint32_t max_queued_bytes);
+
 /**
  * send HCI packet to single connection
  */
@@ -169,7 +169,7 @@ static void btstack_run_loop_freertos_execute(void) {
             if (callback_registration == NULL){
                 break;
             }
-            (*callback_registration->callback)(callback_registration->context);
+            btstack_run_loop_base_execute_callback(callback_registration);
         }
 
         // process registered function calls on run loop thread (deprecated)
@@ -88,11 +88,38 @@
 #define HAVE_USB_VENDOR_ID_AND_PRODUCT_ID
 #endif
 
-#define ACL_IN_BUFFER_COUNT    3
-#define EVENT_IN_BUFFER_COUNT  3
+// number of HCI Event and ACL/ISO Data transfers kept submitted for incoming packets
+#ifndef HCI_USB_EVENT_IN_BUFFER_COUNT
+#define HCI_USB_EVENT_IN_BUFFER_COUNT 3
+#endif
+#ifndef HCI_USB_ACL_IN_BUFFER_COUNT
+#define HCI_USB_ACL_IN_BUFFER_COUNT   3
+#endif
+
+// max number of outgoing ACL/ISO Data transfers in flight
+#ifndef HCI_USB_ACL_OUT_BUFFER_COUNT
+#define HCI_USB_ACL_OUT_BUFFER_COUNT  4
+#endif
+
+#define ACL_IN_BUFFER_COUNT    HCI_USB_ACL_IN_BUFFER_COUNT
+#ifdef ENABLE_HCI_USB_ZERO_COPY
+// transfers reference the single HCI packet buffer, next fragment can only be prepared after completion
+#define ACL_OUT_BUFFER_COUNT   1
+#else
+#define ACL_OUT_BUFFER_COUNT   HCI_USB_ACL_OUT_BUFFER_COUNT
+#endif
+#define EVENT_IN_BUFFER_COUNT  HCI_USB_EVENT_IN_BUFFER_COUNT
 #define EVENT_OUT_BUFFER_COUNT 4
 #define SCO_IN_BUFFER_COUNT   10
 
+// ACL and ISO Data are both sent and received over the bulk endpoints
+#ifdef ENABLE_LE_ISOCHRONOUS_STREAMS
+#define USB_ISO_BUFFER_SIZE  (HCI_ISO_HEADER_SIZE + HCI_ISO_PAYLOAD_SIZE)
+#define USB_BULK_BUFFER_SIZE ((HCI_ACL_BUFFER_SIZE > USB_ISO_BUFFER_SIZE) ? HCI_ACL_BUFFER_SIZE : USB_ISO_BUFFER_SIZE)
+#else
+#define USB_BULK_BUFFER_SIZE HCI_ACL_BUFFER_SIZE
+#endif
+
 #define ASYNC_POLLING_INTERVAL_MS 1
 
 //
@@ -264,7 +291,8 @@ static usb_transfer_list_t *usb_transfer_list_alloc( int nbr, int iso_packets, i
     {
         usb_transfer_list_entry_t *entry = &list->entries[i];
         struct libusb_transfer *transfer = libusb_alloc_transfer(iso_packets);
-        entry->data = malloc( length );
+        // transfers without own buffer point to the packet provided by HCI
+        entry->data = (length > 0) ? malloc( length ) : NULL;
         transfer->buffer = entry->data;
         transfer->user_data = entry;
         entry->t = transfer;
@@ -324,6 +352,10 @@ void usb_transfer_list_free( usb_transfer_list_t *list ) {
 
 static usb_transfer_list_t *default_transfer_list = NULL;
 
+// outgoing ACL and ISO Data
+static usb_transfer_list_t *acl_out_transfer_list = NULL;
+static bool acl_out_blocked;
+
 // For (ab)use as a linked list of received packets
 static list_head_t handle_packet_list = LIST_HEAD_INIT(handle_packet_list);
 
@@ -449,7 +481,9 @@ LIBUSB_CALL static void async_callback(struct libusb_transfer *transfer) {
             usb_transfer_list_release( sco_transfer_list, transfer );
         } else
 #endif
-        {
+        if (transfer->endpoint == acl_out_addr) {
+            usb_transfer_list_release( acl_out_transfer_list, transfer );
+        } else {
             usb_transfer_list_release( default_transfer_list, transfer );
         }
     } else {
@@ -560,8 +594,18 @@ static void handle_completed_transfer(struct libusb_transfer *transfer){
         usb_transfer_list_release( default_transfer_list, transfer );
     } else if (transfer->endpoint == acl_out_addr){
         // log_info("acl out done, size %u", transfer->actual_length);
-//        printf("%s acl release\n", __FUNCTION__ );
-        usb_transfer_list_release( default_transfer_list, transfer );
+        usb_transfer_list_release( acl_out_transfer_list, transfer );
+#ifdef ENABLE_HCI_USB_ZERO_COPY
+        // transfer referenced HCI packet buffer, which can be re-used now
+        acl_out_blocked = false;
+        signal_acknowledge();
+#else
+        // packet was already acknowledged when queued, only notify if HCI had to wait for a free transfer
+        if (acl_out_blocked){
+            acl_out_blocked = false;
+            signal_acknowledge();
+        }
+#endif
 #ifdef ENABLE_SCO_OVER_HCI
     } else if (transfer->endpoint == sco_in_addr) {
         // log_info("handle_completed_transfer for SCO IN! num packets %u", transfer->NUM_ISO_PACKETS);
@@ -890,6 +934,7 @@ static int prepare_device(libusb_device_handle * aHandle){
     return 0;
 }
 
+#ifndef HAVE_USB_VENDOR_ID_AND_PRODUCT_ID
 static libusb_device_handle * try_open_device(libusb_device * device){
     int r;
 
@@ -923,6 +968,7 @@ static libusb_device_handle * try_open_device(libusb_device * device){
 #endif
     return dev_handle;
 }
+#endif
 
 #ifdef ENABLE_SCO_OVER_HCI
 static int usb_sco_start(void){
@@ -1161,7 +1207,15 @@ static int usb_open(void){
     default_transfer_list = usb_transfer_list_alloc(
             EVENT_OUT_BUFFER_COUNT+EVENT_IN_BUFFER_COUNT+ACL_IN_BUFFER_COUNT,
             0,
-            LIBUSB_CONTROL_SETUP_SIZE + HCI_INCOMING_PRE_BUFFER_SIZE + HCI_ACL_BUFFER_SIZE ); // biggest packet ever to expect
+            LIBUSB_CONTROL_SETUP_SIZE + HCI_INCOMING_PRE_BUFFER_SIZE + USB_BULK_BUFFER_SIZE ); // biggest packet ever to expect
+
+#ifdef ENABLE_HCI_USB_ZERO_COPY
+    // outgoing transfers reference HCI packet buffer
+    acl_out_transfer_list = usb_transfer_list_alloc( ACL_OUT_BUFFER_COUNT, 0, 0 );
+#else
+    acl_out_transfer_list = usb_transfer_list_alloc( ACL_OUT_BUFFER_COUNT, 0, USB_BULK_BUFFER_SIZE );
+#endif
+    acl_out_blocked = false;
 
 #ifdef ENABLE_SCO_OVER_HCI
     sco_transfer_list = usb_transfer_list_alloc(
@@ -1197,7 +1251,7 @@ static int usb_open(void){
         void *user_data = transfer->user_data;
         // configure acl_in handlers
         libusb_fill_bulk_transfer(transfer, handle, acl_in_addr,
-                data + HCI_INCOMING_PRE_BUFFER_SIZE, HCI_ACL_BUFFER_SIZE, async_callback, user_data, 0) ;
+                data + HCI_INCOMING_PRE_BUFFER_SIZE, USB_BULK_BUFFER_SIZE, async_callback, user_data, 0) ;
         r = libusb_submit_transfer(transfer);
         if (r) {
             log_error("Error submitting bulk in transfer %d", r);
@@ -1290,11 +1344,13 @@ static int usb_close(void) {
         case LIB_USB_INTERFACE_CLAIMED:
             libusb_set_pollfd_notifiers( NULL, NULL, NULL, NULL );
             usb_transfer_list_cancel( default_transfer_list );
+            usb_transfer_list_cancel( acl_out_transfer_list );
 #ifdef ENABLE_SCO_OVER_HCI
             usb_transfer_list_cancel( sco_transfer_list );
 #endif
 
             int in_flight_transfers = usb_transfer_list_in_flight( default_transfer_list );
+            in_flight_transfers += usb_transfer_list_in_flight( acl_out_transfer_list );
 #ifdef ENABLE_SCO_OVER_HCI
             in_flight_transfers += usb_transfer_list_in_flight( sco_transfer_list );
 #endif
@@ -1303,12 +1359,14 @@ static int usb_close(void) {
                 libusb_handle_events_timeout(NULL, &tv);
 
                 in_flight_transfers = usb_transfer_list_in_flight( default_transfer_list );
+                in_flight_transfers += usb_transfer_list_in_flight( acl_out_transfer_list );
 #ifdef ENABLE_SCO_OVER_HCI
                 in_flight_transfers += usb_transfer_list_in_flight( sco_transfer_list );
 #endif
             }
 
             usb_transfer_list_free( default_transfer_list );
+            usb_transfer_list_free( acl_out_transfer_list );
 #ifdef ENABLE_SCO_OVER_HCI
             usb_transfer_list_free( sco_transfer_list );
             sco_enabled = 0;
@@ -1402,18 +1460,28 @@ static int usb_send_cmd_packet(uint8_t *packet, int size){
     return 0;
 }
 
-static int usb_send_acl_packet(uint8_t *packet, int size){
+// ACL and ISO Data packets
+static int usb_send_bulk_packet(uint8_t *packet, int size){
     int r;
 
     if (libusb_state != LIB_USB_TRANSFERS_ALLOCATED) return -1;
-//   printf("%s( %p, %d )\n", __FUNCTION__, packet, size );
-    // log_info("usb_send_acl_packet enter, size %u", size);
+    // log_info("usb_send_bulk_packet enter, size %u", size);
 
-    struct libusb_transfer *transfer = usb_transfer_list_acquire( default_transfer_list );
-    uint8_t *data = transfer->buffer;
+    if (usb_transfer_list_empty( acl_out_transfer_list )) {
+        log_error("acl transfers shouldn't be empty!");
+        return -1;
+    }
+
+    struct libusb_transfer *transfer = usb_transfer_list_acquire( acl_out_transfer_list );
 
     // prepare transfer
+#ifdef ENABLE_HCI_USB_ZERO_COPY
+    // send directly from HCI packet buffer, acknowledged on completion
+    uint8_t *data = packet;
+#else
+    uint8_t *data = transfer->buffer;
     memcpy( data, packet, size );
+#endif
     libusb_fill_bulk_transfer(transfer, handle, acl_out_addr, data, size,
         async_callback, transfer->user_data, 0);
 
@@ -1421,14 +1489,26 @@ static int usb_send_acl_packet(uint8_t *packet, int size){
 
     if (r < 0) {
         log_error("Error submitting acl transfer, %d", r);
+        usb_transfer_list_release( acl_out_transfer_list, transfer );
         return -1;
     }
 
+#ifndef ENABLE_HCI_USB_ZERO_COPY
     signal_acknowledge();
+#endif
 
     return 0;
 }
 
+static int usb_can_send_bulk_packet_now(void){
+    if (usb_transfer_list_empty( acl_out_transfer_list )) {
+        // notify HCI when the next transfer completes
+        acl_out_blocked = true;
+        return 0;
+    }
+    return 1;
+}
+
 static int usb_can_send_packet_now(uint8_t packet_type){
     switch (packet_type){
         case HCI_COMMAND_DATA_PACKET: {
@@ -1438,13 +1518,11 @@ static int usb_can_send_packet_now(uint8_t packet_type){
             }
             return ret;
         }
-        case HCI_ACL_DATA_PACKET: {
-            int ret = !usb_transfer_list_empty( default_transfer_list );
-            if( !ret ) {
-                log_error("acl transfers shouldn't be empty!");
-            }
-            return ret;
-        }
+        case HCI_ACL_DATA_PACKET:
+#ifdef ENABLE_LE_ISOCHRONOUS_STREAMS
+        case HCI_ISO_DATA_PACKET:
+#endif
+            return usb_can_send_bulk_packet_now();
 
 #ifdef ENABLE_SCO_OVER_HCI
         case HCI_SCO_DATA_PACKET: {
@@ -1466,7 +1544,10 @@ static int usb_send_packet(uint8_t packet_type, uint8_t * packet, int size){
         case HCI_COMMAND_DATA_PACKET:
             return usb_send_cmd_packet(packet, size);
         case HCI_ACL_DATA_PACKET:
-            return usb_send_acl_packet(packet, size);
+#ifdef ENABLE_LE_ISOCHRONOUS_STREAMS
+        case HCI_ISO_DATA_PACKET:
+#endif
+            return usb_send_bulk_packet(packet, size);
 #ifdef ENABLE_SCO_OVER_HCI
         case HCI_SCO_DATA_PACKET:
             if (!sco_enabled) return -1;
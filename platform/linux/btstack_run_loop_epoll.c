@@ -0,0 +1,467 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "btstack_run_loop_epoll.c"
+
+/*
+ *  btstack_run_loop_epoll.c
+ *
+ *  Linux run loop:
+ *  - data sources are registered with epoll once and only modified when enabled callbacks change
+ *  - timers are mapped to a single timerfd which is re-armed when the first timer changes
+ *  - execute_on_main_thread, poll_data_sources_from_irq and trigger_exit are signalled via eventfds
+ */
+
+// enable GNU extensions for epoll/timerfd/eventfd
+#define _GNU_SOURCE
+
+#include "btstack_run_loop_epoll.h"
+
+#include "btstack_run_loop.h"
+#include "btstack_util.h"
+#include "btstack_linked_list.h"
+#include "btstack_debug.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+
+// max number of ready file descriptors returned by a single epoll_wait
+#ifndef BTSTACK_RUN_LOOP_EPOLL_MAX_EVENTS
+#define BTSTACK_RUN_LOOP_EPOLL_MAX_EVENTS 64
+#endif
+
+static int  btstack_run_loop_epoll_fd = -1;
+static bool btstack_run_loop_epoll_exit_requested;
+
+// ready events of current epoll_wait, entries are invalidated when their data source gets removed
+static struct epoll_event btstack_run_loop_epoll_events[BTSTACK_RUN_LOOP_EPOLL_MAX_EVENTS];
+static int btstack_run_loop_epoll_num_events;
+
+// timerfd for timer list
+static int                   btstack_run_loop_epoll_timer_fd = -1;
+static btstack_data_source_t btstack_run_loop_epoll_timer_ds;
+static bool                  btstack_run_loop_epoll_timer_armed;
+static btstack_time_t        btstack_run_loop_epoll_timer_armed_timeout;
+
+// to trigger process callbacks other thread
+static pthread_mutex_t       btstack_run_loop_epoll_callbacks_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int                   btstack_run_loop_epoll_process_callbacks_fd = -1;
+static btstack_data_source_t btstack_run_loop_epoll_process_callbacks_ds;
+
+// to trigger poll data sources from irq
+static int                   btstack_run_loop_epoll_poll_data_sources_fd = -1;
+static btstack_data_source_t btstack_run_loop_epoll_poll_data_sources_ds;
+
+// to wake up epoll_wait on trigger exit
+static int                   btstack_run_loop_epoll_exit_fd = -1;
+static btstack_data_source_t btstack_run_loop_epoll_exit_ds;
+
+// start time. tv_nsec = 0
+static struct timespec btstack_run_loop_epoll_init_ts;
+
+static uint32_t btstack_run_loop_epoll_events_for_flags(uint16_t flags){
+    uint32_t events = 0;
+    if (flags & DATA_SOURCE_CALLBACK_READ){
+        events |= EPOLLIN;
+    }
+    if (flags & DATA_SOURCE_CALLBACK_WRITE){
+        events |= EPOLLOUT;
+    }
+    return events;
+}
+
+static bool btstack_run_loop_epoll_data_source_registered(btstack_data_source_t * ds){
+    btstack_linked_item_t * it;
+    for (it = (btstack_linked_item_t *) btstack_run_loop_base_data_sources; it != NULL ; it = it->next){
+        if (it == (btstack_linked_item_t *) ds) return true;
+    }
+    return false;
+}
+
+static void btstack_run_loop_epoll_ctl(int op, btstack_data_source_t * ds){
+    struct epoll_event event;
+    event.events   = btstack_run_loop_epoll_events_for_flags(ds->flags);
+    event.data.ptr = ds;
+    int res = epoll_ctl(btstack_run_loop_epoll_fd, op, ds->source.fd, &event);
+    if (res < 0){
+        log_error("epoll_ctl op %u for fd %d -> errno %u", op, ds->source.fd, errno);
+    }
+}
+
+// update kernel interest set after flags have changed
+static void btstack_run_loop_epoll_update_data_source(btstack_data_source_t * ds){
+    if (ds->source.fd < 0) return;
+    if (btstack_run_loop_epoll_fd < 0) return;
+    // fds without enabled callbacks are removed to avoid wake-ups on EPOLLHUP/EPOLLERR
+    uint32_t events = btstack_run_loop_epoll_events_for_flags(ds->flags);
+    struct epoll_event event;
+    event.events   = events;
+    event.data.ptr = ds;
+    if (events == 0){
+        (void) epoll_ctl(btstack_run_loop_epoll_fd, EPOLL_CTL_DEL, ds->source.fd, &event);
+        return;
+    }
+    int res = epoll_ctl(btstack_run_loop_epoll_fd, EPOLL_CTL_MOD, ds->source.fd, &event);
+    if ((res < 0) && (errno == ENOENT)){
+        // not in interest set: either not added to run loop yet or all callbacks were disabled before
+        if (btstack_run_loop_epoll_data_source_registered(ds)){
+            btstack_run_loop_epoll_ctl(EPOLL_CTL_ADD, ds);
+        }
+    }
+}
+
+/**
+ * Add data_source to run_loop
+ */
+static void btstack_run_loop_epoll_add_data_source(btstack_data_source_t *ds){
+    btstack_run_loop_base_add_data_source(ds);
+    if (ds->source.fd < 0) return;
+    if (btstack_run_loop_epoll_events_for_flags(ds->flags) == 0) return;
+    btstack_run_loop_epoll_ctl(EPOLL_CTL_ADD, ds);
+}
+
+/**
+ * Remove data_source from run loop
+ */
+static bool btstack_run_loop_epoll_remove_data_source(btstack_data_source_t *ds){
+    if (ds->source.fd >= 0){
+        struct epoll_event event = { 0 };
+        // fails if fd was already closed or no callbacks were enabled
+        (void) epoll_ctl(btstack_run_loop_epoll_fd, EPOLL_CTL_DEL, ds->source.fd, &event);
+    }
+    // invalidate pending ready events for this data source
+    int i;
+    for (i = 0; i < btstack_run_loop_epoll_num_events; i++){
+        if (btstack_run_loop_epoll_events[i].data.ptr == ds){
+            btstack_run_loop_epoll_events[i].data.ptr = NULL;
+        }
+    }
+    return btstack_run_loop_base_remove_data_source(ds);
+}
+
+static void btstack_run_loop_epoll_enable_data_source_callbacks(btstack_data_source_t * ds, uint16_t callback_types){
+    uint16_t old_flags = ds->flags;
+    btstack_run_loop_base_enable_data_source_callbacks(ds, callback_types);
+    if (ds->flags == old_flags) return;
+    btstack_run_loop_epoll_update_data_source(ds);
+}
+
+static void btstack_run_loop_epoll_disable_data_source_callbacks(btstack_data_source_t * ds, uint16_t callback_types){
+    uint16_t old_flags = ds->flags;
+    btstack_run_loop_base_disable_data_source_callbacks(ds, callback_types);
+    if (ds->flags == old_flags) return;
+    btstack_run_loop_epoll_update_data_source(ds);
+}
+
+/**
+ * @brief Returns the milisecond value of (now - start)
+ */
+static uint64_t btstack_run_loop_epoll_get_time_ms_64(void){
+    struct timespec now_ts;
+    clock_gettime(CLOCK_MONOTONIC, &now_ts);
+    uint64_t sec_val  = (uint64_t) (now_ts.tv_sec - btstack_run_loop_epoll_init_ts.tv_sec);
+    uint64_t nsec_val = (uint64_t) now_ts.tv_nsec;
+    return (sec_val * 1000) + (nsec_val / 1000000);
+}
+
+/**
+ * @brief Queries the current time in ms since start
+ */
+static uint32_t btstack_run_loop_epoll_get_time_ms(void){
+    return (uint32_t) btstack_run_loop_epoll_get_time_ms_64();
+}
+
+// set timer
+static void btstack_run_loop_epoll_set_timer(btstack_timer_source_t *a, uint32_t timeout_in_ms){
+    uint32_t time_ms = btstack_run_loop_epoll_get_time_ms();
+    a->timeout = time_ms + timeout_in_ms;
+    log_debug("btstack_run_loop_epoll_set_timer to %u ms (now %u, timeout %u)", a->timeout, time_ms, timeout_in_ms);
+}
+
+// (re-)arm timerfd if first timer in list has changed
+static void btstack_run_loop_epoll_update_timer_fd(void){
+    btstack_timer_source_t * timer = (btstack_timer_source_t *) btstack_run_loop_base_timers;
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+
+    if (timer == NULL){
+        if (btstack_run_loop_epoll_timer_armed == false) return;
+        btstack_run_loop_epoll_timer_armed = false;
+        timerfd_settime(btstack_run_loop_epoll_timer_fd, 0, &spec, NULL);
+        return;
+    }
+
+    if (btstack_run_loop_epoll_timer_armed && (btstack_run_loop_epoll_timer_armed_timeout == timer->timeout)) return;
+
+    // convert to absolute monotonic time. init_ts has tv_nsec = 0, so timerfd fires on a full ms
+    uint64_t now_ms = btstack_run_loop_epoll_get_time_ms_64();
+    int32_t delta_ms = btstack_run_loop_base_get_time_until_timeout((uint32_t) now_ms);
+    uint64_t target_ms = now_ms + (uint64_t) delta_ms;
+    spec.it_value.tv_sec  = btstack_run_loop_epoll_init_ts.tv_sec + (time_t) (target_ms / 1000);
+    spec.it_value.tv_nsec = (long) ((target_ms % 1000) * 1000000);
+    if ((spec.it_value.tv_sec == 0) && (spec.it_value.tv_nsec == 0)){
+        // all zero would disarm timer
+        spec.it_value.tv_nsec = 1;
+    }
+    int res = timerfd_settime(btstack_run_loop_epoll_timer_fd, TFD_TIMER_ABSTIME, &spec, NULL);
+    if (res < 0){
+        log_error("timerfd_settime -> errno %u", errno);
+        return;
+    }
+    btstack_run_loop_epoll_timer_armed = true;
+    btstack_run_loop_epoll_timer_armed_timeout = timer->timeout;
+    log_debug("btstack_run_loop_epoll: timerfd armed for %u ms", (uint32_t) target_ms);
+}
+
+static void btstack_run_loop_epoll_timer_handler(btstack_data_source_t * ds, btstack_data_source_callback_type_t callback_type){
+    UNUSED(callback_type);
+    uint64_t expirations;
+    ssize_t bytes_read = read(ds->source.fd, &expirations, sizeof(expirations));
+    UNUSED(bytes_read);
+    // timers are processed in main loop, re-arm for next timer
+    btstack_run_loop_epoll_timer_armed = false;
+}
+
+static void btstack_run_loop_epoll_dispatch(void){
+    int i;
+    for (i = 0; i < btstack_run_loop_epoll_num_events; i++){
+        btstack_data_source_t * ds = (btstack_data_source_t *) btstack_run_loop_epoll_events[i].data.ptr;
+        if (ds == NULL) continue;
+        uint32_t events = btstack_run_loop_epoll_events[i].events;
+        // report errors and hang-up via enabled callback like select
+        if ((events & (EPOLLIN | EPOLLHUP | EPOLLERR)) && (ds->flags & DATA_SOURCE_CALLBACK_READ)){
+            log_debug("btstack_run_loop_epoll_execute: process read ds %p with fd %u\n", ds, ds->source.fd);
+            btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_READ);
+        }
+        // data source might have been removed by its read callback
+        if (btstack_run_loop_epoll_events[i].data.ptr != ds) continue;
+        if ((events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) && (ds->flags & DATA_SOURCE_CALLBACK_WRITE)){
+            log_debug("btstack_run_loop_epoll_execute: process write ds %p with fd %u\n", ds, ds->source.fd);
+            btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_WRITE);
+        }
+    }
+    btstack_run_loop_epoll_num_events = 0;
+}
+
+/**
+ * Execute run_loop
+ */
+static void btstack_run_loop_epoll_execute(void) {
+    log_info("epoll run loop");
+
+    while (btstack_run_loop_epoll_exit_requested == false) {
+
+        btstack_run_loop_epoll_update_timer_fd();
+
+        // wait for ready FDs
+        int res = epoll_wait(btstack_run_loop_epoll_fd, btstack_run_loop_epoll_events, BTSTACK_RUN_LOOP_EPOLL_MAX_EVENTS, -1);
+        if (res < 0){
+            if (errno != EINTR){
+                log_error("btstack_run_loop_epoll_execute: epoll_wait -> errno %u", errno);
+            }
+            res = 0;
+        }
+        btstack_run_loop_epoll_num_events = res;
+        btstack_run_loop_epoll_dispatch();
+
+        // process timers
+        uint32_t now_ms = btstack_run_loop_epoll_get_time_ms();
+        btstack_run_loop_base_process_timers(now_ms);
+    }
+}
+
+// trigger eventfd
+static void btstack_run_loop_epoll_trigger_eventfd(int fd){
+    if (fd < 0) return;
+    const uint64_t increment = 1;
+    ssize_t bytes_written = write(fd, &increment, sizeof(increment));
+    UNUSED(bytes_written);
+}
+
+static void btstack_run_loop_epoll_drain_eventfd(int fd){
+    uint64_t counter;
+    ssize_t bytes_read = read(fd, &counter, sizeof(counter));
+    UNUSED(bytes_read);
+}
+
+// trigger exit from same or different thread
+
+static void btstack_run_loop_epoll_exit_handler(btstack_data_source_t * ds, btstack_data_source_callback_type_t callback_type){
+    UNUSED(callback_type);
+    // exit_requested is checked in main loop
+    btstack_run_loop_epoll_drain_eventfd(ds->source.fd);
+}
+
+static void btstack_run_loop_epoll_trigger_exit(void){
+    btstack_run_loop_epoll_exit_requested = true;
+    // wake up epoll_wait
+    btstack_run_loop_epoll_trigger_eventfd(btstack_run_loop_epoll_exit_fd);
+}
+
+// poll data sources from irq
+
+static void btstack_run_loop_epoll_poll_data_sources_handler(btstack_data_source_t * ds, btstack_data_source_callback_type_t callback_type){
+    UNUSED(callback_type);
+    btstack_run_loop_epoll_drain_eventfd(ds->source.fd);
+    // poll data sources
+    btstack_run_loop_base_poll_data_sources();
+}
+
+static void btstack_run_loop_epoll_poll_data_sources_from_irq(void){
+    // trigger run loop
+    btstack_run_loop_epoll_trigger_eventfd(btstack_run_loop_epoll_poll_data_sources_fd);
+}
+
+// execute on main thread from same or different thread
+
+static void btstack_run_loop_epoll_process_callbacks_handler(btstack_data_source_t * ds, btstack_data_source_callback_type_t callback_type){
+    UNUSED(callback_type);
+    btstack_run_loop_epoll_drain_eventfd(ds->source.fd);
+    // execute callbacks - protect list with mutex
+    while (1){
+        pthread_mutex_lock(&btstack_run_loop_epoll_callbacks_mutex);
+        btstack_context_callback_registration_t * callback_registration = (btstack_context_callback_registration_t *) btstack_linked_list_pop(&btstack_run_loop_base_callbacks);
+        pthread_mutex_unlock(&btstack_run_loop_epoll_callbacks_mutex);
+        if (callback_registration == NULL){
+            break;
+        }
+        btstack_run_loop_base_execute_callback(callback_registration);
+    }
+}
+
+static void btstack_run_loop_epoll_execute_on_main_thread(btstack_context_callback_registration_t * callback_registration){
+    // protect list with mutex
+    pthread_mutex_lock(&btstack_run_loop_epoll_callbacks_mutex);
+    btstack_run_loop_base_add_callback(callback_registration);
+    pthread_mutex_unlock(&btstack_run_loop_epoll_callbacks_mutex);
+    // trigger run loop
+    btstack_run_loop_epoll_trigger_eventfd(btstack_run_loop_epoll_process_callbacks_fd);
+}
+
+//init
+
+static void btstack_run_loop_epoll_register_internal_data_source(btstack_data_source_t * data_source, int fd,
+    void (*process)(btstack_data_source_t *_data_source,  btstack_data_source_callback_type_t callback_type)){
+    if (fd < 0){
+        log_error("creating fd for internal data source failed, errno %u", errno);
+        return;
+    }
+    data_source->source.fd = fd;
+    data_source->process = process;
+    data_source->flags = DATA_SOURCE_CALLBACK_READ;
+    btstack_run_loop_epoll_add_data_source(data_source);
+}
+
+static void btstack_run_loop_epoll_close_fd(int * fd){
+    if (*fd < 0) return;
+    close(*fd);
+    *fd = -1;
+}
+
+static void btstack_run_loop_epoll_init(void){
+    btstack_run_loop_base_init();
+    btstack_run_loop_epoll_exit_requested = false;
+    btstack_run_loop_epoll_num_events = 0;
+    btstack_run_loop_epoll_timer_armed = false;
+
+    // release fds from previous init
+    btstack_run_loop_epoll_close_fd(&btstack_run_loop_epoll_timer_fd);
+    btstack_run_loop_epoll_close_fd(&btstack_run_loop_epoll_process_callbacks_fd);
+    btstack_run_loop_epoll_close_fd(&btstack_run_loop_epoll_poll_data_sources_fd);
+    btstack_run_loop_epoll_close_fd(&btstack_run_loop_epoll_exit_fd);
+    btstack_run_loop_epoll_close_fd(&btstack_run_loop_epoll_fd);
+
+    clock_gettime(CLOCK_MONOTONIC, &btstack_run_loop_epoll_init_ts);
+    btstack_run_loop_epoll_init_ts.tv_nsec = 0;
+
+    btstack_run_loop_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (btstack_run_loop_epoll_fd < 0){
+        log_error("epoll_create1() failed, errno %u", errno);
+        return;
+    }
+
+    // setup timerfd for timer list
+    btstack_run_loop_epoll_timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    btstack_run_loop_epoll_register_internal_data_source(&btstack_run_loop_epoll_timer_ds,
+        btstack_run_loop_epoll_timer_fd, &btstack_run_loop_epoll_timer_handler);
+
+    // setup eventfd to trigger process callbacks
+    btstack_run_loop_epoll_process_callbacks_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    btstack_run_loop_epoll_register_internal_data_source(&btstack_run_loop_epoll_process_callbacks_ds,
+        btstack_run_loop_epoll_process_callbacks_fd, &btstack_run_loop_epoll_process_callbacks_handler);
+
+    // setup eventfd to poll data sources
+    btstack_run_loop_epoll_poll_data_sources_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    btstack_run_loop_epoll_register_internal_data_source(&btstack_run_loop_epoll_poll_data_sources_ds,
+        btstack_run_loop_epoll_poll_data_sources_fd, &btstack_run_loop_epoll_poll_data_sources_handler);
+
+    // setup eventfd to wake up on trigger exit
+    btstack_run_loop_epoll_exit_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    btstack_run_loop_epoll_register_internal_data_source(&btstack_run_loop_epoll_exit_ds,
+        btstack_run_loop_epoll_exit_fd, &btstack_run_loop_epoll_exit_handler);
+}
+
+static const btstack_run_loop_t btstack_run_loop_epoll = {
+    &btstack_run_loop_epoll_init,
+    &btstack_run_loop_epoll_add_data_source,
+    &btstack_run_loop_epoll_remove_data_source,
+    &btstack_run_loop_epoll_enable_data_source_callbacks,
+    &btstack_run_loop_epoll_disable_data_source_callbacks,
+    &btstack_run_loop_epoll_set_timer,
+    &btstack_run_loop_base_add_timer,
+    &btstack_run_loop_base_remove_timer,
+    &btstack_run_loop_epoll_execute,
+    &btstack_run_loop_base_dump_timer,
+    &btstack_run_loop_epoll_get_time_ms,
+    &btstack_run_loop_epoll_poll_data_sources_from_irq,
+    &btstack_run_loop_epoll_execute_on_main_thread,
+    &btstack_run_loop_epoll_trigger_exit,
+};
+
+/**
+ * Provide btstack_run_loop_epoll instance
+ */
+const btstack_run_loop_t * btstack_run_loop_epoll_get_instance(void){
+    return &btstack_run_loop_epoll;
+}
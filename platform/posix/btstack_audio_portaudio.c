@@ -43,13 +43,16 @@
 #include "btstack_debug.h"
 #include "btstack_audio.h"
 #include "btstack_run_loop.h"
+#include "btstack_spsc_ring.h"
 
 #ifdef HAVE_PORTAUDIO
 
 #define PA_SAMPLE_TYPE               paInt16
 #define NUM_FRAMES_PER_PA_BUFFER       512
 #define NUM_OUTPUT_BUFFERS               5
-#define NUM_INPUT_BUFFERS                2
+// ring buffer sizes, power of two and multiple of stereo PA buffer
+#define OUTPUT_RING_NUM_BUFFERS          8
+#define INPUT_RING_NUM_BUFFERS           4
 #define DRIVER_POLL_INTERVAL_MS          5
 
 #include <portaudio.h>
@@ -78,18 +81,13 @@ static PaStream * stream_sink;
 static void (*playback_callback)(int16_t * buffer, uint16_t num_samples);
 static void (*recording_callback)(const int16_t * buffer, uint16_t num_samples);
 
-// output buffer
-static int16_t               output_buffer_storage[NUM_OUTPUT_BUFFERS * NUM_FRAMES_PER_PA_BUFFER * 2];   // stereo
-static int16_t             * output_buffers[NUM_OUTPUT_BUFFERS];
-static int                   output_buffer_to_play;
-static int                   output_buffer_to_fill;
+// output buffers, filled on run loop and played from portaudio thread
+static int16_t               output_ring_storage[OUTPUT_RING_NUM_BUFFERS * NUM_FRAMES_PER_PA_BUFFER * 2];   // stereo
+static btstack_spsc_ring_t   output_ring;
 
-// input buffer
-static int16_t               input_buffer_a[NUM_FRAMES_PER_PA_BUFFER * 2];   // stereo
-static int16_t               input_buffer_b[NUM_FRAMES_PER_PA_BUFFER * 2];   // stereo
-static int16_t             * input_buffers[NUM_INPUT_BUFFERS] = { input_buffer_a, input_buffer_b};
-static int                   input_buffer_to_record;
-static int                   input_buffer_to_fill;
+// input buffers, filled from portaudio thread and processed on run loop
+static int16_t               input_ring_storage[INPUT_RING_NUM_BUFFERS * NUM_FRAMES_PER_PA_BUFFER * 2];     // stereo
+static btstack_spsc_ring_t   input_ring;
 
 
 // timer to fill output ring buffer
@@ -113,10 +111,18 @@ static int portaudio_callback_sink( const void *                     inputBuffer
 
     // simplified volume control
     uint16_t index;
-    int16_t * from_buffer = output_buffers[output_buffer_to_play];
+    uint32_t num_bytes = NUM_FRAMES_PER_PA_BUFFER * num_bytes_per_sample_sink;
+    uint32_t span_size;
+    const int16_t * from_buffer = (const int16_t *) btstack_spsc_ring_peek(&output_ring, &span_size);
     int16_t * to_buffer = (int16_t *) outputBuffer;
     btstack_assert(frames_per_buffer == NUM_FRAMES_PER_PA_BUFFER);
 
+    if (span_size < num_bytes){
+        // underrun
+        memset(to_buffer, 0, num_bytes);
+        return 0;
+    }
+
 #if 0
     // up to 8 right shifts
     int right_shift = 8 - btstack_min(8, ((sink_volume + 15) / 16));
@@ -133,7 +139,7 @@ static int portaudio_callback_sink( const void *                     inputBuffer
 #endif
 
     // next
-    output_buffer_to_play = (output_buffer_to_play + 1 ) % NUM_OUTPUT_BUFFERS;
+    btstack_spsc_ring_consume(&output_ring, num_bytes);
 
     return 0;
 }
@@ -153,24 +159,36 @@ static int portaudio_callback_source( const void *                     inputBuff
     (void) samples_per_buffer;
     (void) outputBuffer;
 
-    // store in one of our buffers
-    memcpy(input_buffers[input_buffer_to_fill], inputBuffer, NUM_FRAMES_PER_PA_BUFFER * num_bytes_per_sample_source);
-
-    // next
-    input_buffer_to_fill = (input_buffer_to_fill + 1 ) % NUM_INPUT_BUFFERS;
+    // store in ring buffer, drop if recording is not processed in time
+    uint32_t num_bytes = NUM_FRAMES_PER_PA_BUFFER * num_bytes_per_sample_source;
+    uint32_t span_size;
+    uint8_t * span = btstack_spsc_ring_reserve(&input_ring, &span_size);
+    if (span_size >= num_bytes){
+        memcpy(span, inputBuffer, num_bytes);
+        btstack_spsc_ring_commit(&input_ring, num_bytes);
+    }
 
     return 0;
 }
 
+static void driver_fill_output_buffers(void){
+    // keep NUM_OUTPUT_BUFFERS - 1 buffers queued
+    uint32_t num_bytes = NUM_FRAMES_PER_PA_BUFFER * num_bytes_per_sample_sink;
+    uint32_t max_queued = (NUM_OUTPUT_BUFFERS - 1) * num_bytes;
+    while ((sizeof(output_ring_storage) - btstack_spsc_ring_bytes_free(&output_ring)) < max_queued){
+        // ring size is multiple of buffer size, span does not wrap
+        uint32_t span_size;
+        int16_t * buffer = (int16_t *) btstack_spsc_ring_reserve(&output_ring, &span_size);
+        btstack_assert(span_size >= num_bytes);
+        (*playback_callback)(buffer, NUM_FRAMES_PER_PA_BUFFER);
+        btstack_spsc_ring_commit(&output_ring, num_bytes);
+    }
+}
+
 static void driver_timer_handler_sink(btstack_timer_source_t * ts){
 
-    // playback buffer ready to fill
-    while (output_buffer_to_play != output_buffer_to_fill){
-        (*playback_callback)(output_buffers[output_buffer_to_fill], NUM_FRAMES_PER_PA_BUFFER);
-
-        // next
-        output_buffer_to_fill = (output_buffer_to_fill + 1 ) % NUM_OUTPUT_BUFFERS;
-    }
+    // playback buffers ready to fill
+    driver_fill_output_buffers();
 
     // re-set timer
     btstack_run_loop_set_timer(ts, DRIVER_POLL_INTERVAL_MS);
@@ -179,14 +197,15 @@ static void driver_timer_handler_sink(btstack_timer_source_t * ts){
 
 static void driver_timer_handler_source(btstack_timer_source_t * ts){
 
-    // recording buffer ready to process
-    if (input_buffer_to_record != input_buffer_to_fill){
-
-        (*recording_callback)(input_buffers[input_buffer_to_record], NUM_FRAMES_PER_PA_BUFFER);
-
-        // next
-        input_buffer_to_record = (input_buffer_to_record + 1 ) % NUM_INPUT_BUFFERS;
-    }    
+    // recording buffers ready to process
+    uint32_t num_bytes = NUM_FRAMES_PER_PA_BUFFER * num_bytes_per_sample_source;
+    uint32_t span_size;
+    const int16_t * buffer = (const int16_t *) btstack_spsc_ring_peek(&input_ring, &span_size);
+    while (span_size >= num_bytes){
+        (*recording_callback)(buffer, NUM_FRAMES_PER_PA_BUFFER);
+        btstack_spsc_ring_consume(&input_ring, num_bytes);
+        buffer = (const int16_t *) btstack_spsc_ring_peek(&input_ring, &span_size);
+    }
 
     // re-set timer
     btstack_run_loop_set_timer(ts, DRIVER_POLL_INTERVAL_MS);
@@ -203,10 +222,7 @@ static int btstack_audio_portaudio_sink_init(
     num_channels_sink = channels;
     num_bytes_per_sample_sink = 2 * channels;
 
-    uint8_t i;
-    for (i=0;i<NUM_OUTPUT_BUFFERS;i++){
-        output_buffers[i] = &output_buffer_storage[i * NUM_FRAMES_PER_PA_BUFFER * 2];
-    }
+    btstack_spsc_ring_init(&output_ring, (uint8_t *) output_ring_storage, sizeof(output_ring_storage));
 
     if (!playback){
         log_error("No playback callback");
@@ -275,6 +291,8 @@ static int btstack_audio_portaudio_source_init(
     num_channels_source = channels;
     num_bytes_per_sample_source = 2 * channels;
 
+    btstack_spsc_ring_init(&input_ring, (uint8_t *) input_ring_storage, sizeof(input_ring_storage));
+
     if (!recording){
         log_error("No recording callback");
         return 1;
@@ -354,12 +372,8 @@ static void btstack_audio_portaudio_sink_start_stream(void){
     if (!playback_callback) return;
 
     // fill buffers once
-    uint8_t i;
-    for (i=0;i<NUM_OUTPUT_BUFFERS-1;i++){
-        (*playback_callback)(&output_buffer_storage[i*NUM_FRAMES_PER_PA_BUFFER*2], NUM_FRAMES_PER_PA_BUFFER);
-    }
-    output_buffer_to_play = 0;
-    output_buffer_to_fill = NUM_OUTPUT_BUFFERS-1;
+    btstack_spsc_ring_reset(&output_ring);
+    driver_fill_output_buffers();
 
     /* -- start stream -- */
     PaError err = Pa_StartStream(stream_sink);
@@ -380,6 +394,8 @@ static void btstack_audio_portaudio_source_start_stream(void){
 
     if (!recording_callback) return;
 
+    btstack_spsc_ring_reset(&input_ring);
+
     /* -- start stream -- */
     PaError err = Pa_StartStream(stream_source);
     if (err != paNoError){
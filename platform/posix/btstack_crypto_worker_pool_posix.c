@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "btstack_crypto_worker_pool_posix.c"
+
+/*
+ *  btstack_crypto_worker_pool_posix.c
+ *
+ *  Jobs are processed in FIFO order by a fixed number of threads. The done callback
+ *  of a job is executed on the main thread via btstack_run_loop_execute_on_main_thread.
+ */
+
+#include "btstack_config.h"
+
+// enable POSIX functions (needed for -std=c99)
+#define _POSIX_C_SOURCE 200809
+
+#include "btstack_crypto_worker_pool_posix.h"
+
+#include "btstack_bool.h"
+#include "btstack_debug.h"
+#include "btstack_linked_list.h"
+#include "btstack_run_loop.h"
+
+#include <pthread.h>
+
+#ifndef BTSTACK_CRYPTO_WORKER_POOL_POSIX_MAX_THREADS
+#define BTSTACK_CRYPTO_WORKER_POOL_POSIX_MAX_THREADS 8
+#endif
+
+static pthread_t       worker_threads[BTSTACK_CRYPTO_WORKER_POOL_POSIX_MAX_THREADS];
+static uint8_t         worker_num_threads;
+static pthread_mutex_t worker_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  worker_cond  = PTHREAD_COND_INITIALIZER;
+static bool            worker_stop;
+
+// protected by worker_mutex
+static btstack_linked_list_t worker_jobs;
+
+static void * btstack_crypto_worker_pool_posix_thread(void * context){
+    UNUSED(context);
+    while (true){
+        pthread_mutex_lock(&worker_mutex);
+        while ((worker_stop == false) && btstack_linked_list_empty(&worker_jobs)){
+            pthread_cond_wait(&worker_cond, &worker_mutex);
+        }
+        // complete queued jobs before stopping, each job must report done to keep the caller's job count balanced
+        if (btstack_linked_list_empty(&worker_jobs)){
+            pthread_mutex_unlock(&worker_mutex);
+            break;
+        }
+        btstack_crypto_worker_job_t * job = (btstack_crypto_worker_job_t *) btstack_linked_list_pop(&worker_jobs);
+        pthread_mutex_unlock(&worker_mutex);
+
+        (*job->work)(job);
+        btstack_run_loop_execute_on_main_thread(&job->done);
+    }
+    return NULL;
+}
+
+static uint8_t btstack_crypto_worker_pool_posix_get_num_workers(void){
+    return worker_num_threads;
+}
+
+static void btstack_crypto_worker_pool_posix_execute(btstack_crypto_worker_job_t * job){
+    pthread_mutex_lock(&worker_mutex);
+    btstack_linked_list_add_tail(&worker_jobs, (btstack_linked_item_t *) job);
+    pthread_cond_signal(&worker_cond);
+    pthread_mutex_unlock(&worker_mutex);
+}
+
+static const btstack_crypto_worker_pool_t btstack_crypto_worker_pool_posix = {
+    &btstack_crypto_worker_pool_posix_get_num_workers,
+    &btstack_crypto_worker_pool_posix_execute,
+};
+
+const btstack_crypto_worker_pool_t * btstack_crypto_worker_pool_posix_init_instance(uint8_t num_threads){
+    btstack_assert(worker_num_threads == 0);
+    if (num_threads == 0u) {
+        num_threads = 1;
+    }
+    if (num_threads > BTSTACK_CRYPTO_WORKER_POOL_POSIX_MAX_THREADS){
+        num_threads = BTSTACK_CRYPTO_WORKER_POOL_POSIX_MAX_THREADS;
+    }
+    worker_stop = false;
+    worker_jobs = NULL;
+    uint8_t i;
+    for (i = 0; i < num_threads; i++){
+        int err = pthread_create(&worker_threads[i], NULL, &btstack_crypto_worker_pool_posix_thread, NULL);
+        if (err != 0){
+            log_error("crypto worker pool: pthread_create failed, err %d", err);
+            break;
+        }
+        worker_num_threads++;
+    }
+    if (worker_num_threads == 0u){
+        return NULL;
+    }
+    log_info("crypto worker pool: %u threads", worker_num_threads);
+    return &btstack_crypto_worker_pool_posix;
+}
+
+void btstack_crypto_worker_pool_posix_deinit(void){
+    pthread_mutex_lock(&worker_mutex);
+    worker_stop = true;
+    pthread_cond_broadcast(&worker_cond);
+    pthread_mutex_unlock(&worker_mutex);
+    uint8_t i;
+    for (i = 0; i < worker_num_threads; i++){
+        pthread_join(worker_threads[i], NULL);
+    }
+    worker_num_threads = 0;
+    worker_jobs = NULL;
+}
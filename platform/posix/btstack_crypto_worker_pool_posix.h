@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/*
+ *  btstack_crypto_worker_pool_posix.h
+ *
+ *  Worker threads for CPU intensive crypto operations, e.g. ECC P-256 DH Key calculation
+ */
+
+#ifndef BTSTACK_CRYPTO_WORKER_POOL_POSIX_H
+#define BTSTACK_CRYPTO_WORKER_POOL_POSIX_H
+
+#include <stdint.h>
+#include "btstack_crypto.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+/* API_START */
+
+/**
+ * @brief Start worker threads and provide worker pool instance for btstack_crypto_ecc_p256_set_worker_pool
+ * @note Completed jobs are reported via btstack_run_loop_execute_on_main_thread, which requires a thread-safe run loop
+ * @param num_threads, at least 1
+ * @return worker pool or NULL if threads could not be started
+ */
+const btstack_crypto_worker_pool_t * btstack_crypto_worker_pool_posix_init_instance(uint8_t num_threads);
+
+/**
+ * @brief Stop worker threads after all current and pending jobs are complete.
+ * @note call btstack_crypto_ecc_p256_set_worker_pool(NULL) first. Completed jobs are reported when the run loop runs again.
+ */
+void btstack_crypto_worker_pool_posix_deinit(void);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // BTSTACK_CRYPTO_WORKER_POOL_POSIX_H
@@ -154,6 +154,25 @@ static uint32_t btstack_run_loop_posix_get_time_ms(void){
     return time_ms;
 }
 
+#ifdef ENABLE_RUN_LOOP_PROFILING
+/**
+ * @brief Queries the current time in us since start. Might overflow
+ */
+static uint32_t btstack_run_loop_posix_get_time_us(void){
+    uint32_t time_us;
+#ifdef _POSIX_MONOTONIC_CLOCK
+    struct timespec now_ts;
+    clock_gettime(CLOCK_MONOTONIC, &now_ts);
+    time_us = (uint32_t) (((uint64_t) (now_ts.tv_sec - init_ts.tv_sec) * 1000000u) + ((uint64_t) now_ts.tv_nsec / 1000u));
+#else
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    time_us = (uint32_t) (((uint64_t) (tv.tv_sec - init_tv.tv_sec) * 1000000u) + (uint64_t) tv.tv_usec);
+#endif
+    return time_us;
+}
+#endif
+
 /**
  * Execute run_loop
  */
@@ -221,12 +240,12 @@ static void btstack_run_loop_posix_execute(void) {
                 log_debug("btstack_run_loop_posix_execute: check ds %p with fd %u\n", ds, ds->source.fd);
                 if (FD_ISSET(ds->source.fd, &descriptors_read)) {
                     log_debug("btstack_run_loop_posix_execute: process read ds %p with fd %u\n", ds, ds->source.fd);
-                    ds->process(ds, DATA_SOURCE_CALLBACK_READ);
+                    btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_READ);
                 }
                 if (btstack_run_loop_posix_data_sources_modified) break;
                 if (FD_ISSET(ds->source.fd, &descriptors_write)) {
                     log_debug("btstack_run_loop_posix_execute: process write ds %p with fd %u\n", ds, ds->source.fd);
-                    ds->process(ds, DATA_SOURCE_CALLBACK_WRITE);
+                    btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_WRITE);
                 }
             }
         }
@@ -288,7 +307,7 @@ static void btstack_run_loop_posix_process_callbacks_handler(btstack_data_source
         if (callback_registration == NULL){
             break;
         }
-        (*callback_registration->callback)(callback_registration->context);
+        btstack_run_loop_base_execute_callback(callback_registration);
     }
 }
 
@@ -320,6 +339,7 @@ static int btstack_run_loop_posix_register_pipe_datasource(btstack_data_source_t
 
 static void btstack_run_loop_posix_init(void){
     btstack_run_loop_base_init();
+    btstack_run_loop_posix_exit_requested = false;
     
 #ifdef _POSIX_MONOTONIC_CLOCK
     clock_gettime(CLOCK_MONOTONIC, &init_ts);
@@ -330,6 +350,10 @@ static void btstack_run_loop_posix_init(void){
     init_tv.tv_usec = 0;
 #endif
 
+#ifdef ENABLE_RUN_LOOP_PROFILING
+    btstack_run_loop_profiling_set_time_us_callback(&btstack_run_loop_posix_get_time_us);
+#endif
+
     // setup pipe to trigger process callbacks
     btstack_run_loop_posix_process_callbacks_ds.process = &btstack_run_loop_posix_process_callbacks_handler;
     btstack_run_loop_posix_process_callbacks_fd = btstack_run_loop_posix_register_pipe_datasource(&btstack_run_loop_posix_process_callbacks_ds);
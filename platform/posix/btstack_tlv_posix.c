@@ -31,6 +31,9 @@
 
 #define BTSTACK_FILE__ "btstack_tlv_posix.c"
 
+// enable POSIX functions (needed for -std=c99)
+#define _POSIX_C_SOURCE 200809
+
 #include "btstack_tlv.h"
 #include "btstack_tlv_posix.h"
 #include "btstack_debug.h"
@@ -40,6 +43,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 
 // Header:
@@ -55,8 +59,29 @@
 
 #define BTSTACK_TLV_HEADER_LEN 8
 
+#define BTSTACK_TLV_ENTRY_HEADER_LEN 8
+
 #define MAX_TLV_VALUE_SIZE 2048
 
+#if (BTSTACK_TLV_POSIX_HASH_TABLE_SIZE & (BTSTACK_TLV_POSIX_HASH_TABLE_SIZE - 1)) != 0
+#error "BTSTACK_TLV_POSIX_HASH_TABLE_SIZE must be a power of two"
+#endif
+
+// compact file if it contains more than BTSTACK_TLV_POSIX_COMPACTION_MIN_GARBAGE bytes of old entries
+// and old entries make up more than BTSTACK_TLV_POSIX_COMPACTION_GARBAGE_PERCENT of the file
+#ifndef BTSTACK_TLV_POSIX_COMPACTION_MIN_GARBAGE
+#define BTSTACK_TLV_POSIX_COMPACTION_MIN_GARBAGE 4096
+#endif
+
+#ifndef BTSTACK_TLV_POSIX_COMPACTION_GARBAGE_PERCENT
+#define BTSTACK_TLV_POSIX_COMPACTION_GARBAGE_PERCENT 50
+#endif
+
+// flush after this number of stores/deletes in group commit mode
+#ifndef BTSTACK_TLV_POSIX_GROUP_COMMIT_MAX_PENDING
+#define BTSTACK_TLV_POSIX_GROUP_COMMIT_MAX_PENDING 32
+#endif
+
 static const char * btstack_tlv_header_magic = "BTstack";
 
 #define DUMMY_SIZE 4
@@ -67,28 +92,126 @@ typedef struct tlv_entry {
 	uint8_t  value[DUMMY_SIZE];	// dummy size
 } tlv_entry_t;
 
-static int btstack_tlv_posix_append_tag(btstack_tlv_posix_t * self, uint32_t tag, const uint8_t * data, uint32_t data_size){
-
-	if (!self->file) return 1;
+static btstack_linked_list_t * btstack_tlv_posix_entry_list_for_tag(btstack_tlv_posix_t * self, uint32_t tag){
+	// tags often differ only in a single byte, mix all bits
+	uint32_t hash = tag;
+	hash ^= hash >> 16;
+	hash *= 0x45d9f3bu;
+	hash ^= hash >> 16;
+	return &self->entry_lists[hash & (BTSTACK_TLV_POSIX_HASH_TABLE_SIZE - 1)];
+}
 
-	log_info("append tag %04x, len %u", tag, data_size);
+static void btstack_tlv_posix_sync(btstack_tlv_posix_t * self){
+	fflush(self->file);
+	int err = fsync(fileno(self->file));
+	UNUSED(err);
+	self->pending_writes = 0;
+}
 
-	uint8_t header[8];
+static int btstack_tlv_posix_write_tag(btstack_tlv_posix_t * self, FILE * file, uint32_t tag, const uint8_t * data, uint32_t data_size){
+	uint8_t header[BTSTACK_TLV_ENTRY_HEADER_LEN];
 	big_endian_store_32(header, 0, tag);
 	big_endian_store_32(header, 4, data_size);
-	size_t written_header = fwrite(header, 1, sizeof(header), self->file);
+	size_t written_header = fwrite(header, 1, sizeof(header), file);
 	if (written_header != sizeof(header)) return 1;
 	if (data_size > 0) {
-		size_t written_value = fwrite(data, 1, data_size, self->file);
+		size_t written_value = fwrite(data, 1, data_size, file);
 		if (written_value != data_size) return 1;
 	}
-	fflush(self->file);
+	self->file_size += BTSTACK_TLV_ENTRY_HEADER_LEN + data_size;
+	return 0;
+}
+
+static int btstack_tlv_posix_write_header_and_entries(btstack_tlv_posix_t * self, FILE * file){
+	uint8_t header[BTSTACK_TLV_HEADER_LEN];
+	memset(header, 0, sizeof(header));
+	strcpy((char *)header, btstack_tlv_header_magic);
+	if (fwrite(header, 1, sizeof(header), file) != sizeof(header)) return 1;
+	self->file_size = BTSTACK_TLV_HEADER_LEN;
+	// write out all valid entries (if any)
+	uint16_t i;
+	for (i = 0; i < BTSTACK_TLV_POSIX_HASH_TABLE_SIZE; i++){
+		btstack_linked_list_iterator_t it;
+		btstack_linked_list_iterator_init(&it, &self->entry_lists[i]);
+		while (btstack_linked_list_iterator_has_next(&it)){
+			tlv_entry_t * entry = (tlv_entry_t*) btstack_linked_list_iterator_next(&it);
+			if (btstack_tlv_posix_write_tag(self, file, entry->tag, &entry->value[0], entry->len) != 0) return 1;
+		}
+	}
+	return 0;
+}
+
+// write valid entries into new file and replace old file with it
+static void btstack_tlv_posix_compact(btstack_tlv_posix_t * self){
+	log_info("compact db %s: file size %u, valid size %u", self->db_path, self->file_size, self->valid_size);
+
+	size_t path_len = strlen(self->db_path);
+	char * tmp_path = (char *) malloc(path_len + 5);
+	if (tmp_path == NULL) return;
+	memcpy(tmp_path, self->db_path, path_len);
+	memcpy(&tmp_path[path_len], ".tmp", 5);
+
+	uint32_t old_file_size = self->file_size;
+	FILE * file = fopen(tmp_path, "w+");
+	int err = 1;
+	if (file != NULL){
+		err = btstack_tlv_posix_write_header_and_entries(self, file);
+		if (err == 0){
+			fflush(file);
+			err = fsync(fileno(file));
+		}
+		if (err == 0){
+			err = rename(tmp_path, self->db_path);
+		}
+	}
+
+	if (err == 0){
+		// continue appending to new file
+		fclose(self->file);
+		self->file = file;
+		self->pending_writes = 0;
+	} else {
+		log_error("compaction failed");
+		if (file != NULL){
+			fclose(file);
+			(void) unlink(tmp_path);
+		}
+		self->file_size = old_file_size;
+	}
+	free(tmp_path);
+}
+
+static void btstack_tlv_posix_compact_if_needed(btstack_tlv_posix_t * self){
+	uint32_t garbage_size = self->file_size - BTSTACK_TLV_HEADER_LEN - self->valid_size;
+	if (garbage_size < BTSTACK_TLV_POSIX_COMPACTION_MIN_GARBAGE) return;
+	if (((uint64_t) garbage_size * 100u) < ((uint64_t) self->file_size * BTSTACK_TLV_POSIX_COMPACTION_GARBAGE_PERCENT)) return;
+	btstack_tlv_posix_compact(self);
+}
+
+static int btstack_tlv_posix_append_tag(btstack_tlv_posix_t * self, uint32_t tag, const uint8_t * data, uint32_t data_size){
+
+	if (!self->file) return 1;
+
+	log_info("append tag %04x, len %u", tag, data_size);
+
+	if (btstack_tlv_posix_write_tag(self, self->file, tag, data, data_size) != 0) return 1;
+
+	if (self->group_commit){
+		self->pending_writes++;
+		if (self->pending_writes >= BTSTACK_TLV_POSIX_GROUP_COMMIT_MAX_PENDING){
+			btstack_tlv_posix_sync(self);
+		}
+	} else {
+		fflush(self->file);
+	}
+
+	btstack_tlv_posix_compact_if_needed(self);
 	return 1;
 }
 
 static tlv_entry_t * btstack_tlv_posix_find_entry(btstack_tlv_posix_t * self, uint32_t tag){
 	btstack_linked_list_iterator_t it;
-	btstack_linked_list_iterator_init(&it, &self->entry_list);
+	btstack_linked_list_iterator_init(&it, btstack_tlv_posix_entry_list_for_tag(self, tag));
 	while (btstack_linked_list_iterator_has_next(&it)){
 		tlv_entry_t * entry = (tlv_entry_t*) btstack_linked_list_iterator_next(&it);
 		if (entry->tag != tag) continue;
@@ -97,22 +220,27 @@ static tlv_entry_t * btstack_tlv_posix_find_entry(btstack_tlv_posix_t * self, ui
 	return NULL;
 }
 
+static void btstack_tlv_posix_add_entry(btstack_tlv_posix_t * self, tlv_entry_t * entry){
+	btstack_linked_list_add(btstack_tlv_posix_entry_list_for_tag(self, entry->tag), (btstack_linked_item_t *) entry);
+	self->valid_size += BTSTACK_TLV_ENTRY_HEADER_LEN + entry->len;
+}
+
+static void btstack_tlv_posix_remove_entry(btstack_tlv_posix_t * self, tlv_entry_t * entry){
+	btstack_linked_list_remove(btstack_tlv_posix_entry_list_for_tag(self, entry->tag), (btstack_linked_item_t *) entry);
+	self->valid_size -= BTSTACK_TLV_ENTRY_HEADER_LEN + entry->len;
+	free(entry);
+}
+
 /**
  * Delete Tag
  * @param tag
  */
 static void btstack_tlv_posix_delete_tag(void * context, uint32_t tag){
 	btstack_tlv_posix_t * self = (btstack_tlv_posix_t *) context;
-	btstack_linked_list_iterator_t it;
-	btstack_linked_list_iterator_init(&it, &self->entry_list);
-	while (btstack_linked_list_iterator_has_next(&it)){
-		tlv_entry_t * entry = (tlv_entry_t*) btstack_linked_list_iterator_next(&it);
-		if (entry->tag != tag) continue;
-		btstack_linked_list_iterator_remove(&it);
-		free(entry);
-		btstack_tlv_posix_append_tag(self, tag, NULL, 0);
-		return;
-	}
+	tlv_entry_t * entry = btstack_tlv_posix_find_entry(self, tag);
+	if (entry == NULL) return;
+	btstack_tlv_posix_remove_entry(self, entry);
+	btstack_tlv_posix_append_tag(self, tag, NULL, 0);
 }
 
 /**
@@ -150,8 +278,7 @@ static int btstack_tlv_posix_store_tag(void * context, uint32_t tag, const uint8
 	// remove old entry
 	tlv_entry_t * old_entry = btstack_tlv_posix_find_entry(self, tag);
 	if (old_entry){
-		btstack_linked_list_remove(&self->entry_list, (btstack_linked_item_t *) old_entry);
-		free(old_entry);
+		btstack_tlv_posix_remove_entry(self, old_entry);
 	}
 
 	// create new entry
@@ -164,7 +291,7 @@ static int btstack_tlv_posix_store_tag(void * context, uint32_t tag, const uint8
 	memcpy(&new_entry->value[0], data, data_size);
 
 	// append new entry
-	btstack_linked_list_add(&self->entry_list, (btstack_linked_item_t *) new_entry);
+	btstack_tlv_posix_add_entry(self, new_entry);
 
 	// write new tag
 	btstack_tlv_posix_append_tag(self, tag, data, data_size);
@@ -185,9 +312,10 @@ static int btstack_tlv_posix_read_db(btstack_tlv_posix_t * self){
 	    if (objects_read == BTSTACK_TLV_HEADER_LEN){
 	    	if (memcmp(header, btstack_tlv_header_magic, strlen(btstack_tlv_header_magic)) == 0){
 		    	log_info("BTstack Magic Header found");
+		    	self->file_size = BTSTACK_TLV_HEADER_LEN;
 		    	// read entries
 		    	while (true){
-					uint8_t entry[8];
+					uint8_t entry[BTSTACK_TLV_ENTRY_HEADER_LEN];
 					size_t 	entries_read = fread(entry, 1, sizeof(entry), self->file);
 					if (entries_read == 0){
 						// EOF, we're good
@@ -212,19 +340,22 @@ static int btstack_tlv_posix_read_db(btstack_tlv_posix_t * self){
 
                         // read
                         size_t value_read = fread(&new_entry->value[0], 1, len, self->file);
-                        if (value_read != len) break;
+                        if (value_read != len) {
+                            free(new_entry);
+                            break;
+                        }
                     }
+                    self->file_size += BTSTACK_TLV_ENTRY_HEADER_LEN + len;
 
                     // remove old entry
                     tlv_entry_t * old_entry = btstack_tlv_posix_find_entry(self, tag);
                     if (old_entry){
-                        btstack_linked_list_remove(&self->entry_list, (btstack_linked_item_t *) old_entry);
-                        free(old_entry);
+                        btstack_tlv_posix_remove_entry(self, old_entry);
                     }
 
                     // append new entry
                     if (new_entry){
-	                    btstack_linked_list_add(&self->entry_list, (btstack_linked_item_t *) new_entry);
+	                    btstack_tlv_posix_add_entry(self, new_entry);
                     }
 		    	}
 	    	}
@@ -242,16 +373,10 @@ static int btstack_tlv_posix_read_db(btstack_tlv_posix_t * self){
             log_error("failed to create file");
             return -1;
         }
-	    memset(header, 0, sizeof(header));
-	    strcpy((char *)header, btstack_tlv_header_magic);
-	    fwrite(header, 1, sizeof(header), self->file);
-	    // write out all valid entries (if any)
-		btstack_linked_list_iterator_t it;
-		btstack_linked_list_iterator_init(&it, &self->entry_list);
-		while (btstack_linked_list_iterator_has_next(&it)){
-			tlv_entry_t * entry = (tlv_entry_t*) btstack_linked_list_iterator_next(&it);
-			btstack_tlv_posix_append_tag(self, entry->tag, &entry->value[0], entry->len);
-		}
+	    btstack_tlv_posix_write_header_and_entries(self, self->file);
+	    fflush(self->file);
+    } else {
+        btstack_tlv_posix_compact_if_needed(self);
     }
 	return 0;
 }
@@ -274,17 +399,33 @@ const btstack_tlv_t * btstack_tlv_posix_init_instance(btstack_tlv_posix_t * self
 	return &btstack_tlv_posix;
 }
 
+void btstack_tlv_posix_set_group_commit(btstack_tlv_posix_t * self, bool enabled){
+	if ((self->group_commit == true) && (enabled == false)){
+		btstack_tlv_posix_flush(self);
+	}
+	self->group_commit = enabled;
+}
+
+void btstack_tlv_posix_flush(btstack_tlv_posix_t * self){
+	if (!self->file) return;
+	btstack_tlv_posix_sync(self);
+}
+
 /**
  * Free TLV entries
  * @param self
  */
 void btstack_tlv_posix_deinit(btstack_tlv_posix_t * self){
     // free all entries
-    btstack_linked_list_iterator_t it;
-    btstack_linked_list_iterator_init(&it, &self->entry_list);
-    while (btstack_linked_list_iterator_has_next(&it)){
-        tlv_entry_t * entry = (tlv_entry_t*) btstack_linked_list_iterator_next(&it);
-		btstack_linked_list_iterator_remove(&it);
-		free(entry);
+    uint16_t i;
+    for (i = 0; i < BTSTACK_TLV_POSIX_HASH_TABLE_SIZE; i++){
+        btstack_linked_list_iterator_t it;
+        btstack_linked_list_iterator_init(&it, &self->entry_lists[i]);
+        while (btstack_linked_list_iterator_has_next(&it)){
+            tlv_entry_t * entry = (tlv_entry_t*) btstack_linked_list_iterator_next(&it);
+            btstack_linked_list_iterator_remove(&it);
+            free(entry);
+        }
     }
+    self->valid_size = 0;
 }
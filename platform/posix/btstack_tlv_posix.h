@@ -43,15 +43,27 @@
 #include <stdio.h>
 #include "btstack_tlv.h"
 #include "btstack_linked_list.h"
+#include "btstack_bool.h"
 
 #if defined __cplusplus
 extern "C" {
 #endif
 
+// number of hash buckets for tag lookup, must be a power of two
+#ifndef BTSTACK_TLV_POSIX_HASH_TABLE_SIZE
+#define BTSTACK_TLV_POSIX_HASH_TABLE_SIZE 256
+#endif
+
 typedef struct {
-	btstack_linked_list_t entry_list;
+	btstack_linked_list_t entry_lists[BTSTACK_TLV_POSIX_HASH_TABLE_SIZE];
 	const char * db_path;
 	FILE * file;
+	// size of log file and size of all valid entries incl. header
+	uint32_t file_size;
+	uint32_t valid_size;
+	// group commit
+	bool     group_commit;
+	uint16_t pending_writes;
 } btstack_tlv_posix_t;
 
 /**
@@ -61,6 +73,20 @@ typedef struct {
  */
 const btstack_tlv_t * btstack_tlv_posix_init_instance(btstack_tlv_posix_t * context, const char * db_path);
 
+/**
+ * Enable group commit: stores and deletes are not flushed to disc individually, but by
+ * btstack_tlv_posix_flush or after BTSTACK_TLV_POSIX_GROUP_COMMIT_MAX_PENDING operations
+ * @param self
+ * @param enabled
+ */
+void btstack_tlv_posix_set_group_commit(btstack_tlv_posix_t * self, bool enabled);
+
+/**
+ * Flush pending stores and deletes to disc using fflush and fsync
+ * @param self
+ */
+void btstack_tlv_posix_flush(btstack_tlv_posix_t * self);
+
 /**
  * Free TLV entries
  * @param self
@@ -0,0 +1,529 @@
+/*
+ * Copyright (C) 2024-2020 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "hci_dump_posix_fs_async.c"
+
+/*
+ *  hci_dump_posix_fs_async.c
+ *
+ *  Dump HCI trace in various formats into a file:
+ *
+ *  - BlueZ's hcidump format
+ *  - Apple's PacketLogger
+ *  - BTSnoop
+ *
+ *  The BTstack thread only formats the header and copies header and packet into a single-producer,
+ *  single-consumer ring buffer. A writer thread stores all pending packets with writev().
+ */
+
+#include "btstack_config.h"
+
+// enable POSIX functions (needed for -std=c99)
+#define _POSIX_C_SOURCE 200809
+
+#include "hci_dump_posix_fs_async.h"
+
+#include "btstack_debug.h"
+#include "btstack_util.h"
+#include "hci_cmd.h"
+
+#include <time.h>
+#include <stdio.h>        // printf
+#include <string.h>       // memcpy
+#include <fcntl.h>        // open
+#include <unistd.h>       // write
+#include <errno.h>        // errno
+#include <limits.h>       // PATH_MAX
+#include <pthread.h>
+#include <sys/time.h>     // for timestamps
+#include <sys/stat.h>     // file modes
+#include <sys/uio.h>      // writev
+
+// size of ring buffer, must be a power of two
+#ifndef HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE
+#define HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE (128 * 1024)
+#endif
+
+#if (HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE & (HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE - 1)) != 0
+#error "HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE must be a power of two"
+#endif
+
+// max time until packets are written to file
+#ifndef HCI_DUMP_POSIX_FS_ASYNC_FLUSH_INTERVAL_MS
+#define HCI_DUMP_POSIX_FS_ASYNC_FLUSH_INTERVAL_MS 200
+#endif
+
+// max number of packets per writev() call
+#ifndef HCI_DUMP_POSIX_FS_ASYNC_MAX_IOVECS
+#define HCI_DUMP_POSIX_FS_ASYNC_MAX_IOVECS 64
+#endif
+
+// records in ring buffer: 16-bit length + header + packet
+#define RECORD_LEN_SIZE    2u
+// remainder of ring buffer is unused, next record at start
+#define RECORD_LEN_PADDING 0xffffu
+// truncate log file, see hci_dump_set_max_packets
+#define RECORD_LEN_RESET   0x0000u
+
+#define RING_BUFFER_MASK   (HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE - 1u)
+
+static const uint8_t btsnoop_file_header[] = {
+    // Identification Pattern: "btsnoop\0"
+    0x62, 0x74, 0x73, 0x6E, 0x6F, 0x6F, 0x70, 0x00,
+    // Version: 1
+    0x00, 0x00, 0x00, 0x01,
+    // Datalink Type: 1002 - H4
+    0x00, 0x00, 0x03, 0xEA,
+};
+
+// ring buffer: head only written by BTstack thread, tail only written by writer thread
+static uint8_t  ring_buffer[HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE];
+static uint32_t ring_head;
+static uint32_t ring_tail;
+
+static pthread_t       writer_thread;
+static pthread_mutex_t writer_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  writer_cond  = PTHREAD_COND_INITIALIZER;
+static bool            writer_stop;
+static bool            writer_running;
+
+// BTstack thread
+static int      dump_format;
+static bool     reset_pending;
+static uint32_t dropped_packets;
+static uint32_t reported_dropped_packets;
+static char     log_message_buffer[256];
+
+// writer thread
+static int      dump_file = -1;
+static uint32_t dump_file_size;
+static uint32_t max_file_size;
+static uint16_t max_backup_files;
+static char     dump_filename[PATH_MAX];
+
+// provide summary for ISO Data Packets if not supported by fileformat/viewer yet
+static uint16_t hci_dump_iso_summary(uint8_t in,  uint8_t *packet, uint16_t len){
+    UNUSED(len);
+    uint16_t conn_handle = little_endian_read_16(packet, 0) & 0xfff;
+    uint8_t pb = (packet[1] >> 4) & 3;
+    uint8_t ts = (packet[1] >> 6) & 1;
+    uint16_t pos = 4;
+    uint32_t time_stamp = 0;
+    if (ts){
+        time_stamp = little_endian_read_32(packet, pos);
+        pos += 4;
+    }
+    uint16_t packet_sequence = little_endian_read_16(packet, pos);
+    pos += 2;
+    uint16_t iso_sdu_len = little_endian_read_16(packet, pos);
+    uint8_t packet_status_flag = packet[pos+1] >> 6;
+    return snprintf(log_message_buffer,sizeof(log_message_buffer), "ISO %s, handle %04x, pb %u, ts 0x%08x, sequence 0x%04x, packet status %u, iso len %u",
+                    in ? "IN" : "OUT", conn_handle, pb, time_stamp, packet_sequence, packet_status_flag, iso_sdu_len);
+}
+
+// BTstack thread
+
+// returns storage for record or NULL if ring buffer is full
+static uint8_t * hci_dump_posix_fs_async_reserve(uint16_t record_len, uint32_t * new_head){
+    uint32_t head = ring_head;
+    uint32_t tail = __atomic_load_n(&ring_tail, __ATOMIC_ACQUIRE);
+    uint32_t offset = head & RING_BUFFER_MASK;
+    uint32_t contiguous = HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE - offset;
+    uint32_t total = RECORD_LEN_SIZE + record_len;
+
+    // records are not wrapped around
+    uint32_t padding = 0;
+    if (contiguous < total){
+        padding = contiguous;
+    }
+    if ((HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE - (head - tail)) < (padding + total)) {
+        return NULL;
+    }
+    if (padding >= RECORD_LEN_SIZE){
+        little_endian_store_16(&ring_buffer[offset], 0, RECORD_LEN_PADDING);
+    }
+    head += padding;
+    offset = head & RING_BUFFER_MASK;
+    little_endian_store_16(&ring_buffer[offset], 0, record_len);
+    *new_head = head + total;
+    return &ring_buffer[offset + RECORD_LEN_SIZE];
+}
+
+static void hci_dump_posix_fs_async_commit(uint32_t new_head){
+    __atomic_store_n(&ring_head, new_head, __ATOMIC_RELEASE);
+    // wake up writer thread early if ring buffer is half full
+    uint32_t tail = __atomic_load_n(&ring_tail, __ATOMIC_ACQUIRE);
+    if ((new_head - tail) >= (HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE / 2u)){
+        pthread_cond_signal(&writer_cond);
+    }
+}
+
+static void hci_dump_posix_fs_async_reset(void){
+    if (writer_running == false) return;
+    uint32_t new_head;
+    if (hci_dump_posix_fs_async_reserve(RECORD_LEN_RESET, &new_head) == NULL){
+        // retry with next packet
+        reset_pending = true;
+        return;
+    }
+    reset_pending = false;
+    hci_dump_posix_fs_async_commit(new_head);
+}
+
+// returns false if packet was dropped
+static bool hci_dump_posix_fs_async_store(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len){
+
+    union {
+        uint8_t header_bluez[HCI_DUMP_HEADER_SIZE_BLUEZ];
+        uint8_t header_packetlogger[HCI_DUMP_HEADER_SIZE_PACKETLOGGER];
+        uint8_t header_btsnoop[HCI_DUMP_HEADER_SIZE_BTSNOOP+1];
+    } header;
+
+    uint32_t tv_sec = 0;
+    uint32_t tv_us  = 0;
+    uint64_t ts_usec;
+
+    // get time
+    struct timeval curr_time;
+    gettimeofday(&curr_time, NULL);
+    tv_sec = curr_time.tv_sec;
+    tv_us  = curr_time.tv_usec;
+
+    uint16_t header_len = 0;
+    switch (dump_format){
+        case HCI_DUMP_BLUEZ:
+            // ISO packets not supported
+            if (packet_type == HCI_ISO_DATA_PACKET){
+                len = hci_dump_iso_summary(in, packet, len);
+                packet_type = LOG_MESSAGE_PACKET;
+                packet = (uint8_t*) log_message_buffer;
+            }
+            hci_dump_setup_header_bluez(header.header_bluez, tv_sec, tv_us, packet_type, in, len);
+            header_len = HCI_DUMP_HEADER_SIZE_BLUEZ;
+            break;
+        case HCI_DUMP_PACKETLOGGER:
+            // ISO packets not supported
+            if (packet_type == HCI_ISO_DATA_PACKET){
+                len = hci_dump_iso_summary(in, packet, len);
+                packet_type = LOG_MESSAGE_PACKET;
+                packet = (uint8_t*) log_message_buffer;
+            }
+            hci_dump_setup_header_packetlogger(header.header_packetlogger, tv_sec, tv_us, packet_type, in, len);
+            header_len = HCI_DUMP_HEADER_SIZE_PACKETLOGGER;
+            break;
+        case HCI_DUMP_BTSNOOP:
+            // log messages not supported
+            if (packet_type == LOG_MESSAGE_PACKET) return true;
+            ts_usec = 0xdcddb30f2f8000LLU + 1000000LLU * curr_time.tv_sec + curr_time.tv_usec;
+            // append packet type to pcap header, report dropped packets
+            hci_dump_setup_header_btsnoop(header.header_btsnoop, ts_usec >> 32, ts_usec & 0xFFFFFFFF, dropped_packets, packet_type, in, len+1);
+            header.header_btsnoop[HCI_DUMP_HEADER_SIZE_BTSNOOP] = packet_type;
+            header_len = HCI_DUMP_HEADER_SIZE_BTSNOOP + 1;
+            break;
+        default:
+            btstack_unreachable();
+            return true;
+    }
+
+    // record length must fit into 16 bit and not collide with RECORD_LEN_PADDING
+    uint32_t record_len = header_len + len;
+    if ((record_len >= RECORD_LEN_PADDING) || (record_len > (HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE / 2u))) {
+        return false;
+    }
+
+    uint32_t new_head;
+    uint8_t * record = hci_dump_posix_fs_async_reserve((uint16_t) record_len, &new_head);
+    if (record == NULL){
+        return false;
+    }
+    (void) memcpy(record, &header, header_len);
+    (void) memcpy(&record[header_len], packet, len);
+    hci_dump_posix_fs_async_commit(new_head);
+    return true;
+}
+
+static void hci_dump_posix_fs_async_log_packet(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len) {
+    if (writer_running == false) return;
+
+    if (reset_pending){
+        hci_dump_posix_fs_async_reset();
+    }
+
+    // BTSnoop reports dropped packets in packet header, use log message for other formats
+    if ((dropped_packets != reported_dropped_packets) && (dump_format != HCI_DUMP_BTSNOOP)){
+        uint32_t num_dropped = dropped_packets;
+        int message_len = snprintf(log_message_buffer, sizeof(log_message_buffer), "hci_dump: %u packets dropped",
+                                   (unsigned int) (num_dropped - reported_dropped_packets));
+        if (hci_dump_posix_fs_async_store(LOG_MESSAGE_PACKET, 0, (uint8_t *) log_message_buffer, message_len)){
+            reported_dropped_packets = num_dropped;
+        }
+    }
+
+    if (hci_dump_posix_fs_async_store(packet_type, in, packet, len) == false){
+        dropped_packets++;
+    }
+}
+
+static void hci_dump_posix_fs_async_log_message(int log_level, const char * format, va_list argptr){
+    UNUSED(log_level);
+    if (writer_running == false) return;
+    int len = vsnprintf(log_message_buffer, sizeof(log_message_buffer), format, argptr);
+    hci_dump_posix_fs_async_log_packet(LOG_MESSAGE_PACKET, 0, (uint8_t*) log_message_buffer, len);
+}
+
+// Writer thread - must not use log_xxx as this would write into the ring buffer from a second thread
+
+static void hci_dump_posix_fs_async_write_file_header(void){
+    dump_file_size = 0;
+    if (dump_format != HCI_DUMP_BTSNOOP) return;
+    ssize_t bytes_written = write(dump_file, &btsnoop_file_header, sizeof(btsnoop_file_header));
+    if (bytes_written > 0){
+        dump_file_size = (uint32_t) bytes_written;
+    }
+}
+
+static void hci_dump_posix_fs_async_truncate_file(void){
+    (void) lseek(dump_file, 0, SEEK_SET);
+    int err = ftruncate(dump_file, 0);
+    UNUSED(err);
+    hci_dump_posix_fs_async_write_file_header();
+}
+
+static void hci_dump_posix_fs_async_rotate_file(void){
+    if (max_backup_files == 0){
+        hci_dump_posix_fs_async_truncate_file();
+        return;
+    }
+    close(dump_file);
+
+    // filename.1 -> filename.2, ..., filename -> filename.1
+    char old_path[PATH_MAX + 8];
+    char new_path[PATH_MAX + 8];
+    uint16_t i;
+    for (i = max_backup_files; i > 1; i--){
+        snprintf(old_path, sizeof(old_path), "%s.%u", dump_filename, i - 1);
+        snprintf(new_path, sizeof(new_path), "%s.%u", dump_filename, i);
+        (void) rename(old_path, new_path);
+    }
+    snprintf(new_path, sizeof(new_path), "%s.1", dump_filename);
+    (void) rename(dump_filename, new_path);
+
+    int oflags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef _WIN32
+    oflags |= O_BINARY;
+#endif
+    dump_file = open(dump_filename, oflags, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+    if (dump_file < 0){
+        dump_file_size = 0;
+        return;
+    }
+    hci_dump_posix_fs_async_write_file_header();
+}
+
+static void hci_dump_posix_fs_async_write_batch(struct iovec * iov, int num_iovecs){
+    while ((num_iovecs > 0) && (dump_file >= 0)){
+        ssize_t bytes_written = writev(dump_file, iov, num_iovecs);
+        if (bytes_written < 0){
+            if (errno == EINTR) continue;
+            // packets are lost
+            return;
+        }
+        dump_file_size += (uint32_t) bytes_written;
+        // skip written iovecs, continue after partial write
+        while ((num_iovecs > 0) && ((size_t) bytes_written >= iov->iov_len)){
+            bytes_written -= (ssize_t) iov->iov_len;
+            iov++;
+            num_iovecs--;
+        }
+        if (num_iovecs > 0){
+            iov->iov_base = &((uint8_t *) iov->iov_base)[bytes_written];
+            iov->iov_len -= (size_t) bytes_written;
+        }
+    }
+}
+
+static void hci_dump_posix_fs_async_drain(void){
+    struct iovec iov[HCI_DUMP_POSIX_FS_ASYNC_MAX_IOVECS];
+    int num_iovecs = 0;
+    uint32_t batch_size = 0;
+
+    uint32_t head = __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE);
+    uint32_t tail = ring_tail;
+    while (tail != head){
+        uint32_t offset = tail & RING_BUFFER_MASK;
+        uint32_t contiguous = HCI_DUMP_POSIX_FS_ASYNC_BUFFER_SIZE - offset;
+        if (contiguous < RECORD_LEN_SIZE){
+            tail += contiguous;
+            continue;
+        }
+        uint16_t record_len = little_endian_read_16(&ring_buffer[offset], 0);
+        if (record_len == RECORD_LEN_PADDING){
+            tail += contiguous;
+            continue;
+        }
+
+        uint32_t file_header_size = (dump_format == HCI_DUMP_BTSNOOP) ? sizeof(btsnoop_file_header) : 0;
+        uint32_t file_size = dump_file_size + batch_size;
+        bool rotate = (max_file_size > 0) && ((file_size + record_len) > max_file_size) && (file_size > file_header_size);
+        bool reset  = record_len == RECORD_LEN_RESET;
+
+        if (reset || rotate || (num_iovecs == HCI_DUMP_POSIX_FS_ASYNC_MAX_IOVECS)){
+            hci_dump_posix_fs_async_write_batch(iov, num_iovecs);
+            num_iovecs = 0;
+            batch_size = 0;
+            __atomic_store_n(&ring_tail, tail, __ATOMIC_RELEASE);
+            if (reset){
+                hci_dump_posix_fs_async_truncate_file();
+                tail += RECORD_LEN_SIZE;
+                continue;
+            }
+            if (rotate){
+                hci_dump_posix_fs_async_rotate_file();
+            }
+        }
+
+        iov[num_iovecs].iov_base = &ring_buffer[offset + RECORD_LEN_SIZE];
+        iov[num_iovecs].iov_len  = record_len;
+        num_iovecs++;
+        batch_size += record_len;
+        tail += RECORD_LEN_SIZE + record_len;
+    }
+
+    hci_dump_posix_fs_async_write_batch(iov, num_iovecs);
+    __atomic_store_n(&ring_tail, tail, __ATOMIC_RELEASE);
+}
+
+static void * hci_dump_posix_fs_async_writer(void * context){
+    UNUSED(context);
+    bool stop = false;
+    while (stop == false){
+        pthread_mutex_lock(&writer_mutex);
+        if (writer_stop == false){
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_nsec += HCI_DUMP_POSIX_FS_ASYNC_FLUSH_INTERVAL_MS * 1000000L;
+            deadline.tv_sec  += deadline.tv_nsec / 1000000000L;
+            deadline.tv_nsec  = deadline.tv_nsec % 1000000000L;
+            (void) pthread_cond_timedwait(&writer_cond, &writer_mutex, &deadline);
+        }
+        stop = writer_stop;
+        pthread_mutex_unlock(&writer_mutex);
+
+        hci_dump_posix_fs_async_drain();
+    }
+    return NULL;
+}
+
+// returns system errno
+int hci_dump_posix_fs_async_open(const char *filename, hci_dump_format_t format){
+    btstack_assert(format == HCI_DUMP_BLUEZ || format == HCI_DUMP_PACKETLOGGER || format == HCI_DUMP_BTSNOOP);
+    btstack_assert(writer_running == false);
+
+    if (strlen(filename) >= sizeof(dump_filename)){
+        return ENAMETOOLONG;
+    }
+    (void) btstack_strcpy(dump_filename, sizeof(dump_filename), filename);
+
+    dump_format = format;
+    int oflags = O_WRONLY | O_CREAT | O_TRUNC;
+#ifdef _WIN32
+    oflags |= O_BINARY;
+#endif
+    dump_file = open(filename, oflags, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+    if (dump_file < 0){
+        printf("failed to open file %s, errno = %d\n", filename, errno);
+        return errno;
+    }
+    hci_dump_posix_fs_async_write_file_header();
+
+    ring_head = 0;
+    ring_tail = 0;
+    reset_pending = false;
+    dropped_packets = 0;
+    reported_dropped_packets = 0;
+    writer_stop = false;
+
+    int err = pthread_create(&writer_thread, NULL, &hci_dump_posix_fs_async_writer, NULL);
+    if (err != 0){
+        printf("failed to start writer thread, err = %d\n", err);
+        close(dump_file);
+        dump_file = -1;
+        return err;
+    }
+    writer_running = true;
+    return 0;
+}
+
+void hci_dump_posix_fs_async_set_max_file_size(uint32_t max_size, uint16_t num_backup_files){
+    // writer thread reads config without lock
+    btstack_assert(writer_running == false);
+    max_file_size = max_size;
+    max_backup_files = num_backup_files;
+}
+
+uint32_t hci_dump_posix_fs_async_get_dropped_packets(void){
+    return dropped_packets;
+}
+
+void hci_dump_posix_fs_async_close(void){
+    if (writer_running == false) return;
+
+    // writer thread stores pending packets before it exits
+    pthread_mutex_lock(&writer_mutex);
+    writer_stop = true;
+    pthread_cond_signal(&writer_cond);
+    pthread_mutex_unlock(&writer_mutex);
+    (void) pthread_join(writer_thread, NULL);
+    writer_running = false;
+
+    if (dump_file >= 0){
+        close(dump_file);
+    }
+    dump_file = -1;
+}
+
+const hci_dump_t * hci_dump_posix_fs_async_get_instance(void){
+    static const hci_dump_t hci_dump_instance = {
+        // void (*reset)(void);
+        &hci_dump_posix_fs_async_reset,
+        // void (*log_packet)(uint8_t packet_type, uint8_t in, uint8_t *packet, uint16_t len);
+        &hci_dump_posix_fs_async_log_packet,
+        // void (*log_message)(int log_level, const char * format, va_list argptr);
+        &hci_dump_posix_fs_async_log_message,
+    };
+    return &hci_dump_instance;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2024 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/*
+ *  Dump HCI trace in binary formats like PacketLogger and BlueZ (hcidump) into file
+ *  using a separate writer thread
+ */
+
+#ifndef HCI_DUMP_POSIX_FS_ASYNC_H
+#define HCI_DUMP_POSIX_FS_ASYNC_H
+
+#include <stdint.h>
+#include "hci_dump.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+/* API_START */
+
+/**
+ * @brief Get HCI Dump POSIX FS Async Instance
+ *
+ * In contrast to hci_dump_posix_fs, packets are only copied into a ring buffer on the calling thread.
+ * A writer thread stores them in batches using writev(). If the ring buffer is full, packets are
+ * dropped and reported via the cumulative drops field in BTSnoop format or via a log message otherwise.
+ * @return hci_dump_impl
+ */
+const hci_dump_t * hci_dump_posix_fs_async_get_instance(void);
+
+/*
+ * @brief Open Log file and start writer thread
+ * @param filename or path
+ * @param format
+ * @returns 0 if ok, errno otherwise
+ */
+int hci_dump_posix_fs_async_open(const char *filename, hci_dump_format_t format);
+
+/*
+ * @brief Rotate log file when it would exceed max size. Previous logs are kept as 'filename.1', 'filename.2', ...
+ * @note must be called before hci_dump_posix_fs_async_open
+ * @param max_file_size in bytes, 0 for unlimited (default)
+ * @param num_backup_files to keep
+ */
+void hci_dump_posix_fs_async_set_max_file_size(uint32_t max_file_size, uint16_t num_backup_files);
+
+/*
+ * @brief Get number of packets that were dropped as the ring buffer was full
+ * @return dropped packets
+ */
+uint32_t hci_dump_posix_fs_async_get_dropped_packets(void);
+
+/*
+ * @brief Flush pending packets, stop writer thread and close Log file
+ */
+void hci_dump_posix_fs_async_close(void);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+#endif // HCI_DUMP_POSIX_FS_ASYNC_H
@@ -263,10 +263,10 @@ void BTstackRunLoopQt::processDataSource(HANDLE handle){
         if (handle == ds->source.handle){
             if (ds->flags & DATA_SOURCE_CALLBACK_READ){
                 log_debug("process read ds %p with handle %p", ds, ds->source.handle);
-                ds->process(ds, DATA_SOURCE_CALLBACK_READ);
+                btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_READ);
             } else if (ds->flags & DATA_SOURCE_CALLBACK_WRITE){
                 log_debug("process write ds %p with handle %p", ds, ds->source.handle);
-                ds->process(ds, DATA_SOURCE_CALLBACK_WRITE);
+                btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_WRITE);
             }
             break;
         }
@@ -283,7 +283,7 @@ void BTstackRunLoopQt::processCallbacks(void) {
         if (callback_registration == NULL){
             break;
         }
-        (*callback_registration->callback)(callback_registration->context);
+        btstack_run_loop_base_execute_callback(callback_registration);
     }
 }
 
@@ -312,12 +312,12 @@ static void btstack_run_loop_qt_process_data_source(int fd, uint16_t callback_ty
         if (fd == ds->source.fd){
             if ((callback_types & DATA_SOURCE_CALLBACK_READ) != 0){
                 if ((ds->flags & DATA_SOURCE_CALLBACK_READ)  != 0){
-                    ds->process(ds, DATA_SOURCE_CALLBACK_READ);
+                    btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_READ);
                 }
             }
             if ((callback_types & DATA_SOURCE_CALLBACK_WRITE) != 0){
                 if ((ds->flags & DATA_SOURCE_CALLBACK_WRITE)  != 0){
-                    ds->process(ds, DATA_SOURCE_CALLBACK_WRITE);
+                    btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_WRITE);
                 }
             }
             break;
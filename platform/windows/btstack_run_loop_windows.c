@@ -133,10 +133,10 @@ static void btstack_run_loop_windows_execute(void) {
                 if (triggered_handle == ds->source.handle){
                     if (ds->flags & DATA_SOURCE_CALLBACK_READ){
                         log_debug("btstack_run_loop_windows_execute: process read ds %p with handle %p\n", ds, ds->source.handle);
-                        ds->process(ds, DATA_SOURCE_CALLBACK_READ);
+                        btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_READ);
                     } else if (ds->flags & DATA_SOURCE_CALLBACK_WRITE){
                         log_debug("btstack_run_loop_windows_execute: process write ds %p with handle %p\n", ds, ds->source.handle);
-                        ds->process(ds, DATA_SOURCE_CALLBACK_WRITE);
+                        btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_WRITE);
                     }
                     break;
                 }
@@ -171,7 +171,7 @@ static void btstack_run_loop_windows_process_callbacks_handler(btstack_data_sour
         if (callback_registration == NULL){
             break;
         }
-        (*callback_registration->callback)(callback_registration->context);
+        btstack_run_loop_base_execute_callback(callback_registration);
     }
 }
 
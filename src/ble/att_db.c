@@ -86,6 +86,12 @@ static uint16_t uuid16_from_uuid(uint16_t uuid_len, uint8_t * uuid){
 typedef struct att_iterator {
     // private
     uint8_t const * att_ptr;
+#ifdef ENABLE_ATT_DB_INDEX
+    // only visit attributes [uuid16_pos..uuid16_end) of uuid16 index
+    bool     uuid16_only;
+    uint16_t uuid16_pos;
+    uint16_t uuid16_end;
+#endif
     // public
     uint16_t size;
     uint16_t flags;
@@ -107,8 +113,218 @@ static uint16_t att_prepare_write_error_handle = 0x0000;
 static uint16_t att_persistent_ccc_handle;
 static uint16_t att_persistent_ccc_uuid16;
 
+#ifdef ENABLE_ATT_DB_INDEX
+
+#ifndef MAX_ATT_DB_INDEX_ENTRIES
+#define MAX_ATT_DB_INDEX_ENTRIES 256
+#endif
+
+// index over att_database, requires ascending handles
+static bool     att_db_index_valid;
+static uint16_t att_db_index_end_offset;
+// offset of attribute by position
+static uint16_t att_db_index_num_attributes;
+static uint16_t att_db_index_offsets[MAX_ATT_DB_INDEX_ENTRIES];
+// positions of attributes with 16-bit UUID, sorted by UUID, then position
+static uint16_t att_db_index_num_uuid16;
+static uint16_t att_db_index_uuid16[MAX_ATT_DB_INDEX_ENTRIES];
+static uint16_t att_db_index_uuid16_positions[MAX_ATT_DB_INDEX_ENTRIES];
+// positions of primary and secondary service declarations
+static uint16_t att_db_index_num_services;
+static uint16_t att_db_index_services[MAX_ATT_DB_INDEX_ENTRIES];
+
+static void att_db_index_build(void){
+    att_db_index_valid = false;
+    att_db_index_num_attributes = 0;
+    att_db_index_num_uuid16 = 0;
+    att_db_index_num_services = 0;
+    if (att_database == NULL){
+        return;
+    }
+
+    uint32_t offset = 0;
+    uint16_t prev_handle = 0;
+    while (true){
+        if (offset > 0xffffu){
+            log_info("ATT DB Index: database too large");
+            return;
+        }
+        uint16_t size = little_endian_read_16(att_database, offset);
+        if (size == 0u){
+            break;
+        }
+        if (att_db_index_num_attributes == (uint16_t) MAX_ATT_DB_INDEX_ENTRIES){
+            log_info("ATT DB Index: more than %u attributes", (unsigned int) MAX_ATT_DB_INDEX_ENTRIES);
+            return;
+        }
+        uint16_t flags  = little_endian_read_16(att_database, offset + 2u);
+        uint16_t handle = little_endian_read_16(att_database, offset + 4u);
+        if (handle <= prev_handle){
+            log_info("ATT DB Index: handle 0x%04x not ascending", handle);
+            return;
+        }
+        prev_handle = handle;
+
+        uint16_t position = att_db_index_num_attributes++;
+        att_db_index_offsets[position] = (uint16_t) offset;
+
+        // get 16-bit UUID
+        uint8_t const * uuid = &att_database[offset + 6u];
+        uint16_t uuid16;
+        if ((flags & (uint16_t)ATT_PROPERTY_UUID128) == 0u){
+            uuid16 = little_endian_read_16(uuid, 0);
+        } else if (is_Bluetooth_Base_UUID(uuid)){
+            uuid16 = little_endian_read_16(uuid, 12);
+        } else {
+            uuid16 = 0;
+        }
+
+        if (uuid16 != 0u){
+            // insert after entries with same or lower UUID
+            uint16_t i = att_db_index_num_uuid16++;
+            while ((i > 0u) && (att_db_index_uuid16[i-1u] > uuid16)){
+                att_db_index_uuid16[i] = att_db_index_uuid16[i-1u];
+                att_db_index_uuid16_positions[i] = att_db_index_uuid16_positions[i-1u];
+                i--;
+            }
+            att_db_index_uuid16[i] = uuid16;
+            att_db_index_uuid16_positions[i] = position;
+        }
+
+        if ((uuid16 == (uint16_t)GATT_PRIMARY_SERVICE_UUID) || (uuid16 == (uint16_t)GATT_SECONDARY_SERVICE_UUID)){
+            att_db_index_services[att_db_index_num_services++] = position;
+        }
+
+        offset += size;
+    }
+    att_db_index_end_offset = (uint16_t) offset;
+    att_db_index_valid = true;
+    log_info("ATT DB Index: %u attributes, %u services", att_db_index_num_attributes, att_db_index_num_services);
+}
+
+static bool att_db_index_available(void){
+    if (att_db_index_valid == false){
+        return false;
+    }
+    // att_db_util may append attributes after att_set_db
+    if (little_endian_read_16(att_database, att_db_index_end_offset) != 0u){
+        att_db_index_build();
+    }
+    return att_db_index_valid;
+}
+
+static uint16_t att_db_index_handle(uint16_t position){
+    return little_endian_read_16(att_database, att_db_index_offsets[position] + 4u);
+}
+
+// position of first attribute with handle >= handle in positions[low..high)
+static uint16_t att_db_index_lower_bound(const uint16_t * positions, uint16_t low, uint16_t high, uint16_t handle){
+    while (low < high){
+        uint16_t mid = (low + high) >> 1;
+        uint16_t position = (positions == NULL) ? mid : positions[mid];
+        if (att_db_index_handle(position) < handle){
+            low = mid + 1u;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// first entry in uuid16 index with uuid > uuid16 (upper == true) or >= uuid16
+static uint16_t att_db_index_uuid16_bound(uint16_t uuid16, bool upper){
+    uint16_t low  = 0;
+    uint16_t high = att_db_index_num_uuid16;
+    while (low < high){
+        uint16_t mid = (low + high) >> 1;
+        uint16_t value = att_db_index_uuid16[mid];
+        if ((value < uuid16) || (upper && (value == uuid16))){
+            low = mid + 1u;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// handle of last attribute in service group
+static uint16_t att_db_index_service_end_handle(uint16_t service){
+    uint16_t next_service = service + 1u;
+    if (next_service < att_db_index_num_services){
+        return att_db_index_handle(att_db_index_services[next_service] - 1u);
+    }
+    return att_db_index_handle(att_db_index_num_attributes - 1u);
+}
+
+// handle that terminates a service group scan: next service declaration or last attribute
+static uint16_t att_db_index_service_scan_handle(uint16_t service){
+    uint16_t next_service = service + 1u;
+    if (next_service < att_db_index_num_services){
+        return att_db_index_handle(att_db_index_services[next_service]);
+    }
+    return att_db_index_handle(att_db_index_num_attributes - 1u);
+}
+
+static void att_iterator_init_at_position(att_iterator_t *it, uint16_t position){
+    it->uuid16_only = false;
+    if (position < att_db_index_num_attributes){
+        it->att_ptr = &att_database[att_db_index_offsets[position]];
+    } else {
+        it->att_ptr = &att_database[att_db_index_end_offset];
+    }
+}
+
+static void att_iterator_uuid16_next(att_iterator_t *it){
+    if (it->uuid16_pos < it->uuid16_end){
+        it->att_ptr = &att_database[att_db_index_offsets[att_db_index_uuid16_positions[it->uuid16_pos]]];
+        it->uuid16_pos++;
+    } else {
+        it->att_ptr = &att_database[att_db_index_end_offset];
+    }
+}
+
+#endif
+
 static void att_iterator_init(att_iterator_t *it){
     it->att_ptr = att_database;
+#ifdef ENABLE_ATT_DB_INDEX
+    it->uuid16_only = false;
+#endif
+}
+
+// init iterator to skip attributes with handle < start_handle
+static void att_iterator_init_from_handle(att_iterator_t *it, uint16_t start_handle){
+#ifdef ENABLE_ATT_DB_INDEX
+    if (att_db_index_available()){
+        att_iterator_init_at_position(it, att_db_index_lower_bound(NULL, 0, att_db_index_num_attributes, start_handle));
+        return;
+    }
+#else
+    UNUSED(start_handle);
+#endif
+    att_iterator_init(it);
+}
+
+// init iterator to skip attributes with handle < start_handle that don't match uuid16
+static void att_iterator_init_for_uuid16(att_iterator_t *it, uint16_t start_handle, uint16_t uuid16){
+#ifdef ENABLE_ATT_DB_INDEX
+    if ((uuid16 != 0u) && att_db_index_available()){
+        uint16_t low  = att_db_index_uuid16_bound(uuid16, false);
+        uint16_t high = att_db_index_uuid16_bound(uuid16, true);
+        it->uuid16_only = true;
+        it->uuid16_pos  = att_db_index_lower_bound(att_db_index_uuid16_positions, low, high, start_handle);
+        it->uuid16_end  = high;
+        it->att_ptr     = att_database;
+        return;
+    }
+#else
+    UNUSED(uuid16);
+#endif
+    att_iterator_init_from_handle(it, start_handle);
+}
+
+static void att_iterator_init_for_uuid(att_iterator_t *it, uint16_t start_handle, uint16_t uuid_len, const uint8_t * uuid){
+    att_iterator_init_for_uuid16(it, start_handle, uuid16_from_uuid(uuid_len, (uint8_t *) uuid));
 }
 
 static bool att_iterator_has_next(att_iterator_t *it){
@@ -116,6 +332,11 @@ static bool att_iterator_has_next(att_iterator_t *it){
 }
 
 static void att_iterator_fetch_next(att_iterator_t *it){
+#ifdef ENABLE_ATT_DB_INDEX
+    if (it->uuid16_only){
+        att_iterator_uuid16_next(it);
+    }
+#endif
     it->size   = little_endian_read_16(it->att_ptr, 0);
     if (it->size == 0u){
         it->flags = 0;
@@ -178,6 +399,17 @@ static int att_find_handle(att_iterator_t *it, uint16_t handle){
     if (handle == 0u){
         return 0u;
     }
+#ifdef ENABLE_ATT_DB_INDEX
+    if (att_db_index_available()){
+        uint16_t position = att_db_index_lower_bound(NULL, 0, att_db_index_num_attributes, handle);
+        if ((position == att_db_index_num_attributes) || (att_db_index_handle(position) != handle)){
+            return 0;
+        }
+        att_iterator_init_at_position(it, position);
+        att_iterator_fetch_next(it);
+        return 1;
+    }
+#endif
     att_iterator_init(it);
     while (att_iterator_has_next(it)){
         att_iterator_fetch_next(it);
@@ -189,6 +421,27 @@ static int att_find_handle(att_iterator_t *it, uint16_t handle){
     return 0;
 }
 
+// handle of first attribute >= start_handle that matches uuid16 or uuid128 (uuid_len 16). start_handle if no index
+static uint16_t att_find_first_handle_for_uuid(uint16_t start_handle, uint16_t uuid_len, uint16_t uuid16, const uint8_t * uuid128){
+#ifdef ENABLE_ATT_DB_INDEX
+    if (uuid_len == 16u){
+        uuid16 = uuid16_from_uuid(uuid_len, (uint8_t *) uuid128);
+    }
+    if ((uuid16 != 0u) && att_db_index_available()){
+        att_iterator_t it;
+        att_iterator_init_for_uuid16(&it, start_handle, uuid16);
+        att_iterator_fetch_next(&it);
+        // no match: start after last attribute
+        return (it.handle != 0u) ? it.handle : 0xffffu;
+    }
+#else
+    UNUSED(uuid_len);
+    UNUSED(uuid16);
+    UNUSED(uuid128);
+#endif
+    return start_handle;
+}
+
 // experimental client API
 uint16_t att_uuid_for_handle(uint16_t attribute_handle){
     att_iterator_t it;
@@ -237,6 +490,9 @@ void att_set_db(uint8_t const * db){
     log_info("att_set_db %p", db);
     // ignore db version
     att_database = &db[1];
+#ifdef ENABLE_ATT_DB_INDEX
+    att_db_index_build();
+#endif
 }
 
 void att_set_read_callback(att_read_callback_t callback){
@@ -441,7 +697,7 @@ static uint16_t handle_find_information_request2(att_connection_t * att_connecti
     uint16_t uuid_len = 0;
     
     att_iterator_t it;
-    att_iterator_init(&it);
+    att_iterator_init_from_handle(&it, start_handle);
     while (att_iterator_has_next(&it)){
         att_iterator_fetch_next(&it);
         if (!it.handle){
@@ -506,6 +762,44 @@ static uint16_t handle_find_information_request(att_connection_t * att_connectio
     return handle_find_information_request2(att_connection, response_buffer, response_buffer_size, start_handle, end_handle);
 }
 
+#ifdef ENABLE_ATT_DB_INDEX
+// same as handle_find_by_type_value_request for primary/secondary service type, but only visits service declarations
+static uint16_t handle_find_by_type_value_request_indexed(uint8_t * response_buffer, uint16_t response_buffer_size, uint16_t start_handle, uint16_t end_handle,
+                                                          uint16_t attribute_type, const uint8_t * attribute_value, uint16_t attribute_len){
+    uint16_t offset = 1;
+    uint16_t service;
+    for (service = att_db_index_lower_bound(att_db_index_services, 0, att_db_index_num_services, start_handle); service < att_db_index_num_services; service++){
+        att_iterator_t it;
+        att_iterator_init_at_position(&it, att_db_index_services[service]);
+        att_iterator_fetch_next(&it);
+        if (it.handle > end_handle){
+            break;
+        }
+        if (att_iterator_match_uuid16(&it, attribute_type) && (attribute_len == it.value_len) && (memcmp(attribute_value, it.value, it.value_len) == 0)){
+            little_endian_store_16(response_buffer, offset, it.handle);
+            offset += 2u;
+            // group is only closed if next service declaration or end of att db is within requested range
+            if (att_db_index_service_scan_handle(service) > end_handle){
+                break;
+            }
+            little_endian_store_16(response_buffer, offset, att_db_index_service_end_handle(service));
+            offset += 2u;
+            // check if space for another handle pair available
+            if ((offset + 4u) > response_buffer_size){
+                break;
+            }
+        }
+    }
+
+    if (offset == 1u){
+        return setup_error_atribute_not_found(response_buffer, ATT_FIND_BY_TYPE_VALUE_REQUEST, start_handle);
+    }
+
+    response_buffer[0] = ATT_FIND_BY_TYPE_VALUE_RESPONSE;
+    return offset;
+}
+#endif
+
 //
 // MARK: ATT_FIND_BY_TYPE_VALUE
 //
@@ -541,12 +835,18 @@ static uint16_t handle_find_by_type_value_request(att_connection_t * att_connect
         return setup_error_invalid_handle(response_buffer, request_type, start_handle);
     }
 
+#ifdef ENABLE_ATT_DB_INDEX
+    if (((attribute_type == (uint16_t)GATT_PRIMARY_SERVICE_UUID) || (attribute_type == (uint16_t)GATT_SECONDARY_SERVICE_UUID)) && att_db_index_available()){
+        return handle_find_by_type_value_request_indexed(response_buffer, response_buffer_size, start_handle, end_handle, attribute_type, attribute_value, attribute_len);
+    }
+#endif
+
     uint16_t offset      = 1;
     bool in_group        = false;
     uint16_t prev_handle = 0;
 
     att_iterator_t it;
-    att_iterator_init(&it);
+    att_iterator_init_from_handle(&it, start_handle);
     while (att_iterator_has_next(&it)){
         att_iterator_fetch_next(&it);
 
@@ -611,7 +911,7 @@ static uint16_t handle_read_by_type_request2(att_connection_t * att_connection,
     uint16_t pair_len = 0;
 
     att_iterator_t it;
-    att_iterator_init(&it);
+    att_iterator_init_for_uuid(&it, start_handle, attribute_type_len, attribute_type);
     uint8_t error_code = 0;
     uint16_t first_matching_but_unreadable_handle = 0;
 
@@ -933,6 +1233,65 @@ static uint16_t handle_read_multiple_request(att_connection_t * att_connection,
     return handle_read_multiple_request2(att_connection, response_buffer, response_buffer_size, num_handles, &request_buffer[1]);
 }
 
+#ifdef ENABLE_ATT_DB_INDEX
+// same as handle_read_by_group_type_request2, but only visits service declarations
+static uint16_t handle_read_by_group_type_request_indexed(uint8_t * response_buffer, uint16_t response_buffer_size,
+                                                          uint16_t start_handle, uint16_t end_handle,
+                                                          uint16_t attribute_type_len, uint8_t * attribute_type){
+    uint16_t offset   = 1;
+    uint16_t pair_len = 0;
+    uint16_t service;
+    for (service = att_db_index_lower_bound(att_db_index_services, 0, att_db_index_num_services, start_handle); service < att_db_index_num_services; service++){
+        att_iterator_t it;
+        att_iterator_init_at_position(&it, att_db_index_services[service]);
+        att_iterator_fetch_next(&it);
+        if (it.handle > end_handle){
+            break;
+        }
+        if (!att_iterator_match_uuid(&it, attribute_type, attribute_type_len)){
+            continue;
+        }
+
+        // check if value has same len as last one
+        uint16_t this_pair_len = 4u + it.value_len;
+        if ((offset > 1u) && (this_pair_len != pair_len)){
+            break;
+        }
+
+        // first
+        if (offset == 1u) {
+            pair_len = this_pair_len;
+            response_buffer[offset] = (uint8_t) this_pair_len;
+            offset++;
+        }
+
+        // group is only reported if it ends within requested range
+        if (att_db_index_service_scan_handle(service) > end_handle){
+            break;
+        }
+
+        little_endian_store_16(response_buffer, offset, it.handle);
+        offset += 2u;
+        little_endian_store_16(response_buffer, offset, att_db_index_service_end_handle(service));
+        offset += 2u;
+        (void)memcpy(response_buffer + offset, it.value, pair_len - 4u);
+        offset += pair_len - 4u;
+
+        // check if space for another handle pair available
+        if ((offset + pair_len) > response_buffer_size){
+            break;
+        }
+    }
+
+    if (offset == 1u){
+        return setup_error_atribute_not_found(response_buffer, ATT_READ_BY_GROUP_TYPE_REQUEST, start_handle);
+    }
+
+    response_buffer[0] = ATT_READ_BY_GROUP_TYPE_RESPONSE;
+    return offset;
+}
+#endif
+
 //
 // MARK: ATT_READ_BY_GROUP_TYPE_REQUEST 0x10
 //
@@ -969,6 +1328,12 @@ static uint16_t handle_read_by_group_type_request2(att_connection_t * att_connec
         return setup_error(response_buffer, request_type, start_handle, ATT_ERROR_UNSUPPORTED_GROUP_TYPE);
     }
 
+#ifdef ENABLE_ATT_DB_INDEX
+    if (att_db_index_available()){
+        return handle_read_by_group_type_request_indexed(response_buffer, response_buffer_size, start_handle, end_handle, attribute_type_len, attribute_type);
+    }
+#endif
+
     uint16_t offset   = 1;
     uint16_t pair_len = 0;
     bool     in_group = false;
@@ -977,7 +1342,7 @@ static uint16_t handle_read_by_group_type_request2(att_connection_t * att_connec
     uint16_t prev_handle = 0;
 
     att_iterator_t it;
-    att_iterator_init(&it);
+    att_iterator_init_from_handle(&it, start_handle);
     while (att_iterator_has_next(&it)){
         att_iterator_fetch_next(&it);
         
@@ -1356,6 +1721,28 @@ bool gatt_server_get_handle_range_for_service_with_uuid16(uint16_t uuid16, uint1
     int attribute_len = sizeof(attribute_value);
     little_endian_store_16(attribute_value, 0, uuid16);
 
+#ifdef ENABLE_ATT_DB_INDEX
+    if (att_db_index_available()){
+        uint16_t service;
+        for (service = 0; service < att_db_index_num_services; service++){
+            att_iterator_t it;
+            att_iterator_init_at_position(&it, att_db_index_services[service]);
+            att_iterator_fetch_next(&it);
+            if ((attribute_len != it.value_len) || (memcmp(attribute_value, it.value, it.value_len) != 0)){
+                continue;
+            }
+            // check range
+            uint16_t service_end = att_db_index_service_end_handle(service);
+            if ((it.handle >= *start_handle) && (service_end <= *end_handle)){
+                *start_handle = it.handle;
+                *end_handle = service_end;
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
+
     att_iterator_t it;
     att_iterator_init(&it);
     while (att_iterator_has_next(&it)){
@@ -1389,7 +1776,7 @@ bool gatt_server_get_handle_range_for_service_with_uuid16(uint16_t uuid16, uint1
 // returns false if not found
 uint16_t gatt_server_get_value_handle_for_characteristic_with_uuid16(uint16_t start_handle, uint16_t end_handle, uint16_t uuid16){
     att_iterator_t it;
-    att_iterator_init(&it);
+    att_iterator_init_for_uuid16(&it, start_handle, uuid16);
     while (att_iterator_has_next(&it)){
         att_iterator_fetch_next(&it);
         if ((it.handle != 0u) && (it.handle < start_handle)){
@@ -1410,7 +1797,7 @@ uint16_t gatt_server_get_value_handle_for_characteristic_with_uuid16(uint16_t st
 
 uint16_t gatt_server_get_descriptor_handle_for_characteristic_with_uuid16(uint16_t start_handle, uint16_t end_handle, uint16_t characteristic_uuid16, uint16_t descriptor_uuid16){
     att_iterator_t it;
-    att_iterator_init(&it);
+    att_iterator_init_from_handle(&it, att_find_first_handle_for_uuid(start_handle, 2, characteristic_uuid16, NULL));
     bool characteristic_found = false;
     while (att_iterator_has_next(&it)){
         att_iterator_fetch_next(&it);
@@ -1461,6 +1848,23 @@ bool gatt_server_get_handle_range_for_service_with_uuid128(const uint8_t * uuid1
     uint16_t attribute_len = (uint16_t)sizeof(attribute_value);
     reverse_128(uuid128, attribute_value);
 
+#ifdef ENABLE_ATT_DB_INDEX
+    if (att_db_index_available()){
+        uint16_t service;
+        for (service = 0; service < att_db_index_num_services; service++){
+            att_iterator_t it;
+            att_iterator_init_at_position(&it, att_db_index_services[service]);
+            att_iterator_fetch_next(&it);
+            if ((attribute_len == it.value_len) && (memcmp(attribute_value, it.value, it.value_len) == 0)){
+                *start_handle = it.handle;
+                *end_handle = att_db_index_service_end_handle(service);
+                return true;
+            }
+        }
+        return false;
+    }
+#endif
+
     att_iterator_t it;
     att_iterator_init(&it);
     while (att_iterator_has_next(&it)){
@@ -1491,7 +1895,7 @@ uint16_t gatt_server_get_value_handle_for_characteristic_with_uuid128(uint16_t s
     uint8_t attribute_value[16];
     reverse_128(uuid128, attribute_value);
     att_iterator_t it;
-    att_iterator_init(&it);
+    att_iterator_init_for_uuid(&it, start_handle, 16, attribute_value);
     while (att_iterator_has_next(&it)){
         att_iterator_fetch_next(&it);
         if ((it.handle != 0u) && (it.handle < start_handle)){
@@ -1515,7 +1919,7 @@ uint16_t gatt_server_get_client_configuration_handle_for_characteristic_with_uui
     uint8_t attribute_value[16];
     reverse_128(uuid128, attribute_value);
     att_iterator_t it;
-    att_iterator_init(&it);
+    att_iterator_init_from_handle(&it, att_find_first_handle_for_uuid(start_handle, 16, 0, attribute_value));
     int characteristic_found = 0;
     while (att_iterator_has_next(&it)){
         att_iterator_fetch_next(&it);
@@ -1552,7 +1956,7 @@ bool gatt_server_get_included_service_with_uuid16(uint16_t start_handle, uint16_
     uint16_t * out_included_service_handle, uint16_t * out_included_service_start_handle, uint16_t * out_included_service_end_handle){
 
     att_iterator_t it;
-    att_iterator_init(&it);
+    att_iterator_init_for_uuid16(&it, start_handle, GATT_INCLUDE_SERVICE_UUID);
     while (att_iterator_has_next(&it)){
         att_iterator_fetch_next(&it);
         if ((it.handle != 0u) && (it.handle < start_handle)){
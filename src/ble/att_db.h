@@ -177,6 +177,7 @@ typedef struct att_service_handler {
 
 /**
  * @brief setup ATT database
+ * @note with ENABLE_ATT_DB_INDEX, an index for handle, UUID16 and service lookups is built
  * @param db
  */
 void att_set_db(uint8_t const * db);
@@ -68,6 +68,9 @@ static uint16_t hids_cid_counter = 0;
 static uint8_t * hids_client_descriptor_storage;
 static uint16_t  hids_client_descriptor_storage_len;
 
+static btstack_hid_field_t * hids_client_field_storage;
+static uint16_t              hids_client_field_storage_len;
+
 static void handle_gatt_client_event(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size);
 static void hids_client_handle_can_write_without_reponse(void * context);
 
@@ -210,6 +213,86 @@ uint16_t hids_client_descriptor_storage_get_descriptor_len(uint16_t hids_cid, ui
 
 // END Descriptor Storage Util
 
+// START Field Storage Util
+
+static uint16_t hids_client_field_storage_get_used_fields(void){
+    // assumes all field tables are back to back
+    uint16_t used_fields = 0;
+    uint8_t i;
+
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &clients);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        hids_client_t * client = (hids_client_t *)btstack_linked_list_iterator_next(&it);
+        for (i = 0; i < client->num_instances; i++){
+            used_fields += client->services[i].hid_field_count;
+        }
+    }
+    return used_fields;
+}
+
+static void hids_client_field_storage_compile(hids_client_t * client, uint8_t service_index){
+    hid_service_t * service = &client->services[service_index];
+    if (hids_client_field_storage == NULL) return;
+    if (service->hid_descriptor_status != ERROR_CODE_SUCCESS) return;
+    if (service->hid_field_count > 0u) return;
+
+    uint16_t offset = hids_client_field_storage_get_used_fields();
+    uint16_t max_fields = hids_client_field_storage_len - offset;
+    uint16_t num_fields = btstack_hid_descriptor_compile(&hids_client_descriptor_storage[service->hid_descriptor_offset],
+                                                         service->hid_descriptor_len, &hids_client_field_storage[offset], max_fields);
+    if (num_fields > max_fields){
+        log_info("HIDS Client: %u fields required for descriptor, %u available", num_fields, max_fields);
+        return;
+    }
+    service->hid_field_offset = offset;
+    service->hid_field_count  = num_fields;
+}
+
+static void hids_client_field_storage_delete(hids_client_t * client, uint8_t service_index){
+    hid_service_t * service = &client->services[service_index];
+    uint16_t num_fields = service->hid_field_count;
+    if (num_fields == 0u) return;
+    uint16_t next_offset = service->hid_field_offset + num_fields;
+
+    memmove(&hids_client_field_storage[service->hid_field_offset],
+            &hids_client_field_storage[next_offset],
+            (hids_client_field_storage_len - next_offset) * sizeof(btstack_hid_field_t));
+
+    service->hid_field_count = 0;
+    service->hid_field_offset = 0;
+
+    uint8_t i;
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &clients);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        hids_client_t * conn = (hids_client_t *)btstack_linked_list_iterator_next(&it);
+        for (i = 0; i < conn->num_instances; i++){
+            if ((conn->services[i].hid_field_count > 0u) && (conn->services[i].hid_field_offset >= next_offset)){
+                conn->services[i].hid_field_offset -= num_fields;
+            }
+        }
+    }
+}
+
+uint8_t hids_client_get_field_table(uint16_t hids_cid, uint8_t service_index, btstack_hid_field_table_t * field_table){
+    hids_client_t * client = hids_get_client_for_cid(hids_cid);
+    if (client == NULL){
+        return ERROR_CODE_UNKNOWN_CONNECTION_IDENTIFIER;
+    }
+    if (service_index >= client->num_instances){
+        return ERROR_CODE_UNSUPPORTED_FEATURE_OR_PARAMETER_VALUE;
+    }
+    if (client->services[service_index].hid_field_count == 0u){
+        return ERROR_CODE_COMMAND_DISALLOWED;
+    }
+    field_table->fields     = &hids_client_field_storage[client->services[service_index].hid_field_offset];
+    field_table->num_fields = client->services[service_index].hid_field_count;
+    return ERROR_CODE_SUCCESS;
+}
+
+// END Field Storage Util
+
 static uint16_t hids_get_next_cid(void){
     if (hids_cid_counter == 0xffff) {
         hids_cid_counter = 1;
@@ -491,6 +574,9 @@ static void hids_finalize_client(hids_client_t * client){
         gatt_client_stop_listening_for_characteristic_value_updates(&client->reports[i].notification_listener);
     }
 
+    for (i = 0; i < client->num_instances; i++){
+        hids_client_field_storage_delete(client, i);
+    }
     hids_client_descriptor_storage_delete(client);
     btstack_linked_list_remove(&clients, (btstack_linked_item_t *) client);
     btstack_memory_hids_client_free(client); 
@@ -1242,6 +1328,7 @@ static void handle_gatt_client_event(uint8_t packet_type, uint16_t channel, uint
                         hids_finalize_client(client);
                         return;  
                     }
+                    hids_client_field_storage_compile(client, client->service_index);
                     client->state = HIDS_CLIENT_STATE_W2_REPORT_MAP_DISCOVER_CHARACTERISTIC_DESCRIPTORS;
                     break;
 
@@ -1595,4 +1682,9 @@ void hids_client_init(uint8_t * hid_descriptor_storage, uint16_t hid_descriptor_
     hids_client_descriptor_storage_len = hid_descriptor_storage_len;
 }
 
+void hids_client_init_field_storage(btstack_hid_field_t * hid_field_storage, uint16_t hid_field_storage_len){
+    hids_client_field_storage = hid_field_storage;
+    hids_client_field_storage_len = hid_field_storage_len;
+}
+
 void hids_client_deinit(void){}
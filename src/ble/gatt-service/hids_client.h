@@ -46,6 +46,7 @@
 #include <stdint.h>
 #include "btstack_defines.h"
 #include "btstack_hid.h"
+#include "btstack_hid_parser.h"
 #include "bluetooth.h"
 #include "btstack_linked_list.h"
 #include "ble/gatt_client.h"
@@ -173,6 +174,10 @@ typedef struct {
     uint8_t  hid_descriptor_status;     // ERROR_CODE_SUCCESS if descriptor available, 
                                         // ERROR_CODE_UNSUPPORTED_FEATURE_OR_PARAMETER_VALUE if not, and 
                                         // ERROR_CODE_MEMORY_CAPACITY_EXCEEDED if descriptor is larger then the available space
+
+    // compiled descriptor in field storage, hid_field_count is 0 if not available
+    uint16_t hid_field_offset;
+    uint16_t hid_field_count;
 } hid_service_t;
 
 typedef struct {
@@ -219,6 +224,14 @@ typedef struct {
  */
 void hids_client_init(uint8_t * hid_descriptor_storage, uint16_t hid_descriptor_storage_len);
 
+/**
+ * @brief Provide storage for compiled HID Descriptors. If set, the Report Map of each HID service is compiled once
+ * after it has been read, see hids_client_get_field_table
+ * @param hid_field_storage
+ * @param hid_field_storage_len number of fields
+ */
+void hids_client_init_field_storage(btstack_hid_field_t * hid_field_storage, uint16_t hid_field_storage_len);
+
 /* @brief Connect to HID Services of remote device. Event GATTSERVICE_SUBEVENT_HID_SERVICE_CONNECTED will be emitted
  * after all remote HID services and characteristics are found, and notifications for all input reports are enabled.
  * Status code can be ERROR_CODE_SUCCES if at least one HID service is found, otherwise either ATT errors or 
@@ -360,6 +373,16 @@ const uint8_t * hids_client_descriptor_storage_get_descriptor_data(uint16_t hids
  */
 uint16_t hids_client_descriptor_storage_get_descriptor_len(uint16_t hids_cid, uint8_t service_index);
 
+/**
+ * @brief Get compiled Report Map to decode reports with btstack_hid_report_decoder_init
+ * @param hids_cid
+ * @param service_index
+ * @param field_table
+ * @return status ERROR_CODE_SUCCESS on success, otherwise ERROR_CODE_UNKNOWN_CONNECTION_IDENTIFIER, ERROR_CODE_UNSUPPORTED_FEATURE_OR_PARAMETER_VALUE
+ *         for invalid service index, or ERROR_CODE_COMMAND_DISALLOWED if no field storage was provided, Report Map is not available, or field storage is full
+ */
+uint8_t hids_client_get_field_table(uint16_t hids_cid, uint8_t service_index, btstack_hid_field_table_t * field_table);
+
 /**
  * @brief De-initialize HID Service Client. 
  *
@@ -87,6 +87,16 @@
 #define USE_CMAC_ENGINE
 #endif
 
+// with synchronous AES128, resolvable private addresses are checked against all IRKs in a single pass
+#if defined(ENABLE_SOFTWARE_AES128) || defined (HAVE_AES128)
+#define USE_SM_ADDRESS_RESOLUTION_SINGLE_PASS
+#endif
+
+// number of resolved private addresses that are mapped to their LE Device DB index
+#ifndef MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES
+#define MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES 8
+#endif
+
 
 #define BTSTACK_TAG32(A,B,C,D) (((A) << 24) | ((B) << 16) | ((C) << 8) | (D))
 
@@ -152,6 +162,11 @@ typedef enum {
     ADDRESS_RESOLUTION_FAILED,
 } address_resolution_event_t;
 
+typedef struct {
+    bd_addr_t address;
+    int       le_device_db_index;
+} sm_resolved_address_cache_entry_t;
+
 typedef enum {
     EC_KEY_GENERATION_IDLE,
     EC_KEY_GENERATION_ACTIVE,
@@ -258,6 +273,16 @@ static bd_addr_t sm_address_resolution_address;
 static void *    sm_address_resolution_context;
 static address_resolution_mode_t sm_address_resolution_mode;
 static btstack_linked_list_t sm_address_resolution_general_queue;
+static uint32_t  sm_address_resolution_start_ms;
+static sm_address_resolution_statistics_t sm_address_resolution_statistics;
+
+// resolved private addresses, most recently used first. RPA rotation leads to a new entry
+#if MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES > 0
+static sm_resolved_address_cache_entry_t sm_resolved_address_cache[MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES];
+static uint8_t   sm_resolved_address_cache_count;
+// cached device is checked first, if it doesn't match anymore, all devices are checked
+static bool      sm_address_resolution_cache_probe;
+#endif
 
 // aes128 crypto engine.
 static sm_aes128_state_t  sm_aes128_state;
@@ -271,7 +296,9 @@ static btstack_crypto_ecc_p256_t sm_crypto_ecc_p256_request;
 
 // temp storage for random data
 static uint8_t sm_random_data[8];
+#ifndef USE_SM_ADDRESS_RESOLUTION_SINGLE_PASS
 static uint8_t sm_aes128_key[16];
+#endif
 static uint8_t sm_aes128_plaintext[16];
 static uint8_t sm_aes128_ciphertext[16];
 
@@ -403,7 +430,9 @@ static sm_connection_t * sm_get_connection_for_bd_addr_and_type(bd_addr_t addres
 #endif
 static inline int sm_calc_actual_encryption_key_size(int other);
 static int sm_validate_stk_generation_method(void);
+#ifndef USE_SM_ADDRESS_RESOLUTION_SINGLE_PASS
 static void sm_handle_encryption_result_address_resolution(void *arg);
+#endif
 static void sm_handle_encryption_result_dkg_dhk(void *arg);
 static void sm_handle_encryption_result_dkg_irk(void *arg);
 static void sm_handle_encryption_result_enc_a(void *arg);
@@ -928,15 +957,84 @@ static int sm_address_resolution_idle(void){
     return sm_address_resolution_mode == ADDRESS_RESOLUTION_IDLE;
 }
 
+#if MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES > 0
+static int sm_resolved_address_cache_find(const bd_addr_t address){
+    uint8_t i;
+    for (i = 0; i < sm_resolved_address_cache_count; i++){
+        if (memcmp(sm_resolved_address_cache[i].address, address, 6) == 0) return i;
+    }
+    return -1;
+}
+
+static void sm_resolved_address_cache_remove(const bd_addr_t address){
+    int pos = sm_resolved_address_cache_find(address);
+    if (pos < 0) return;
+    sm_resolved_address_cache_count--;
+    (void)memmove(&sm_resolved_address_cache[pos], &sm_resolved_address_cache[pos+1],
+                  (sm_resolved_address_cache_count - pos) * sizeof(sm_resolved_address_cache_entry_t));
+}
+
+static void sm_resolved_address_cache_add(const bd_addr_t address, int le_device_db_index){
+    sm_resolved_address_cache_remove(address);
+    // drop least recently used entry if full
+    if (sm_resolved_address_cache_count == MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES){
+        sm_resolved_address_cache_count--;
+    }
+    (void)memmove(&sm_resolved_address_cache[1], &sm_resolved_address_cache[0],
+                  sm_resolved_address_cache_count * sizeof(sm_resolved_address_cache_entry_t));
+    (void)memcpy(sm_resolved_address_cache[0].address, address, 6);
+    sm_resolved_address_cache[0].le_device_db_index = le_device_db_index;
+    sm_resolved_address_cache_count++;
+}
+
+static bool sm_address_resolution_is_resolvable_private_address(uint8_t addr_type, const bd_addr_t addr){
+    return (addr_type == BD_ADDR_TYPE_LE_RANDOM) && ((addr[0] & 0xc0u) == 0x40u);
+}
+#endif
+
 static void sm_address_resolution_start_lookup(uint8_t addr_type, hci_con_handle_t con_handle, bd_addr_t addr, address_resolution_mode_t mode, void * context){
     (void)memcpy(sm_address_resolution_address, addr, 6);
     sm_address_resolution_addr_type = addr_type;
     sm_address_resolution_test = 0;
     sm_address_resolution_mode = mode;
     sm_address_resolution_context = context;
+    sm_address_resolution_start_ms = btstack_run_loop_get_time_ms();
+#if MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES > 0
+    sm_address_resolution_cache_probe = false;
+    if (sm_address_resolution_is_resolvable_private_address(addr_type, addr)){
+        int pos = sm_resolved_address_cache_find(addr);
+        if ((pos >= 0) && (sm_resolved_address_cache[pos].le_device_db_index < le_device_db_max_count())){
+            log_info("LE Device Lookup: check cached device %u", sm_resolved_address_cache[pos].le_device_db_index);
+            sm_address_resolution_test = sm_resolved_address_cache[pos].le_device_db_index;
+            sm_address_resolution_cache_probe = true;
+        }
+    }
+#endif
     sm_notify_client_base(SM_EVENT_IDENTITY_RESOLVING_STARTED, con_handle, addr_type, addr);
 }
 
+// continue with next device, or with first one if cached device did not match
+static void sm_address_resolution_test_next(void){
+#if MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES > 0
+    if (sm_address_resolution_cache_probe){
+        // e.g. bonding information has been deleted
+        sm_address_resolution_cache_probe = false;
+        sm_resolved_address_cache_remove(sm_address_resolution_address);
+        sm_address_resolution_test = 0;
+        return;
+    }
+#endif
+    sm_address_resolution_test++;
+}
+
+void sm_address_resolution_get_statistics(sm_address_resolution_statistics_t * statistics){
+    *statistics = sm_address_resolution_statistics;
+}
+
+void sm_address_resolution_reset_statistics(void){
+    memset(&sm_address_resolution_statistics, 0, sizeof(sm_address_resolution_statistics_t));
+}
+
 int sm_address_resolution_lookup(uint8_t address_type, bd_addr_t address){
     // check if already in list
     btstack_linked_list_iterator_t it;
@@ -1276,6 +1374,26 @@ static void sm_address_resolution_handle_event(address_resolution_event_t event)
     sm_address_resolution_mode = ADDRESS_RESOLUTION_IDLE;
     sm_address_resolution_context = NULL;
     sm_address_resolution_test = -1;
+
+    // update statistics and cache
+    uint32_t latency_ms = btstack_run_loop_get_time_ms() - sm_address_resolution_start_ms;
+    sm_address_resolution_statistics.lookups++;
+    sm_address_resolution_statistics.latency_total_ms += latency_ms;
+    sm_address_resolution_statistics.latency_max_ms = btstack_max(sm_address_resolution_statistics.latency_max_ms, latency_ms);
+    if (event == ADDRESS_RESOLUTION_SUCCEEDED){
+        sm_address_resolution_statistics.resolved++;
+#if MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES > 0
+        if (sm_address_resolution_cache_probe){
+            sm_address_resolution_statistics.cache_hits++;
+        }
+        if (sm_address_resolution_is_resolvable_private_address(sm_address_resolution_addr_type, sm_address_resolution_address)){
+            sm_resolved_address_cache_add(sm_address_resolution_address, matched_device_id);
+        }
+#endif
+    }
+#if MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES > 0
+    sm_address_resolution_cache_probe = false;
+#endif
     hci_con_handle_t con_handle = 0;
 
     sm_connection_t * sm_connection;
@@ -2223,12 +2341,10 @@ static bool sm_run_csrk(void){
 
             // skip unused entries
             if (addr_type == BD_ADDR_TYPE_UNKNOWN){
-                sm_address_resolution_test++;
+                sm_address_resolution_test_next();
                 continue;
             }
 
-            log_info("LE Device Lookup: device %u of %u", sm_address_resolution_test, le_device_db_max_count());
-
             if ((sm_address_resolution_addr_type == addr_type) && (memcmp(addr, sm_address_resolution_address, 6) == 0)){
                 log_info("LE Device Lookup: found by { addr_type, address} ");
                 sm_address_resolution_handle_event(ADDRESS_RESOLUTION_SUCCEEDED);
@@ -2237,31 +2353,54 @@ static bool sm_run_csrk(void){
 
             // if connection type is public, it must be a different one
             if (sm_address_resolution_addr_type == BD_ADDR_TYPE_LE_PUBLIC){
-                sm_address_resolution_test++;
+                sm_address_resolution_test_next();
                 continue;
             }
 
             // skip AH if no IRK
             if (sm_is_null_key(irk)){
-                sm_address_resolution_test++;
+                sm_address_resolution_test_next();
                 continue;
             }
 
+#ifdef USE_SM_ADDRESS_RESOLUTION_SINGLE_PASS
+            // calculate AH directly instead of waiting for btstack_crypto for each IRK
+            uint8_t r_prime[16];
+            uint8_t hash[16];
+            sm_ah_r_prime(sm_address_resolution_address, r_prime);
+            btstack_aes128_calc(irk, r_prime, hash);
+            sm_address_resolution_statistics.ah_calculations++;
+            if (memcmp(&sm_address_resolution_address[3], &hash[13], 3) == 0){
+                log_info("LE Device Lookup: matched resolvable private address, device %u", sm_address_resolution_test);
+                sm_address_resolution_handle_event(ADDRESS_RESOLUTION_SUCCEEDED);
+                // continue with pending lookups
+                sm_trigger_run();
+                break;
+            }
+            sm_address_resolution_test_next();
+#else
             if (sm_aes128_state == SM_AES128_ACTIVE) break;
 
+            log_info("LE Device Lookup: device %u of %u", sm_address_resolution_test, le_device_db_max_count());
             log_info("LE Device Lookup: calculate AH");
             log_info_key("IRK", irk);
 
             (void)memcpy(sm_aes128_key, irk, 16);
             sm_ah_r_prime(sm_address_resolution_address, sm_aes128_plaintext);
             sm_aes128_state = SM_AES128_ACTIVE;
+            sm_address_resolution_statistics.ah_calculations++;
             btstack_crypto_aes128_encrypt(&sm_crypto_aes128_request, sm_aes128_key, sm_aes128_plaintext, sm_aes128_ciphertext, sm_handle_encryption_result_address_resolution, NULL);
             return true;
+#endif
         }
 
         if (sm_address_resolution_test >= le_device_db_max_count()){
             log_info("LE Device Lookup: not found");
             sm_address_resolution_handle_event(ADDRESS_RESOLUTION_FAILED);
+#ifdef USE_SM_ADDRESS_RESOLUTION_SINGLE_PASS
+            // continue with pending lookups
+            sm_trigger_run();
+#endif
         }
     }
     return false;
@@ -3469,6 +3608,7 @@ static void sm_handle_encryption_result_enc_ph4_ltk(void *arg){
 }
 #endif
 
+#ifndef USE_SM_ADDRESS_RESOLUTION_SINGLE_PASS
 static void sm_handle_encryption_result_address_resolution(void *arg){
     UNUSED(arg);
     sm_aes128_state = SM_AES128_IDLE;
@@ -3482,9 +3622,10 @@ static void sm_handle_encryption_result_address_resolution(void *arg){
         return;
     }
     // no match, try next
-    sm_address_resolution_test++;
+    sm_address_resolution_test_next();
     sm_trigger_run();
 }
+#endif
 
 static void sm_handle_encryption_result_dkg_irk(void *arg){
     UNUSED(arg);
@@ -4892,6 +5033,10 @@ static void sm_state_reset(void) {
     sm_address_resolution_test = -1;    // no private address to resolve yet
     sm_address_resolution_mode = ADDRESS_RESOLUTION_IDLE;
     sm_address_resolution_general_queue = NULL;
+#if MAX_NR_SM_RESOLVED_ADDRESS_CACHE_ENTRIES > 0
+    sm_resolved_address_cache_count = 0;
+    sm_address_resolution_cache_probe = false;
+#endif
     sm_active_connection_handle = HCI_CON_HANDLE_INVALID;
     sm_persistent_keys_random_active = false;
 #ifdef ENABLE_LE_SECURE_CONNECTIONS
@@ -58,6 +58,20 @@ typedef struct {
     bd_addr_type_t address_type;
 } sm_lookup_entry_t;
 
+typedef struct {
+    // completed lookups
+    uint32_t lookups;
+    // lookups that matched a bonded device
+    uint32_t resolved;
+    // resolvable private addresses resolved via cache
+    uint32_t cache_hits;
+    // ah() calculations
+    uint32_t ah_calculations;
+    // time from start of lookup until result
+    uint32_t latency_total_ms;
+    uint32_t latency_max_ms;
+} sm_address_resolution_statistics_t;
+
 /* API_START */
 
 /**
@@ -219,6 +233,17 @@ void sm_cmac_signed_write_start(const sm_key_t key, uint8_t opcode, uint16_t att
  */
 int sm_address_resolution_lookup(uint8_t address_type, bd_addr_t address);
 
+/**
+ * @brief Get address resolution statistics, e.g. to measure resolution latency in crowded environments
+ * @param statistics
+ */
+void sm_address_resolution_get_statistics(sm_address_resolution_statistics_t * statistics);
+
+/**
+ * @brief Reset address resolution statistics
+ */
+void sm_address_resolution_reset_statistics(void);
+
 /**
  * @brief Get Identity Resolving state
  * @param con_handle
@@ -63,6 +63,19 @@
 #include "rijndael.h"
 #endif
 
+// use AES instructions for software AES128 if supported by the CPU
+#if defined(ENABLE_SOFTWARE_AES128) && defined(ENABLE_SOFTWARE_AES128_ACCELERATION)
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define USE_AES128_AESNI
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#define BTSTACK_AES128_AESNI_TARGET __attribute__((target("aes,sse2")))
+#elif defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)
+#define USE_AES128_ARMV8_CE
+#include <arm_neon.h>
+#endif
+#endif
+
 #ifdef HAVE_AES128
 #define USE_BTSTACK_AES128
 #endif
@@ -103,6 +116,14 @@
 #define ENABLE_ECC_P256
 #endif
 
+// Software ECC-P256 operations can be offloaded to worker threads
+#if defined(USE_SOFTWARE_ECC_P256_IMPLEMENTATION) && defined(ENABLE_ECC_P256_WORKER_POOL)
+#define USE_ECC_P256_WORKER_POOL
+#ifndef MAX_NR_ECC_P256_WORKER_JOBS
+#define MAX_NR_ECC_P256_WORKER_JOBS 4
+#endif
+#endif
+
 // debugging
 // #define DEBUG_CCM
 
@@ -119,6 +140,7 @@ typedef enum {
 typedef enum {
     ECC_P256_KEY_GENERATION_IDLE,
     ECC_P256_KEY_GENERATION_GENERATING_RANDOM,
+    ECC_P256_KEY_GENERATION_W4_WORKERS_IDLE,
     ECC_P256_KEY_GENERATION_ACTIVE,
     ECC_P256_KEY_GENERATION_W4_KEY,
     ECC_P256_KEY_GENERATION_DONE,
@@ -144,21 +166,38 @@ static uint8_t  btstack_crypto_cmac_block_current;
 static uint8_t  btstack_crypto_cmac_block_count;
 #endif
 
-// state for AES-CCM
-static uint8_t btstack_crypto_ccm_s[16];
-
 #ifdef ENABLE_ECC_P256
 
 static uint8_t  btstack_crypto_ecc_p256_public_key[64];
 static uint8_t  btstack_crypto_ecc_p256_random[64];
 static uint8_t  btstack_crypto_ecc_p256_random_len;
 static uint8_t  btstack_crypto_ecc_p256_random_offset;
+// only set during key generation, as the RNG is also used by DH Key calculation on worker threads
+static bool     btstack_crypto_ecc_p256_random_available;
 static btstack_crypto_ecc_p256_key_generation_state_t btstack_crypto_ecc_p256_key_generation_state;
 
 #ifdef USE_SOFTWARE_ECC_P256_IMPLEMENTATION
 static uint8_t btstack_crypto_ecc_p256_d[32];
 #endif
 
+#ifdef USE_ECC_P256_WORKER_POOL
+typedef struct {
+    btstack_crypto_worker_job_t job;
+    // NULL for key generation
+    btstack_crypto_ecc_p256_t * request;
+    bool    active;
+    bool    cancelled;
+    int     result;
+    uint8_t public_key[64];
+    uint8_t d[32];
+    uint8_t dhkey[32];
+} btstack_crypto_ecc_p256_worker_job_t;
+
+static const btstack_crypto_worker_pool_t * btstack_crypto_worker_pool;
+static btstack_crypto_ecc_p256_worker_job_t btstack_crypto_ecc_p256_worker_jobs[MAX_NR_ECC_P256_WORKER_JOBS];
+static uint8_t btstack_crypto_ecc_p256_worker_jobs_active;
+#endif
+
 // Software ECDH implementation provided by mbedtls
 #ifdef USE_MBEDTLS_ECC_P256
 static mbedtls_ecp_group   mbedtls_ec_group;
@@ -166,12 +205,187 @@ static mbedtls_ecp_group   mbedtls_ec_group;
 
 #endif /* ENABLE_ECC_P256 */
 
+#ifdef USE_BTSTACK_AES128
+
+// expanded key, set up once per CMAC or CCM operation
+typedef struct {
 #ifdef ENABLE_SOFTWARE_AES128
-// AES128 using public domain rijndael implementation
-void btstack_aes128_calc(const uint8_t * key, const uint8_t * plaintext, uint8_t * ciphertext){
     uint32_t rk[RKLENGTH(KEYBITS)];
-    int nrounds = rijndaelSetupEncrypt(rk, &key[0], KEYBITS);
-    rijndaelEncrypt(rk, nrounds, plaintext, ciphertext);
+    int      nrounds;
+#if defined(USE_AES128_AESNI) || defined(USE_AES128_ARMV8_CE)
+    bool     accelerated;
+    uint8_t  round_keys[11][16];
+#endif
+#else
+    sm_key_t key;
+#endif
+} btstack_aes128_key_schedule_t;
+
+#ifdef USE_AES128_AESNI
+BTSTACK_AES128_AESNI_TARGET
+static inline __m128i btstack_aes128_expand_step_aesni(__m128i key, __m128i key_generated){
+    key_generated = _mm_shuffle_epi32(key_generated, _MM_SHUFFLE(3, 3, 3, 3));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    return _mm_xor_si128(key, key_generated);
+}
+
+// aeskeygenassist requires the round constant as immediate
+#define BTSTACK_AES128_EXPAND_AESNI(round, rcon) \
+    round_key = btstack_aes128_expand_step_aesni(round_key, _mm_aeskeygenassist_si128(round_key, rcon)); \
+    _mm_storeu_si128((__m128i *) schedule->round_keys[round], round_key)
+
+BTSTACK_AES128_AESNI_TARGET
+static void btstack_aes128_setup_aesni(btstack_aes128_key_schedule_t * schedule, const uint8_t * key){
+    __m128i round_key = _mm_loadu_si128((const __m128i *) key);
+    _mm_storeu_si128((__m128i *) schedule->round_keys[0], round_key);
+    BTSTACK_AES128_EXPAND_AESNI( 1, 0x01);
+    BTSTACK_AES128_EXPAND_AESNI( 2, 0x02);
+    BTSTACK_AES128_EXPAND_AESNI( 3, 0x04);
+    BTSTACK_AES128_EXPAND_AESNI( 4, 0x08);
+    BTSTACK_AES128_EXPAND_AESNI( 5, 0x10);
+    BTSTACK_AES128_EXPAND_AESNI( 6, 0x20);
+    BTSTACK_AES128_EXPAND_AESNI( 7, 0x40);
+    BTSTACK_AES128_EXPAND_AESNI( 8, 0x80);
+    BTSTACK_AES128_EXPAND_AESNI( 9, 0x1b);
+    BTSTACK_AES128_EXPAND_AESNI(10, 0x36);
+}
+
+BTSTACK_AES128_AESNI_TARGET
+static void btstack_aes128_encrypt_aesni(const btstack_aes128_key_schedule_t * schedule, const uint8_t * plaintext, uint8_t * ciphertext){
+    __m128i state = _mm_xor_si128(_mm_loadu_si128((const __m128i *) plaintext), _mm_loadu_si128((const __m128i *) schedule->round_keys[0]));
+    int round;
+    for (round = 1; round < 10; round++){
+        state = _mm_aesenc_si128(state, _mm_loadu_si128((const __m128i *) schedule->round_keys[round]));
+    }
+    state = _mm_aesenclast_si128(state, _mm_loadu_si128((const __m128i *) schedule->round_keys[10]));
+    _mm_storeu_si128((__m128i *) ciphertext, state);
+}
+
+// two independent blocks interleaved to hide aesenc latency
+BTSTACK_AES128_AESNI_TARGET
+static void btstack_aes128_encrypt_2_aesni(const btstack_aes128_key_schedule_t * schedule,
+                                           const uint8_t * plaintext_a, uint8_t * ciphertext_a,
+                                           const uint8_t * plaintext_b, uint8_t * ciphertext_b){
+    __m128i round_key = _mm_loadu_si128((const __m128i *) schedule->round_keys[0]);
+    __m128i state_a = _mm_xor_si128(_mm_loadu_si128((const __m128i *) plaintext_a), round_key);
+    __m128i state_b = _mm_xor_si128(_mm_loadu_si128((const __m128i *) plaintext_b), round_key);
+    int round;
+    for (round = 1; round < 10; round++){
+        round_key = _mm_loadu_si128((const __m128i *) schedule->round_keys[round]);
+        state_a = _mm_aesenc_si128(state_a, round_key);
+        state_b = _mm_aesenc_si128(state_b, round_key);
+    }
+    round_key = _mm_loadu_si128((const __m128i *) schedule->round_keys[10]);
+    _mm_storeu_si128((__m128i *) ciphertext_a, _mm_aesenclast_si128(state_a, round_key));
+    _mm_storeu_si128((__m128i *) ciphertext_b, _mm_aesenclast_si128(state_b, round_key));
+}
+#endif
+
+#ifdef USE_AES128_ARMV8_CE
+static void btstack_aes128_encrypt_armv8(const btstack_aes128_key_schedule_t * schedule, const uint8_t * plaintext, uint8_t * ciphertext){
+    uint8x16_t state = vld1q_u8(plaintext);
+    int round;
+    for (round = 0; round < 9; round++){
+        state = vaesmcq_u8(vaeseq_u8(state, vld1q_u8(schedule->round_keys[round])));
+    }
+    state = vaeseq_u8(state, vld1q_u8(schedule->round_keys[9]));
+    vst1q_u8(ciphertext, veorq_u8(state, vld1q_u8(schedule->round_keys[10])));
+}
+
+static void btstack_aes128_encrypt_2_armv8(const btstack_aes128_key_schedule_t * schedule,
+                                           const uint8_t * plaintext_a, uint8_t * ciphertext_a,
+                                           const uint8_t * plaintext_b, uint8_t * ciphertext_b){
+    uint8x16_t state_a = vld1q_u8(plaintext_a);
+    uint8x16_t state_b = vld1q_u8(plaintext_b);
+    uint8x16_t round_key;
+    int round;
+    for (round = 0; round < 9; round++){
+        round_key = vld1q_u8(schedule->round_keys[round]);
+        state_a = vaesmcq_u8(vaeseq_u8(state_a, round_key));
+        state_b = vaesmcq_u8(vaeseq_u8(state_b, round_key));
+    }
+    round_key = vld1q_u8(schedule->round_keys[9]);
+    state_a = vaeseq_u8(state_a, round_key);
+    state_b = vaeseq_u8(state_b, round_key);
+    round_key = vld1q_u8(schedule->round_keys[10]);
+    vst1q_u8(ciphertext_a, veorq_u8(state_a, round_key));
+    vst1q_u8(ciphertext_b, veorq_u8(state_b, round_key));
+}
+#endif
+
+static void btstack_aes128_setup(btstack_aes128_key_schedule_t * schedule, const uint8_t * key){
+#ifdef ENABLE_SOFTWARE_AES128
+#ifdef USE_AES128_AESNI
+    schedule->accelerated = __builtin_cpu_supports("aes") != 0;
+    if (schedule->accelerated){
+        btstack_aes128_setup_aesni(schedule, key);
+        return;
+    }
+#endif
+    schedule->nrounds = rijndaelSetupEncrypt(schedule->rk, &key[0], KEYBITS);
+#ifdef USE_AES128_ARMV8_CE
+    // rijndael round keys are big endian words
+    int i;
+    for (i = 0; i < RKLENGTH(KEYBITS); i++){
+        big_endian_store_32((uint8_t *) schedule->round_keys, i * 4, schedule->rk[i]);
+    }
+    schedule->accelerated = true;
+#endif
+#else
+    (void)memcpy(schedule->key, key, 16);
+#endif
+}
+
+static void btstack_aes128_encrypt(const btstack_aes128_key_schedule_t * schedule, const uint8_t * plaintext, uint8_t * ciphertext){
+#ifdef ENABLE_SOFTWARE_AES128
+#ifdef USE_AES128_AESNI
+    if (schedule->accelerated){
+        btstack_aes128_encrypt_aesni(schedule, plaintext, ciphertext);
+        return;
+    }
+#endif
+#ifdef USE_AES128_ARMV8_CE
+    if (schedule->accelerated){
+        btstack_aes128_encrypt_armv8(schedule, plaintext, ciphertext);
+        return;
+    }
+#endif
+    rijndaelEncrypt(schedule->rk, schedule->nrounds, plaintext, ciphertext);
+#else
+    btstack_aes128_calc(schedule->key, plaintext, ciphertext);
+#endif
+}
+
+// encrypt two independent blocks, e.g. CBC-MAC and CTR block of CCM
+static void btstack_aes128_encrypt_2(const btstack_aes128_key_schedule_t * schedule,
+                                     const uint8_t * plaintext_a, uint8_t * ciphertext_a,
+                                     const uint8_t * plaintext_b, uint8_t * ciphertext_b){
+#ifdef USE_AES128_AESNI
+    if (schedule->accelerated){
+        btstack_aes128_encrypt_2_aesni(schedule, plaintext_a, ciphertext_a, plaintext_b, ciphertext_b);
+        return;
+    }
+#endif
+#ifdef USE_AES128_ARMV8_CE
+    if (schedule->accelerated){
+        btstack_aes128_encrypt_2_armv8(schedule, plaintext_a, ciphertext_a, plaintext_b, ciphertext_b);
+        return;
+    }
+#endif
+    btstack_aes128_encrypt(schedule, plaintext_a, ciphertext_a);
+    btstack_aes128_encrypt(schedule, plaintext_b, ciphertext_b);
+}
+
+#endif
+
+#ifdef ENABLE_SOFTWARE_AES128
+// AES128 using public domain rijndael implementation or AES instructions
+void btstack_aes128_calc(const uint8_t * key, const uint8_t * plaintext, uint8_t * ciphertext){
+    btstack_aes128_key_schedule_t schedule;
+    btstack_aes128_setup(&schedule, key);
+    btstack_aes128_encrypt(&schedule, plaintext, ciphertext);
 }
 #endif
 
@@ -213,11 +427,29 @@ static void btstack_crypto_cmac_calc_subkeys(sm_key_t k0, sm_key_t k1, sm_key_t
     } 
 }
 
+// y := x xor M_i, reads message directly if possible
+static void btstack_crypto_cmac_xor_block(btstack_crypto_aes128_cmac_t * btstack_crypto_cmac, uint16_t pos, const uint8_t * x, uint8_t * y){
+    uint16_t i;
+    if (btstack_crypto_cmac->btstack_crypto.operation == BTSTACK_CRYPTO_CMAC_MESSAGE){
+        const uint8_t * message = &btstack_crypto_cmac->data.message[pos];
+        for (i=0;i<16;i++){
+            y[i] = x[i] ^ message[i];
+        }
+    } else {
+        for (i=0;i<16;i++){
+            y[i] = x[i] ^ (*btstack_crypto_cmac->data.get_byte_callback)(pos + i);
+        }
+    }
+}
+
+// complete CMAC in one go, key is expanded only once
 static void btstack_crypto_cmac_calc(btstack_crypto_aes128_cmac_t * btstack_crypto_cmac) {
+    btstack_aes128_key_schedule_t schedule;
     sm_key_t k0, k1, k2;
     uint16_t i;
 
-    btstack_aes128_calc(btstack_crypto_cmac->key, zero, k0);
+    btstack_aes128_setup(&schedule, btstack_crypto_cmac->key);
+    btstack_aes128_encrypt(&schedule, zero, k0);
     btstack_crypto_cmac_calc_subkeys(k0, k1, k2);
 
     uint16_t cmac_block_count = (btstack_crypto_cmac->size + 15) / 16;
@@ -235,19 +467,15 @@ static void btstack_crypto_cmac_calc(btstack_crypto_aes128_cmac_t * btstack_cryp
     sm_key_t cmac_y;
     int block;
     for (block = 0 ; block < cmac_block_count-1 ; block++){
-        for (i=0;i<16;i++){
-            cmac_y[i] = cmac_x[i] ^ btstack_crypto_cmac_get_byte(btstack_crypto_cmac, (block*16) + i);
-        }
-        btstack_aes128_calc(btstack_crypto_cmac->key, cmac_y, cmac_x);
+        btstack_crypto_cmac_xor_block(btstack_crypto_cmac, block * 16, cmac_x, cmac_y);
+        btstack_aes128_encrypt(&schedule, cmac_y, cmac_x);
     }
 
     // step 4: set m_last
     sm_key_t cmac_m_last;
     bool last_block_complete = btstack_crypto_cmac->size != 0 && (btstack_crypto_cmac->size & 0x0f) == 0;
     if (last_block_complete){
-        for (i=0;i<16;i++){
-            cmac_m_last[i] = btstack_crypto_cmac_get_byte(btstack_crypto_cmac, btstack_crypto_cmac->size - 16 + i) ^ k1[i];
-        }
+        btstack_crypto_cmac_xor_block(btstack_crypto_cmac, btstack_crypto_cmac->size - 16, k1, cmac_m_last);
     } else {
         uint16_t valid_octets_in_last_block = btstack_crypto_cmac->size & 0x0f;
         for (i=0;i<16;i++){
@@ -268,7 +496,7 @@ static void btstack_crypto_cmac_calc(btstack_crypto_aes128_cmac_t * btstack_cryp
     }
 
     // Step 7
-    btstack_aes128_calc(btstack_crypto_cmac->key, cmac_y, btstack_crypto_cmac->hash);
+    btstack_aes128_encrypt(&schedule, cmac_y, btstack_crypto_cmac->hash);
 }
 #else
 
@@ -435,14 +663,14 @@ static void btstack_crypto_cmac_start(btstack_crypto_aes128_cmac_t * btstack_cry
   2 ... 0      L'
 */
 
-static void btstack_crypto_ccm_setup_a_i(btstack_crypto_ccm_t * btstack_crypto_ccm, uint16_t counter){
-    btstack_crypto_ccm_s[0] = 1;  // L' = L - 1
-    (void)memcpy(&btstack_crypto_ccm_s[1], btstack_crypto_ccm->nonce, 13);
-    big_endian_store_16(btstack_crypto_ccm_s, 14, counter);
+static void btstack_crypto_ccm_setup_a_i(btstack_crypto_ccm_t * btstack_crypto_ccm, uint16_t counter, uint8_t * a_i){
+    a_i[0] = 1;  // L' = L - 1
+    (void)memcpy(&a_i[1], btstack_crypto_ccm->nonce, 13);
+    big_endian_store_16(a_i, 14, counter);
 #ifdef DEBUG_CCM
     printf("btstack_crypto_ccm_setup_a_%u\n", counter);
     printf("%16s: ", "ai");
-    printf_hexdump(btstack_crypto_ccm_s, 16);
+    printf_hexdump(a_i, 16);
 #endif
 }
 
@@ -494,8 +722,8 @@ static void btstack_crypto_log_ec_publickey(const uint8_t * ec_q){
 #if (defined(USE_MICRO_ECC_P256) && !defined(WICED_VERSION)) || defined(USE_MBEDTLS_ECC_P256)
 // @return OK
 static int sm_generate_f_rng(unsigned char * buffer, unsigned size){
-    if (btstack_crypto_ecc_p256_key_generation_state != ECC_P256_KEY_GENERATION_ACTIVE) return 0;
-    log_info("sm_generate_f_rng: size %u - offset %u", (int) size, btstack_crypto_ecc_p256_random_offset);
+    // called during key generation, possibly on worker thread - no logging
+    if (btstack_crypto_ecc_p256_random_available == false) return 0;
     btstack_assert((btstack_crypto_ecc_p256_random_offset + size) <= btstack_crypto_ecc_p256_random_len);
     uint16_t remaining_size = size;
     uint8_t * buffer_ptr = buffer;
@@ -514,29 +742,32 @@ static int sm_generate_f_rng_mbedtls(void * context, unsigned char * buffer, siz
 }
 #endif /* USE_MBEDTLS_ECC_P256 */
 
-static void btstack_crypto_ecc_p256_generate_key_software(void){
+// may run on worker thread - no logging
+// @return result of key generation, 0 if ok
+static int btstack_crypto_ecc_p256_generate_key_software(void){
 
+    int res = 0;
     btstack_crypto_ecc_p256_random_offset = 0;
+    btstack_crypto_ecc_p256_random_available = true;
     
     // generate EC key
 #ifdef USE_MICRO_ECC_P256
 
 #ifndef WICED_VERSION
-    log_info("set uECC RNG for initial key generation with 64 random bytes");
+    // set uECC RNG for initial key generation with 64 random bytes
     // micro-ecc from WICED SDK uses its wiced_crypto_get_random by default - no need to set it
     uECC_set_rng(&sm_generate_f_rng);
 #endif /* WICED_VERSION */
 
 #if uECC_SUPPORTS_secp256r1
     // standard version
-    uECC_make_key(btstack_crypto_ecc_p256_public_key, btstack_crypto_ecc_p256_d, uECC_secp256r1());
+    res = uECC_make_key(btstack_crypto_ecc_p256_public_key, btstack_crypto_ecc_p256_d, uECC_secp256r1()) == 0;
 
-    // disable RNG again, as returning no randmon data lets shared key generation fail
-    log_info("disable uECC RNG in standard version after key generation");
+    // disable RNG again in standard version, as returning no randmon data lets shared key generation fail
     uECC_set_rng(NULL);
 #else
     // static version
-    uECC_make_key(btstack_crypto_ecc_p256_public_key, btstack_crypto_ecc_p256_d);
+    res = uECC_make_key(btstack_crypto_ecc_p256_public_key, btstack_crypto_ecc_p256_d) == 0;
 #endif
 #endif /* USE_MICRO_ECC_P256 */
 
@@ -545,27 +776,30 @@ static void btstack_crypto_ecc_p256_generate_key_software(void){
     mbedtls_ecp_point P;
     mbedtls_mpi_init(&d);
     mbedtls_ecp_point_init(&P);
-    int res = mbedtls_ecp_gen_keypair(&mbedtls_ec_group, &d, &P, &sm_generate_f_rng_mbedtls, NULL);
-    log_info("gen keypair %x", res);
+    res = mbedtls_ecp_gen_keypair(&mbedtls_ec_group, &d, &P, &sm_generate_f_rng_mbedtls, NULL);
     mbedtls_mpi_write_binary(&P.X, &btstack_crypto_ecc_p256_public_key[0],  32);
     mbedtls_mpi_write_binary(&P.Y, &btstack_crypto_ecc_p256_public_key[32], 32);
     mbedtls_mpi_write_binary(&d, btstack_crypto_ecc_p256_d, 32);
     mbedtls_ecp_point_free(&P);
     mbedtls_mpi_free(&d);
 #endif  /* USE_MBEDTLS_ECC_P256 */
+
+    btstack_crypto_ecc_p256_random_available = false;
+    return res;
 }
 
 #ifdef USE_SOFTWARE_ECC_P256_IMPLEMENTATION
-static void btstack_crypto_ecc_p256_calculate_dhkey_software(btstack_crypto_ecc_p256_t * btstack_crypto_ec_p192){
-    memset(btstack_crypto_ec_p192->dhkey, 0, 32);
+// may run on worker thread - no logging
+static void btstack_crypto_ecc_p256_calculate_dhkey_software(const uint8_t * private_key, const uint8_t * public_key, uint8_t * dhkey){
+    memset(dhkey, 0, 32);
 
 #ifdef USE_MICRO_ECC_P256
 #if uECC_SUPPORTS_secp256r1
     // standard version
-    uECC_shared_secret(btstack_crypto_ec_p192->public_key, btstack_crypto_ecc_p256_d, btstack_crypto_ec_p192->dhkey, uECC_secp256r1());
+    uECC_shared_secret(public_key, private_key, dhkey, uECC_secp256r1());
 #else
     // static version
-    uECC_shared_secret(btstack_crypto_ec_p192->public_key, btstack_crypto_ecc_p256_d, btstack_crypto_ec_p192->dhkey);
+    uECC_shared_secret(public_key, private_key, dhkey);
 #endif
 #endif
 
@@ -577,24 +811,110 @@ static void btstack_crypto_ecc_p256_calculate_dhkey_software(btstack_crypto_ecc_
     mbedtls_mpi_init(&d);
     mbedtls_ecp_point_init(&Q);
     mbedtls_ecp_point_init(&DH);
-    mbedtls_mpi_read_binary(&d, btstack_crypto_ecc_p256_d, 32);
-    mbedtls_mpi_read_binary(&Q.X, &btstack_crypto_ec_p192->public_key[0] , 32);
-    mbedtls_mpi_read_binary(&Q.Y, &btstack_crypto_ec_p192->public_key[32], 32);
+    mbedtls_mpi_read_binary(&d, private_key, 32);
+    mbedtls_mpi_read_binary(&Q.X, &public_key[0] , 32);
+    mbedtls_mpi_read_binary(&Q.Y, &public_key[32], 32);
     mbedtls_mpi_lset(&Q.Z, 1);
     mbedtls_ecp_mul(&mbedtls_ec_group, &DH, &d, &Q, NULL, NULL);
-    mbedtls_mpi_write_binary(&DH.X, btstack_crypto_ec_p192->dhkey, 32);
+    mbedtls_mpi_write_binary(&DH.X, dhkey, 32);
     mbedtls_ecp_point_free(&DH);
     mbedtls_mpi_free(&d);
     mbedtls_ecp_point_free(&Q);
 #endif
+}
+#endif
+
+#ifdef USE_ECC_P256_WORKER_POOL
+
+static void btstack_crypto_ecc_p256_worker_generate_key(btstack_crypto_worker_job_t * job){
+    btstack_crypto_ecc_p256_worker_job_t * ecc_job = (btstack_crypto_ecc_p256_worker_job_t *) job;
+    // result is reported via btstack_crypto_ecc_p256_public_key / btstack_crypto_ecc_p256_d
+    ecc_job->result = btstack_crypto_ecc_p256_generate_key_software();
+}
+
+static void btstack_crypto_ecc_p256_worker_calculate_dhkey(btstack_crypto_worker_job_t * job){
+    btstack_crypto_ecc_p256_worker_job_t * ecc_job = (btstack_crypto_ecc_p256_worker_job_t *) job;
+    btstack_crypto_ecc_p256_calculate_dhkey_software(ecc_job->d, ecc_job->public_key, ecc_job->dhkey);
+}
+
+// executed on main thread
+static void btstack_crypto_ecc_p256_worker_done(void * context){
+    btstack_crypto_ecc_p256_worker_job_t * ecc_job = (btstack_crypto_ecc_p256_worker_job_t *) context;
+    ecc_job->active = false;
+    btstack_crypto_ecc_p256_worker_jobs_active--;
+
+    if (ecc_job->cancelled == false){
+        btstack_crypto_ecc_p256_t * request = ecc_job->request;
+        if (request == NULL){
+            // key generation
+            log_info("gen keypair %x", ecc_job->result);
+            btstack_crypto_ecc_p256_key_generation_state = ECC_P256_KEY_GENERATION_DONE;
+        } else {
+            log_info("dhkey");
+            log_info_hexdump(ecc_job->dhkey, 32);
+            (void)memcpy(request->dhkey, ecc_job->dhkey, 32);
+            (*request->btstack_crypto.context_callback.callback)(request->btstack_crypto.context_callback.context);
+        }
+    }
 
-    log_info("dhkey");
-    log_info_hexdump(btstack_crypto_ec_p192->dhkey, 32);
+    // more work?
+    btstack_crypto_run();
+}
+
+// @return job or NULL if all workers are busy
+static btstack_crypto_ecc_p256_worker_job_t * btstack_crypto_ecc_p256_worker_get_job(void){
+    uint8_t num_workers = btstack_min((*btstack_crypto_worker_pool->get_num_workers)(), MAX_NR_ECC_P256_WORKER_JOBS);
+    if (btstack_crypto_ecc_p256_worker_jobs_active >= num_workers) return NULL;
+    uint8_t i;
+    for (i = 0; i < MAX_NR_ECC_P256_WORKER_JOBS; i++){
+        btstack_crypto_ecc_p256_worker_job_t * ecc_job = &btstack_crypto_ecc_p256_worker_jobs[i];
+        if (ecc_job->active) continue;
+        memset(ecc_job, 0, sizeof(btstack_crypto_ecc_p256_worker_job_t));
+        ecc_job->active = true;
+        ecc_job->job.done.callback = &btstack_crypto_ecc_p256_worker_done;
+        ecc_job->job.done.context  = ecc_job;
+        btstack_crypto_ecc_p256_worker_jobs_active++;
+        return ecc_job;
+    }
+    return NULL;
+}
+
+// @return true if key generation was started
+static bool btstack_crypto_ecc_p256_worker_start_key_generation(void){
+    // key generation updates the shared key pair, wait for ongoing DH Key calculations
+    if (btstack_crypto_ecc_p256_worker_jobs_active > 0u) return false;
+    btstack_crypto_ecc_p256_worker_job_t * ecc_job = btstack_crypto_ecc_p256_worker_get_job();
+    if (ecc_job == NULL) return false;
+    btstack_crypto_ecc_p256_key_generation_state = ECC_P256_KEY_GENERATION_ACTIVE;
+    ecc_job->job.work = &btstack_crypto_ecc_p256_worker_generate_key;
+    (*btstack_crypto_worker_pool->execute)(&ecc_job->job);
+    return true;
+}
+
+// @return true if DH Key calculation was started
+static bool btstack_crypto_ecc_p256_worker_start_dhkey(btstack_crypto_ecc_p256_t * request){
+    btstack_crypto_ecc_p256_worker_job_t * ecc_job = btstack_crypto_ecc_p256_worker_get_job();
+    if (ecc_job == NULL) return false;
+    ecc_job->request = request;
+    (void)memcpy(ecc_job->public_key, request->public_key, 64);
+    (void)memcpy(ecc_job->d, btstack_crypto_ecc_p256_d, 32);
+    ecc_job->job.work = &btstack_crypto_ecc_p256_worker_calculate_dhkey;
+    (*btstack_crypto_worker_pool->execute)(&ecc_job->job);
+    return true;
+}
+
+static void btstack_crypto_ecc_p256_worker_cancel_all(void){
+    uint8_t i;
+    for (i = 0; i < MAX_NR_ECC_P256_WORKER_JOBS; i++){
+        btstack_crypto_ecc_p256_worker_jobs[i].cancelled = true;
+    }
 }
 #endif
 
 #endif
 
+#ifndef USE_BTSTACK_AES128
+
 static void btstack_crypto_ccm_next_block(btstack_crypto_ccm_t * btstack_crypto_ccm, btstack_crypto_ccm_state_t state_when_done){
     uint16_t bytes_to_process = btstack_min(btstack_crypto_ccm->block_len, 16);
     // next block
@@ -620,11 +940,7 @@ static void btstack_crypto_ccm_next_block(btstack_crypto_ccm_t * btstack_crypto_
 static void btstack_crypto_ccm_handle_s0(btstack_crypto_ccm_t * btstack_crypto_ccm, const uint8_t * data){
     int i;
     for (i=0;i<16;i++){
-#ifdef USE_BTSTACK_AES128
-        btstack_crypto_ccm->x_i[i] = btstack_crypto_ccm->x_i[i] ^ data[i];
-#else
         btstack_crypto_ccm->x_i[i] = btstack_crypto_ccm->x_i[i] ^ data[15-i];
-#endif
     }
     btstack_crypto_done(&btstack_crypto_ccm->btstack_crypto);
 }
@@ -634,11 +950,7 @@ static void btstack_crypto_ccm_handle_sn(btstack_crypto_ccm_t * btstack_crypto_c
     int i;
     uint16_t bytes_to_process = btstack_min(btstack_crypto_ccm->block_len, 16);
     for (i=0;i<bytes_to_process;i++){
-#ifdef USE_BTSTACK_AES128
-        btstack_crypto_ccm->output[i] = btstack_crypto_ccm->input[i] ^ data[i];
-#else
         btstack_crypto_ccm->output[i] = btstack_crypto_ccm->input[i] ^ data[15-i];
-#endif
     }
     switch (btstack_crypto_ccm->btstack_crypto.operation){
         case BTSTACK_CRYPTO_CCM_DECRYPT_BLOCK:
@@ -711,42 +1023,27 @@ static void btstack_crypto_ccm_calc_s0(btstack_crypto_ccm_t * btstack_crypto_ccm
 #ifdef DEBUG_CCM
     printf("btstack_crypto_ccm_calc_s0\n");
 #endif
+    uint8_t btstack_crypto_ccm_buffer[16];
     btstack_crypto_ccm->state = CCM_W4_S0;
-    btstack_crypto_ccm_setup_a_i(btstack_crypto_ccm, 0);
-#ifdef USE_BTSTACK_AES128
-    uint8_t data[16];
-    btstack_aes128_calc(btstack_crypto_ccm->key, btstack_crypto_ccm_s, data);
-    btstack_crypto_ccm_handle_s0(btstack_crypto_ccm, data);
-#else
-    btstack_crypto_aes128_start(btstack_crypto_ccm->key, btstack_crypto_ccm_s);
-#endif
+    btstack_crypto_ccm_setup_a_i(btstack_crypto_ccm, 0, btstack_crypto_ccm_buffer);
+    btstack_crypto_aes128_start(btstack_crypto_ccm->key, btstack_crypto_ccm_buffer);
 }
 
 static void btstack_crypto_ccm_calc_sn(btstack_crypto_ccm_t * btstack_crypto_ccm){
 #ifdef DEBUG_CCM
     printf("btstack_crypto_ccm_calc_s%u\n", btstack_crypto_ccm->counter);
 #endif
+    uint8_t btstack_crypto_ccm_buffer[16];
     btstack_crypto_ccm->state = CCM_W4_SN;
-    btstack_crypto_ccm_setup_a_i(btstack_crypto_ccm, btstack_crypto_ccm->counter);
-#ifdef USE_BTSTACK_AES128
-    uint8_t data[16];
-    btstack_aes128_calc(btstack_crypto_ccm->key, btstack_crypto_ccm_s, data);
-    btstack_crypto_ccm_handle_sn(btstack_crypto_ccm, data);
-#else
-    btstack_crypto_aes128_start(btstack_crypto_ccm->key, btstack_crypto_ccm_s);
-#endif
+    btstack_crypto_ccm_setup_a_i(btstack_crypto_ccm, btstack_crypto_ccm->counter, btstack_crypto_ccm_buffer);
+    btstack_crypto_aes128_start(btstack_crypto_ccm->key, btstack_crypto_ccm_buffer);
 }
 
 static void btstack_crypto_ccm_calc_x1(btstack_crypto_ccm_t * btstack_crypto_ccm){
     uint8_t btstack_crypto_ccm_buffer[16];
     btstack_crypto_ccm->state = CCM_W4_X1;
     btstack_crypto_ccm_setup_b_0(btstack_crypto_ccm, btstack_crypto_ccm_buffer);
-#ifdef USE_BTSTACK_AES128
-    btstack_aes128_calc(btstack_crypto_ccm->key, btstack_crypto_ccm_buffer, btstack_crypto_ccm->x_i);
-    btstack_crypto_ccm_handle_x1(btstack_crypto_ccm);
-#else
     btstack_crypto_aes128_start(btstack_crypto_ccm->key, btstack_crypto_ccm_buffer);
-#endif
 }
 
 static void btstack_crypto_ccm_calc_xn(btstack_crypto_ccm_t * btstack_crypto_ccm, const uint8_t * plaintext){
@@ -773,12 +1070,7 @@ static void btstack_crypto_ccm_calc_xn(btstack_crypto_ccm_t * btstack_crypto_ccm
     printf_hexdump(btstack_crypto_ccm_buffer, 16);
 #endif
 
-#ifdef USE_BTSTACK_AES128
-    btstack_aes128_calc(btstack_crypto_ccm->key, btstack_crypto_ccm_buffer, btstack_crypto_ccm->x_i);
-    btstack_crypto_ccm_handle_xn(btstack_crypto_ccm);
-#else
     btstack_crypto_aes128_start(btstack_crypto_ccm->key, btstack_crypto_ccm_buffer);
-#endif
 }
 
 static void btstack_crypto_ccm_calc_aad_xn(btstack_crypto_ccm_t * btstack_crypto_ccm){
@@ -821,13 +1113,165 @@ static void btstack_crypto_ccm_calc_aad_xn(btstack_crypto_ccm_t * btstack_crypto
 
     btstack_crypto_ccm->aad_remainder_len = 0;
     btstack_crypto_ccm->state = CCM_W4_AAD_XN;
-#ifdef USE_BTSTACK_AES128
-    btstack_aes128_calc(btstack_crypto_ccm->key, btstack_crypto_ccm->x_i, btstack_crypto_ccm->x_i);
-    btstack_crypto_ccm_handle_aad_xn(btstack_crypto_ccm);
-#else
     btstack_crypto_aes128_start(btstack_crypto_ccm->key, btstack_crypto_ccm->x_i);
+}
+
+#else
+
+// With AES128 available on the host, a CCM digest/encrypt/decrypt request is completed in one go:
+// the key is expanded once, and CBC-MAC and CTR blocks are computed in a single loop
+
+static void btstack_crypto_ccm_calc_x1(btstack_crypto_ccm_t * btstack_crypto_ccm, const btstack_aes128_key_schedule_t * schedule){
+    uint8_t btstack_crypto_ccm_buffer[16];
+    btstack_crypto_ccm_setup_b_0(btstack_crypto_ccm, btstack_crypto_ccm_buffer);
+    btstack_aes128_encrypt(schedule, btstack_crypto_ccm_buffer, btstack_crypto_ccm->x_i);
+#ifdef DEBUG_CCM
+    printf("%16s: ", "Xi");
+    printf_hexdump(btstack_crypto_ccm->x_i, 16);
+#endif
+    switch (btstack_crypto_ccm->btstack_crypto.operation){
+        case BTSTACK_CRYPTO_CCM_DIGEST_BLOCK:
+            btstack_crypto_ccm->aad_remainder_len = 0;
+            btstack_crypto_ccm->state = CCM_CALCULATE_AAD_XN;
+            break;
+        case BTSTACK_CRYPTO_CCM_DECRYPT_BLOCK:
+            btstack_crypto_ccm->state = CCM_CALCULATE_SN;
+            break;
+        case BTSTACK_CRYPTO_CCM_ENCRYPT_BLOCK:
+            btstack_crypto_ccm->state = CCM_CALCULATE_XN;
+            break;
+        default:
+            btstack_assert(false);
+            break;
+    }
+}
+
+static void btstack_crypto_ccm_calc_aad_xn(btstack_crypto_ccm_t * btstack_crypto_ccm, const btstack_aes128_key_schedule_t * schedule){
+    while (true){
+        // store length
+        if (btstack_crypto_ccm->aad_offset == 0u){
+            uint8_t len_buffer[2];
+            big_endian_store_16(len_buffer, 0, btstack_crypto_ccm->aad_len);
+            btstack_crypto_ccm->x_i[0] ^= len_buffer[0];
+            btstack_crypto_ccm->x_i[1] ^= len_buffer[1];
+            btstack_crypto_ccm->aad_remainder_len += 2u;
+            btstack_crypto_ccm->aad_offset        += 2u;
+        }
+
+        // fill from input
+        uint16_t bytes_free = 16u - btstack_crypto_ccm->aad_remainder_len;
+        uint16_t bytes_to_copy = btstack_min(bytes_free, btstack_crypto_ccm->block_len);
+        while (bytes_to_copy){
+            btstack_crypto_ccm->x_i[btstack_crypto_ccm->aad_remainder_len++] ^= *btstack_crypto_ccm->input++;
+            btstack_crypto_ccm->aad_offset++;
+            btstack_crypto_ccm->block_len--;
+            bytes_to_copy--;
+        }
+
+        // if last block, fill with zeros
+        if (btstack_crypto_ccm->aad_offset == (btstack_crypto_ccm->aad_len + 2u)){
+            btstack_crypto_ccm->aad_remainder_len = 16;
+        }
+        // if not full, wait for more aad
+        if (btstack_crypto_ccm->aad_remainder_len < 16u){
+            btstack_crypto_ccm->state = CCM_CALCULATE_AAD_XN;
+            return;
+        }
+
+        btstack_crypto_ccm->aad_remainder_len = 0;
+        btstack_aes128_encrypt(schedule, btstack_crypto_ccm->x_i, btstack_crypto_ccm->x_i);
+#ifdef DEBUG_CCM
+        printf("%16s: ", "Xn+1 AAD");
+        printf_hexdump(btstack_crypto_ccm->x_i, 16);
 #endif
+
+        // done?
+        if (btstack_crypto_ccm->aad_offset >= (btstack_crypto_ccm->aad_len + 2u)){
+            btstack_crypto_ccm->state = CCM_W4_AAD_XN;
+            return;
+        }
+    }
+}
+
+static void btstack_crypto_ccm_calc_xn_sn(btstack_crypto_ccm_t * btstack_crypto_ccm, const btstack_aes128_key_schedule_t * schedule){
+    bool encrypt = btstack_crypto_ccm->btstack_crypto.operation == BTSTACK_CRYPTO_CCM_ENCRYPT_BLOCK;
+    uint8_t a_i[16];
+    uint8_t s_i[16];
+    uint8_t b_i[16];
+    uint16_t i;
+    // each request processes at least one (possibly empty) block, same as controller based state machine
+    while (true){
+        uint16_t bytes_to_process = btstack_min(btstack_crypto_ccm->block_len, 16);
+        btstack_crypto_ccm_setup_a_i(btstack_crypto_ccm, btstack_crypto_ccm->counter, a_i);
+        if (encrypt){
+            // X_i+1 = E(X_i xor B_i) and S_i = E(A_i) are independent
+            for (i = 0; i < bytes_to_process ; i++){
+                b_i[i] = btstack_crypto_ccm->x_i[i] ^ btstack_crypto_ccm->input[i];
+            }
+            (void)memcpy(&b_i[i], &btstack_crypto_ccm->x_i[i], 16u - bytes_to_process);
+            btstack_aes128_encrypt_2(schedule, b_i, btstack_crypto_ccm->x_i, a_i, s_i);
+            for (i = 0; i < bytes_to_process ; i++){
+                btstack_crypto_ccm->output[i] = btstack_crypto_ccm->input[i] ^ s_i[i];
+            }
+        } else {
+            // plaintext is needed for CBC-MAC
+            btstack_aes128_encrypt(schedule, a_i, s_i);
+            for (i = 0; i < bytes_to_process ; i++){
+                btstack_crypto_ccm->output[i] = btstack_crypto_ccm->input[i] ^ s_i[i];
+                b_i[i] = btstack_crypto_ccm->x_i[i] ^ btstack_crypto_ccm->output[i];
+            }
+            (void)memcpy(&b_i[i], &btstack_crypto_ccm->x_i[i], 16u - bytes_to_process);
+            btstack_aes128_encrypt(schedule, b_i, btstack_crypto_ccm->x_i);
+        }
+
+        // next block
+        btstack_crypto_ccm->counter++;
+        btstack_crypto_ccm->input       += bytes_to_process;
+        btstack_crypto_ccm->output      += bytes_to_process;
+        btstack_crypto_ccm->block_len   -= bytes_to_process;
+        btstack_crypto_ccm->message_len -= bytes_to_process;
+#ifdef DEBUG_CCM
+        printf("btstack_crypto_ccm_next_block (message len %u, block_len %u)\n", btstack_crypto_ccm->message_len, btstack_crypto_ccm->block_len);
+#endif
+
+        // message complete: T = X_n+1 xor S_0
+        if (btstack_crypto_ccm->message_len == 0u){
+            btstack_crypto_ccm_setup_a_i(btstack_crypto_ccm, 0, a_i);
+            btstack_aes128_encrypt(schedule, a_i, s_i);
+            for (i = 0; i < 16u; i++){
+                btstack_crypto_ccm->x_i[i] ^= s_i[i];
+            }
+            btstack_crypto_ccm->state = CCM_W4_S0;
+            return;
+        }
+
+        // wait for next block
+        if (btstack_crypto_ccm->block_len == 0u){
+            btstack_crypto_ccm->state = encrypt ? CCM_CALCULATE_XN : CCM_CALCULATE_SN;
+            return;
+        }
+    }
+}
+
+static void btstack_crypto_ccm_calc(btstack_crypto_ccm_t * btstack_crypto_ccm){
+    btstack_aes128_key_schedule_t schedule;
+    btstack_aes128_setup(&schedule, btstack_crypto_ccm->key);
+    if (btstack_crypto_ccm->state == CCM_CALCULATE_X1){
+        btstack_crypto_ccm_calc_x1(btstack_crypto_ccm, &schedule);
+    }
+    switch (btstack_crypto_ccm->state){
+        case CCM_CALCULATE_AAD_XN:
+            btstack_crypto_ccm_calc_aad_xn(btstack_crypto_ccm, &schedule);
+            break;
+        case CCM_CALCULATE_XN:
+        case CCM_CALCULATE_SN:
+            btstack_crypto_ccm_calc_xn_sn(btstack_crypto_ccm, &schedule);
+            break;
+        default:
+            break;
+    }
 }
+#endif
 
 static void btstack_crypto_run(void){
 
@@ -890,6 +1334,10 @@ static void btstack_crypto_run(void){
             case BTSTACK_CRYPTO_CCM_ENCRYPT_BLOCK:
             case BTSTACK_CRYPTO_CCM_DECRYPT_BLOCK:
                 btstack_crypto_ccm = (btstack_crypto_ccm_t *) btstack_crypto;
+#ifdef USE_BTSTACK_AES128
+                btstack_crypto_ccm_calc(btstack_crypto_ccm);
+                btstack_crypto_done(btstack_crypto);
+#else
                 switch (btstack_crypto_ccm->state){
                     case CCM_CALCULATE_AAD_XN:
 #ifdef DEBUG_CCM
@@ -924,6 +1372,7 @@ static void btstack_crypto_run(void){
                     default:
                         break;
                 }
+#endif
                 break;
 
 #ifdef ENABLE_ECC_P256
@@ -957,6 +1406,15 @@ static void btstack_crypto_run(void){
                         btstack_crypto_wait_for_hci_result = true;
                         hci_send_cmd(&hci_le_rand);
                         break;
+#endif
+#ifdef USE_ECC_P256_WORKER_POOL
+                    case ECC_P256_KEY_GENERATION_W4_WORKERS_IDLE:
+                        // start when all DH Key calculations are complete, worker done callback triggers run again
+                        btstack_crypto_ecc_p256_worker_start_key_generation();
+                        return;
+                    case ECC_P256_KEY_GENERATION_ACTIVE:
+                        // wait for worker
+                        return;
 #endif
                     default:
                         break;
@@ -965,7 +1423,17 @@ static void btstack_crypto_run(void){
             case BTSTACK_CRYPTO_ECC_P256_CALCULATE_DHKEY:
                 btstack_crypto_ec_p192 = (btstack_crypto_ecc_p256_t *) btstack_crypto;
 #ifdef USE_SOFTWARE_ECC_P256_IMPLEMENTATION
-                btstack_crypto_ecc_p256_calculate_dhkey_software(btstack_crypto_ec_p192);
+#ifdef USE_ECC_P256_WORKER_POOL
+                if (btstack_crypto_worker_pool != NULL){
+                    // continue with next operation while DH Key is calculated, wait if all workers are busy
+                    if (btstack_crypto_ecc_p256_worker_start_dhkey(btstack_crypto_ec_p192) == false) return;
+                    btstack_linked_list_pop(&btstack_crypto_operations);
+                    break;
+                }
+#endif
+                btstack_crypto_ecc_p256_calculate_dhkey_software(btstack_crypto_ecc_p256_d, btstack_crypto_ec_p192->public_key, btstack_crypto_ec_p192->dhkey);
+                log_info("dhkey");
+                log_info_hexdump(btstack_crypto_ec_p192->dhkey, 32);
                 // done
                 btstack_linked_list_pop(&btstack_crypto_operations);
                 (*btstack_crypto_ec_p192->btstack_crypto.context_callback.callback)(btstack_crypto_ec_p192->btstack_crypto.context_callback.context);
@@ -1008,8 +1476,17 @@ static void btstack_crypto_handle_random_data(const uint8_t * data, uint16_t len
             (void)memcpy(&btstack_crypto_ecc_p256_random[btstack_crypto_ecc_p256_random_len], data, 8);
             btstack_crypto_ecc_p256_random_len += 8u;
             if (btstack_crypto_ecc_p256_random_len >= 64u) {
+#ifdef USE_ECC_P256_WORKER_POOL
+                if (btstack_crypto_worker_pool != NULL){
+                    // started by btstack_crypto_run
+                    btstack_crypto_ecc_p256_key_generation_state = ECC_P256_KEY_GENERATION_W4_WORKERS_IDLE;
+                    break;
+                }
+#endif
                 btstack_crypto_ecc_p256_key_generation_state = ECC_P256_KEY_GENERATION_ACTIVE;
-                btstack_crypto_ecc_p256_generate_key_software();
+                int res = btstack_crypto_ecc_p256_generate_key_software();
+                log_info("gen keypair %x", res);
+                UNUSED(res);
                 btstack_crypto_ecc_p256_key_generation_state = ECC_P256_KEY_GENERATION_DONE;
             }
             break;
@@ -1358,6 +1835,10 @@ static void btstack_crypto_state_reset(void) {
 #endif
 #ifdef ENABLE_ECC_P256
     btstack_crypto_ecc_p256_key_generation_state = ECC_P256_KEY_GENERATION_IDLE;
+#endif
+#ifdef USE_ECC_P256_WORKER_POOL
+    // jobs keep running, but results are dropped
+    btstack_crypto_ecc_p256_worker_cancel_all();
 #endif
     btstack_crypto_wait_for_hci_result = false;
     btstack_crypto_operations = NULL;
@@ -1385,6 +1866,15 @@ void btstack_crypto_deinit(void) {
     btstack_crypto_initialized = false;
 }
 
+void btstack_crypto_ecc_p256_set_worker_pool(const btstack_crypto_worker_pool_t * worker_pool){
+#ifdef USE_ECC_P256_WORKER_POOL
+    btstack_crypto_worker_pool = worker_pool;
+#else
+    UNUSED(worker_pool);
+    log_error("ECC P-256 worker pool requires ENABLE_ECC_P256_WORKER_POOL and software ECC implementation");
+#endif
+}
+
 // PTS only
 void btstack_crypto_ecc_p256_set_key(const uint8_t * public_key, const uint8_t * private_key){
 #ifdef USE_SOFTWARE_ECC_P256_IMPLEMENTATION
@@ -131,6 +131,21 @@ typedef struct {
 	uint8_t         aad_remainder_len;
 } btstack_crypto_ccm_t;
 
+typedef struct btstack_crypto_worker_job {
+	btstack_linked_item_t item;
+	// called on worker thread
+	void (*work)(struct btstack_crypto_worker_job * job);
+	// executed on main thread via btstack_run_loop_execute_on_main_thread after work is complete
+	btstack_context_callback_registration_t done;
+} btstack_crypto_worker_job_t;
+
+typedef struct {
+	// number of jobs that are processed in parallel
+	uint8_t (*get_num_workers)(void);
+	// call job->work on a worker thread, then execute job->done on main thread
+	void (*execute)(btstack_crypto_worker_job_t * job);
+} btstack_crypto_worker_pool_t;
+
 /** 
  * Initialize crypto functions
  */
@@ -287,6 +302,14 @@ void btstack_aes128_calc(const uint8_t * key, const uint8_t * plaintext, uint8_t
  */
 void btstack_crypto_deinit(void);
 
+/**
+ * @brief Calculate ECC P-256 key pair and DH Keys of the software implementation on worker threads
+ * @note Requires ENABLE_ECC_P256_WORKER_POOL and micro-ecc or mbedTLS. Callbacks are executed on main thread.
+ *       DH Key calculations are started as workers become available, key pair generation waits for them to complete.
+ * @param worker_pool e.g. btstack_crypto_worker_pool_posix_init_instance(), or NULL to calculate on main thread
+ */
+void btstack_crypto_ecc_p256_set_worker_pool(const btstack_crypto_worker_pool_t * worker_pool);
+
 // PTS testing only - not possible when using Buetooth Controller for ECC operations
 void btstack_crypto_ecc_p256_set_key(const uint8_t * public_key, const uint8_t * private_key);
 
@@ -3647,6 +3647,18 @@ typedef uint8_t sm_key_t[16];
  */
 #define PBAP_SUBEVENT_CARD_RESULT                                          0x06u
 
+/**
+ * @format 122JVJV
+ * @param subevent_code
+ * @param goep_cid
+ * @param card_index
+ * @param name_len
+ * @param name
+ * @param number_len
+ * @param number
+ */
+#define PBAP_SUBEVENT_VCARD_RESULT                                         0x07u
+
 /**
  * @format 121
  * @param subevent_code
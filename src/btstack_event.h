@@ -11697,6 +11697,61 @@ static inline const uint8_t * pbap_subevent_card_result_get_handle(const uint8_t
     return &event[6u + event[5] + 1u];
 }
 
+/**
+ * @brief Get field goep_cid from event PBAP_SUBEVENT_VCARD_RESULT
+ * @param event packet
+ * @return goep_cid
+ * @note: btstack_type 2
+ */
+static inline uint16_t pbap_subevent_vcard_result_get_goep_cid(const uint8_t * event){
+    return little_endian_read_16(event, 3);
+}
+/**
+ * @brief Get field card_index from event PBAP_SUBEVENT_VCARD_RESULT
+ * @param event packet
+ * @return card_index
+ * @note: btstack_type 2
+ */
+static inline uint16_t pbap_subevent_vcard_result_get_card_index(const uint8_t * event){
+    return little_endian_read_16(event, 5);
+}
+/**
+ * @brief Get field name_len from event PBAP_SUBEVENT_VCARD_RESULT
+ * @param event packet
+ * @return name_len
+ * @note: btstack_type J
+ */
+static inline uint8_t pbap_subevent_vcard_result_get_name_len(const uint8_t * event){
+    return event[7];
+}
+/**
+ * @brief Get field name from event PBAP_SUBEVENT_VCARD_RESULT
+ * @param event packet
+ * @return name
+ * @note: btstack_type V
+ */
+static inline const uint8_t * pbap_subevent_vcard_result_get_name(const uint8_t * event){
+    return &event[8];
+}
+/**
+ * @brief Get field number_len from event PBAP_SUBEVENT_VCARD_RESULT
+ * @param event packet
+ * @return number_len
+ * @note: btstack_type J
+ */
+static inline uint8_t pbap_subevent_vcard_result_get_number_len(const uint8_t * event){
+    return event[8u + event[7]];
+}
+/**
+ * @brief Get field number from event PBAP_SUBEVENT_VCARD_RESULT
+ * @param event packet
+ * @return number
+ * @note: btstack_type V
+ */
+static inline const uint8_t * pbap_subevent_vcard_result_get_number(const uint8_t * event){
+    return &event[8u + event[7] + 1u];
+}
+
 /**
  * @brief Get field goep_cid from event PBAP_SUBEVENT_RESET_MISSED_CALLS
  * @param event packet
@@ -531,3 +531,359 @@ int btstack_hid_report_id_declared(uint16_t hid_descriptor_len, const uint8_t *
     }
     return 0;
 }
+
+// HID Descriptor Compiler
+
+// max number of Usage and Usage Minimum/Maximum items for a single Main item
+#ifndef BTSTACK_HID_COMPILER_MAX_USAGE_RANGES
+#define BTSTACK_HID_COMPILER_MAX_USAGE_RANGES 16
+#endif
+
+typedef struct {
+    uint32_t minimum;
+    uint32_t maximum;
+} btstack_hid_usage_range_t;
+
+typedef struct {
+    // field table
+    btstack_hid_field_t * fields;
+    uint16_t        max_fields;
+    uint16_t        num_fields;
+
+    // last added field, used to merge consecutive usages
+    uint32_t        previous_usage_end;
+    uint8_t         previous_flags;
+
+    // local items since last main item
+    btstack_hid_usage_range_t usage_ranges[BTSTACK_HID_COMPILER_MAX_USAGE_RANGES];
+    uint8_t         num_usage_ranges;
+    uint32_t        usage_minimum;
+    uint32_t        usage_maximum;
+    bool            have_usage_minimum;
+    bool            have_usage_maximum;
+
+    // global items
+    int32_t         logical_minimum;
+    int32_t         logical_maximum;
+    uint16_t        usage_page;
+    uint8_t         report_size;
+    uint8_t         report_count;
+    uint8_t         report_id;
+} btstack_hid_compiler_t;
+
+static void btstack_hid_compiler_add_usage_range(btstack_hid_compiler_t * compiler, uint32_t minimum, uint32_t maximum){
+    if (maximum < minimum) return;
+    if (compiler->num_usage_ranges == BTSTACK_HID_COMPILER_MAX_USAGE_RANGES){
+        log_info("HID Compiler: more than %u usage ranges, ignore usage 0x%08x", BTSTACK_HID_COMPILER_MAX_USAGE_RANGES, (unsigned int) minimum);
+        return;
+    }
+    compiler->usage_ranges[compiler->num_usage_ranges].minimum = minimum;
+    compiler->usage_ranges[compiler->num_usage_ranges].maximum = maximum;
+    compiler->num_usage_ranges++;
+}
+
+static void btstack_hid_compiler_handle_local_item(btstack_hid_compiler_t * compiler, const hid_descriptor_item_t * item){
+    uint32_t usage = (uint32_t) item->item_value;
+    if (item->data_size <= 2u){
+        usage = (((uint32_t) compiler->usage_page) << 16) | (usage & 0xffffu);
+    }
+    switch ((LocalItemTag)item->item_tag){
+        case Usage:
+            btstack_hid_compiler_add_usage_range(compiler, usage, usage);
+            break;
+        case UsageMinimum:
+            compiler->usage_minimum = usage;
+            compiler->have_usage_minimum = true;
+            break;
+        case UsageMaximum:
+            compiler->usage_maximum = usage;
+            compiler->have_usage_maximum = true;
+            break;
+        default:
+            break;
+    }
+    if (compiler->have_usage_minimum && compiler->have_usage_maximum){
+        btstack_hid_compiler_add_usage_range(compiler, compiler->usage_minimum, compiler->usage_maximum);
+        compiler->have_usage_minimum = false;
+        compiler->have_usage_maximum = false;
+    }
+}
+
+static void btstack_hid_compiler_handle_global_item(btstack_hid_compiler_t * compiler, const hid_descriptor_item_t * item){
+    switch((GlobalItemTag)item->item_tag){
+        case UsagePage:
+            compiler->usage_page = (uint16_t) item->item_value;
+            break;
+        case LogicalMinimum:
+            compiler->logical_minimum = item->item_value;
+            break;
+        case LogicalMaximum:
+            compiler->logical_maximum = item->item_value;
+            break;
+        case ReportSize:
+            compiler->report_size = (uint8_t) item->item_value;
+            break;
+        case ReportID:
+            compiler->report_id = (uint8_t) item->item_value;
+            break;
+        case ReportCount:
+            compiler->report_count = (uint8_t) item->item_value;
+            break;
+        default:
+            break;
+    }
+}
+
+// add field for current main item, or extend previous field of the same main item if usages are consecutive
+static void btstack_hid_compiler_add_field(btstack_hid_compiler_t * compiler, uint16_t first_field_of_item, hid_report_type_t report_type,
+                                           uint8_t flags, uint32_t usage, uint8_t count){
+    if ((compiler->num_fields > first_field_of_item) && ((flags & BTSTACK_HID_FIELD_FLAGS_USAGE_INCREMENT) != 0u) &&
+        (compiler->previous_flags == flags) && (compiler->previous_usage_end == usage)){
+        compiler->previous_usage_end += count;
+        if (compiler->num_fields <= compiler->max_fields){
+            compiler->fields[compiler->num_fields - 1u].count += count;
+        }
+        return;
+    }
+    compiler->previous_flags = flags;
+    compiler->previous_usage_end = usage + count;
+    uint16_t index = compiler->num_fields++;
+    if (index >= compiler->max_fields) return;
+
+    // fields of the same report are back to back
+    uint16_t bit_offset = (compiler->report_id != 0u) ? 8u : 0u;
+    uint16_t i;
+    for (i = index; i > 0u; i--){
+        const btstack_hid_field_t * field = &compiler->fields[i - 1u];
+        if ((field->report_type != (uint8_t) report_type) || (field->report_id != compiler->report_id)) continue;
+        bit_offset = (uint16_t) (field->bit_offset + (field->bit_size * field->count));
+        break;
+    }
+
+    btstack_hid_field_t * field = &compiler->fields[index];
+    field->usage           = usage;
+    field->logical_minimum = compiler->logical_minimum;
+    field->logical_maximum = compiler->logical_maximum;
+    field->bit_offset      = bit_offset;
+    field->bit_size        = compiler->report_size;
+    field->count           = count;
+    field->report_id       = compiler->report_id;
+    field->report_type     = (uint8_t) report_type;
+    field->flags           = flags;
+}
+
+static void btstack_hid_compiler_handle_main_item(btstack_hid_compiler_t * compiler, const hid_descriptor_item_t * item){
+    hid_report_type_t report_type;
+    switch ((MainItemTag)item->item_tag){
+        case Input:
+            report_type = HID_REPORT_TYPE_INPUT;
+            break;
+        case Output:
+            report_type = HID_REPORT_TYPE_OUTPUT;
+            break;
+        case Feature:
+            report_type = HID_REPORT_TYPE_FEATURE;
+            break;
+        default:
+            return;
+    }
+    if (compiler->report_count == 0u) return;
+
+    uint16_t first_field_of_item = compiler->num_fields;
+    uint32_t last_usage = ((uint32_t) compiler->usage_page) << 16;
+    if (compiler->num_usage_ranges > 0u){
+        last_usage = compiler->usage_ranges[0].minimum;
+    }
+
+    // constant fields used for padding
+    if ((item->item_value & 1) != 0){
+        btstack_hid_compiler_add_field(compiler, first_field_of_item, report_type, BTSTACK_HID_FIELD_FLAGS_CONSTANT, 0, compiler->report_count);
+        return;
+    }
+
+    // array: single field, value is usage
+    if ((item->item_value & 2) == 0){
+        btstack_hid_compiler_add_field(compiler, first_field_of_item, report_type, 0, last_usage, compiler->report_count);
+        return;
+    }
+
+    // variable: assign usages in order
+    uint8_t remaining = compiler->report_count;
+    uint8_t i;
+    for (i = 0; (i < compiler->num_usage_ranges) && (remaining > 0u); i++){
+        const btstack_hid_usage_range_t * range = &compiler->usage_ranges[i];
+        uint32_t num_usages = range->maximum - range->minimum + 1u;
+        uint8_t count = (num_usages < remaining) ? (uint8_t) num_usages : remaining;
+        btstack_hid_compiler_add_field(compiler, first_field_of_item, report_type,
+                                       BTSTACK_HID_FIELD_FLAGS_VARIABLE | BTSTACK_HID_FIELD_FLAGS_USAGE_INCREMENT, range->minimum, count);
+        remaining -= count;
+        last_usage = range->minimum + count - 1u;
+    }
+    // remaining values use last usage
+    if (remaining > 0u){
+        btstack_hid_compiler_add_field(compiler, first_field_of_item, report_type, BTSTACK_HID_FIELD_FLAGS_VARIABLE, last_usage, remaining);
+    }
+}
+
+static uint16_t btstack_hid_field_get_sort_key(const btstack_hid_field_t * field){
+    return (((uint16_t) field->report_type) << 8) | field->report_id;
+}
+
+// stable insertion sort by report type and report id
+static void btstack_hid_compiler_sort_fields(btstack_hid_field_t * fields, uint16_t num_fields){
+    uint16_t i;
+    for (i = 1; i < num_fields; i++){
+        btstack_hid_field_t field = fields[i];
+        uint16_t key = btstack_hid_field_get_sort_key(&field);
+        uint16_t j = i;
+        while ((j > 0u) && (btstack_hid_field_get_sort_key(&fields[j - 1u]) > key)){
+            fields[j] = fields[j - 1u];
+            j--;
+        }
+        fields[j] = field;
+    }
+}
+
+uint16_t btstack_hid_descriptor_compile(const uint8_t * hid_descriptor, uint16_t hid_descriptor_len, btstack_hid_field_t * fields, uint16_t max_fields){
+    btstack_hid_compiler_t compiler;
+    memset(&compiler, 0, sizeof(compiler));
+    compiler.fields     = fields;
+    compiler.max_fields = max_fields;
+
+    while (hid_descriptor_len > 0u){
+        hid_descriptor_item_t item;
+        btstack_hid_parse_descriptor_item(&item, hid_descriptor, hid_descriptor_len);
+        if ((item.item_size == 0u) || (item.item_size > hid_descriptor_len)) break;
+        switch ((TagType)item.item_type){
+            case Main:
+                btstack_hid_compiler_handle_main_item(&compiler, &item);
+                // local items are only valid for the next main item
+                compiler.num_usage_ranges   = 0;
+                compiler.have_usage_minimum = false;
+                compiler.have_usage_maximum = false;
+                break;
+            case Global:
+                btstack_hid_compiler_handle_global_item(&compiler, &item);
+                break;
+            case Local:
+                btstack_hid_compiler_handle_local_item(&compiler, &item);
+                break;
+            default:
+                break;
+        }
+        hid_descriptor_len -= item.item_size;
+        hid_descriptor     += item.item_size;
+    }
+
+    if (compiler.num_fields <= max_fields){
+        btstack_hid_compiler_sort_fields(fields, compiler.num_fields);
+    }
+    return compiler.num_fields;
+}
+
+int btstack_hid_field_table_get_report_size_for_id(const btstack_hid_field_table_t * field_table, int report_id, hid_report_type_t report_type){
+    int total_report_size = 0;
+    uint16_t i;
+    for (i = 0; i < field_table->num_fields; i++){
+        const btstack_hid_field_t * field = &field_table->fields[i];
+        if (field->report_type != (uint8_t) report_type) continue;
+        if (field->report_id != report_id) continue;
+        total_report_size += field->bit_size * field->count;
+    }
+    return (total_report_size + 7) / 8;
+}
+
+// HID Report Decoder
+
+static bool btstack_hid_report_decoder_value_available(const btstack_hid_report_decoder_t * decoder){
+    const btstack_hid_field_t * field = decoder->field;
+    uint32_t bit_end = field->bit_offset + ((uint32_t) (decoder->value_index + 1u) * field->bit_size);
+    return bit_end <= (((uint32_t) decoder->report_len) * 8u);
+}
+
+// skip constant fields and stop if report is too short
+static void btstack_hid_report_decoder_find_next_value(btstack_hid_report_decoder_t * decoder){
+    while ((decoder->field < decoder->fields_end) && ((decoder->field->flags & BTSTACK_HID_FIELD_FLAGS_CONSTANT) != 0u)){
+        decoder->field++;
+    }
+    if (decoder->field == decoder->fields_end) return;
+    if (btstack_hid_report_decoder_value_available(decoder)) return;
+    decoder->field = decoder->fields_end;
+}
+
+static uint32_t btstack_hid_report_read_bits(const uint8_t * report, uint16_t bit_pos, uint8_t bit_size){
+    uint16_t pos = bit_pos >> 3;
+    uint8_t  shift = bit_pos & 0x07u;
+    uint8_t  num_bytes = (uint8_t) ((shift + bit_size + 7u) >> 3);
+    uint64_t value = 0;
+    uint8_t i;
+    for (i = 0; i < num_bytes; i++){
+        value |= ((uint64_t) report[pos + i]) << (8u * i);
+    }
+    value >>= shift;
+    if (bit_size < 32u){
+        value &= (1u << bit_size) - 1u;
+    }
+    return (uint32_t) value;
+}
+
+void btstack_hid_report_decoder_init(btstack_hid_report_decoder_t * decoder, const btstack_hid_field_table_t * field_table, hid_report_type_t hid_report_type, const uint8_t * hid_report, uint16_t hid_report_len){
+    memset(decoder, 0, sizeof(btstack_hid_report_decoder_t));
+    decoder->report     = hid_report;
+    decoder->report_len = hid_report_len;
+
+    // find fields of report, fields are sorted by report type and report id
+    const btstack_hid_field_t * field = field_table->fields;
+    const btstack_hid_field_t * fields_end = &field_table->fields[field_table->num_fields];
+    while (field < fields_end){
+        if (field->report_type == (uint8_t) hid_report_type){
+            if (field->report_id == 0u) break;
+            if ((hid_report_len > 0u) && (field->report_id == hid_report[0])) break;
+        }
+        field++;
+    }
+    const btstack_hid_field_t * report_end = field;
+    while ((report_end < fields_end) && (report_end->report_type == field->report_type) && (report_end->report_id == field->report_id)){
+        report_end++;
+    }
+    decoder->field      = field;
+    decoder->fields_end = report_end;
+    btstack_hid_report_decoder_find_next_value(decoder);
+}
+
+bool btstack_hid_report_decoder_has_more(btstack_hid_report_decoder_t * decoder){
+    return decoder->field < decoder->fields_end;
+}
+
+void btstack_hid_report_decoder_get_field(btstack_hid_report_decoder_t * decoder, uint16_t * usage_page, uint16_t * usage, int32_t * value){
+    const btstack_hid_field_t * field = decoder->field;
+    uint16_t bit_pos = (uint16_t) (field->bit_offset + (decoder->value_index * field->bit_size));
+    uint32_t unsigned_value = btstack_hid_report_read_bits(decoder->report, bit_pos, field->bit_size);
+
+    if ((field->flags & BTSTACK_HID_FIELD_FLAGS_VARIABLE) != 0u){
+        uint32_t field_usage = field->usage;
+        if ((field->flags & BTSTACK_HID_FIELD_FLAGS_USAGE_INCREMENT) != 0u){
+            field_usage += decoder->value_index;
+        }
+        *usage_page = (uint16_t) (field_usage >> 16);
+        *usage      = (uint16_t) (field_usage & 0xffffu);
+        bool is_signed = field->logical_minimum < 0;
+        if (is_signed && (field->bit_size > 0u) && (field->bit_size < 32u) && ((unsigned_value & (1u << (field->bit_size - 1u))) != 0u)){
+            *value = (int32_t) (unsigned_value - (1u << field->bit_size));
+        } else {
+            *value = (int32_t) unsigned_value;
+        }
+    } else {
+        *usage_page = (uint16_t) (field->usage >> 16);
+        *usage      = (uint16_t) unsigned_value;
+        *value      = 1;
+    }
+
+    // next value
+    decoder->value_index++;
+    if (decoder->value_index == field->count){
+        decoder->value_index = 0;
+        decoder->field++;
+    }
+    btstack_hid_report_decoder_find_next_value(decoder);
+}
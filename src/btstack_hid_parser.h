@@ -40,12 +40,16 @@
  *
  * Single-pass HID Report Parser: HID Report is directly parsed without preprocessing HID Descriptor to minimize memory.
  *
+ * Alternatively, a HID Descriptor can be compiled once into a flat field table, which allows to decode
+ * reports without parsing the HID Descriptor again.
+ *
  */
 
 #ifndef BTSTACK_HID_PARSER_H
 #define BTSTACK_HID_PARSER_H
 
 #include <stdint.h>
+#include "btstack_bool.h"
 #include "btstack_hid.h"
 
 #if defined __cplusplus
@@ -151,6 +155,48 @@ typedef struct {
     uint8_t         global_report_id;
 } btstack_hid_parser_t;
 
+// value is a variable, usage of first value in field.usage, otherwise value is usage index of array
+#define BTSTACK_HID_FIELD_FLAGS_VARIABLE        0x01u
+// constant value used as padding
+#define BTSTACK_HID_FIELD_FLAGS_CONSTANT        0x02u
+// usage gets incremented for each value, otherwise all values have the same usage
+#define BTSTACK_HID_FIELD_FLAGS_USAGE_INCREMENT 0x04u
+
+/**
+ * Compiled HID Report field: values of a Main Input/Output/Feature item that share report size and
+ * logical range and have consecutive usages
+ */
+typedef struct {
+    // usage page << 16 | usage of first value. for arrays, only usage page is used
+    uint32_t        usage;
+    int32_t         logical_minimum;
+    int32_t         logical_maximum;
+    // bit position of first value in report, including report id
+    uint16_t        bit_offset;
+    uint8_t         bit_size;
+    uint8_t         count;
+    uint8_t         report_id;
+    uint8_t         report_type;
+    uint8_t         flags;
+} btstack_hid_field_t;
+
+typedef struct {
+    const btstack_hid_field_t * fields;
+    uint16_t        num_fields;
+} btstack_hid_field_table_t;
+
+typedef struct {
+    // Report
+    const uint8_t * report;
+    uint16_t        report_len;
+
+    // current and last field of report
+    const btstack_hid_field_t * field;
+    const btstack_hid_field_t * fields_end;
+    // index of next value in current field
+    uint8_t         value_index;
+} btstack_hid_report_decoder_t;
+
 /* API_START */
 
 /**
@@ -210,6 +256,51 @@ hid_report_id_status_t btstack_hid_id_valid(int report_id, uint16_t hid_descript
  * @param hid_descriptor
  */
 int btstack_hid_report_id_declared(uint16_t hid_descriptor_len, const uint8_t * hid_descriptor);
+
+/**
+ * @brief Compile HID Descriptor into field table sorted by report type and report id
+ * @note Push/Pop and Delimiter items are not supported. Variable items with more values than usages use the last usage
+ * @param hid_descriptor
+ * @param hid_descriptor_len
+ * @param fields storage for field table
+ * @param max_fields
+ * @return number of fields required. fields are only valid if the number is not larger than max_fields
+ */
+uint16_t btstack_hid_descriptor_compile(const uint8_t * hid_descriptor, uint16_t hid_descriptor_len, btstack_hid_field_t * fields, uint16_t max_fields);
+
+/**
+ * @brief Get report size for given report ID and report type from compiled HID Descriptor
+ * @param field_table
+ * @param report_id
+ * @param report_type
+ * @return report size in bytes without report id
+ */
+int btstack_hid_field_table_get_report_size_for_id(const btstack_hid_field_table_t * field_table, int report_id, hid_report_type_t report_type);
+
+/**
+ * @brief Initialize HID Report decoder for compiled HID Descriptor
+ * @param decoder state
+ * @param field_table
+ * @param hid_report_type
+ * @param hid_report including report id if used
+ * @param hid_report_len
+ */
+void btstack_hid_report_decoder_init(btstack_hid_report_decoder_t * decoder, const btstack_hid_field_table_t * field_table, hid_report_type_t hid_report_type, const uint8_t * hid_report, uint16_t hid_report_len);
+
+/**
+ * @brief Checks if more fields are available
+ * @param decoder
+ */
+bool btstack_hid_report_decoder_has_more(btstack_hid_report_decoder_t * decoder);
+
+/**
+ * @brief Get next field. Same semantics as btstack_hid_parser_get_field
+ * @param decoder
+ * @param usage_page
+ * @param usage
+ * @param value provided in HID report
+ */
+void btstack_hid_report_decoder_get_field(btstack_hid_report_decoder_t * decoder, uint16_t * usage_page, uint16_t * usage, int32_t * value);
 /* API_END */
 
 #if defined __cplusplus
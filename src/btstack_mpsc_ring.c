@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "btstack_mpsc_ring.c"
+
+/*
+ *  btstack_mpsc_ring.c
+ *
+ *  Bounded queue with per-slot sequence numbers: slot i is free for write index w if
+ *  sequences[i] == w, and holds an element for read index r if sequences[i] == r + 1.
+ *  After reading, the consumer sets sequences[i] to r + num_slots, which frees the slot
+ *  for the next round. A producer that is preempted between claiming and publishing a slot
+ *  only delays the consumer, other producers can continue.
+ */
+
+#include <string.h>
+
+#include "btstack_mpsc_ring.h"
+#include "btstack_debug.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MPSC_LOAD_RELAXED(ptr)          __atomic_load_n(ptr, __ATOMIC_RELAXED)
+#define MPSC_LOAD_ACQUIRE(ptr)          __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define MPSC_STORE_RELEASE(ptr, value)  __atomic_store_n(ptr, value, __ATOMIC_RELEASE)
+#define MPSC_COMPARE_EXCHANGE(ptr, expected, desired) \
+    __atomic_compare_exchange_n(ptr, expected, desired, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define MPSC_LOAD_RELAXED(ptr)          ((uint32_t) _InterlockedOr((volatile long *) (ptr), 0))
+#define MPSC_LOAD_ACQUIRE(ptr)          ((uint32_t) _InterlockedOr((volatile long *) (ptr), 0))
+#define MPSC_STORE_RELEASE(ptr, value)  ((void) _InterlockedExchange((volatile long *) (ptr), (long) (value)))
+static bool mpsc_compare_exchange(uint32_t * ptr, uint32_t * expected, uint32_t desired){
+    uint32_t previous = (uint32_t) _InterlockedCompareExchange((volatile long *) ptr, (long) desired, (long) *expected);
+    if (previous == *expected) return true;
+    *expected = previous;
+    return false;
+}
+#define MPSC_COMPARE_EXCHANGE(ptr, expected, desired) mpsc_compare_exchange(ptr, expected, desired)
+#else
+#error "btstack_mpsc_ring requires __atomic builtins"
+#endif
+
+void btstack_mpsc_ring_init(btstack_mpsc_ring_t * ring, uint8_t * storage, uint32_t * sequences, uint32_t num_slots, uint32_t element_size){
+    btstack_assert((num_slots >= 2u) && ((num_slots & (num_slots - 1u)) == 0u));
+    ring->storage = storage;
+    ring->sequences = sequences;
+    ring->num_slots = num_slots;
+    ring->element_size = element_size;
+    btstack_mpsc_ring_reset(ring);
+}
+
+void btstack_mpsc_ring_reset(btstack_mpsc_ring_t * ring){
+    uint32_t i;
+    for (i = 0; i < ring->num_slots; i++){
+        ring->sequences[i] = i;
+    }
+    ring->write_index = 0;
+    ring->read_index = 0;
+}
+
+bool btstack_mpsc_ring_push(btstack_mpsc_ring_t * ring, const void * element){
+    uint32_t mask = ring->num_slots - 1u;
+    uint32_t write_index = MPSC_LOAD_RELAXED(&ring->write_index);
+    uint32_t slot;
+    while (true){
+        slot = write_index & mask;
+        int32_t diff = (int32_t) (MPSC_LOAD_ACQUIRE(&ring->sequences[slot]) - write_index);
+        if (diff == 0){
+            // slot free, try to claim it. on failure, write_index is updated
+            if (MPSC_COMPARE_EXCHANGE(&ring->write_index, &write_index, write_index + 1u)){
+                break;
+            }
+        } else if (diff < 0){
+            // slot still holds element from previous round
+            return false;
+        } else {
+            // other producer claimed slot
+            write_index = MPSC_LOAD_RELAXED(&ring->write_index);
+        }
+    }
+    (void) memcpy(&ring->storage[slot * ring->element_size], element, ring->element_size);
+    MPSC_STORE_RELEASE(&ring->sequences[slot], write_index + 1u);
+    return true;
+}
+
+const void * btstack_mpsc_ring_peek(btstack_mpsc_ring_t * ring){
+    uint32_t slot = ring->read_index & (ring->num_slots - 1u);
+    if (MPSC_LOAD_ACQUIRE(&ring->sequences[slot]) != (ring->read_index + 1u)){
+        return NULL;
+    }
+    return &ring->storage[slot * ring->element_size];
+}
+
+void btstack_mpsc_ring_consume(btstack_mpsc_ring_t * ring){
+    uint32_t slot = ring->read_index & (ring->num_slots - 1u);
+    btstack_assert(ring->sequences[slot] == (ring->read_index + 1u));
+    MPSC_STORE_RELEASE(&ring->sequences[slot], ring->read_index + ring->num_slots);
+    ring->read_index++;
+}
+
+bool btstack_mpsc_ring_pop(btstack_mpsc_ring_t * ring, void * element){
+    const void * next = btstack_mpsc_ring_peek(ring);
+    if (next == NULL){
+        return false;
+    }
+    (void) memcpy(element, next, ring->element_size);
+    btstack_mpsc_ring_consume(ring);
+    return true;
+}
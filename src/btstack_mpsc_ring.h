@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/**
+ * @title MPSC Ring Buffer
+ *
+ * Lock-free bounded multi-producer/single-consumer queue of fixed-size elements, e.g. to post
+ * events or callbacks from several threads to the run loop. Producers claim a slot with a
+ * compare-and-swap on the shared write index, copy the element and publish the slot via its
+ * sequence number. The single consumer - usually the run loop - reads elements in order.
+ *
+ * To post to the run loop, producers push an element and call btstack_run_loop_poll_data_sources_from_irq.
+ * The queue is drained in the process callback of a data source with DATA_SOURCE_CALLBACK_POLL enabled.
+ *
+ * The number of slots has to be a power of two, at least 2. Requires GCC/Clang __atomic builtins or MSVC.
+ */
+
+#ifndef BTSTACK_MPSC_RING_H
+#define BTSTACK_MPSC_RING_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "btstack_bool.h"
+
+typedef struct btstack_mpsc_ring {
+    uint8_t  * storage;
+    uint32_t * sequences;
+    uint32_t   num_slots;
+    uint32_t   element_size;
+    // shared by producers
+    uint32_t   write_index;
+    // consumer
+    uint32_t   read_index;
+} btstack_mpsc_ring_t;
+
+/* API_START */
+
+/**
+ * @brief Init MPSC ring buffer
+ * @param ring
+ * @param storage for num_slots * element_size bytes
+ * @param sequences array with num_slots entries
+ * @param num_slots power of two, >= 2
+ * @param element_size in bytes
+ */
+void btstack_mpsc_ring_init(btstack_mpsc_ring_t * ring, uint8_t * storage, uint32_t * sequences, uint32_t num_slots, uint32_t element_size);
+
+/**
+ * @brief Reset ring buffer to empty state. Must not be called while producers or consumer are active
+ * @param ring
+ */
+void btstack_mpsc_ring_reset(btstack_mpsc_ring_t * ring);
+
+/**
+ * @brief Copy element into ring buffer. Can be called from any thread
+ * @param ring
+ * @param element of element_size bytes
+ * @return true if stored, false if ring buffer is full
+ */
+bool btstack_mpsc_ring_push(btstack_mpsc_ring_t * ring, const void * element);
+
+/**
+ * @brief Get next element without removing it. Called by consumer
+ * @param ring
+ * @return element or NULL if empty
+ */
+const void * btstack_mpsc_ring_peek(btstack_mpsc_ring_t * ring);
+
+/**
+ * @brief Remove element returned by peek. Called by consumer
+ * @param ring
+ */
+void btstack_mpsc_ring_consume(btstack_mpsc_ring_t * ring);
+
+/**
+ * @brief Copy next element from ring buffer. Called by consumer
+ * @param ring
+ * @param element buffer of element_size bytes
+ * @return true if element was read, false if empty
+ */
+bool btstack_mpsc_ring_pop(btstack_mpsc_ring_t * ring, void * element);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // BTSTACK_MPSC_RING_H
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "btstack_resample_polyphase.c"
+
+/*
+ *  btstack_resample_polyphase.c
+ *
+ *  Each output sample is the dot product of num_taps input frames with a Q15 filter phase.
+ *  Filter tables provide 2^phase_bits + 1 phases, see tool/resample_polyphase_generator.py.
+ *  The coefficients for the exact fractional position are linearly interpolated between the
+ *  two neighbouring phases by computing both dot products.
+ *
+ *  Input frames are deinterleaved into a per-channel buffer so that the dot products run
+ *  over contiguous samples. The per-lane sums of absolute coefficients are below 2^16, which
+ *  allows for 32-bit SIMD accumulators. All implementations produce identical results.
+ */
+
+#include <string.h>
+
+#include "btstack_debug.h"
+#include "btstack_resample_polyphase.h"
+#include "btstack_resample_polyphase_tables.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define BTSTACK_RESAMPLE_POLYPHASE_SSE2
+#endif
+
+static void btstack_resample_polyphase_dot2(const int16_t * samples, const int16_t * coefficients_0,
+                                            const int16_t * coefficients_1, uint16_t num_taps,
+                                            int64_t * result_0, int64_t * result_1){
+    int64_t acc_0 = 0;
+    int64_t acc_1 = 0;
+    uint16_t i;
+    for (i = 0; i < num_taps; i++){
+        acc_0 += (int32_t) samples[i] * coefficients_0[i];
+        acc_1 += (int32_t) samples[i] * coefficients_1[i];
+    }
+    *result_0 = acc_0;
+    *result_1 = acc_1;
+}
+
+#ifdef BTSTACK_RESAMPLE_POLYPHASE_SSE2
+static int64_t btstack_resample_polyphase_sse2_sum(__m128i acc){
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i *) lanes, acc);
+    return (int64_t) lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+static void btstack_resample_polyphase_dot2_simd(const int16_t * samples, const int16_t * coefficients_0,
+                                                 const int16_t * coefficients_1, uint16_t num_taps,
+                                                 int64_t * result_0, int64_t * result_1){
+    __m128i acc_0 = _mm_setzero_si128();
+    __m128i acc_1 = _mm_setzero_si128();
+    uint16_t i;
+    for (i = 0; i < num_taps; i += 8){
+        __m128i x = _mm_loadu_si128((const __m128i *) &samples[i]);
+        acc_0 = _mm_add_epi32(acc_0, _mm_madd_epi16(x, _mm_loadu_si128((const __m128i *) &coefficients_0[i])));
+        acc_1 = _mm_add_epi32(acc_1, _mm_madd_epi16(x, _mm_loadu_si128((const __m128i *) &coefficients_1[i])));
+    }
+    *result_0 = btstack_resample_polyphase_sse2_sum(acc_0);
+    *result_1 = btstack_resample_polyphase_sse2_sum(acc_1);
+}
+#endif
+
+bool btstack_resample_polyphase_simd_available(void){
+#ifdef BTSTACK_RESAMPLE_POLYPHASE_SSE2
+    return true;
+#else
+    return false;
+#endif
+}
+
+void btstack_resample_polyphase_init(btstack_resample_polyphase_t * context, int num_channels, btstack_resample_polyphase_quality_t quality){
+    btstack_assert(num_channels <= BTSTACK_RESAMPLE_MAX_CHANNELS);
+    memset(context, 0, sizeof(btstack_resample_polyphase_t));
+    switch (quality){
+        case BTSTACK_RESAMPLE_POLYPHASE_QUALITY_LOW:
+            context->coefficients = btstack_resample_polyphase_coefficients_low;
+            context->num_taps     = 16;
+            context->phase_bits   = 5;
+            break;
+        case BTSTACK_RESAMPLE_POLYPHASE_QUALITY_MEDIUM:
+            context->coefficients = btstack_resample_polyphase_coefficients_medium;
+            context->num_taps     = 32;
+            context->phase_bits   = 6;
+            break;
+        default:
+            context->coefficients = btstack_resample_polyphase_coefficients_high;
+            context->num_taps     = 64;
+            context->phase_bits   = 7;
+            break;
+    }
+    context->src_step     = 0x10000;  // default resampling 1.0
+    context->num_channels = num_channels;
+    context->simd         = btstack_resample_polyphase_simd_available();
+    // pre-fill history with silence so that the first output sample corresponds to the first input frame
+    context->buffer_frames = (context->num_taps / 2u) - 1u;
+}
+
+void btstack_resample_polyphase_set_factor(btstack_resample_polyphase_t * context, uint32_t src_step){
+    // factors of 2.0 and above would skip frames that have not been buffered yet
+    btstack_assert(src_step < 0x20000);
+    context->src_step = src_step;
+}
+
+void btstack_resample_polyphase_set_simd(btstack_resample_polyphase_t * context, bool enabled){
+    context->simd = enabled && btstack_resample_polyphase_simd_available();
+}
+
+static int16_t btstack_resample_polyphase_filter(btstack_resample_polyphase_t * context, const int16_t * samples, uint16_t t){
+    const uint8_t  phase_bits = context->phase_bits;
+    const uint16_t num_taps   = context->num_taps;
+    const uint16_t phase      = t >> (16u - phase_bits);
+    const int64_t  weight     = (uint16_t)(t << phase_bits);
+    const int16_t * coefficients_0 = &context->coefficients[phase * num_taps];
+    const int16_t * coefficients_1 = coefficients_0 + num_taps;
+    int64_t acc_0;
+    int64_t acc_1;
+#ifdef BTSTACK_RESAMPLE_POLYPHASE_SSE2
+    if (context->simd){
+        btstack_resample_polyphase_dot2_simd(samples, coefficients_0, coefficients_1, num_taps, &acc_0, &acc_1);
+    } else
+#endif
+    {
+        btstack_resample_polyphase_dot2(samples, coefficients_0, coefficients_1, num_taps, &acc_0, &acc_1);
+    }
+    int64_t acc = acc_0 + (((acc_1 - acc_0) * weight) >> 16);
+    acc = (acc + (1 << 14)) >> 15;
+    if (acc > INT16_MAX) return INT16_MAX;
+    if (acc < INT16_MIN) return INT16_MIN;
+    return (int16_t) acc;
+}
+
+uint16_t btstack_resample_polyphase_block(btstack_resample_polyphase_t * context, const int16_t * input_buffer, uint32_t num_frames, int16_t * output_buffer){
+    const int num_channels = context->num_channels;
+    uint16_t dest_frames  = 0;
+    uint32_t dest_samples = 0;
+    while (num_frames > 0){
+        // append next chunk to per-channel buffers
+        uint32_t chunk = BTSTACK_RESAMPLE_POLYPHASE_BUFFER_FRAMES - context->buffer_frames;
+        if (chunk > num_frames){
+            chunk = num_frames;
+        }
+        int channel;
+        uint32_t i;
+        for (channel = 0; channel < num_channels; channel++){
+            int16_t * dest = &context->buffer[channel][context->buffer_frames];
+            const int16_t * src = &input_buffer[channel];
+            for (i = 0; i < chunk; i++){
+                dest[i] = *src;
+                src += num_channels;
+            }
+        }
+        input_buffer += chunk * num_channels;
+        num_frames   -= chunk;
+        context->buffer_frames += chunk;
+
+        // generate output while full filter window is available
+        while (((context->src_pos >> 16) + context->num_taps) <= context->buffer_frames){
+            const uint16_t src_pos = context->src_pos >> 16;
+            const uint16_t t       = context->src_pos & 0xffffu;
+            for (channel = 0; channel < num_channels; channel++){
+                output_buffer[dest_samples++] = btstack_resample_polyphase_filter(context, &context->buffer[channel][src_pos], t);
+            }
+            dest_frames++;
+            context->src_pos += context->src_step;
+        }
+
+        // drop frames that are not needed anymore
+        const uint16_t consumed = context->src_pos >> 16;
+        const uint16_t remaining = context->buffer_frames - consumed;
+        for (channel = 0; channel < num_channels; channel++){
+            memmove(&context->buffer[channel][0], &context->buffer[channel][consumed], remaining * sizeof(int16_t));
+        }
+        context->buffer_frames = remaining;
+        context->src_pos -= ((uint32_t) consumed) << 16;
+    }
+    return dest_frames;
+}
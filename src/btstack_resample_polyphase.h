@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/**
+ * @title Polyphase Resampling
+ *
+ * Windowed-sinc polyphase resampling for 16-bit audio samples with the same streaming
+ * block API as btstack_resample. Intended for drift compensation and 44.1 <-> 48 kHz
+ * conversion, i.e. factors between 0.9 and 1.1 as the filter cutoff does not follow the factor.
+ *
+ * Uses SSE2 if supported by the compiler target.
+ *
+ */
+
+#ifndef BTSTACK_RESAMPLE_POLYPHASE_H
+#define BTSTACK_RESAMPLE_POLYPHASE_H
+
+#include <stdint.h>
+
+#include "btstack_bool.h"
+#include "btstack_resample.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+#define BTSTACK_RESAMPLE_POLYPHASE_MAX_TAPS 64
+
+// number of input frames processed per filter run
+#ifndef BTSTACK_RESAMPLE_POLYPHASE_BLOCK_FRAMES
+#define BTSTACK_RESAMPLE_POLYPHASE_BLOCK_FRAMES 128
+#endif
+
+#define BTSTACK_RESAMPLE_POLYPHASE_BUFFER_FRAMES (BTSTACK_RESAMPLE_POLYPHASE_MAX_TAPS + BTSTACK_RESAMPLE_POLYPHASE_BLOCK_FRAMES)
+
+typedef enum {
+    BTSTACK_RESAMPLE_POLYPHASE_QUALITY_LOW = 0,     // 16 taps
+    BTSTACK_RESAMPLE_POLYPHASE_QUALITY_MEDIUM,      // 32 taps
+    BTSTACK_RESAMPLE_POLYPHASE_QUALITY_HIGH,        // 64 taps
+} btstack_resample_polyphase_quality_t;
+
+typedef struct {
+    const int16_t * coefficients;
+    uint16_t num_taps;
+    uint8_t  phase_bits;
+    bool     simd;
+    uint32_t src_pos;
+    uint32_t src_step;
+    uint16_t buffer_frames;
+    int      num_channels;
+    int16_t  buffer[BTSTACK_RESAMPLE_MAX_CHANNELS][BTSTACK_RESAMPLE_POLYPHASE_BUFFER_FRAMES];
+} btstack_resample_polyphase_t;
+
+/* API_START */
+
+/**
+ * @brief Init resample context
+ * @param context
+ * @param num_channels up to BTSTACK_RESAMPLE_MAX_CHANNELS
+ * @param quality
+ */
+void btstack_resample_polyphase_init(btstack_resample_polyphase_t * context, int num_channels, btstack_resample_polyphase_quality_t quality);
+
+/**
+ * @brief Set resampling factor
+ * @param factor as fixed point value, identity is 0x10000, must be below 0x20000
+ */
+void btstack_resample_polyphase_set_factor(btstack_resample_polyphase_t * context, uint32_t factor);
+
+/**
+ * @brief Process block of input samples
+ * @note size of output buffer is not checked
+ * @note output lags input by half the number of taps as the filter needs future frames
+ * @param input_buffer
+ * @param num_frames
+ * @param output_buffer
+ * @return number destination frames
+ */
+uint16_t btstack_resample_polyphase_block(btstack_resample_polyphase_t * context, const int16_t * input_buffer, uint32_t num_frames, int16_t * output_buffer);
+
+/**
+ * @brief Use SIMD implementation if available, enabled by default
+ * @param context
+ * @param enabled
+ */
+void btstack_resample_polyphase_set_simd(btstack_resample_polyphase_t * context, bool enabled);
+
+/**
+ * @brief Check if SIMD implementation (SSE2) has been compiled in
+ * @return true if available
+ */
+bool btstack_resample_polyphase_simd_available(void);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+
+#endif
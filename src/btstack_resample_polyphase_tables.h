@@ -0,0 +1,697 @@
+// btstack_resample_polyphase_tables.h generated by tool/resample_polyphase_generator.py - do not edit
+
+#ifndef BTSTACK_RESAMPLE_POLYPHASE_TABLES_H
+#define BTSTACK_RESAMPLE_POLYPHASE_TABLES_H
+
+// low: 16 taps, 32 phases, cutoff 0.400, Kaiser beta 5.0
+static const int16_t btstack_resample_polyphase_coefficients_low[33 * 16] = {
+      -161,    236,      0,   -848,   2394,  -4311,   5928,  26246,   5928,  -4311,   2394,   -848,      0,    236,   -161,     46,
+      -152,    205,     61,   -921,   2405,  -4105,   5098,  26221,   6775,  -4497,   2366,   -768,    -64,    267,   -170,     47,
+      -142,    174,    120,   -985,   2401,  -3881,   4289,  26137,   7638,  -4662,   2322,   -679,   -130,    297,   -178,     47,
+      -132,    143,    175,  -1041,   2382,  -3641,   3504,  25995,   8514,  -4803,   2261,   -582,   -197,    327,   -185,     48,
+      -121,    113,    227,  -1088,   2348,  -3387,   2744,  25802,   9400,  -4919,   2183,   -479,   -266,    356,   -192,     47,
+      -110,     83,    276,  -1126,   2300,  -3122,   2012,  25552,  10292,  -5007,   2088,   -368,   -336,    384,   -197,     47,
+       -99,     54,    321,  -1156,   2240,  -2848,   1309,  25252,  11189,  -5067,   1976,   -251,   -407,    411,   -201,     45,
+       -88,     27,    362,  -1177,   2167,  -2566,    638,  24896,  12086,  -5096,   1847,   -128,   -477,    436,   -203,     44,
+       -77,      0,    399,  -1190,   2083,  -2278,      0,  24493,  12981,  -5093,   1702,      0,   -547,    459,   -205,     41,
+       -66,    -25,    432,  -1195,   1989,  -1987,   -604,  24041,  13871,  -5057,   1540,    133,   -616,    479,   -205,     38,
+       -55,    -49,    461,  -1192,   1885,  -1695,  -1171,  23540,  14752,  -4986,   1362,    269,   -683,    498,   -203,     35,
+       -45,    -71,    485,  -1181,   1773,  -1402,  -1702,  22997,  15621,  -4879,   1168,    408,   -749,    514,   -200,     31,
+       -35,    -92,    505,  -1163,   1654,  -1111,  -2195,  22409,  16475,  -4735,    960,    550,   -812,    527,   -195,     26,
+       -26,   -111,    522,  -1139,   1528,   -824,  -2650,  21781,  17312,  -4554,    739,    693,   -872,    537,   -188,     20,
+       -16,   -129,    534,  -1108,   1396,   -542,  -3066,  21118,  18127,  -4335,    504,    836,   -928,    543,   -180,     14,
+        -8,   -144,    542,  -1071,   1260,   -267,  -3442,  20418,  18918,  -4077,    257,    979,   -980,    546,   -170,      7,
+         0,   -158,    546,  -1028,   1121,      0,  -3779,  19682,  19682,  -3779,      0,   1121,  -1028,    546,   -158,      0,
+         7,   -170,    546,   -980,    979,    257,  -4077,  18918,  20418,  -3442,   -267,   1260,  -1071,    542,   -144,     -8,
+        14,   -180,    543,   -928,    836,    504,  -4335,  18127,  21118,  -3066,   -542,   1396,  -1108,    534,   -129,    -16,
+        20,   -188,    537,   -872,    693,    739,  -4554,  17312,  21781,  -2650,   -824,   1528,  -1139,    522,   -111,    -26,
+        26,   -195,    527,   -812,    550,    960,  -4735,  16475,  22409,  -2195,  -1111,   1654,  -1163,    505,    -92,    -35,
+        31,   -200,    514,   -749,    408,   1168,  -4879,  15621,  22997,  -1702,  -1402,   1773,  -1181,    485,    -71,    -45,
+        35,   -203,    498,   -683,    269,   1362,  -4986,  14752,  23540,  -1171,  -1695,   1885,  -1192,    461,    -49,    -55,
+        38,   -205,    479,   -616,    133,   1540,  -5057,  13871,  24041,   -604,  -1987,   1989,  -1195,    432,    -25,    -66,
+        41,   -205,    459,   -547,      0,   1702,  -5093,  12981,  24493,      0,  -2278,   2083,  -1190,    399,      0,    -77,
+        44,   -203,    436,   -477,   -128,   1847,  -5096,  12086,  24896,    638,  -2566,   2167,  -1177,    362,     27,    -88,
+        45,   -201,    411,   -407,   -251,   1976,  -5067,  11189,  25252,   1309,  -2848,   2240,  -1156,    321,     54,    -99,
+        47,   -197,    384,   -336,   -368,   2088,  -5007,  10292,  25552,   2012,  -3122,   2300,  -1126,    276,     83,   -110,
+        47,   -192,    356,   -266,   -479,   2183,  -4919,   9400,  25802,   2744,  -3387,   2348,  -1088,    227,    113,   -121,
+        48,   -185,    327,   -197,   -582,   2261,  -4803,   8514,  25995,   3504,  -3641,   2382,  -1041,    175,    143,   -132,
+        47,   -178,    297,   -130,   -679,   2322,  -4662,   7638,  26137,   4289,  -3881,   2401,   -985,    120,    174,   -142,
+        47,   -170,    267,    -64,   -768,   2366,  -4497,   6775,  26221,   5098,  -4105,   2405,   -921,     61,    205,   -152,
+        46,   -161,    236,      0,   -848,   2394,  -4311,   5928,  26246,   5928,  -4311,   2394,   -848,      0,    236,   -161,
+};
+
+// medium: 32 taps, 64 phases, cutoff 0.430, Kaiser beta 6.5
+static const int16_t btstack_resample_polyphase_coefficients_medium[65 * 32] = {
+         6,      5,    -38,    101,   -188,    272,   -303,    217,     51,   -542,   1252,  -2119,   3029,  -3834,   4389,  28176,
+      4389,  -3834,   3029,  -2119,   1252,   -542,     51,    217,   -303,    272,   -188,    101,    -38,      5,      6,     -4,
+         5,      6,    -40,    103,   -187,    266,   -289,    192,     85,   -581,   1283,  -2123,   2975,  -3666,   3929,  28170,
+      4857,  -3999,   3079,  -2112,   1219,   -503,     17,    241,   -316,    277,   -188,     99,    -36,      3,      6,     -4,
+         4,      8,    -42,    105,   -187,    260,   -275,    168,    119,   -617,   1311,  -2123,   2916,  -3493,   3476,  28144,
+      5330,  -4159,   3123,  -2100,   1183,   -462,    -18,    265,   -329,    282,   -188,     97,    -34,      2,      7,     -5,
+         3,      9,    -44,    106,   -186,    254,   -260,    144,    152,   -653,   1336,  -2119,   2852,  -3318,   3030,  28104,
+      5811,  -4314,   3163,  -2085,   1144,   -420,    -53,    289,   -342,    286,   -187,     94,    -31,      0,      8,     -5,
+         2,     11,    -46,    107,   -184,    247,   -245,    119,    184,   -687,   1359,  -2111,   2784,  -3139,   2593,  28044,
+      6296,  -4465,   3197,  -2065,   1103,   -376,    -88,    312,   -354,    290,   -186,     92,    -28,     -2,      9,     -5,
+         2,     12,    -48,    108,   -182,    240,   -230,     95,    216,   -719,   1380,  -2100,   2713,  -2958,   2164,  27969,
+      6787,  -4610,   3226,  -2042,   1060,   -332,   -124,    335,   -366,    293,   -185,     89,    -26,     -3,     10,     -6,
+         1,     13,    -49,    109,   -180,    232,   -215,     70,    247,   -750,   1397,  -2084,   2637,  -2774,   1744,  27878,
+      7283,  -4749,   3249,  -2015,   1014,   -286,   -160,    358,   -377,    296,   -183,     86,    -23,     -5,     10,     -6,
+         0,     15,    -51,    110,   -178,    224,   -199,     46,    277,   -779,   1412,  -2066,   2557,  -2588,   1333,  27770,
+      7784,  -4882,   3267,  -1984,    966,   -240,   -195,    380,   -388,    298,   -181,     82,    -20,     -7,     11,     -6,
+         0,     16,    -52,    110,   -175,    216,   -183,     22,    306,   -806,   1424,  -2044,   2474,  -2401,    931,  27642,
+      8288,  -5009,   3280,  -1949,    916,   -192,   -231,    402,   -397,    300,   -179,     79,    -17,     -9,     12,     -6,
+        -1,     17,    -53,    110,   -172,    208,   -167,     -2,    335,   -832,   1434,  -2018,   2387,  -2213,    539,  27501,
+      8796,  -5128,   3286,  -1910,    864,   -144,   -267,    424,   -407,    301,   -176,     75,    -14,    -11,     13,     -7,
+        -2,     18,    -54,    110,   -169,    199,   -151,    -25,    363,   -855,   1441,  -1989,   2297,  -2023,    157,  27340,
+      9307,  -5241,   3287,  -1867,    809,    -95,   -303,    445,   -415,    302,   -173,     71,    -11,    -12,     14,     -7,
+        -2,     19,    -55,    110,   -166,    190,   -135,    -48,    389,   -878,   1445,  -1957,   2204,  -1833,   -215,  27168,
+      9820,  -5346,   3281,  -1820,    753,    -45,   -338,    465,   -424,    302,   -169,     67,     -8,    -14,     15,     -7,
+        -3,     20,    -56,    109,   -162,    181,   -119,    -71,    415,   -898,   1446,  -1922,   2109,  -1643,   -576,  26980,
+     10336,  -5444,   3270,  -1769,    694,      5,   -373,    485,   -431,    301,   -166,     63,     -5,    -16,     15,     -7,
+        -3,     21,    -57,    108,   -158,    171,   -102,    -94,    440,   -916,   1445,  -1883,   2010,  -1453,   -927,  26775,
+     10852,  -5533,   3252,  -1715,    634,     55,   -408,    504,   -437,    301,   -161,     58,     -1,    -18,     16,     -8,
+        -4,     22,    -58,    108,   -154,    162,    -86,   -116,    464,   -933,   1442,  -1842,   1909,  -1263,  -1267,  26553,
+     11371,  -5614,   3229,  -1657,    572,    106,   -442,    522,   -443,    299,   -157,     54,      2,    -20,     17,     -8,
+        -5,     23,    -58,    107,   -149,    152,    -70,   -138,    486,   -948,   1435,  -1798,   1806,  -1074,  -1595,  26321,
+     11889,  -5687,   3199,  -1595,    508,    158,   -476,    539,   -449,    297,   -152,     49,      5,    -22,     18,     -8,
+        -5,     23,    -58,    105,   -145,    142,    -53,   -159,    508,   -961,   1427,  -1751,   1702,   -886,  -1913,  26069,
+     12408,  -5750,   3163,  -1530,    443,    209,   -510,    556,   -453,    294,   -147,     44,      9,    -24,     19,     -8,
+        -6,     24,    -59,    104,   -140,    132,    -37,   -180,    528,   -972,   1416,  -1701,   1595,   -699,  -2219,  25806,
+     12926,  -5804,   3121,  -1461,    376,    261,   -543,    572,   -457,    291,   -141,     39,     12,    -26,     19,     -9,
+        -6,     25,    -59,    102,   -135,    122,    -21,   -200,    548,   -981,   1402,  -1649,   1486,   -514,  -2513,  25524,
+     13444,  -5849,   3072,  -1389,    308,    313,   -575,    587,   -459,    287,   -135,     33,     16,    -27,     20,     -9,
+        -6,     25,    -59,    101,   -130,    111,     -5,   -219,    566,   -989,   1386,  -1594,   1377,   -331,  -2795,  25229,
+     13959,  -5884,   3018,  -1313,    238,    365,   -607,    601,   -461,    283,   -129,     28,     20,    -29,     21,     -9,
+        -7,     26,    -59,     99,   -124,    101,     10,   -238,    583,   -994,   1368,  -1537,   1266,   -150,  -3065,  24922,
+     14473,  -5909,   2957,  -1234,    168,    416,   -637,    614,   -463,    278,   -122,     22,     23,    -31,     21,     -9,
+        -7,     26,    -59,     97,   -119,     91,     26,   -257,    598,   -998,   1347,  -1478,   1154,     29,  -3324,  24602,
+     14985,  -5924,   2890,  -1152,     96,    468,   -667,    626,   -463,    272,   -115,     17,     27,    -33,     22,     -9,
+        -8,     26,    -58,     94,   -113,     80,     41,   -274,    613,  -1000,   1324,  -1417,   1041,    205,  -3570,  24268,
+     15493,  -5928,   2817,  -1067,     24,    519,   -696,    637,   -462,    266,   -108,     11,     31,    -35,     23,     -9,
+        -8,     27,    -58,     92,   -107,     70,     56,   -291,    626,  -1000,   1299,  -1354,    928,    378,  -3804,  23923,
+     15998,  -5921,   2737,   -980,    -50,    569,   -724,    647,   -461,    260,   -101,      5,     34,    -36,     23,     -9,
+        -8,     27,    -57,     90,   -101,     59,     71,   -308,    638,   -998,   1272,  -1289,    815,    547,  -4025,  23562,
+     16499,  -5904,   2652,   -889,   -123,    619,   -751,    656,   -459,    253,    -93,     -1,     38,    -38,     24,    -10,
+        -8,     27,    -57,     87,    -95,     49,     85,   -323,    648,   -995,   1243,  -1223,    701,    713,  -4234,  23197,
+     16995,  -5876,   2560,   -796,   -198,    669,   -777,    664,   -456,    245,    -85,     -7,     41,    -40,     24,    -10,
+        -9,     27,    -56,     84,    -89,     38,     99,   -338,    658,   -989,   1212,  -1155,    588,    876,  -4431,  22811,
+     17487,  -5836,   2463,   -700,   -273,    718,   -802,    671,   -452,    237,    -77,    -13,     45,    -41,     25,    -10,
+        -9,     27,    -55,     82,    -83,     28,    113,   -352,    666,   -982,   1179,  -1086,    474,   1034,  -4616,  22418,
+     17973,  -5785,   2360,   -602,   -348,    766,   -825,    677,   -447,    228,    -68,    -20,     49,    -43,     25,    -10,
+        -9,     27,    -54,     79,    -77,     18,    126,   -365,    672,   -974,   1145,  -1015,    362,   1189,  -4788,  22015,
+     18452,  -5722,   2251,   -501,   -423,    812,   -847,    681,   -442,    218,    -59,    -26,     52,    -45,     26,    -10,
+        -9,     27,    -53,     76,    -71,      8,    139,   -378,    678,   -963,   1108,   -944,    250,   1339,  -4947,  21600,
+     18926,  -5648,   2136,   -399,   -499,    858,   -868,    684,   -435,    209,    -50,    -32,     56,    -46,     26,    -10,
+        -9,     27,    -52,     72,    -64,     -2,    152,   -389,    682,   -951,   1070,   -871,    138,   1484,  -5095,  21179,
+     19392,  -5561,   2016,   -295,   -574,    903,   -888,    686,   -428,    198,    -41,    -39,     59,    -47,     26,    -10,
+       -10,     27,    -51,     69,    -58,    -12,    164,   -400,    685,   -938,   1030,   -798,     28,   1625,  -5230,  20747,
+     19850,  -5463,   1891,   -189,   -649,    947,   -906,    687,   -419,    187,    -32,    -45,     63,    -49,     27,    -10,
+       -10,     27,    -50,     66,    -51,    -22,    176,   -410,    687,   -922,    989,   -724,    -81,   1760,  -5352,  20301,
+     20301,  -5352,   1760,    -81,   -724,    989,   -922,    687,   -410,    176,    -22,    -51,     66,    -50,     27,    -10,
+       -10,     27,    -49,     63,    -45,    -32,    187,   -419,    687,   -906,    947,   -649,   -189,   1891,  -5463,  19850,
+     20747,  -5230,   1625,     28,   -798,   1030,   -938,    685,   -400,    164,    -12,    -58,     69,    -51,     27,    -10,
+       -10,     26,    -47,     59,    -39,    -41,    198,   -428,    686,   -888,    903,   -574,   -295,   2016,  -5561,  19392,
+     21179,  -5095,   1484,    138,   -871,   1070,   -951,    682,   -389,    152,     -2,    -64,     72,    -52,     27,     -9,
+       -10,     26,    -46,     56,    -32,    -50,    209,   -435,    684,   -868,    858,   -499,   -399,   2136,  -5648,  18926,
+     21600,  -4947,   1339,    250,   -944,   1108,   -963,    678,   -378,    139,      8,    -71,     76,    -53,     27,     -9,
+       -10,     26,    -45,     52,    -26,    -59,    218,   -442,    681,   -847,    812,   -423,   -501,   2251,  -5722,  18452,
+     22015,  -4788,   1189,    362,  -1015,   1145,   -974,    672,   -365,    126,     18,    -77,     79,    -54,     27,     -9,
+       -10,     25,    -43,     49,    -20,    -68,    228,   -447,    677,   -825,    766,   -348,   -602,   2360,  -5785,  17973,
+     22418,  -4616,   1034,    474,  -1086,   1179,   -982,    666,   -352,    113,     28,    -83,     82,    -55,     27,     -9,
+       -10,     25,    -41,     45,    -13,    -77,    237,   -452,    671,   -802,    718,   -273,   -700,   2463,  -5836,  17487,
+     22811,  -4431,    876,    588,  -1155,   1212,   -989,    658,   -338,     99,     38,    -89,     84,    -56,     27,     -9,
+       -10,     24,    -40,     41,     -7,    -85,    245,   -456,    664,   -777,    669,   -198,   -796,   2560,  -5876,  16995,
+     23197,  -4234,    713,    701,  -1223,   1243,   -995,    648,   -323,     85,     49,    -95,     87,    -57,     27,     -8,
+       -10,     24,    -38,     38,     -1,    -93,    253,   -459,    656,   -751,    619,   -123,   -889,   2652,  -5904,  16499,
+     23562,  -4025,    547,    815,  -1289,   1272,   -998,    638,   -308,     71,     59,   -101,     90,    -57,     27,     -8,
+        -9,     23,    -36,     34,      5,   -101,    260,   -461,    647,   -724,    569,    -50,   -980,   2737,  -5921,  15998,
+     23923,  -3804,    378,    928,  -1354,   1299,  -1000,    626,   -291,     56,     70,   -107,     92,    -58,     27,     -8,
+        -9,     23,    -35,     31,     11,   -108,    266,   -462,    637,   -696,    519,     24,  -1067,   2817,  -5928,  15493,
+     24268,  -3570,    205,   1041,  -1417,   1324,  -1000,    613,   -274,     41,     80,   -113,     94,    -58,     26,     -8,
+        -9,     22,    -33,     27,     17,   -115,    272,   -463,    626,   -667,    468,     96,  -1152,   2890,  -5924,  14985,
+     24602,  -3324,     29,   1154,  -1478,   1347,   -998,    598,   -257,     26,     91,   -119,     97,    -59,     26,     -7,
+        -9,     21,    -31,     23,     22,   -122,    278,   -463,    614,   -637,    416,    168,  -1234,   2957,  -5909,  14473,
+     24922,  -3065,   -150,   1266,  -1537,   1368,   -994,    583,   -238,     10,    101,   -124,     99,    -59,     26,     -7,
+        -9,     21,    -29,     20,     28,   -129,    283,   -461,    601,   -607,    365,    238,  -1313,   3018,  -5884,  13959,
+     25229,  -2795,   -331,   1377,  -1594,   1386,   -989,    566,   -219,     -5,    111,   -130,    101,    -59,     25,     -6,
+        -9,     20,    -27,     16,     33,   -135,    287,   -459,    587,   -575,    313,    308,  -1389,   3072,  -5849,  13444,
+     25524,  -2513,   -514,   1486,  -1649,   1402,   -981,    548,   -200,    -21,    122,   -135,    102,    -59,     25,     -6,
+        -9,     19,    -26,     12,     39,   -141,    291,   -457,    572,   -543,    261,    376,  -1461,   3121,  -5804,  12926,
+     25806,  -2219,   -699,   1595,  -1701,   1416,   -972,    528,   -180,    -37,    132,   -140,    104,    -59,     24,     -6,
+        -8,     19,    -24,      9,     44,   -147,    294,   -453,    556,   -510,    209,    443,  -1530,   3163,  -5750,  12408,
+     26069,  -1913,   -886,   1702,  -1751,   1427,   -961,    508,   -159,    -53,    142,   -145,    105,    -58,     23,     -5,
+        -8,     18,    -22,      5,     49,   -152,    297,   -449,    539,   -476,    158,    508,  -1595,   3199,  -5687,  11889,
+     26321,  -1595,  -1074,   1806,  -1798,   1435,   -948,    486,   -138,    -70,    152,   -149,    107,    -58,     23,     -5,
+        -8,     17,    -20,      2,     54,   -157,    299,   -443,    522,   -442,    106,    572,  -1657,   3229,  -5614,  11371,
+     26553,  -1267,  -1263,   1909,  -1842,   1442,   -933,    464,   -116,    -86,    162,   -154,    108,    -58,     22,     -4,
+        -8,     16,    -18,     -1,     58,   -161,    301,   -437,    504,   -408,     55,    634,  -1715,   3252,  -5533,  10852,
+     26775,   -927,  -1453,   2010,  -1883,   1445,   -916,    440,    -94,   -102,    171,   -158,    108,    -57,     21,     -3,
+        -7,     15,    -16,     -5,     63,   -166,    301,   -431,    485,   -373,      5,    694,  -1769,   3270,  -5444,  10336,
+     26980,   -576,  -1643,   2109,  -1922,   1446,   -898,    415,    -71,   -119,    181,   -162,    109,    -56,     20,     -3,
+        -7,     15,    -14,     -8,     67,   -169,    302,   -424,    465,   -338,    -45,    753,  -1820,   3281,  -5346,   9820,
+     27168,   -215,  -1833,   2204,  -1957,   1445,   -878,    389,    -48,   -135,    190,   -166,    110,    -55,     19,     -2,
+        -7,     14,    -12,    -11,     71,   -173,    302,   -415,    445,   -303,    -95,    809,  -1867,   3287,  -5241,   9307,
+     27340,    157,  -2023,   2297,  -1989,   1441,   -855,    363,    -25,   -151,    199,   -169,    110,    -54,     18,     -2,
+        -7,     13,    -11,    -14,     75,   -176,    301,   -407,    424,   -267,   -144,    864,  -1910,   3286,  -5128,   8796,
+     27501,    539,  -2213,   2387,  -2018,   1434,   -832,    335,     -2,   -167,    208,   -172,    110,    -53,     17,     -1,
+        -6,     12,     -9,    -17,     79,   -179,    300,   -397,    402,   -231,   -192,    916,  -1949,   3280,  -5009,   8288,
+     27642,    931,  -2401,   2474,  -2044,   1424,   -806,    306,     22,   -183,    216,   -175,    110,    -52,     16,      0,
+        -6,     11,     -7,    -20,     82,   -181,    298,   -388,    380,   -195,   -240,    966,  -1984,   3267,  -4882,   7784,
+     27770,   1333,  -2588,   2557,  -2066,   1412,   -779,    277,     46,   -199,    224,   -178,    110,    -51,     15,      0,
+        -6,     10,     -5,    -23,     86,   -183,    296,   -377,    358,   -160,   -286,   1014,  -2015,   3249,  -4749,   7283,
+     27878,   1744,  -2774,   2637,  -2084,   1397,   -750,    247,     70,   -215,    232,   -180,    109,    -49,     13,      1,
+        -6,     10,     -3,    -26,     89,   -185,    293,   -366,    335,   -124,   -332,   1060,  -2042,   3226,  -4610,   6787,
+     27969,   2164,  -2958,   2713,  -2100,   1380,   -719,    216,     95,   -230,    240,   -182,    108,    -48,     12,      2,
+        -5,      9,     -2,    -28,     92,   -186,    290,   -354,    312,    -88,   -376,   1103,  -2065,   3197,  -4465,   6296,
+     28044,   2593,  -3139,   2784,  -2111,   1359,   -687,    184,    119,   -245,    247,   -184,    107,    -46,     11,      2,
+        -5,      8,      0,    -31,     94,   -187,    286,   -342,    289,    -53,   -420,   1144,  -2085,   3163,  -4314,   5811,
+     28104,   3030,  -3318,   2852,  -2119,   1336,   -653,    152,    144,   -260,    254,   -186,    106,    -44,      9,      3,
+        -5,      7,      2,    -34,     97,   -188,    282,   -329,    265,    -18,   -462,   1183,  -2100,   3123,  -4159,   5330,
+     28144,   3476,  -3493,   2916,  -2123,   1311,   -617,    119,    168,   -275,    260,   -187,    105,    -42,      8,      4,
+        -4,      6,      3,    -36,     99,   -188,    277,   -316,    241,     17,   -503,   1219,  -2112,   3079,  -3999,   4857,
+     28170,   3929,  -3666,   2975,  -2123,   1283,   -581,     85,    192,   -289,    266,   -187,    103,    -40,      6,      5,
+        -4,      6,      5,    -38,    101,   -188,    272,   -303,    217,     51,   -542,   1252,  -2119,   3029,  -3834,   4389,
+     28176,   4389,  -3834,   3029,  -2119,   1252,   -542,     51,    217,   -303,    272,   -188,    101,    -38,      5,      6,
+};
+
+// high: 64 taps, 128 phases, cutoff 0.455, Kaiser beta 8.6
+static const int16_t btstack_resample_polyphase_coefficients_high[129 * 64] = {
+         1,     -2,      4,     -6,     10,    -13,     15,    -14,      9,      3,    -24,     53,    -90,    134,   -179,    218,
+      -242,    241,   -204,    120,     18,   -215,    470,   -777,   1125,  -1494,   1866,  -2215,   2517,  -2751,   2899,  29814,
+      2899,  -2751,   2517,  -2215,   1866,  -1494,   1125,   -777,    470,   -215,     18,    120,   -204,    241,   -242,    218,
+      -179,    134,    -90,     53,    -24,      3,      9,    -14,     15,    -13,     10,     -6,      4,     -2,      1,      0,
+         1,     -2,      4,     -6,     10,    -13,     15,    -14,      8,      5,    -25,     54,    -92,    135,   -179,    217,
+      -239,    236,   -196,    109,     31,   -230,    485,   -790,   1133,  -1496,   1855,  -2186,   2460,  -2642,   2654,  29815,
+      3145,  -2858,   2573,  -2242,   1875,  -1492,   1115,   -764,    455,   -201,      5,    131,   -212,    247,   -245,    219,
+      -179,    133,    -89,     51,    -22,      2,     10,    -15,     15,    -13,     10,     -6,      4,     -2,      1,      0,
+         1,     -2,      4,     -6,     10,    -13,     14,    -13,      7,      6,    -26,     56,    -93,    136,   -179,    215,
+      -236,    230,   -188,     99,     44,   -244,    499,   -803,   1142,  -1496,   1844,  -2156,   2402,  -2534,   2412,  29807,
+      3395,  -2965,   2628,  -2269,   1884,  -1490,   1105,   -750,    440,   -186,     -8,    141,   -220,    252,   -248,    220,
+      -179,    132,    -88,     50,    -21,      1,     10,    -15,     16,    -13,     10,     -6,      4,     -2,      1,      0,
+         1,     -2,      4,     -6,      9,    -12,     14,    -12,      6,      7,    -28,     57,    -94,    137,   -179,    214,
+      -232,    224,   -180,     88,     57,   -258,    513,   -815,   1149,  -1496,   1831,  -2126,   2343,  -2425,   2173,  29793,
+      3646,  -3072,   2682,  -2294,   1892,  -1486,   1095,   -736,    425,   -171,    -21,    152,   -227,    257,   -251,    221,
+      -178,    131,    -86,     48,    -19,      0,     11,    -16,     16,    -13,     10,     -6,      4,     -2,      1,      0,
+         1,     -2,      4,     -6,      9,    -12,     13,    -12,      5,      8,    -29,     59,    -96,    137,   -178,    212,
+      -229,    219,   -171,     77,     69,   -272,    527,   -827,   1156,  -1495,   1818,  -2094,   2283,  -2316,   1936,  29781,
+      3900,  -3178,   2735,  -2319,   1899,  -1482,   1083,   -721,    409,   -156,    -34,    162,   -235,    262,   -254,    222,
+      -178,    130,    -84,     47,    -18,     -1,     12,    -17,     16,    -14,     10,     -6,      4,     -2,      1,      0,
+         1,     -2,      4,     -6,      9,    -12,     13,    -11,      4,      9,    -30,     60,    -97,    138,   -178,    210,
+      -225,    213,   -163,     67,     82,   -286,    541,   -838,   1163,  -1494,   1804,  -2062,   2223,  -2206,   1702,  29754,
+      4156,  -3283,   2787,  -2343,   1905,  -1476,   1072,   -706,    393,   -141,    -47,    173,   -243,    267,   -256,    223,
+      -177,    128,    -83,     45,    -16,     -3,     13,    -17,     17,    -14,     10,     -6,      4,     -2,      1,      0,
+         1,     -2,      4,     -6,      9,    -12,     13,    -10,      3,     10,    -32,     61,    -98,    138,   -178,    208,
+      -221,    207,   -155,     56,     95,   -299,    554,   -849,   1169,  -1491,   1789,  -2029,   2162,  -2096,   1470,  29730,
+      4414,  -3387,   2838,  -2365,   1910,  -1471,   1059,   -691,    377,   -126,    -60,    183,   -250,    272,   -259,    224,
+      -177,    127,    -81,     43,    -15,     -4,     14,    -18,     17,    -14,     10,     -6,      4,     -2,      1,      0,
+         1,     -2,      4,     -6,      9,    -11,     12,    -10,      2,     11,    -33,     63,    -99,    139,   -177,    206,
+      -218,    201,   -146,     45,    107,   -313,    567,   -859,   1174,  -1488,   1774,  -1994,   2100,  -1986,   1241,  29696,
+      4674,  -3490,   2888,  -2386,   1914,  -1464,   1046,   -675,    360,   -111,    -73,    193,   -258,    276,   -261,    224,
+      -176,    126,    -79,     41,    -13,     -5,     15,    -18,     17,    -14,     10,     -6,      4,     -2,      1,      0,
+         1,     -2,      4,     -6,      9,    -11,     12,     -9,      2,     12,    -34,     64,   -100,    139,   -177,    204,
+      -214,    195,   -138,     35,    120,   -326,    579,   -869,   1178,  -1484,   1757,  -1959,   2037,  -1876,   1015,  29658,
+      4936,  -3593,   2936,  -2407,   1917,  -1457,   1033,   -658,    344,    -95,    -86,    204,   -265,    281,   -264,    225,
+      -175,    124,    -78,     40,    -12,     -6,     16,    -19,     18,    -14,     10,     -6,      4,     -2,      1,      0,
+         1,     -2,      4,     -6,      9,    -11,     11,     -9,      1,     14,    -36,     65,   -101,    140,   -176,    202,
+      -210,    189,   -129,     24,    132,   -339,    591,   -878,   1182,  -1480,   1740,  -1924,   1973,  -1766,    792,  29617,
+      5200,  -3694,   2984,  -2426,   1919,  -1448,   1019,   -642,    327,    -80,    -99,    214,   -272,    285,   -266,    225,
+      -175,    123,    -76,     38,    -10,     -7,     17,    -19,     18,    -14,     10,     -6,      4,     -2,      1,      0,
+         1,     -2,      4,     -6,      9,    -11,     11,     -8,      0,     15,    -37,     66,   -102,    140,   -175,    200,
+      -206,    182,   -121,     13,    144,   -351,    603,   -887,   1186,  -1474,   1722,  -1887,   1909,  -1655,    572,  29573,
+      5466,  -3795,   3030,  -2444,   1921,  -1440,   1004,   -625,    310,    -64,   -112,    224,   -279,    290,   -268,    225,
+      -174,    121,    -74,     36,     -9,     -9,     17,    -20,     18,    -15,     10,     -6,      3,     -2,      1,      0,
+         1,     -2,      4,     -6,      9,    -10,     11,     -7,     -1,     16,    -38,     67,   -103,    140,   -174,    198,
+      -201,    176,   -112,      3,    156,   -364,    615,   -896,   1189,  -1468,   1703,  -1850,   1845,  -1545,    354,  29517,
+      5734,  -3894,   3075,  -2461,   1921,  -1430,    989,   -607,    292,    -48,   -125,    234,   -286,    294,   -270,    226,
+      -173,    119,    -72,     34,     -7,    -10,     18,    -21,     19,    -15,     10,     -6,      3,     -2,      0,      0,
+         1,     -2,      4,     -6,      8,    -10,     10,     -7,     -2,     17,    -39,     69,   -104,    140,   -173,    195,
+      -197,    169,   -103,     -8,    168,   -376,    626,   -904,   1191,  -1461,   1683,  -1811,   1780,  -1435,    140,  29460,
+      6004,  -3993,   3119,  -2477,   1920,  -1420,    974,   -590,    275,    -33,   -138,    244,   -293,    298,   -271,    226,
+      -171,    118,    -70,     32,     -6,    -11,     19,    -21,     19,    -15,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -6,      8,    -10,     10,     -6,     -3,     18,    -40,     70,   -104,    140,   -172,    193,
+      -193,    163,    -95,    -18,    180,   -388,    637,   -911,   1192,  -1454,   1662,  -1773,   1714,  -1325,    -72,  29399,
+      6275,  -4090,   3161,  -2491,   1919,  -1408,    957,   -572,    257,    -17,   -151,    254,   -300,    302,   -273,    225,
+      -170,    116,    -68,     31,     -4,    -12,     20,    -22,     19,    -15,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -6,      8,    -10,      9,     -5,     -4,     19,    -41,     71,   -105,    140,   -171,    190,
+      -188,    156,    -86,    -29,    192,   -400,    647,   -918,   1193,  -1446,   1641,  -1733,   1648,  -1215,   -280,  29333,
+      6548,  -4186,   3202,  -2505,   1916,  -1397,    941,   -553,    239,     -1,   -164,    263,   -306,    306,   -274,    225,
+      -169,    114,    -66,     29,     -2,    -14,     21,    -22,     19,    -15,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -6,      8,     -9,      9,     -5,     -4,     20,    -42,     72,   -106,    140,   -170,    188,
+      -184,    150,    -77,    -39,    203,   -412,    657,   -925,   1194,  -1437,   1619,  -1693,   1581,  -1106,   -485,  29264,
+      6822,  -4281,   3241,  -2517,   1913,  -1384,    923,   -535,    221,     15,   -177,    273,   -313,    309,   -276,    225,
+      -168,    112,    -64,     27,     -1,    -15,     22,    -23,     20,    -15,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -6,      8,     -9,      8,     -4,     -5,     21,    -44,     73,   -106,    140,   -169,    185,
+      -179,    143,    -69,    -50,    215,   -423,    667,   -931,   1194,  -1427,   1596,  -1652,   1514,   -996,   -688,  29185,
+      7098,  -4374,   3280,  -2528,   1908,  -1371,    906,   -515,    203,     31,   -190,    282,   -319,    313,   -277,    224,
+      -166,    110,    -62,     25,      1,    -16,     23,    -23,     20,    -15,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -6,      8,     -9,      8,     -3,     -6,     22,    -45,     74,   -107,    140,   -168,    182,
+      -175,    137,    -60,    -60,    226,   -435,    676,   -936,   1193,  -1417,   1573,  -1610,   1446,   -887,   -887,  29105,
+      7376,  -4466,   3316,  -2537,   1903,  -1356,    887,   -496,    185,     47,   -203,    292,   -325,    316,   -278,    224,
+      -165,    108,    -60,     23,      2,    -17,     23,    -24,     20,    -15,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -6,      8,     -9,      8,     -3,     -7,     23,    -46,     74,   -107,    140,   -166,    179,
+      -170,    130,    -51,    -71,    237,   -446,    685,   -942,   1192,  -1406,   1549,  -1568,   1378,   -779,  -1083,  29022,
+      7654,  -4557,   3352,  -2546,   1896,  -1342,    869,   -476,    166,     63,   -216,    301,   -331,    319,   -279,    223,
+      -163,    106,    -58,     21,      4,    -18,     24,    -24,     21,    -15,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -6,      7,     -8,      7,     -2,     -8,     24,    -47,     75,   -108,    139,   -165,    176,
+      -165,    123,    -43,    -81,    248,   -456,    694,   -946,   1190,  -1395,   1524,  -1525,   1310,   -671,  -1275,  28932,
+      7934,  -4646,   3386,  -2553,   1889,  -1326,    849,   -456,    148,     79,   -228,    310,   -337,    322,   -280,    222,
+      -161,    104,    -55,     19,      6,    -20,     25,    -25,     21,    -16,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -6,      7,     -8,      7,     -2,     -9,     25,    -48,     76,   -108,    139,   -163,    173,
+      -160,    116,    -34,    -91,    259,   -467,    702,   -950,   1187,  -1383,   1498,  -1481,   1242,   -563,  -1465,  28837,
+      8215,  -4733,   3418,  -2559,   1880,  -1310,    830,   -436,    129,     95,   -241,    319,   -343,    325,   -280,    222,
+      -159,    101,    -53,     17,      7,    -21,     26,    -25,     21,    -16,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -6,      7,     -8,      6,     -1,     -9,     26,    -49,     77,   -108,    138,   -161,    170,
+      -155,    109,    -25,   -101,    270,   -477,    710,   -954,   1184,  -1370,   1472,  -1437,   1173,   -456,  -1651,  28735,
+      8498,  -4819,   3449,  -2564,   1871,  -1293,    809,   -416,    110,    111,   -253,    328,   -348,    328,   -281,    221,
+      -157,     99,    -51,     15,      9,    -22,     27,    -26,     21,    -16,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -5,      7,     -8,      6,      0,    -10,     27,    -49,     78,   -108,    138,   -160,    167,
+      -150,    102,    -17,   -111,    281,   -487,    718,   -957,   1180,  -1356,   1445,  -1393,   1104,   -349,  -1833,  28629,
+      8781,  -4903,   3478,  -2568,   1860,  -1275,    789,   -395,     91,    127,   -266,    337,   -354,    330,   -281,    219,
+      -155,     97,    -49,     13,     11,    -23,     27,    -26,     21,    -16,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -5,      7,     -7,      5,      0,    -11,     28,    -50,     78,   -109,    137,   -158,    163,
+      -145,     95,     -8,   -121,    291,   -496,    725,   -960,   1176,  -1342,   1418,  -1348,   1035,   -243,  -2013,  28521,
+      9066,  -4986,   3506,  -2570,   1849,  -1257,    767,   -374,     72,    143,   -278,    346,   -359,    333,   -282,    218,
+      -153,     94,    -46,     11,     12,    -24,     28,    -26,     22,    -16,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      4,     -5,      7,     -7,      5,      1,    -12,     28,    -51,     79,   -109,    136,   -156,    160,
+      -140,     88,      1,   -131,    301,   -506,    732,   -962,   1171,  -1327,   1390,  -1302,    965,   -138,  -2189,  28407,
+      9351,  -5066,   3532,  -2571,   1837,  -1238,    746,   -352,     53,    159,   -290,    354,   -364,    335,   -282,    217,
+      -151,     92,    -44,      9,     14,    -26,     29,    -27,     22,    -16,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      3,     -5,      7,     -7,      4,      2,    -12,     29,    -52,     79,   -109,    136,   -154,    156,
+      -135,     81,      9,   -141,    311,   -515,    738,   -964,   1166,  -1312,   1361,  -1256,    896,    -33,  -2361,  28295,
+      9637,  -5145,   3556,  -2571,   1823,  -1218,    724,   -331,     33,    174,   -302,    362,   -369,    337,   -282,    215,
+      -149,     89,    -41,      7,     15,    -27,     30,    -27,     22,    -16,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      3,     -5,      6,     -6,      4,      2,    -13,     30,    -53,     80,   -109,    135,   -152,    153,
+      -129,     74,     18,   -150,    321,   -523,    744,   -965,   1160,  -1296,   1332,  -1210,    827,     71,  -2531,  28170,
+      9924,  -5222,   3579,  -2569,   1809,  -1198,    701,   -309,     14,    190,   -314,    370,   -374,    339,   -281,    214,
+      -147,     87,    -39,      4,     17,    -28,     30,    -28,     22,    -16,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      3,     -5,      6,     -6,      4,      3,    -14,     31,    -54,     80,   -109,    134,   -150,    149,
+      -124,     67,     27,   -160,    331,   -532,    750,   -966,   1153,  -1279,   1302,  -1163,    757,    174,  -2696,  28040,
+     10211,  -5297,   3601,  -2566,   1794,  -1176,    678,   -287,     -5,    206,   -326,    378,   -378,    341,   -281,    212,
+      -144,     84,    -36,      2,     19,    -29,     31,    -28,     22,    -16,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      3,     -5,      6,     -6,      3,      3,    -15,     32,    -54,     81,   -109,    133,   -148,    146,
+      -119,     60,     35,   -169,    340,   -540,    755,   -966,   1146,  -1262,   1272,  -1116,    687,    276,  -2858,  27911,
+     10500,  -5370,   3620,  -2562,   1778,  -1155,    655,   -265,    -25,    222,   -338,    386,   -382,    342,   -281,    210,
+      -142,     82,    -34,      0,     20,    -30,     32,    -28,     22,    -16,     10,     -6,      3,     -1,      0,      0,
+         1,     -2,      3,     -5,      6,     -6,      3,      4,    -15,     33,    -55,     81,   -109,    132,   -146,    142,
+      -113,     53,     44,   -179,    349,   -548,    760,   -966,   1138,  -1244,   1241,  -1068,    618,    377,  -3017,  27770,
+     10788,  -5441,   3638,  -2556,   1761,  -1132,    631,   -242,    -44,    238,   -349,    394,   -387,    344,   -280,    208,
+      -139,     79,    -31,     -2,     22,    -31,     33,    -29,     23,    -16,     10,     -5,      2,     -1,      0,      0,
+         1,     -2,      3,     -5,      6,     -5,      2,      5,    -16,     33,    -56,     82,   -108,    131,   -143,    138,
+      -108,     46,     52,   -188,    359,   -556,    765,   -965,   1130,  -1226,   1210,  -1020,    548,    478,  -3172,  27630,
+     11078,  -5510,   3654,  -2550,   1743,  -1109,    607,   -220,    -64,    253,   -361,    401,   -391,    345,   -279,    206,
+      -136,     76,    -29,     -4,     24,    -32,     33,    -29,     23,    -16,     10,     -5,      2,     -1,      0,      0,
+         1,     -2,      3,     -5,      6,     -5,      2,      5,    -17,     34,    -56,     82,   -108,    130,   -141,    134,
+      -103,     39,     60,   -197,    367,   -563,    769,   -964,   1121,  -1207,   1178,   -972,    479,    577,  -3324,  27485,
+     11367,  -5577,   3668,  -2541,   1724,  -1085,    583,   -197,    -83,    269,   -372,    409,   -394,    346,   -278,    204,
+      -134,     73,    -26,     -6,     25,    -33,     34,    -29,     23,    -16,     10,     -5,      2,     -1,      0,      0,
+         1,     -2,      3,     -5,      5,     -5,      1,      6,    -18,     35,    -57,     82,   -108,    129,   -138,    130,
+       -97,     32,     69,   -206,    376,   -570,    772,   -962,   1112,  -1188,   1146,   -924,    410,    676,  -3472,  27339,
+     11657,  -5642,   3681,  -2532,   1704,  -1061,    558,   -174,   -103,    284,   -383,    416,   -398,    347,   -277,    202,
+      -131,     70,    -24,     -8,     27,    -35,     35,    -30,     23,    -16,     10,     -5,      2,     -1,      0,      0,
+         1,     -2,      3,     -4,      5,     -4,      1,      6,    -18,     35,    -57,     83,   -107,    127,   -136,    126,
+       -92,     25,     77,   -215,    385,   -577,    776,   -960,   1102,  -1168,   1113,   -875,    341,    773,  -3616,  27184,
+     11947,  -5704,   3692,  -2521,   1683,  -1036,    532,   -151,   -123,    300,   -394,    423,   -402,    348,   -276,    200,
+      -128,     67,    -21,    -10,     28,    -36,     35,    -30,     23,    -16,     10,     -5,      2,     -1,      0,      0,
+         1,     -2,      3,     -4,      5,     -4,      0,      7,    -19,     36,    -58,     83,   -107,    126,   -133,    123,
+       -86,     18,     85,   -223,    393,   -583,    778,   -957,   1092,  -1147,   1080,   -826,    272,    869,  -3757,  27024,
+     12238,  -5764,   3701,  -2509,   1661,  -1011,    507,   -127,   -142,    315,   -405,    429,   -405,    348,   -275,    197,
+      -125,     64,    -18,    -13,     30,    -37,     36,    -30,     23,    -16,     10,     -5,      2,      0,      0,      0,
+         1,     -2,      3,     -4,      5,     -4,      0,      7,    -20,     37,    -59,     83,   -107,    125,   -131,    118,
+       -80,     11,     93,   -232,    401,   -589,    781,   -954,   1081,  -1126,   1046,   -777,    203,    964,  -3894,  26868,
+     12528,  -5822,   3708,  -2496,   1638,   -984,    481,   -104,   -162,    330,   -416,    436,   -408,    349,   -273,    195,
+      -122,     61,    -16,    -15,     32,    -38,     36,    -31,     23,    -16,      9,     -5,      2,      0,      0,      0,
+         1,     -2,      3,     -4,      5,     -3,      0,      8,    -20,     37,    -59,     83,   -106,    123,   -128,    114,
+       -75,      4,    101,   -240,    409,   -595,    783,   -951,   1069,  -1105,   1012,   -728,    135,   1058,  -4028,  26700,
+     12819,  -5877,   3714,  -2481,   1615,   -958,    455,    -80,   -181,    345,   -426,    442,   -411,    349,   -272,    192,
+      -119,     58,    -13,    -17,     33,    -39,     37,    -31,     23,    -16,      9,     -5,      2,      0,      0,      0,
+         1,     -2,      3,     -4,      4,     -3,     -1,      9,    -21,     38,    -59,     83,   -105,    122,   -126,    110,
+       -69,     -3,    109,   -249,    416,   -600,    785,   -947,   1058,  -1083,    978,   -678,     66,   1151,  -4158,  26530,
+     13109,  -5930,   3717,  -2465,   1590,   -930,    428,    -57,   -201,    360,   -436,    448,   -413,    349,   -270,    189,
+      -116,     55,    -10,    -19,     35,    -40,     38,    -31,     23,    -16,      9,     -5,      2,      0,      0,      0,
+         1,     -2,      3,     -4,      4,     -3,     -1,      9,    -21,     39,    -60,     83,   -105,    120,   -123,    106,
+       -64,    -10,    117,   -257,    423,   -605,    786,   -942,   1045,  -1061,    943,   -628,     -1,   1243,  -4284,  26357,
+     13399,  -5980,   3719,  -2448,   1565,   -903,    401,    -33,   -220,    375,   -447,    454,   -416,    349,   -268,    186,
+      -112,     52,     -8,    -21,     36,    -41,     38,    -31,     23,    -15,      9,     -5,      2,      0,      0,      0,
+         1,     -2,      3,     -4,      4,     -3,     -2,     10,    -22,     39,    -60,     83,   -104,    118,   -120,    102,
+       -58,    -17,    125,   -265,    431,   -610,    787,   -937,   1032,  -1038,    908,   -579,    -69,   1333,  -4407,  26179,
+     13689,  -6028,   3719,  -2429,   1538,   -874,    374,     -9,   -240,    389,   -456,    460,   -418,    348,   -266,    183,
+      -109,     49,     -5,    -23,     38,    -42,     39,    -32,     23,    -15,      9,     -4,      2,      0,      0,      0,
+         1,     -2,      3,     -4,      4,     -2,     -2,     10,    -23,     40,    -61,     83,   -103,    117,   -117,     98,
+       -52,    -24,    133,   -273,    437,   -615,    787,   -932,   1019,  -1014,    873,   -529,   -136,   1422,  -4526,  25995,
+     13979,  -6074,   3717,  -2409,   1511,   -845,    347,     15,   -259,    404,   -466,    466,   -420,    348,   -264,    180,
+      -106,     46,     -2,    -25,     39,    -43,     39,    -32,     23,    -15,      9,     -4,      2,      0,      0,      0,
+         1,     -2,      3,     -4,      4,     -2,     -2,     11,    -23,     40,    -61,     83,   -103,    115,   -114,     93,
+       -47,    -31,    140,   -280,    444,   -619,    787,   -926,   1005,   -991,    837,   -479,   -203,   1510,  -4641,  25813,
+     14268,  -6116,   3713,  -2388,   1483,   -816,    319,     39,   -278,    418,   -476,    471,   -422,    347,   -262,    177,
+      -102,     43,      1,    -28,     41,    -44,     40,    -32,     23,    -15,      9,     -4,      1,      0,      0,      0,
+         1,     -2,      3,     -4,      3,     -2,     -3,     11,    -24,     41,    -61,     83,   -102,    113,   -111,     89,
+       -41,    -38,    148,   -288,    450,   -623,    787,   -919,    991,   -966,    801,   -429,   -269,   1596,  -4753,  25627,
+     14557,  -6156,   3707,  -2366,   1454,   -786,    291,     63,   -297,    432,   -485,    476,   -424,    346,   -259,    174,
+       -99,     39,      3,    -30,     42,    -45,     40,    -32,     23,    -15,      9,     -4,      1,      0,      0,      0,
+         1,     -2,      3,     -3,      3,     -1,     -3,     12,    -24,     41,    -61,     83,   -101,    112,   -108,     85,
+       -35,    -44,    155,   -295,    456,   -626,    786,   -913,    976,   -942,    765,   -379,   -335,   1681,  -4861,  25430,
+     14845,  -6194,   3700,  -2342,   1424,   -755,    263,     87,   -317,    446,   -494,    481,   -425,    345,   -257,    170,
+       -95,     36,      6,    -32,     44,    -46,     41,    -32,     23,    -15,      8,     -4,      1,      0,      0,      0,
+         1,     -2,      3,     -3,      3,     -1,     -4,     12,    -25,     42,    -62,     82,   -100,    110,   -105,     80,
+       -30,    -51,    163,   -302,    462,   -630,    785,   -906,    961,   -917,    728,   -329,   -400,   1765,  -4965,  25237,
+     15133,  -6228,   3690,  -2317,   1394,   -724,    235,    111,   -336,    460,   -503,    485,   -427,    344,   -254,    167,
+       -92,     33,      9,    -34,     45,    -46,     41,    -33,     23,    -15,      8,     -4,      1,      0,      0,      0,
+         1,     -2,      3,     -3,      3,     -1,     -4,     13,    -25,     42,    -62,     82,    -99,    108,   -102,     76,
+       -24,    -58,    170,   -309,    468,   -632,    784,   -898,    946,   -892,    691,   -279,   -465,   1847,  -5065,  25031,
+     15420,  -6260,   3679,  -2290,   1362,   -693,    206,    135,   -354,    473,   -511,    490,   -428,    343,   -251,    163,
+       -88,     29,     12,    -36,     47,    -47,     42,    -33,     23,    -15,      8,     -4,      1,      0,      0,      0,
+         1,     -2,      3,     -3,      3,     -1,     -4,     13,    -26,     43,    -62,     82,    -98,    106,    -99,     72,
+       -18,    -64,    177,   -316,    473,   -635,    782,   -890,    930,   -866,    654,   -229,   -529,   1927,  -5162,  24830,
+     15706,  -6289,   3665,  -2263,   1330,   -661,    177,    159,   -373,    487,   -520,    494,   -428,    341,   -248,    160,
+       -84,     26,     14,    -38,     48,    -48,     42,    -33,     23,    -15,      8,     -4,      1,      0,     -1,      0,
+         1,     -2,      2,     -3,      3,      0,     -5,     14,    -26,     43,    -62,     82,    -97,    104,    -96,     67,
+       -13,    -71,    184,   -323,    479,   -637,    780,   -881,    913,   -840,    617,   -180,   -593,   2006,  -5255,  24623,
+     15991,  -6315,   3650,  -2234,   1297,   -629,    148,    183,   -392,    500,   -528,    498,   -429,    340,   -245,    156,
+       -80,     22,     17,    -40,     50,    -49,     42,    -33,     23,    -14,      8,     -3,      1,      0,     -1,      0,
+         1,     -2,      2,     -3,      2,      0,     -5,     14,    -27,     43,    -62,     81,    -96,    102,    -93,     63,
+        -7,    -78,    191,   -329,    483,   -639,    777,   -873,    896,   -813,    580,   -130,   -656,   2084,  -5345,  24414,
+     16276,  -6338,   3633,  -2203,   1263,   -596,    119,    207,   -410,    513,   -536,    501,   -429,    338,   -242,    152,
+       -77,     19,     20,    -42,     51,    -50,     43,    -33,     23,    -14,      8,     -3,      1,      0,     -1,      0,
+         1,     -2,      2,     -3,      2,      0,     -6,     14,    -27,     44,    -62,     81,    -95,    100,    -89,     58,
+        -1,    -84,    198,   -336,    488,   -641,    774,   -863,    879,   -787,    542,    -81,   -718,   2160,  -5431,  24202,
+     16559,  -6358,   3614,  -2172,   1229,   -563,     90,    231,   -429,    525,   -544,    505,   -430,    336,   -238,    148,
+       -73,     16,     23,    -44,     52,    -51,     43,    -33,     23,    -14,      7,     -3,      1,      0,     -1,      0,
+         1,     -2,      2,     -3,      2,      1,     -6,     15,    -28,     44,    -62,     80,    -94,     97,    -86,     54,
+         4,    -91,    205,   -342,    492,   -642,    771,   -854,    862,   -760,    504,    -31,   -780,   2234,  -5513,  23985,
+     16841,  -6375,   3593,  -2139,   1193,   -529,     61,    255,   -447,    538,   -551,    508,   -430,    333,   -235,    144,
+       -69,     12,     26,    -46,     54,    -51,     43,    -33,     23,    -14,      7,     -3,      1,      0,     -1,      0,
+         1,     -2,      2,     -3,      2,      1,     -6,     15,    -28,     44,    -62,     80,    -92,     95,    -83,     49,
+        10,    -97,    211,   -348,    497,   -643,    767,   -843,    844,   -733,    467,     18,   -841,   2307,  -5591,  23760,
+     17122,  -6389,   3570,  -2105,   1157,   -495,     31,    279,   -465,    550,   -558,    511,   -429,    331,   -231,    140,
+       -65,      9,     28,    -48,     55,    -52,     44,    -33,     23,    -14,      7,     -3,      0,      1,     -1,      0,
+         1,     -1,      2,     -2,      2,      1,     -7,     16,    -29,     45,    -62,     79,    -91,     93,    -79,     45,
+        15,   -103,    218,   -353,    500,   -644,    763,   -833,    825,   -705,    429,     67,   -901,   2378,  -5666,  23537,
+     17402,  -6400,   3545,  -2070,   1121,   -461,      1,    303,   -483,    562,   -565,    514,   -429,    328,   -227,    136,
+       -61,      5,     31,    -50,     56,    -53,     44,    -33,     22,    -14,      7,     -3,      0,      1,     -1,      0,
+         1,     -1,      2,     -2,      1,      1,     -7,     16,    -29,     45,    -62,     79,    -90,     91,    -76,     40,
+        21,   -110,    224,   -359,    504,   -644,    758,   -822,    807,   -677,    391,    115,   -961,   2447,  -5737,  23310,
+     17680,  -6408,   3518,  -2034,   1083,   -426,    -28,    327,   -500,    574,   -572,    516,   -428,    326,   -223,    131,
+       -57,      2,     34,    -52,     58,    -54,     44,    -33,     22,    -13,      7,     -2,      0,      1,     -1,      0,
+         1,     -1,      2,     -2,      1,      2,     -7,     17,    -29,     45,    -62,     78,    -88,     89,    -73,     36,
+        27,   -116,    230,   -364,    507,   -644,    753,   -811,    787,   -649,    353,    164,  -1019,   2515,  -5804,  23076,
+     17957,  -6413,   3489,  -1997,   1045,   -391,    -58,    351,   -518,    585,   -578,    518,   -427,    323,   -219,    127,
+       -53,     -2,     37,    -54,     59,    -54,     45,    -33,     22,    -13,      7,     -2,      0,      1,     -1,      1,
+         1,     -1,      2,     -2,      1,      2,     -8,     17,    -30,     45,    -62,     77,    -87,     86,    -69,     31,
+        32,   -122,    236,   -369,    510,   -643,    748,   -799,    768,   -621,    315,    212,  -1077,   2581,  -5868,  22846,
+     18233,  -6415,   3458,  -1958,   1006,   -356,    -88,    374,   -535,    597,   -584,    520,   -426,    320,   -215,    123,
+       -48,     -5,     40,    -56,     60,    -55,     45,    -33,     22,    -13,      6,     -2,      0,      1,     -1,      1,
+         1,     -1,      2,     -2,      1,      2,     -8,     17,    -30,     45,    -62,     77,    -86,     84,    -66,     27,
+        37,   -128,    242,   -374,    513,   -643,    742,   -787,    748,   -592,    277,    260,  -1134,   2645,  -5928,  22612,
+     18507,  -6413,   3426,  -1918,    967,   -320,   -118,    398,   -552,    608,   -590,    522,   -425,    316,   -211,    118,
+       -44,     -9,     42,    -58,     61,    -56,     45,    -33,     22,    -13,      6,     -2,      0,      1,     -1,      1,
+         1,     -1,      2,     -2,      1,      3,     -8,     18,    -30,     46,    -62,     76,    -84,     81,    -62,     22,
+        43,   -134,    248,   -379,    516,   -642,    737,   -775,    728,   -563,    239,    307,  -1191,   2708,  -5985,  22368,
+     18779,  -6408,   3391,  -1877,    927,   -284,   -148,    421,   -569,    618,   -595,    523,   -423,    313,   -206,    114,
+       -40,    -13,     45,    -60,     63,    -56,     45,    -33,     22,    -12,      6,     -2,      0,      1,     -1,      1,
+         1,     -1,      2,     -2,      0,      3,     -9,     18,    -31,     46,    -62,     75,    -83,     79,    -59,     18,
+        48,   -140,    254,   -384,    518,   -640,    730,   -762,    708,   -534,    201,    354,  -1246,   2769,  -6038,  22134,
+     19049,  -6400,   3354,  -1835,    886,   -248,   -178,    444,   -585,    629,   -601,    524,   -421,    309,   -202,    109,
+       -36,    -16,     48,    -62,     64,    -57,     45,    -33,     21,    -12,      6,     -2,      0,      1,     -1,      1,
+         1,     -1,      2,     -2,      0,      3,     -9,     18,    -31,     46,    -61,     74,    -81,     77,    -55,     13,
+        54,   -145,    259,   -388,    520,   -639,    724,   -749,    687,   -505,    163,    401,  -1300,   2828,  -6087,  21886,
+     19318,  -6389,   3316,  -1791,    844,   -212,   -208,    468,   -602,    639,   -606,    525,   -419,    306,   -197,    104,
+       -31,    -20,     50,    -64,     65,    -57,     46,    -33,     21,    -12,      5,     -2,      0,      1,     -1,      1,
+         1,     -1,      2,     -1,      0,      3,     -9,     19,    -31,     46,    -61,     74,    -80,     74,    -52,      8,
+        59,   -151,    264,   -392,    522,   -637,    717,   -736,    666,   -476,    125,    448,  -1354,   2885,  -6133,  21641,
+     19585,  -6374,   3276,  -1747,    802,   -175,   -238,    490,   -618,    649,   -610,    526,   -417,    302,   -193,     99,
+       -27,    -23,     53,    -66,     66,    -58,     46,    -33,     21,    -12,      5,     -1,     -1,      1,     -1,      1,
+         1,     -1,      2,     -1,      0,      4,    -10,     19,    -31,     46,    -61,     73,    -78,     71,    -48,      4,
+        64,   -156,    270,   -396,    523,   -635,    709,   -722,    645,   -447,     87,    494,  -1407,   2940,  -6176,  21393,
+     19850,  -6356,   3233,  -1702,    760,   -138,   -268,    513,   -633,    658,   -615,    526,   -415,    298,   -188,     95,
+       -23,    -27,     56,    -68,     67,    -58,     46,    -33,     21,    -11,      5,     -1,     -1,      1,     -1,      1,
+         1,     -1,      2,     -1,      0,      4,    -10,     19,    -32,     46,    -60,     72,    -76,     69,    -45,      0,
+        69,   -162,    275,   -400,    524,   -632,    702,   -708,    624,   -417,     49,    539,  -1458,   2994,  -6214,  21137,
+     20113,  -6335,   3189,  -1655,    717,   -101,   -298,    536,   -649,    668,   -619,    527,   -412,    293,   -183,     90,
+       -18,    -30,     58,    -69,     68,    -59,     46,    -32,     20,    -11,      5,     -1,     -1,      1,     -1,      1,
+         1,     -1,      1,     -1,      0,      4,    -10,     20,    -32,     46,    -60,     71,    -75,     66,    -41,     -5,
+        75,   -167,    279,   -403,    525,   -629,    694,   -694,    602,   -388,     11,    584,  -1509,   3045,  -6250,  20889,
+     20373,  -6310,   3143,  -1607,    673,    -64,   -328,    558,   -664,    677,   -623,    526,   -409,    289,   -178,     85,
+       -14,    -34,     61,    -71,     69,    -59,     46,    -32,     20,    -11,      5,     -1,     -1,      1,     -1,      1,
+         1,     -1,      1,     -1,     -1,      4,    -11,     20,    -32,     46,    -60,     70,    -73,     64,    -38,     -9,
+        80,   -173,    284,   -406,    526,   -626,    685,   -679,    580,   -358,    -26,    629,  -1559,   3095,  -6281,  20634,
+     20632,  -6281,   3095,  -1559,    629,    -26,   -358,    580,   -679,    685,   -626,    526,   -406,    284,   -173,     80,
+        -9,    -38,     64,    -73,     70,    -60,     46,    -32,     20,    -11,      4,     -1,     -1,      1,     -1,      1,
+         1,     -1,      1,     -1,     -1,      5,    -11,     20,    -32,     46,    -59,     69,    -71,     61,    -34,    -14,
+        85,   -178,    289,   -409,    526,   -623,    677,   -664,    558,   -328,    -64,    673,  -1607,   3143,  -6310,  20373,
+     20889,  -6250,   3045,  -1509,    584,     11,   -388,    602,   -694,    694,   -629,    525,   -403,    279,   -167,     75,
+        -5,    -41,     66,    -75,     71,    -60,     46,    -32,     20,    -10,      4,      0,     -1,      1,     -1,      1,
+         1,     -1,      1,     -1,     -1,      5,    -11,     20,    -32,     46,    -59,     68,    -69,     58,    -30,    -18,
+        90,   -183,    293,   -412,    527,   -619,    668,   -649,    536,   -298,   -101,    717,  -1655,   3189,  -6335,  20113,
+     21137,  -6214,   2994,  -1458,    539,     49,   -417,    624,   -708,    702,   -632,    524,   -400,    275,   -162,     69,
+         0,    -45,     69,    -76,     72,    -60,     46,    -32,     19,    -10,      4,      0,     -1,      2,     -1,      1,
+         1,     -1,      1,     -1,     -1,      5,    -11,     21,    -33,     46,    -58,     67,    -68,     56,    -27,    -23,
+        95,   -188,    298,   -415,    526,   -615,    658,   -633,    513,   -268,   -138,    760,  -1702,   3233,  -6356,  19850,
+     21393,  -6176,   2940,  -1407,    494,     87,   -447,    645,   -722,    709,   -635,    523,   -396,    270,   -156,     64,
+         4,    -48,     71,    -78,     73,    -61,     46,    -31,     19,    -10,      4,      0,     -1,      2,     -1,      1,
+         1,     -1,      1,     -1,     -1,      5,    -12,     21,    -33,     46,    -58,     66,    -66,     53,    -23,    -27,
+        99,   -193,    302,   -417,    526,   -610,    649,   -618,    490,   -238,   -175,    802,  -1747,   3276,  -6374,  19585,
+     21641,  -6133,   2885,  -1354,    448,    125,   -476,    666,   -736,    717,   -637,    522,   -392,    264,   -151,     59,
+         8,    -52,     74,    -80,     74,    -61,     46,    -31,     19,     -9,      3,      0,     -1,      2,     -1,      1,
+         1,     -1,      1,      0,     -2,      5,    -12,     21,    -33,     46,    -57,     65,    -64,     50,    -20,    -31,
+       104,   -197,    306,   -419,    525,   -606,    639,   -602,    468,   -208,   -212,    844,  -1791,   3316,  -6389,  19318,
+     21886,  -6087,   2828,  -1300,    401,    163,   -505,    687,   -749,    724,   -639,    520,   -388,    259,   -145,     54,
+        13,    -55,     77,    -81,     74,    -61,     46,    -31,     18,     -9,      3,      0,     -2,      2,     -1,      1,
+         1,     -1,      1,      0,     -2,      6,    -12,     21,    -33,     45,    -57,     64,    -62,     48,    -16,    -36,
+       109,   -202,    309,   -421,    524,   -601,    629,   -585,    444,   -178,   -248,    886,  -1835,   3354,  -6400,  19049,
+     22134,  -6038,   2769,  -1246,    354,    201,   -534,    708,   -762,    730,   -640,    518,   -384,    254,   -140,     48,
+        18,    -59,     79,    -83,     75,    -62,     46,    -31,     18,     -9,      3,      0,     -2,      2,     -1,      1,
+         1,     -1,      1,      0,     -2,      6,    -12,     22,    -33,     45,    -56,     63,    -60,     45,    -13,    -40,
+       114,   -206,    313,   -423,    523,   -595,    618,   -569,    421,   -148,   -284,    927,  -1877,   3391,  -6408,  18779,
+     22368,  -5985,   2708,  -1191,    307,    239,   -563,    728,   -775,    737,   -642,    516,   -379,    248,   -134,     43,
+        22,    -62,     81,    -84,     76,    -62,     46,    -30,     18,     -8,      3,      1,     -2,      2,     -1,      1,
+         1,     -1,      1,      0,     -2,      6,    -13,     22,    -33,     45,    -56,     61,    -58,     42,     -9,    -44,
+       118,   -211,    316,   -425,    522,   -590,    608,   -552,    398,   -118,   -320,    967,  -1918,   3426,  -6413,  18507,
+     22612,  -5928,   2645,  -1134,    260,    277,   -592,    748,   -787,    742,   -643,    513,   -374,    242,   -128,     37,
+        27,    -66,     84,    -86,     77,    -62,     45,    -30,     17,     -8,      2,      1,     -2,      2,     -1,      1,
+         1,     -1,      1,      0,     -2,      6,    -13,     22,    -33,     45,    -55,     60,    -56,     40,     -5,    -48,
+       123,   -215,    320,   -426,    520,   -584,    597,   -535,    374,    -88,   -356,   1006,  -1958,   3458,  -6415,  18233,
+     22846,  -5868,   2581,  -1077,    212,    315,   -621,    768,   -799,    748,   -643,    510,   -369,    236,   -122,     32,
+        31,    -69,     86,    -87,     77,    -62,     45,    -30,     17,     -8,      2,      1,     -2,      2,     -1,      1,
+         1,     -1,      1,      0,     -2,      7,    -13,     22,    -33,     45,    -54,     59,    -54,     37,     -2,    -53,
+       127,   -219,    323,   -427,    518,   -578,    585,   -518,    351,    -58,   -391,   1045,  -1997,   3489,  -6413,  17957,
+     23076,  -5804,   2515,  -1019,    164,    353,   -649,    787,   -811,    753,   -644,    507,   -364,    230,   -116,     27,
+        36,    -73,     89,    -88,     78,    -62,     45,    -29,     17,     -7,      2,      1,     -2,      2,     -1,      1,
+         0,     -1,      1,      0,     -2,      7,    -13,     22,    -33,     44,    -54,     58,    -52,     34,      2,    -57,
+       131,   -223,    326,   -428,    516,   -572,    574,   -500,    327,    -28,   -426,   1083,  -2034,   3518,  -6408,  17680,
+     23310,  -5737,   2447,   -961,    115,    391,   -677,    807,   -822,    758,   -644,    504,   -359,    224,   -110,     21,
+        40,    -76,     91,    -90,     79,    -62,     45,    -29,     16,     -7,      1,      1,     -2,      2,     -1,      1,
+         0,     -1,      1,      0,     -3,      7,    -14,     22,    -33,     44,    -53,     56,    -50,     31,      5,    -61,
+       136,   -227,    328,   -429,    514,   -565,    562,   -483,    303,      1,   -461,   1121,  -2070,   3545,  -6400,  17402,
+     23537,  -5666,   2378,   -901,     67,    429,   -705,    825,   -833,    763,   -644,    500,   -353,    218,   -103,     15,
+        45,    -79,     93,    -91,     79,    -62,     45,    -29,     16,     -7,      1,      2,     -2,      2,     -1,      1,
+         0,     -1,      1,      0,     -3,      7,    -14,     23,    -33,     44,    -52,     55,    -48,     28,      9,    -65,
+       140,   -231,    331,   -429,    511,   -558,    550,   -465,    279,     31,   -495,   1157,  -2105,   3570,  -6389,  17122,
+     23760,  -5591,   2307,   -841,     18,    467,   -733,    844,   -843,    767,   -643,    497,   -348,    211,    -97,     10,
+        49,    -83,     95,    -92,     80,    -62,     44,    -28,     15,     -6,      1,      2,     -3,      2,     -2,      1,
+         0,     -1,      0,      1,     -3,      7,    -14,     23,    -33,     43,    -51,     54,    -46,     26,     12,    -69,
+       144,   -235,    333,   -430,    508,   -551,    538,   -447,    255,     61,   -529,   1193,  -2139,   3593,  -6375,  16841,
+     23985,  -5513,   2234,   -780,    -31,    504,   -760,    862,   -854,    771,   -642,    492,   -342,    205,    -91,      4,
+        54,    -86,     97,    -94,     80,    -62,     44,    -28,     15,     -6,      1,      2,     -3,      2,     -2,      1,
+         0,     -1,      0,      1,     -3,      7,    -14,     23,    -33,     43,    -51,     52,    -44,     23,     16,    -73,
+       148,   -238,    336,   -430,    505,   -544,    525,   -429,    231,     90,   -563,   1229,  -2172,   3614,  -6358,  16559,
+     24202,  -5431,   2160,   -718,    -81,    542,   -787,    879,   -863,    774,   -641,    488,   -336,    198,    -84,     -1,
+        58,    -89,    100,    -95,     81,    -62,     44,    -27,     14,     -6,      0,      2,     -3,      2,     -2,      1,
+         0,     -1,      0,      1,     -3,      8,    -14,     23,    -33,     43,    -50,     51,    -42,     20,     19,    -77,
+       152,   -242,    338,   -429,    501,   -536,    513,   -410,    207,    119,   -596,   1263,  -2203,   3633,  -6338,  16276,
+     24414,  -5345,   2084,   -656,   -130,    580,   -813,    896,   -873,    777,   -639,    483,   -329,    191,    -78,     -7,
+        63,    -93,    102,    -96,     81,    -62,     43,    -27,     14,     -5,      0,      2,     -3,      2,     -2,      1,
+         0,     -1,      0,      1,     -3,      8,    -14,     23,    -33,     42,    -49,     50,    -40,     17,     22,    -80,
+       156,   -245,    340,   -429,    498,   -528,    500,   -392,    183,    148,   -629,   1297,  -2234,   3650,  -6315,  15991,
+     24623,  -5255,   2006,   -593,   -180,    617,   -840,    913,   -881,    780,   -637,    479,   -323,    184,    -71,    -13,
+        67,    -96,    104,    -97,     82,    -62,     43,    -26,     14,     -5,      0,      3,     -3,      2,     -2,      1,
+         0,     -1,      0,      1,     -4,      8,    -15,     23,    -33,     42,    -48,     48,    -38,     14,     26,    -84,
+       160,   -248,    341,   -428,    494,   -520,    487,   -373,    159,    177,   -661,   1330,  -2263,   3665,  -6289,  15706,
+     24830,  -5162,   1927,   -529,   -229,    654,   -866,    930,   -890,    782,   -635,    473,   -316,    177,    -64,    -18,
+        72,    -99,    106,    -98,     82,    -62,     43,    -26,     13,     -4,     -1,      3,     -3,      3,     -2,      1,
+         0,      0,      0,      1,     -4,      8,    -15,     23,    -33,     42,    -47,     47,    -36,     12,     29,    -88,
+       163,   -251,    343,   -428,    490,   -511,    473,   -354,    135,    206,   -693,   1362,  -2290,   3679,  -6260,  15420,
+     25031,  -5065,   1847,   -465,   -279,    691,   -892,    946,   -898,    784,   -632,    468,   -309,    170,    -58,    -24,
+        76,   -102,    108,    -99,     82,    -62,     42,    -25,     13,     -4,     -1,      3,     -3,      3,     -2,      1,
+         0,      0,      0,      1,     -4,      8,    -15,     23,    -33,     41,    -46,     45,    -34,      9,     33,    -92,
+       167,   -254,    344,   -427,    485,   -503,    460,   -336,    111,    235,   -724,   1394,  -2317,   3690,  -6228,  15133,
+     25237,  -4965,   1765,   -400,   -329,    728,   -917,    961,   -906,    785,   -630,    462,   -302,    163,    -51,    -30,
+        80,   -105,    110,   -100,     82,    -62,     42,    -25,     12,     -4,     -1,      3,     -3,      3,     -2,      1,
+         0,      0,      0,      1,     -4,      8,    -15,     23,    -32,     41,    -46,     44,    -32,      6,     36,    -95,
+       170,   -257,    345,   -425,    481,   -494,    446,   -317,     87,    263,   -755,   1424,  -2342,   3700,  -6194,  14845,
+     25430,  -4861,   1681,   -335,   -379,    765,   -942,    976,   -913,    786,   -626,    456,   -295,    155,    -44,    -35,
+        85,   -108,    112,   -101,     83,    -61,     41,    -24,     12,     -3,     -1,      3,     -3,      3,     -2,      1,
+         0,      0,      0,      1,     -4,      9,    -15,     23,    -32,     40,    -45,     42,    -30,      3,     39,    -99,
+       174,   -259,    346,   -424,    476,   -485,    432,   -297,     63,    291,   -786,   1454,  -2366,   3707,  -6156,  14557,
+     25627,  -4753,   1596,   -269,   -429,    801,   -966,    991,   -919,    787,   -623,    450,   -288,    148,    -38,    -41,
+        89,   -111,    113,   -102,     83,    -61,     41,    -24,     11,     -3,     -2,      3,     -4,      3,     -2,      1,
+         0,      0,      0,      1,     -4,      9,    -15,     23,    -32,     40,    -44,     41,    -28,      1,     43,   -102,
+       177,   -262,    347,   -422,    471,   -476,    418,   -278,     39,    319,   -816,   1483,  -2388,   3713,  -6116,  14268,
+     25813,  -4641,   1510,   -203,   -479,    837,   -991,   1005,   -926,    787,   -619,    444,   -280,    140,    -31,    -47,
+        93,   -114,    115,   -103,     83,    -61,     40,    -23,     11,     -2,     -2,      4,     -4,      3,     -2,      1,
+         0,      0,      0,      2,     -4,      9,    -15,     23,    -32,     39,    -43,     39,    -25,     -2,     46,   -106,
+       180,   -264,    348,   -420,    466,   -466,    404,   -259,     15,    347,   -845,   1511,  -2409,   3717,  -6074,  13979,
+     25995,  -4526,   1422,   -136,   -529,    873,  -1014,   1019,   -932,    787,   -615,    437,   -273,    133,    -24,    -52,
+        98,   -117,    117,   -103,     83,    -61,     40,    -23,     10,     -2,     -2,      4,     -4,      3,     -2,      1,
+         0,      0,      0,      2,     -4,      9,    -15,     23,    -32,     39,    -42,     38,    -23,     -5,     49,   -109,
+       183,   -266,    348,   -418,    460,   -456,    389,   -240,     -9,    374,   -874,   1538,  -2429,   3719,  -6028,  13689,
+     26179,  -4407,   1333,    -69,   -579,    908,  -1038,   1032,   -937,    787,   -610,    431,   -265,    125,    -17,    -58,
+       102,   -120,    118,   -104,     83,    -60,     39,    -22,     10,     -2,     -3,      4,     -4,      3,     -2,      1,
+         0,      0,      0,      2,     -5,      9,    -15,     23,    -31,     38,    -41,     36,    -21,     -8,     52,   -112,
+       186,   -268,    349,   -416,    454,   -447,    375,   -220,    -33,    401,   -903,   1565,  -2448,   3719,  -5980,  13399,
+     26357,  -4284,   1243,     -1,   -628,    943,  -1061,   1045,   -942,    786,   -605,    423,   -257,    117,    -10,    -64,
+       106,   -123,    120,   -105,     83,    -60,     39,    -21,      9,     -1,     -3,      4,     -4,      3,     -2,      1,
+         0,      0,      0,      2,     -5,      9,    -16,     23,    -31,     38,    -40,     35,    -19,    -10,     55,   -116,
+       189,   -270,    349,   -413,    448,   -436,    360,   -201,    -57,    428,   -930,   1590,  -2465,   3717,  -5930,  13109,
+     26530,  -4158,   1151,     66,   -678,    978,  -1083,   1058,   -947,    785,   -600,    416,   -249,    109,     -3,    -69,
+       110,   -126,    122,   -105,     83,    -59,     38,    -21,      9,     -1,     -3,      4,     -4,      3,     -2,      1,
+         0,      0,      0,      2,     -5,      9,    -16,     23,    -31,     37,    -39,     33,    -17,    -13,     58,   -119,
+       192,   -272,    349,   -411,    442,   -426,    345,   -181,    -80,    455,   -958,   1615,  -2481,   3714,  -5877,  12819,
+     26700,  -4028,   1058,    135,   -728,   1012,  -1105,   1069,   -951,    783,   -595,    409,   -240,    101,      4,    -75,
+       114,   -128,    123,   -106,     83,    -59,     37,    -20,      8,      0,     -3,      5,     -4,      3,     -2,      1,
+         0,      0,      0,      2,     -5,      9,    -16,     23,    -31,     36,    -38,     32,    -15,    -16,     61,   -122,
+       195,   -273,    349,   -408,    436,   -416,    330,   -162,   -104,    481,   -984,   1638,  -2496,   3708,  -5822,  12528,
+     26868,  -3894,    964,    203,   -777,   1046,  -1126,   1081,   -954,    781,   -589,    401,   -232,     93,     11,    -80,
+       118,   -131,    125,   -107,     83,    -59,     37,    -20,      7,      0,     -4,      5,     -4,      3,     -2,      1,
+         0,      0,      0,      2,     -5,     10,    -16,     23,    -30,     36,    -37,     30,    -13,    -18,     64,   -125,
+       197,   -275,    348,   -405,    429,   -405,    315,   -142,   -127,    507,  -1011,   1661,  -2509,   3701,  -5764,  12238,
+     27024,  -3757,    869,    272,   -826,   1080,  -1147,   1092,   -957,    778,   -583,    393,   -223,     85,     18,    -86,
+       123,   -133,    126,   -107,     83,    -58,     36,    -19,      7,      0,     -4,      5,     -4,      3,     -2,      1,
+         0,      0,     -1,      2,     -5,     10,    -16,     23,    -30,     35,    -36,     28,    -10,    -21,     67,   -128,
+       200,   -276,    348,   -402,    423,   -394,    300,   -123,   -151,    532,  -1036,   1683,  -2521,   3692,  -5704,  11947,
+     27184,  -3616,    773,    341,   -875,   1113,  -1168,   1102,   -960,    776,   -577,    385,   -215,     77,     25,    -92,
+       126,   -136,    127,   -107,     83,    -57,     35,    -18,      6,      1,     -4,      5,     -4,      3,     -2,      1,
+         0,      0,     -1,      2,     -5,     10,    -16,     23,    -30,     35,    -35,     27,     -8,    -24,     70,   -131,
+       202,   -277,    347,   -398,    416,   -383,    284,   -103,   -174,    558,  -1061,   1704,  -2532,   3681,  -5642,  11657,
+     27339,  -3472,    676,    410,   -924,   1146,  -1188,   1112,   -962,    772,   -570,    376,   -206,     69,     32,    -97,
+       130,   -138,    129,   -108,     82,    -57,     35,    -18,      6,      1,     -5,      5,     -5,      3,     -2,      1,
+         0,      0,     -1,      2,     -5,     10,    -16,     23,    -29,     34,    -33,     25,     -6,    -26,     73,   -134,
+       204,   -278,    346,   -394,    409,   -372,    269,    -83,   -197,    583,  -1085,   1724,  -2541,   3668,  -5577,  11367,
+     27485,  -3324,    577,    479,   -972,   1178,  -1207,   1121,   -964,    769,   -563,    367,   -197,     60,     39,   -103,
+       134,   -141,    130,   -108,     82,    -56,     34,    -17,      5,      2,     -5,      6,     -5,      3,     -2,      1,
+         0,      0,     -1,      2,     -5,     10,    -16,     23,    -29,     33,    -32,     24,     -4,    -29,     76,   -136,
+       206,   -279,    345,   -391,    401,   -361,    253,    -64,   -220,    607,  -1109,   1743,  -2550,   3654,  -5510,  11078,
+     27630,  -3172,    478,    548,  -1020,   1210,  -1226,   1130,   -965,    765,   -556,    359,   -188,     52,     46,   -108,
+       138,   -143,    131,   -108,     82,    -56,     33,    -16,      5,      2,     -5,      6,     -5,      3,     -2,      1,
+         0,      0,     -1,      2,     -5,     10,    -16,     23,    -29,     33,    -31,     22,     -2,    -31,     79,   -139,
+       208,   -280,    344,   -387,    394,   -349,    238,    -44,   -242,    631,  -1132,   1761,  -2556,   3638,  -5441,  10788,
+     27770,  -3017,    377,    618,  -1068,   1241,  -1244,   1138,   -966,    760,   -548,    349,   -179,     44,     53,   -113,
+       142,   -146,    132,   -109,     81,    -55,     33,    -15,      4,      3,     -6,      6,     -5,      3,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -16,     22,    -28,     32,    -30,     20,      0,    -34,     82,   -142,
+       210,   -281,    342,   -382,    386,   -338,    222,    -25,   -265,    655,  -1155,   1778,  -2562,   3620,  -5370,  10500,
+     27911,  -2858,    276,    687,  -1116,   1272,  -1262,   1146,   -966,    755,   -540,    340,   -169,     35,     60,   -119,
+       146,   -148,    133,   -109,     81,    -54,     32,    -15,      3,      3,     -6,      6,     -5,      3,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -16,     22,    -28,     31,    -29,     19,      2,    -36,     84,   -144,
+       212,   -281,    341,   -378,    378,   -326,    206,     -5,   -287,    678,  -1176,   1794,  -2566,   3601,  -5297,  10211,
+     28040,  -2696,    174,    757,  -1163,   1302,  -1279,   1153,   -966,    750,   -532,    331,   -160,     27,     67,   -124,
+       149,   -150,    134,   -109,     80,    -54,     31,    -14,      3,      4,     -6,      6,     -5,      3,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -16,     22,    -28,     30,    -28,     17,      4,    -39,     87,   -147,
+       214,   -281,    339,   -374,    370,   -314,    190,     14,   -309,    701,  -1198,   1809,  -2569,   3579,  -5222,   9924,
+     28170,  -2531,     71,    827,  -1210,   1332,  -1296,   1160,   -965,    744,   -523,    321,   -150,     18,     74,   -129,
+       153,   -152,    135,   -109,     80,    -53,     30,    -13,      2,      4,     -6,      6,     -5,      3,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -16,     22,    -27,     30,    -27,     15,      7,    -41,     89,   -149,
+       215,   -282,    337,   -369,    362,   -302,    174,     33,   -331,    724,  -1218,   1823,  -2571,   3556,  -5145,   9637,
+     28295,  -2361,    -33,    896,  -1256,   1361,  -1312,   1166,   -964,    738,   -515,    311,   -141,      9,     81,   -135,
+       156,   -154,    136,   -109,     79,    -52,     29,    -12,      2,      4,     -7,      7,     -5,      3,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -16,     22,    -27,     29,    -26,     14,      9,    -44,     92,   -151,
+       217,   -282,    335,   -364,    354,   -290,    159,     53,   -352,    746,  -1238,   1837,  -2571,   3532,  -5066,   9351,
+     28407,  -2189,   -138,    965,  -1302,   1390,  -1327,   1171,   -962,    732,   -506,    301,   -131,      1,     88,   -140,
+       160,   -156,    136,   -109,     79,    -51,     28,    -12,      1,      5,     -7,      7,     -5,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -16,     22,    -26,     28,    -24,     12,     11,    -46,     94,   -153,
+       218,   -282,    333,   -359,    346,   -278,    143,     72,   -374,    767,  -1257,   1849,  -2570,   3506,  -4986,   9066,
+     28521,  -2013,   -243,   1035,  -1348,   1418,  -1342,   1176,   -960,    725,   -496,    291,   -121,     -8,     95,   -145,
+       163,   -158,    137,   -109,     78,    -50,     28,    -11,      0,      5,     -7,      7,     -5,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -16,     21,    -26,     27,    -23,     11,     13,    -49,     97,   -155,
+       219,   -281,    330,   -354,    337,   -266,    127,     91,   -395,    789,  -1275,   1860,  -2568,   3478,  -4903,   8781,
+     28629,  -1833,   -349,   1104,  -1393,   1445,  -1356,   1180,   -957,    718,   -487,    281,   -111,    -17,    102,   -150,
+       167,   -160,    138,   -108,     78,    -49,     27,    -10,      0,      6,     -8,      7,     -5,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -16,     21,    -26,     27,    -22,      9,     15,    -51,     99,   -157,
+       221,   -281,    328,   -348,    328,   -253,    111,    110,   -416,    809,  -1293,   1871,  -2564,   3449,  -4819,   8498,
+     28735,  -1651,   -456,   1173,  -1437,   1472,  -1370,   1184,   -954,    710,   -477,    270,   -101,    -25,    109,   -155,
+       170,   -161,    138,   -108,     77,    -49,     26,     -9,     -1,      6,     -8,      7,     -6,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -16,     21,    -25,     26,    -21,      7,     17,    -53,    101,   -159,
+       222,   -280,    325,   -343,    319,   -241,     95,    129,   -436,    830,  -1310,   1880,  -2559,   3418,  -4733,   8215,
+     28837,  -1465,   -563,   1242,  -1481,   1498,  -1383,   1187,   -950,    702,   -467,    259,    -91,    -34,    116,   -160,
+       173,   -163,    139,   -108,     76,    -48,     25,     -9,     -2,      7,     -8,      7,     -6,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -16,     21,    -25,     25,    -20,      6,     19,    -55,    104,   -161,
+       222,   -280,    322,   -337,    310,   -228,     79,    148,   -456,    849,  -1326,   1889,  -2553,   3386,  -4646,   7934,
+     28932,  -1275,   -671,   1310,  -1525,   1524,  -1395,   1190,   -946,    694,   -456,    248,    -81,    -43,    123,   -165,
+       176,   -165,    139,   -108,     75,    -47,     24,     -8,     -2,      7,     -8,      7,     -6,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -15,     21,    -24,     24,    -18,      4,     21,    -58,    106,   -163,
+       223,   -279,    319,   -331,    301,   -216,     63,    166,   -476,    869,  -1342,   1896,  -2546,   3352,  -4557,   7654,
+     29022,  -1083,   -779,   1378,  -1568,   1549,  -1406,   1192,   -942,    685,   -446,    237,    -71,    -51,    130,   -170,
+       179,   -166,    140,   -107,     74,    -46,     23,     -7,     -3,      8,     -9,      8,     -6,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -15,     20,    -24,     23,    -17,      2,     23,    -60,    108,   -165,
+       224,   -278,    316,   -325,    292,   -203,     47,    185,   -496,    887,  -1356,   1903,  -2537,   3316,  -4466,   7376,
+     29105,   -887,   -887,   1446,  -1610,   1573,  -1417,   1193,   -936,    676,   -435,    226,    -60,    -60,    137,   -175,
+       182,   -168,    140,   -107,     74,    -45,     22,     -6,     -3,      8,     -9,      8,     -6,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -15,     20,    -23,     23,    -16,      1,     25,    -62,    110,   -166,
+       224,   -277,    313,   -319,    282,   -190,     31,    203,   -515,    906,  -1371,   1908,  -2528,   3280,  -4374,   7098,
+     29185,   -688,   -996,   1514,  -1652,   1596,  -1427,   1194,   -931,    667,   -423,    215,    -50,    -69,    143,   -179,
+       185,   -169,    140,   -106,     73,    -44,     21,     -5,     -4,      8,     -9,      8,     -6,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -15,     20,    -23,     22,    -15,     -1,     27,    -64,    112,   -168,
+       225,   -276,    309,   -313,    273,   -177,     15,    221,   -535,    923,  -1384,   1913,  -2517,   3241,  -4281,   6822,
+     29264,   -485,  -1106,   1581,  -1693,   1619,  -1437,   1194,   -925,    657,   -412,    203,    -39,    -77,    150,   -184,
+       188,   -170,    140,   -106,     72,    -42,     20,     -4,     -5,      9,     -9,      8,     -6,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -15,     19,    -22,     21,    -14,     -2,     29,    -66,    114,   -169,
+       225,   -274,    306,   -306,    263,   -164,     -1,    239,   -553,    941,  -1397,   1916,  -2505,   3202,  -4186,   6548,
+     29333,   -280,  -1215,   1648,  -1733,   1641,  -1446,   1193,   -918,    647,   -400,    192,    -29,    -86,    156,   -188,
+       190,   -171,    140,   -105,     71,    -41,     19,     -4,     -5,      9,    -10,      8,     -6,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -15,     19,    -22,     20,    -12,     -4,     31,    -68,    116,   -170,
+       225,   -273,    302,   -300,    254,   -151,    -17,    257,   -572,    957,  -1408,   1919,  -2491,   3161,  -4090,   6275,
+     29399,    -72,  -1325,   1714,  -1773,   1662,  -1454,   1192,   -911,    637,   -388,    180,    -18,    -95,    163,   -193,
+       193,   -172,    140,   -104,     70,    -40,     18,     -3,     -6,     10,    -10,      8,     -6,      4,     -2,      1,
+         0,      0,     -1,      3,     -6,     10,    -15,     19,    -21,     19,    -11,     -6,     32,    -70,    118,   -171,
+       226,   -271,    298,   -293,    244,   -138,    -33,    275,   -590,    974,  -1420,   1920,  -2477,   3119,  -3993,   6004,
+     29460,    140,  -1435,   1780,  -1811,   1683,  -1461,   1191,   -904,    626,   -376,    168,     -8,   -103,    169,   -197,
+       195,   -173,    140,   -104,     69,    -39,     17,     -2,     -7,     10,    -10,      8,     -6,      4,     -2,      1,
+         0,      0,     -2,      3,     -6,     10,    -15,     19,    -21,     18,    -10,     -7,     34,    -72,    119,   -173,
+       226,   -270,    294,   -286,    234,   -125,    -48,    292,   -607,    989,  -1430,   1921,  -2461,   3075,  -3894,   5734,
+     29517,    354,  -1545,   1845,  -1850,   1703,  -1468,   1189,   -896,    615,   -364,    156,      3,   -112,    176,   -201,
+       198,   -174,    140,   -103,     67,    -38,     16,     -1,     -7,     11,    -10,      9,     -6,      4,     -2,      1,
+         0,      1,     -2,      3,     -6,     10,    -15,     18,    -20,     17,     -9,     -9,     36,    -74,    121,   -174,
+       225,   -268,    290,   -279,    224,   -112,    -64,    310,   -625,   1004,  -1440,   1921,  -2444,   3030,  -3795,   5466,
+     29573,    572,  -1655,   1909,  -1887,   1722,  -1474,   1186,   -887,    603,   -351,    144,     13,   -121,    182,   -206,
+       200,   -175,    140,   -102,     66,    -37,     15,      0,     -8,     11,    -11,      9,     -6,      4,     -2,      1,
+         0,      1,     -2,      4,     -6,     10,    -14,     18,    -19,     17,     -7,    -10,     38,    -76,    123,   -175,
+       225,   -266,    285,   -272,    214,    -99,    -80,    327,   -642,   1019,  -1448,   1919,  -2426,   2984,  -3694,   5200,
+     29617,    792,  -1766,   1973,  -1924,   1740,  -1480,   1182,   -878,    591,   -339,    132,     24,   -129,    189,   -210,
+       202,   -176,    140,   -101,     65,    -36,     14,      1,     -9,     11,    -11,      9,     -6,      4,     -2,      1,
+         0,      1,     -2,      4,     -6,     10,    -14,     18,    -19,     16,     -6,    -12,     40,    -78,    124,   -175,
+       225,   -264,    281,   -265,    204,    -86,    -95,    344,   -658,   1033,  -1457,   1917,  -2407,   2936,  -3593,   4936,
+     29658,   1015,  -1876,   2037,  -1959,   1757,  -1484,   1178,   -869,    579,   -326,    120,     35,   -138,    195,   -214,
+       204,   -177,    139,   -100,     64,    -34,     12,      2,     -9,     12,    -11,      9,     -6,      4,     -2,      1,
+         0,      1,     -2,      4,     -6,     10,    -14,     17,    -18,     15,     -5,    -13,     41,    -79,    126,   -176,
+       224,   -261,    276,   -258,    193,    -73,   -111,    360,   -675,   1046,  -1464,   1914,  -2386,   2888,  -3490,   4674,
+     29696,   1241,  -1986,   2100,  -1994,   1774,  -1488,   1174,   -859,    567,   -313,    107,     45,   -146,    201,   -218,
+       206,   -177,    139,    -99,     63,    -33,     11,      2,    -10,     12,    -11,      9,     -6,      4,     -2,      1,
+         0,      1,     -2,      4,     -6,     10,    -14,     17,    -18,     14,     -4,    -15,     43,    -81,    127,   -177,
+       224,   -259,    272,   -250,    183,    -60,   -126,    377,   -691,   1059,  -1471,   1910,  -2365,   2838,  -3387,   4414,
+     29730,   1470,  -2096,   2162,  -2029,   1789,  -1491,   1169,   -849,    554,   -299,     95,     56,   -155,    207,   -221,
+       208,   -178,    138,    -98,     61,    -32,     10,      3,    -10,     13,    -12,      9,     -6,      4,     -2,      1,
+         0,      1,     -2,      4,     -6,     10,    -14,     17,    -17,     13,     -3,    -16,     45,    -83,    128,   -177,
+       223,   -256,    267,   -243,    173,    -47,   -141,    393,   -706,   1072,  -1476,   1905,  -2343,   2787,  -3283,   4156,
+     29754,   1702,  -2206,   2223,  -2062,   1804,  -1494,   1163,   -838,    541,   -286,     82,     67,   -163,    213,   -225,
+       210,   -178,    138,    -97,     60,    -30,      9,      4,    -11,     13,    -12,      9,     -6,      4,     -2,      1,
+         0,      1,     -2,      4,     -6,     10,    -14,     16,    -17,     12,     -1,    -18,     47,    -84,    130,   -178,
+       222,   -254,    262,   -235,    162,    -34,   -156,    409,   -721,   1083,  -1482,   1899,  -2319,   2735,  -3178,   3900,
+     29781,   1936,  -2316,   2283,  -2094,   1818,  -1495,   1156,   -827,    527,   -272,     69,     77,   -171,    219,   -229,
+       212,   -178,    137,    -96,     59,    -29,      8,      5,    -12,     13,    -12,      9,     -6,      4,     -2,      1,
+         0,      1,     -2,      4,     -6,     10,    -13,     16,    -16,     11,      0,    -19,     48,    -86,    131,   -178,
+       221,   -251,    257,   -227,    152,    -21,   -171,    425,   -736,   1095,  -1486,   1892,  -2294,   2682,  -3072,   3646,
+     29793,   2173,  -2425,   2343,  -2126,   1831,  -1496,   1149,   -815,    513,   -258,     57,     88,   -180,    224,   -232,
+       214,   -179,    137,    -94,     57,    -28,      7,      6,    -12,     14,    -12,      9,     -6,      4,     -2,      1,
+         0,      1,     -2,      4,     -6,     10,    -13,     16,    -15,     10,      1,    -21,     50,    -88,    132,   -179,
+       220,   -248,    252,   -220,    141,     -8,   -186,    440,   -750,   1105,  -1490,   1884,  -2269,   2628,  -2965,   3395,
+     29807,   2412,  -2534,   2402,  -2156,   1844,  -1496,   1142,   -803,    499,   -244,     44,     99,   -188,    230,   -236,
+       215,   -179,    136,    -93,     56,    -26,      6,      7,    -13,     14,    -13,     10,     -6,      4,     -2,      1,
+         0,      1,     -2,      4,     -6,     10,    -13,     15,    -15,     10,      2,    -22,     51,    -89,    133,   -179,
+       219,   -245,    247,   -212,    131,      5,   -201,    455,   -764,   1115,  -1492,   1875,  -2242,   2573,  -2858,   3145,
+     29815,   2654,  -2642,   2460,  -2186,   1855,  -1496,   1133,   -790,    485,   -230,     31,    109,   -196,    236,   -239,
+       217,   -179,    135,    -92,     54,    -25,      5,      8,    -14,     15,    -13,     10,     -6,      4,     -2,      1,
+         0,      1,     -2,      4,     -6,     10,    -13,     15,    -14,      9,      3,    -24,     53,    -90,    134,   -179,
+       218,   -242,    241,   -204,    120,     18,   -215,    470,   -777,   1125,  -1494,   1866,  -2215,   2517,  -2751,   2899,
+     29814,   2899,  -2751,   2517,  -2215,   1866,  -1494,   1125,   -777,    470,   -215,     18,    120,   -204,    241,   -242,
+       218,   -179,    134,    -90,     53,    -24,      3,      9,    -14,     15,    -13,     10,     -6,      4,     -2,      1,
+};
+
+#endif
@@ -50,6 +50,7 @@
 #include "btstack_util.h"
 
 #include <inttypes.h>
+#include <string.h>
 
 static const btstack_run_loop_t * the_run_loop = NULL;
 
@@ -64,14 +65,179 @@ btstack_linked_list_t  btstack_run_loop_base_timers;
 btstack_linked_list_t  btstack_run_loop_base_data_sources;
 btstack_linked_list_t  btstack_run_loop_base_callbacks;
 
+#ifdef ENABLE_RUN_LOOP_PROFILING
+
+#ifndef MAX_NR_RUN_LOOP_PROFILING_ENTRIES
+#define MAX_NR_RUN_LOOP_PROFILING_ENTRIES 16
+#endif
+
+// durations below 16 us go into first bucket
+#define BTSTACK_RUN_LOOP_PROFILING_FIRST_BUCKET_US 16u
+
+// handlers that do not fit into the table are collected in an additional entry
+static btstack_run_loop_profiling_entry_t btstack_run_loop_profiling_entries[MAX_NR_RUN_LOOP_PROFILING_ENTRIES + 1];
+static uint16_t                           btstack_run_loop_profiling_num_entries;
+static btstack_run_loop_profiling_stats_t btstack_run_loop_profiling_stats;
+static uint32_t (*btstack_run_loop_profiling_get_time_us)(void);
+static btstack_timer_source_t             btstack_run_loop_profiling_dump_timer;
+static uint32_t                           btstack_run_loop_profiling_dump_interval_ms;
+
+static uint32_t btstack_run_loop_profiling_now_us(void){
+    if (btstack_run_loop_profiling_get_time_us != NULL){
+        return (*btstack_run_loop_profiling_get_time_us)();
+    }
+    if (the_run_loop != NULL){
+        return the_run_loop->get_time_ms() * 1000u;
+    }
+    return 0;
+}
+
+// bucket 0 for value < first_limit, then one bucket per power of two
+static uint8_t btstack_run_loop_profiling_bucket(uint32_t value, uint32_t first_limit){
+    uint8_t bucket = 0;
+    uint32_t limit = first_limit;
+    while ((value >= limit) && (bucket < (BTSTACK_RUN_LOOP_PROFILING_NUM_BUCKETS - 1u))){
+        bucket++;
+        limit <<= 1;
+    }
+    return bucket;
+}
+
+static btstack_run_loop_profiling_entry_t * btstack_run_loop_profiling_get_entry_for_handler(btstack_run_loop_profiling_type_t type, btstack_run_loop_profiling_handler_t handler){
+    btstack_run_loop_profiling_entry_t * entry;
+    uint16_t i;
+    for (i = 0; i < btstack_run_loop_profiling_num_entries; i++){
+        entry = &btstack_run_loop_profiling_entries[i];
+        if ((entry->handler == handler) && (entry->type == type)){
+            return entry;
+        }
+    }
+    if (btstack_run_loop_profiling_num_entries < MAX_NR_RUN_LOOP_PROFILING_ENTRIES){
+        entry = &btstack_run_loop_profiling_entries[btstack_run_loop_profiling_num_entries++];
+        memset(entry, 0, sizeof(btstack_run_loop_profiling_entry_t));
+        entry->handler = handler;
+        entry->type = type;
+        return entry;
+    }
+    // table full, collect all other handlers in additional entry after the table
+    entry = &btstack_run_loop_profiling_entries[MAX_NR_RUN_LOOP_PROFILING_ENTRIES];
+    if (btstack_run_loop_profiling_num_entries == MAX_NR_RUN_LOOP_PROFILING_ENTRIES){
+        btstack_run_loop_profiling_num_entries++;
+        memset(entry, 0, sizeof(btstack_run_loop_profiling_entry_t));
+        entry->handler = NULL;
+        entry->type = BTSTACK_RUN_LOOP_PROFILING_TYPE_OTHER;
+    }
+    return entry;
+}
+
+static btstack_run_loop_profiling_entry_t * btstack_run_loop_profiling_record(btstack_run_loop_profiling_type_t type, btstack_run_loop_profiling_handler_t handler, uint32_t start_us){
+    uint32_t duration_us = btstack_run_loop_profiling_now_us() - start_us;
+    btstack_run_loop_profiling_entry_t * entry = btstack_run_loop_profiling_get_entry_for_handler(type, handler);
+    entry->count++;
+    entry->total_us += duration_us;
+    entry->max_us = btstack_max(entry->max_us, duration_us);
+    entry->histogram[btstack_run_loop_profiling_bucket(duration_us, BTSTACK_RUN_LOOP_PROFILING_FIRST_BUCKET_US)]++;
+    return entry;
+}
+
+static void btstack_run_loop_profiling_update_max(uint16_t * max_value, int value){
+    if (value > (int) *max_value){
+        *max_value = (uint16_t) btstack_min((uint32_t) value, 0xffffu);
+    }
+}
+
+static void btstack_run_loop_profiling_process_timer(btstack_timer_source_t * timer, uint32_t now){
+    // timer might get re-used by its handler
+    btstack_run_loop_profiling_handler_t handler = (btstack_run_loop_profiling_handler_t) timer->process;
+    uint32_t lateness = (uint32_t) btstack_time_delta(now, (uint32_t) timer->timeout);
+    uint32_t start_us = btstack_run_loop_profiling_now_us();
+    timer->process(timer);
+    btstack_run_loop_profiling_entry_t * entry = btstack_run_loop_profiling_record(BTSTACK_RUN_LOOP_PROFILING_TYPE_TIMER, handler, start_us);
+    entry->max_lateness = btstack_max(entry->max_lateness, lateness);
+    btstack_run_loop_profiling_stats.max_timer_lateness = btstack_max(btstack_run_loop_profiling_stats.max_timer_lateness, lateness);
+    btstack_run_loop_profiling_stats.timer_lateness_histogram[btstack_run_loop_profiling_bucket(lateness, 1)]++;
+}
+
+static void btstack_run_loop_profiling_dump_histogram(const char * name, const uint32_t * histogram){
+    hci_dump_log(HCI_DUMP_LOG_LEVEL_INFO, "RL profiling: %s histogram %" PRIu32 " %" PRIu32 " %" PRIu32 " %" PRIu32 " %" PRIu32 " %" PRIu32
+                 " %" PRIu32 " %" PRIu32 " %" PRIu32 " %" PRIu32 " %" PRIu32 " %" PRIu32, name,
+                 histogram[0], histogram[1], histogram[2], histogram[3], histogram[4],  histogram[5],
+                 histogram[6], histogram[7], histogram[8], histogram[9], histogram[10], histogram[11]);
+}
+
+static void btstack_run_loop_profiling_dump_timer_handler(btstack_timer_source_t * timer){
+    btstack_run_loop_profiling_dump();
+    btstack_run_loop_set_timer(timer, btstack_run_loop_profiling_dump_interval_ms);
+    btstack_run_loop_add_timer(timer);
+}
+
+void btstack_run_loop_profiling_set_time_us_callback(uint32_t (*get_time_us)(void)){
+    btstack_run_loop_profiling_get_time_us = get_time_us;
+}
+
+void btstack_run_loop_profiling_reset(void){
+    btstack_run_loop_profiling_num_entries = 0;
+    memset(&btstack_run_loop_profiling_stats, 0, sizeof(btstack_run_loop_profiling_stats_t));
+}
+
+uint16_t btstack_run_loop_profiling_get_num_entries(void){
+    return btstack_run_loop_profiling_num_entries;
+}
+
+const btstack_run_loop_profiling_entry_t * btstack_run_loop_profiling_get_entry(uint16_t index){
+    if (index >= btstack_run_loop_profiling_num_entries){
+        return NULL;
+    }
+    return &btstack_run_loop_profiling_entries[index];
+}
+
+const btstack_run_loop_profiling_stats_t * btstack_run_loop_profiling_get_stats(void){
+    return &btstack_run_loop_profiling_stats;
+}
+
+void btstack_run_loop_profiling_dump(void){
+    static const char * type_names[] = { "timer", "data source", "callback", "other" };
+    const btstack_run_loop_profiling_stats_t * stats = &btstack_run_loop_profiling_stats;
+    hci_dump_log(HCI_DUMP_LOG_LEVEL_INFO, "RL profiling: max timers %u, max expired timers %u, max data sources %u, max callbacks %u, max timer lateness %" PRIu32,
+                 stats->max_timers, stats->max_expired_timers, stats->max_data_sources, stats->max_callbacks, stats->max_timer_lateness);
+    btstack_run_loop_profiling_dump_histogram("timer lateness", stats->timer_lateness_histogram);
+    uint16_t i;
+    for (i = 0; i < btstack_run_loop_profiling_num_entries; i++){
+        const btstack_run_loop_profiling_entry_t * entry = &btstack_run_loop_profiling_entries[i];
+        uint32_t avg_us = (uint32_t) (entry->total_us / entry->count);
+        hci_dump_log(HCI_DUMP_LOG_LEVEL_INFO, "RL profiling: %s %p: count %" PRIu32 ", avg %" PRIu32 " us, max %" PRIu32 " us, max lateness %" PRIu32,
+                     type_names[entry->type], (void *) (uintptr_t) entry->handler, entry->count, avg_us, entry->max_us, entry->max_lateness);
+        btstack_run_loop_profiling_dump_histogram(type_names[entry->type], entry->histogram);
+    }
+}
+
+void btstack_run_loop_profiling_set_dump_interval(uint32_t interval_ms){
+    btstack_run_loop_remove_timer(&btstack_run_loop_profiling_dump_timer);
+    btstack_run_loop_profiling_dump_interval_ms = interval_ms;
+    if (interval_ms == 0){
+        return;
+    }
+    btstack_run_loop_set_timer_handler(&btstack_run_loop_profiling_dump_timer, &btstack_run_loop_profiling_dump_timer_handler);
+    btstack_run_loop_set_timer(&btstack_run_loop_profiling_dump_timer, interval_ms);
+    btstack_run_loop_add_timer(&btstack_run_loop_profiling_dump_timer);
+}
+
+#endif
+
 void btstack_run_loop_base_init(void){
     btstack_run_loop_base_timers = NULL;
     btstack_run_loop_base_data_sources = NULL;
     btstack_run_loop_base_callbacks = NULL;
+#ifdef ENABLE_RUN_LOOP_PROFILING
+    btstack_run_loop_profiling_reset();
+#endif
 }
 
 void btstack_run_loop_base_add_data_source(btstack_data_source_t * data_source){
     btstack_linked_list_add(&btstack_run_loop_base_data_sources, (btstack_linked_item_t *) data_source);
+#ifdef ENABLE_RUN_LOOP_PROFILING
+    btstack_run_loop_profiling_update_max(&btstack_run_loop_profiling_stats.max_data_sources, btstack_linked_list_count(&btstack_run_loop_base_data_sources));
+#endif
 }
 
 bool btstack_run_loop_base_remove_data_source(btstack_data_source_t * data_source){
@@ -117,17 +283,29 @@ void btstack_run_loop_base_add_timer(btstack_timer_source_t * timer){
     }
     timer->item.next = it->next;
     it->next = (btstack_linked_item_t *) timer;
+#ifdef ENABLE_RUN_LOOP_PROFILING
+    btstack_run_loop_profiling_update_max(&btstack_run_loop_profiling_stats.max_timers, btstack_linked_list_count(&btstack_run_loop_base_timers));
+#endif
 }
 
 void btstack_run_loop_base_process_timers(uint32_t now){
+#ifdef ENABLE_RUN_LOOP_PROFILING
+    int num_expired_timers = 0;
+#endif
     // process timers, exit when timeout is in the future
     while (btstack_run_loop_base_timers) {
         btstack_timer_source_t * timer = (btstack_timer_source_t *) btstack_run_loop_base_timers;
         int32_t delta = btstack_time_delta(timer->timeout, now);
         if (delta > 0) break;
         btstack_run_loop_base_remove_timer(timer);
-        timer->process(timer);
+#ifdef ENABLE_RUN_LOOP_PROFILING
+        num_expired_timers++;
+#endif
+        btstack_run_loop_base_process_timer(timer, now);
     }
+#ifdef ENABLE_RUN_LOOP_PROFILING
+    btstack_run_loop_profiling_update_max(&btstack_run_loop_profiling_stats.max_expired_timers, num_expired_timers);
+#endif
 }
 
 void btstack_run_loop_base_dump_timer(void){
@@ -163,13 +341,16 @@ void btstack_run_loop_base_poll_data_sources(void){
     for (ds = (btstack_data_source_t *) btstack_run_loop_base_data_sources; ds != NULL ; ds = next){
         next = (btstack_data_source_t *) ds->item.next; // cache pointer to next data_source to allow data source to remove itself
         if (ds->flags & DATA_SOURCE_CALLBACK_POLL){
-            ds->process(ds, DATA_SOURCE_CALLBACK_POLL);
+            btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_POLL);
         }
     }
 }
 
 void btstack_run_loop_base_add_callback(btstack_context_callback_registration_t * callback_registration){
     btstack_linked_list_add_tail(&btstack_run_loop_base_callbacks, (btstack_linked_item_t *) callback_registration);
+#ifdef ENABLE_RUN_LOOP_PROFILING
+    btstack_run_loop_profiling_update_max(&btstack_run_loop_profiling_stats.max_callbacks, btstack_linked_list_count(&btstack_run_loop_base_callbacks));
+#endif
 }
 
 
@@ -179,10 +360,41 @@ void btstack_run_loop_base_execute_callbacks(void){
         if (callback_registration == NULL){
             break;
         }
-        (*callback_registration->callback)(callback_registration->context);
+        btstack_run_loop_base_execute_callback(callback_registration);
     }
 }
 
+void btstack_run_loop_base_process_timer(btstack_timer_source_t * timer, uint32_t now){
+#ifdef ENABLE_RUN_LOOP_PROFILING
+    btstack_run_loop_profiling_process_timer(timer, now);
+#else
+    UNUSED(now);
+    timer->process(timer);
+#endif
+}
+
+void btstack_run_loop_base_process_data_source(btstack_data_source_t * data_source, btstack_data_source_callback_type_t callback_type){
+#ifdef ENABLE_RUN_LOOP_PROFILING
+    btstack_run_loop_profiling_handler_t handler = (btstack_run_loop_profiling_handler_t) data_source->process;
+    uint32_t start_us = btstack_run_loop_profiling_now_us();
+    data_source->process(data_source, callback_type);
+    (void) btstack_run_loop_profiling_record(BTSTACK_RUN_LOOP_PROFILING_TYPE_DATA_SOURCE, handler, start_us);
+#else
+    data_source->process(data_source, callback_type);
+#endif
+}
+
+void btstack_run_loop_base_execute_callback(btstack_context_callback_registration_t * callback_registration){
+#ifdef ENABLE_RUN_LOOP_PROFILING
+    btstack_run_loop_profiling_handler_t handler = (btstack_run_loop_profiling_handler_t) callback_registration->callback;
+    uint32_t start_us = btstack_run_loop_profiling_now_us();
+    (*callback_registration->callback)(callback_registration->context);
+    (void) btstack_run_loop_profiling_record(BTSTACK_RUN_LOOP_PROFILING_TYPE_CALLBACK, handler, start_us);
+#else
+    (*callback_registration->callback)(callback_registration->context);
+#endif
+}
+
 
 /**
  * BTstack Run Loop Implementation, mainly dispatches to port-specific implementation
@@ -211,6 +211,117 @@ void btstack_run_loop_base_add_callback(btstack_context_callback_registration_t
  */
 void btstack_run_loop_base_execute_callbacks(void);
 
+/**
+ * @brief Call process function of expired timer. Used by run loop implementations that do not use
+ *        btstack_run_loop_base_process_timers, allows to measure callback duration with ENABLE_RUN_LOOP_PROFILING
+ * @param timer
+ * @param now
+ */
+void btstack_run_loop_base_process_timer(btstack_timer_source_t * timer, uint32_t now);
+
+/**
+ * @brief Call process function of data source for given callback type. Used by run loop implementations to dispatch
+ *        READ and WRITE callbacks, allows to measure callback duration with ENABLE_RUN_LOOP_PROFILING
+ * @param data_source
+ * @param callback_type
+ */
+void btstack_run_loop_base_process_data_source(btstack_data_source_t * data_source, btstack_data_source_callback_type_t callback_type);
+
+/**
+ * @brief Call registered function with its context. Used by run loop implementations that manage the list of callbacks
+ *        themselves, allows to measure callback duration with ENABLE_RUN_LOOP_PROFILING
+ * @param callback_registration
+ */
+void btstack_run_loop_base_execute_callback(btstack_context_callback_registration_t * callback_registration);
+
+
+#ifdef ENABLE_RUN_LOOP_PROFILING
+
+/*
+ *  Run Loop Profiling
+ *  Collects duration histograms per timer, data source and callback handler, timer lateness and queue depths
+ */
+
+// number of histogram buckets. Durations: bucket 0 < 16 us, bucket n in [8 << n, 16 << n) us, last bucket >= 16384 us
+// Timer lateness: bucket 0 = on time, bucket n in [1 << (n-1), 1 << n) time units, last bucket >= 1024 time units
+#define BTSTACK_RUN_LOOP_PROFILING_NUM_BUCKETS 12
+
+typedef enum {
+    BTSTACK_RUN_LOOP_PROFILING_TYPE_TIMER = 0,
+    BTSTACK_RUN_LOOP_PROFILING_TYPE_DATA_SOURCE,
+    BTSTACK_RUN_LOOP_PROFILING_TYPE_CALLBACK,
+    // handlers that did not fit into the table of MAX_NR_RUN_LOOP_PROFILING_ENTRIES
+    BTSTACK_RUN_LOOP_PROFILING_TYPE_OTHER,
+} btstack_run_loop_profiling_type_t;
+
+// generic function pointer used to identify a handler
+typedef void (*btstack_run_loop_profiling_handler_t)(void);
+
+typedef struct {
+    btstack_run_loop_profiling_handler_t handler;
+    btstack_run_loop_profiling_type_t type;
+    uint32_t count;
+    uint32_t max_us;
+    uint64_t total_us;
+    // timers only: max difference between timeout and process time in system ticks or milliseconds
+    uint32_t max_lateness;
+    uint32_t histogram[BTSTACK_RUN_LOOP_PROFILING_NUM_BUCKETS];
+} btstack_run_loop_profiling_entry_t;
+
+typedef struct {
+    // timer lateness in system ticks (HAVE_EMBEDDED_TICK) or milliseconds
+    uint32_t timer_lateness_histogram[BTSTACK_RUN_LOOP_PROFILING_NUM_BUCKETS];
+    uint32_t max_timer_lateness;
+    // queue depths
+    uint16_t max_timers;
+    uint16_t max_expired_timers;
+    uint16_t max_data_sources;
+    uint16_t max_callbacks;
+} btstack_run_loop_profiling_stats_t;
+
+/**
+ * @brief Set function that provides current time in microseconds. Without it, btstack_run_loop_get_time_ms is used
+ * @param get_time_us or NULL
+ */
+void btstack_run_loop_profiling_set_time_us_callback(uint32_t (*get_time_us)(void));
+
+/**
+ * @brief Clear all collected data
+ */
+void btstack_run_loop_profiling_reset(void);
+
+/**
+ * @brief Get number of handlers that have been profiled
+ * @return num entries, at most MAX_NR_RUN_LOOP_PROFILING_ENTRIES + 1 for the entry of type BTSTACK_RUN_LOOP_PROFILING_TYPE_OTHER
+ */
+uint16_t btstack_run_loop_profiling_get_num_entries(void);
+
+/**
+ * @brief Get profiling data for handler
+ * @param index < btstack_run_loop_profiling_get_num_entries()
+ * @return entry or NULL if index invalid
+ */
+const btstack_run_loop_profiling_entry_t * btstack_run_loop_profiling_get_entry(uint16_t index);
+
+/**
+ * @brief Get timer lateness and queue depths
+ * @return stats
+ */
+const btstack_run_loop_profiling_stats_t * btstack_run_loop_profiling_get_stats(void);
+
+/**
+ * @brief Log collected data as HCI_DUMP_LOG_LEVEL_INFO log messages via hci_dump
+ */
+void btstack_run_loop_profiling_dump(void);
+
+/**
+ * @brief Dump collected data periodically. Requires initialized run loop
+ * @param interval_ms or 0 to stop
+ */
+void btstack_run_loop_profiling_set_dump_interval(uint32_t interval_ms);
+
+#endif
+
 
 /* API_START */
 
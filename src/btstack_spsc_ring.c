@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "btstack_spsc_ring.c"
+
+/*
+ *  btstack_spsc_ring.c
+ *
+ *  Producer owns write_index, consumer owns read_index. Each side publishes its index with release
+ *  semantics after accessing the storage and reads the other index with acquire semantics. The last
+ *  seen value of the other index is cached to avoid touching the cache line of the other side on every
+ *  call. Producer and consumer fields are kept on separate cache lines, see BTSTACK_SPSC_RING_CACHE_LINE_SIZE.
+ */
+
+#include <string.h>
+
+#include "btstack_spsc_ring.h"
+#include "btstack_debug.h"
+#include "btstack_util.h"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SPSC_LOAD_ACQUIRE(ptr)          __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define SPSC_STORE_RELEASE(ptr, value)  __atomic_store_n(ptr, value, __ATOMIC_RELEASE)
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define SPSC_LOAD_ACQUIRE(ptr)          ((uint32_t) _InterlockedOr((volatile long *) (ptr), 0))
+#define SPSC_STORE_RELEASE(ptr, value)  ((void) _InterlockedExchange((volatile long *) (ptr), (long) (value)))
+#else
+#error "btstack_spsc_ring requires __atomic builtins"
+#endif
+
+void btstack_spsc_ring_init(btstack_spsc_ring_t * ring, uint8_t * storage, uint32_t storage_size){
+    btstack_assert((storage_size != 0u) && ((storage_size & (storage_size - 1u)) == 0u));
+    ring->storage = storage;
+    ring->size = storage_size;
+    btstack_spsc_ring_reset(ring);
+}
+
+void btstack_spsc_ring_reset(btstack_spsc_ring_t * ring){
+    ring->write_index = 0;
+    ring->read_index_cached = 0;
+    ring->read_index = 0;
+    ring->write_index_cached = 0;
+}
+
+// producer
+
+uint32_t btstack_spsc_ring_bytes_free(btstack_spsc_ring_t * ring){
+    ring->read_index_cached = SPSC_LOAD_ACQUIRE(&ring->read_index);
+    return ring->size - (ring->write_index - ring->read_index_cached);
+}
+
+uint8_t * btstack_spsc_ring_reserve(btstack_spsc_ring_t * ring, uint32_t * span_size){
+    uint32_t write_index = ring->write_index;
+    uint32_t offset = write_index & (ring->size - 1u);
+    uint32_t contiguous = ring->size - offset;
+    uint32_t bytes_free = ring->size - (write_index - ring->read_index_cached);
+    if (bytes_free < contiguous){
+        bytes_free = btstack_spsc_ring_bytes_free(ring);
+    }
+    *span_size = btstack_min(bytes_free, contiguous);
+    return &ring->storage[offset];
+}
+
+void btstack_spsc_ring_commit(btstack_spsc_ring_t * ring, uint32_t num_bytes){
+    btstack_assert(num_bytes <= (ring->size - (ring->write_index - ring->read_index_cached)));
+    SPSC_STORE_RELEASE(&ring->write_index, ring->write_index + num_bytes);
+}
+
+bool btstack_spsc_ring_write(btstack_spsc_ring_t * ring, const uint8_t * data, uint32_t data_len){
+    if (btstack_spsc_ring_bytes_free(ring) < data_len){
+        return false;
+    }
+    uint32_t offset = ring->write_index & (ring->size - 1u);
+    uint32_t bytes_to_end = btstack_min(data_len, ring->size - offset);
+    (void) memcpy(&ring->storage[offset], data, bytes_to_end);
+    (void) memcpy(ring->storage, &data[bytes_to_end], data_len - bytes_to_end);
+    btstack_spsc_ring_commit(ring, data_len);
+    return true;
+}
+
+// consumer
+
+uint32_t btstack_spsc_ring_bytes_available(btstack_spsc_ring_t * ring){
+    ring->write_index_cached = SPSC_LOAD_ACQUIRE(&ring->write_index);
+    return ring->write_index_cached - ring->read_index;
+}
+
+const uint8_t * btstack_spsc_ring_peek(btstack_spsc_ring_t * ring, uint32_t * span_size){
+    uint32_t read_index = ring->read_index;
+    uint32_t offset = read_index & (ring->size - 1u);
+    uint32_t contiguous = ring->size - offset;
+    uint32_t bytes_available = ring->write_index_cached - read_index;
+    if (bytes_available < contiguous){
+        bytes_available = btstack_spsc_ring_bytes_available(ring);
+    }
+    *span_size = btstack_min(bytes_available, contiguous);
+    return &ring->storage[offset];
+}
+
+void btstack_spsc_ring_consume(btstack_spsc_ring_t * ring, uint32_t num_bytes){
+    btstack_assert(num_bytes <= (ring->write_index_cached - ring->read_index));
+    SPSC_STORE_RELEASE(&ring->read_index, ring->read_index + num_bytes);
+}
+
+uint32_t btstack_spsc_ring_read(btstack_spsc_ring_t * ring, uint8_t * buffer, uint32_t buffer_size){
+    uint32_t bytes_to_read = btstack_min(btstack_spsc_ring_bytes_available(ring), buffer_size);
+    uint32_t offset = ring->read_index & (ring->size - 1u);
+    uint32_t bytes_to_end = btstack_min(bytes_to_read, ring->size - offset);
+    (void) memcpy(buffer, &ring->storage[offset], bytes_to_end);
+    (void) memcpy(&buffer[bytes_to_end], ring->storage, bytes_to_read - bytes_to_end);
+    btstack_spsc_ring_consume(ring, bytes_to_read);
+    return bytes_to_read;
+}
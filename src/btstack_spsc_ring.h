@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/**
+ * @title SPSC Ring Buffer
+ *
+ * Wait-free single-producer/single-consumer byte ring buffer, e.g. to pass audio samples between an
+ * audio driver thread and the run loop without locks. One thread may write and another thread may read
+ * concurrently; the read and write indices are free-running 32-bit counters that are only updated with
+ * release/acquire semantics by their owner. The storage size has to be a power of two.
+ *
+ * Data can be copied with write/read or accessed in place: reserve returns the contiguous free span
+ * at the write position, which is made visible to the consumer with commit. Similarly, peek returns
+ * the contiguous span of available data, which is released with consume. A span ends at the end of
+ * the storage, so a second call may be needed after wrap-around. If the storage size is a multiple of
+ * the block size and only complete blocks are written, spans never wrap.
+ *
+ * Requires GCC/Clang __atomic builtins or MSVC.
+ */
+
+#ifndef BTSTACK_SPSC_RING_H
+#define BTSTACK_SPSC_RING_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "btstack_config.h"
+#include "btstack_bool.h"
+
+// producer and consumer fields are separated by a full cache line, set to 0 for targets without data cache
+#ifndef BTSTACK_SPSC_RING_CACHE_LINE_SIZE
+#define BTSTACK_SPSC_RING_CACHE_LINE_SIZE 64
+#endif
+
+#if BTSTACK_SPSC_RING_CACHE_LINE_SIZE > 0
+#define BTSTACK_SPSC_RING_PADDING(name) uint8_t name[BTSTACK_SPSC_RING_CACHE_LINE_SIZE];
+#else
+#define BTSTACK_SPSC_RING_PADDING(name)
+#endif
+
+typedef struct btstack_spsc_ring {
+    uint8_t * storage;
+    uint32_t  size;
+    BTSTACK_SPSC_RING_PADDING(padding_shared)
+    // written by producer
+    uint32_t  write_index;
+    uint32_t  read_index_cached;
+    BTSTACK_SPSC_RING_PADDING(padding_producer)
+    // written by consumer
+    uint32_t  read_index;
+    uint32_t  write_index_cached;
+    BTSTACK_SPSC_RING_PADDING(padding_consumer)
+} btstack_spsc_ring_t;
+
+/* API_START */
+
+/**
+ * @brief Init SPSC ring buffer
+ * @param ring
+ * @param storage
+ * @param storage_size in bytes, power of two
+ */
+void btstack_spsc_ring_init(btstack_spsc_ring_t * ring, uint8_t * storage, uint32_t storage_size);
+
+/**
+ * @brief Reset ring buffer to empty state. Must not be called while producer or consumer are active
+ * @param ring
+ */
+void btstack_spsc_ring_reset(btstack_spsc_ring_t * ring);
+
+/**
+ * @brief Get free space. Called by producer
+ * @param ring
+ * @return number of bytes that can be written
+ */
+uint32_t btstack_spsc_ring_bytes_free(btstack_spsc_ring_t * ring);
+
+/**
+ * @brief Get contiguous free span at write position. Called by producer
+ * @param ring
+ * @param span_size returns size of span in bytes, 0 if full
+ * @return start of span
+ */
+uint8_t * btstack_spsc_ring_reserve(btstack_spsc_ring_t * ring, uint32_t * span_size);
+
+/**
+ * @brief Make bytes stored in reserved span available to consumer. Called by producer
+ * @param ring
+ * @param num_bytes <= span_size of last reserve
+ */
+void btstack_spsc_ring_commit(btstack_spsc_ring_t * ring, uint32_t num_bytes);
+
+/**
+ * @brief Copy data into ring buffer. Called by producer
+ * @param ring
+ * @param data
+ * @param data_len
+ * @return true if data was stored, false if not enough space (nothing stored)
+ */
+bool btstack_spsc_ring_write(btstack_spsc_ring_t * ring, const uint8_t * data, uint32_t data_len);
+
+/**
+ * @brief Get number of bytes available for read. Called by consumer
+ * @param ring
+ * @return number of bytes
+ */
+uint32_t btstack_spsc_ring_bytes_available(btstack_spsc_ring_t * ring);
+
+/**
+ * @brief Get contiguous span of available data at read position. Called by consumer
+ * @param ring
+ * @param span_size returns size of span in bytes, 0 if empty
+ * @return start of span
+ */
+const uint8_t * btstack_spsc_ring_peek(btstack_spsc_ring_t * ring, uint32_t * span_size);
+
+/**
+ * @brief Release bytes at read position to producer. Called by consumer
+ * @param ring
+ * @param num_bytes <= bytes available
+ */
+void btstack_spsc_ring_consume(btstack_spsc_ring_t * ring, uint32_t num_bytes);
+
+/**
+ * @brief Copy data from ring buffer. Called by consumer
+ * @param ring
+ * @param buffer
+ * @param buffer_size
+ * @return number of bytes read
+ */
+uint32_t btstack_spsc_ring_read(btstack_spsc_ring_t * ring, uint8_t * buffer, uint32_t buffer_size);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // BTSTACK_SPSC_RING_H
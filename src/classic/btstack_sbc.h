@@ -163,6 +163,49 @@ uint16_t  btstack_sbc_encoder_sbc_buffer_length(void);
  */
 int  btstack_sbc_encoder_num_audio_frames(void);
 
+/* BTstack SBC Encoder Instance */
+/**
+ * @brief Configure SBC encoder instance
+ * @note encoder storage has to be provided first, e.g. with btstack_sbc_encoder_bluedroid_init_instance
+ * @param state
+ * @param mode
+ * @param blocks
+ * @param subbands
+ * @param allocation_method
+ * @param sample_rate
+ * @param bitpool
+ * @param channel_mode
+ */
+void btstack_sbc_encoder_instance_configure(btstack_sbc_encoder_state_t * state, btstack_sbc_mode_t mode,
+                        int blocks, int subbands, btstack_sbc_allocation_method_t allocation_method,
+                        int sample_rate, int bitpool, btstack_sbc_channel_mode_t channel_mode);
+
+/**
+ * @brief Encode PCM data with SBC encoder instance
+ * @param state
+ * @param buffer with samples in host endianess
+ */
+void btstack_sbc_encoder_instance_process_data(btstack_sbc_encoder_state_t * state, int16_t * input_buffer);
+
+/**
+ * @brief Return SBC frame of SBC encoder instance
+ * @param state
+ */
+uint8_t * btstack_sbc_encoder_instance_sbc_buffer(btstack_sbc_encoder_state_t * state);
+
+/**
+ * @brief Return SBC frame length of SBC encoder instance
+ * @param state
+ */
+uint16_t  btstack_sbc_encoder_instance_sbc_buffer_length(btstack_sbc_encoder_state_t * state);
+
+/**
+ * @brief Return number of audio frames required for one SBC packet of SBC encoder instance
+ * @note  each audio frame contains 2 sample values in stereo modes
+ * @param state
+ */
+int  btstack_sbc_encoder_instance_num_audio_frames(btstack_sbc_encoder_state_t * state);
+
 /* API_END */
 
 // testing only
@@ -54,105 +54,135 @@
 #include "btstack_debug.h"
 #include "btstack_util.h"
 
-#include "sbc_encoder.h"
+#include "btstack_sbc_bluedroid.h"
 
 #define mSBC_SYNCWORD 0xad
 #define SBC_SYNCWORD 0x9c
 #define SBC_MAX_CHANNELS 2
 // #define LOG_FRAME_STATUS
 
-
-typedef struct {
-    SBC_ENC_PARAMS context;
-    int num_data_bytes;
-    uint8_t sbc_packet[1000];
-} bludroid_encoder_state_t;
-
+// storage for legacy single instance API
 static btstack_sbc_encoder_state_t * sbc_encoder_state_singleton = NULL;
-static bludroid_encoder_state_t bd_encoder_state;
+static btstack_sbc_encoder_bluedroid_t bd_encoder_state;
 
+static SBC_ENC_PARAMS * btstack_sbc_encoder_params(btstack_sbc_encoder_state_t * state){
+    return &((btstack_sbc_encoder_bluedroid_t *) state->encoder_state)->params;
+}
 
-void btstack_sbc_encoder_init(btstack_sbc_encoder_state_t * state, btstack_sbc_mode_t mode, 
-                        int blocks, int subbands, btstack_sbc_allocation_method_t allocation_method, 
-                        int sample_rate, int bitpool, btstack_sbc_channel_mode_t channel_mode){
+void btstack_sbc_encoder_bluedroid_init_instance(btstack_sbc_encoder_state_t * state, btstack_sbc_encoder_bluedroid_t * context){
+    memset(context, 0, sizeof(btstack_sbc_encoder_bluedroid_t));
+    state->encoder_state = context;
+}
 
-    if (sbc_encoder_state_singleton && (sbc_encoder_state_singleton != state) ){
-        log_error("SBC encoder: different sbc decoder state is allready registered");
-    } 
-    
-    sbc_encoder_state_singleton = state;
+void btstack_sbc_encoder_instance_configure(btstack_sbc_encoder_state_t * state, btstack_sbc_mode_t mode,
+                        int blocks, int subbands, btstack_sbc_allocation_method_t allocation_method,
+                        int sample_rate, int bitpool, btstack_sbc_channel_mode_t channel_mode){
 
-    if (!sbc_encoder_state_singleton){
-        log_error("SBC encoder init: sbc state is NULL");
-    }
+    btstack_assert(state->encoder_state != NULL);
+    btstack_sbc_encoder_bluedroid_t * bd_encoder = (btstack_sbc_encoder_bluedroid_t *) state->encoder_state;
+    SBC_ENC_PARAMS * context = &bd_encoder->params;
 
-    sbc_encoder_state_singleton->mode = mode;
+    state->mode = mode;
 
-    switch (sbc_encoder_state_singleton->mode){
+    switch (state->mode){
         case SBC_MODE_STANDARD:
-            bd_encoder_state.context.s16NumOfBlocks = blocks;                          
-            bd_encoder_state.context.s16NumOfSubBands = subbands;                       
-            bd_encoder_state.context.s16AllocationMethod = (uint8_t)allocation_method;                     
-            bd_encoder_state.context.s16BitPool = bitpool;  
-            bd_encoder_state.context.mSBCEnabled = 0;
-            bd_encoder_state.context.s16ChannelMode = (uint8_t)channel_mode;
-            bd_encoder_state.context.s16NumOfChannels = 2;
-            if (bd_encoder_state.context.s16ChannelMode == SBC_MONO){
-                bd_encoder_state.context.s16NumOfChannels = 1;
+            context->s16NumOfBlocks = blocks;
+            context->s16NumOfSubBands = subbands;
+            context->s16AllocationMethod = (uint8_t)allocation_method;
+            context->s16BitPool = bitpool;
+            context->mSBCEnabled = 0;
+            context->s16ChannelMode = (uint8_t)channel_mode;
+            context->s16NumOfChannels = 2;
+            if (context->s16ChannelMode == SBC_MONO){
+                context->s16NumOfChannels = 1;
             }
             switch(sample_rate){
-                case 16000: bd_encoder_state.context.s16SamplingFreq = SBC_sf16000; break;
-                case 32000: bd_encoder_state.context.s16SamplingFreq = SBC_sf32000; break;
-                case 44100: bd_encoder_state.context.s16SamplingFreq = SBC_sf44100; break;
-                case 48000: bd_encoder_state.context.s16SamplingFreq = SBC_sf48000; break;
-                default: bd_encoder_state.context.s16SamplingFreq = 0; break;
+                case 16000: context->s16SamplingFreq = SBC_sf16000; break;
+                case 32000: context->s16SamplingFreq = SBC_sf32000; break;
+                case 44100: context->s16SamplingFreq = SBC_sf44100; break;
+                case 48000: context->s16SamplingFreq = SBC_sf48000; break;
+                default: context->s16SamplingFreq = 0; break;
             }
             break;
         case SBC_MODE_mSBC:
-            bd_encoder_state.context.s16NumOfBlocks    = 15;
-            bd_encoder_state.context.s16NumOfSubBands  = 8;
-            bd_encoder_state.context.s16AllocationMethod = SBC_LOUDNESS;
-            bd_encoder_state.context.s16BitPool   = 26;
-            bd_encoder_state.context.s16ChannelMode = SBC_MONO;
-            bd_encoder_state.context.s16NumOfChannels = 1;
-            bd_encoder_state.context.mSBCEnabled = 1;
-            bd_encoder_state.context.s16SamplingFreq = SBC_sf16000;
+            context->s16NumOfBlocks    = 15;
+            context->s16NumOfSubBands  = 8;
+            context->s16AllocationMethod = SBC_LOUDNESS;
+            context->s16BitPool   = 26;
+            context->s16ChannelMode = SBC_MONO;
+            context->s16NumOfChannels = 1;
+            context->mSBCEnabled = 1;
+            context->s16SamplingFreq = SBC_sf16000;
             break;
         default:
             btstack_assert(false);
             break;
     }
-    bd_encoder_state.context.pu8Packet = bd_encoder_state.sbc_packet;
-    
-    sbc_encoder_state_singleton->encoder_state = &bd_encoder_state;
-    SBC_ENC_PARAMS * context = &((bludroid_encoder_state_t *)sbc_encoder_state_singleton->encoder_state)->context;
+    context->pu8Packet = bd_encoder->sbc_packet;
+
     SBC_Encoder_Init(context);
 }
 
+void btstack_sbc_encoder_instance_process_data(btstack_sbc_encoder_state_t * state, int16_t * input_buffer){
+    SBC_ENC_PARAMS * context = btstack_sbc_encoder_params(state);
+    context->ps16PcmBuffer = input_buffer;
+    if (context->mSBCEnabled){
+        context->pu8Packet[0] = mSBC_SYNCWORD;
+    }
+    SBC_Encoder(context);
+}
+
+int btstack_sbc_encoder_instance_num_audio_frames(btstack_sbc_encoder_state_t * state){
+    SBC_ENC_PARAMS * context = btstack_sbc_encoder_params(state);
+    return context->s16NumOfSubBands * context->s16NumOfBlocks;
+}
+
+uint8_t * btstack_sbc_encoder_instance_sbc_buffer(btstack_sbc_encoder_state_t * state){
+    SBC_ENC_PARAMS * context = btstack_sbc_encoder_params(state);
+    return context->pu8Packet;
+}
+
+uint16_t  btstack_sbc_encoder_instance_sbc_buffer_length(btstack_sbc_encoder_state_t * state){
+    SBC_ENC_PARAMS * context = btstack_sbc_encoder_params(state);
+    return context->u16PacketLength;
+}
+
+// legacy single instance API
+
+void btstack_sbc_encoder_init(btstack_sbc_encoder_state_t * state, btstack_sbc_mode_t mode, 
+                        int blocks, int subbands, btstack_sbc_allocation_method_t allocation_method, 
+                        int sample_rate, int bitpool, btstack_sbc_channel_mode_t channel_mode){
+
+    if (sbc_encoder_state_singleton && (sbc_encoder_state_singleton != state) ){
+        log_error("SBC encoder: different sbc decoder state is allready registered");
+    } 
+    
+    sbc_encoder_state_singleton = state;
+
+    if (!sbc_encoder_state_singleton){
+        log_error("SBC encoder init: sbc state is NULL");
+    }
+
+    btstack_sbc_encoder_bluedroid_init_instance(sbc_encoder_state_singleton, &bd_encoder_state);
+    btstack_sbc_encoder_instance_configure(sbc_encoder_state_singleton, mode, blocks, subbands, allocation_method,
+                                           sample_rate, bitpool, channel_mode);
+}
 
 void btstack_sbc_encoder_process_data(int16_t * input_buffer){
     if (!sbc_encoder_state_singleton){
         log_error("SBC encoder: sbc state is NULL, call btstack_sbc_encoder_init to initialize it");
     }
-    SBC_ENC_PARAMS * context = &((bludroid_encoder_state_t *)sbc_encoder_state_singleton->encoder_state)->context;
-    context->ps16PcmBuffer = input_buffer;
-    if (context->mSBCEnabled){
-        context->pu8Packet[0] = 0xad;
-    }
-    SBC_Encoder(context);
+    btstack_sbc_encoder_instance_process_data(sbc_encoder_state_singleton, input_buffer);
 }
 
 int btstack_sbc_encoder_num_audio_frames(void){
-    SBC_ENC_PARAMS * context = &((bludroid_encoder_state_t *)sbc_encoder_state_singleton->encoder_state)->context;
-    return context->s16NumOfSubBands * context->s16NumOfBlocks;
+    return btstack_sbc_encoder_instance_num_audio_frames(sbc_encoder_state_singleton);
 }
 
 uint8_t * btstack_sbc_encoder_sbc_buffer(void){
-    SBC_ENC_PARAMS * context = &((bludroid_encoder_state_t *)sbc_encoder_state_singleton->encoder_state)->context;
-    return context->pu8Packet;
+    return btstack_sbc_encoder_instance_sbc_buffer(sbc_encoder_state_singleton);
 }
 
 uint16_t  btstack_sbc_encoder_sbc_buffer_length(void){
-    SBC_ENC_PARAMS * context = &((bludroid_encoder_state_t *)sbc_encoder_state_singleton->encoder_state)->context;
-    return context->u16PacketLength;
+    return btstack_sbc_encoder_instance_sbc_buffer_length(sbc_encoder_state_singleton);
 }
@@ -77,16 +77,30 @@ static uint8_t goep_packet_buffer[150];
 static goep_client_t   goep_client_singleton;
 
 #ifdef ENABLE_GOEP_L2CAP
+// ERTM config of singleton instance, larger MTU and receive window speed up bulk transfers, e.g. PBAP phonebook sync
+#ifndef GOEP_CLIENT_L2CAP_ERTM_MTU
+#define GOEP_CLIENT_L2CAP_ERTM_MTU 512
+#endif
+#ifndef GOEP_CLIENT_L2CAP_ERTM_NUM_RX_BUFFERS
+#define GOEP_CLIENT_L2CAP_ERTM_NUM_RX_BUFFERS 2
+#endif
+#ifndef GOEP_CLIENT_L2CAP_ERTM_NUM_TX_BUFFERS
+#define GOEP_CLIENT_L2CAP_ERTM_NUM_TX_BUFFERS 2
+#endif
+#ifndef GOEP_CLIENT_L2CAP_ERTM_BUFFER_SIZE
+#define GOEP_CLIENT_L2CAP_ERTM_BUFFER_SIZE 1000
+#endif
+
 // singleton instance
-static uint8_t goep_client_singleton_ertm_buffer[1000];
+static uint8_t goep_client_singleton_ertm_buffer[GOEP_CLIENT_L2CAP_ERTM_BUFFER_SIZE];
 static l2cap_ertm_config_t goep_client_singleton_ertm_config = {
     1,  // ertm mandatory
     2,  // max transmit, some tests require > 1
     2000,
     12000,
-    512,    // l2cap ertm mtu
-    2,
-    2,
+    GOEP_CLIENT_L2CAP_ERTM_MTU,             // l2cap ertm mtu
+    GOEP_CLIENT_L2CAP_ERTM_NUM_TX_BUFFERS,
+    GOEP_CLIENT_L2CAP_ERTM_NUM_RX_BUFFERS,  // receive window
     1,      // 16-bit FCS
 };
 #endif
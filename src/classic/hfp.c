@@ -58,6 +58,8 @@
 #include "hci_cmd.h"
 #include "hci_dump.h"
 
+#include "classic/hfp_at_command_trie.h"
+
 #if defined(ENABLE_CC256X_ASSISTED_HFP) && !defined(ENABLE_SCO_OVER_PCM)
 #error "Assisted HFP is only possible over PCM/I2S. Please add define: ENABLE_SCO_OVER_PCM"
 #endif
@@ -1115,73 +1117,6 @@ void hfp_handle_rfcomm_event(uint8_t packet_type, uint16_t channel, uint8_t *pac
 }
 // translates command string into hfp_command_t CMD
 
-typedef struct {
-    const char * command;
-    hfp_command_t command_id;
-} hfp_command_entry_t;
-
-static hfp_command_entry_t hfp_ag_command_table[] = {
-    { "AT+BAC=",   HFP_CMD_AVAILABLE_CODECS },
-    { "AT+BCC",    HFP_CMD_TRIGGER_CODEC_CONNECTION_SETUP },
-    { "AT+BCS=",   HFP_CMD_HF_CONFIRMED_CODEC },
-    { "AT+BIA=",   HFP_CMD_ENABLE_INDIVIDUAL_AG_INDICATOR_STATUS_UPDATE, }, // +BIA:<enabled>,,<enabled>,,,<enabled>
-    { "AT+BIEV=",  HFP_CMD_HF_INDICATOR_STATUS },
-    { "AT+BIND=",  HFP_CMD_LIST_GENERIC_STATUS_INDICATORS },
-    { "AT+BIND=?", HFP_CMD_RETRIEVE_GENERIC_STATUS_INDICATORS },
-    { "AT+BIND?",  HFP_CMD_RETRIEVE_GENERIC_STATUS_INDICATORS_STATE },
-    { "AT+BINP=",  HFP_CMD_HF_REQUEST_PHONE_NUMBER },
-    { "AT+BLDN",   HFP_CMD_REDIAL_LAST_NUMBER },
-    { "AT+BRSF=",  HFP_CMD_SUPPORTED_FEATURES },
-    { "AT+BTRH=",  HFP_CMD_RESPONSE_AND_HOLD_COMMAND },
-    { "AT+BTRH?",  HFP_CMD_RESPONSE_AND_HOLD_QUERY },
-    { "AT+BVRA=",  HFP_CMD_HF_ACTIVATE_VOICE_RECOGNITION },
-    { "AT+CCWA=",  HFP_CMD_ENABLE_CALL_WAITING_NOTIFICATION},
-    { "AT+CHLD=",  HFP_CMD_CALL_HOLD },
-    { "AT+CHLD=?", HFP_CMD_SUPPORT_CALL_HOLD_AND_MULTIPARTY_SERVICES },
-    { "AT+CHUP",   HFP_CMD_HANG_UP_CALL },
-    { "AT+CIND=?", HFP_CMD_RETRIEVE_AG_INDICATORS },
-    { "AT+CIND?",  HFP_CMD_RETRIEVE_AG_INDICATORS_STATUS },
-    { "AT+CLCC",   HFP_CMD_LIST_CURRENT_CALLS },
-    { "AT+CLIP=",  HFP_CMD_ENABLE_CLIP},
-    { "AT+CMEE=",  HFP_CMD_ENABLE_EXTENDED_AUDIO_GATEWAY_ERROR},
-    { "AT+CMER=",  HFP_CMD_ENABLE_INDICATOR_STATUS_UPDATE },
-    { "AT+CNUM",   HFP_CMD_GET_SUBSCRIBER_NUMBER_INFORMATION },
-    { "AT+COPS=",  HFP_CMD_QUERY_OPERATOR_SELECTION_NAME_FORMAT },
-    { "AT+COPS?",  HFP_CMD_QUERY_OPERATOR_SELECTION_NAME },
-    { "AT+NREC=",  HFP_CMD_TURN_OFF_EC_AND_NR, },
-    { "AT+VGM=",   HFP_CMD_SET_MICROPHONE_GAIN },
-    { "AT+VGS=",   HFP_CMD_SET_SPEAKER_GAIN },
-    { "AT+VTS=",   HFP_CMD_TRANSMIT_DTMF_CODES },
-    { "ATA",       HFP_CMD_CALL_ANSWERED },
-};
-
-static hfp_command_entry_t hfp_hf_command_table[] = {
-    { "+BCS:",  HFP_CMD_AG_SUGGESTED_CODEC },
-    { "+BIND:", HFP_CMD_SET_GENERIC_STATUS_INDICATOR_STATUS },
-    { "+BINP:", HFP_CMD_AG_SENT_PHONE_NUMBER },
-    { "+BRSF:", HFP_CMD_SUPPORTED_FEATURES },
-    { "+BSIR:", HFP_CMD_CHANGE_IN_BAND_RING_TONE_SETTING },
-    { "+BTRH:", HFP_CMD_RESPONSE_AND_HOLD_STATUS },
-    { "+BVRA:", HFP_CMD_AG_ACTIVATE_VOICE_RECOGNITION },
-    { "+CCWA:", HFP_CMD_AG_SENT_CALL_WAITING_NOTIFICATION_UPDATE, },
-    { "+CHLD:", HFP_CMD_SUPPORT_CALL_HOLD_AND_MULTIPARTY_SERVICES },
-    { "+CIEV:", HFP_CMD_TRANSFER_AG_INDICATOR_STATUS},
-    { "+CIND:", HFP_CMD_RETRIEVE_AG_INDICATORS_GENERIC },
-    { "+CLCC:", HFP_CMD_LIST_CURRENT_CALLS },
-    { "+CLIP:", HFP_CMD_AG_SENT_CLIP_INFORMATION },
-    { "+CME ERROR:", HFP_CMD_EXTENDED_AUDIO_GATEWAY_ERROR },
-    { "+CNUM:", HFP_CMD_GET_SUBSCRIBER_NUMBER_INFORMATION},
-    { "+COPS:", HFP_CMD_QUERY_OPERATOR_SELECTION_NAME },
-    { "+VGM:",  HFP_CMD_SET_MICROPHONE_GAIN },
-    { "+VGM=",  HFP_CMD_SET_MICROPHONE_GAIN },
-    { "+VGS:",  HFP_CMD_SET_SPEAKER_GAIN},
-    { "+VGS=",  HFP_CMD_SET_SPEAKER_GAIN},
-    { "ERROR",  HFP_CMD_ERROR},
-    { "NOP",    HFP_CMD_NONE}, // dummy command used by unit tests
-    { "OK",     HFP_CMD_OK },
-    { "RING",   HFP_CMD_RING },
-};
-
 static const hfp_custom_at_command_t *
 hfp_custom_command_lookup(bool isHandsFree, const char *text) {
     btstack_linked_list_t * custom_commands = isHandsFree ? &hfp_custom_commands_hf : &hfp_custom_commands_ag;
@@ -1197,41 +1132,35 @@ hfp_custom_command_lookup(bool isHandsFree, const char *text) {
     return NULL;
 }
 
-static hfp_command_t parse_command(const char * line_buffer, int isHandsFree){
+// returns command id of exact match, or HFP_AT_COMMAND_TRIE_NO_COMMAND
+static uint8_t hfp_at_command_trie_lookup(const hfp_at_command_trie_node_t * trie, const char * text){
+    uint8_t node = 0;
+    while (*text != 0){
+        uint8_t child = trie[node].first_child;
+        while ((child != 0) && (trie[child].character != *text)){
+            child = trie[child].next_sibling;
+        }
+        if (child == 0){
+            return HFP_AT_COMMAND_TRIE_NO_COMMAND;
+        }
+        node = child;
+        text++;
+    }
+    return trie[node].command;
+}
+
+static hfp_command_t parse_command(const char * line_buffer, int isHandsFree, const hfp_custom_at_command_t ** custom_at_command){
 
-    // check for custom commands, AG only
-    const hfp_custom_at_command_t * custom_at_command = hfp_custom_command_lookup(isHandsFree, line_buffer);
-    if (custom_at_command != NULL){
+    // check for custom commands
+    *custom_at_command = hfp_custom_command_lookup(isHandsFree, line_buffer);
+    if (*custom_at_command != NULL){
         return HFP_CMD_CUSTOM_MESSAGE;
     }
 
-    // table lookup based on role
-    uint16_t num_entries;
-    hfp_command_entry_t * table;
-    if (isHandsFree == 0){
-        table = hfp_ag_command_table;
-        num_entries = sizeof(hfp_ag_command_table) / sizeof(hfp_command_entry_t);
-    } else {
-        table = hfp_hf_command_table;
-        num_entries = sizeof(hfp_hf_command_table) / sizeof(hfp_command_entry_t);
-    }
-    // binary search
-    uint16_t left = 0;
-    uint16_t right = num_entries - 1;
-    while (left <= right){
-        uint16_t middle = left + (right - left) / 2;
-        hfp_command_entry_t *entry = &table[middle];
-        int match = strcmp(line_buffer, entry->command);
-        if (match < 0){
-            // search term is lower than middle element
-            if (right == 0) break;
-            right = middle - 1;
-        } else if (match == 0){
-            return entry->command_id;
-        } else {
-            // search term is higher than middle element
-            left = middle + 1;
-        }
+    // trie lookup based on role
+    uint8_t command = hfp_at_command_trie_lookup((isHandsFree == 0) ? hfp_at_command_trie_ag : hfp_at_command_trie_hf, line_buffer);
+    if (command != HFP_AT_COMMAND_TRIE_NO_COMMAND){
+        return (hfp_command_t) command;
     }
 
     // note: if parser in CMD_HEADER state would treats digits and maybe '+' as separator, match on "ATD" would work.
@@ -1300,6 +1229,40 @@ static bool hfp_parser_is_separator( uint8_t byte){
     }
 }
 
+// classify command in line buffer and prepare for arguments
+static void hfp_parser_handle_header(hfp_connection_t * hfp_connection, int isHandsFree){
+    const hfp_custom_at_command_t * custom_at_command;
+    hfp_connection->command = parse_command((char *)hfp_connection->line_buffer, isHandsFree, &custom_at_command);
+
+    // pick +CIND version based on connection state: descriptions during SLC vs. states later
+    if (hfp_connection->command == HFP_CMD_RETRIEVE_AG_INDICATORS_GENERIC){
+        switch(hfp_connection->state){
+            case HFP_W4_RETRIEVE_INDICATORS_STATUS:
+                hfp_connection->command = HFP_CMD_RETRIEVE_AG_INDICATORS_STATUS;
+                break;
+            case HFP_W4_RETRIEVE_INDICATORS:
+                hfp_connection->command = HFP_CMD_RETRIEVE_AG_INDICATORS;
+                break;
+            default:
+                hfp_connection->command = HFP_CMD_UNKNOWN;
+                break;
+        }
+    }
+
+    log_info("command string '%s', handsfree %u -> cmd id %u", (char *)hfp_connection->line_buffer, isHandsFree, hfp_connection->command);
+
+    // store command id for custom command and just store rest of line
+    if (hfp_connection->command == HFP_CMD_CUSTOM_MESSAGE){
+        hfp_connection->custom_at_command_id = custom_at_command->command_id;
+        hfp_connection->parser_state = HFP_PARSER_CUSTOM_COMMAND;
+        return;
+    }
+
+    // next state
+    hfp_parser_reset_line_buffer(hfp_connection);
+    hfp_connection->parser_state = HFP_PARSER_CMD_SEQUENCE;
+}
+
 // returns true if received bytes was processed. Otherwise, functions will be called with same byte again
 // this is used to for a one byte lookahead, where an unexpected byte is pushed back by returning false
 static bool hfp_parse_byte(hfp_connection_t * hfp_connection, uint8_t byte, int isHandsFree){
@@ -1359,38 +1322,7 @@ static bool hfp_parse_byte(hfp_connection_t * hfp_connection, uint8_t byte, int
             // ignore empty tokens
             if (hfp_parser_is_buffer_empty(hfp_connection)) return true;
 
-            // parse
-            hfp_connection->command = parse_command((char *)hfp_connection->line_buffer, isHandsFree);
-
-            // pick +CIND version based on connection state: descriptions during SLC vs. states later
-            if (hfp_connection->command == HFP_CMD_RETRIEVE_AG_INDICATORS_GENERIC){
-                switch(hfp_connection->state){
-                    case HFP_W4_RETRIEVE_INDICATORS_STATUS:
-                        hfp_connection->command = HFP_CMD_RETRIEVE_AG_INDICATORS_STATUS;
-                        break;
-                    case HFP_W4_RETRIEVE_INDICATORS:
-                        hfp_connection->command = HFP_CMD_RETRIEVE_AG_INDICATORS;
-                        break;
-                    default:
-                        hfp_connection->command = HFP_CMD_UNKNOWN;
-                        break;
-                }
-            }
-
-            log_info("command string '%s', handsfree %u -> cmd id %u", (char *)hfp_connection->line_buffer, isHandsFree, hfp_connection->command);
-
-            // store command id for custom command and just store rest of line
-            if (hfp_connection->command == HFP_CMD_CUSTOM_MESSAGE){
-                const hfp_custom_at_command_t * at_command = hfp_custom_command_lookup(isHandsFree, (const char *) hfp_connection->line_buffer);
-                hfp_connection->custom_at_command_id = at_command->command_id;
-                hfp_connection->parser_state = HFP_PARSER_CUSTOM_COMMAND;
-                return processed;
-            }
-
-            // next state
-            hfp_parser_reset_line_buffer(hfp_connection);
-            hfp_connection->parser_state = HFP_PARSER_CMD_SEQUENCE;
-
+            hfp_parser_handle_header(hfp_connection, isHandsFree);
             return processed;
 
         case HFP_PARSER_CMD_SEQUENCE:
@@ -1526,6 +1458,12 @@ static bool hfp_parse_byte(hfp_connection_t * hfp_connection, uint8_t byte, int
     }
 }
 
+static void hfp_parser_handle_end_of_line(hfp_connection_t * hfp_connection){
+    hfp_connection->found_equal_sign = false;
+    hfp_connection->parser_item_index = 0;
+    hfp_connection->parser_state = HFP_PARSER_CMD_HEADER;
+}
+
 void hfp_parse(hfp_connection_t * hfp_connection, uint8_t byte, int isHandsFree){
     bool processed = false;
     while (!processed){
@@ -1533,10 +1471,135 @@ void hfp_parse(hfp_connection_t * hfp_connection, uint8_t byte, int isHandsFree)
     }
     // reset parser state on end-of-line
     if (hfp_parser_is_end_of_line(byte)){
-        hfp_connection->found_equal_sign = false;
-        hfp_connection->parser_item_index = 0;
-        hfp_connection->parser_state = HFP_PARSER_CMD_HEADER;
+        hfp_parser_handle_end_of_line(hfp_connection);
+    }
+}
+
+// bytes that are stored as part of an argument without further processing by hfp_parse_byte
+static bool hfp_parser_is_plain(uint8_t byte){
+    switch (byte){
+        case '"':
+        case ' ':
+        case ',':
+        case '-':
+        case ';':
+        case '(':
+        case ')':
+        case '\n':
+        case '\r':
+            return false;
+        default:
+            return true;
+    }
+}
+
+static void hfp_parser_store_bytes(hfp_connection_t * hfp_connection, const uint8_t * data, uint16_t len){
+    // truncate like hfp_parser_store_byte
+    if ((hfp_connection->line_size + 1) >= HFP_MAX_VR_TEXT_SIZE) return;
+    uint16_t space = (uint16_t) (HFP_MAX_VR_TEXT_SIZE - 1 - hfp_connection->line_size);
+    uint16_t bytes_to_store = btstack_min(len, space);
+    (void) memcpy(&hfp_connection->line_buffer[hfp_connection->line_size], data, bytes_to_store);
+    hfp_connection->line_size += bytes_to_store;
+    hfp_connection->line_buffer[hfp_connection->line_size] = 0;
+}
+
+// finds complete command header at start of data, returns number of bytes consumed or 0 if hfp_parse_byte is needed
+static uint16_t hfp_parser_parse_header(hfp_connection_t * hfp_connection, const uint8_t * data, uint16_t size, int isHandsFree){
+    if ((hfp_connection->line_size != 0) || hfp_connection->found_equal_sign) return 0;
+
+    uint16_t header_len = 0;
+    uint16_t consumed = 0;
+    bool found_equal_sign = false;
+    uint16_t pos;
+    for (pos = 0; (pos < size) && (consumed == 0); pos++){
+        switch (data[pos]){
+            case '"':
+                return 0;
+            case '\n':
+            case '\r':
+            case ';':
+                // separator is not stored
+                header_len = pos;
+                consumed = pos + 1;
+                break;
+            case ':':
+            case '?':
+                header_len = pos + 1;
+                consumed = pos + 1;
+                break;
+            case '=':
+                // one byte lookahead to decide between '=?' and '=<argument>'
+                if ((pos + 1) >= size) return 0;
+                found_equal_sign = true;
+                switch (data[pos + 1]){
+                    case '"':
+                    case '=':
+                        return 0;
+                    case ':':
+                    case '?':
+                        header_len = pos + 2;
+                        consumed = pos + 2;
+                        break;
+                    case '\n':
+                    case '\r':
+                    case ';':
+                        header_len = pos + 1;
+                        consumed = pos + 2;
+                        break;
+                    default:
+                        header_len = pos + 1;
+                        consumed = pos + 1;
+                        break;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    // header incomplete, empty or too long
+    if ((consumed == 0) || (header_len == 0) || ((header_len + 1) >= HFP_MAX_VR_TEXT_SIZE)){
+        return 0;
+    }
+
+    hfp_connection->found_equal_sign = found_equal_sign;
+    hfp_parser_store_bytes(hfp_connection, data, header_len);
+    hfp_parser_handle_header(hfp_connection, isHandsFree);
+    if (hfp_parser_is_end_of_line(data[consumed - 1])){
+        hfp_parser_handle_end_of_line(hfp_connection);
+    }
+    return consumed;
+}
+
+uint16_t hfp_parse_data(hfp_connection_t * hfp_connection, const uint8_t * data, uint16_t size, int isHandsFree){
+    uint16_t pos = 0;
+    while (pos < size){
+        uint8_t byte = data[pos];
+        uint16_t consumed = 0;
+        if (hfp_parser_is_end_of_line(byte) == false){
+            if (hfp_connection->parser_quoted == false){
+                if (hfp_connection->parser_state == HFP_PARSER_CMD_HEADER){
+                    consumed = hfp_parser_parse_header(hfp_connection, &data[pos], size - pos, isHandsFree);
+                } else {
+                    // store run of plain argument bytes directly
+                    while (((pos + consumed) < size) && hfp_parser_is_plain(data[pos + consumed])){
+                        consumed++;
+                    }
+                    if (consumed > 0){
+                        hfp_parser_store_bytes(hfp_connection, &data[pos], consumed);
+                    }
+                }
+            }
+        }
+        if (consumed == 0){
+            hfp_parse(hfp_connection, byte, isHandsFree);
+            consumed = 1;
+        }
+        pos += consumed;
+        // stop after end of line
+        if (hfp_parser_is_end_of_line(data[pos - 1])) break;
     }
+    return pos;
 }
 
 static void parse_sequence(hfp_connection_t * hfp_connection){
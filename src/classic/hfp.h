@@ -839,6 +839,8 @@ hfp_connection_t * get_hfp_connection_context_for_acl_handle(uint16_t handle, hf
 
 btstack_linked_list_t * hfp_get_connections(void);
 void hfp_parse(hfp_connection_t * connection, uint8_t byte, int isHandsFree);
+// parses received data up to and including the first end of line, returns number of bytes consumed
+uint16_t hfp_parse_data(hfp_connection_t * connection, const uint8_t * data, uint16_t size, int isHandsFree);
 void hfp_parser_reset_line_buffer(hfp_connection_t *hfp_connection);
 
 /**
@@ -0,0 +1,207 @@
+// hfp_at_command_trie.h generated by tool/hfp_at_command_trie_generator.py - do not edit
+
+#ifndef HFP_AT_COMMAND_TRIE_H
+#define HFP_AT_COMMAND_TRIE_H
+
+#define HFP_AT_COMMAND_TRIE_NO_COMMAND 0xff
+
+typedef struct {
+    char    character;
+    uint8_t first_child;   // 0 = none
+    uint8_t next_sibling;  // 0 = none
+    uint8_t command;       // hfp_command_t or HFP_AT_COMMAND_TRIE_NO_COMMAND
+} hfp_at_command_trie_node_t;
+
+// AT commands received by AG
+static const hfp_at_command_trie_node_t hfp_at_command_trie_ag[94] = {
+    {    0,   1,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //   0 ""
+    {  'A',   2,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //   1 "A"
+    {  'T',   3,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //   2 "AT"
+    {  '+',   4,  93, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //   3 "AT+"
+    {  'B',   5,  41, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //   4 "AT+B"
+    {  'A',   6,   8, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //   5 "AT+BA"
+    {  'C',   7,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //   6 "AT+BAC"
+    {  '=',   0,   0, HFP_CMD_AVAILABLE_CODECS                             }, //   7 "AT+BAC="
+    {  'C',   9,  12, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //   8 "AT+BC"
+    {  'C',   0,  10, HFP_CMD_TRIGGER_CODEC_CONNECTION_SETUP               }, //   9 "AT+BCC"
+    {  'S',  11,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  10 "AT+BCS"
+    {  '=',   0,   0, HFP_CMD_HF_CONFIRMED_CODEC                           }, //  11 "AT+BCS="
+    {  'I',  13,  25, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  12 "AT+BI"
+    {  'A',  14,  15, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  13 "AT+BIA"
+    {  '=',   0,   0, HFP_CMD_ENABLE_INDIVIDUAL_AG_INDICATOR_STATUS_UPDATE }, //  14 "AT+BIA="
+    {  'E',  16,  18, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  15 "AT+BIE"
+    {  'V',  17,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  16 "AT+BIEV"
+    {  '=',   0,   0, HFP_CMD_HF_INDICATOR_STATUS                          }, //  17 "AT+BIEV="
+    {  'N',  19,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  18 "AT+BIN"
+    {  'D',  20,  23, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  19 "AT+BIND"
+    {  '=',  21,  22, HFP_CMD_LIST_GENERIC_STATUS_INDICATORS               }, //  20 "AT+BIND="
+    {  '?',   0,   0, HFP_CMD_RETRIEVE_GENERIC_STATUS_INDICATORS           }, //  21 "AT+BIND=?"
+    {  '?',   0,   0, HFP_CMD_RETRIEVE_GENERIC_STATUS_INDICATORS_STATE     }, //  22 "AT+BIND?"
+    {  'P',  24,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  23 "AT+BINP"
+    {  '=',   0,   0, HFP_CMD_HF_REQUEST_PHONE_NUMBER                      }, //  24 "AT+BINP="
+    {  'L',  26,  28, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  25 "AT+BL"
+    {  'D',  27,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  26 "AT+BLD"
+    {  'N',   0,   0, HFP_CMD_REDIAL_LAST_NUMBER                           }, //  27 "AT+BLDN"
+    {  'R',  29,  32, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  28 "AT+BR"
+    {  'S',  30,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  29 "AT+BRS"
+    {  'F',  31,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  30 "AT+BRSF"
+    {  '=',   0,   0, HFP_CMD_SUPPORTED_FEATURES                           }, //  31 "AT+BRSF="
+    {  'T',  33,  37, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  32 "AT+BT"
+    {  'R',  34,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  33 "AT+BTR"
+    {  'H',  35,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  34 "AT+BTRH"
+    {  '=',   0,  36, HFP_CMD_RESPONSE_AND_HOLD_COMMAND                    }, //  35 "AT+BTRH="
+    {  '?',   0,   0, HFP_CMD_RESPONSE_AND_HOLD_QUERY                      }, //  36 "AT+BTRH?"
+    {  'V',  38,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  37 "AT+BV"
+    {  'R',  39,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  38 "AT+BVR"
+    {  'A',  40,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  39 "AT+BVRA"
+    {  '=',   0,   0, HFP_CMD_HF_ACTIVATE_VOICE_RECOGNITION                }, //  40 "AT+BVRA="
+    {  'C',  42,  79, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  41 "AT+C"
+    {  'C',  43,  46, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  42 "AT+CC"
+    {  'W',  44,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  43 "AT+CCW"
+    {  'A',  45,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  44 "AT+CCWA"
+    {  '=',   0,   0, HFP_CMD_ENABLE_CALL_WAITING_NOTIFICATION             }, //  45 "AT+CCWA="
+    {  'H',  47,  53, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  46 "AT+CH"
+    {  'L',  48,  51, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  47 "AT+CHL"
+    {  'D',  49,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  48 "AT+CHLD"
+    {  '=',  50,   0, HFP_CMD_CALL_HOLD                                    }, //  49 "AT+CHLD="
+    {  '?',   0,   0, HFP_CMD_SUPPORT_CALL_HOLD_AND_MULTIPARTY_SERVICES    }, //  50 "AT+CHLD=?"
+    {  'U',  52,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  51 "AT+CHU"
+    {  'P',   0,   0, HFP_CMD_HANG_UP_CALL                                 }, //  52 "AT+CHUP"
+    {  'I',  54,  59, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  53 "AT+CI"
+    {  'N',  55,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  54 "AT+CIN"
+    {  'D',  56,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  55 "AT+CIND"
+    {  '=',  57,  58, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  56 "AT+CIND="
+    {  '?',   0,   0, HFP_CMD_RETRIEVE_AG_INDICATORS                       }, //  57 "AT+CIND=?"
+    {  '?',   0,   0, HFP_CMD_RETRIEVE_AG_INDICATORS_STATUS                }, //  58 "AT+CIND?"
+    {  'L',  60,  65, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  59 "AT+CL"
+    {  'C',  61,  62, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  60 "AT+CLC"
+    {  'C',   0,   0, HFP_CMD_LIST_CURRENT_CALLS                           }, //  61 "AT+CLCC"
+    {  'I',  63,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  62 "AT+CLI"
+    {  'P',  64,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  63 "AT+CLIP"
+    {  '=',   0,   0, HFP_CMD_ENABLE_CLIP                                  }, //  64 "AT+CLIP="
+    {  'M',  66,  71, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  65 "AT+CM"
+    {  'E',  67,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  66 "AT+CME"
+    {  'E',  68,  69, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  67 "AT+CMEE"
+    {  '=',   0,   0, HFP_CMD_ENABLE_EXTENDED_AUDIO_GATEWAY_ERROR          }, //  68 "AT+CMEE="
+    {  'R',  70,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  69 "AT+CMER"
+    {  '=',   0,   0, HFP_CMD_ENABLE_INDICATOR_STATUS_UPDATE               }, //  70 "AT+CMER="
+    {  'N',  72,  74, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  71 "AT+CN"
+    {  'U',  73,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  72 "AT+CNU"
+    {  'M',   0,   0, HFP_CMD_GET_SUBSCRIBER_NUMBER_INFORMATION            }, //  73 "AT+CNUM"
+    {  'O',  75,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  74 "AT+CO"
+    {  'P',  76,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  75 "AT+COP"
+    {  'S',  77,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  76 "AT+COPS"
+    {  '=',   0,  78, HFP_CMD_QUERY_OPERATOR_SELECTION_NAME_FORMAT         }, //  77 "AT+COPS="
+    {  '?',   0,   0, HFP_CMD_QUERY_OPERATOR_SELECTION_NAME                }, //  78 "AT+COPS?"
+    {  'N',  80,  84, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  79 "AT+N"
+    {  'R',  81,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  80 "AT+NR"
+    {  'E',  82,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  81 "AT+NRE"
+    {  'C',  83,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  82 "AT+NREC"
+    {  '=',   0,   0, HFP_CMD_TURN_OFF_EC_AND_NR                           }, //  83 "AT+NREC="
+    {  'V',  85,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  84 "AT+V"
+    {  'G',  86,  90, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  85 "AT+VG"
+    {  'M',  87,  88, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  86 "AT+VGM"
+    {  '=',   0,   0, HFP_CMD_SET_MICROPHONE_GAIN                          }, //  87 "AT+VGM="
+    {  'S',  89,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  88 "AT+VGS"
+    {  '=',   0,   0, HFP_CMD_SET_SPEAKER_GAIN                             }, //  89 "AT+VGS="
+    {  'T',  91,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  90 "AT+VT"
+    {  'S',  92,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                       }, //  91 "AT+VTS"
+    {  '=',   0,   0, HFP_CMD_TRANSMIT_DTMF_CODES                          }, //  92 "AT+VTS="
+    {  'A',   0,   0, HFP_CMD_CALL_ANSWERED                                }, //  93 "ATA"
+};
+
+// result codes received by HF
+static const hfp_at_command_trie_node_t hfp_at_command_trie_hf[90] = {
+    {    0,   1,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //   0 ""
+    {  '+',   2,  76, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //   1 "+"
+    {  'B',   3,  28, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //   2 "+B"
+    {  'C',   4,   6, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //   3 "+BC"
+    {  'S',   5,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //   4 "+BCS"
+    {  ':',   0,   0, HFP_CMD_AG_SUGGESTED_CODEC                        }, //   5 "+BCS:"
+    {  'I',   7,  12, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //   6 "+BI"
+    {  'N',   8,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //   7 "+BIN"
+    {  'D',   9,  10, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //   8 "+BIND"
+    {  ':',   0,   0, HFP_CMD_SET_GENERIC_STATUS_INDICATOR_STATUS       }, //   9 "+BIND:"
+    {  'P',  11,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  10 "+BINP"
+    {  ':',   0,   0, HFP_CMD_AG_SENT_PHONE_NUMBER                      }, //  11 "+BINP:"
+    {  'R',  13,  16, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  12 "+BR"
+    {  'S',  14,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  13 "+BRS"
+    {  'F',  15,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  14 "+BRSF"
+    {  ':',   0,   0, HFP_CMD_SUPPORTED_FEATURES                        }, //  15 "+BRSF:"
+    {  'S',  17,  20, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  16 "+BS"
+    {  'I',  18,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  17 "+BSI"
+    {  'R',  19,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  18 "+BSIR"
+    {  ':',   0,   0, HFP_CMD_CHANGE_IN_BAND_RING_TONE_SETTING          }, //  19 "+BSIR:"
+    {  'T',  21,  24, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  20 "+BT"
+    {  'R',  22,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  21 "+BTR"
+    {  'H',  23,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  22 "+BTRH"
+    {  ':',   0,   0, HFP_CMD_RESPONSE_AND_HOLD_STATUS                  }, //  23 "+BTRH:"
+    {  'V',  25,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  24 "+BV"
+    {  'R',  26,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  25 "+BVR"
+    {  'A',  27,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  26 "+BVRA"
+    {  ':',   0,   0, HFP_CMD_AG_ACTIVATE_VOICE_RECOGNITION             }, //  27 "+BVRA:"
+    {  'C',  29,  68, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  28 "+C"
+    {  'C',  30,  33, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  29 "+CC"
+    {  'W',  31,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  30 "+CCW"
+    {  'A',  32,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  31 "+CCWA"
+    {  ':',   0,   0, HFP_CMD_AG_SENT_CALL_WAITING_NOTIFICATION_UPDATE  }, //  32 "+CCWA:"
+    {  'H',  34,  37, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  33 "+CH"
+    {  'L',  35,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  34 "+CHL"
+    {  'D',  36,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  35 "+CHLD"
+    {  ':',   0,   0, HFP_CMD_SUPPORT_CALL_HOLD_AND_MULTIPARTY_SERVICES }, //  36 "+CHLD:"
+    {  'I',  38,  44, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  37 "+CI"
+    {  'E',  39,  41, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  38 "+CIE"
+    {  'V',  40,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  39 "+CIEV"
+    {  ':',   0,   0, HFP_CMD_TRANSFER_AG_INDICATOR_STATUS              }, //  40 "+CIEV:"
+    {  'N',  42,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  41 "+CIN"
+    {  'D',  43,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  42 "+CIND"
+    {  ':',   0,   0, HFP_CMD_RETRIEVE_AG_INDICATORS_GENERIC            }, //  43 "+CIND:"
+    {  'L',  45,  51, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  44 "+CL"
+    {  'C',  46,  48, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  45 "+CLC"
+    {  'C',  47,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  46 "+CLCC"
+    {  ':',   0,   0, HFP_CMD_LIST_CURRENT_CALLS                        }, //  47 "+CLCC:"
+    {  'I',  49,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  48 "+CLI"
+    {  'P',  50,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  49 "+CLIP"
+    {  ':',   0,   0, HFP_CMD_AG_SENT_CLIP_INFORMATION                  }, //  50 "+CLIP:"
+    {  'M',  52,  60, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  51 "+CM"
+    {  'E',  53,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  52 "+CME"
+    {  ' ',  54,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  53 "+CME "
+    {  'E',  55,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  54 "+CME E"
+    {  'R',  56,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  55 "+CME ER"
+    {  'R',  57,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  56 "+CME ERR"
+    {  'O',  58,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  57 "+CME ERRO"
+    {  'R',  59,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  58 "+CME ERROR"
+    {  ':',   0,   0, HFP_CMD_EXTENDED_AUDIO_GATEWAY_ERROR              }, //  59 "+CME ERROR:"
+    {  'N',  61,  64, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  60 "+CN"
+    {  'U',  62,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  61 "+CNU"
+    {  'M',  63,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  62 "+CNUM"
+    {  ':',   0,   0, HFP_CMD_GET_SUBSCRIBER_NUMBER_INFORMATION         }, //  63 "+CNUM:"
+    {  'O',  65,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  64 "+CO"
+    {  'P',  66,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  65 "+COP"
+    {  'S',  67,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  66 "+COPS"
+    {  ':',   0,   0, HFP_CMD_QUERY_OPERATOR_SELECTION_NAME             }, //  67 "+COPS:"
+    {  'V',  69,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  68 "+V"
+    {  'G',  70,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  69 "+VG"
+    {  'M',  71,  73, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  70 "+VGM"
+    {  ':',   0,  72, HFP_CMD_SET_MICROPHONE_GAIN                       }, //  71 "+VGM:"
+    {  '=',   0,   0, HFP_CMD_SET_MICROPHONE_GAIN                       }, //  72 "+VGM="
+    {  'S',  74,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  73 "+VGS"
+    {  ':',   0,  75, HFP_CMD_SET_SPEAKER_GAIN                          }, //  74 "+VGS:"
+    {  '=',   0,   0, HFP_CMD_SET_SPEAKER_GAIN                          }, //  75 "+VGS="
+    {  'E',  77,  81, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  76 "E"
+    {  'R',  78,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  77 "ER"
+    {  'R',  79,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  78 "ERR"
+    {  'O',  80,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  79 "ERRO"
+    {  'R',   0,   0, HFP_CMD_ERROR                                     }, //  80 "ERROR"
+    {  'N',  82,  84, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  81 "N"
+    {  'O',  83,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  82 "NO"
+    {  'P',   0,   0, HFP_CMD_NONE                                      }, //  83 "NOP"
+    {  'O',  85,  86, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  84 "O"
+    {  'K',   0,   0, HFP_CMD_OK                                        }, //  85 "OK"
+    {  'R',  87,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  86 "R"
+    {  'I',  88,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  87 "RI"
+    {  'N',  89,   0, HFP_AT_COMMAND_TRIE_NO_COMMAND                    }, //  88 "RIN"
+    {  'G',   0,   0, HFP_CMD_RING                                      }, //  89 "RING"
+};
+
+#endif // HFP_AT_COMMAND_TRIE_H
@@ -97,6 +97,11 @@ static bool            hid_device_boot_protocol_mode_supported;
 static const uint8_t * hid_device_descriptor;
 static uint16_t        hid_device_descriptor_len;
 
+// optional compiled HID Descriptor
+static btstack_hid_field_t * hid_device_field_storage;
+static uint16_t              hid_device_field_storage_len;
+static uint16_t              hid_device_field_count;
+
 
 static uint16_t hid_device_cid = 0;
 
@@ -338,6 +343,30 @@ static inline void hid_device_emit_event(hid_device_t * context, uint8_t subeven
     hid_device_callback(HCI_EVENT_PACKET, context->cid, &event[0], pos);
 }
 
+static void hid_device_field_table_compile(void){
+    hid_device_field_count = 0;
+    if (hid_device_field_storage == NULL) return;
+    if (hid_device_descriptor == NULL) return;
+
+    uint16_t num_fields = btstack_hid_descriptor_compile(hid_device_descriptor, hid_device_descriptor_len,
+                                                         hid_device_field_storage, hid_device_field_storage_len);
+    if (num_fields > hid_device_field_storage_len){
+        log_info("HID Device: %u fields required for descriptor, %u available", num_fields, hid_device_field_storage_len);
+        return;
+    }
+    hid_device_field_count = num_fields;
+}
+
+static int hid_device_get_report_size_for_id(int report_id, hid_report_type_t report_type){
+    if (hid_device_field_count > 0u){
+        btstack_hid_field_table_t field_table;
+        field_table.fields     = hid_device_field_storage;
+        field_table.num_fields = hid_device_field_count;
+        return btstack_hid_field_table_get_report_size_for_id(&field_table, report_id, report_type);
+    }
+    return btstack_hid_get_report_size_for_id(report_id, report_type, hid_device_descriptor_len, hid_device_descriptor);
+}
+
 static int hid_report_size_valid(uint16_t cid, int report_id, hid_report_type_t report_type, int report_size){
     if (!report_size) return 0;
     if (hid_device_in_boot_protocol_mode(cid)){
@@ -352,13 +381,13 @@ static int hid_report_size_valid(uint16_t cid, int report_id, hid_report_type_t
                 return 0;
         }
     } else {
-        int size =  btstack_hid_get_report_size_for_id(report_id, report_type, hid_device_descriptor_len, hid_device_descriptor);
+        int size =  hid_device_get_report_size_for_id(report_id, report_type);
         if ((size == 0) || (size != report_size)) return 0;
     }
     return 1;
 }
 
-static int hid_get_report_size_for_id(uint16_t cid, int report_id, hid_report_type_t report_type, uint16_t descriptor_len, const uint8_t * descriptor){
+static int hid_get_report_size_for_id(uint16_t cid, int report_id, hid_report_type_t report_type){
     if (hid_device_in_boot_protocol_mode(cid)){
         switch (report_id){
             case HID_BOOT_MODE_KEYBOARD_ID:
@@ -369,7 +398,7 @@ static int hid_get_report_size_for_id(uint16_t cid, int report_id, hid_report_ty
                 return 0;
         }
     } else {
-        return btstack_hid_get_report_size_for_id(report_id, report_type, descriptor_len, descriptor);
+        return hid_device_get_report_size_for_id(report_id, report_type);
     }
 }
 
@@ -485,7 +514,7 @@ static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t * pack
                             break;
                     }
                     
-                    device->expected_report_size = hid_get_report_size_for_id(device->cid, device->report_id, device->report_type, hid_device_descriptor_len, hid_device_descriptor);
+                    device->expected_report_size = hid_get_report_size_for_id(device->cid, device->report_id, device->report_type);
                     report_size =  device->expected_report_size + pos; // add 1 for header size and report id
                     
                     if ((packet[0] & 0x08) && (packet_size >= (pos + 1))){
@@ -828,6 +857,7 @@ void hid_device_init(bool boot_protocol_mode_supported, uint16_t descriptor_len,
     hid_device_boot_protocol_mode_supported = boot_protocol_mode_supported;
     hid_device_descriptor =  descriptor;
     hid_device_descriptor_len = descriptor_len;
+    hid_device_field_table_compile();
     hci_device_get_report = dummy_write_report;
     hci_device_set_report = dummy_set_report;
     hci_device_report_data = dummy_report_data;
@@ -847,9 +877,18 @@ void hid_device_deinit(void){
     hid_device_boot_protocol_mode_supported = false;
     hid_device_descriptor = NULL;
     hid_device_descriptor_len = 0;
+    hid_device_field_storage = NULL;
+    hid_device_field_storage_len = 0;
+    hid_device_field_count = 0;
     hid_device_cid = 0;
 }
 
+void hid_device_init_field_storage(btstack_hid_field_t * hid_field_storage, uint16_t hid_field_storage_len){
+    hid_device_field_storage = hid_field_storage;
+    hid_device_field_storage_len = hid_field_storage_len;
+    hid_device_field_table_compile();
+}
+
 /**
  * @brief Register callback for the HID Device client. 
  * @param callback
@@ -90,6 +90,14 @@ void hid_create_sdp_record(uint8_t * service, uint32_t service_record_handle, co
  */
 void hid_device_init(bool boot_protocol_mode_supported, uint16_t hid_descriptor_len, const uint8_t * hid_descriptor);
 
+/**
+ * @brief Provide storage for compiled HID Descriptor. If set, report sizes are looked up in the compiled
+ * HID Descriptor instead of parsing the HID Descriptor for each report
+ * @param hid_field_storage
+ * @param hid_field_storage_len number of fields
+ */
+void hid_device_init_field_storage(btstack_hid_field_t * hid_field_storage, uint16_t hid_field_storage_len);
+
 /**
  * @brief Register callback for the HID Device client. 
  * @param callback
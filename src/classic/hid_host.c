@@ -68,6 +68,10 @@ static btstack_packet_handler_t hid_host_callback;
 static uint8_t * hid_host_descriptor_storage;
 static uint16_t  hid_host_descriptor_storage_len;
 
+// compiled descriptor storage
+static btstack_hid_field_t * hid_host_field_storage;
+static uint16_t              hid_host_field_storage_len;
+
 // SDP
 static uint8_t            hid_host_sdp_attribute_value[MAX_ATTRIBUTE_VALUE_SIZE];
 static const unsigned int hid_host_sdp_attribute_value_buffer_size = MAX_ATTRIBUTE_VALUE_SIZE;
@@ -134,7 +138,61 @@ static bool hid_descriptor_storage_store(hid_host_connection_t * connection, uin
     return true;
 }
 
+static uint16_t hid_field_storage_get_used_fields(void){
+    // assumes all field tables are back to back
+    uint16_t used_fields = 0;
+
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &hid_host_connections);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        hid_host_connection_t * connection = (hid_host_connection_t *)btstack_linked_list_iterator_next(&it);
+        used_fields += connection->hid_field_count;
+    }
+    return used_fields;
+}
+
+static void hid_field_storage_compile(hid_host_connection_t * connection){
+    if (hid_host_field_storage == NULL) return;
+    if (connection->hid_descriptor_status != ERROR_CODE_SUCCESS) return;
+    if (connection->hid_field_count > 0u) return;
+
+    uint16_t offset = hid_field_storage_get_used_fields();
+    uint16_t max_fields = hid_host_field_storage_len - offset;
+    uint16_t num_fields = btstack_hid_descriptor_compile(&hid_host_descriptor_storage[connection->hid_descriptor_offset],
+                                                         connection->hid_descriptor_len, &hid_host_field_storage[offset], max_fields);
+    if (num_fields > max_fields){
+        log_info("HID Host: %u fields required for descriptor, %u available", num_fields, max_fields);
+        return;
+    }
+    connection->hid_field_offset = offset;
+    connection->hid_field_count  = num_fields;
+}
+
+static void hid_field_storage_delete(hid_host_connection_t * connection){
+    uint16_t num_fields = connection->hid_field_count;
+    if (num_fields == 0u) return;
+    uint16_t next_offset = connection->hid_field_offset + num_fields;
+
+    memmove(&hid_host_field_storage[connection->hid_field_offset],
+            &hid_host_field_storage[next_offset],
+            (hid_host_field_storage_len - next_offset) * sizeof(btstack_hid_field_t));
+
+    connection->hid_field_count = 0;
+    connection->hid_field_offset = 0;
+
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &hid_host_connections);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        hid_host_connection_t * conn = (hid_host_connection_t *)btstack_linked_list_iterator_next(&it);
+        if ((conn->hid_field_count > 0u) && (conn->hid_field_offset >= next_offset)){
+            conn->hid_field_offset -= num_fields;
+        }
+    }
+}
+
 static void hid_descriptor_storage_delete(hid_host_connection_t * connection){
+    hid_field_storage_delete(connection);
+
     uint16_t next_offset = connection->hid_descriptor_offset + connection->hid_descriptor_len;
 
     memmove(&hid_host_descriptor_storage[connection->hid_descriptor_offset], 
@@ -171,6 +229,19 @@ uint16_t hid_descriptor_storage_get_descriptor_len(uint16_t hid_cid){
     return connection->hid_descriptor_len;
 }
 
+uint8_t hid_host_get_field_table(uint16_t hid_cid, btstack_hid_field_table_t * field_table){
+    hid_host_connection_t * connection = hid_host_get_connection_for_hid_cid(hid_cid);
+    if (!connection){
+        return ERROR_CODE_UNKNOWN_CONNECTION_IDENTIFIER;
+    }
+    if (connection->hid_field_count == 0u){
+        return ERROR_CODE_COMMAND_DISALLOWED;
+    }
+    field_table->fields     = &hid_host_field_storage[connection->hid_field_offset];
+    field_table->num_fields = connection->hid_field_count;
+    return ERROR_CODE_SUCCESS;
+}
+
 
 // HID Util
 static void hid_emit_connected_event(hid_host_connection_t * connection, uint8_t status){
@@ -192,6 +263,9 @@ static void hid_emit_connected_event(hid_host_connection_t * connection, uint8_t
 }   
 
 static void hid_emit_descriptor_available_event(hid_host_connection_t * connection){
+    // compile descriptor once before it is announced
+    hid_field_storage_compile(connection);
+
     uint8_t event[6];
     uint16_t pos = 0;
     event[pos++] = HCI_EVENT_HID_META;
@@ -1041,9 +1115,16 @@ void hid_host_init(uint8_t * hid_descriptor_storage, uint16_t hid_descriptor_sto
     l2cap_register_service(hid_host_packet_handler, PSM_HID_CONTROL, 0xffff, gap_get_security_level());
 }
 
+void hid_host_init_field_storage(btstack_hid_field_t * hid_field_storage, uint16_t hid_field_storage_len){
+    hid_host_field_storage = hid_field_storage;
+    hid_host_field_storage_len = hid_field_storage_len;
+}
+
 void hid_host_deinit(void){
     hid_host_callback = NULL;
     hid_host_descriptor_storage = NULL;
+    hid_host_field_storage = NULL;
+    hid_host_field_storage_len = 0;
     hid_host_sdp_context_control_cid = 0;
     hid_host_connections = NULL;
     hid_host_cid_counter = 0;
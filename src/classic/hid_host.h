@@ -112,6 +112,10 @@ typedef struct {
                                         // ERROR_CODE_UNSUPPORTED_FEATURE_OR_PARAMETER_VALUE if not, and 
                                         // ERROR_CODE_MEMORY_CAPACITY_EXCEEDED if descriptor is larger then the available space
 
+    // compiled descriptor in field storage, hid_field_count is 0 if not available
+    uint16_t hid_field_offset;
+    uint16_t hid_field_count;
+
     uint8_t   user_request_can_send_now; 
 
     // get report
@@ -138,6 +142,14 @@ typedef struct {
  */
 void hid_host_init(uint8_t * hid_descriptor_storage, uint16_t hid_descriptor_storage_len);
 
+/**
+ * @brief Provide storage for compiled HID Descriptors. If set, the HID Descriptor of a connection is compiled once
+ * before HID_SUBEVENT_DESCRIPTOR_AVAILABLE is emitted, see hid_host_get_field_table
+ * @param hid_field_storage
+ * @param hid_field_storage_len number of fields
+ */
+void hid_host_init_field_storage(btstack_hid_field_t * hid_field_storage, uint16_t hid_field_storage_len);
+
 /**
  * @brief Register callback for the HID Host. 
  * @param callback
@@ -276,6 +288,15 @@ const uint8_t * hid_descriptor_storage_get_descriptor_data(uint16_t hid_cid);
  */
 uint16_t hid_descriptor_storage_get_descriptor_len(uint16_t hid_cid);
 
+/*
+ * @brief Get compiled HID Descriptor to decode reports with btstack_hid_report_decoder_init
+ * @param hid_cid
+ * @param field_table
+ * @result status ERROR_CODE_SUCCESS on success, otherwise ERROR_CODE_UNKNOWN_CONNECTION_IDENTIFIER, or 
+ *         ERROR_CODE_COMMAND_DISALLOWED if no field storage was provided, descriptor is not available, or field storage is full
+ */
+uint8_t hid_host_get_field_table(uint16_t hid_cid, btstack_hid_field_table_t * field_table);
+
 /**
  * @brief De-Init HID Device
  */
@@ -60,6 +60,7 @@
 #include "classic/goep_client.h"
 #include "classic/pbap.h"
 #include "classic/pbap_client.h"
+#include "classic/vcard_parser.h"
 
 // 796135f0-f0c5-11d8-0966- 0800200c9a66
 static const uint8_t pbap_uuid[] = { 0x79, 0x61, 0x35, 0xf0, 0xf0, 0xc5, 0x11, 0xd8, 0x09, 0x66, 0x08, 0x00, 0x20, 0x0c, 0x9a, 0x66};
@@ -197,6 +198,21 @@ typedef struct pbap_client {
     /* srm */
     obex_srm_t obex_srm;
     srm_state_t srm_state;
+    bool srm_client_wait;
+    /* vcard parser */
+    bool vcard_parsing_enabled;
+    vcard_parser_t vcard_parser;
+    uint16_t card_index;
+    bool     card_have_formatted_name;
+    char     card_name[PBAP_MAX_NAME_LEN];
+    uint8_t  card_name_len;
+    char     card_number[PBAP_MAX_PHONE_NUMBER_LEN];
+    uint8_t  card_number_len;
+    char *   card_value_buffer;
+    uint8_t *card_value_len;
+    uint8_t  card_value_size;
+    uint8_t  card_quoted_printable_state;
+    uint8_t  card_quoted_printable_high;
 } pbap_client_t;
 
 static uint32_t pbap_client_supported_features;
@@ -304,6 +320,26 @@ static void pbap_client_emit_card_result_event(pbap_client_t * context, const ch
     context->client_handler(HCI_EVENT_PACKET, context->cid, &event[0], pos);
 }
 
+static void pbap_client_emit_vcard_result_event(pbap_client_t * context){
+    uint8_t event[9 + PBAP_MAX_NAME_LEN + PBAP_MAX_PHONE_NUMBER_LEN];
+    int pos = 0;
+    event[pos++] = HCI_EVENT_PBAP_META;
+    pos++;  // skip len
+    event[pos++] = PBAP_SUBEVENT_VCARD_RESULT;
+    little_endian_store_16(event,pos,context->cid);
+    pos+=2;
+    little_endian_store_16(event,pos,context->card_index);
+    pos+=2;
+    event[pos++] = context->card_name_len;
+    (void)memcpy(&event[pos], context->card_name, context->card_name_len);
+    pos += context->card_name_len;
+    event[pos++] = context->card_number_len;
+    (void)memcpy(&event[pos], context->card_number, context->card_number_len);
+    pos += context->card_number_len;
+    event[1] = pos - 2;
+    context->client_handler(HCI_EVENT_PACKET, context->cid, &event[0], pos);
+}
+
 static const uint8_t collon = (uint8_t) ':';
 
 static void pbap_client_vcard_listing_init_parser(pbap_client_t * client){
@@ -502,6 +538,107 @@ static void pbap_client_process_vcard_list_body(const uint8_t * data, uint16_t d
     }
 }
 
+static void pbap_client_vcard_append_byte(pbap_client_t * client, uint8_t value){
+    if (*client->card_value_len < client->card_value_size){
+        client->card_value_buffer[(*client->card_value_len)++] = (char) value;
+    }
+}
+
+static void pbap_client_vcard_append_value(pbap_client_t * client, const uint8_t * data, uint16_t data_len, bool quoted_printable){
+    uint16_t i;
+    if (quoted_printable == false){
+        for (i = 0; i < data_len; i++){
+            pbap_client_vcard_append_byte(client, data[i]);
+        }
+        return;
+    }
+    // decode =XX escapes, state survives chunk boundaries
+    for (i = 0; i < data_len; i++){
+        uint8_t c = data[i];
+        int nibble;
+        switch (client->card_quoted_printable_state){
+            case 1:
+                nibble = nibble_for_char((char) c);
+                if (nibble < 0){
+                    pbap_client_vcard_append_byte(client, '=');
+                    pbap_client_vcard_append_byte(client, c);
+                    client->card_quoted_printable_state = 0;
+                    break;
+                }
+                client->card_quoted_printable_high = c;
+                client->card_quoted_printable_state = 2;
+                break;
+            case 2:
+                client->card_quoted_printable_state = 0;
+                nibble = nibble_for_char((char) c);
+                if (nibble < 0){
+                    pbap_client_vcard_append_byte(client, '=');
+                    pbap_client_vcard_append_byte(client, client->card_quoted_printable_high);
+                    pbap_client_vcard_append_byte(client, c);
+                    break;
+                }
+                pbap_client_vcard_append_byte(client, (uint8_t) ((nibble_for_char((char) client->card_quoted_printable_high) << 4) | nibble));
+                break;
+            default:
+                if (c == '='){
+                    client->card_quoted_printable_state = 1;
+                } else {
+                    pbap_client_vcard_append_byte(client, c);
+                }
+                break;
+        }
+    }
+}
+
+static void pbap_client_vcard_parser_callback(void * user_data, vcard_parser_event_t event, const vcard_parser_property_t * property, const uint8_t * data_buffer, uint16_t data_len){
+    pbap_client_t * client = (pbap_client_t *) user_data;
+    switch (event){
+        case VCARD_PARSER_EVENT_CARD_BEGIN:
+            client->card_have_formatted_name = false;
+            client->card_name_len = 0;
+            client->card_number_len = 0;
+            client->card_value_buffer = NULL;
+            break;
+        case VCARD_PARSER_EVENT_PROPERTY_VALUE:
+            if (property->value_len == 0u){
+                // first chunk: select target, prefer FN over N, use first TEL
+                client->card_value_buffer = NULL;
+                client->card_quoted_printable_state = 0;
+                bool formatted_name = strcmp(property->name, "FN") == 0;
+                if (formatted_name || ((strcmp(property->name, "N") == 0) && (client->card_have_formatted_name == false))){
+                    client->card_have_formatted_name = client->card_have_formatted_name || formatted_name;
+                    client->card_name_len     = 0;
+                    client->card_value_buffer = client->card_name;
+                    client->card_value_len    = &client->card_name_len;
+                    client->card_value_size   = sizeof(client->card_name);
+                } else if ((strcmp(property->name, "TEL") == 0) && (client->card_number_len == 0u)){
+                    client->card_value_buffer = client->card_number;
+                    client->card_value_len    = &client->card_number_len;
+                    client->card_value_size   = sizeof(client->card_number);
+                }
+            }
+            if (client->card_value_buffer != NULL){
+                pbap_client_vcard_append_value(client, data_buffer, data_len, property->quoted_printable);
+            }
+            break;
+        case VCARD_PARSER_EVENT_PROPERTY_END:
+            client->card_value_buffer = NULL;
+            break;
+        case VCARD_PARSER_EVENT_CARD_END:
+            pbap_client_emit_vcard_result_event(client);
+            client->card_index++;
+            break;
+        default:
+            btstack_unreachable();
+            break;
+    }
+}
+
+static void pbap_client_vcard_init_parser(pbap_client_t * client){
+    vcard_parser_init(&client->vcard_parser, &pbap_client_vcard_parser_callback, client);
+    client->card_index = 0;
+}
+
 static void pbap_client_parser_callback_connect(void * user_data, uint8_t header_id, uint16_t total_len, uint16_t data_offset, const uint8_t * data_buffer, uint16_t data_len){
     pbap_client_t * client = (pbap_client_t *) user_data;
     switch (header_id){
@@ -545,7 +682,11 @@ static void pbap_client_parser_callback_get_operation(void * user_data, uint8_t
             switch(pbap_client->state){
                 case PBAP_W4_PHONEBOOK:
                 case PBAP_W4_GET_CARD_ENTRY_COMPLETE:
+                    // body chunk points into L2CAP/RFCOMM receive buffer
                     client->client_handler(PBAP_DATA_PACKET, client->cid, (uint8_t *) data_buffer, data_len);
+                    if (client->vcard_parsing_enabled){
+                        vcard_parser_process_data(&client->vcard_parser, data_buffer, data_len);
+                    }
                     if (data_offset + data_len == total_len){
                         client->flow_wait_for_user = true;
                     }
@@ -656,13 +797,29 @@ static void pbap_client_add_application_parameters(const pbap_client_t * client,
     }
 }
 
-static void pbap_client_prepare_srm_header(const pbap_client_t * client){
-    if (!client->flow_control_enabled && goep_client_version_20_or_higher(client->goep_cid)){
+static void pbap_client_add_srmp_wait_header(pbap_client_t * client){
+    goep_client_header_add_byte(client->goep_cid, OBEX_HEADER_SINGLE_RESPONSE_MODE_PARAMETER, OBEX_SRMP_WAIT);
+    client->srm_client_wait = true;
+}
+
+// SRM is used whenever the PSE supports it. In flow control mode, SRMP 'wait' lets the PSE
+// wait for the next GET request, which is sent after pbap_next_packet was called.
+static void pbap_client_prepare_srm_header(pbap_client_t * client, bool use_flow_control){
+    client->srm_state = SRM_DISABLED;
+    client->srm_client_wait = false;
+    if (goep_client_version_20_or_higher(client->goep_cid)){
         goep_client_header_add_srm_enable(client->goep_cid);
-        pbap_client->srm_state = SRM_W4_CONFIRM;
+        client->srm_state = SRM_W4_CONFIRM;
+        if (use_flow_control){
+            pbap_client_add_srmp_wait_header(client);
+        }
     }
 }
 
+static bool pbap_client_srm_streaming(const pbap_client_t * client){
+    return (client->srm_state == SRM_ENABLED) && (client->srm_client_wait == false);
+}
+
 static void pbap_client_prepare_get_operation(pbap_client_t * client){
     obex_parser_init_for_response(&client->obex_parser, OBEX_OPCODE_GET, pbap_client_parser_callback_get_operation, pbap_client);
     obex_srm_init(&client->obex_srm);
@@ -756,7 +913,7 @@ static void pbap_handle_can_send_now(void){
         case PBAP_W2_GET_PHONEBOOK_SIZE:
             // prepare request
             goep_client_request_create_get(pbap_client->goep_cid);
-            pbap_client_prepare_srm_header(pbap_client);
+            pbap_client_prepare_srm_header(pbap_client, false);
             goep_client_header_add_name(pbap_client->goep_cid, pbap_client->phonebook_path);
             goep_client_header_add_type(pbap_client->goep_cid, pbap_phonebook_type);
 
@@ -779,7 +936,7 @@ static void pbap_handle_can_send_now(void){
             // prepare request
             goep_client_request_create_get(pbap_client->goep_cid);
             if (pbap_client->request_number == 0){
-                pbap_client_prepare_srm_header(pbap_client);
+                pbap_client_prepare_srm_header(pbap_client, pbap_client->flow_control_enabled != 0);
                 goep_client_header_add_name(pbap_client->goep_cid, pbap_client->phonebook_path);
                 goep_client_header_add_type(pbap_client->goep_cid, pbap_phonebook_type);
 
@@ -787,6 +944,13 @@ static void pbap_handle_can_send_now(void){
                 pos += pbap_client_application_params_add_property_selector(pbap_client, &application_parameters[pos]);
                 pos += pbap_client_application_params_add_vcard_selector(pbap_client, &application_parameters[pos]);
                 pbap_client_add_application_parameters(pbap_client, application_parameters, pos);
+            } else if (pbap_client->srm_client_wait){
+                // keep PSE waiting while in flow control mode, otherwise let it stream the rest
+                if (pbap_client->flow_control_enabled){
+                    pbap_client_add_srmp_wait_header(pbap_client);
+                } else {
+                    pbap_client->srm_client_wait = false;
+                }
             }
             // state
             pbap_client->state = PBAP_W4_PHONEBOOK;
@@ -802,7 +966,7 @@ static void pbap_handle_can_send_now(void){
             // prepare request
             goep_client_request_create_get(pbap_client->goep_cid);
             if (pbap_client->request_number == 0){
-                pbap_client_prepare_srm_header(pbap_client);
+                pbap_client_prepare_srm_header(pbap_client, false);
                 goep_client_header_add_name(pbap_client->goep_cid, pbap_client->phonebook_path);
                 goep_client_header_add_type(pbap_client->goep_cid, pbap_vcard_listing_type);
 
@@ -823,7 +987,7 @@ static void pbap_handle_can_send_now(void){
             // prepare request
             goep_client_request_create_get(pbap_client->goep_cid);
             if (pbap_client->request_number == 0){
-                pbap_client_prepare_srm_header(pbap_client);
+                pbap_client_prepare_srm_header(pbap_client, false);
                 goep_client_header_add_name(pbap_client->goep_cid, pbap_client->vcard_name);
                 goep_client_header_add_type(pbap_client->goep_cid, pbap_vcard_entry_type);
 
@@ -1021,7 +1185,7 @@ static void pbap_packet_handler_goep(uint8_t *packet, uint16_t size){
                 switch (op_info.response_code) {
                     case OBEX_RESP_CONTINUE:
                         pbap_client_handle_srm_headers(pbap_client);
-                        if (pbap_client->srm_state == SRM_ENABLED) {
+                        if (pbap_client_srm_streaming(pbap_client)) {
                             // prepare response
                             pbap_client_prepare_get_operation(pbap_client);
                             break;
@@ -1064,7 +1228,7 @@ static void pbap_packet_handler_goep(uint8_t *packet, uint16_t size){
                     case OBEX_RESP_CONTINUE:
                         // handle continue
                         pbap_client_handle_srm_headers(pbap_client);
-                        if (pbap_client->srm_state == SRM_ENABLED) {
+                        if (pbap_client_srm_streaming(pbap_client)) {
                             // prepare response
                             pbap_client_prepare_get_operation(pbap_client);
                             break;
@@ -1092,7 +1256,7 @@ static void pbap_packet_handler_goep(uint8_t *packet, uint16_t size){
                 switch (op_info.response_code) {
                     case OBEX_RESP_CONTINUE:
                         pbap_client_handle_srm_headers(pbap_client);
-                        if (pbap_client->srm_state == SRM_ENABLED) {
+                        if (pbap_client_srm_streaming(pbap_client)) {
                             // prepare response
                             pbap_client_prepare_get_operation(pbap_client);
                             break;
@@ -1214,6 +1378,7 @@ uint8_t pbap_pull_phonebook(uint16_t pbap_cid, const char * path){
     pbap_client->phonebook_path = path;
     pbap_client->vcard_name = NULL;
     pbap_client->request_number = 0;
+    pbap_client_vcard_init_parser(pbap_client);
     goep_client_request_can_send_now(pbap_client->goep_cid);
     return ERROR_CODE_SUCCESS;
 }
@@ -1265,6 +1430,7 @@ uint8_t pbap_pull_vcard_entry(uint16_t pbap_cid, const char * path){
     // pbap_client->phone_number = NULL;
     pbap_client->vcard_name = path;
     pbap_client->request_number = 0;
+    pbap_client_vcard_init_parser(pbap_client);
     goep_client_request_can_send_now(pbap_client->goep_cid);
     return ERROR_CODE_SUCCESS;
 }
@@ -1347,3 +1513,12 @@ uint8_t pbap_set_property_selector(uint16_t pbap_cid, uint32_t property_selector
     pbap_client->property_selector  = property_selector;
     return ERROR_CODE_SUCCESS;
 }
+
+uint8_t pbap_set_vcard_parsing(uint16_t pbap_cid, int enable){
+    UNUSED(pbap_cid);
+    if (pbap_client->state != PBAP_CONNECTED){
+        return BTSTACK_BUSY;
+    }
+    pbap_client->vcard_parsing_enabled = enable != 0;
+    return ERROR_CODE_SUCCESS;
+}
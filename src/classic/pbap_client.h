@@ -146,6 +146,9 @@ uint8_t pbap_get_phonebook_size(uint16_t pbap_cid, const char * path);
 /**
  * @brief Pull phone book from PSE. The result is reported via registered packet handler (see pbap_connect function),
  * with packet type set to PBAP_DATA_PACKET. Event PBAP_SUBEVENT_OPERATION_COMPLETED marks the end of the phone book. 
+ * Single Response Mode (SRM) is used if supported by the PSE.
+ * @note PBAP_DATA_PACKET points into the L2CAP/RFCOMM receive buffer and is only valid during the callback
+ * @note With vCard parsing enabled, PBAP_SUBEVENT_VCARD_RESULT is emitted for each vCard
  * 
  * @param pbap_cid
  * @param path - note: path is not copied, common path 'telecom/pb.vcf'
@@ -195,7 +198,8 @@ uint8_t pbap_abort(uint16_t pbap_cid);
 
 /**
  * @brief Set flow control mode - default is off. No event is emitted.
- * @note When enabled, pbap_next_packet needs to be called after a packet was processed to receive the next one
+ * @note When enabled, pbap_next_packet needs to be called after a packet was processed to receive the next one.
+ *       With SRM, the PSE is asked to wait for the next request via SRMP header.
  *
  * @param pbap_cid
  * @return status ERROR_CODE_SUCCESS on success, otherwise BTSTACK_BUSY if in a wrong state.
@@ -209,6 +213,17 @@ uint8_t pbap_set_flow_control_mode(uint16_t pbap_cid, int enable);
  */
 uint8_t pbap_next_packet(uint16_t pbap_cid);
 
+/**
+ * @brief Enable incremental vCard parsing for pull phonebook and pull vCard entry - default is off. No event is emitted.
+ * @note When enabled, PBAP_SUBEVENT_VCARD_RESULT with name (FN or N) and first phone number (TEL) is emitted for each vCard
+ *       in addition to the PBAP_DATA_PACKETs. Quoted-Printable values are decoded, values are truncated to
+ *       PBAP_MAX_NAME_LEN and PBAP_MAX_PHONE_NUMBER_LEN.
+ * @param pbap_cid
+ * @param enable
+ * @return status ERROR_CODE_SUCCESS on success, otherwise BTSTACK_BUSY if in a wrong state.
+ */
+uint8_t pbap_set_vcard_parsing(uint16_t pbap_cid, int enable);
+
 /**
  * @brief De-Init PBAP Client
  */
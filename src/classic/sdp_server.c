@@ -41,6 +41,7 @@
  * Implementation of the Service Discovery Protocol Server 
  */
 
+#include <inttypes.h>
 #include <string.h>
 
 #include "bluetooth.h"
@@ -84,17 +85,314 @@ static uint16_t sdp_server_response_size;
 static uint16_t sdp_server_l2cap_waiting_list_cids[SDP_WAITING_LIST_MAX_COUNT];
 static int      sdp_server_l2cap_waiting_list_count;
 
+#ifdef ENABLE_SDP_SERVER_INDEX
+
+// max number of UUIDs in ServiceSearchPattern, spec allows 12
+#ifndef MAX_SDP_SERVER_INDEX_PATTERN_UUIDS
+#define MAX_SDP_SERVER_INDEX_PATTERN_UUIDS 12
+#endif
+
+// max number of attribute IDs and ranges in AttributeIDList
+#ifndef MAX_SDP_SERVER_INDEX_ATTRIBUTE_RANGES
+#define MAX_SDP_SERVER_INDEX_ATTRIBUTE_RANGES 16
+#endif
+
+// max size of request parameters (without continuation state) stored for continuation requests
+#ifndef SDP_SERVER_CONTINUATION_CACHE_REQUEST_SIZE
+#define SDP_SERVER_CONTINUATION_CACHE_REQUEST_SIZE 64
+#endif
+
+// ServiceSearchPattern of current request
+static bool     sdp_server_pattern_valid;
+// pattern contains invalid element, no record matches
+static bool     sdp_server_pattern_matches_none;
+// pattern contains 128-bit UUIDs that are not based on the Bluetooth Base UUID
+static bool     sdp_server_pattern_has_uuid128;
+static uint8_t  sdp_server_pattern_num_uuids;
+static uint32_t sdp_server_pattern_uuids[MAX_SDP_SERVER_INDEX_PATTERN_UUIDS];
+
+// AttributeIDList of current request as inclusive ranges
+static bool     sdp_server_attribute_ranges_valid;
+static uint8_t  sdp_server_attribute_ranges_num;
+static uint16_t sdp_server_attribute_ranges_start[MAX_SDP_SERVER_INDEX_ATTRIBUTE_RANGES];
+static uint16_t sdp_server_attribute_ranges_end[MAX_SDP_SERVER_INDEX_ATTRIBUTE_RANGES];
+
+// state after last response with continuation, allows to resume without walking and matching all records again
+static uint8_t  sdp_server_continuation_cache_pdu_id;
+static uint16_t sdp_server_continuation_cache_request_len;
+static uint8_t  sdp_server_continuation_cache_request[SDP_SERVER_CONTINUATION_CACHE_REQUEST_SIZE];
+// total service count or total attribute lists size
+static uint16_t sdp_server_continuation_cache_total;
+static uint16_t sdp_server_continuation_cache_matching_count;
+static uint16_t sdp_server_continuation_cache_service_index;
+static service_record_item_t * sdp_server_continuation_cache_item;
+
+#endif
+
 void sdp_init(void){
     sdp_server_next_service_record_handle = ((uint32_t) MAX_RESERVED_SERVICE_RECORD_HANDLE) + 2;
     // register with l2cap psm sevices - max MTU
     l2cap_register_service(sdp_packet_handler, BLUETOOTH_PSM_SDP, 0xffff, LEVEL_0);
 }
 
+#ifdef ENABLE_SDP_SERVER_INDEX
+
+static void sdp_server_continuation_cache_invalidate(void){
+    sdp_server_continuation_cache_pdu_id = 0;
+}
+
+// @return true if request parameters match cached request and continuation index points to cached item
+static bool sdp_server_continuation_cache_lookup(uint8_t pdu_id, const uint8_t * request, uint16_t request_len, uint16_t service_index){
+    if (sdp_server_continuation_cache_pdu_id != pdu_id) return false;
+    if (sdp_server_continuation_cache_request_len != request_len) return false;
+    if (sdp_server_continuation_cache_service_index != service_index) return false;
+    return memcmp(sdp_server_continuation_cache_request, request, request_len) == 0;
+}
+
+static void sdp_server_continuation_cache_store(uint8_t pdu_id, const uint8_t * request, uint16_t request_len, uint16_t total,
+                                                uint16_t matching_count, uint16_t service_index, service_record_item_t * item){
+    if (request_len > SDP_SERVER_CONTINUATION_CACHE_REQUEST_SIZE) {
+        sdp_server_continuation_cache_invalidate();
+        return;
+    }
+    sdp_server_continuation_cache_pdu_id = pdu_id;
+    sdp_server_continuation_cache_request_len = request_len;
+    (void)memcpy(sdp_server_continuation_cache_request, request, request_len);
+    sdp_server_continuation_cache_total = total;
+    sdp_server_continuation_cache_matching_count = matching_count;
+    sdp_server_continuation_cache_service_index = service_index;
+    sdp_server_continuation_cache_item = item;
+}
+
+// @return false if UUID is invalid
+static bool sdp_server_index_get_uuid32(const uint8_t * element, uint32_t * uuid32, bool * is_uuid128){
+    uint8_t uuid128[16];
+    if (!de_get_normalized_uuid(uuid128, element)) return false;
+    *is_uuid128 = uuid_has_bluetooth_prefix(uuid128) == 0;
+    *uuid32 = big_endian_read_32(uuid128, 0);
+    return true;
+}
+
+// collect UUIDs in data element sequences, same traversal as sdp_record_contains_UUID128
+static bool sdp_server_index_add_uuids(service_record_item_t * item, const uint8_t * element){
+    uint32_t pos = de_get_header_size(element);
+    uint32_t end_pos = de_get_len(element);
+    while (pos < end_pos){
+        const uint8_t * child = &element[pos];
+        uint32_t uuid32;
+        bool is_uuid128;
+        uint8_t i;
+        switch (de_get_element_type(child)){
+            case DE_UUID:
+                if (!sdp_server_index_get_uuid32(child, &uuid32, &is_uuid128)) break;
+                if (is_uuid128){
+                    item->index_has_uuid128 = true;
+                    break;
+                }
+                for (i = 0; i < item->index_num_uuids; i++){
+                    if (item->index_uuids[i] == uuid32) break;
+                }
+                if (i < item->index_num_uuids) break;
+                if (item->index_num_uuids == MAX_SDP_SERVER_INDEX_UUIDS) return false;
+                item->index_uuids[item->index_num_uuids++] = uuid32;
+                break;
+            case DE_DES:
+                if (!sdp_server_index_add_uuids(item, child)) return false;
+                break;
+            default:
+                break;
+        }
+        pos += de_get_len(child);
+    }
+    return true;
+}
+
+// collect attribute IDs and offsets, same traversal as sdp_attribute_list_traverse_sequence
+static bool sdp_server_index_add_attributes(service_record_item_t * item){
+    const uint8_t * record = item->service_record;
+    uint32_t pos = de_get_header_size(record);
+    uint32_t end_pos = de_get_len(record);
+    if (end_pos > 0xffffu) return false;
+    while (pos < end_pos){
+        if (item->index_num_attributes == MAX_SDP_SERVER_INDEX_ATTRIBUTES) return false;
+        if (de_get_element_type(&record[pos]) != DE_UINT) return false;
+        if (de_get_size_type(&record[pos])    != DE_SIZE_16) return false;
+        if ((pos + 3u) >= end_pos) return false;
+        item->index_attribute_ids[item->index_num_attributes] = (uint16_t) big_endian_read_16(record, pos + 1u);
+        item->index_attribute_offsets[item->index_num_attributes] = (uint16_t) pos;
+        item->index_num_attributes++;
+        pos += 3u + de_get_len(&record[pos + 3u]);
+    }
+    if (pos != end_pos) return false;
+    item->index_attribute_offsets[item->index_num_attributes] = (uint16_t) pos;
+    return true;
+}
+
+static void sdp_server_index_build(service_record_item_t * item){
+    item->index_valid = false;
+    item->index_has_uuid128 = false;
+    item->index_num_uuids = 0;
+    item->index_num_attributes = 0;
+    if (de_get_element_type(item->service_record) != DE_DES) return;
+    if (!sdp_server_index_add_uuids(item, item->service_record)){
+        log_info("SDP Index: record 0x%08" PRIx32 " has more than %u UUIDs", item->service_record_handle, MAX_SDP_SERVER_INDEX_UUIDS);
+        return;
+    }
+    if (!sdp_server_index_add_attributes(item)){
+        log_info("SDP Index: record 0x%08" PRIx32 " has more than %u attributes or is malformed", item->service_record_handle, MAX_SDP_SERVER_INDEX_ATTRIBUTES);
+        return;
+    }
+    item->index_valid = true;
+}
+
+// parse ServiceSearchPattern of current request
+static void sdp_server_index_prepare_pattern(const uint8_t * service_search_pattern){
+    sdp_server_pattern_valid = false;
+    sdp_server_pattern_matches_none = false;
+    sdp_server_pattern_has_uuid128 = false;
+    sdp_server_pattern_num_uuids = 0;
+    if (de_get_element_type(service_search_pattern) != DE_DES) return;
+    uint32_t pos = de_get_header_size(service_search_pattern);
+    uint32_t end_pos = de_get_len(service_search_pattern);
+    while (pos < end_pos){
+        uint32_t uuid32;
+        bool is_uuid128;
+        if (!sdp_server_index_get_uuid32(&service_search_pattern[pos], &uuid32, &is_uuid128)){
+            sdp_server_pattern_matches_none = true;
+        } else if (is_uuid128){
+            sdp_server_pattern_has_uuid128 = true;
+        } else {
+            if (sdp_server_pattern_num_uuids == MAX_SDP_SERVER_INDEX_PATTERN_UUIDS) return;
+            sdp_server_pattern_uuids[sdp_server_pattern_num_uuids++] = uuid32;
+        }
+        pos += de_get_len(&service_search_pattern[pos]);
+    }
+    sdp_server_pattern_valid = true;
+}
+
+// parse AttributeIDList of current request
+static void sdp_server_index_prepare_attribute_ranges(const uint8_t * attribute_id_list){
+    sdp_server_attribute_ranges_valid = false;
+    sdp_server_attribute_ranges_num = 0;
+    if (de_get_element_type(attribute_id_list) == DE_DES){
+        uint32_t pos = de_get_header_size(attribute_id_list);
+        uint32_t end_pos = de_get_len(attribute_id_list);
+        while (pos < end_pos){
+            const uint8_t * element = &attribute_id_list[pos];
+            pos += de_get_len(element);
+            if (de_get_element_type(element) != DE_UINT) continue;
+            uint16_t start;
+            uint16_t end;
+            switch (de_get_size_type(element)){
+                case DE_SIZE_16:
+                    start = (uint16_t) big_endian_read_16(element, 1);
+                    end = start;
+                    break;
+                case DE_SIZE_32:
+                    start = (uint16_t) big_endian_read_16(element, 1);
+                    end = (uint16_t) big_endian_read_16(element, 3);
+                    break;
+                default:
+                    continue;
+            }
+            if (sdp_server_attribute_ranges_num == MAX_SDP_SERVER_INDEX_ATTRIBUTE_RANGES) return;
+            sdp_server_attribute_ranges_start[sdp_server_attribute_ranges_num] = start;
+            sdp_server_attribute_ranges_end[sdp_server_attribute_ranges_num] = end;
+            sdp_server_attribute_ranges_num++;
+        }
+    }
+    sdp_server_attribute_ranges_valid = true;
+}
+
+static bool sdp_server_index_attribute_requested(uint16_t attribute_id){
+    uint8_t i;
+    for (i = 0; i < sdp_server_attribute_ranges_num; i++){
+        if ((sdp_server_attribute_ranges_start[i] <= attribute_id) && (attribute_id <= sdp_server_attribute_ranges_end[i])) return true;
+    }
+    return false;
+}
+
+static bool sdp_server_index_contains_uuid(const service_record_item_t * item, uint32_t uuid32){
+    uint8_t i;
+    for (i = 0; i < item->index_num_uuids; i++){
+        if (item->index_uuids[i] == uuid32) return true;
+    }
+    return false;
+}
+#endif
+
+static bool sdp_server_record_matches_service_search_pattern(service_record_item_t * item, uint8_t * service_search_pattern){
+#ifdef ENABLE_SDP_SERVER_INDEX
+    if (item->index_valid && sdp_server_pattern_valid){
+        if (sdp_server_pattern_matches_none) return false;
+        uint8_t i;
+        for (i = 0; i < sdp_server_pattern_num_uuids; i++){
+            if (!sdp_server_index_contains_uuid(item, sdp_server_pattern_uuids[i])) return false;
+        }
+        if (!sdp_server_pattern_has_uuid128) return true;
+        // 128-bit UUIDs are not indexed
+        if (!item->index_has_uuid128) return false;
+    }
+#endif
+    return sdp_record_matches_service_search_pattern(item->service_record, service_search_pattern) != 0;
+}
+
+static uint16_t sdp_server_get_filtered_size(service_record_item_t * item, uint8_t * attribute_id_list){
+#ifdef ENABLE_SDP_SERVER_INDEX
+    if (item->index_valid && sdp_server_attribute_ranges_valid){
+        uint16_t size = 0;
+        uint8_t i;
+        for (i = 0; i < item->index_num_attributes; i++){
+            if (!sdp_server_index_attribute_requested(item->index_attribute_ids[i])) continue;
+            size += (uint16_t) (item->index_attribute_offsets[i+1] - item->index_attribute_offsets[i]);
+        }
+        return size;
+    }
+#endif
+    return spd_get_filtered_size(item->service_record, attribute_id_list);
+}
+
+// copy attributes in attribute ID list starting at offset, see sdp_filter_attributes_in_attributeIDList
+static int sdp_server_filter_attributes(service_record_item_t * item, uint8_t * attribute_id_list, uint16_t start_offset, uint16_t max_bytes, uint16_t * used_bytes, uint8_t * buffer){
+#ifdef ENABLE_SDP_SERVER_INDEX
+    if (item->index_valid && sdp_server_attribute_ranges_valid){
+        uint16_t pos = 0;
+        uint8_t i;
+        for (i = 0; i < item->index_num_attributes; i++){
+            if (!sdp_server_index_attribute_requested(item->index_attribute_ids[i])) continue;
+            // attribute ID element and attribute value are stored back to back in record
+            uint16_t offset = item->index_attribute_offsets[i];
+            uint16_t len = item->index_attribute_offsets[i+1] - offset;
+            if (start_offset >= len){
+                start_offset -= len;
+                continue;
+            }
+            offset += start_offset;
+            len    -= start_offset;
+            start_offset = 0;
+            if (len > (max_bytes - pos)){
+                (void)memcpy(&buffer[pos], &item->service_record[offset], max_bytes - pos);
+                *used_bytes = max_bytes;
+                return 0;
+            }
+            (void)memcpy(&buffer[pos], &item->service_record[offset], len);
+            pos += len;
+        }
+        *used_bytes = pos;
+        return 1;
+    }
+#endif
+    return sdp_filter_attributes_in_attributeIDList(item->service_record, attribute_id_list, start_offset, max_bytes, used_bytes, buffer);
+}
+
 void sdp_deinit(void){
     sdp_server_service_records = NULL;
     sdp_server_l2cap_cid = 0;
     sdp_server_response_size = 0;
     sdp_server_l2cap_waiting_list_count = 0;
+#ifdef ENABLE_SDP_SERVER_INDEX
+    sdp_server_continuation_cache_invalidate();
+#endif
 }
 
 uint32_t sdp_get_service_record_handle(const uint8_t * record){
@@ -155,7 +453,12 @@ uint8_t sdp_register_service(const uint8_t * record){
     // set handle and record
     newRecordItem->service_record_handle = record_handle;
     newRecordItem->service_record = (uint8_t*) record;
-    
+
+#ifdef ENABLE_SDP_SERVER_INDEX
+    sdp_server_index_build(newRecordItem);
+    sdp_server_continuation_cache_invalidate();
+#endif
+
     // add to linked list
     btstack_linked_list_add(&sdp_server_service_records, (btstack_linked_item_t *) newRecordItem);
     
@@ -170,6 +473,9 @@ void sdp_unregister_service(uint32_t service_record_handle){
     if (!record_item) return;
     btstack_linked_list_remove(&sdp_server_service_records, (btstack_linked_item_t *) record_item);
     btstack_memory_service_record_item_free(record_item);
+#ifdef ENABLE_SDP_SERVER_INDEX
+    sdp_server_continuation_cache_invalidate();
+#endif
 }
 
 // PDU
@@ -213,27 +519,45 @@ int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu){
         continuation_index = big_endian_read_16(continuationState, 1);
     }
     
-    // get and limit total count
-    btstack_linked_item_t *it;
-    uint16_t total_service_count   = 0;
-    for (it = (btstack_linked_item_t *) sdp_server_service_records; it ; it = it->next){
-        service_record_item_t * item = (service_record_item_t *) it;
-        if (!sdp_record_matches_service_search_pattern(item->service_record, serviceSearchPattern)) continue;
-        total_service_count++;
-    }
-    if (total_service_count > maximumServiceRecordCount){
-        total_service_count = maximumServiceRecordCount;
+    btstack_linked_item_t *it = (btstack_linked_item_t *) sdp_server_service_records;
+    uint16_t total_service_count    = 0;
+    uint16_t current_service_index  = 0;
+    uint16_t matching_service_count = 0;
+
+#ifdef ENABLE_SDP_SERVER_INDEX
+    sdp_server_index_prepare_pattern(serviceSearchPattern);
+    // request parameters without continuation state
+    uint16_t request_len = serviceSearchPatternLen + 2;
+    bool cached = (continuationState[0] == 2) &&
+        sdp_server_continuation_cache_lookup(SDP_ServiceSearchRequest, serviceSearchPattern, request_len, continuation_index);
+    if (cached){
+        // resume with next record
+        total_service_count    = sdp_server_continuation_cache_total;
+        matching_service_count = sdp_server_continuation_cache_matching_count;
+        current_service_index  = continuation_index;
+        it = (btstack_linked_item_t *) sdp_server_continuation_cache_item;
+    } else
+#endif
+    {
+        // get and limit total count
+        btstack_linked_item_t *it_count;
+        for (it_count = it; it_count ; it_count = it_count->next){
+            service_record_item_t * item = (service_record_item_t *) it_count;
+            if (!sdp_server_record_matches_service_search_pattern(item, serviceSearchPattern)) continue;
+            total_service_count++;
+        }
+        if (total_service_count > maximumServiceRecordCount){
+            total_service_count = maximumServiceRecordCount;
+        }
     }
-    
+
     // ServiceRecordHandleList at 9
     uint16_t pos = 9;
     uint16_t current_service_count  = 0;
-    uint16_t current_service_index  = 0;
-    uint16_t matching_service_count = 0;
-    for (it = (btstack_linked_item_t *) sdp_server_service_records; it ; it = it->next, ++current_service_index){
+    for ( ; it ; it = it->next, ++current_service_index){
         service_record_item_t * item = (service_record_item_t *) it;
 
-        if (!sdp_record_matches_service_search_pattern(item->service_record, serviceSearchPattern)) continue;
+        if (!sdp_server_record_matches_service_search_pattern(item, serviceSearchPattern)) continue;
         matching_service_count++;
         
         if (current_service_index < continuation_index) continue;
@@ -256,6 +580,10 @@ int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu){
         sdp_response_buffer[pos++] = 2;
         big_endian_store_16(sdp_response_buffer, pos, continuation_index);
         pos += 2;
+#ifdef ENABLE_SDP_SERVER_INDEX
+        sdp_server_continuation_cache_store(SDP_ServiceSearchRequest, serviceSearchPattern, request_len, total_service_count,
+                                            matching_service_count, continuation_index, (service_record_item_t *) it->next);
+#endif
     } else {
         sdp_response_buffer[pos++] = 0;
     }
@@ -311,13 +639,17 @@ int sdp_handle_service_attribute_request(uint8_t * packet, uint16_t remote_mtu){
     }
     
     
+#ifdef ENABLE_SDP_SERVER_INDEX
+    sdp_server_index_prepare_attribute_ranges(attributeIDList);
+#endif
+
     // AttributeList - starts at offset 7
     uint16_t pos = 7;
     
     if (continuation_offset == 0){
         
         // get size of this record
-        uint16_t filtered_attributes_size = spd_get_filtered_size(item->service_record, attributeIDList);
+        uint16_t filtered_attributes_size = sdp_server_get_filtered_size(item, attributeIDList);
         
         // store DES
         de_store_descriptor_with_len(&sdp_response_buffer[pos], DE_DES, DE_SIZE_VAR_16, filtered_attributes_size);
@@ -327,7 +659,7 @@ int sdp_handle_service_attribute_request(uint8_t * packet, uint16_t remote_mtu){
 
     // copy maximumAttributeByteCount from record
     uint16_t bytes_used;
-    int complete = sdp_filter_attributes_in_attributeIDList(item->service_record, attributeIDList, continuation_offset, maximumAttributeByteCount, &bytes_used, &sdp_response_buffer[pos]);
+    int complete = sdp_server_filter_attributes(item, attributeIDList, continuation_offset, maximumAttributeByteCount, &bytes_used, &sdp_response_buffer[pos]);
     pos += bytes_used;
     
     uint16_t attributeListByteCount = pos - 7;
@@ -356,10 +688,10 @@ static uint16_t sdp_get_size_for_service_search_attribute_response(uint8_t * ser
     for (it = (btstack_linked_item_t *) sdp_server_service_records; it ; it = it->next){
         service_record_item_t * item = (service_record_item_t *) it;
         
-        if (!sdp_record_matches_service_search_pattern(item->service_record, serviceSearchPattern)) continue;
+        if (!sdp_server_record_matches_service_search_pattern(item, serviceSearchPattern)) continue;
         
         // for all service records that match
-        total_response_size += 3 + spd_get_filtered_size(item->service_record, attributeIDList);
+        total_response_size += 3 + sdp_server_get_filtered_size(item, attributeIDList);
     }
     return total_response_size;
 }
@@ -411,6 +743,22 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
     // AttributeLists - starts at offset 7
     uint16_t pos = 7;
     
+    uint16_t current_service_index = 0;
+    btstack_linked_item_t *it = (btstack_linked_item_t *) sdp_server_service_records;
+
+#ifdef ENABLE_SDP_SERVER_INDEX
+    sdp_server_index_prepare_pattern(serviceSearchPattern);
+    sdp_server_index_prepare_attribute_ranges(attributeIDList);
+    // request parameters without continuation state
+    uint16_t request_len = serviceSearchPatternLen + 2 + attributeIDListLen;
+    if ((continuationState[0] == 4) &&
+        sdp_server_continuation_cache_lookup(SDP_ServiceSearchAttributeRequest, serviceSearchPattern, request_len, continuation_service_index)){
+        // resume with record of last response
+        current_service_index = continuation_service_index;
+        it = (btstack_linked_item_t *) sdp_server_continuation_cache_item;
+    }
+#endif
+
     // add DES with total size for first request
     if ((continuation_service_index == 0) && (continuation_offset == 0)){
         uint16_t total_response_size = sdp_get_size_for_service_search_attribute_response(serviceSearchPattern, attributeIDList);
@@ -423,18 +771,16 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
     // create attribute list
     int      first_answer = 1;
     int      continuation = 0;
-    uint16_t current_service_index = 0;
-    btstack_linked_item_t *it = (btstack_linked_item_t *) sdp_server_service_records;
     for ( ; it ; it = it->next, ++current_service_index){
         service_record_item_t * item = (service_record_item_t *) it;
         
         if (current_service_index < continuation_service_index ) continue;
-        if (!sdp_record_matches_service_search_pattern(item->service_record, serviceSearchPattern)) continue;
+        if (!sdp_server_record_matches_service_search_pattern(item, serviceSearchPattern)) continue;
 
         if (continuation_offset == 0){
             
             // get size of this record
-            uint16_t filtered_attributes_size = spd_get_filtered_size(item->service_record, attributeIDList);
+            uint16_t filtered_attributes_size = sdp_server_get_filtered_size(item, attributeIDList);
             
             // stop if complete record doesn't fits into response but we already have a partial response
             if (((filtered_attributes_size + 3) > maximumAttributeByteCount) && !first_answer) {
@@ -452,7 +798,7 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
     
         // copy maximumAttributeByteCount from record
         uint16_t bytes_used;
-        int complete = sdp_filter_attributes_in_attributeIDList(item->service_record, attributeIDList, continuation_offset, maximumAttributeByteCount, &bytes_used, &sdp_response_buffer[pos]);
+        int complete = sdp_server_filter_attributes(item, attributeIDList, continuation_offset, maximumAttributeByteCount, &bytes_used, &sdp_response_buffer[pos]);
         pos += bytes_used;
         maximumAttributeByteCount -= bytes_used;
         
@@ -475,6 +821,10 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
         pos += 2;
         big_endian_store_16(sdp_response_buffer, pos, continuation_offset);
         pos += 2;
+#ifdef ENABLE_SDP_SERVER_INDEX
+        sdp_server_continuation_cache_store(SDP_ServiceSearchAttributeRequest, serviceSearchPattern, request_len, 0,
+                                            0, current_service_index, (service_record_item_t *) it);
+#endif
     } else {
         // complete
         sdp_response_buffer[pos++] = 0;
@@ -489,6 +839,12 @@ int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remot
     return pos;
 }
 
+#ifdef UNIT_TEST
+const uint8_t * sdp_get_response_buffer(void){
+    return sdp_response_buffer;
+}
+#endif
+
 static void sdp_respond(void){
     if (!sdp_server_response_size ) return;
     if (!sdp_server_l2cap_cid) return;
@@ -44,6 +44,7 @@
 #define SDP_H
 
 #include <stdint.h>
+#include "btstack_bool.h"
 #include "btstack_linked_list.h"
 
 #include "btstack_config.h"
@@ -52,17 +53,43 @@
 extern "C" {
 #endif
     
+#ifdef ENABLE_SDP_SERVER_INDEX
+#ifndef MAX_SDP_SERVER_INDEX_UUIDS
+#define MAX_SDP_SERVER_INDEX_UUIDS 16
+#endif
+#ifndef MAX_SDP_SERVER_INDEX_ATTRIBUTES
+#define MAX_SDP_SERVER_INDEX_ATTRIBUTES 24
+#endif
+#endif
+
 typedef struct {
     // linked list - assert: first field
     btstack_linked_item_t   item;
 
     uint32_t        service_record_handle;
     uint8_t *       service_record;
+
+#ifdef ENABLE_SDP_SERVER_INDEX
+    // built by sdp_register_service, records that don't fit are handled without index
+    bool            index_valid;
+    // record contains 128-bit UUIDs that are not based on the Bluetooth Base UUID
+    bool            index_has_uuid128;
+    uint8_t         index_num_uuids;
+    uint8_t         index_num_attributes;
+    // UUIDs based on the Bluetooth Base UUID as 32-bit values
+    uint32_t        index_uuids[MAX_SDP_SERVER_INDEX_UUIDS];
+    // attribute IDs and offsets of their attribute ID element in record, last offset marks end of last attribute
+    uint16_t        index_attribute_ids[MAX_SDP_SERVER_INDEX_ATTRIBUTES];
+    uint16_t        index_attribute_offsets[MAX_SDP_SERVER_INDEX_ATTRIBUTES + 1];
+#endif
 } service_record_item_t;
 
 int sdp_handle_service_search_request(uint8_t * packet, uint16_t remote_mtu);
 int sdp_handle_service_attribute_request(uint8_t * packet, uint16_t remote_mtu);
 int sdp_handle_service_search_attribute_request(uint8_t * packet, uint16_t remote_mtu);
+#ifdef UNIT_TEST
+const uint8_t * sdp_get_response_buffer(void);
+#endif
 
 /* API_START */
 
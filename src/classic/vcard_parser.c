@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "vcard_parser.c"
+
+#include "btstack_config.h"
+
+#include <string.h>
+
+#include "classic/vcard_parser.h"
+#include "btstack_debug.h"
+#include "btstack_util.h"
+
+static const char vcard_parser_quoted_printable[] = "QUOTED-PRINTABLE";
+static const uint8_t vcard_parser_equal_sign = (uint8_t) '=';
+
+static char vcard_parser_to_upper(uint8_t c){
+    if ((c >= 'a') && (c <= 'z')){
+        return (char) (c - 'a' + 'A');
+    }
+    return (char) c;
+}
+
+static bool vcard_parser_reports_property(const vcard_parser_t * parser){
+    return (parser->depth == 1u) && (parser->keyword_property == false) && (parser->callback != NULL);
+}
+
+static void vcard_parser_emit_value(vcard_parser_t * parser, const uint8_t * data_buffer, uint16_t data_len){
+    if (data_len == 0u){
+        return;
+    }
+    if (parser->keyword_property){
+        uint16_t i;
+        for (i = 0; i < data_len; i++){
+            if (parser->keyword_len < sizeof(parser->keyword)){
+                parser->keyword[parser->keyword_len] = vcard_parser_to_upper(data_buffer[i]);
+            }
+            // keep counting to detect values longer than any keyword
+            if (parser->keyword_len < 255u){
+                parser->keyword_len++;
+            }
+        }
+        return;
+    }
+    if (vcard_parser_reports_property(parser) == false){
+        return;
+    }
+    (*parser->callback)(parser->user_data, VCARD_PARSER_EVENT_PROPERTY_VALUE, &parser->property, data_buffer, data_len);
+    parser->property.value_len += data_len;
+}
+
+static void vcard_parser_start_property(vcard_parser_t * parser){
+    memset(&parser->property, 0, sizeof(vcard_parser_property_t));
+    parser->name_len = 0;
+    parser->params_len = 0;
+    parser->quoted_printable_match = 0;
+    parser->params_quoted = false;
+}
+
+static void vcard_parser_start_value(vcard_parser_t * parser){
+    parser->property.name[parser->name_len] = '\0';
+    parser->property.params[parser->params_len] = '\0';
+    parser->keyword_property = (strcmp(parser->property.name, "BEGIN") == 0) || (strcmp(parser->property.name, "END") == 0);
+    parser->keyword_len = 0;
+    parser->soft_line_break = false;
+    parser->equal_sign_pending = false;
+    parser->state = VCARD_PARSER_STATE_W4_VALUE;
+}
+
+static void vcard_parser_finish_property(vcard_parser_t * parser){
+    if (parser->keyword_property){
+        parser->keyword_property = false;
+        if ((parser->keyword_len != 5u) || (memcmp(parser->keyword, "VCARD", 5) != 0)){
+            return;
+        }
+        if (parser->property.name[0] == 'B'){
+            if (parser->depth < 255u){
+                parser->depth++;
+            }
+            if ((parser->depth == 1u) && (parser->callback != NULL)){
+                (*parser->callback)(parser->user_data, VCARD_PARSER_EVENT_CARD_BEGIN, NULL, NULL, 0);
+            }
+        } else if (parser->depth > 0u){
+            parser->depth--;
+            if (parser->depth == 0u){
+                parser->num_cards++;
+                if (parser->callback != NULL){
+                    (*parser->callback)(parser->user_data, VCARD_PARSER_EVENT_CARD_END, NULL, NULL, 0);
+                }
+            }
+        }
+        return;
+    }
+    if (vcard_parser_reports_property(parser)){
+        (*parser->callback)(parser->user_data, VCARD_PARSER_EVENT_PROPERTY_END, &parser->property, NULL, 0);
+    }
+}
+
+static void vcard_parser_process_param(vcard_parser_t * parser, uint8_t c){
+    if (parser->params_len < VCARD_PARSER_MAX_PARAMS_LEN){
+        parser->property.params[parser->params_len++] = (char) c;
+    }
+    // match QUOTED-PRINTABLE, 'Q' only occurs at its start
+    char upper = vcard_parser_to_upper(c);
+    if (upper == vcard_parser_quoted_printable[parser->quoted_printable_match]){
+        parser->quoted_printable_match++;
+        if (parser->quoted_printable_match == (sizeof(vcard_parser_quoted_printable) - 1u)){
+            parser->property.quoted_printable = true;
+            parser->quoted_printable_match = 0;
+        }
+    } else {
+        parser->quoted_printable_match = (upper == 'Q') ? 1u : 0u;
+    }
+}
+
+// returns number of bytes consumed
+static uint16_t vcard_parser_process_value(vcard_parser_t * parser, const uint8_t * data_buffer, uint16_t data_len){
+    if (parser->equal_sign_pending){
+        parser->equal_sign_pending = false;
+        if ((data_buffer[0] == '\r') || (data_buffer[0] == '\n')){
+            parser->soft_line_break = true;
+        } else {
+            vcard_parser_emit_value(parser, &vcard_parser_equal_sign, 1);
+        }
+    }
+    uint16_t pos = 0;
+    while ((pos < data_len) && (data_buffer[pos] != '\r') && (data_buffer[pos] != '\n')){
+        pos++;
+    }
+    uint16_t chunk_len = pos;
+    if (parser->property.quoted_printable && (chunk_len > 0u) && (data_buffer[chunk_len - 1u] == '=')){
+        // soft line break, or '=' at end of chunk which might become one
+        chunk_len--;
+        if (pos == data_len){
+            parser->equal_sign_pending = true;
+        } else {
+            parser->soft_line_break = true;
+        }
+    }
+    vcard_parser_emit_value(parser, data_buffer, chunk_len);
+    if (pos == data_len){
+        return pos;
+    }
+    // BEGIN and END are not folded
+    if (parser->keyword_property){
+        vcard_parser_finish_property(parser);
+        parser->state = VCARD_PARSER_STATE_W4_LINE;
+    } else if (data_buffer[pos] == '\r'){
+        parser->state = VCARD_PARSER_STATE_W4_VALUE_LF;
+    } else {
+        parser->state = VCARD_PARSER_STATE_W4_CONTINUATION;
+    }
+    return pos + 1u;
+}
+
+void vcard_parser_init(vcard_parser_t * parser, vcard_parser_callback_t callback, void * user_data){
+    memset(parser, 0, sizeof(vcard_parser_t));
+    parser->callback = callback;
+    parser->user_data = user_data;
+    parser->state = VCARD_PARSER_STATE_W4_LINE;
+}
+
+void vcard_parser_process_data(vcard_parser_t * parser, const uint8_t * data_buffer, uint16_t data_len){
+    while (data_len > 0u){
+        uint16_t bytes_to_consume = 1;
+        uint8_t c = *data_buffer;
+        switch (parser->state){
+            case VCARD_PARSER_STATE_W4_LINE:
+                if ((c == '\r') || (c == '\n')){
+                    break;
+                }
+                vcard_parser_start_property(parser);
+                parser->state = VCARD_PARSER_STATE_W4_NAME;
+                bytes_to_consume = 0;
+                break;
+            case VCARD_PARSER_STATE_W4_NAME:
+                switch (c){
+                    case '.':
+                        // drop group prefix
+                        parser->name_len = 0;
+                        break;
+                    case ';':
+                        parser->state = VCARD_PARSER_STATE_W4_PARAMS;
+                        break;
+                    case ':':
+                        vcard_parser_start_value(parser);
+                        break;
+                    case '\r':
+                    case '\n':
+                        // line without value
+                        parser->state = VCARD_PARSER_STATE_W4_LINE;
+                        break;
+                    default:
+                        if (parser->name_len < VCARD_PARSER_MAX_NAME_LEN){
+                            parser->property.name[parser->name_len++] = vcard_parser_to_upper(c);
+                        }
+                        break;
+                }
+                break;
+            case VCARD_PARSER_STATE_W4_PARAMS:
+                if ((c == '\r') || (c == '\n')){
+                    parser->state = VCARD_PARSER_STATE_W4_LINE;
+                    break;
+                }
+                if ((c == ':') && (parser->params_quoted == false)){
+                    vcard_parser_start_value(parser);
+                    break;
+                }
+                if (c == '"'){
+                    parser->params_quoted = !parser->params_quoted;
+                }
+                vcard_parser_process_param(parser, c);
+                break;
+            case VCARD_PARSER_STATE_W4_VALUE:
+                bytes_to_consume = vcard_parser_process_value(parser, data_buffer, data_len);
+                break;
+            case VCARD_PARSER_STATE_W4_VALUE_LF:
+                if (c != '\n'){
+                    bytes_to_consume = 0;
+                }
+                parser->state = VCARD_PARSER_STATE_W4_CONTINUATION;
+                break;
+            case VCARD_PARSER_STATE_W4_CONTINUATION:
+                if (parser->soft_line_break){
+                    parser->soft_line_break = false;
+                    parser->state = VCARD_PARSER_STATE_W4_VALUE;
+                    bytes_to_consume = 0;
+                    break;
+                }
+                if ((c == ' ') || (c == '\t')){
+                    // folded line
+                    parser->state = VCARD_PARSER_STATE_W4_VALUE;
+                    break;
+                }
+                vcard_parser_finish_property(parser);
+                parser->state = VCARD_PARSER_STATE_W4_LINE;
+                bytes_to_consume = 0;
+                break;
+            default:
+                btstack_unreachable();
+                break;
+        }
+        data_buffer += bytes_to_consume;
+        data_len    -= bytes_to_consume;
+    }
+}
+
+uint32_t vcard_parser_get_num_cards(const vcard_parser_t * parser){
+    return parser->num_cards;
+}
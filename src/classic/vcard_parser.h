@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/**
+ * vCard Parser
+ * Incremental tokenizer for arbitrarily chunked vCard 2.1/3.0 streams, e.g. PBAP phonebooks.
+ * Property values are reported as chunks that point into the input data. Folded lines and
+ * Quoted-Printable soft line breaks are joined, values are not decoded.
+ */
+
+#ifndef VCARD_PARSER_H
+#define VCARD_PARSER_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "btstack_bool.h"
+
+// max len of property name without group, longer names are truncated
+#define VCARD_PARSER_MAX_NAME_LEN   24
+
+// max len of property parameters, longer parameters are truncated
+#define VCARD_PARSER_MAX_PARAMS_LEN 48
+
+typedef enum {
+    VCARD_PARSER_STATE_W4_LINE,
+    VCARD_PARSER_STATE_W4_NAME,
+    VCARD_PARSER_STATE_W4_PARAMS,
+    VCARD_PARSER_STATE_W4_VALUE,
+    VCARD_PARSER_STATE_W4_VALUE_LF,
+    VCARD_PARSER_STATE_W4_CONTINUATION,
+} vcard_parser_state_t;
+
+typedef enum {
+    // BEGIN:VCARD
+    VCARD_PARSER_EVENT_CARD_BEGIN,
+    // chunk of property value, emitted zero or more times per property
+    VCARD_PARSER_EVENT_PROPERTY_VALUE,
+    // property complete, data_len is 0
+    VCARD_PARSER_EVENT_PROPERTY_END,
+    // END:VCARD
+    VCARD_PARSER_EVENT_CARD_END,
+} vcard_parser_event_t;
+
+typedef struct {
+    // upper case, group prefix removed
+    char     name[VCARD_PARSER_MAX_NAME_LEN + 1];
+    // raw parameters without leading ';'
+    char     params[VCARD_PARSER_MAX_PARAMS_LEN + 1];
+    // ENCODING=QUOTED-PRINTABLE or QUOTED-PRINTABLE parameter present
+    bool     quoted_printable;
+    // number of value bytes reported so far
+    uint16_t value_len;
+} vcard_parser_property_t;
+
+/* API_START */
+
+/**
+ * Callback for parser events
+ * @param user_data provided in vcard_parser_init
+ * @param event
+ * @param property current property, NULL for card events
+ * @param data_buffer chunk of property value, points into buffer passed to vcard_parser_process_data
+ * @param data_len
+ */
+typedef void (*vcard_parser_callback_t)(void * user_data, vcard_parser_event_t event, const vcard_parser_property_t * property, const uint8_t * data_buffer, uint16_t data_len);
+
+typedef struct {
+    vcard_parser_callback_t callback;
+    void * user_data;
+    vcard_parser_state_t state;
+    vcard_parser_property_t property;
+    uint8_t  name_len;
+    uint8_t  params_len;
+    uint8_t  quoted_printable_match;
+    bool     params_quoted;
+    bool     soft_line_break;
+    bool     equal_sign_pending;
+    // value of BEGIN and END properties
+    bool     keyword_property;
+    char     keyword[6];
+    uint8_t  keyword_len;
+    // nesting level of BEGIN:VCARD, only top level properties are reported
+    uint8_t  depth;
+    uint32_t num_cards;
+} vcard_parser_t;
+
+/**
+ * Initialize vCard parser
+ * @param parser
+ * @param callback
+ * @param user_data
+ */
+void vcard_parser_init(vcard_parser_t * parser, vcard_parser_callback_t callback, void * user_data);
+
+/**
+ * Process chunk of vCard data
+ * @param parser
+ * @param data_buffer
+ * @param data_len
+ */
+void vcard_parser_process_data(vcard_parser_t * parser, const uint8_t * data_buffer, uint16_t data_len);
+
+/**
+ * Get number of complete vCards
+ * @param parser
+ * @return num cards
+ */
+uint32_t vcard_parser_get_num_cards(const vcard_parser_t * parser);
+
+/* API_END */
+
+#if defined __cplusplus
+}
+#endif
+#endif
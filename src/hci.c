@@ -71,6 +71,7 @@
 #include "gap.h"
 #include "hci.h"
 #include "hci_cmd.h"
+#include "hci_cmd_encoder.h"
 #include "hci_dump.h"
 #include "ad_parser.h"
 
@@ -215,6 +216,7 @@ static void hci_emit_dedicated_bonding_result(bd_addr_t address, uint8_t status)
 static void hci_emit_event(uint8_t * event, uint16_t size, int dump);
 static void hci_emit_acl_packet(uint8_t * packet, uint16_t size);
 static void hci_run(void);
+static uint8_t hci_send_encoded_cmd(uint16_t size);
 static int  hci_is_le_connection(hci_connection_t * connection);
 
 #ifdef ENABLE_CLASSIC
@@ -306,6 +308,137 @@ static void hci_connection_init(hci_connection_t * conn){
 #endif
 }
 
+#ifdef ENABLE_HCI_CONNECTION_INDEX
+
+// connection index: open addressing with linear probing and backward shift deletion
+// entries are verified against the connection on lookup, hci_stack->connections stays the reference
+
+static uint32_t hci_connection_index_mix(uint32_t hash){
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static uint32_t hci_connection_index_hash_for_handle(hci_con_handle_t con_handle){
+    return hci_connection_index_mix(con_handle);
+}
+
+static uint32_t hci_connection_index_hash_for_address(const bd_addr_t addr, bd_addr_type_t addr_type){
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    uint8_t i;
+    for (i = 0; i < 6; i++){
+        hash = (hash ^ addr[i]) * 16777619u;
+    }
+    hash = (hash ^ (uint8_t) addr_type) * 16777619u;
+    return hci_connection_index_mix(hash);
+}
+
+static void hci_connection_index_insert(hci_connection_index_entry_t * table, uint32_t hash, hci_connection_t * conn){
+    const uint32_t mask = HCI_CONNECTION_INDEX_SIZE - 1;
+    uint32_t pos = hash & mask;
+    uint16_t i;
+    for (i = 0; i < HCI_CONNECTION_INDEX_SIZE; i++){
+        hci_connection_index_entry_t * entry = &table[pos];
+        if (entry->connection == NULL){
+            entry->connection = conn;
+            entry->hash = hash;
+            return;
+        }
+        if ((entry->connection == conn) && (entry->hash == hash)) return;
+        pos = (pos + 1) & mask;
+    }
+    // index full, lookup falls back to list
+    log_info("connection index full");
+}
+
+static void hci_connection_index_remove_at(hci_connection_index_entry_t * table, uint32_t pos){
+    const uint32_t mask = HCI_CONNECTION_INDEX_SIZE - 1;
+    uint32_t free_pos = pos;
+    uint32_t next_pos = pos;
+    table[free_pos].connection = NULL;
+    while (true){
+        next_pos = (next_pos + 1) & mask;
+        if (table[next_pos].connection == NULL) return;
+        // keep entry if its home slot is cyclically in (free_pos, next_pos]
+        uint32_t home_pos = table[next_pos].hash & mask;
+        bool keep;
+        if (free_pos <= next_pos){
+            keep = (free_pos < home_pos) && (home_pos <= next_pos);
+        } else {
+            keep = (free_pos < home_pos) || (home_pos <= next_pos);
+        }
+        if (keep) continue;
+        table[free_pos] = table[next_pos];
+        table[next_pos].connection = NULL;
+        free_pos = next_pos;
+    }
+}
+
+static void hci_connection_index_remove_from_table(hci_connection_index_entry_t * table, const hci_connection_t * conn){
+    uint32_t pos;
+    for (pos = 0; pos < HCI_CONNECTION_INDEX_SIZE; pos++){
+        while (table[pos].connection == conn){
+            hci_connection_index_remove_at(table, pos);
+        }
+    }
+}
+
+static hci_connection_t * hci_connection_index_lookup_handle(hci_con_handle_t con_handle){
+    const uint32_t mask = HCI_CONNECTION_INDEX_SIZE - 1;
+    uint32_t hash = hci_connection_index_hash_for_handle(con_handle);
+    uint32_t pos = hash & mask;
+    uint16_t i;
+    for (i = 0; i < HCI_CONNECTION_INDEX_SIZE; i++){
+        const hci_connection_index_entry_t * entry = &hci_stack->connections_by_handle[pos];
+        if (entry->connection == NULL) break;
+        if ((entry->hash == hash) && (entry->connection->con_handle == con_handle)){
+            return entry->connection;
+        }
+        pos = (pos + 1) & mask;
+    }
+    return NULL;
+}
+
+static hci_connection_t * hci_connection_index_lookup_address(const bd_addr_t addr, bd_addr_type_t addr_type){
+    const uint32_t mask = HCI_CONNECTION_INDEX_SIZE - 1;
+    uint32_t hash = hci_connection_index_hash_for_address(addr, addr_type);
+    uint32_t pos = hash & mask;
+    uint16_t i;
+    for (i = 0; i < HCI_CONNECTION_INDEX_SIZE; i++){
+        const hci_connection_index_entry_t * entry = &hci_stack->connections_by_address[pos];
+        if (entry->connection == NULL) break;
+        if ((entry->hash == hash) && (entry->connection->address_type == addr_type) && (memcmp(addr, entry->connection->address, 6) == 0)){
+            return entry->connection;
+        }
+        pos = (pos + 1) & mask;
+    }
+    return NULL;
+}
+#endif
+
+static void hci_connection_index_remove_connection(hci_connection_t * conn){
+#ifdef ENABLE_HCI_CONNECTION_INDEX
+    hci_connection_index_remove_from_table(hci_stack->connections_by_handle, conn);
+    hci_connection_index_remove_from_table(hci_stack->connections_by_address, conn);
+#else
+    UNUSED(conn);
+#endif
+}
+
+static void hci_connection_set_con_handle(hci_connection_t * conn, hci_con_handle_t con_handle){
+    conn->con_handle = con_handle;
+#ifdef ENABLE_HCI_CONNECTION_INDEX
+    hci_connection_index_remove_from_table(hci_stack->connections_by_handle, conn);
+    if (con_handle != HCI_CON_HANDLE_INVALID){
+        hci_connection_index_insert(hci_stack->connections_by_handle, hci_connection_index_hash_for_handle(con_handle), conn);
+    }
+#endif
+}
+
 /**
  * create connection for given address
  *
@@ -327,6 +460,9 @@ create_connection_for_bd_addr_and_type(const bd_addr_t addr, bd_addr_type_t addr
     conn->le_past_sync_handle = HCI_CON_HANDLE_INVALID;
 #endif
     btstack_linked_list_add(&hci_stack->connections, (btstack_linked_item_t *) conn);
+#ifdef ENABLE_HCI_CONNECTION_INDEX
+    hci_connection_index_insert(hci_stack->connections_by_address, hci_connection_index_hash_for_address(addr, addr_type), conn);
+#endif
 
     return conn;
 }
@@ -398,11 +534,24 @@ void hci_connections_get_iterator(btstack_linked_list_iterator_t *it){
  * @return connection OR NULL, if not found
  */
 hci_connection_t * hci_connection_for_handle(hci_con_handle_t con_handle){
+#ifdef ENABLE_HCI_CONNECTION_INDEX
+    if (con_handle != HCI_CON_HANDLE_INVALID){
+        hci_connection_t * conn = hci_connection_index_lookup_handle(con_handle);
+        if (conn != NULL){
+            return conn;
+        }
+    }
+#endif
     btstack_linked_list_iterator_t it;
     btstack_linked_list_iterator_init(&it, &hci_stack->connections);
     while (btstack_linked_list_iterator_has_next(&it)){
         hci_connection_t * item = (hci_connection_t *) btstack_linked_list_iterator_next(&it);
         if ( item->con_handle == con_handle ) {
+#ifdef ENABLE_HCI_CONNECTION_INDEX
+            if (con_handle != HCI_CON_HANDLE_INVALID){
+                hci_connection_index_insert(hci_stack->connections_by_handle, hci_connection_index_hash_for_handle(con_handle), item);
+            }
+#endif
             return item;
         }
     } 
@@ -415,12 +564,21 @@ hci_connection_t * hci_connection_for_handle(hci_con_handle_t con_handle){
  * @return connection OR NULL, if not found
  */
 hci_connection_t * hci_connection_for_bd_addr_and_type(const bd_addr_t  addr, bd_addr_type_t addr_type){
+#ifdef ENABLE_HCI_CONNECTION_INDEX
+    hci_connection_t * conn = hci_connection_index_lookup_address(addr, addr_type);
+    if (conn != NULL){
+        return conn;
+    }
+#endif
     btstack_linked_list_iterator_t it;
     btstack_linked_list_iterator_init(&it, &hci_stack->connections);
     while (btstack_linked_list_iterator_has_next(&it)){
         hci_connection_t * connection = (hci_connection_t *) btstack_linked_list_iterator_next(&it);
         if (connection->address_type != addr_type)  continue;
         if (memcmp(addr, connection->address, 6) != 0) continue;
+#ifdef ENABLE_HCI_CONNECTION_INDEX
+        hci_connection_index_insert(hci_stack->connections_by_address, hci_connection_index_hash_for_address(addr, addr_type), connection);
+#endif
         return connection;   
     } 
     return NULL;
@@ -762,11 +920,20 @@ bool hci_can_send_acl_le_packet_now(void){
     return hci_can_send_prepared_acl_packet_for_address_type(BD_ADDR_TYPE_LE_PUBLIC);
 }
 
-bool hci_can_send_prepared_acl_packet_now(hci_con_handle_t con_handle) {
+static bool hci_can_send_acl_fragment_now(hci_con_handle_t con_handle){
     if (!hci_transport_can_send_prepared_packet_now(HCI_ACL_DATA_PACKET)) return false;
     return hci_number_free_acl_slots_for_handle(con_handle) > 0;
 }
 
+bool hci_can_send_prepared_acl_packet_now(hci_con_handle_t con_handle) {
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+    // keep order: wait until remaining fragments of previous packet have been sent
+    hci_connection_t * connection = hci_connection_for_handle(con_handle);
+    if ((connection != NULL) && (connection->acl_tx_fragmentation_total_size > 0u)) return false;
+#endif
+    return hci_can_send_acl_fragment_now(con_handle);
+}
+
 bool hci_can_send_acl_packet_now(hci_con_handle_t con_handle){
     if (hci_stack->hci_packet_buffer_reserved) return false;
     return hci_can_send_prepared_acl_packet_now(con_handle);
@@ -863,9 +1030,9 @@ static void hci_controller_dump_packets(void){
 }
 #endif
 
-static uint8_t hci_send_acl_packet_fragments(hci_connection_t *connection){
-
-    // log_info("hci_send_acl_packet_fragments  %u/%u (con 0x%04x)", hci_stack->acl_fragmentation_pos, hci_stack->acl_fragmentation_total_size, connection->con_handle);
+// send next fragment from buffer, header of first fragment at buffer[0]
+static uint8_t hci_send_acl_fragment(hci_connection_t *connection, uint8_t * buffer, uint16_t * fragmentation_pos,
+                                     uint16_t * fragmentation_total_size, bool * more_fragments){
 
     // max ACL data packet length depends on connection type (LE vs. Classic) and available buffers
     uint16_t max_acl_data_packet_length = hci_stack->acl_data_packet_length;
@@ -879,71 +1046,203 @@ static uint8_t hci_send_acl_packet_fragments(hci_connection_t *connection){
     }
 #endif
 
-    log_debug("hci_send_acl_packet_fragments entered");
+    // get current data
+    const uint16_t acl_header_pos = *fragmentation_pos - 4u;
+    int current_acl_data_packet_length = *fragmentation_total_size - *fragmentation_pos;
+    *more_fragments = false;
 
-    uint8_t status = ERROR_CODE_SUCCESS;
-    // multiple packets could be send on a synchronous HCI transport
-    while (true){
+    // if ACL packet is larger than Bluetooth packet buffer, only send max_acl_data_packet_length
+    if (current_acl_data_packet_length > max_acl_data_packet_length){
+        *more_fragments = true;
+        current_acl_data_packet_length = max_acl_data_packet_length & (~(HCI_ACL_CHUNK_SIZE_ALIGNMENT-1));
+    }
 
-        log_debug("hci_send_acl_packet_fragments loop entered");
+    // copy handle_and_flags if not first fragment and update packet boundary flags to be 01 (continuing fragmnent)
+    if (acl_header_pos > 0u){
+        uint16_t handle_and_flags = little_endian_read_16(buffer, 0);
+        handle_and_flags = (handle_and_flags & 0xcfffu) | (1u << 12u);
+        little_endian_store_16(buffer, acl_header_pos, handle_and_flags);
+    }
 
-        // get current data
-        const uint16_t acl_header_pos = hci_stack->acl_fragmentation_pos - 4u;
-        int current_acl_data_packet_length = hci_stack->acl_fragmentation_total_size - hci_stack->acl_fragmentation_pos;
-        bool more_fragments = false;
+    // update header len
+    little_endian_store_16(buffer, acl_header_pos + 2u, current_acl_data_packet_length);
 
-        // if ACL packet is larger than Bluetooth packet buffer, only send max_acl_data_packet_length
-        if (current_acl_data_packet_length > max_acl_data_packet_length){
-            more_fragments = true;
-            current_acl_data_packet_length = max_acl_data_packet_length & (~(HCI_ACL_CHUNK_SIZE_ALIGNMENT-1));
-        }
+    // count packet
+    connection->num_packets_sent++;
+    log_debug("hci_send_acl_fragment before send (more fragments %d)", (int) *more_fragments);
 
-        // copy handle_and_flags if not first fragment and update packet boundary flags to be 01 (continuing fragmnent)
-        if (acl_header_pos > 0u){
-            uint16_t handle_and_flags = little_endian_read_16(hci_stack->hci_packet_buffer, 0);
-            handle_and_flags = (handle_and_flags & 0xcfffu) | (1u << 12u);
-            little_endian_store_16(hci_stack->hci_packet_buffer, acl_header_pos, handle_and_flags);
-        }
+    // update state for next fragment (if any) as "transport done" might be sent during send_packet already
+    if (*more_fragments){
+        // update start of next fragment to send
+        *fragmentation_pos += current_acl_data_packet_length;
+    } else {
+        // done
+        *fragmentation_pos = 0;
+        *fragmentation_total_size = 0;
+    }
 
-        // update header len
-        little_endian_store_16(hci_stack->hci_packet_buffer, acl_header_pos + 2u, current_acl_data_packet_length);
-        
-        // count packet
-        connection->num_packets_sent++;
-        log_debug("hci_send_acl_packet_fragments loop before send (more fragments %d)", (int) more_fragments);
+    // send packet
+    uint8_t * packet = &buffer[acl_header_pos];
+    const int size = current_acl_data_packet_length + 4;
+    hci_dump_packet(HCI_ACL_DATA_PACKET, 0, packet, size);
+    int err = hci_stack->hci_transport->send_packet(HCI_ACL_DATA_PACKET, packet, size);
 
-        // update state for next fragment (if any) as "transport done" might be sent during send_packet already
-        if (more_fragments){
-            // update start of next fragment to send
-            hci_stack->acl_fragmentation_pos += current_acl_data_packet_length;
-        } else {
-            // done
-            hci_stack->acl_fragmentation_pos = 0;
-            hci_stack->acl_fragmentation_total_size = 0;
+#ifdef ENABLE_CONTROLLER_DUMP_PACKETS
+    hci_controller_dump_packets();
+#endif
+
+    if (err != 0){
+        // no error from HCI Transport expected
+        return ERROR_CODE_HARDWARE_FAILURE;
+    }
+    return ERROR_CODE_SUCCESS;
+}
+
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+static hci_acl_tx_buffer_t * hci_acl_tx_buffer_get(void){
+    uint16_t i;
+    for (i = 0; i < HCI_ACL_TX_BUFFER_POOL_SIZE; i++){
+        hci_acl_tx_buffer_t * tx_buffer = &hci_stack->acl_tx_buffers[i];
+        if (tx_buffer->in_use) continue;
+        if (tx_buffer->in_flight) continue;
+        tx_buffer->in_use = true;
+        return tx_buffer;
+    }
+    return NULL;
+}
+
+static void hci_acl_tx_buffer_release(hci_connection_t * connection){
+    if (connection->acl_tx_buffer == NULL) return;
+    log_info("drop pending ACL fragments for con handle 0x%04x", connection->con_handle);
+    connection->acl_tx_buffer->in_use = false;
+    connection->acl_tx_buffer = NULL;
+    connection->acl_tx_fragmentation_pos = 0;
+    connection->acl_tx_fragmentation_total_size = 0;
+}
+
+// move remaining fragments from hci_packet_buffer into tx buffer of connection
+static bool hci_acl_tx_buffer_move_fragments(hci_connection_t * connection){
+    hci_acl_tx_buffer_t * tx_buffer = hci_acl_tx_buffer_get();
+    if (tx_buffer == NULL) return false;
+
+    uint8_t * buffer = &tx_buffer->data[HCI_OUTGOING_PRE_BUFFER_SIZE];
+    uint16_t remaining_len = hci_stack->acl_fragmentation_total_size - hci_stack->acl_fragmentation_pos;
+
+    // store header with packet boundary flags set to continuing fragment
+    uint16_t handle_and_flags = little_endian_read_16(hci_stack->hci_packet_buffer, 0);
+    handle_and_flags = (handle_and_flags & 0xcfffu) | (1u << 12u);
+    little_endian_store_16(buffer, 0, handle_and_flags);
+    (void) memcpy(&buffer[4], &hci_stack->hci_packet_buffer[hci_stack->acl_fragmentation_pos], remaining_len);
+
+    connection->acl_tx_buffer = tx_buffer;
+    connection->acl_tx_fragmentation_pos = 4;
+    connection->acl_tx_fragmentation_total_size = 4 + remaining_len;
+
+    hci_stack->acl_fragmentation_pos = 0;
+    hci_stack->acl_fragmentation_total_size = 0;
+    return true;
+}
+
+static void hci_acl_tx_buffer_send_fragment(hci_connection_t * connection){
+    hci_acl_tx_buffer_t * tx_buffer = connection->acl_tx_buffer;
+    bool more_fragments;
+    tx_buffer->in_flight = true;
+    (void) hci_send_acl_fragment(connection, &tx_buffer->data[HCI_OUTGOING_PRE_BUFFER_SIZE],
+                                 &connection->acl_tx_fragmentation_pos, &connection->acl_tx_fragmentation_total_size, &more_fragments);
+    // remaining fragments might have been sent from hci_run during send_packet already
+    if ((connection->acl_tx_fragmentation_total_size == 0u) && (connection->acl_tx_buffer == tx_buffer)){
+        // buffer returns to pool after HCI Transport is done with it
+        tx_buffer->in_use = false;
+        connection->acl_tx_buffer = NULL;
+    }
+    if (hci_transport_synchronous()){
+        tx_buffer->in_flight = false;
+        if (more_fragments == false){
+            hci_emit_transport_packet_sent();
         }
+    }
+}
 
-        // send packet
-        uint8_t * packet = &hci_stack->hci_packet_buffer[acl_header_pos];
-        const int size = current_acl_data_packet_length + 4;
-        hci_dump_packet(HCI_ACL_DATA_PACKET, 0, packet, size);
-        hci_stack->acl_fragmentation_tx_active = 1;
-        int err = hci_stack->hci_transport->send_packet(HCI_ACL_DATA_PACKET, packet, size);
-        if (err != 0){
-            // no error from HCI Transport expected
-            status = ERROR_CODE_HARDWARE_FAILURE;
+static void hci_acl_tx_buffer_packet_sent(void){
+    uint16_t i;
+    for (i = 0; i < HCI_ACL_TX_BUFFER_POOL_SIZE; i++){
+        hci_stack->acl_tx_buffers[i].in_flight = false;
+    }
+}
+
+// send fragments from tx buffers round robin, starting after the connection that was served last
+static bool hci_run_acl_tx_buffer_fragments(void){
+    btstack_linked_item_t * start = (btstack_linked_item_t *) hci_stack->connections;
+    if (start == NULL) return false;
+    btstack_linked_item_t * it;
+    for (it = start; it != NULL; it = it->next){
+        if (((hci_connection_t *) it)->con_handle == hci_stack->acl_tx_last_con_handle){
+            if (it->next != NULL){
+                start = it->next;
+            }
+            break;
         }
+    }
 
-#ifdef ENABLE_CONTROLLER_DUMP_PACKETS
-        hci_controller_dump_packets();
+    bool sent = false;
+    it = start;
+    do {
+        hci_connection_t * connection = (hci_connection_t *) it;
+        if ((connection->acl_tx_fragmentation_total_size > 0u) && hci_can_send_acl_fragment_now(connection->con_handle)){
+            hci_stack->acl_tx_last_con_handle = connection->con_handle;
+            hci_acl_tx_buffer_send_fragment(connection);
+            sent = true;
+            // asynchronous transport is busy until packet sent
+            if (hci_transport_synchronous() == false) break;
+        }
+        it = (it->next != NULL) ? it->next : (btstack_linked_item_t *) hci_stack->connections;
+    } while (it != start);
+    return sent;
+}
 #endif
 
+static uint8_t hci_send_acl_packet_fragments(hci_connection_t *connection){
+
+    // log_info("hci_send_acl_packet_fragments  %u/%u (con 0x%04x)", hci_stack->acl_fragmentation_pos, hci_stack->acl_fragmentation_total_size, connection->con_handle);
+
+    log_debug("hci_send_acl_packet_fragments entered");
+
+    uint8_t status = ERROR_CODE_SUCCESS;
+    // multiple packets could be send on a synchronous HCI transport
+    while (true){
+
+        log_debug("hci_send_acl_packet_fragments loop entered");
+
+        bool more_fragments;
+        hci_stack->acl_fragmentation_tx_active = 1;
+        uint8_t fragment_status = hci_send_acl_fragment(connection, hci_stack->hci_packet_buffer, &hci_stack->acl_fragmentation_pos,
+                                                        &hci_stack->acl_fragmentation_total_size, &more_fragments);
+        if (fragment_status != ERROR_CODE_SUCCESS){
+            status = fragment_status;
+        }
+
         log_debug("hci_send_acl_packet_fragments loop after send (more fragments %d)", (int) more_fragments);
 
         // done yet?
         if (!more_fragments) break;
 
         // can send more?
-        if (!hci_can_send_prepared_acl_packet_now(connection->con_handle)) return status;
+        if (!hci_can_send_acl_fragment_now(connection->con_handle)) {
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+            // if controller has no buffers for this connection, continue from tx buffer of this connection
+            // and let other connections use hci_packet_buffer meanwhile
+            if ((hci_stack->acl_fragmentation_total_size > 0u) && (hci_number_free_acl_slots_for_handle(connection->con_handle) == 0)
+                && hci_acl_tx_buffer_move_fragments(connection)){
+                // asynchronous transport: release buffer here if HCI_EVENT_TRANSPORT_PACKET_SENT was already received
+                if ((hci_transport_synchronous() == false) && (hci_stack->acl_fragmentation_tx_active == 0u)){
+                    hci_release_packet_buffer();
+                    hci_emit_transport_packet_sent();
+                }
+                break;
+            }
+#endif
+            return status;
+        }
     }
 
     log_debug("hci_send_acl_packet_fragments loop over");
@@ -1175,6 +1474,13 @@ static void acl_handler(uint8_t *packet, uint16_t size){
 
     // ignore non-registered handle
     if (!conn){
+#ifdef ENABLE_LE_ISOCHRONOUS_STREAMS
+        // USB transport receives ISO Data over the ACL bulk endpoint
+        if (hci_iso_stream_for_con_handle(con_handle) != NULL){
+            hci_iso_packet_handler(packet, size);
+            return;
+        }
+#endif
         log_error("acl_handler called with non-registered handle %u!" , con_handle);
         return;
     }
@@ -1291,8 +1597,12 @@ static void hci_shutdown_connection(hci_connection_t *conn){
 #endif
 
     hci_connection_stop_timer(conn);
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+    hci_acl_tx_buffer_release(conn);
+#endif
 
     btstack_linked_list_remove(&hci_stack->connections, (btstack_linked_item_t *) conn);
+    hci_connection_index_remove_connection(conn);
     btstack_memory_hci_connection_free( conn );
     
     // now it's gone
@@ -2510,6 +2820,7 @@ static void hci_handle_connection_failed(hci_connection_t * conn, uint8_t status
     
     // connection failed, remove entry
     btstack_linked_list_remove(&hci_stack->connections, (btstack_linked_item_t *) conn);
+    hci_connection_index_remove_connection(conn);
     btstack_memory_hci_connection_free( conn );
 
 #ifdef ENABLE_CLASSIC
@@ -3218,6 +3529,7 @@ static void event_handle_le_connection_complete(const uint8_t * packet){
 		if (conn){
 			// remove entry
 			btstack_linked_list_remove(&hci_stack->connections, (btstack_linked_item_t *) conn);
+			hci_connection_index_remove_connection(conn);
 			btstack_memory_hci_connection_free( conn );
 		}
 		return;
@@ -3252,7 +3564,7 @@ static void event_handle_le_connection_complete(const uint8_t * packet){
 	}
 
 	conn->state = OPEN;
-	conn->con_handle             = hci_subevent_le_connection_complete_get_connection_handle(packet);
+	hci_connection_set_con_handle(conn, hci_subevent_le_connection_complete_get_connection_handle(packet));
     conn->le_connection_interval = conn_interval;
 
     // workaround: PAST doesn't work without LE Read Remote Features on PacketCraft Controller with LMP 568B
@@ -3577,7 +3889,7 @@ static void event_handler(uint8_t *packet, uint16_t size){
                 }
                 if (!packet[2]){
                     conn->state = OPEN;
-                    conn->con_handle = little_endian_read_16(packet, 3);
+                    hci_connection_set_con_handle(conn, little_endian_read_16(packet, 3));
 
                     // trigger write supervision timeout if we're master
                     if ((hci_stack->link_supervision_timeout != HCI_LINK_SUPERVISION_TIMEOUT_DEFAULT) && (conn->role == HCI_ROLE_MASTER)){
@@ -3621,7 +3933,7 @@ static void event_handler(uint8_t *packet, uint16_t size){
             }
 
             conn->state = OPEN;
-            conn->con_handle = little_endian_read_16(packet, 3);            
+            hci_connection_set_con_handle(conn, little_endian_read_16(packet, 3));            
 
 #ifdef ENABLE_SCO_OVER_HCI
             // update SCO
@@ -4011,6 +4323,9 @@ static void event_handler(uint8_t *packet, uint16_t size){
             // mark connection for shutdown, stop timers, reset state
             conn->state = RECEIVED_DISCONNECTION_COMPLETE;
             hci_connection_stop_timer(conn);
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+            hci_acl_tx_buffer_release(conn);
+#endif
             hci_connection_init(conn);
 
 #ifdef ENABLE_BLE
@@ -4052,6 +4367,9 @@ static void event_handler(uint8_t *packet, uint16_t size){
                 return; // instead of break: to avoid re-entering hci_run()
             }
             hci_stack->acl_fragmentation_tx_active = 0;
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+            hci_acl_tx_buffer_packet_sent();
+#endif
 #ifdef ENABLE_LE_ISOCHRONOUS_STREAMS
             hci_stack->iso_fragmentation_tx_active = 0;
             if (hci_stack->iso_fragmentation_total_size) break;
@@ -4552,6 +4870,12 @@ static void hci_state_reset(void){
     // buffer is free
     hci_stack->hci_packet_buffer_reserved = false;
 
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+    // tx buffers are free
+    memset(hci_stack->acl_tx_buffers, 0, sizeof(hci_stack->acl_tx_buffers));
+    hci_stack->acl_tx_last_con_handle = HCI_CON_HANDLE_INVALID;
+#endif
+
     // no pending cmds
     hci_stack->decline_reason = 0;
 
@@ -5549,7 +5873,7 @@ static bool hci_run_acl_fragments(void){
         hci_con_handle_t con_handle = READ_ACL_CONNECTION_HANDLE(hci_stack->hci_packet_buffer);
         hci_connection_t *connection = hci_connection_for_handle(con_handle);
         if (connection) {
-            if (hci_can_send_prepared_acl_packet_now(con_handle)){
+            if (hci_can_send_acl_fragment_now(con_handle)){
                 hci_send_acl_packet_fragments(connection);
                 return true;
             }
@@ -5560,7 +5884,11 @@ static bool hci_run_acl_fragments(void){
             hci_stack->acl_fragmentation_pos = 0;
         }
     }
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+    return hci_run_acl_tx_buffer_fragments();
+#else
     return false;
+#endif
 }
 
 #ifdef ENABLE_LE_ISOCHRONOUS_STREAMS
@@ -6078,8 +6406,8 @@ static bool hci_run_general_gap_le(void){
             }
             const uint8_t advertising_handles[] = { advertising_stop_handle };
             const uint16_t durations[] = { 0 };
-            const uint16_t max_events[] = { 0 };
-            hci_send_cmd(&hci_le_set_extended_advertising_enable, 0, 1, advertising_handles, durations, max_events);
+            const uint8_t max_events[] = { 0 };
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_advertising_enable(hci_stack->hci_packet_buffer, 0, 1, advertising_handles, durations, max_events));
         } else
 #endif
         {
@@ -6092,7 +6420,7 @@ static bool hci_run_general_gap_le(void){
 #ifdef ENABLE_LE_PERIODIC_ADVERTISING
     if (periodic_advertising_stop){
         advertising_stop_set->state &= ~LE_ADVERTISEMENT_STATE_PERIODIC_ACTIVE;
-        hci_send_cmd(&hci_le_set_periodic_advertising_enable, 0, advertising_stop_set->advertising_handle);
+        hci_send_encoded_cmd(hci_cmd_encode_le_set_periodic_advertising_enable(hci_stack->hci_packet_buffer, 0, advertising_stop_set->advertising_handle));
         return true;
     }
 #endif /* ENABLE_LE_PERIODIC_ADVERTISING */
@@ -6129,13 +6457,13 @@ static bool hci_run_general_gap_le(void){
                 scan_intervals[i] = hci_stack->le_scan_interval;
                 scan_windows[i]   = hci_stack->le_scan_window;
             }
-            hci_send_cmd(&hci_le_set_extended_scan_parameters, hci_stack->le_own_addr_type,
-                         hci_stack->le_scan_filter_policy, hci_stack->le_scan_phys, scan_types, scan_intervals, scan_windows);
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_scan_parameters(hci_stack->hci_packet_buffer, hci_stack->le_own_addr_type,
+                         hci_stack->le_scan_filter_policy, hci_stack->le_scan_phys, scan_types, scan_intervals, scan_windows));
         } else
 #endif
         {
-            hci_send_cmd(&hci_le_set_scan_parameters, hci_stack->le_scan_type, hci_stack->le_scan_interval, hci_stack->le_scan_window,
-                         hci_stack->le_own_addr_type, hci_stack->le_scan_filter_policy);
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_scan_parameters(hci_stack->hci_packet_buffer, hci_stack->le_scan_type, hci_stack->le_scan_interval, hci_stack->le_scan_window,
+                         hci_stack->le_own_addr_type, hci_stack->le_scan_filter_policy));
         }
         return true;
     }
@@ -6154,7 +6482,7 @@ static bool hci_run_general_gap_le(void){
                 adv_event_properties = mapping[hci_stack->le_advertisements_type];
             }
             hci_stack->le_advertising_set_in_current_command = 0;
-            hci_send_cmd(&hci_le_set_extended_advertising_parameters,
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_advertising_parameters(hci_stack->hci_packet_buffer,
                          0,
                          adv_event_properties,
                          hci_stack->le_advertisements_interval_min,
@@ -6170,11 +6498,11 @@ static bool hci_run_general_gap_le(void){
                          0x01,  // secondary adv phy
                          0,     // adv sid
                          0      // scan request notification
-                         );
+                         ));
         } else
 #endif
         {
-            hci_send_cmd(&hci_le_set_advertising_parameters,
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_advertising_parameters(hci_stack->hci_packet_buffer,
                          hci_stack->le_advertisements_interval_min,
                          hci_stack->le_advertisements_interval_max,
                          hci_stack->le_advertisements_type,
@@ -6182,7 +6510,7 @@ static bool hci_run_general_gap_le(void){
                          hci_stack->le_advertisements_direct_address_type,
                          hci_stack->le_advertisements_direct_address,
                          hci_stack->le_advertisements_channel_map,
-                         hci_stack->le_advertisements_filter_policy);
+                         hci_stack->le_advertisements_filter_policy));
         }
         return true;
     }
@@ -6206,11 +6534,11 @@ static bool hci_run_general_gap_le(void){
 #ifdef ENABLE_LE_EXTENDED_ADVERTISING
         if (hci_extended_advertising_supported()){
             hci_stack->le_advertising_set_in_current_command = 0;
-            hci_send_cmd(&hci_le_set_extended_advertising_data, 0, 0x03, 0x01, hci_stack->le_advertisements_data_len, adv_data_clean);
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_advertising_data(hci_stack->hci_packet_buffer, 0, 0x03, 0x01, hci_stack->le_advertisements_data_len, adv_data_clean));
         } else
 #endif
         {
-            hci_send_cmd(&hci_le_set_advertising_data, hci_stack->le_advertisements_data_len, adv_data_clean);
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_advertising_data(hci_stack->hci_packet_buffer, hci_stack->le_advertisements_data_len, adv_data_clean));
         }
         return true;
     }
@@ -6225,11 +6553,11 @@ static bool hci_run_general_gap_le(void){
 #ifdef ENABLE_LE_EXTENDED_ADVERTISING
         if (hci_extended_advertising_supported()){
             hci_stack->le_advertising_set_in_current_command = 0;
-            hci_send_cmd(&hci_le_set_extended_scan_response_data, 0, 0x03, 0x01, hci_stack->le_scan_response_data_len, scan_data_clean);
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_scan_response_data(hci_stack->hci_packet_buffer, 0, 0x03, 0x01, hci_stack->le_scan_response_data_len, scan_data_clean));
         } else
 #endif
         {
-            hci_send_cmd(&hci_le_set_scan_response_data, hci_stack->le_scan_response_data_len, scan_data_clean);
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_scan_response_data(hci_stack->hci_packet_buffer, hci_stack->le_scan_response_data_len, scan_data_clean));
         }
         return true;
     }
@@ -6249,7 +6577,7 @@ static bool hci_run_general_gap_le(void){
             if ((advertising_set->tasks & LE_ADVERTISEMENT_TASKS_SET_PARAMS) != 0){
                 advertising_set->tasks &= ~LE_ADVERTISEMENT_TASKS_SET_PARAMS;
                 hci_stack->le_advertising_set_in_current_command = advertising_set->advertising_handle;
-                hci_send_cmd(&hci_le_set_extended_advertising_parameters,
+                hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_advertising_parameters(hci_stack->hci_packet_buffer,
                              advertising_set->advertising_handle,
                              advertising_set->extended_params.advertising_event_properties,
                              advertising_set->extended_params.primary_advertising_interval_min,
@@ -6265,7 +6593,7 @@ static bool hci_run_general_gap_le(void){
                              advertising_set->extended_params.secondary_advertising_phy,
                              advertising_set->extended_params.advertising_sid,
                              advertising_set->extended_params.scan_request_notification_enable
-                );
+                ));
                 return true;
             }
             if ((advertising_set->tasks & LE_ADVERTISEMENT_TASKS_SET_ADDRESS) != 0){
@@ -6286,7 +6614,7 @@ static bool hci_run_general_gap_le(void){
                     advertising_set->adv_data_pos += data_to_upload;
                 }
                 hci_stack->le_advertising_set_in_current_command = advertising_set->advertising_handle;
-                hci_send_cmd(&hci_le_set_extended_advertising_data, advertising_set->advertising_handle, operation, 0x01, data_to_upload, &advertising_set->adv_data[pos]);
+                hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_advertising_data(hci_stack->hci_packet_buffer, advertising_set->advertising_handle, operation, 0x01, data_to_upload, &advertising_set->adv_data[pos]));
                 return true;
             }
             if ((advertising_set->tasks & LE_ADVERTISEMENT_TASKS_SET_SCAN_DATA) != 0) {
@@ -6300,18 +6628,18 @@ static bool hci_run_general_gap_le(void){
                     advertising_set->scan_data_pos += data_to_upload;
                 }
                 hci_stack->le_advertising_set_in_current_command = advertising_set->advertising_handle;
-                hci_send_cmd(&hci_le_set_extended_scan_response_data, advertising_set->advertising_handle, operation, 0x01, data_to_upload, &advertising_set->scan_data[pos]);
+                hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_scan_response_data(hci_stack->hci_packet_buffer, advertising_set->advertising_handle, operation, 0x01, data_to_upload, &advertising_set->scan_data[pos]));
                 return true;
             }
 #ifdef ENABLE_LE_PERIODIC_ADVERTISING
             if ((advertising_set->tasks & LE_ADVERTISEMENT_TASKS_SET_PERIODIC_PARAMS) != 0){
                 advertising_set->tasks &= ~LE_ADVERTISEMENT_TASKS_SET_PERIODIC_PARAMS;
                 hci_stack->le_advertising_set_in_current_command = advertising_set->advertising_handle;
-                hci_send_cmd(&hci_le_set_periodic_advertising_parameters,
+                hci_send_encoded_cmd(hci_cmd_encode_le_set_periodic_advertising_parameters(hci_stack->hci_packet_buffer,
                              advertising_set->advertising_handle,
                              advertising_set->periodic_params.periodic_advertising_interval_min,
                              advertising_set->periodic_params.periodic_advertising_interval_max,
-                             advertising_set->periodic_params.periodic_advertising_properties);
+                             advertising_set->periodic_params.periodic_advertising_properties));
                 return true;
             }
             if ((advertising_set->tasks & LE_ADVERTISEMENT_TASKS_SET_PERIODIC_DATA) != 0) {
@@ -6327,7 +6655,7 @@ static bool hci_run_general_gap_le(void){
                     advertising_set->periodic_data_pos += data_to_upload;
                 }
                 hci_stack->le_advertising_set_in_current_command = advertising_set->advertising_handle;
-                hci_send_cmd(&hci_le_set_periodic_advertising_data, advertising_set->advertising_handle, operation, data_to_upload, &advertising_set->periodic_data[pos]);
+                hci_send_encoded_cmd(hci_cmd_encode_le_set_periodic_advertising_data(hci_stack->hci_packet_buffer, advertising_set->advertising_handle, operation, data_to_upload, &advertising_set->periodic_data[pos]));
                 return true;
             }
 #endif /* ENABLE_LE_PERIODIC_ADVERTISING */
@@ -6536,11 +6864,11 @@ static bool hci_run_general_gap_le(void){
         hci_stack->le_scanning_active = true;
 #ifdef ENABLE_LE_EXTENDED_ADVERTISING
         if (hci_extended_advertising_supported()){
-            hci_send_cmd(&hci_le_set_extended_scan_enable, 1, hci_stack->le_scan_filter_duplicates, 0, 0);
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_scan_enable(hci_stack->hci_packet_buffer, 1, hci_stack->le_scan_filter_duplicates, 0, 0));
         } else
 #endif
         {
-            hci_send_cmd(&hci_le_set_scan_enable, 1, hci_stack->le_scan_filter_duplicates);
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_scan_enable(hci_stack->hci_packet_buffer, 1, hci_stack->le_scan_filter_duplicates));
         }
         return true;
     }
@@ -6589,8 +6917,8 @@ static bool hci_run_general_gap_le(void){
         if (hci_extended_advertising_supported()){
             const uint8_t advertising_handles[] = { 0 };
             const uint16_t durations[] = { 0 };
-            const uint16_t max_events[] = { 0 };
-            hci_send_cmd(&hci_le_set_extended_advertising_enable, 1, 1, advertising_handles, durations, max_events);
+            const uint8_t max_events[] = { 0 };
+            hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_advertising_enable(hci_stack->hci_packet_buffer, 1, 1, advertising_handles, durations, max_events));
         } else
 #endif
         {
@@ -6609,8 +6937,8 @@ static bool hci_run_general_gap_le(void){
                 advertising_set->state |= LE_ADVERTISEMENT_STATE_ACTIVE;
                 const uint8_t advertising_handles[] = { advertising_set->advertising_handle };
                 const uint16_t durations[] = { advertising_set->enable_timeout };
-                const uint16_t max_events[] = { advertising_set->enable_max_scan_events };
-                hci_send_cmd(&hci_le_set_extended_advertising_enable, 1, 1, advertising_handles, durations, max_events);
+                const uint8_t max_events[] = { advertising_set->enable_max_scan_events };
+                hci_send_encoded_cmd(hci_cmd_encode_le_set_extended_advertising_enable(hci_stack->hci_packet_buffer, 1, 1, advertising_handles, durations, max_events));
                 return true;
             }
 #ifdef ENABLE_LE_PERIODIC_ADVERTISING
@@ -6620,7 +6948,7 @@ static bool hci_run_general_gap_le(void){
                 if (advertising_set->periodic_include_adi){
                     enable |= 2;
                 }
-                hci_send_cmd(&hci_le_set_periodic_advertising_enable, enable, advertising_set->advertising_handle);
+                hci_send_encoded_cmd(hci_cmd_encode_le_set_periodic_advertising_enable(hci_stack->hci_packet_buffer, enable, advertising_set->advertising_handle));
                 return true;
             }
 #endif /* ENABLE_LE_PERIODIC_ADVERTISING */
@@ -6665,7 +6993,7 @@ static bool hci_run_iso_tasks(void){
                 return true;
             case LE_AUDIO_BIG_STATE_SETUP_ISO_PATH:
                 big->state = LE_AUDIO_BIG_STATE_W4_SETUP_ISO_PATH;
-                hci_send_cmd(&hci_le_setup_iso_data_path, big->bis_con_handles[big->state_vars.next_bis], 0, 0,  0, 0, 0,  0, 0, NULL);
+                hci_send_encoded_cmd(hci_cmd_encode_le_setup_iso_data_path(hci_stack->hci_packet_buffer, big->bis_con_handles[big->state_vars.next_bis], 0, 0,  0, 0, 0,  0, 0, NULL));
                 return true;
             case LE_AUDIO_BIG_STATE_SETUP_ISO_PATHS_FAILED:
                 big->state = LE_AUDIO_BIG_STATE_W4_TERMINATED_AFTER_SETUP_FAILED;
@@ -6701,7 +7029,7 @@ static bool hci_run_iso_tasks(void){
                 return true;
             case LE_AUDIO_BIG_STATE_SETUP_ISO_PATH:
                 big_sync->state = LE_AUDIO_BIG_STATE_W4_SETUP_ISO_PATH;
-                hci_send_cmd(&hci_le_setup_iso_data_path, big_sync->bis_con_handles[big_sync->state_vars.next_bis], 1, 0, 0, 0, 0, 0, 0, NULL);
+                hci_send_encoded_cmd(hci_cmd_encode_le_setup_iso_data_path(hci_stack->hci_packet_buffer, big_sync->bis_con_handles[big_sync->state_vars.next_bis], 1, 0, 0, 0, 0, 0, 0, NULL));
                 return true;
             case LE_AUDIO_BIG_STATE_SETUP_ISO_PATHS_FAILED:
                 big_sync->state = LE_AUDIO_BIG_STATE_W4_TERMINATED_AFTER_SETUP_FAILED;
@@ -6745,7 +7073,7 @@ static bool hci_run_iso_tasks(void){
                     rtn_c_to_p[i]     = cis_params->rtn_c_to_p;
                     rtn_p_to_c[i]     = cis_params->rtn_p_to_c;
                 }
-                hci_send_cmd(&hci_le_set_cig_parameters,
+                hci_send_encoded_cmd(hci_cmd_encode_le_set_cig_parameters(hci_stack->hci_packet_buffer,
                              cig->cig_id,
                              params->sdu_interval_c_to_p,
                              params->sdu_interval_p_to_c,
@@ -6762,7 +7090,7 @@ static bool hci_run_iso_tasks(void){
                              phy_p_to_c,
                              rtn_c_to_p,
                              rtn_p_to_c
-                );
+                ));
                 return true;
             case LE_AUDIO_CIG_STATE_CREATE_CIS:
                 hci_stack->iso_active_operation_group_id = cig->params->cig_id;
@@ -6771,7 +7099,7 @@ static bool hci_run_iso_tasks(void){
                 for (i=0;i<cig->num_cis;i++){
                     cig->cis_setup_active[i] = true;
                 }
-                hci_send_cmd(&hci_le_create_cis, cig->num_cis, cig->cis_con_handles, cig->acl_con_handles);
+                hci_send_encoded_cmd(hci_cmd_encode_le_create_cis(hci_stack->hci_packet_buffer, cig->num_cis, cig->cis_con_handles, cig->acl_con_handles));
                 return true;
             case LE_AUDIO_CIG_STATE_SETUP_ISO_PATH:
                 while (cig->state_vars.next_cis < (cig->num_cis * 2)){
@@ -6795,7 +7123,7 @@ static bool hci_run_iso_tasks(void){
                         hci_stack->iso_active_operation_group_id = cig->params->cig_id;
                         hci_stack->iso_active_operation_type = HCI_ISO_TYPE_CIS;
                         cig->state = LE_AUDIO_CIG_STATE_W4_SETUP_ISO_PATH;
-                        hci_send_cmd(&hci_le_setup_iso_data_path, cig->cis_con_handles[cis_index], cis_direction, 0, 0, 0, 0, 0, 0, NULL);
+                        hci_send_encoded_cmd(hci_cmd_encode_le_setup_iso_data_path(hci_stack->hci_packet_buffer, cig->cis_con_handles[cis_index], cis_direction, 0, 0, 0, 0, 0, 0, NULL));
                         return true;
                     }
                     cig->state_vars.next_cis++;
@@ -6830,13 +7158,13 @@ static bool hci_run_iso_tasks(void){
                 hci_stack->iso_active_operation_group_id = HCI_ISO_GROUP_ID_SINGLE_CIS;
                 hci_stack->iso_active_operation_type = HCI_ISO_TYPE_CIS;
                 iso_stream->state = HCI_ISO_STREAM_STATE_W4_ISO_SETUP_INPUT;
-                hci_send_cmd(&hci_le_setup_iso_data_path, iso_stream->cis_handle, 0, 0, 0, 0, 0, 0, 0, NULL);
+                hci_send_encoded_cmd(hci_cmd_encode_le_setup_iso_data_path(hci_stack->hci_packet_buffer, iso_stream->cis_handle, 0, 0, 0, 0, 0, 0, 0, NULL));
                 break;
             case HCI_ISO_STREAM_STATE_W2_SETUP_ISO_OUTPUT:
                 hci_stack->iso_active_operation_group_id = HCI_ISO_GROUP_ID_SINGLE_CIS;
                 hci_stack->iso_active_operation_type = HCI_ISO_TYPE_CIS;
                 iso_stream->state = HCI_ISO_STREAM_STATE_W4_ISO_SETUP_OUTPUT;
-                hci_send_cmd(&hci_le_setup_iso_data_path, iso_stream->cis_handle, 1, 0, 0, 0, 0, 0, 0, NULL);
+                hci_send_encoded_cmd(hci_cmd_encode_le_setup_iso_data_path(hci_stack->hci_packet_buffer, iso_stream->cis_handle, 1, 0, 0, 0, 0, 0, 0, NULL));
                 break;
             default:
                 break;
@@ -7508,19 +7836,14 @@ bool gap_secure_connections_active(void){
 #endif
 
 // va_list part of hci_send_cmd
-uint8_t hci_send_cmd_va_arg(const hci_cmd_t * cmd, va_list argptr){
-    if (!hci_can_send_command_packet_now()){ 
-        log_error("hci_send_cmd called but cannot send packet now");
-        return ERROR_CODE_COMMAND_DISALLOWED;
-    }
-
-    // for HCI INITIALIZATION
-    // log_info("hci_send_cmd: opcode %04x", cmd->opcode);
-    hci_stack->last_cmd_opcode = cmd->opcode;
+/**
+ * pre: hci_can_send_command_packet_now() and HCI Command of given size stored in hci_packet_buffer
+ */
+static uint8_t hci_send_encoded_cmd(uint16_t size){
+    uint8_t * packet = hci_stack->hci_packet_buffer;
+    hci_stack->last_cmd_opcode = little_endian_read_16(packet, 0);
 
     hci_reserve_packet_buffer();
-    uint8_t * packet = hci_stack->hci_packet_buffer;
-    uint16_t size = hci_cmd_create_from_template(packet, cmd, argptr);
     uint8_t status = hci_send_cmd_packet(packet, size);
 
     // release packet buffer on error or for synchronous transport implementations
@@ -7532,6 +7855,18 @@ uint8_t hci_send_cmd_va_arg(const hci_cmd_t * cmd, va_list argptr){
     return status;
 }
 
+uint8_t hci_send_cmd_va_arg(const hci_cmd_t * cmd, va_list argptr){
+    if (!hci_can_send_command_packet_now()){ 
+        log_error("hci_send_cmd called but cannot send packet now");
+        return ERROR_CODE_COMMAND_DISALLOWED;
+    }
+
+    // for HCI INITIALIZATION
+    // log_info("hci_send_cmd: opcode %04x", cmd->opcode);
+    uint16_t size = hci_cmd_create_from_template(hci_stack->hci_packet_buffer, cmd, argptr);
+    return hci_send_encoded_cmd(size);
+}
+
 /**
  * pre: numcmds >= 0 - it's allowed to send a command to the controller
  */
@@ -8168,6 +8503,7 @@ uint8_t gap_connect_cancel(void){
                         // skip sending create connection and emit event instead
                         hci_emit_le_connection_complete(conn->address_type, conn->address, 0, ERROR_CODE_UNKNOWN_CONNECTION_IDENTIFIER);
                         btstack_linked_list_remove(&hci_stack->connections, (btstack_linked_item_t *) conn);
+                        hci_connection_index_remove_connection(conn);
                         btstack_memory_hci_connection_free( conn );
                         break;
                     case SENT_CREATE_CONNECTION:
@@ -10231,35 +10567,35 @@ void hci_setup_test_connections_fuzz(void){
     // setup incoming Classic ACL connection with con handle 0x0001, 66:55:44:33:22:01
     addr[5] = 0x01;
     conn = create_connection_for_bd_addr_and_type(addr, BD_ADDR_TYPE_ACL, HCI_ROLE_SLAVE);
-    conn->con_handle = addr[5];
+    hci_connection_set_con_handle(conn, addr[5]);
     conn->state = RECEIVED_CONNECTION_REQUEST;
     conn->sm_connection.sm_role = HCI_ROLE_SLAVE;
 
     // setup incoming Classic SCO connection with con handle 0x0002
     addr[5] = 0x02;
     conn = create_connection_for_bd_addr_and_type(addr, BD_ADDR_TYPE_SCO, HCI_ROLE_SLAVE);
-    conn->con_handle = addr[5];
+    hci_connection_set_con_handle(conn, addr[5]);
     conn->state = RECEIVED_CONNECTION_REQUEST;
     conn->sm_connection.sm_role = HCI_ROLE_SLAVE;
 
     // setup ready Classic ACL connection with con handle 0x0003
     addr[5] = 0x03;
     conn = create_connection_for_bd_addr_and_type(addr, BD_ADDR_TYPE_ACL, HCI_ROLE_SLAVE);
-    conn->con_handle = addr[5];
+    hci_connection_set_con_handle(conn, addr[5]);
     conn->state = OPEN;
     conn->sm_connection.sm_role = HCI_ROLE_SLAVE;
 
     // setup ready Classic SCO connection with con handle 0x0004
     addr[5] = 0x04;
     conn = create_connection_for_bd_addr_and_type(addr, BD_ADDR_TYPE_SCO, HCI_ROLE_SLAVE);
-    conn->con_handle = addr[5];
+    hci_connection_set_con_handle(conn, addr[5]);
     conn->state = OPEN;
     conn->sm_connection.sm_role = HCI_ROLE_SLAVE;
 
     // setup ready LE ACL connection with con handle 0x005 and public address
     addr[5] = 0x05;
     conn = create_connection_for_bd_addr_and_type(addr, BD_ADDR_TYPE_LE_PUBLIC, HCI_ROLE_SLAVE);
-    conn->con_handle = addr[5];
+    hci_connection_set_con_handle(conn, addr[5]);
     conn->state = OPEN;
     conn->sm_connection.sm_role = HCI_ROLE_SLAVE;
     conn->sm_connection.sm_connection_encrypted = 1;
@@ -10271,6 +10607,7 @@ void hci_free_connections_fuzz(void){
     while (btstack_linked_list_iterator_has_next(&it)){
         hci_connection_t * con = (hci_connection_t*) btstack_linked_list_iterator_next(&it);
         btstack_linked_list_iterator_remove(&it);
+        hci_connection_index_remove_connection(con);
         btstack_memory_hci_connection_free(con);
     }
 }
@@ -520,6 +520,25 @@ typedef struct {
     uint16_t                  fixed_channels_supported;    // Core V5.3 - only first octet used
 } l2cap_state_t;
 
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+// number of ACL tx buffers that can hold the remaining fragments of an outgoing ACL packet
+#ifndef HCI_ACL_TX_BUFFER_POOL_SIZE
+#ifdef MAX_NR_HCI_CONNECTIONS
+#define HCI_ACL_TX_BUFFER_POOL_SIZE MAX_NR_HCI_CONNECTIONS
+#else
+#define HCI_ACL_TX_BUFFER_POOL_SIZE 4
+#endif
+#endif
+typedef struct {
+    // assigned to connection
+    bool    in_use;
+    // fragment passed to HCI Transport, buffer cannot be reused until packet sent
+    bool    in_flight;
+    // pre-buffer for H4 drivers + ACL packet
+    uint8_t data[HCI_OUTGOING_PRE_BUFFER_SIZE + HCI_ACL_BUFFER_SIZE];
+} hci_acl_tx_buffer_t;
+#endif
+
 //
 typedef struct {
     // linked list - assert: first field
@@ -631,6 +650,13 @@ typedef struct {
     uint8_t num_packets_completed;
 #endif
 
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+    // remaining fragments of outgoing ACL packet - ACL Header + ACL payload
+    hci_acl_tx_buffer_t * acl_tx_buffer;
+    uint16_t acl_tx_fragmentation_pos;
+    uint16_t acl_tx_fragmentation_total_size;
+#endif
+
     // LE Connection parameter update
     le_con_parameter_update_state_t le_con_parameter_update_state;
     uint8_t  le_con_param_update_identifier;
@@ -954,6 +980,20 @@ typedef enum {
     LE_RESOLVING_LIST_DONE
 } le_resolving_list_state_t;
 
+#ifdef ENABLE_HCI_CONNECTION_INDEX
+// number of slots in each connection index, must be a power of two and should be at least twice the max number of connections
+#ifndef HCI_CONNECTION_INDEX_SIZE
+#define HCI_CONNECTION_INDEX_SIZE 32
+#endif
+#if (HCI_CONNECTION_INDEX_SIZE & (HCI_CONNECTION_INDEX_SIZE - 1)) != 0
+#error "HCI_CONNECTION_INDEX_SIZE must be a power of two"
+#endif
+typedef struct {
+    hci_connection_t * connection;
+    uint32_t           hash;
+} hci_connection_index_entry_t;
+#endif
+
 /**
  * main data structure
  */
@@ -979,6 +1019,12 @@ typedef struct {
     // list of existing baseband connections
     btstack_linked_list_t     connections;
 
+#ifdef ENABLE_HCI_CONNECTION_INDEX
+    // open addressing hash tables for connection lookup by con handle and by address + type
+    hci_connection_index_entry_t connections_by_handle[HCI_CONNECTION_INDEX_SIZE];
+    hci_connection_index_entry_t connections_by_address[HCI_CONNECTION_INDEX_SIZE];
+#endif
+
     /* callback to L2CAP layer */
     btstack_packet_handler_t acl_packet_handler;
 
@@ -1074,6 +1120,13 @@ typedef struct {
     uint16_t  acl_fragmentation_pos;
     uint16_t  acl_fragmentation_total_size;
     uint8_t   acl_fragmentation_tx_active;
+
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+    // buffers for remaining fragments per connection, frees hci_packet_buffer for other connections
+    hci_acl_tx_buffer_t acl_tx_buffers[HCI_ACL_TX_BUFFER_POOL_SIZE];
+    // round robin over connections with pending fragments
+    hci_con_handle_t    acl_tx_last_con_handle;
+#endif
      
     /* host to controller flow control */
     uint8_t  num_cmd_packets;
@@ -0,0 +1,5532 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/**
+ * HCI Command Encoder
+ *
+ * Typed encoders for the HCI Commands defined in hci_cmd.c. Each encoder stores the complete
+ * HCI Command packet incl. opcode and parameter length in the provided buffer and returns its size.
+ * The result is identical to hci_cmd_create_from_template with the hci_cmd_t format string.
+ *
+ * Note: Don't edit this file. It is generated by tool/btstack_hci_cmd_generator.py
+ *
+ */
+
+#ifndef HCI_CMD_ENCODER_H
+#define HCI_CMD_ENCODER_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+#include "bluetooth.h"
+#include "btstack_util.h"
+#include "hci_cmd.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/**
+ * @brief Encode hci_inquiry
+ * @param hci_cmd_buffer
+ * @param lap
+ * @param inquiry_length
+ * @param num_responses
+ * @return size of HCI Command packet
+ * @note: format 311
+ */
+static inline uint16_t hci_cmd_encode_inquiry(uint8_t * hci_cmd_buffer, uint32_t lap, uint8_t inquiry_length, uint8_t num_responses){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) lap;
+    hci_cmd_buffer[pos++] = (uint8_t) (lap >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (lap >> 16);
+    hci_cmd_buffer[pos++] = inquiry_length;
+    hci_cmd_buffer[pos++] = num_responses;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_INQUIRY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_INQUIRY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_inquiry_cancel
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_inquiry_cancel(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_INQUIRY_CANCEL;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_INQUIRY_CANCEL >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_periodic_inquiry_mode
+ * @param hci_cmd_buffer
+ * @param max_period_length
+ * @param min_period_length
+ * @param lap
+ * @param inquiry_length
+ * @param num_responses
+ * @return size of HCI Command packet
+ * @note: format 22311
+ */
+static inline uint16_t hci_cmd_encode_periodic_inquiry_mode(uint8_t * hci_cmd_buffer, uint16_t max_period_length, uint16_t min_period_length, uint32_t lap, uint8_t inquiry_length, uint8_t num_responses){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) max_period_length;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_period_length >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) min_period_length;
+    hci_cmd_buffer[pos++] = (uint8_t) (min_period_length >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) lap;
+    hci_cmd_buffer[pos++] = (uint8_t) (lap >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (lap >> 16);
+    hci_cmd_buffer[pos++] = inquiry_length;
+    hci_cmd_buffer[pos++] = num_responses;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_PERIODIC_INQUIRY_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_PERIODIC_INQUIRY_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_exit_periodic_inquiry_mode
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_exit_periodic_inquiry_mode(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_EXIT_PERIODIC_INQUIRY_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_EXIT_PERIODIC_INQUIRY_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_create_connection
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param packet_type
+ * @param page_scan_repetition_mode
+ * @param reserved
+ * @param clock_offset
+ * @param allow_role_switch
+ * @return size of HCI Command packet
+ * @note: format B21121
+ */
+static inline uint16_t hci_cmd_encode_create_connection(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint16_t packet_type, uint8_t page_scan_repetition_mode, uint8_t reserved, uint16_t clock_offset, uint8_t allow_role_switch){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = (uint8_t) packet_type;
+    hci_cmd_buffer[pos++] = (uint8_t) (packet_type >> 8);
+    hci_cmd_buffer[pos++] = page_scan_repetition_mode;
+    hci_cmd_buffer[pos++] = reserved;
+    hci_cmd_buffer[pos++] = (uint8_t) clock_offset;
+    hci_cmd_buffer[pos++] = (uint8_t) (clock_offset >> 8);
+    hci_cmd_buffer[pos++] = allow_role_switch;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_CREATE_CONNECTION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_CREATE_CONNECTION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_disconnect
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param reason
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_disconnect(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint8_t reason){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = reason;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_DISCONNECT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_DISCONNECT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_create_connection_cancel
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format B
+ */
+static inline uint16_t hci_cmd_encode_create_connection_cancel(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_CREATE_CONNECTION_CANCEL;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_CREATE_CONNECTION_CANCEL >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_accept_connection_request
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param role
+ * @return size of HCI Command packet
+ * @note: format B1
+ */
+static inline uint16_t hci_cmd_encode_accept_connection_request(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint8_t role){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = role;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_ACCEPT_CONNECTION_REQUEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_ACCEPT_CONNECTION_REQUEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_reject_connection_request
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param reason
+ * @return size of HCI Command packet
+ * @note: format B1
+ */
+static inline uint16_t hci_cmd_encode_reject_connection_request(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint8_t reason){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = reason;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_REJECT_CONNECTION_REQUEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_REJECT_CONNECTION_REQUEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_link_key_request_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param link_key
+ * @return size of HCI Command packet
+ * @note: format BP
+ */
+static inline uint16_t hci_cmd_encode_link_key_request_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, const uint8_t * link_key){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    (void) memcpy(&hci_cmd_buffer[pos], link_key, 16);
+    pos += 16;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LINK_KEY_REQUEST_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LINK_KEY_REQUEST_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_link_key_request_negative_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format B
+ */
+static inline uint16_t hci_cmd_encode_link_key_request_negative_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LINK_KEY_REQUEST_NEGATIVE_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LINK_KEY_REQUEST_NEGATIVE_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_pin_code_request_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param pin_length
+ * @param pin
+ * @return size of HCI Command packet
+ * @note: format B1P
+ */
+static inline uint16_t hci_cmd_encode_pin_code_request_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint8_t pin_length, const uint8_t * pin){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = pin_length;
+    (void) memcpy(&hci_cmd_buffer[pos], pin, 16);
+    pos += 16;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_PIN_CODE_REQUEST_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_PIN_CODE_REQUEST_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_pin_code_request_negative_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format B
+ */
+static inline uint16_t hci_cmd_encode_pin_code_request_negative_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_PIN_CODE_REQUEST_NEGATIVE_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_PIN_CODE_REQUEST_NEGATIVE_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_change_connection_packet_type
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param packet_type
+ * @return size of HCI Command packet
+ * @note: format H2
+ */
+static inline uint16_t hci_cmd_encode_change_connection_packet_type(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint16_t packet_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) packet_type;
+    hci_cmd_buffer[pos++] = (uint8_t) (packet_type >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_CHANGE_CONNECTION_PACKET_TYPE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_CHANGE_CONNECTION_PACKET_TYPE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_authentication_requested
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_authentication_requested(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_AUTHENTICATION_REQUESTED;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_AUTHENTICATION_REQUESTED >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_set_connection_encryption
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param encryption_enable
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_set_connection_encryption(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint8_t encryption_enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = encryption_enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_SET_CONNECTION_ENCRYPTION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_SET_CONNECTION_ENCRYPTION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_change_connection_link_key
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_change_connection_link_key(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_CHANGE_CONNECTION_LINK_KEY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_CHANGE_CONNECTION_LINK_KEY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_remote_name_request
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param page_scan_repetition_mode
+ * @param reserved
+ * @param clock_offset
+ * @return size of HCI Command packet
+ * @note: format B112
+ */
+static inline uint16_t hci_cmd_encode_remote_name_request(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint8_t page_scan_repetition_mode, uint8_t reserved, uint16_t clock_offset){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = page_scan_repetition_mode;
+    hci_cmd_buffer[pos++] = reserved;
+    hci_cmd_buffer[pos++] = (uint8_t) clock_offset;
+    hci_cmd_buffer[pos++] = (uint8_t) (clock_offset >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_REMOTE_NAME_REQUEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_REMOTE_NAME_REQUEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_remote_name_request_cancel
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format B
+ */
+static inline uint16_t hci_cmd_encode_remote_name_request_cancel(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_REMOTE_NAME_REQUEST_CANCEL;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_REMOTE_NAME_REQUEST_CANCEL >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_remote_supported_features_command
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_read_remote_supported_features_command(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_REMOTE_SUPPORTED_FEATURES_COMMAND;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_REMOTE_SUPPORTED_FEATURES_COMMAND >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_remote_extended_features_command
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_read_remote_extended_features_command(uint8_t * hci_cmd_buffer, hci_con_handle_t param_0, uint8_t param_1){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) param_0;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_0 >> 8);
+    hci_cmd_buffer[pos++] = param_1;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_REMOTE_EXTENDED_FEATURES_COMMAND;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_REMOTE_EXTENDED_FEATURES_COMMAND >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_remote_version_information
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_read_remote_version_information(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_REMOTE_VERSION_INFORMATION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_REMOTE_VERSION_INFORMATION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_setup_synchronous_connection
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param transmit_bandwidth
+ * @param receive_bandwidth
+ * @param max_latency
+ * @param voice_settings
+ * @param retransmission_effort
+ * @param packet_type
+ * @return size of HCI Command packet
+ * @note: format H442212
+ */
+static inline uint16_t hci_cmd_encode_setup_synchronous_connection(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint32_t transmit_bandwidth, uint32_t receive_bandwidth, uint16_t max_latency, uint16_t voice_settings, uint8_t retransmission_effort, uint16_t packet_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) transmit_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) receive_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) max_latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_latency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) voice_settings;
+    hci_cmd_buffer[pos++] = (uint8_t) (voice_settings >> 8);
+    hci_cmd_buffer[pos++] = retransmission_effort;
+    hci_cmd_buffer[pos++] = (uint8_t) packet_type;
+    hci_cmd_buffer[pos++] = (uint8_t) (packet_type >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_SETUP_SYNCHRONOUS_CONNECTION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_SETUP_SYNCHRONOUS_CONNECTION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_accept_synchronous_connection
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param transmit_bandwidth
+ * @param receive_bandwidth
+ * @param max_latency
+ * @param voice_settings
+ * @param retransmission_effort
+ * @param packet_type
+ * @return size of HCI Command packet
+ * @note: format B442212
+ */
+static inline uint16_t hci_cmd_encode_accept_synchronous_connection(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint32_t transmit_bandwidth, uint32_t receive_bandwidth, uint16_t max_latency, uint16_t voice_settings, uint8_t retransmission_effort, uint16_t packet_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = (uint8_t) transmit_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) receive_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) max_latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_latency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) voice_settings;
+    hci_cmd_buffer[pos++] = (uint8_t) (voice_settings >> 8);
+    hci_cmd_buffer[pos++] = retransmission_effort;
+    hci_cmd_buffer[pos++] = (uint8_t) packet_type;
+    hci_cmd_buffer[pos++] = (uint8_t) (packet_type >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_ACCEPT_SYNCHRONOUS_CONNECTION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_ACCEPT_SYNCHRONOUS_CONNECTION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_io_capability_request_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param io_capability
+ * @param oob_data_present
+ * @param authentication_requirements
+ * @return size of HCI Command packet
+ * @note: format B111
+ */
+static inline uint16_t hci_cmd_encode_io_capability_request_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint8_t io_capability, uint8_t oob_data_present, uint8_t authentication_requirements){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = io_capability;
+    hci_cmd_buffer[pos++] = oob_data_present;
+    hci_cmd_buffer[pos++] = authentication_requirements;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_IO_CAPABILITY_REQUEST_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_IO_CAPABILITY_REQUEST_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_user_confirmation_request_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format B
+ */
+static inline uint16_t hci_cmd_encode_user_confirmation_request_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_USER_CONFIRMATION_REQUEST_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_USER_CONFIRMATION_REQUEST_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_user_confirmation_request_negative_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format B
+ */
+static inline uint16_t hci_cmd_encode_user_confirmation_request_negative_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_USER_CONFIRMATION_REQUEST_NEGATIVE_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_USER_CONFIRMATION_REQUEST_NEGATIVE_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_user_passkey_request_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param numeric_value
+ * @return size of HCI Command packet
+ * @note: format B4
+ */
+static inline uint16_t hci_cmd_encode_user_passkey_request_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint32_t numeric_value){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = (uint8_t) numeric_value;
+    hci_cmd_buffer[pos++] = (uint8_t) (numeric_value >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (numeric_value >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (numeric_value >> 24);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_USER_PASSKEY_REQUEST_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_USER_PASSKEY_REQUEST_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_user_passkey_request_negative_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format B
+ */
+static inline uint16_t hci_cmd_encode_user_passkey_request_negative_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_USER_PASSKEY_REQUEST_NEGATIVE_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_USER_PASSKEY_REQUEST_NEGATIVE_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_remote_oob_data_request_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param c
+ * @param r
+ * @return size of HCI Command packet
+ * @note: format BKK
+ */
+static inline uint16_t hci_cmd_encode_remote_oob_data_request_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, const uint8_t * c, const uint8_t * r){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    reverse_bytes(c, &hci_cmd_buffer[pos], 16);
+    pos += 16;
+    reverse_bytes(r, &hci_cmd_buffer[pos], 16);
+    pos += 16;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_REMOTE_OOB_DATA_REQUEST_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_REMOTE_OOB_DATA_REQUEST_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_remote_oob_data_request_negative_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format B
+ */
+static inline uint16_t hci_cmd_encode_remote_oob_data_request_negative_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_REMOTE_OOB_DATA_REQUEST_NEGATIVE_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_REMOTE_OOB_DATA_REQUEST_NEGATIVE_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_io_capability_request_negative_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param reason
+ * @return size of HCI Command packet
+ * @note: format B1
+ */
+static inline uint16_t hci_cmd_encode_io_capability_request_negative_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint8_t reason){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = reason;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_IO_CAPABILITY_REQUEST_NEGATIVE_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_IO_CAPABILITY_REQUEST_NEGATIVE_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_enhanced_setup_synchronous_connection
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param transmit_bandwidth
+ * @param receive_bandwidth
+ * @param transmit_coding_format_type
+ * @param transmit_coding_format_company
+ * @param transmit_coding_format_codec
+ * @param receive_coding_format_type
+ * @param receive_coding_format_company
+ * @param receive_coding_format_codec
+ * @param transmit_coding_frame_size
+ * @param receive_coding_frame_size
+ * @param input_bandwidth
+ * @param output_bandwidth
+ * @param input_coding_format_type
+ * @param input_coding_format_company
+ * @param input_coding_format_codec
+ * @param output_coding_format_type
+ * @param output_coding_format_company
+ * @param output_coding_format_codec
+ * @param input_coded_data_size
+ * @param outupt_coded_data_size
+ * @param input_pcm_data_format
+ * @param output_pcm_data_format
+ * @param input_pcm_sample_payload_msb_position
+ * @param output_pcm_sample_payload_msb_position
+ * @param input_data_path
+ * @param output_data_path
+ * @param input_transport_unit_size
+ * @param output_transport_unit_size
+ * @param max_latency
+ * @param packet_type
+ * @param retransmission_effort
+ * @return size of HCI Command packet
+ * @note: format H4412212222441221222211111111221
+ */
+static inline uint16_t hci_cmd_encode_enhanced_setup_synchronous_connection(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint32_t transmit_bandwidth, uint32_t receive_bandwidth, uint8_t transmit_coding_format_type, uint16_t transmit_coding_format_company, uint16_t transmit_coding_format_codec, uint8_t receive_coding_format_type, uint16_t receive_coding_format_company, uint16_t receive_coding_format_codec, uint16_t transmit_coding_frame_size, uint16_t receive_coding_frame_size, uint32_t input_bandwidth, uint32_t output_bandwidth, uint8_t input_coding_format_type, uint16_t input_coding_format_company, uint16_t input_coding_format_codec, uint8_t output_coding_format_type, uint16_t output_coding_format_company, uint16_t output_coding_format_codec, uint16_t input_coded_data_size, uint16_t outupt_coded_data_size, uint8_t input_pcm_data_format, uint8_t output_pcm_data_format, uint8_t input_pcm_sample_payload_msb_position, uint8_t output_pcm_sample_payload_msb_position, uint8_t input_data_path, uint8_t output_data_path, uint8_t input_transport_unit_size, uint8_t output_transport_unit_size, uint16_t max_latency, uint16_t packet_type, uint8_t retransmission_effort){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) transmit_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) receive_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = transmit_coding_format_type;
+    hci_cmd_buffer[pos++] = (uint8_t) transmit_coding_format_company;
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_coding_format_company >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) transmit_coding_format_codec;
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_coding_format_codec >> 8);
+    hci_cmd_buffer[pos++] = receive_coding_format_type;
+    hci_cmd_buffer[pos++] = (uint8_t) receive_coding_format_company;
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_coding_format_company >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) receive_coding_format_codec;
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_coding_format_codec >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) transmit_coding_frame_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_coding_frame_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) receive_coding_frame_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_coding_frame_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) input_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (input_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (input_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (input_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) output_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (output_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (output_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (output_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = input_coding_format_type;
+    hci_cmd_buffer[pos++] = (uint8_t) input_coding_format_company;
+    hci_cmd_buffer[pos++] = (uint8_t) (input_coding_format_company >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) input_coding_format_codec;
+    hci_cmd_buffer[pos++] = (uint8_t) (input_coding_format_codec >> 8);
+    hci_cmd_buffer[pos++] = output_coding_format_type;
+    hci_cmd_buffer[pos++] = (uint8_t) output_coding_format_company;
+    hci_cmd_buffer[pos++] = (uint8_t) (output_coding_format_company >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) output_coding_format_codec;
+    hci_cmd_buffer[pos++] = (uint8_t) (output_coding_format_codec >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) input_coded_data_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (input_coded_data_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) outupt_coded_data_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (outupt_coded_data_size >> 8);
+    hci_cmd_buffer[pos++] = input_pcm_data_format;
+    hci_cmd_buffer[pos++] = output_pcm_data_format;
+    hci_cmd_buffer[pos++] = input_pcm_sample_payload_msb_position;
+    hci_cmd_buffer[pos++] = output_pcm_sample_payload_msb_position;
+    hci_cmd_buffer[pos++] = input_data_path;
+    hci_cmd_buffer[pos++] = output_data_path;
+    hci_cmd_buffer[pos++] = input_transport_unit_size;
+    hci_cmd_buffer[pos++] = output_transport_unit_size;
+    hci_cmd_buffer[pos++] = (uint8_t) max_latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_latency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) packet_type;
+    hci_cmd_buffer[pos++] = (uint8_t) (packet_type >> 8);
+    hci_cmd_buffer[pos++] = retransmission_effort;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_ENHANCED_SETUP_SYNCHRONOUS_CONNECTION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_ENHANCED_SETUP_SYNCHRONOUS_CONNECTION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_enhanced_accept_synchronous_connection
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param transmit_bandwidth
+ * @param receive_bandwidth
+ * @param transmit_coding_format_type
+ * @param transmit_coding_format_company
+ * @param transmit_coding_format_codec
+ * @param receive_coding_format_type
+ * @param receive_coding_format_company
+ * @param receive_coding_format_codec
+ * @param transmit_coding_frame_size
+ * @param receive_coding_frame_size
+ * @param input_bandwidth
+ * @param output_bandwidth
+ * @param input_coding_format_type
+ * @param input_coding_format_company
+ * @param input_coding_format_codec
+ * @param output_coding_format_type
+ * @param output_coding_format_company
+ * @param output_coding_format_codec
+ * @param input_coded_data_size
+ * @param outupt_coded_data_size
+ * @param input_pcm_data_format
+ * @param output_pcm_data_format
+ * @param input_pcm_sample_payload_msb_position
+ * @param output_pcm_sample_payload_msb_position
+ * @param input_data_path
+ * @param output_data_path
+ * @param input_transport_unit_size
+ * @param output_transport_unit_size
+ * @param max_latency
+ * @param packet_type
+ * @param retransmission_effort
+ * @return size of HCI Command packet
+ * @note: format B4412212222441221222211111111221
+ */
+static inline uint16_t hci_cmd_encode_enhanced_accept_synchronous_connection(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint32_t transmit_bandwidth, uint32_t receive_bandwidth, uint8_t transmit_coding_format_type, uint16_t transmit_coding_format_company, uint16_t transmit_coding_format_codec, uint8_t receive_coding_format_type, uint16_t receive_coding_format_company, uint16_t receive_coding_format_codec, uint16_t transmit_coding_frame_size, uint16_t receive_coding_frame_size, uint32_t input_bandwidth, uint32_t output_bandwidth, uint8_t input_coding_format_type, uint16_t input_coding_format_company, uint16_t input_coding_format_codec, uint8_t output_coding_format_type, uint16_t output_coding_format_company, uint16_t output_coding_format_codec, uint16_t input_coded_data_size, uint16_t outupt_coded_data_size, uint8_t input_pcm_data_format, uint8_t output_pcm_data_format, uint8_t input_pcm_sample_payload_msb_position, uint8_t output_pcm_sample_payload_msb_position, uint8_t input_data_path, uint8_t output_data_path, uint8_t input_transport_unit_size, uint8_t output_transport_unit_size, uint16_t max_latency, uint16_t packet_type, uint8_t retransmission_effort){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = (uint8_t) transmit_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) receive_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = transmit_coding_format_type;
+    hci_cmd_buffer[pos++] = (uint8_t) transmit_coding_format_company;
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_coding_format_company >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) transmit_coding_format_codec;
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_coding_format_codec >> 8);
+    hci_cmd_buffer[pos++] = receive_coding_format_type;
+    hci_cmd_buffer[pos++] = (uint8_t) receive_coding_format_company;
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_coding_format_company >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) receive_coding_format_codec;
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_coding_format_codec >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) transmit_coding_frame_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (transmit_coding_frame_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) receive_coding_frame_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (receive_coding_frame_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) input_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (input_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (input_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (input_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) output_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (output_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (output_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (output_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = input_coding_format_type;
+    hci_cmd_buffer[pos++] = (uint8_t) input_coding_format_company;
+    hci_cmd_buffer[pos++] = (uint8_t) (input_coding_format_company >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) input_coding_format_codec;
+    hci_cmd_buffer[pos++] = (uint8_t) (input_coding_format_codec >> 8);
+    hci_cmd_buffer[pos++] = output_coding_format_type;
+    hci_cmd_buffer[pos++] = (uint8_t) output_coding_format_company;
+    hci_cmd_buffer[pos++] = (uint8_t) (output_coding_format_company >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) output_coding_format_codec;
+    hci_cmd_buffer[pos++] = (uint8_t) (output_coding_format_codec >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) input_coded_data_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (input_coded_data_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) outupt_coded_data_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (outupt_coded_data_size >> 8);
+    hci_cmd_buffer[pos++] = input_pcm_data_format;
+    hci_cmd_buffer[pos++] = output_pcm_data_format;
+    hci_cmd_buffer[pos++] = input_pcm_sample_payload_msb_position;
+    hci_cmd_buffer[pos++] = output_pcm_sample_payload_msb_position;
+    hci_cmd_buffer[pos++] = input_data_path;
+    hci_cmd_buffer[pos++] = output_data_path;
+    hci_cmd_buffer[pos++] = input_transport_unit_size;
+    hci_cmd_buffer[pos++] = output_transport_unit_size;
+    hci_cmd_buffer[pos++] = (uint8_t) max_latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_latency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) packet_type;
+    hci_cmd_buffer[pos++] = (uint8_t) (packet_type >> 8);
+    hci_cmd_buffer[pos++] = retransmission_effort;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_ENHANCED_ACCEPT_SYNCHRONOUS_CONNECTION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_ENHANCED_ACCEPT_SYNCHRONOUS_CONNECTION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_remote_oob_extended_data_request_reply
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param c_192
+ * @param r_192
+ * @param c_256
+ * @param r_256
+ * @return size of HCI Command packet
+ * @note: format BKKKK
+ */
+static inline uint16_t hci_cmd_encode_remote_oob_extended_data_request_reply(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, const uint8_t * c_192, const uint8_t * r_192, const uint8_t * c_256, const uint8_t * r_256){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    reverse_bytes(c_192, &hci_cmd_buffer[pos], 16);
+    pos += 16;
+    reverse_bytes(r_192, &hci_cmd_buffer[pos], 16);
+    pos += 16;
+    reverse_bytes(c_256, &hci_cmd_buffer[pos], 16);
+    pos += 16;
+    reverse_bytes(r_256, &hci_cmd_buffer[pos], 16);
+    pos += 16;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_REMOTE_OOB_EXTENDED_DATA_REQUEST_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_REMOTE_OOB_EXTENDED_DATA_REQUEST_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_hold_mode
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param hold_mode_max_interval
+ * @param hold_mode_min_interval
+ * @return size of HCI Command packet
+ * @note: format H22
+ */
+static inline uint16_t hci_cmd_encode_hold_mode(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint16_t hold_mode_max_interval, uint16_t hold_mode_min_interval){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) hold_mode_max_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (hold_mode_max_interval >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) hold_mode_min_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (hold_mode_min_interval >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_HOLD_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_HOLD_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_sniff_mode
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param sniff_max_interval
+ * @param sniff_min_interval
+ * @param sniff_attempt
+ * @param sniff_timeout
+ * @return size of HCI Command packet
+ * @note: format H2222
+ */
+static inline uint16_t hci_cmd_encode_sniff_mode(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint16_t sniff_max_interval, uint16_t sniff_min_interval, uint16_t sniff_attempt, uint16_t sniff_timeout){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) sniff_max_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (sniff_max_interval >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) sniff_min_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (sniff_min_interval >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) sniff_attempt;
+    hci_cmd_buffer[pos++] = (uint8_t) (sniff_attempt >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) sniff_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (sniff_timeout >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_SNIFF_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_SNIFF_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_exit_sniff_mode
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_exit_sniff_mode(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_EXIT_SNIFF_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_EXIT_SNIFF_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_park_state
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @param param_2
+ * @return size of HCI Command packet
+ * @note: format H22
+ */
+static inline uint16_t hci_cmd_encode_park_state(uint8_t * hci_cmd_buffer, hci_con_handle_t param_0, uint16_t param_1, uint16_t param_2){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) param_0;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_0 >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) param_1;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_1 >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) param_2;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_2 >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_PARK_STATE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_PARK_STATE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_exit_park_state
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_exit_park_state(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_EXIT_PARK_STATE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_EXIT_PARK_STATE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_qos_setup
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param flags
+ * @param service_type
+ * @param token_rate
+ * @param peak_bandwith
+ * @param latency
+ * @param delay_variation
+ * @return size of HCI Command packet
+ * @note: format H114444
+ */
+static inline uint16_t hci_cmd_encode_qos_setup(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint8_t flags, uint8_t service_type, uint32_t token_rate, uint32_t peak_bandwith, uint32_t latency, uint32_t delay_variation){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = flags;
+    hci_cmd_buffer[pos++] = service_type;
+    hci_cmd_buffer[pos++] = (uint8_t) token_rate;
+    hci_cmd_buffer[pos++] = (uint8_t) (token_rate >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (token_rate >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (token_rate >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) peak_bandwith;
+    hci_cmd_buffer[pos++] = (uint8_t) (peak_bandwith >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (peak_bandwith >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (peak_bandwith >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (latency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (latency >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (latency >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) delay_variation;
+    hci_cmd_buffer[pos++] = (uint8_t) (delay_variation >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (delay_variation >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (delay_variation >> 24);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_QOS_SETUP;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_QOS_SETUP >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_role_discovery
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_role_discovery(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_ROLE_DISCOVERY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_ROLE_DISCOVERY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_switch_role_command
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param role
+ * @return size of HCI Command packet
+ * @note: format B1
+ */
+static inline uint16_t hci_cmd_encode_switch_role_command(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint8_t role){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = role;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_SWITCH_ROLE_COMMAND;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_SWITCH_ROLE_COMMAND >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_link_policy_settings
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_read_link_policy_settings(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_LINK_POLICY_SETTINGS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_LINK_POLICY_SETTINGS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_link_policy_settings
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param settings
+ * @return size of HCI Command packet
+ * @note: format H2
+ */
+static inline uint16_t hci_cmd_encode_write_link_policy_settings(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint16_t settings){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) settings;
+    hci_cmd_buffer[pos++] = (uint8_t) (settings >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_LINK_POLICY_SETTINGS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_LINK_POLICY_SETTINGS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_sniff_subrating
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param max_latency
+ * @param min_remote_timeout
+ * @param min_local_timeout
+ * @return size of HCI Command packet
+ * @note: format H222
+ */
+static inline uint16_t hci_cmd_encode_sniff_subrating(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint16_t max_latency, uint16_t min_remote_timeout, uint16_t min_local_timeout){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) max_latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_latency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) min_remote_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (min_remote_timeout >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) min_local_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (min_local_timeout >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_SNIFF_SUBRATING;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_SNIFF_SUBRATING >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_default_link_policy_setting
+ * @param hci_cmd_buffer
+ * @param policy
+ * @return size of HCI Command packet
+ * @note: format 2
+ */
+static inline uint16_t hci_cmd_encode_write_default_link_policy_setting(uint8_t * hci_cmd_buffer, uint16_t policy){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) policy;
+    hci_cmd_buffer[pos++] = (uint8_t) (policy >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_DEFAULT_LINK_POLICY_SETTING;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_DEFAULT_LINK_POLICY_SETTING >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_flow_specification
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param unused
+ * @param flow_direction
+ * @param service_type
+ * @param token_rate
+ * @param token_bucket_size
+ * @param peak_bandwidth
+ * @param access_latency
+ * @return size of HCI Command packet
+ * @note: format H1114444
+ */
+static inline uint16_t hci_cmd_encode_flow_specification(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint8_t unused, uint8_t flow_direction, uint8_t service_type, uint32_t token_rate, uint32_t token_bucket_size, uint32_t peak_bandwidth, uint32_t access_latency){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = unused;
+    hci_cmd_buffer[pos++] = flow_direction;
+    hci_cmd_buffer[pos++] = service_type;
+    hci_cmd_buffer[pos++] = (uint8_t) token_rate;
+    hci_cmd_buffer[pos++] = (uint8_t) (token_rate >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (token_rate >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (token_rate >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) token_bucket_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (token_bucket_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (token_bucket_size >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (token_bucket_size >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) peak_bandwidth;
+    hci_cmd_buffer[pos++] = (uint8_t) (peak_bandwidth >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (peak_bandwidth >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (peak_bandwidth >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) access_latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (access_latency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (access_latency >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (access_latency >> 24);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_FLOW_SPECIFICATION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_FLOW_SPECIFICATION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_set_event_mask
+ * @param hci_cmd_buffer
+ * @param event_mask_lower_octets
+ * @param event_mask_higher_octets
+ * @return size of HCI Command packet
+ * @note: format 44
+ */
+static inline uint16_t hci_cmd_encode_set_event_mask(uint8_t * hci_cmd_buffer, uint32_t event_mask_lower_octets, uint32_t event_mask_higher_octets){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) event_mask_lower_octets;
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_lower_octets >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_lower_octets >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_lower_octets >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) event_mask_higher_octets;
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_higher_octets >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_higher_octets >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_higher_octets >> 24);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_SET_EVENT_MASK;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_SET_EVENT_MASK >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_reset
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_reset(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_RESET;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_RESET >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_flush
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_flush(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_FLUSH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_FLUSH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_pin_type
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_pin_type(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_PIN_TYPE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_PIN_TYPE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_pin_type
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_pin_type(uint8_t * hci_cmd_buffer, uint8_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = handle;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_PIN_TYPE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_PIN_TYPE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_delete_stored_link_key
+ * @param hci_cmd_buffer
+ * @param bd_addr
+ * @param delete_all_flags
+ * @return size of HCI Command packet
+ * @note: format B1
+ */
+static inline uint16_t hci_cmd_encode_delete_stored_link_key(uint8_t * hci_cmd_buffer, const bd_addr_t bd_addr, uint8_t delete_all_flags){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[pos++] = delete_all_flags;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_DELETE_STORED_LINK_KEY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_DELETE_STORED_LINK_KEY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_local_name
+ * @param hci_cmd_buffer
+ * @param local_name
+ * @return size of HCI Command packet
+ * @note: format N
+ */
+static inline uint16_t hci_cmd_encode_write_local_name(uint8_t * hci_cmd_buffer, const char * local_name){
+    uint16_t pos = 3;
+    uint16_t local_name_len = (uint16_t) btstack_min((uint32_t) strlen(local_name), 248u);
+    (void) memcpy(&hci_cmd_buffer[pos], local_name, local_name_len);
+    memset(&hci_cmd_buffer[pos + local_name_len], 0, 248u - local_name_len);
+    pos += 248;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_LOCAL_NAME;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_LOCAL_NAME >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_local_name
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_local_name(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_LOCAL_NAME;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_LOCAL_NAME >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_page_timeout
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_page_timeout(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_PAGE_TIMEOUT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_PAGE_TIMEOUT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_page_timeout
+ * @param hci_cmd_buffer
+ * @param page_timeout
+ * @return size of HCI Command packet
+ * @note: format 2
+ */
+static inline uint16_t hci_cmd_encode_write_page_timeout(uint8_t * hci_cmd_buffer, uint16_t page_timeout){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) page_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (page_timeout >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_PAGE_TIMEOUT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_PAGE_TIMEOUT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_scan_enable
+ * @param hci_cmd_buffer
+ * @param scan_enable
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_scan_enable(uint8_t * hci_cmd_buffer, uint8_t scan_enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = scan_enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_SCAN_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_SCAN_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_page_scan_activity
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_page_scan_activity(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_PAGE_SCAN_ACTIVITY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_PAGE_SCAN_ACTIVITY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_page_scan_activity
+ * @param hci_cmd_buffer
+ * @param page_scan_interval
+ * @param page_scan_window
+ * @return size of HCI Command packet
+ * @note: format 22
+ */
+static inline uint16_t hci_cmd_encode_write_page_scan_activity(uint8_t * hci_cmd_buffer, uint16_t page_scan_interval, uint16_t page_scan_window){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) page_scan_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (page_scan_interval >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) page_scan_window;
+    hci_cmd_buffer[pos++] = (uint8_t) (page_scan_window >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_PAGE_SCAN_ACTIVITY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_PAGE_SCAN_ACTIVITY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_inquiry_scan_activity
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_inquiry_scan_activity(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_INQUIRY_SCAN_ACTIVITY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_INQUIRY_SCAN_ACTIVITY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_inquiry_scan_activity
+ * @param hci_cmd_buffer
+ * @param inquiry_scan_interval
+ * @param inquiry_scan_window
+ * @return size of HCI Command packet
+ * @note: format 22
+ */
+static inline uint16_t hci_cmd_encode_write_inquiry_scan_activity(uint8_t * hci_cmd_buffer, uint16_t inquiry_scan_interval, uint16_t inquiry_scan_window){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) inquiry_scan_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (inquiry_scan_interval >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) inquiry_scan_window;
+    hci_cmd_buffer[pos++] = (uint8_t) (inquiry_scan_window >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_INQUIRY_SCAN_ACTIVITY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_INQUIRY_SCAN_ACTIVITY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_authentication_enable
+ * @param hci_cmd_buffer
+ * @param authentication_enable
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_authentication_enable(uint8_t * hci_cmd_buffer, uint8_t authentication_enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = authentication_enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_AUTHENTICATION_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_AUTHENTICATION_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_automatic_flush_timeout
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param timeout
+ * @return size of HCI Command packet
+ * @note: format H2
+ */
+static inline uint16_t hci_cmd_encode_write_automatic_flush_timeout(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint16_t timeout){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (timeout >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_AUTOMATIC_FLUSH_TIMEOUT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_AUTOMATIC_FLUSH_TIMEOUT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_class_of_device
+ * @param hci_cmd_buffer
+ * @param class_of_device
+ * @return size of HCI Command packet
+ * @note: format 3
+ */
+static inline uint16_t hci_cmd_encode_write_class_of_device(uint8_t * hci_cmd_buffer, uint32_t class_of_device){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) class_of_device;
+    hci_cmd_buffer[pos++] = (uint8_t) (class_of_device >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (class_of_device >> 16);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_CLASS_OF_DEVICE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_CLASS_OF_DEVICE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_num_broadcast_retransmissions
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_num_broadcast_retransmissions(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_NUM_BROADCAST_RETRANSMISSIONS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_NUM_BROADCAST_RETRANSMISSIONS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_num_broadcast_retransmissions
+ * @param hci_cmd_buffer
+ * @param num_broadcast_retransmissions
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_num_broadcast_retransmissions(uint8_t * hci_cmd_buffer, uint8_t num_broadcast_retransmissions){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = num_broadcast_retransmissions;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_NUM_BROADCAST_RETRANSMISSIONS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_NUM_BROADCAST_RETRANSMISSIONS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_transmit_power_level
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param type
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_read_transmit_power_level(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = type;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_TRANSMIT_POWER_LEVEL;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_TRANSMIT_POWER_LEVEL >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_synchronous_flow_control_enable
+ * @param hci_cmd_buffer
+ * @param synchronous_flow_control_enable
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_synchronous_flow_control_enable(uint8_t * hci_cmd_buffer, uint8_t synchronous_flow_control_enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = synchronous_flow_control_enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_SYNCHRONOUS_FLOW_CONTROL_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_SYNCHRONOUS_FLOW_CONTROL_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_set_controller_to_host_flow_control
+ * @param hci_cmd_buffer
+ * @param flow_control_enable
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_set_controller_to_host_flow_control(uint8_t * hci_cmd_buffer, uint8_t flow_control_enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = flow_control_enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_SET_CONTROLLER_TO_HOST_FLOW_CONTROL;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_SET_CONTROLLER_TO_HOST_FLOW_CONTROL >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_host_buffer_size
+ * @param hci_cmd_buffer
+ * @param host_acl_data_packet_length
+ * @param host_synchronous_data_packet_length
+ * @param host_total_num_acl_data_packets
+ * @param host_total_num_synchronous_data_packets
+ * @return size of HCI Command packet
+ * @note: format 2122
+ */
+static inline uint16_t hci_cmd_encode_host_buffer_size(uint8_t * hci_cmd_buffer, uint16_t host_acl_data_packet_length, uint8_t host_synchronous_data_packet_length, uint16_t host_total_num_acl_data_packets, uint16_t host_total_num_synchronous_data_packets){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) host_acl_data_packet_length;
+    hci_cmd_buffer[pos++] = (uint8_t) (host_acl_data_packet_length >> 8);
+    hci_cmd_buffer[pos++] = host_synchronous_data_packet_length;
+    hci_cmd_buffer[pos++] = (uint8_t) host_total_num_acl_data_packets;
+    hci_cmd_buffer[pos++] = (uint8_t) (host_total_num_acl_data_packets >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) host_total_num_synchronous_data_packets;
+    hci_cmd_buffer[pos++] = (uint8_t) (host_total_num_synchronous_data_packets >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_HOST_BUFFER_SIZE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_HOST_BUFFER_SIZE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_link_supervision_timeout
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_read_link_supervision_timeout(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_LINK_SUPERVISION_TIMEOUT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_LINK_SUPERVISION_TIMEOUT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_link_supervision_timeout
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param timeout
+ * @return size of HCI Command packet
+ * @note: format H2
+ */
+static inline uint16_t hci_cmd_encode_write_link_supervision_timeout(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint16_t timeout){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (timeout >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_LINK_SUPERVISION_TIMEOUT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_LINK_SUPERVISION_TIMEOUT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_current_iac_lap_two_iacs
+ * @param hci_cmd_buffer
+ * @param num_current_iac
+ * @param iac_lap1
+ * @param iac_lap2
+ * @return size of HCI Command packet
+ * @note: format 133
+ */
+static inline uint16_t hci_cmd_encode_write_current_iac_lap_two_iacs(uint8_t * hci_cmd_buffer, uint8_t num_current_iac, uint32_t iac_lap1, uint32_t iac_lap2){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = num_current_iac;
+    hci_cmd_buffer[pos++] = (uint8_t) iac_lap1;
+    hci_cmd_buffer[pos++] = (uint8_t) (iac_lap1 >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (iac_lap1 >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) iac_lap2;
+    hci_cmd_buffer[pos++] = (uint8_t) (iac_lap2 >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (iac_lap2 >> 16);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_CURRENT_IAC_LAP_TWO_IACS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_CURRENT_IAC_LAP_TWO_IACS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_inquiry_scan_type
+ * @param hci_cmd_buffer
+ * @param inquiry_scan_type
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_inquiry_scan_type(uint8_t * hci_cmd_buffer, uint8_t inquiry_scan_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = inquiry_scan_type;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_INQUIRY_SCAN_TYPE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_INQUIRY_SCAN_TYPE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_inquiry_mode
+ * @param hci_cmd_buffer
+ * @param inquiry_mode
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_inquiry_mode(uint8_t * hci_cmd_buffer, uint8_t inquiry_mode){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = inquiry_mode;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_INQUIRY_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_INQUIRY_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_page_scan_type
+ * @param hci_cmd_buffer
+ * @param page_scan_type
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_page_scan_type(uint8_t * hci_cmd_buffer, uint8_t page_scan_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = page_scan_type;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_PAGE_SCAN_TYPE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_PAGE_SCAN_TYPE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_extended_inquiry_response
+ * @param hci_cmd_buffer
+ * @param fec_required
+ * @param exstended_inquiry_response
+ * @return size of HCI Command packet
+ * @note: format 1E
+ */
+static inline uint16_t hci_cmd_encode_write_extended_inquiry_response(uint8_t * hci_cmd_buffer, uint8_t fec_required, const uint8_t * exstended_inquiry_response){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = fec_required;
+    (void) memcpy(&hci_cmd_buffer[pos], exstended_inquiry_response, 240);
+    pos += 240;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_EXTENDED_INQUIRY_RESPONSE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_EXTENDED_INQUIRY_RESPONSE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_simple_pairing_mode
+ * @param hci_cmd_buffer
+ * @param mode
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_simple_pairing_mode(uint8_t * hci_cmd_buffer, uint8_t mode){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = mode;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_SIMPLE_PAIRING_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_SIMPLE_PAIRING_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_local_oob_data
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_local_oob_data(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_LOCAL_OOB_DATA;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_LOCAL_OOB_DATA >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_default_erroneous_data_reporting
+ * @param hci_cmd_buffer
+ * @param mode
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_default_erroneous_data_reporting(uint8_t * hci_cmd_buffer, uint8_t mode){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = mode;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_DEFAULT_ERRONEOUS_DATA_REPORTING;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_DEFAULT_ERRONEOUS_DATA_REPORTING >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_set_event_mask_2
+ * @param hci_cmd_buffer
+ * @param event_mask_page_2_lower_octets
+ * @param event_mask_page_2_higher_octets
+ * @return size of HCI Command packet
+ * @note: format 44
+ */
+static inline uint16_t hci_cmd_encode_set_event_mask_2(uint8_t * hci_cmd_buffer, uint32_t event_mask_page_2_lower_octets, uint32_t event_mask_page_2_higher_octets){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) event_mask_page_2_lower_octets;
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_page_2_lower_octets >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_page_2_lower_octets >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_page_2_lower_octets >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) event_mask_page_2_higher_octets;
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_page_2_higher_octets >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_page_2_higher_octets >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_page_2_higher_octets >> 24);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_SET_EVENT_MASK_2;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_SET_EVENT_MASK_2 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_le_host_supported
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_le_host_supported(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_LE_HOST_SUPPORTED;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_LE_HOST_SUPPORTED >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_le_host_supported
+ * @param hci_cmd_buffer
+ * @param le_supported_host
+ * @param simultaneous_le_host
+ * @return size of HCI Command packet
+ * @note: format 11
+ */
+static inline uint16_t hci_cmd_encode_write_le_host_supported(uint8_t * hci_cmd_buffer, uint8_t le_supported_host, uint8_t simultaneous_le_host){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = le_supported_host;
+    hci_cmd_buffer[pos++] = simultaneous_le_host;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_LE_HOST_SUPPORTED;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_LE_HOST_SUPPORTED >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_secure_connections_host_support
+ * @param hci_cmd_buffer
+ * @param secure_connections_host_support
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_secure_connections_host_support(uint8_t * hci_cmd_buffer, uint8_t secure_connections_host_support){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = secure_connections_host_support;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_SECURE_CONNECTIONS_HOST_SUPPORT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_SECURE_CONNECTIONS_HOST_SUPPORT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_local_extended_oob_data
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_local_extended_oob_data(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_LOCAL_EXTENDED_OOB_DATA;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_LOCAL_EXTENDED_OOB_DATA >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_extended_page_timeout
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_extended_page_timeout(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_EXTENDED_PAGE_TIMEOUT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_EXTENDED_PAGE_TIMEOUT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_extended_page_timeout
+ * @param hci_cmd_buffer
+ * @param extended_page_timeout
+ * @return size of HCI Command packet
+ * @note: format 2
+ */
+static inline uint16_t hci_cmd_encode_write_extended_page_timeout(uint8_t * hci_cmd_buffer, uint16_t extended_page_timeout){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) extended_page_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (extended_page_timeout >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_EXTENDED_PAGE_TIMEOUT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_EXTENDED_PAGE_TIMEOUT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_extended_inquiry_length
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_extended_inquiry_length(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_EXTENDED_INQUIRY_LENGTH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_EXTENDED_INQUIRY_LENGTH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_extended_inquiry_length
+ * @param hci_cmd_buffer
+ * @param extended_inquiry_length
+ * @return size of HCI Command packet
+ * @note: format 2
+ */
+static inline uint16_t hci_cmd_encode_write_extended_inquiry_length(uint8_t * hci_cmd_buffer, uint16_t extended_inquiry_length){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) extended_inquiry_length;
+    hci_cmd_buffer[pos++] = (uint8_t) (extended_inquiry_length >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_EXTENDED_INQUIRY_LENGTH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_EXTENDED_INQUIRY_LENGTH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_set_ecosystem_base_interval
+ * @param hci_cmd_buffer
+ * @param interval
+ * @return size of HCI Command packet
+ * @note: format 2
+ */
+static inline uint16_t hci_cmd_encode_set_ecosystem_base_interval(uint8_t * hci_cmd_buffer, uint16_t interval){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (interval >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_SET_ECOSYSTEM_BASE_INTERVAL;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_SET_ECOSYSTEM_BASE_INTERVAL >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_configure_data_path
+ * @param hci_cmd_buffer
+ * @param data_path_direction
+ * @param data_path_id
+ * @param vendor_specific_config_length
+ * @param vendor_specific_config
+ * @return size of HCI Command packet
+ * @note: format 11JV
+ */
+static inline uint16_t hci_cmd_encode_configure_data_path(uint8_t * hci_cmd_buffer, uint8_t data_path_direction, uint8_t data_path_id, uint8_t vendor_specific_config_length, const uint8_t * vendor_specific_config){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = data_path_direction;
+    hci_cmd_buffer[pos++] = data_path_id;
+    hci_cmd_buffer[pos++] = vendor_specific_config_length;
+    (void) memcpy(&hci_cmd_buffer[pos], vendor_specific_config, vendor_specific_config_length);
+    pos += vendor_specific_config_length;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_CONFIGURE_DATA_PATH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_CONFIGURE_DATA_PATH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_set_min_encryption_key_size
+ * @param hci_cmd_buffer
+ * @param min_encryption_key_size
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_set_min_encryption_key_size(uint8_t * hci_cmd_buffer, uint8_t min_encryption_key_size){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = min_encryption_key_size;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_SET_MIN_ENCRYPTION_KEY_SIZE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_SET_MIN_ENCRYPTION_KEY_SIZE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_loopback_mode
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_loopback_mode(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_LOOPBACK_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_LOOPBACK_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_loopback_mode
+ * @param hci_cmd_buffer
+ * @param loopback_mode
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_loopback_mode(uint8_t * hci_cmd_buffer, uint8_t loopback_mode){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = loopback_mode;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_LOOPBACK_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_LOOPBACK_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_enable_device_under_test_mode
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_enable_device_under_test_mode(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_ENABLE_DEVICE_UNDER_TEST_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_ENABLE_DEVICE_UNDER_TEST_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_simple_pairing_debug_mode
+ * @param hci_cmd_buffer
+ * @param simple_pairing_debug_mode
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_write_simple_pairing_debug_mode(uint8_t * hci_cmd_buffer, uint8_t simple_pairing_debug_mode){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = simple_pairing_debug_mode;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_SIMPLE_PAIRING_DEBUG_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_SIMPLE_PAIRING_DEBUG_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_write_secure_connections_test_mode
+ * @param hci_cmd_buffer
+ * @param handle
+ * @param dm1_acl_u_mode
+ * @param esco_loopback_mode
+ * @return size of HCI Command packet
+ * @note: format H11
+ */
+static inline uint16_t hci_cmd_encode_write_secure_connections_test_mode(uint8_t * hci_cmd_buffer, hci_con_handle_t handle, uint8_t dm1_acl_u_mode, uint8_t esco_loopback_mode){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[pos++] = dm1_acl_u_mode;
+    hci_cmd_buffer[pos++] = esco_loopback_mode;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_WRITE_SECURE_CONNECTIONS_TEST_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_WRITE_SECURE_CONNECTIONS_TEST_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_local_version_information
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_local_version_information(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_LOCAL_VERSION_INFORMATION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_LOCAL_VERSION_INFORMATION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_local_supported_commands
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_local_supported_commands(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_LOCAL_SUPPORTED_COMMANDS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_LOCAL_SUPPORTED_COMMANDS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_local_supported_features
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_local_supported_features(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_LOCAL_SUPPORTED_FEATURES;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_LOCAL_SUPPORTED_FEATURES >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_buffer_size
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_buffer_size(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_BUFFER_SIZE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_BUFFER_SIZE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_bd_addr
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_read_bd_addr(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_BD_ADDR;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_BD_ADDR >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_rssi
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_read_rssi(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_RSSI;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_RSSI >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_read_encryption_key_size
+ * @param hci_cmd_buffer
+ * @param handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_read_encryption_key_size(uint8_t * hci_cmd_buffer, hci_con_handle_t handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_READ_ENCRYPTION_KEY_SIZE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_READ_ENCRYPTION_KEY_SIZE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_event_mask
+ * @param hci_cmd_buffer
+ * @param event_mask_lower_octets
+ * @param event_mask_higher_octets
+ * @return size of HCI Command packet
+ * @note: format 44
+ */
+static inline uint16_t hci_cmd_encode_le_set_event_mask(uint8_t * hci_cmd_buffer, uint32_t event_mask_lower_octets, uint32_t event_mask_higher_octets){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) event_mask_lower_octets;
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_lower_octets >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_lower_octets >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_lower_octets >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) event_mask_higher_octets;
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_higher_octets >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_higher_octets >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (event_mask_higher_octets >> 24);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_EVENT_MASK;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_EVENT_MASK >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_buffer_size
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_buffer_size(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_BUFFER_SIZE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_BUFFER_SIZE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_local_supported_features
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_local_supported_features(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_LOCAL_SUPPORTED_FEATURES;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_LOCAL_SUPPORTED_FEATURES >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_random_address
+ * @param hci_cmd_buffer
+ * @param random_bd_addr
+ * @return size of HCI Command packet
+ * @note: format B
+ */
+static inline uint16_t hci_cmd_encode_le_set_random_address(uint8_t * hci_cmd_buffer, const bd_addr_t random_bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = random_bd_addr[5];
+    hci_cmd_buffer[pos++] = random_bd_addr[4];
+    hci_cmd_buffer[pos++] = random_bd_addr[3];
+    hci_cmd_buffer[pos++] = random_bd_addr[2];
+    hci_cmd_buffer[pos++] = random_bd_addr[1];
+    hci_cmd_buffer[pos++] = random_bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_RANDOM_ADDRESS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_RANDOM_ADDRESS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_advertising_parameters
+ * @param hci_cmd_buffer
+ * @param advertising_interval_min
+ * @param advertising_interval_max
+ * @param advertising_type
+ * @param own_address_type
+ * @param direct_address_type
+ * @param direct_address
+ * @param advertising_channel_map
+ * @param advertising_filter_policy
+ * @return size of HCI Command packet
+ * @note: format 22111B11
+ */
+static inline uint16_t hci_cmd_encode_le_set_advertising_parameters(uint8_t * hci_cmd_buffer, uint16_t advertising_interval_min, uint16_t advertising_interval_max, uint8_t advertising_type, uint8_t own_address_type, uint8_t direct_address_type, const bd_addr_t direct_address, uint8_t advertising_channel_map, uint8_t advertising_filter_policy){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) advertising_interval_min;
+    hci_cmd_buffer[pos++] = (uint8_t) (advertising_interval_min >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) advertising_interval_max;
+    hci_cmd_buffer[pos++] = (uint8_t) (advertising_interval_max >> 8);
+    hci_cmd_buffer[pos++] = advertising_type;
+    hci_cmd_buffer[pos++] = own_address_type;
+    hci_cmd_buffer[pos++] = direct_address_type;
+    hci_cmd_buffer[pos++] = direct_address[5];
+    hci_cmd_buffer[pos++] = direct_address[4];
+    hci_cmd_buffer[pos++] = direct_address[3];
+    hci_cmd_buffer[pos++] = direct_address[2];
+    hci_cmd_buffer[pos++] = direct_address[1];
+    hci_cmd_buffer[pos++] = direct_address[0];
+    hci_cmd_buffer[pos++] = advertising_channel_map;
+    hci_cmd_buffer[pos++] = advertising_filter_policy;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_ADVERTISING_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_ADVERTISING_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_advertising_channel_tx_power
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_advertising_channel_tx_power(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_ADVERTISING_CHANNEL_TX_POWER;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_ADVERTISING_CHANNEL_TX_POWER >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_advertising_data
+ * @param hci_cmd_buffer
+ * @param advertising_data_length
+ * @param advertising_data
+ * @return size of HCI Command packet
+ * @note: format 1A
+ */
+static inline uint16_t hci_cmd_encode_le_set_advertising_data(uint8_t * hci_cmd_buffer, uint8_t advertising_data_length, const uint8_t * advertising_data){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertising_data_length;
+    (void) memcpy(&hci_cmd_buffer[pos], advertising_data, 31);
+    pos += 31;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_ADVERTISING_DATA;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_ADVERTISING_DATA >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_scan_response_data
+ * @param hci_cmd_buffer
+ * @param scan_response_data_length
+ * @param scan_response_data
+ * @return size of HCI Command packet
+ * @note: format 1A
+ */
+static inline uint16_t hci_cmd_encode_le_set_scan_response_data(uint8_t * hci_cmd_buffer, uint8_t scan_response_data_length, const uint8_t * scan_response_data){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = scan_response_data_length;
+    (void) memcpy(&hci_cmd_buffer[pos], scan_response_data, 31);
+    pos += 31;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_SCAN_RESPONSE_DATA;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_SCAN_RESPONSE_DATA >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_advertise_enable
+ * @param hci_cmd_buffer
+ * @param advertise_enable
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_le_set_advertise_enable(uint8_t * hci_cmd_buffer, uint8_t advertise_enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertise_enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_ADVERTISE_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_ADVERTISE_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_scan_parameters
+ * @param hci_cmd_buffer
+ * @param le_scan_type
+ * @param le_scan_interval
+ * @param le_scan_window
+ * @param own_address_type
+ * @param scanning_filter_policy
+ * @return size of HCI Command packet
+ * @note: format 12211
+ */
+static inline uint16_t hci_cmd_encode_le_set_scan_parameters(uint8_t * hci_cmd_buffer, uint8_t le_scan_type, uint16_t le_scan_interval, uint16_t le_scan_window, uint8_t own_address_type, uint8_t scanning_filter_policy){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = le_scan_type;
+    hci_cmd_buffer[pos++] = (uint8_t) le_scan_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (le_scan_interval >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) le_scan_window;
+    hci_cmd_buffer[pos++] = (uint8_t) (le_scan_window >> 8);
+    hci_cmd_buffer[pos++] = own_address_type;
+    hci_cmd_buffer[pos++] = scanning_filter_policy;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_SCAN_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_SCAN_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_scan_enable
+ * @param hci_cmd_buffer
+ * @param le_scan_enable
+ * @param filter_duplices
+ * @return size of HCI Command packet
+ * @note: format 11
+ */
+static inline uint16_t hci_cmd_encode_le_set_scan_enable(uint8_t * hci_cmd_buffer, uint8_t le_scan_enable, uint8_t filter_duplices){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = le_scan_enable;
+    hci_cmd_buffer[pos++] = filter_duplices;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_SCAN_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_SCAN_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_create_connection
+ * @param hci_cmd_buffer
+ * @param le_scan_interval
+ * @param le_scan_window
+ * @param initiator_filter_policy
+ * @param peer_address_type
+ * @param peer_address
+ * @param own_address_type
+ * @param conn_interval_min
+ * @param conn_interval_max
+ * @param conn_latency
+ * @param supervision_timeout
+ * @param minimum_ce_length
+ * @param maximum_ce_length
+ * @return size of HCI Command packet
+ * @note: format 2211B1222222
+ */
+static inline uint16_t hci_cmd_encode_le_create_connection(uint8_t * hci_cmd_buffer, uint16_t le_scan_interval, uint16_t le_scan_window, uint8_t initiator_filter_policy, uint8_t peer_address_type, const bd_addr_t peer_address, uint8_t own_address_type, uint16_t conn_interval_min, uint16_t conn_interval_max, uint16_t conn_latency, uint16_t supervision_timeout, uint16_t minimum_ce_length, uint16_t maximum_ce_length){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) le_scan_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (le_scan_interval >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) le_scan_window;
+    hci_cmd_buffer[pos++] = (uint8_t) (le_scan_window >> 8);
+    hci_cmd_buffer[pos++] = initiator_filter_policy;
+    hci_cmd_buffer[pos++] = peer_address_type;
+    hci_cmd_buffer[pos++] = peer_address[5];
+    hci_cmd_buffer[pos++] = peer_address[4];
+    hci_cmd_buffer[pos++] = peer_address[3];
+    hci_cmd_buffer[pos++] = peer_address[2];
+    hci_cmd_buffer[pos++] = peer_address[1];
+    hci_cmd_buffer[pos++] = peer_address[0];
+    hci_cmd_buffer[pos++] = own_address_type;
+    hci_cmd_buffer[pos++] = (uint8_t) conn_interval_min;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_interval_min >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) conn_interval_max;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_interval_max >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) conn_latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_latency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) supervision_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (supervision_timeout >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) minimum_ce_length;
+    hci_cmd_buffer[pos++] = (uint8_t) (minimum_ce_length >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) maximum_ce_length;
+    hci_cmd_buffer[pos++] = (uint8_t) (maximum_ce_length >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CREATE_CONNECTION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CREATE_CONNECTION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_create_connection_cancel
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_create_connection_cancel(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CREATE_CONNECTION_CANCEL;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CREATE_CONNECTION_CANCEL >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_white_list_size
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_white_list_size(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_WHITE_LIST_SIZE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_WHITE_LIST_SIZE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_clear_white_list
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_clear_white_list(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CLEAR_WHITE_LIST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CLEAR_WHITE_LIST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_add_device_to_white_list
+ * @param hci_cmd_buffer
+ * @param address_type
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format 1B
+ */
+static inline uint16_t hci_cmd_encode_le_add_device_to_white_list(uint8_t * hci_cmd_buffer, uint8_t address_type, const bd_addr_t bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = address_type;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_ADD_DEVICE_TO_WHITE_LIST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_ADD_DEVICE_TO_WHITE_LIST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_remove_device_from_white_list
+ * @param hci_cmd_buffer
+ * @param address_type
+ * @param bd_addr
+ * @return size of HCI Command packet
+ * @note: format 1B
+ */
+static inline uint16_t hci_cmd_encode_le_remove_device_from_white_list(uint8_t * hci_cmd_buffer, uint8_t address_type, const bd_addr_t bd_addr){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = address_type;
+    hci_cmd_buffer[pos++] = bd_addr[5];
+    hci_cmd_buffer[pos++] = bd_addr[4];
+    hci_cmd_buffer[pos++] = bd_addr[3];
+    hci_cmd_buffer[pos++] = bd_addr[2];
+    hci_cmd_buffer[pos++] = bd_addr[1];
+    hci_cmd_buffer[pos++] = bd_addr[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_REMOVE_DEVICE_FROM_WHITE_LIST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_REMOVE_DEVICE_FROM_WHITE_LIST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_connection_update
+ * @param hci_cmd_buffer
+ * @param conn_handle
+ * @param conn_interval_min
+ * @param conn_interval_max
+ * @param conn_latency
+ * @param supervision_timeout
+ * @param minimum_ce_length
+ * @param maximum_ce_length
+ * @return size of HCI Command packet
+ * @note: format H222222
+ */
+static inline uint16_t hci_cmd_encode_le_connection_update(uint8_t * hci_cmd_buffer, hci_con_handle_t conn_handle, uint16_t conn_interval_min, uint16_t conn_interval_max, uint16_t conn_latency, uint16_t supervision_timeout, uint16_t minimum_ce_length, uint16_t maximum_ce_length){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) conn_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) conn_interval_min;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_interval_min >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) conn_interval_max;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_interval_max >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) conn_latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_latency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) supervision_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (supervision_timeout >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) minimum_ce_length;
+    hci_cmd_buffer[pos++] = (uint8_t) (minimum_ce_length >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) maximum_ce_length;
+    hci_cmd_buffer[pos++] = (uint8_t) (maximum_ce_length >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CONNECTION_UPDATE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CONNECTION_UPDATE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_host_channel_classification
+ * @param hci_cmd_buffer
+ * @param channel_map_lower_32bits
+ * @param channel_map_higher_5bits
+ * @return size of HCI Command packet
+ * @note: format 41
+ */
+static inline uint16_t hci_cmd_encode_le_set_host_channel_classification(uint8_t * hci_cmd_buffer, uint32_t channel_map_lower_32bits, uint8_t channel_map_higher_5bits){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) channel_map_lower_32bits;
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_map_lower_32bits >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_map_lower_32bits >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_map_lower_32bits >> 24);
+    hci_cmd_buffer[pos++] = channel_map_higher_5bits;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_HOST_CHANNEL_CLASSIFICATION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_HOST_CHANNEL_CLASSIFICATION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_channel_map
+ * @param hci_cmd_buffer
+ * @param conn_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_read_channel_map(uint8_t * hci_cmd_buffer, hci_con_handle_t conn_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) conn_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_CHANNEL_MAP;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_CHANNEL_MAP >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_remote_used_features
+ * @param hci_cmd_buffer
+ * @param conn_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_read_remote_used_features(uint8_t * hci_cmd_buffer, hci_con_handle_t conn_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) conn_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_REMOTE_USED_FEATURES;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_REMOTE_USED_FEATURES >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_encrypt
+ * @param hci_cmd_buffer
+ * @param key
+ * @param plain_text
+ * @return size of HCI Command packet
+ * @note: format PP
+ */
+static inline uint16_t hci_cmd_encode_le_encrypt(uint8_t * hci_cmd_buffer, const uint8_t * key, const uint8_t * plain_text){
+    uint16_t pos = 3;
+    (void) memcpy(&hci_cmd_buffer[pos], key, 16);
+    pos += 16;
+    (void) memcpy(&hci_cmd_buffer[pos], plain_text, 16);
+    pos += 16;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_ENCRYPT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_ENCRYPT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_rand
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_rand(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_RAND;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_RAND >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_start_encryption
+ * @param hci_cmd_buffer
+ * @param conn_handle
+ * @param random_number_lower_32bits
+ * @param random_number_higher_32bits
+ * @param encryption_diversifier
+ * @param long_term_key
+ * @return size of HCI Command packet
+ * @note: format H442P
+ */
+static inline uint16_t hci_cmd_encode_le_start_encryption(uint8_t * hci_cmd_buffer, hci_con_handle_t conn_handle, uint32_t random_number_lower_32bits, uint32_t random_number_higher_32bits, uint16_t encryption_diversifier, const uint8_t * long_term_key){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) conn_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) random_number_lower_32bits;
+    hci_cmd_buffer[pos++] = (uint8_t) (random_number_lower_32bits >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (random_number_lower_32bits >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (random_number_lower_32bits >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) random_number_higher_32bits;
+    hci_cmd_buffer[pos++] = (uint8_t) (random_number_higher_32bits >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (random_number_higher_32bits >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (random_number_higher_32bits >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) encryption_diversifier;
+    hci_cmd_buffer[pos++] = (uint8_t) (encryption_diversifier >> 8);
+    (void) memcpy(&hci_cmd_buffer[pos], long_term_key, 16);
+    pos += 16;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_START_ENCRYPTION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_START_ENCRYPTION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_long_term_key_request_reply
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param long_term_key
+ * @return size of HCI Command packet
+ * @note: format HP
+ */
+static inline uint16_t hci_cmd_encode_le_long_term_key_request_reply(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, const uint8_t * long_term_key){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    (void) memcpy(&hci_cmd_buffer[pos], long_term_key, 16);
+    pos += 16;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_LONG_TERM_KEY_REQUEST_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_LONG_TERM_KEY_REQUEST_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_long_term_key_negative_reply
+ * @param hci_cmd_buffer
+ * @param conn_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_long_term_key_negative_reply(uint8_t * hci_cmd_buffer, hci_con_handle_t conn_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) conn_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_LONG_TERM_KEY_NEGATIVE_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_LONG_TERM_KEY_NEGATIVE_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_supported_states
+ * @param hci_cmd_buffer
+ * @param conn_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_read_supported_states(uint8_t * hci_cmd_buffer, hci_con_handle_t conn_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) conn_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_SUPPORTED_STATES;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_SUPPORTED_STATES >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_receiver_test
+ * @param hci_cmd_buffer
+ * @param rx_frequency
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_le_receiver_test(uint8_t * hci_cmd_buffer, uint8_t rx_frequency){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = rx_frequency;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_RECEIVER_TEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_RECEIVER_TEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_transmitter_test
+ * @param hci_cmd_buffer
+ * @param tx_frequency
+ * @param test_payload_lengh
+ * @param packet_payload
+ * @return size of HCI Command packet
+ * @note: format 111
+ */
+static inline uint16_t hci_cmd_encode_le_transmitter_test(uint8_t * hci_cmd_buffer, uint8_t tx_frequency, uint8_t test_payload_lengh, uint8_t packet_payload){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = tx_frequency;
+    hci_cmd_buffer[pos++] = test_payload_lengh;
+    hci_cmd_buffer[pos++] = packet_payload;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_TRANSMITTER_TEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_TRANSMITTER_TEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_test_end
+ * @param hci_cmd_buffer
+ * @param end_test_cmd
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_le_test_end(uint8_t * hci_cmd_buffer, uint8_t end_test_cmd){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = end_test_cmd;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_TEST_END;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_TEST_END >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_remote_connection_parameter_request_reply
+ * @param hci_cmd_buffer
+ * @param conn_handle
+ * @param conn_interval_min
+ * @param conn_interval_max
+ * @param conn_latency
+ * @param supervision_timeout
+ * @param minimum_ce_length
+ * @param maximum_ce_length
+ * @return size of HCI Command packet
+ * @note: format H222222
+ */
+static inline uint16_t hci_cmd_encode_le_remote_connection_parameter_request_reply(uint8_t * hci_cmd_buffer, hci_con_handle_t conn_handle, uint16_t conn_interval_min, uint16_t conn_interval_max, uint16_t conn_latency, uint16_t supervision_timeout, uint16_t minimum_ce_length, uint16_t maximum_ce_length){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) conn_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) conn_interval_min;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_interval_min >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) conn_interval_max;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_interval_max >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) conn_latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (conn_latency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) supervision_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (supervision_timeout >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) minimum_ce_length;
+    hci_cmd_buffer[pos++] = (uint8_t) (minimum_ce_length >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) maximum_ce_length;
+    hci_cmd_buffer[pos++] = (uint8_t) (maximum_ce_length >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_REMOTE_CONNECTION_PARAMETER_REQUEST_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_REMOTE_CONNECTION_PARAMETER_REQUEST_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_remote_connection_parameter_request_negative_reply
+ * @param hci_cmd_buffer
+ * @param con_handle
+ * @param reason
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_le_remote_connection_parameter_request_negative_reply(uint8_t * hci_cmd_buffer, hci_con_handle_t con_handle, uint8_t reason){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) con_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (con_handle >> 8);
+    hci_cmd_buffer[pos++] = reason;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_REMOTE_CONNECTION_PARAMETER_REQUEST_NEGATIVE_REPLY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_REMOTE_CONNECTION_PARAMETER_REQUEST_NEGATIVE_REPLY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_data_length
+ * @param hci_cmd_buffer
+ * @param con_handle
+ * @param tx_octets
+ * @param tx_time
+ * @return size of HCI Command packet
+ * @note: format H22
+ */
+static inline uint16_t hci_cmd_encode_le_set_data_length(uint8_t * hci_cmd_buffer, hci_con_handle_t con_handle, uint16_t tx_octets, uint16_t tx_time){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) con_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (con_handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) tx_octets;
+    hci_cmd_buffer[pos++] = (uint8_t) (tx_octets >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) tx_time;
+    hci_cmd_buffer[pos++] = (uint8_t) (tx_time >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_DATA_LENGTH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_DATA_LENGTH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_suggested_default_data_length
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_suggested_default_data_length(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_SUGGESTED_DEFAULT_DATA_LENGTH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_SUGGESTED_DEFAULT_DATA_LENGTH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_write_suggested_default_data_length
+ * @param hci_cmd_buffer
+ * @param suggested_max_tx_octets
+ * @param suggested_max_tx_time
+ * @return size of HCI Command packet
+ * @note: format 22
+ */
+static inline uint16_t hci_cmd_encode_le_write_suggested_default_data_length(uint8_t * hci_cmd_buffer, uint16_t suggested_max_tx_octets, uint16_t suggested_max_tx_time){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) suggested_max_tx_octets;
+    hci_cmd_buffer[pos++] = (uint8_t) (suggested_max_tx_octets >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) suggested_max_tx_time;
+    hci_cmd_buffer[pos++] = (uint8_t) (suggested_max_tx_time >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_WRITE_SUGGESTED_DEFAULT_DATA_LENGTH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_WRITE_SUGGESTED_DEFAULT_DATA_LENGTH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_local_p256_public_key
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_local_p256_public_key(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_LOCAL_P256_PUBLIC_KEY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_LOCAL_P256_PUBLIC_KEY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_generate_dhkey
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @return size of HCI Command packet
+ * @note: format QQ
+ */
+static inline uint16_t hci_cmd_encode_le_generate_dhkey(uint8_t * hci_cmd_buffer, const uint8_t * param_0, const uint8_t * param_1){
+    uint16_t pos = 3;
+    reverse_bytes(param_0, &hci_cmd_buffer[pos], 32);
+    pos += 32;
+    reverse_bytes(param_1, &hci_cmd_buffer[pos], 32);
+    pos += 32;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_GENERATE_DHKEY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_GENERATE_DHKEY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_add_device_to_resolving_list
+ * @param hci_cmd_buffer
+ * @param peer_identity_address_type
+ * @param peer_identity_address
+ * @param peer_irk
+ * @param local_irk
+ * @return size of HCI Command packet
+ * @note: format 1BPP
+ */
+static inline uint16_t hci_cmd_encode_le_add_device_to_resolving_list(uint8_t * hci_cmd_buffer, uint8_t peer_identity_address_type, const bd_addr_t peer_identity_address, const uint8_t * peer_irk, const uint8_t * local_irk){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = peer_identity_address_type;
+    hci_cmd_buffer[pos++] = peer_identity_address[5];
+    hci_cmd_buffer[pos++] = peer_identity_address[4];
+    hci_cmd_buffer[pos++] = peer_identity_address[3];
+    hci_cmd_buffer[pos++] = peer_identity_address[2];
+    hci_cmd_buffer[pos++] = peer_identity_address[1];
+    hci_cmd_buffer[pos++] = peer_identity_address[0];
+    (void) memcpy(&hci_cmd_buffer[pos], peer_irk, 16);
+    pos += 16;
+    (void) memcpy(&hci_cmd_buffer[pos], local_irk, 16);
+    pos += 16;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_ADD_DEVICE_TO_RESOLVING_LIST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_ADD_DEVICE_TO_RESOLVING_LIST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_remove_device_from_resolving_list
+ * @param hci_cmd_buffer
+ * @param peer_identity_address_type
+ * @param peer_identity_address
+ * @return size of HCI Command packet
+ * @note: format 1B
+ */
+static inline uint16_t hci_cmd_encode_le_remove_device_from_resolving_list(uint8_t * hci_cmd_buffer, uint8_t peer_identity_address_type, const bd_addr_t peer_identity_address){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = peer_identity_address_type;
+    hci_cmd_buffer[pos++] = peer_identity_address[5];
+    hci_cmd_buffer[pos++] = peer_identity_address[4];
+    hci_cmd_buffer[pos++] = peer_identity_address[3];
+    hci_cmd_buffer[pos++] = peer_identity_address[2];
+    hci_cmd_buffer[pos++] = peer_identity_address[1];
+    hci_cmd_buffer[pos++] = peer_identity_address[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_REMOVE_DEVICE_FROM_RESOLVING_LIST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_REMOVE_DEVICE_FROM_RESOLVING_LIST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_clear_resolving_list
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_clear_resolving_list(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CLEAR_RESOLVING_LIST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CLEAR_RESOLVING_LIST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_resolving_list_size
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_resolving_list_size(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_RESOLVING_LIST_SIZE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_RESOLVING_LIST_SIZE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_peer_resolvable_address
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_peer_resolvable_address(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_PEER_RESOLVABLE_ADDRESS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_PEER_RESOLVABLE_ADDRESS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_local_resolvable_address
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_local_resolvable_address(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_LOCAL_RESOLVABLE_ADDRESS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_LOCAL_RESOLVABLE_ADDRESS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_address_resolution_enabled
+ * @param hci_cmd_buffer
+ * @param address_resolution_enable
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_le_set_address_resolution_enabled(uint8_t * hci_cmd_buffer, uint8_t address_resolution_enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = address_resolution_enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_ADDRESS_RESOLUTION_ENABLED;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_ADDRESS_RESOLUTION_ENABLED >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_resolvable_private_address_timeout
+ * @param hci_cmd_buffer
+ * @param rpa_timeout
+ * @return size of HCI Command packet
+ * @note: format 2
+ */
+static inline uint16_t hci_cmd_encode_le_set_resolvable_private_address_timeout(uint8_t * hci_cmd_buffer, uint16_t rpa_timeout){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) rpa_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (rpa_timeout >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_RESOLVABLE_PRIVATE_ADDRESS_TIMEOUT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_RESOLVABLE_PRIVATE_ADDRESS_TIMEOUT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_maximum_data_length
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_maximum_data_length(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_MAXIMUM_DATA_LENGTH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_MAXIMUM_DATA_LENGTH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_phy
+ * @param hci_cmd_buffer
+ * @param con_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_read_phy(uint8_t * hci_cmd_buffer, hci_con_handle_t con_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) con_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (con_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_PHY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_PHY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_default_phy
+ * @param hci_cmd_buffer
+ * @param all_phys
+ * @param tx_phys
+ * @param rx_phys
+ * @return size of HCI Command packet
+ * @note: format 111
+ */
+static inline uint16_t hci_cmd_encode_le_set_default_phy(uint8_t * hci_cmd_buffer, uint8_t all_phys, uint8_t tx_phys, uint8_t rx_phys){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = all_phys;
+    hci_cmd_buffer[pos++] = tx_phys;
+    hci_cmd_buffer[pos++] = rx_phys;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_DEFAULT_PHY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_DEFAULT_PHY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_phy
+ * @param hci_cmd_buffer
+ * @param con_handle
+ * @param all_phys
+ * @param tx_phys
+ * @param rx_phys
+ * @param phy_options
+ * @return size of HCI Command packet
+ * @note: format H1112
+ */
+static inline uint16_t hci_cmd_encode_le_set_phy(uint8_t * hci_cmd_buffer, hci_con_handle_t con_handle, uint8_t all_phys, uint8_t tx_phys, uint8_t rx_phys, uint16_t phy_options){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) con_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (con_handle >> 8);
+    hci_cmd_buffer[pos++] = all_phys;
+    hci_cmd_buffer[pos++] = tx_phys;
+    hci_cmd_buffer[pos++] = rx_phys;
+    hci_cmd_buffer[pos++] = (uint8_t) phy_options;
+    hci_cmd_buffer[pos++] = (uint8_t) (phy_options >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_PHY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_PHY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_receiver_test_v2
+ * @param hci_cmd_buffer
+ * @param rx_channel
+ * @param phy
+ * @param modulation_index
+ * @return size of HCI Command packet
+ * @note: format 111
+ */
+static inline uint16_t hci_cmd_encode_le_receiver_test_v2(uint8_t * hci_cmd_buffer, uint8_t rx_channel, uint8_t phy, uint8_t modulation_index){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = rx_channel;
+    hci_cmd_buffer[pos++] = phy;
+    hci_cmd_buffer[pos++] = modulation_index;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_RECEIVER_TEST_V2;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_RECEIVER_TEST_V2 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_transmitter_test_v2
+ * @param hci_cmd_buffer
+ * @param tx_channel
+ * @param test_data_length
+ * @param packet_payload
+ * @param phy
+ * @return size of HCI Command packet
+ * @note: format 1111
+ */
+static inline uint16_t hci_cmd_encode_le_transmitter_test_v2(uint8_t * hci_cmd_buffer, uint8_t tx_channel, uint8_t test_data_length, uint8_t packet_payload, uint8_t phy){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = tx_channel;
+    hci_cmd_buffer[pos++] = test_data_length;
+    hci_cmd_buffer[pos++] = packet_payload;
+    hci_cmd_buffer[pos++] = phy;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_TRANSMITTER_TEST_V2;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_TRANSMITTER_TEST_V2 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_advertising_set_random_address
+ * @param hci_cmd_buffer
+ * @param advertising_handle
+ * @param random_address
+ * @return size of HCI Command packet
+ * @note: format 1B
+ */
+static inline uint16_t hci_cmd_encode_le_set_advertising_set_random_address(uint8_t * hci_cmd_buffer, uint8_t advertising_handle, const bd_addr_t random_address){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[pos++] = random_address[5];
+    hci_cmd_buffer[pos++] = random_address[4];
+    hci_cmd_buffer[pos++] = random_address[3];
+    hci_cmd_buffer[pos++] = random_address[2];
+    hci_cmd_buffer[pos++] = random_address[1];
+    hci_cmd_buffer[pos++] = random_address[0];
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_ADVERTISING_SET_RANDOM_ADDRESS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_ADVERTISING_SET_RANDOM_ADDRESS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_extended_advertising_parameters
+ * @param hci_cmd_buffer
+ * @param advertising_handle
+ * @param advertising_event_properties
+ * @param primary_advertising_interval_min
+ * @param primary_advertising_interval_max
+ * @param primary_advertising_channel_map
+ * @param own_address_type
+ * @param peer_address_type
+ * @param peer_address
+ * @param advertising_filter_policy
+ * @param advertising_tx_power
+ * @param primary_advertising_phy
+ * @param secondary_advertising_max_skip
+ * @param secondary_advertising_phy
+ * @param advertising_sid
+ * @param scan_request_notification_enable
+ * @return size of HCI Command packet
+ * @note: format 1233111B1111111
+ */
+static inline uint16_t hci_cmd_encode_le_set_extended_advertising_parameters(uint8_t * hci_cmd_buffer, uint8_t advertising_handle, uint16_t advertising_event_properties, uint32_t primary_advertising_interval_min, uint32_t primary_advertising_interval_max, uint8_t primary_advertising_channel_map, uint8_t own_address_type, uint8_t peer_address_type, const bd_addr_t peer_address, uint8_t advertising_filter_policy, uint8_t advertising_tx_power, uint8_t primary_advertising_phy, uint8_t secondary_advertising_max_skip, uint8_t secondary_advertising_phy, uint8_t advertising_sid, uint8_t scan_request_notification_enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) advertising_event_properties;
+    hci_cmd_buffer[pos++] = (uint8_t) (advertising_event_properties >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) primary_advertising_interval_min;
+    hci_cmd_buffer[pos++] = (uint8_t) (primary_advertising_interval_min >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (primary_advertising_interval_min >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) primary_advertising_interval_max;
+    hci_cmd_buffer[pos++] = (uint8_t) (primary_advertising_interval_max >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (primary_advertising_interval_max >> 16);
+    hci_cmd_buffer[pos++] = primary_advertising_channel_map;
+    hci_cmd_buffer[pos++] = own_address_type;
+    hci_cmd_buffer[pos++] = peer_address_type;
+    hci_cmd_buffer[pos++] = peer_address[5];
+    hci_cmd_buffer[pos++] = peer_address[4];
+    hci_cmd_buffer[pos++] = peer_address[3];
+    hci_cmd_buffer[pos++] = peer_address[2];
+    hci_cmd_buffer[pos++] = peer_address[1];
+    hci_cmd_buffer[pos++] = peer_address[0];
+    hci_cmd_buffer[pos++] = advertising_filter_policy;
+    hci_cmd_buffer[pos++] = advertising_tx_power;
+    hci_cmd_buffer[pos++] = primary_advertising_phy;
+    hci_cmd_buffer[pos++] = secondary_advertising_max_skip;
+    hci_cmd_buffer[pos++] = secondary_advertising_phy;
+    hci_cmd_buffer[pos++] = advertising_sid;
+    hci_cmd_buffer[pos++] = scan_request_notification_enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_EXTENDED_ADVERTISING_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_EXTENDED_ADVERTISING_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_extended_advertising_data
+ * @param hci_cmd_buffer
+ * @param advertising_handle
+ * @param operation
+ * @param fragment_preference
+ * @param advertising_data_length
+ * @param advertising_data
+ * @return size of HCI Command packet
+ * @note: format 111JV
+ */
+static inline uint16_t hci_cmd_encode_le_set_extended_advertising_data(uint8_t * hci_cmd_buffer, uint8_t advertising_handle, uint8_t operation, uint8_t fragment_preference, uint8_t advertising_data_length, const uint8_t * advertising_data){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[pos++] = operation;
+    hci_cmd_buffer[pos++] = fragment_preference;
+    hci_cmd_buffer[pos++] = advertising_data_length;
+    (void) memcpy(&hci_cmd_buffer[pos], advertising_data, advertising_data_length);
+    pos += advertising_data_length;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_EXTENDED_ADVERTISING_DATA;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_EXTENDED_ADVERTISING_DATA >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_extended_scan_response_data
+ * @param hci_cmd_buffer
+ * @param advertising_handle
+ * @param operation
+ * @param fragment_preference
+ * @param scan_response_data_length
+ * @param scan_response_data
+ * @return size of HCI Command packet
+ * @note: format 111JV
+ */
+static inline uint16_t hci_cmd_encode_le_set_extended_scan_response_data(uint8_t * hci_cmd_buffer, uint8_t advertising_handle, uint8_t operation, uint8_t fragment_preference, uint8_t scan_response_data_length, const uint8_t * scan_response_data){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[pos++] = operation;
+    hci_cmd_buffer[pos++] = fragment_preference;
+    hci_cmd_buffer[pos++] = scan_response_data_length;
+    (void) memcpy(&hci_cmd_buffer[pos], scan_response_data, scan_response_data_length);
+    pos += scan_response_data_length;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_EXTENDED_SCAN_RESPONSE_DATA;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_EXTENDED_SCAN_RESPONSE_DATA >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_extended_advertising_enable
+ * @param hci_cmd_buffer
+ * @param enable
+ * @param num_sets
+ * @param advertising_handle
+ * @param duration
+ * @param max_extended_advertising_events
+ * @return size of HCI Command packet
+ * @note: format 1a[121]
+ */
+static inline uint16_t hci_cmd_encode_le_set_extended_advertising_enable(uint8_t * hci_cmd_buffer, uint8_t enable, uint8_t num_sets, const uint8_t * advertising_handle, const uint16_t * duration, const uint8_t * max_extended_advertising_events){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = enable;
+    hci_cmd_buffer[pos++] = num_sets;
+    uint8_t i;
+    for (i = 0; i < num_sets; i++){
+        hci_cmd_buffer[pos++] = (uint8_t) advertising_handle[i];
+        hci_cmd_buffer[pos++] = (uint8_t) duration[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (duration[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) max_extended_advertising_events[i];
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_EXTENDED_ADVERTISING_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_EXTENDED_ADVERTISING_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_maximum_advertising_data_length
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_maximum_advertising_data_length(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_MAXIMUM_ADVERTISING_DATA_LENGTH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_MAXIMUM_ADVERTISING_DATA_LENGTH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_number_of_supported_advertising_sets
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_number_of_supported_advertising_sets(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_NUMBER_OF_SUPPORTED_ADVERTISING_SETS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_NUMBER_OF_SUPPORTED_ADVERTISING_SETS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_remove_advertising_set
+ * @param hci_cmd_buffer
+ * @param advertising_handle
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_le_remove_advertising_set(uint8_t * hci_cmd_buffer, uint8_t advertising_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_REMOVE_ADVERTISING_SET;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_REMOVE_ADVERTISING_SET >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_clear_advertising_sets
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_clear_advertising_sets(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CLEAR_ADVERTISING_SETS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CLEAR_ADVERTISING_SETS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_periodic_advertising_parameters
+ * @param hci_cmd_buffer
+ * @param advertising_handle
+ * @param periodic_advertising_interval_min
+ * @param periodic_advertising_interval_max
+ * @param periodic_advertising_properties
+ * @return size of HCI Command packet
+ * @note: format 1222
+ */
+static inline uint16_t hci_cmd_encode_le_set_periodic_advertising_parameters(uint8_t * hci_cmd_buffer, uint8_t advertising_handle, uint16_t periodic_advertising_interval_min, uint16_t periodic_advertising_interval_max, uint16_t periodic_advertising_properties){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) periodic_advertising_interval_min;
+    hci_cmd_buffer[pos++] = (uint8_t) (periodic_advertising_interval_min >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) periodic_advertising_interval_max;
+    hci_cmd_buffer[pos++] = (uint8_t) (periodic_advertising_interval_max >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) periodic_advertising_properties;
+    hci_cmd_buffer[pos++] = (uint8_t) (periodic_advertising_properties >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_periodic_advertising_data
+ * @param hci_cmd_buffer
+ * @param advertising_handle
+ * @param operation
+ * @param advertising_data_length
+ * @param advertising_data
+ * @return size of HCI Command packet
+ * @note: format 11JV
+ */
+static inline uint16_t hci_cmd_encode_le_set_periodic_advertising_data(uint8_t * hci_cmd_buffer, uint8_t advertising_handle, uint8_t operation, uint8_t advertising_data_length, const uint8_t * advertising_data){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[pos++] = operation;
+    hci_cmd_buffer[pos++] = advertising_data_length;
+    (void) memcpy(&hci_cmd_buffer[pos], advertising_data, advertising_data_length);
+    pos += advertising_data_length;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_DATA;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_DATA >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_periodic_advertising_enable
+ * @param hci_cmd_buffer
+ * @param enable
+ * @param advertising_handle
+ * @return size of HCI Command packet
+ * @note: format 11
+ */
+static inline uint16_t hci_cmd_encode_le_set_periodic_advertising_enable(uint8_t * hci_cmd_buffer, uint8_t enable, uint8_t advertising_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = enable;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_extended_scan_parameters
+ * @param hci_cmd_buffer
+ * @param own_address_type
+ * @param scanning_filter_policy
+ * @param scanning_phys
+ * @param scan_type
+ * @param scan_interval
+ * @param scan_window
+ * @return size of HCI Command packet
+ * @note: format 11b[122]
+ */
+static inline uint16_t hci_cmd_encode_le_set_extended_scan_parameters(uint8_t * hci_cmd_buffer, uint8_t own_address_type, uint8_t scanning_filter_policy, uint8_t scanning_phys, const uint8_t * scan_type, const uint16_t * scan_interval, const uint16_t * scan_window){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = own_address_type;
+    hci_cmd_buffer[pos++] = scanning_filter_policy;
+    hci_cmd_buffer[pos++] = scanning_phys;
+    uint8_t i;
+    for (i = 0; i < count_set_bits_uint32(scanning_phys); i++){
+        hci_cmd_buffer[pos++] = (uint8_t) scan_type[i];
+        hci_cmd_buffer[pos++] = (uint8_t) scan_interval[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (scan_interval[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) scan_window[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (scan_window[i] >> 8);
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_EXTENDED_SCAN_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_EXTENDED_SCAN_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_extended_scan_enable
+ * @param hci_cmd_buffer
+ * @param enable
+ * @param filter_duplicates
+ * @param duration
+ * @param period
+ * @return size of HCI Command packet
+ * @note: format 1122
+ */
+static inline uint16_t hci_cmd_encode_le_set_extended_scan_enable(uint8_t * hci_cmd_buffer, uint8_t enable, uint8_t filter_duplicates, uint16_t duration, uint16_t period){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = enable;
+    hci_cmd_buffer[pos++] = filter_duplicates;
+    hci_cmd_buffer[pos++] = (uint8_t) duration;
+    hci_cmd_buffer[pos++] = (uint8_t) (duration >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) period;
+    hci_cmd_buffer[pos++] = (uint8_t) (period >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_EXTENDED_SCAN_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_EXTENDED_SCAN_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_extended_create_connection
+ * @param hci_cmd_buffer
+ * @param initiator_filter_policy
+ * @param own_address_type
+ * @param peer_address_type
+ * @param peer_address
+ * @param initiating_phys
+ * @param scan_interval
+ * @param scan_window
+ * @param connection_interval_min
+ * @param connection_interval_max
+ * @param connection_latency
+ * @param supervision_timeout
+ * @param min_ce_length
+ * @param max_ce_length
+ * @return size of HCI Command packet
+ * @note: format 111Bb[22222222]
+ */
+static inline uint16_t hci_cmd_encode_le_extended_create_connection(uint8_t * hci_cmd_buffer, uint8_t initiator_filter_policy, uint8_t own_address_type, uint8_t peer_address_type, const bd_addr_t peer_address, uint8_t initiating_phys, const uint16_t * scan_interval, const uint16_t * scan_window, const uint16_t * connection_interval_min, const uint16_t * connection_interval_max, const uint16_t * connection_latency, const uint16_t * supervision_timeout, const uint16_t * min_ce_length, const uint16_t * max_ce_length){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = initiator_filter_policy;
+    hci_cmd_buffer[pos++] = own_address_type;
+    hci_cmd_buffer[pos++] = peer_address_type;
+    hci_cmd_buffer[pos++] = peer_address[5];
+    hci_cmd_buffer[pos++] = peer_address[4];
+    hci_cmd_buffer[pos++] = peer_address[3];
+    hci_cmd_buffer[pos++] = peer_address[2];
+    hci_cmd_buffer[pos++] = peer_address[1];
+    hci_cmd_buffer[pos++] = peer_address[0];
+    hci_cmd_buffer[pos++] = initiating_phys;
+    uint8_t i;
+    for (i = 0; i < count_set_bits_uint32(initiating_phys); i++){
+        hci_cmd_buffer[pos++] = (uint8_t) scan_interval[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (scan_interval[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) scan_window[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (scan_window[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) connection_interval_min[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (connection_interval_min[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) connection_interval_max[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (connection_interval_max[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) connection_latency[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (connection_latency[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) supervision_timeout[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (supervision_timeout[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) min_ce_length[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (min_ce_length[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) max_ce_length[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (max_ce_length[i] >> 8);
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_EXTENDED_CREATE_CONNECTION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_EXTENDED_CREATE_CONNECTION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_periodic_advertising_create_sync
+ * @param hci_cmd_buffer
+ * @param options
+ * @param advertising_sid
+ * @param advertiser_address_type
+ * @param advertiser_address
+ * @param skip
+ * @param sync_timeout
+ * @param sync_cte_type
+ * @return size of HCI Command packet
+ * @note: format 111B221
+ */
+static inline uint16_t hci_cmd_encode_le_periodic_advertising_create_sync(uint8_t * hci_cmd_buffer, uint8_t options, uint8_t advertising_sid, uint8_t advertiser_address_type, const bd_addr_t advertiser_address, uint16_t skip, uint16_t sync_timeout, uint8_t sync_cte_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = options;
+    hci_cmd_buffer[pos++] = advertising_sid;
+    hci_cmd_buffer[pos++] = advertiser_address_type;
+    hci_cmd_buffer[pos++] = advertiser_address[5];
+    hci_cmd_buffer[pos++] = advertiser_address[4];
+    hci_cmd_buffer[pos++] = advertiser_address[3];
+    hci_cmd_buffer[pos++] = advertiser_address[2];
+    hci_cmd_buffer[pos++] = advertiser_address[1];
+    hci_cmd_buffer[pos++] = advertiser_address[0];
+    hci_cmd_buffer[pos++] = (uint8_t) skip;
+    hci_cmd_buffer[pos++] = (uint8_t) (skip >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) sync_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (sync_timeout >> 8);
+    hci_cmd_buffer[pos++] = sync_cte_type;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_CREATE_SYNC;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_CREATE_SYNC >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_periodic_advertising_create_sync_cancel
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_periodic_advertising_create_sync_cancel(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_CREATE_SYNC_CANCEL;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_CREATE_SYNC_CANCEL >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_periodic_advertising_terminate_sync
+ * @param hci_cmd_buffer
+ * @param sync_handle
+ * @return size of HCI Command packet
+ * @note: format 2
+ */
+static inline uint16_t hci_cmd_encode_le_periodic_advertising_terminate_sync(uint8_t * hci_cmd_buffer, uint16_t sync_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) sync_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (sync_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_TERMINATE_SYNC;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_TERMINATE_SYNC >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_add_device_to_periodic_advertiser_list
+ * @param hci_cmd_buffer
+ * @param advertiser_address_type
+ * @param advertiser_address
+ * @param advertising_sid
+ * @return size of HCI Command packet
+ * @note: format 1B1
+ */
+static inline uint16_t hci_cmd_encode_le_add_device_to_periodic_advertiser_list(uint8_t * hci_cmd_buffer, uint8_t advertiser_address_type, const bd_addr_t advertiser_address, uint8_t advertising_sid){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertiser_address_type;
+    hci_cmd_buffer[pos++] = advertiser_address[5];
+    hci_cmd_buffer[pos++] = advertiser_address[4];
+    hci_cmd_buffer[pos++] = advertiser_address[3];
+    hci_cmd_buffer[pos++] = advertiser_address[2];
+    hci_cmd_buffer[pos++] = advertiser_address[1];
+    hci_cmd_buffer[pos++] = advertiser_address[0];
+    hci_cmd_buffer[pos++] = advertising_sid;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_ADD_DEVICE_TO_PERIODIC_ADVERTISER_LIST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_ADD_DEVICE_TO_PERIODIC_ADVERTISER_LIST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_remove_device_from_periodic_advertiser_list
+ * @param hci_cmd_buffer
+ * @param advertiser_address_type
+ * @param advertiser_address
+ * @param advertising_sid
+ * @return size of HCI Command packet
+ * @note: format 1B1
+ */
+static inline uint16_t hci_cmd_encode_le_remove_device_from_periodic_advertiser_list(uint8_t * hci_cmd_buffer, uint8_t advertiser_address_type, const bd_addr_t advertiser_address, uint8_t advertising_sid){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertiser_address_type;
+    hci_cmd_buffer[pos++] = advertiser_address[5];
+    hci_cmd_buffer[pos++] = advertiser_address[4];
+    hci_cmd_buffer[pos++] = advertiser_address[3];
+    hci_cmd_buffer[pos++] = advertiser_address[2];
+    hci_cmd_buffer[pos++] = advertiser_address[1];
+    hci_cmd_buffer[pos++] = advertiser_address[0];
+    hci_cmd_buffer[pos++] = advertising_sid;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_REMOVE_DEVICE_FROM_PERIODIC_ADVERTISER_LIST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_REMOVE_DEVICE_FROM_PERIODIC_ADVERTISER_LIST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_clear_periodic_advertiser_list
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_clear_periodic_advertiser_list(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CLEAR_PERIODIC_ADVERTISER_LIST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CLEAR_PERIODIC_ADVERTISER_LIST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_periodic_advertiser_list_size
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_periodic_advertiser_list_size(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_PERIODIC_ADVERTISER_LIST_SIZE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_PERIODIC_ADVERTISER_LIST_SIZE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_transmit_power
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_transmit_power(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_TRANSMIT_POWER;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_TRANSMIT_POWER >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_rf_path_compensation
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_rf_path_compensation(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_RF_PATH_COMPENSATION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_RF_PATH_COMPENSATION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_write_rf_path_compensation
+ * @param hci_cmd_buffer
+ * @param rf_tx_path_compensation_value
+ * @param rf_rx_path_compensation_value
+ * @return size of HCI Command packet
+ * @note: format 22
+ */
+static inline uint16_t hci_cmd_encode_le_write_rf_path_compensation(uint8_t * hci_cmd_buffer, uint16_t rf_tx_path_compensation_value, uint16_t rf_rx_path_compensation_value){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) rf_tx_path_compensation_value;
+    hci_cmd_buffer[pos++] = (uint8_t) (rf_tx_path_compensation_value >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) rf_rx_path_compensation_value;
+    hci_cmd_buffer[pos++] = (uint8_t) (rf_rx_path_compensation_value >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_WRITE_RF_PATH_COMPENSATION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_WRITE_RF_PATH_COMPENSATION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_privacy_mode
+ * @param hci_cmd_buffer
+ * @param peer_identity_address_type
+ * @param peer_identity_address
+ * @param privacy_mode
+ * @return size of HCI Command packet
+ * @note: format 1B1
+ */
+static inline uint16_t hci_cmd_encode_le_set_privacy_mode(uint8_t * hci_cmd_buffer, uint8_t peer_identity_address_type, const bd_addr_t peer_identity_address, uint8_t privacy_mode){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = peer_identity_address_type;
+    hci_cmd_buffer[pos++] = peer_identity_address[5];
+    hci_cmd_buffer[pos++] = peer_identity_address[4];
+    hci_cmd_buffer[pos++] = peer_identity_address[3];
+    hci_cmd_buffer[pos++] = peer_identity_address[2];
+    hci_cmd_buffer[pos++] = peer_identity_address[1];
+    hci_cmd_buffer[pos++] = peer_identity_address[0];
+    hci_cmd_buffer[pos++] = privacy_mode;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_PRIVACY_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_PRIVACY_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_receiver_test_v3
+ * @param hci_cmd_buffer
+ * @param rx_channel
+ * @param phy
+ * @param modulation_index
+ * @param expected_cte_length
+ * @param expected_cte_type
+ * @param slot_durations
+ * @param switching_pattern_length
+ * @param antenna_ids
+ * @return size of HCI Command packet
+ * @note: format 111111a[1]
+ */
+static inline uint16_t hci_cmd_encode_le_receiver_test_v3(uint8_t * hci_cmd_buffer, uint8_t rx_channel, uint8_t phy, uint8_t modulation_index, uint8_t expected_cte_length, uint8_t expected_cte_type, uint8_t slot_durations, uint8_t switching_pattern_length, const uint8_t * antenna_ids){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = rx_channel;
+    hci_cmd_buffer[pos++] = phy;
+    hci_cmd_buffer[pos++] = modulation_index;
+    hci_cmd_buffer[pos++] = expected_cte_length;
+    hci_cmd_buffer[pos++] = expected_cte_type;
+    hci_cmd_buffer[pos++] = slot_durations;
+    hci_cmd_buffer[pos++] = switching_pattern_length;
+    uint8_t i;
+    for (i = 0; i < switching_pattern_length; i++){
+        hci_cmd_buffer[pos++] = (uint8_t) antenna_ids[i];
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_RECEIVER_TEST_V3;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_RECEIVER_TEST_V3 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_transmitter_test_v3
+ * @param hci_cmd_buffer
+ * @param tx_channel
+ * @param test_data_length
+ * @param packet_payload
+ * @param phy
+ * @param cte_length
+ * @param cte_type
+ * @param switching_pattern_length
+ * @param antenna_ids
+ * @return size of HCI Command packet
+ * @note: format 111111a[1]
+ */
+static inline uint16_t hci_cmd_encode_le_transmitter_test_v3(uint8_t * hci_cmd_buffer, uint8_t tx_channel, uint8_t test_data_length, uint8_t packet_payload, uint8_t phy, uint8_t cte_length, uint8_t cte_type, uint8_t switching_pattern_length, const uint8_t * antenna_ids){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = tx_channel;
+    hci_cmd_buffer[pos++] = test_data_length;
+    hci_cmd_buffer[pos++] = packet_payload;
+    hci_cmd_buffer[pos++] = phy;
+    hci_cmd_buffer[pos++] = cte_length;
+    hci_cmd_buffer[pos++] = cte_type;
+    hci_cmd_buffer[pos++] = switching_pattern_length;
+    uint8_t i;
+    for (i = 0; i < switching_pattern_length; i++){
+        hci_cmd_buffer[pos++] = (uint8_t) antenna_ids[i];
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_TRANSMITTER_TEST_V3;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_TRANSMITTER_TEST_V3 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_connectionless_cte_transmit_parameters
+ * @param hci_cmd_buffer
+ * @param advertising_handle
+ * @param cte_length
+ * @param cte_type
+ * @param cte_count
+ * @param switching_pattern_length
+ * @param antenna_ids
+ * @return size of HCI Command packet
+ * @note: format 1111a[1]
+ */
+static inline uint16_t hci_cmd_encode_le_set_connectionless_cte_transmit_parameters(uint8_t * hci_cmd_buffer, uint8_t advertising_handle, uint8_t cte_length, uint8_t cte_type, uint8_t cte_count, uint8_t switching_pattern_length, const uint8_t * antenna_ids){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[pos++] = cte_length;
+    hci_cmd_buffer[pos++] = cte_type;
+    hci_cmd_buffer[pos++] = cte_count;
+    hci_cmd_buffer[pos++] = switching_pattern_length;
+    uint8_t i;
+    for (i = 0; i < switching_pattern_length; i++){
+        hci_cmd_buffer[pos++] = (uint8_t) antenna_ids[i];
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_CONNECTIONLESS_CTE_TRANSMIT_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_CONNECTIONLESS_CTE_TRANSMIT_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_connectionless_cte_transmit_enable
+ * @param hci_cmd_buffer
+ * @param advertising_handle
+ * @param cte_enable
+ * @return size of HCI Command packet
+ * @note: format 11
+ */
+static inline uint16_t hci_cmd_encode_le_set_connectionless_cte_transmit_enable(uint8_t * hci_cmd_buffer, uint8_t advertising_handle, uint8_t cte_enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[pos++] = cte_enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_CONNECTIONLESS_CTE_TRANSMIT_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_CONNECTIONLESS_CTE_TRANSMIT_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_connectionless_iq_sampling_enable
+ * @note: format 2111a[i] not supported
+ */
+//  static inline uint16_t hci_cmd_encode_le_set_connectionless_iq_sampling_enable(uint8_t * hci_cmd_buffer, ...){
+//      not implemented yet
+//  }
+
+/**
+ * @brief Encode hci_le_set_connection_cte_receive_parameters
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param sampling_enable
+ * @param slot_durations
+ * @param switching_pattern_length
+ * @param antenna_ids
+ * @return size of HCI Command packet
+ * @note: format 211a[1]
+ */
+static inline uint16_t hci_cmd_encode_le_set_connection_cte_receive_parameters(uint8_t * hci_cmd_buffer, uint16_t connection_handle, uint8_t sampling_enable, uint8_t slot_durations, uint8_t switching_pattern_length, const uint8_t * antenna_ids){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = sampling_enable;
+    hci_cmd_buffer[pos++] = slot_durations;
+    hci_cmd_buffer[pos++] = switching_pattern_length;
+    uint8_t i;
+    for (i = 0; i < switching_pattern_length; i++){
+        hci_cmd_buffer[pos++] = (uint8_t) antenna_ids[i];
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_CONNECTION_CTE_RECEIVE_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_CONNECTION_CTE_RECEIVE_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_connection_cte_transmit_parameters
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param cte_types
+ * @param switching_pattern_length
+ * @param antenna_ids
+ * @return size of HCI Command packet
+ * @note: format 21a[1]
+ */
+static inline uint16_t hci_cmd_encode_le_set_connection_cte_transmit_parameters(uint8_t * hci_cmd_buffer, uint16_t connection_handle, uint8_t cte_types, uint8_t switching_pattern_length, const uint8_t * antenna_ids){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = cte_types;
+    hci_cmd_buffer[pos++] = switching_pattern_length;
+    uint8_t i;
+    for (i = 0; i < switching_pattern_length; i++){
+        hci_cmd_buffer[pos++] = (uint8_t) antenna_ids[i];
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_CONNECTION_CTE_TRANSMIT_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_CONNECTION_CTE_TRANSMIT_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_connection_cte_request_enable
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param enable
+ * @param cte_request_interval
+ * @param requested_cte_length
+ * @param requested_cte_type
+ * @return size of HCI Command packet
+ * @note: format H1211
+ */
+static inline uint16_t hci_cmd_encode_le_connection_cte_request_enable(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t enable, uint16_t cte_request_interval, uint8_t requested_cte_length, uint8_t requested_cte_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = enable;
+    hci_cmd_buffer[pos++] = (uint8_t) cte_request_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (cte_request_interval >> 8);
+    hci_cmd_buffer[pos++] = requested_cte_length;
+    hci_cmd_buffer[pos++] = requested_cte_type;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CONNECTION_CTE_REQUEST_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CONNECTION_CTE_REQUEST_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_connection_cte_response_enable
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param enable
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_le_connection_cte_response_enable(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CONNECTION_CTE_RESPONSE_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CONNECTION_CTE_RESPONSE_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_antenna_information
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_antenna_information(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_ANTENNA_INFORMATION;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_ANTENNA_INFORMATION >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_periodic_advertising_receive_enable
+ * @param hci_cmd_buffer
+ * @param sync_handle
+ * @param enable
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_le_set_periodic_advertising_receive_enable(uint8_t * hci_cmd_buffer, hci_con_handle_t sync_handle, uint8_t enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) sync_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (sync_handle >> 8);
+    hci_cmd_buffer[pos++] = enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_RECEIVE_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_RECEIVE_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_periodic_advertising_sync_transfer
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param service_data
+ * @param sync_handle
+ * @return size of HCI Command packet
+ * @note: format H22
+ */
+static inline uint16_t hci_cmd_encode_le_periodic_advertising_sync_transfer(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint16_t service_data, uint16_t sync_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) service_data;
+    hci_cmd_buffer[pos++] = (uint8_t) (service_data >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) sync_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (sync_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_SYNC_TRANSFER;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_SYNC_TRANSFER >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_periodic_advertising_set_info_transfer
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param service_data
+ * @param advertising_handle
+ * @return size of HCI Command packet
+ * @note: format H21
+ */
+static inline uint16_t hci_cmd_encode_le_periodic_advertising_set_info_transfer(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint16_t service_data, uint8_t advertising_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) service_data;
+    hci_cmd_buffer[pos++] = (uint8_t) (service_data >> 8);
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_SET_INFO_TRANSFER;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_PERIODIC_ADVERTISING_SET_INFO_TRANSFER >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_periodic_advertising_sync_transfer_parameters
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param mode
+ * @param skip
+ * @param sync_timeout
+ * @param cte_type
+ * @return size of HCI Command packet
+ * @note: format H1221
+ */
+static inline uint16_t hci_cmd_encode_le_set_periodic_advertising_sync_transfer_parameters(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t mode, uint16_t skip, uint16_t sync_timeout, uint8_t cte_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = mode;
+    hci_cmd_buffer[pos++] = (uint8_t) skip;
+    hci_cmd_buffer[pos++] = (uint8_t) (skip >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) sync_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (sync_timeout >> 8);
+    hci_cmd_buffer[pos++] = cte_type;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_SYNC_TRANSFER_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_PERIODIC_ADVERTISING_SYNC_TRANSFER_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_default_periodic_advertising_sync_transfer_parameters
+ * @param hci_cmd_buffer
+ * @param mode
+ * @param skip
+ * @param sync_timeout
+ * @param cte_type
+ * @return size of HCI Command packet
+ * @note: format 1221
+ */
+static inline uint16_t hci_cmd_encode_le_set_default_periodic_advertising_sync_transfer_parameters(uint8_t * hci_cmd_buffer, uint8_t mode, uint16_t skip, uint16_t sync_timeout, uint8_t cte_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = mode;
+    hci_cmd_buffer[pos++] = (uint8_t) skip;
+    hci_cmd_buffer[pos++] = (uint8_t) (skip >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) sync_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (sync_timeout >> 8);
+    hci_cmd_buffer[pos++] = cte_type;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_DEFAULT_PERIODIC_ADVERTISING_SYNC_TRANSFER_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_DEFAULT_PERIODIC_ADVERTISING_SYNC_TRANSFER_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_generate_dhkey_v2
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @param param_2
+ * @return size of HCI Command packet
+ * @note: format QQ1
+ */
+static inline uint16_t hci_cmd_encode_le_generate_dhkey_v2(uint8_t * hci_cmd_buffer, const uint8_t * param_0, const uint8_t * param_1, uint8_t param_2){
+    uint16_t pos = 3;
+    reverse_bytes(param_0, &hci_cmd_buffer[pos], 32);
+    pos += 32;
+    reverse_bytes(param_1, &hci_cmd_buffer[pos], 32);
+    pos += 32;
+    hci_cmd_buffer[pos++] = param_2;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_GENERATE_DHKEY_V2;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_GENERATE_DHKEY_V2 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_modify_sleep_clock_accuracy
+ * @param hci_cmd_buffer
+ * @param action
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_le_modify_sleep_clock_accuracy(uint8_t * hci_cmd_buffer, uint8_t action){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = action;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_MODIFY_SLEEP_CLOCK_ACCURACY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_MODIFY_SLEEP_CLOCK_ACCURACY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_buffer_size_v2
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_le_read_buffer_size_v2(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_BUFFER_SIZE_V2;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_BUFFER_SIZE_V2 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_iso_tx_sync
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_read_iso_tx_sync(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_ISO_TX_SYNC;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_ISO_TX_SYNC >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_cig_parameters
+ * @param hci_cmd_buffer
+ * @param cig_id
+ * @param sdu_interval_m_to_s
+ * @param sdu_interval_s_to_m
+ * @param slaves_clock_accuracy
+ * @param packing
+ * @param framing
+ * @param max_transport_latency_m_to_s
+ * @param max_transport_latency_s_to_m
+ * @param cis_count
+ * @param cis_id
+ * @param max_sdu_m_to_s
+ * @param max_sdu_s_to_m
+ * @param phy_m_to_s
+ * @param phy_s_to_m
+ * @param rtn_m_to_s
+ * @param rtn_s_to_m
+ * @return size of HCI Command packet
+ * @note: format 13311122a[1221111]
+ */
+static inline uint16_t hci_cmd_encode_le_set_cig_parameters(uint8_t * hci_cmd_buffer, uint8_t cig_id, uint32_t sdu_interval_m_to_s, uint32_t sdu_interval_s_to_m, uint8_t slaves_clock_accuracy, uint8_t packing, uint8_t framing, uint16_t max_transport_latency_m_to_s, uint16_t max_transport_latency_s_to_m, uint8_t cis_count, const uint8_t * cis_id, const uint16_t * max_sdu_m_to_s, const uint16_t * max_sdu_s_to_m, const uint8_t * phy_m_to_s, const uint8_t * phy_s_to_m, const uint8_t * rtn_m_to_s, const uint8_t * rtn_s_to_m){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = cig_id;
+    hci_cmd_buffer[pos++] = (uint8_t) sdu_interval_m_to_s;
+    hci_cmd_buffer[pos++] = (uint8_t) (sdu_interval_m_to_s >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (sdu_interval_m_to_s >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) sdu_interval_s_to_m;
+    hci_cmd_buffer[pos++] = (uint8_t) (sdu_interval_s_to_m >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (sdu_interval_s_to_m >> 16);
+    hci_cmd_buffer[pos++] = slaves_clock_accuracy;
+    hci_cmd_buffer[pos++] = packing;
+    hci_cmd_buffer[pos++] = framing;
+    hci_cmd_buffer[pos++] = (uint8_t) max_transport_latency_m_to_s;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_transport_latency_m_to_s >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) max_transport_latency_s_to_m;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_transport_latency_s_to_m >> 8);
+    hci_cmd_buffer[pos++] = cis_count;
+    uint8_t i;
+    for (i = 0; i < cis_count; i++){
+        hci_cmd_buffer[pos++] = (uint8_t) cis_id[i];
+        hci_cmd_buffer[pos++] = (uint8_t) max_sdu_m_to_s[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (max_sdu_m_to_s[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) max_sdu_s_to_m[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (max_sdu_s_to_m[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) phy_m_to_s[i];
+        hci_cmd_buffer[pos++] = (uint8_t) phy_s_to_m[i];
+        hci_cmd_buffer[pos++] = (uint8_t) rtn_m_to_s[i];
+        hci_cmd_buffer[pos++] = (uint8_t) rtn_s_to_m[i];
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_CIG_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_CIG_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_cig_parameters_test
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @param param_2
+ * @param param_3
+ * @param param_4
+ * @param param_5
+ * @param param_6
+ * @param param_7
+ * @param param_8
+ * @param param_9
+ * @param param_10
+ * @param param_11
+ * @param param_12
+ * @param param_13
+ * @param param_14
+ * @param param_15
+ * @param param_16
+ * @param param_17
+ * @param param_18
+ * @param param_19
+ * @return size of HCI Command packet
+ * @note: format 133112111a[1122221111]
+ */
+static inline uint16_t hci_cmd_encode_le_set_cig_parameters_test(uint8_t * hci_cmd_buffer, uint8_t param_0, uint32_t param_1, uint32_t param_2, uint8_t param_3, uint8_t param_4, uint16_t param_5, uint8_t param_6, uint8_t param_7, uint8_t param_8, uint8_t param_9, const uint8_t * param_10, const uint8_t * param_11, const uint16_t * param_12, const uint16_t * param_13, const uint16_t * param_14, const uint16_t * param_15, const uint8_t * param_16, const uint8_t * param_17, const uint8_t * param_18, const uint8_t * param_19){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = param_0;
+    hci_cmd_buffer[pos++] = (uint8_t) param_1;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_1 >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (param_1 >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) param_2;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_2 >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (param_2 >> 16);
+    hci_cmd_buffer[pos++] = param_3;
+    hci_cmd_buffer[pos++] = param_4;
+    hci_cmd_buffer[pos++] = (uint8_t) param_5;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_5 >> 8);
+    hci_cmd_buffer[pos++] = param_6;
+    hci_cmd_buffer[pos++] = param_7;
+    hci_cmd_buffer[pos++] = param_8;
+    hci_cmd_buffer[pos++] = param_9;
+    uint8_t i;
+    for (i = 0; i < param_9; i++){
+        hci_cmd_buffer[pos++] = (uint8_t) param_10[i];
+        hci_cmd_buffer[pos++] = (uint8_t) param_11[i];
+        hci_cmd_buffer[pos++] = (uint8_t) param_12[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (param_12[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) param_13[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (param_13[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) param_14[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (param_14[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) param_15[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (param_15[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) param_16[i];
+        hci_cmd_buffer[pos++] = (uint8_t) param_17[i];
+        hci_cmd_buffer[pos++] = (uint8_t) param_18[i];
+        hci_cmd_buffer[pos++] = (uint8_t) param_19[i];
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_CIG_PARAMETERS_TEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_CIG_PARAMETERS_TEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_create_cis
+ * @param hci_cmd_buffer
+ * @param cis_count
+ * @param cis_connection_handle
+ * @param acl_connection_handle
+ * @return size of HCI Command packet
+ * @note: format a[22]
+ */
+static inline uint16_t hci_cmd_encode_le_create_cis(uint8_t * hci_cmd_buffer, uint8_t cis_count, const uint16_t * cis_connection_handle, const uint16_t * acl_connection_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = cis_count;
+    uint8_t i;
+    for (i = 0; i < cis_count; i++){
+        hci_cmd_buffer[pos++] = (uint8_t) cis_connection_handle[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (cis_connection_handle[i] >> 8);
+        hci_cmd_buffer[pos++] = (uint8_t) acl_connection_handle[i];
+        hci_cmd_buffer[pos++] = (uint8_t) (acl_connection_handle[i] >> 8);
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CREATE_CIS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CREATE_CIS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_remove_cig
+ * @param hci_cmd_buffer
+ * @param cig_id
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_le_remove_cig(uint8_t * hci_cmd_buffer, uint8_t cig_id){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = cig_id;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_REMOVE_CIG;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_REMOVE_CIG >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_accept_cis_request
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_accept_cis_request(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_ACCEPT_CIS_REQUEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_ACCEPT_CIS_REQUEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_reject_cis_request
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_le_reject_cis_request(uint8_t * hci_cmd_buffer, hci_con_handle_t param_0, uint8_t param_1){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) param_0;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_0 >> 8);
+    hci_cmd_buffer[pos++] = param_1;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_REJECT_CIS_REQUEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_REJECT_CIS_REQUEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_create_big
+ * @param hci_cmd_buffer
+ * @param big_handle
+ * @param advertising_handle
+ * @param num_bis
+ * @param sdu_interval
+ * @param max_sdu
+ * @param max_transport_latency
+ * @param rtn
+ * @param phy
+ * @param packing
+ * @param framing
+ * @param encryption
+ * @param broadcast_code
+ * @return size of HCI Command packet
+ * @note: format 11132211111K
+ */
+static inline uint16_t hci_cmd_encode_le_create_big(uint8_t * hci_cmd_buffer, uint8_t big_handle, uint8_t advertising_handle, uint8_t num_bis, uint32_t sdu_interval, uint16_t max_sdu, uint16_t max_transport_latency, uint8_t rtn, uint8_t phy, uint8_t packing, uint8_t framing, uint8_t encryption, const uint8_t * broadcast_code){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = big_handle;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[pos++] = num_bis;
+    hci_cmd_buffer[pos++] = (uint8_t) sdu_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (sdu_interval >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (sdu_interval >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) max_sdu;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_sdu >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) max_transport_latency;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_transport_latency >> 8);
+    hci_cmd_buffer[pos++] = rtn;
+    hci_cmd_buffer[pos++] = phy;
+    hci_cmd_buffer[pos++] = packing;
+    hci_cmd_buffer[pos++] = framing;
+    hci_cmd_buffer[pos++] = encryption;
+    reverse_bytes(broadcast_code, &hci_cmd_buffer[pos], 16);
+    pos += 16;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CREATE_BIG;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CREATE_BIG >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_create_big_test
+ * @param hci_cmd_buffer
+ * @param big_handle
+ * @param advertising_handle
+ * @param num_bis
+ * @param sdu_interval
+ * @param iso_interval
+ * @param nse
+ * @param max_sdu
+ * @param max_pdu
+ * @param phy
+ * @param packing
+ * @param framing
+ * @param bn
+ * @param irc
+ * @param pto
+ * @param encryption
+ * @param broadcast_code
+ * @return size of HCI Command packet
+ * @note: format 111321221111111K
+ */
+static inline uint16_t hci_cmd_encode_le_create_big_test(uint8_t * hci_cmd_buffer, uint8_t big_handle, uint8_t advertising_handle, uint8_t num_bis, uint32_t sdu_interval, uint16_t iso_interval, uint8_t nse, uint16_t max_sdu, uint16_t max_pdu, uint8_t phy, uint8_t packing, uint8_t framing, uint8_t bn, uint8_t irc, uint8_t pto, uint8_t encryption, const uint8_t * broadcast_code){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = big_handle;
+    hci_cmd_buffer[pos++] = advertising_handle;
+    hci_cmd_buffer[pos++] = num_bis;
+    hci_cmd_buffer[pos++] = (uint8_t) sdu_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (sdu_interval >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (sdu_interval >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) iso_interval;
+    hci_cmd_buffer[pos++] = (uint8_t) (iso_interval >> 8);
+    hci_cmd_buffer[pos++] = nse;
+    hci_cmd_buffer[pos++] = (uint8_t) max_sdu;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_sdu >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) max_pdu;
+    hci_cmd_buffer[pos++] = (uint8_t) (max_pdu >> 8);
+    hci_cmd_buffer[pos++] = phy;
+    hci_cmd_buffer[pos++] = packing;
+    hci_cmd_buffer[pos++] = framing;
+    hci_cmd_buffer[pos++] = bn;
+    hci_cmd_buffer[pos++] = irc;
+    hci_cmd_buffer[pos++] = pto;
+    hci_cmd_buffer[pos++] = encryption;
+    reverse_bytes(broadcast_code, &hci_cmd_buffer[pos], 16);
+    pos += 16;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_CREATE_BIG_TEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_CREATE_BIG_TEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_terminate_big
+ * @param hci_cmd_buffer
+ * @param big_handle
+ * @param reason
+ * @return size of HCI Command packet
+ * @note: format 11
+ */
+static inline uint16_t hci_cmd_encode_le_terminate_big(uint8_t * hci_cmd_buffer, uint8_t big_handle, uint8_t reason){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = big_handle;
+    hci_cmd_buffer[pos++] = reason;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_TERMINATE_BIG;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_TERMINATE_BIG >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_big_create_sync
+ * @param hci_cmd_buffer
+ * @param big_handle
+ * @param sync_handle
+ * @param encryption
+ * @param broadcast_code
+ * @param mse
+ * @param big_sync_timeout
+ * @param num_bis
+ * @param bis
+ * @return size of HCI Command packet
+ * @note: format 1H1K12a[1]
+ */
+static inline uint16_t hci_cmd_encode_le_big_create_sync(uint8_t * hci_cmd_buffer, uint8_t big_handle, hci_con_handle_t sync_handle, uint8_t encryption, const uint8_t * broadcast_code, uint8_t mse, uint16_t big_sync_timeout, uint8_t num_bis, const uint8_t * bis){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = big_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) sync_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (sync_handle >> 8);
+    hci_cmd_buffer[pos++] = encryption;
+    reverse_bytes(broadcast_code, &hci_cmd_buffer[pos], 16);
+    pos += 16;
+    hci_cmd_buffer[pos++] = mse;
+    hci_cmd_buffer[pos++] = (uint8_t) big_sync_timeout;
+    hci_cmd_buffer[pos++] = (uint8_t) (big_sync_timeout >> 8);
+    hci_cmd_buffer[pos++] = num_bis;
+    uint8_t i;
+    for (i = 0; i < num_bis; i++){
+        hci_cmd_buffer[pos++] = (uint8_t) bis[i];
+    }
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_BIG_CREATE_SYNC;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_BIG_CREATE_SYNC >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_big_terminate_sync
+ * @param hci_cmd_buffer
+ * @param big_handle
+ * @return size of HCI Command packet
+ * @note: format 1
+ */
+static inline uint16_t hci_cmd_encode_le_big_terminate_sync(uint8_t * hci_cmd_buffer, uint8_t big_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = big_handle;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_BIG_TERMINATE_SYNC;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_BIG_TERMINATE_SYNC >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_request_peer_sca
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_request_peer_sca(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_REQUEST_PEER_SCA;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_REQUEST_PEER_SCA >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_setup_iso_data_path
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param data_path_direction
+ * @param data_path_id
+ * @param codec_id_coding_format
+ * @param codec_id_company_identifier
+ * @param codec_id_vendor_codec_id
+ * @param controller_delay
+ * @param codec_configuration_length
+ * @param codec_configuration
+ * @return size of HCI Command packet
+ * @note: format H111223JV
+ */
+static inline uint16_t hci_cmd_encode_le_setup_iso_data_path(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t data_path_direction, uint8_t data_path_id, uint8_t codec_id_coding_format, uint16_t codec_id_company_identifier, uint16_t codec_id_vendor_codec_id, uint32_t controller_delay, uint8_t codec_configuration_length, const uint8_t * codec_configuration){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = data_path_direction;
+    hci_cmd_buffer[pos++] = data_path_id;
+    hci_cmd_buffer[pos++] = codec_id_coding_format;
+    hci_cmd_buffer[pos++] = (uint8_t) codec_id_company_identifier;
+    hci_cmd_buffer[pos++] = (uint8_t) (codec_id_company_identifier >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) codec_id_vendor_codec_id;
+    hci_cmd_buffer[pos++] = (uint8_t) (codec_id_vendor_codec_id >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) controller_delay;
+    hci_cmd_buffer[pos++] = (uint8_t) (controller_delay >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (controller_delay >> 16);
+    hci_cmd_buffer[pos++] = codec_configuration_length;
+    (void) memcpy(&hci_cmd_buffer[pos], codec_configuration, codec_configuration_length);
+    pos += codec_configuration_length;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SETUP_ISO_DATA_PATH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SETUP_ISO_DATA_PATH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_remove_iso_data_path
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_le_remove_iso_data_path(uint8_t * hci_cmd_buffer, hci_con_handle_t param_0, uint8_t param_1){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) param_0;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_0 >> 8);
+    hci_cmd_buffer[pos++] = param_1;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_REMOVE_ISO_DATA_PATH;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_REMOVE_ISO_DATA_PATH >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_iso_transmit_test
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param paylaod_type
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_le_iso_transmit_test(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t paylaod_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = paylaod_type;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_ISO_TRANSMIT_TEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_ISO_TRANSMIT_TEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_iso_receive_test
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param paylaod_type
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_le_iso_receive_test(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t paylaod_type){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = paylaod_type;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_ISO_RECEIVE_TEST;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_ISO_RECEIVE_TEST >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_iso_read_test_counters
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_iso_read_test_counters(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_ISO_READ_TEST_COUNTERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_ISO_READ_TEST_COUNTERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_iso_test_end
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_iso_test_end(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_ISO_TEST_END;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_ISO_TEST_END >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_host_feature
+ * @param hci_cmd_buffer
+ * @param bit_number
+ * @param bit_value
+ * @return size of HCI Command packet
+ * @note: format 11
+ */
+static inline uint16_t hci_cmd_encode_le_set_host_feature(uint8_t * hci_cmd_buffer, uint8_t bit_number, uint8_t bit_value){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = bit_number;
+    hci_cmd_buffer[pos++] = bit_value;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_HOST_FEATURE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_HOST_FEATURE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_iso_link_quality
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_le_read_iso_link_quality(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_ISO_LINK_QUALITY;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_ISO_LINK_QUALITY >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_enhanced_read_transmit_power_level
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param phy
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_le_enhanced_read_transmit_power_level(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t phy){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = phy;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_ENHANCED_READ_TRANSMIT_POWER_LEVEL;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_ENHANCED_READ_TRANSMIT_POWER_LEVEL >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_read_remote_transmit_power_level
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param phy
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_le_read_remote_transmit_power_level(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t phy){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = phy;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_READ_REMOTE_TRANSMIT_POWER_LEVEL;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_READ_REMOTE_TRANSMIT_POWER_LEVEL >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_path_loss_reporting_parameters
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param high_threshold
+ * @param high_hysteresis
+ * @param low_threshold
+ * @param low_hysteresis
+ * @param min_time_spent
+ * @return size of HCI Command packet
+ * @note: format 211112
+ */
+static inline uint16_t hci_cmd_encode_le_set_path_loss_reporting_parameters(uint8_t * hci_cmd_buffer, uint16_t connection_handle, uint8_t high_threshold, uint8_t high_hysteresis, uint8_t low_threshold, uint8_t low_hysteresis, uint16_t min_time_spent){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = high_threshold;
+    hci_cmd_buffer[pos++] = high_hysteresis;
+    hci_cmd_buffer[pos++] = low_threshold;
+    hci_cmd_buffer[pos++] = low_hysteresis;
+    hci_cmd_buffer[pos++] = (uint8_t) min_time_spent;
+    hci_cmd_buffer[pos++] = (uint8_t) (min_time_spent >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_PATH_LOSS_REPORTING_PARAMETERS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_PATH_LOSS_REPORTING_PARAMETERS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_path_loss_reporting_enable
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param enable
+ * @return size of HCI Command packet
+ * @note: format H1
+ */
+static inline uint16_t hci_cmd_encode_le_set_path_loss_reporting_enable(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_PATH_LOSS_REPORTING_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_PATH_LOSS_REPORTING_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_set_transmit_power_reporting_enable
+ * @param hci_cmd_buffer
+ * @param connection_handle
+ * @param local_enable
+ * @param remote_enable
+ * @return size of HCI Command packet
+ * @note: format H11
+ */
+static inline uint16_t hci_cmd_encode_le_set_transmit_power_reporting_enable(uint8_t * hci_cmd_buffer, hci_con_handle_t connection_handle, uint8_t local_enable, uint8_t remote_enable){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) connection_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (connection_handle >> 8);
+    hci_cmd_buffer[pos++] = local_enable;
+    hci_cmd_buffer[pos++] = remote_enable;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_LE_SET_TRANSMIT_POWER_REPORTING_ENABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_LE_SET_TRANSMIT_POWER_REPORTING_ENABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_le_transmitter_test_v4
+ * @note: format 111111a[1]1 not supported
+ */
+//  static inline uint16_t hci_cmd_encode_le_transmitter_test_v4(uint8_t * hci_cmd_buffer, ...){
+//      not implemented yet
+//  }
+
+/**
+ * @brief Encode hci_bcm_enable_wbs
+ * @param hci_cmd_buffer
+ * @param enable_wbs
+ * @param uuid_wbs
+ * @return size of HCI Command packet
+ * @note: format 12
+ */
+static inline uint16_t hci_cmd_encode_bcm_enable_wbs(uint8_t * hci_cmd_buffer, uint8_t enable_wbs, uint16_t uuid_wbs){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = enable_wbs;
+    hci_cmd_buffer[pos++] = (uint8_t) uuid_wbs;
+    hci_cmd_buffer[pos++] = (uint8_t) (uuid_wbs >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_BCM_ENABLE_WBS;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_BCM_ENABLE_WBS >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_bcm_write_sco_pcm_int
+ * @param hci_cmd_buffer
+ * @param sco_routing
+ * @param pcm_interface_rate
+ * @param frame_type
+ * @param sync_mode
+ * @param clock_mode
+ * @return size of HCI Command packet
+ * @note: format 11111
+ */
+static inline uint16_t hci_cmd_encode_bcm_write_sco_pcm_int(uint8_t * hci_cmd_buffer, uint8_t sco_routing, uint8_t pcm_interface_rate, uint8_t frame_type, uint8_t sync_mode, uint8_t clock_mode){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = sco_routing;
+    hci_cmd_buffer[pos++] = pcm_interface_rate;
+    hci_cmd_buffer[pos++] = frame_type;
+    hci_cmd_buffer[pos++] = sync_mode;
+    hci_cmd_buffer[pos++] = clock_mode;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_BCM_WRITE_SCO_PCM_INT;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_BCM_WRITE_SCO_PCM_INT >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_bcm_write_i2spcm_interface_param
+ * @param hci_cmd_buffer
+ * @param i2s_enable
+ * @param is_master
+ * @param sample_rate
+ * @param clock_rate
+ * @return size of HCI Command packet
+ * @note: format 1111
+ */
+static inline uint16_t hci_cmd_encode_bcm_write_i2spcm_interface_param(uint8_t * hci_cmd_buffer, uint8_t i2s_enable, uint8_t is_master, uint8_t sample_rate, uint8_t clock_rate){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = i2s_enable;
+    hci_cmd_buffer[pos++] = is_master;
+    hci_cmd_buffer[pos++] = sample_rate;
+    hci_cmd_buffer[pos++] = clock_rate;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_BCM_WRITE_I2SPCM_INTERFACE_PARAM;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_BCM_WRITE_I2SPCM_INTERFACE_PARAM >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_bcm_set_sleep_mode
+ * @param hci_cmd_buffer
+ * @param sleep_mode
+ * @param idle_threshold_host
+ * @param idle_threshold_controller
+ * @param bt_wake_active_mode
+ * @param host_wake_active_mode
+ * @param allow_host_sleep_during_sco
+ * @param combine_sleep_mode_and_lpm
+ * @param enable_tristate_control_of_uart_tx_line
+ * @param active_connection_handling_on_suspend
+ * @param resume_timeout
+ * @param enable_break_to_host
+ * @param pulsed_host_wake
+ * @return size of HCI Command packet
+ * @note: format 111111111111
+ */
+static inline uint16_t hci_cmd_encode_bcm_set_sleep_mode(uint8_t * hci_cmd_buffer, uint8_t sleep_mode, uint8_t idle_threshold_host, uint8_t idle_threshold_controller, uint8_t bt_wake_active_mode, uint8_t host_wake_active_mode, uint8_t allow_host_sleep_during_sco, uint8_t combine_sleep_mode_and_lpm, uint8_t enable_tristate_control_of_uart_tx_line, uint8_t active_connection_handling_on_suspend, uint8_t resume_timeout, uint8_t enable_break_to_host, uint8_t pulsed_host_wake){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = sleep_mode;
+    hci_cmd_buffer[pos++] = idle_threshold_host;
+    hci_cmd_buffer[pos++] = idle_threshold_controller;
+    hci_cmd_buffer[pos++] = bt_wake_active_mode;
+    hci_cmd_buffer[pos++] = host_wake_active_mode;
+    hci_cmd_buffer[pos++] = allow_host_sleep_during_sco;
+    hci_cmd_buffer[pos++] = combine_sleep_mode_and_lpm;
+    hci_cmd_buffer[pos++] = enable_tristate_control_of_uart_tx_line;
+    hci_cmd_buffer[pos++] = active_connection_handling_on_suspend;
+    hci_cmd_buffer[pos++] = resume_timeout;
+    hci_cmd_buffer[pos++] = enable_break_to_host;
+    hci_cmd_buffer[pos++] = pulsed_host_wake;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_BCM_SET_SLEEP_MODE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_BCM_SET_SLEEP_MODE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_bcm_write_tx_power_table
+ * @param hci_cmd_buffer
+ * @param is_le
+ * @param chip_max_tx_pwr_db
+ * @return size of HCI Command packet
+ * @note: format 11
+ */
+static inline uint16_t hci_cmd_encode_bcm_write_tx_power_table(uint8_t * hci_cmd_buffer, uint8_t is_le, uint8_t chip_max_tx_pwr_db){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = is_le;
+    hci_cmd_buffer[pos++] = chip_max_tx_pwr_db;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_BCM_WRITE_TX_POWER_TABLE;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_BCM_WRITE_TX_POWER_TABLE >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_bcm_set_tx_pwr
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @param param_2
+ * @return size of HCI Command packet
+ * @note: format 11H
+ */
+static inline uint16_t hci_cmd_encode_bcm_set_tx_pwr(uint8_t * hci_cmd_buffer, uint8_t param_0, uint8_t param_1, hci_con_handle_t param_2){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = param_0;
+    hci_cmd_buffer[pos++] = param_1;
+    hci_cmd_buffer[pos++] = (uint8_t) param_2;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_2 >> 8);
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_BCM_SET_TX_PWR;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_BCM_SET_TX_PWR >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_ti_drpb_tester_con_rx
+ * @param hci_cmd_buffer
+ * @param frequency
+ * @param adpll
+ * @return size of HCI Command packet
+ * @note: format 11
+ */
+static inline uint16_t hci_cmd_encode_ti_drpb_tester_con_rx(uint8_t * hci_cmd_buffer, uint8_t frequency, uint8_t adpll){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = frequency;
+    hci_cmd_buffer[pos++] = adpll;
+    hci_cmd_buffer[0] = (uint8_t) 0xFD17;
+    hci_cmd_buffer[1] = (uint8_t) (0xFD17 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_ti_drpb_tester_con_tx
+ * @param hci_cmd_buffer
+ * @param modulation
+ * @param test_pattern
+ * @param frequency
+ * @param power_level
+ * @param reserved1
+ * @param reserved2
+ * @return size of HCI Command packet
+ * @note: format 111144
+ */
+static inline uint16_t hci_cmd_encode_ti_drpb_tester_con_tx(uint8_t * hci_cmd_buffer, uint8_t modulation, uint8_t test_pattern, uint8_t frequency, uint8_t power_level, uint32_t reserved1, uint32_t reserved2){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = modulation;
+    hci_cmd_buffer[pos++] = test_pattern;
+    hci_cmd_buffer[pos++] = frequency;
+    hci_cmd_buffer[pos++] = power_level;
+    hci_cmd_buffer[pos++] = (uint8_t) reserved1;
+    hci_cmd_buffer[pos++] = (uint8_t) (reserved1 >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (reserved1 >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (reserved1 >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) reserved2;
+    hci_cmd_buffer[pos++] = (uint8_t) (reserved2 >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (reserved2 >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (reserved2 >> 24);
+    hci_cmd_buffer[0] = (uint8_t) 0xFD84;
+    hci_cmd_buffer[1] = (uint8_t) (0xFD84 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_ti_drpb_tester_packet_tx_rx
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @param param_2
+ * @param param_3
+ * @param param_4
+ * @param param_5
+ * @param param_6
+ * @param param_7
+ * @param param_8
+ * @param param_9
+ * @return size of HCI Command packet
+ * @note: format 1111112112
+ */
+static inline uint16_t hci_cmd_encode_ti_drpb_tester_packet_tx_rx(uint8_t * hci_cmd_buffer, uint8_t param_0, uint8_t param_1, uint8_t param_2, uint8_t param_3, uint8_t param_4, uint8_t param_5, uint16_t param_6, uint8_t param_7, uint8_t param_8, uint16_t param_9){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = param_0;
+    hci_cmd_buffer[pos++] = param_1;
+    hci_cmd_buffer[pos++] = param_2;
+    hci_cmd_buffer[pos++] = param_3;
+    hci_cmd_buffer[pos++] = param_4;
+    hci_cmd_buffer[pos++] = param_5;
+    hci_cmd_buffer[pos++] = (uint8_t) param_6;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_6 >> 8);
+    hci_cmd_buffer[pos++] = param_7;
+    hci_cmd_buffer[pos++] = param_8;
+    hci_cmd_buffer[pos++] = (uint8_t) param_9;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_9 >> 8);
+    hci_cmd_buffer[0] = (uint8_t) 0xFD85;
+    hci_cmd_buffer[1] = (uint8_t) (0xFD85 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_ti_configure_ddip
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @param param_2
+ * @param param_3
+ * @param param_4
+ * @param param_5
+ * @param param_6
+ * @return size of HCI Command packet
+ * @note: format 1111111
+ */
+static inline uint16_t hci_cmd_encode_ti_configure_ddip(uint8_t * hci_cmd_buffer, uint8_t param_0, uint8_t param_1, uint8_t param_2, uint8_t param_3, uint8_t param_4, uint8_t param_5, uint8_t param_6){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = param_0;
+    hci_cmd_buffer[pos++] = param_1;
+    hci_cmd_buffer[pos++] = param_2;
+    hci_cmd_buffer[pos++] = param_3;
+    hci_cmd_buffer[pos++] = param_4;
+    hci_cmd_buffer[pos++] = param_5;
+    hci_cmd_buffer[pos++] = param_6;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_TI_VS_CONFIGURE_DDIP;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_TI_VS_CONFIGURE_DDIP >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_ti_avrp_enable
+ * @param hci_cmd_buffer
+ * @param enable
+ * @param a3dp_role
+ * @param code_upload
+ * @param reserved
+ * @return size of HCI Command packet
+ * @note: format 1112
+ */
+static inline uint16_t hci_cmd_encode_ti_avrp_enable(uint8_t * hci_cmd_buffer, uint8_t enable, uint8_t a3dp_role, uint8_t code_upload, uint16_t reserved){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = enable;
+    hci_cmd_buffer[pos++] = a3dp_role;
+    hci_cmd_buffer[pos++] = code_upload;
+    hci_cmd_buffer[pos++] = (uint8_t) reserved;
+    hci_cmd_buffer[pos++] = (uint8_t) (reserved >> 8);
+    hci_cmd_buffer[0] = (uint8_t) 0xFD92;
+    hci_cmd_buffer[1] = (uint8_t) (0xFD92 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_ti_wbs_associate
+ * @param hci_cmd_buffer
+ * @param acl_con_handle
+ * @return size of HCI Command packet
+ * @note: format H
+ */
+static inline uint16_t hci_cmd_encode_ti_wbs_associate(uint8_t * hci_cmd_buffer, hci_con_handle_t acl_con_handle){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) acl_con_handle;
+    hci_cmd_buffer[pos++] = (uint8_t) (acl_con_handle >> 8);
+    hci_cmd_buffer[0] = (uint8_t) 0xFD78;
+    hci_cmd_buffer[1] = (uint8_t) (0xFD78 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_ti_wbs_disassociate
+ * @param hci_cmd_buffer
+ * @return size of HCI Command packet
+ * @note: format 
+ */
+static inline uint16_t hci_cmd_encode_ti_wbs_disassociate(uint8_t * hci_cmd_buffer){
+    uint16_t pos = 3;
+    hci_cmd_buffer[0] = (uint8_t) 0xFD79;
+    hci_cmd_buffer[1] = (uint8_t) (0xFD79 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_ti_write_codec_config
+ * @param hci_cmd_buffer
+ * @param clock_rate
+ * @param clock_direction
+ * @param frame_sync_frequency
+ * @param frame_sync_duty_cycle
+ * @param frame_sync_edge
+ * @param frame_sync_polariy
+ * @param reserved1
+ * @param channel_1_data_out_size
+ * @param channel_1_data_out_offset
+ * @param channel_1_data_out_edge
+ * @param channel_1_data_in_size
+ * @param channel_1_data_in_offset
+ * @param channel_1_data_in_edge
+ * @param fsync_multiplier
+ * @param channel_2_data_out_size
+ * @param channel_2_data_out_offset
+ * @param channel_2_data_out_edge
+ * @param channel_2_data_in_size
+ * @param channel_2_data_in_offset
+ * @param channel_2_data_in_edge
+ * @param reserved2
+ * @return size of HCI Command packet
+ * @note: format 214211122122112212211
+ */
+static inline uint16_t hci_cmd_encode_ti_write_codec_config(uint8_t * hci_cmd_buffer, uint16_t clock_rate, uint8_t clock_direction, uint32_t frame_sync_frequency, uint16_t frame_sync_duty_cycle, uint8_t frame_sync_edge, uint8_t frame_sync_polariy, uint8_t reserved1, uint16_t channel_1_data_out_size, uint16_t channel_1_data_out_offset, uint8_t channel_1_data_out_edge, uint16_t channel_1_data_in_size, uint16_t channel_1_data_in_offset, uint8_t channel_1_data_in_edge, uint8_t fsync_multiplier, uint16_t channel_2_data_out_size, uint16_t channel_2_data_out_offset, uint8_t channel_2_data_out_edge, uint16_t channel_2_data_in_size, uint16_t channel_2_data_in_offset, uint8_t channel_2_data_in_edge, uint8_t reserved2){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) clock_rate;
+    hci_cmd_buffer[pos++] = (uint8_t) (clock_rate >> 8);
+    hci_cmd_buffer[pos++] = clock_direction;
+    hci_cmd_buffer[pos++] = (uint8_t) frame_sync_frequency;
+    hci_cmd_buffer[pos++] = (uint8_t) (frame_sync_frequency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (frame_sync_frequency >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (frame_sync_frequency >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) frame_sync_duty_cycle;
+    hci_cmd_buffer[pos++] = (uint8_t) (frame_sync_duty_cycle >> 8);
+    hci_cmd_buffer[pos++] = frame_sync_edge;
+    hci_cmd_buffer[pos++] = frame_sync_polariy;
+    hci_cmd_buffer[pos++] = reserved1;
+    hci_cmd_buffer[pos++] = (uint8_t) channel_1_data_out_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_1_data_out_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) channel_1_data_out_offset;
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_1_data_out_offset >> 8);
+    hci_cmd_buffer[pos++] = channel_1_data_out_edge;
+    hci_cmd_buffer[pos++] = (uint8_t) channel_1_data_in_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_1_data_in_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) channel_1_data_in_offset;
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_1_data_in_offset >> 8);
+    hci_cmd_buffer[pos++] = channel_1_data_in_edge;
+    hci_cmd_buffer[pos++] = fsync_multiplier;
+    hci_cmd_buffer[pos++] = (uint8_t) channel_2_data_out_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_2_data_out_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) channel_2_data_out_offset;
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_2_data_out_offset >> 8);
+    hci_cmd_buffer[pos++] = channel_2_data_out_edge;
+    hci_cmd_buffer[pos++] = (uint8_t) channel_2_data_in_size;
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_2_data_in_size >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) channel_2_data_in_offset;
+    hci_cmd_buffer[pos++] = (uint8_t) (channel_2_data_in_offset >> 8);
+    hci_cmd_buffer[pos++] = channel_2_data_in_edge;
+    hci_cmd_buffer[pos++] = reserved2;
+    hci_cmd_buffer[0] = (uint8_t) 0xFD06;
+    hci_cmd_buffer[1] = (uint8_t) (0xFD06 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_ti_drpb_enable_rf_calibration
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @param param_2
+ * @return size of HCI Command packet
+ * @note: format 141
+ */
+static inline uint16_t hci_cmd_encode_ti_drpb_enable_rf_calibration(uint8_t * hci_cmd_buffer, uint8_t param_0, uint32_t param_1, uint8_t param_2){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = param_0;
+    hci_cmd_buffer[pos++] = (uint8_t) param_1;
+    hci_cmd_buffer[pos++] = (uint8_t) (param_1 >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (param_1 >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (param_1 >> 24);
+    hci_cmd_buffer[pos++] = param_2;
+    hci_cmd_buffer[0] = (uint8_t) 0xFD80;
+    hci_cmd_buffer[1] = (uint8_t) (0xFD80 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_ti_write_hardware_register
+ * @param hci_cmd_buffer
+ * @param frequency
+ * @param adpll
+ * @return size of HCI Command packet
+ * @note: format 42
+ */
+static inline uint16_t hci_cmd_encode_ti_write_hardware_register(uint8_t * hci_cmd_buffer, uint32_t frequency, uint16_t adpll){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = (uint8_t) frequency;
+    hci_cmd_buffer[pos++] = (uint8_t) (frequency >> 8);
+    hci_cmd_buffer[pos++] = (uint8_t) (frequency >> 16);
+    hci_cmd_buffer[pos++] = (uint8_t) (frequency >> 24);
+    hci_cmd_buffer[pos++] = (uint8_t) adpll;
+    hci_cmd_buffer[pos++] = (uint8_t) (adpll >> 8);
+    hci_cmd_buffer[0] = (uint8_t) 0xFF01;
+    hci_cmd_buffer[1] = (uint8_t) (0xFF01 >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_rtk_configure_sco_routing
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @param param_2
+ * @param param_3
+ * @param param_4
+ * @param param_5
+ * @param param_6
+ * @param param_7
+ * @param param_8
+ * @return size of HCI Command packet
+ * @note: format 111111111
+ */
+static inline uint16_t hci_cmd_encode_rtk_configure_sco_routing(uint8_t * hci_cmd_buffer, uint8_t param_0, uint8_t param_1, uint8_t param_2, uint8_t param_3, uint8_t param_4, uint8_t param_5, uint8_t param_6, uint8_t param_7, uint8_t param_8){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = param_0;
+    hci_cmd_buffer[pos++] = param_1;
+    hci_cmd_buffer[pos++] = param_2;
+    hci_cmd_buffer[pos++] = param_3;
+    hci_cmd_buffer[pos++] = param_4;
+    hci_cmd_buffer[pos++] = param_5;
+    hci_cmd_buffer[pos++] = param_6;
+    hci_cmd_buffer[pos++] = param_7;
+    hci_cmd_buffer[pos++] = param_8;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_RTK_CONFIGURE_SCO_ROUTING;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_RTK_CONFIGURE_SCO_ROUTING >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+/**
+ * @brief Encode hci_rtk_read_card_info
+ * @param hci_cmd_buffer
+ * @param param_0
+ * @param param_1
+ * @param param_2
+ * @param param_3
+ * @param param_4
+ * @return size of HCI Command packet
+ * @note: format 11111
+ */
+static inline uint16_t hci_cmd_encode_rtk_read_card_info(uint8_t * hci_cmd_buffer, uint8_t param_0, uint8_t param_1, uint8_t param_2, uint8_t param_3, uint8_t param_4){
+    uint16_t pos = 3;
+    hci_cmd_buffer[pos++] = param_0;
+    hci_cmd_buffer[pos++] = param_1;
+    hci_cmd_buffer[pos++] = param_2;
+    hci_cmd_buffer[pos++] = param_3;
+    hci_cmd_buffer[pos++] = param_4;
+    hci_cmd_buffer[0] = (uint8_t) HCI_OPCODE_HCI_RTK_READ_CARD_INFO;
+    hci_cmd_buffer[1] = (uint8_t) (HCI_OPCODE_HCI_RTK_READ_CARD_INFO >> 8);
+    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);
+    return pos;
+}
+
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // HCI_CMD_ENCODER_H
@@ -622,7 +622,7 @@ static void l2cap_ertm_setup_buffers(l2cap_channel_t * channel, uint8_t * buffer
 
     // setup tx buffers
     channel->tx_packets_data = &buffer[pos];
-    pos += channel->num_rx_buffers * channel->remote_mps;
+    pos += channel->num_tx_buffers * channel->remote_mps;
 
     btstack_assert(pos <= size);
     UNUSED(pos);
@@ -50,8 +50,41 @@
 static btstack_linked_list_t network_keys;
 static uint8_t mesh_network_key_used[MAX_NR_MESH_NETWORK_KEYS];
 
+// network keys indexed by nid to avoid checking all keys for incoming network pdus
+#define MESH_NETWORK_KEY_NID_BUCKETS 8
+static mesh_network_key_t * network_keys_by_nid[MESH_NETWORK_KEY_NID_BUCKETS];
+
+static mesh_network_key_t ** mesh_network_key_nid_bucket(uint8_t nid){
+    return &network_keys_by_nid[nid & (MESH_NETWORK_KEY_NID_BUCKETS - 1)];
+}
+
+static void mesh_network_key_nid_index_remove(const mesh_network_key_t * network_key){
+    // key might have been modified since it was added, check all buckets
+    uint8_t i;
+    for (i = 0; i < MESH_NETWORK_KEY_NID_BUCKETS; i++){
+        mesh_network_key_t ** it;
+        for (it = &network_keys_by_nid[i]; *it != NULL; it = &(*it)->nid_next){
+            if (*it == network_key){
+                *it = network_key->nid_next;
+                return;
+            }
+        }
+    }
+}
+
+static void mesh_network_key_nid_index_add(mesh_network_key_t * network_key){
+    // append to keep order of network key list
+    mesh_network_key_t ** it = mesh_network_key_nid_bucket(network_key->nid);
+    while (*it != NULL){
+        it = &(*it)->nid_next;
+    }
+    network_key->nid_next = NULL;
+    *it = network_key;
+}
+
 void mesh_network_key_init(void){
     network_keys = NULL;
+    memset(network_keys_by_nid, 0, sizeof(network_keys_by_nid));
 }
 
 uint16_t mesh_network_key_get_free_index(void){
@@ -66,11 +99,14 @@ uint16_t mesh_network_key_get_free_index(void){
 
 void mesh_network_key_add(mesh_network_key_t * network_key){
     mesh_network_key_used[network_key->internal_index] = 1;
+    mesh_network_key_nid_index_remove(network_key);
+    mesh_network_key_nid_index_add(network_key);
     btstack_linked_list_add_tail(&network_keys, (btstack_linked_item_t *) network_key);
 }
 
 bool mesh_network_key_remove(mesh_network_key_t * network_key){
     mesh_network_key_used[network_key->internal_index] = 0;
+    mesh_network_key_nid_index_remove(network_key);
     return btstack_linked_list_remove(&network_keys, (btstack_linked_item_t *) network_key);
 }
 
@@ -103,17 +139,18 @@ mesh_network_key_t * mesh_network_key_iterator_get_next(mesh_network_key_iterato
 
 // mesh network key iterator for a given nid
 void mesh_network_key_nid_iterator_init(mesh_network_key_iterator_t *it, uint8_t nid){
-    btstack_linked_list_iterator_init(&it->it, &network_keys);
     it->key = NULL;
+    it->nid_next = *mesh_network_key_nid_bucket(nid);
     it->nid = nid;
 }
 
 int mesh_network_key_nid_iterator_has_more(mesh_network_key_iterator_t *it){
-    // find next matching key
+    // find next matching key in bucket
     while (true){
         if (it->key && it->key->nid == it->nid) return 1;
-        if (!btstack_linked_list_iterator_has_next(&it->it)) break;
-        it->key = (mesh_network_key_t *) btstack_linked_list_iterator_next(&it->it);
+        if (it->nid_next == NULL) break;
+        it->key = it->nid_next;
+        it->nid_next = it->key->nid_next;
     }
     return 0;
 }
@@ -124,6 +161,21 @@ mesh_network_key_t * mesh_network_key_nid_iterator_get_next(mesh_network_key_ite
     return key;
 }
 
+void mesh_network_key_nid_set_last_used(mesh_network_key_t * network_key){
+    // move to front of bucket
+    mesh_network_key_t ** bucket = mesh_network_key_nid_bucket(network_key->nid);
+    if (*bucket == network_key) return;
+    mesh_network_key_t ** it;
+    for (it = bucket; *it != NULL; it = &(*it)->nid_next){
+        if (*it == network_key){
+            *it = network_key->nid_next;
+            network_key->nid_next = *bucket;
+            *bucket = network_key;
+            return;
+        }
+    }
+}
+
 
 // application key list
 
@@ -133,6 +185,38 @@ static btstack_linked_list_t  application_keys;
 
 static uint8_t mesh_transport_key_used[MAX_NR_MESH_TRANSPORT_KEYS];
 
+// application keys indexed by (netkey_index, aid) to avoid checking all keys for incoming messages
+#define MESH_TRANSPORT_KEY_AID_BUCKETS 16
+static mesh_transport_key_t * application_keys_by_aid[MESH_TRANSPORT_KEY_AID_BUCKETS];
+
+static mesh_transport_key_t ** mesh_transport_key_aid_bucket(uint16_t netkey_index, uint8_t aid){
+    return &application_keys_by_aid[(netkey_index ^ aid) & (MESH_TRANSPORT_KEY_AID_BUCKETS - 1)];
+}
+
+static void mesh_transport_key_aid_index_remove(const mesh_transport_key_t * transport_key){
+    // key might have been modified since it was added, check all buckets
+    uint8_t i;
+    for (i = 0; i < MESH_TRANSPORT_KEY_AID_BUCKETS; i++){
+        mesh_transport_key_t ** it;
+        for (it = &application_keys_by_aid[i]; *it != NULL; it = &(*it)->aid_next){
+            if (*it == transport_key){
+                *it = transport_key->aid_next;
+                return;
+            }
+        }
+    }
+}
+
+static void mesh_transport_key_aid_index_add(mesh_transport_key_t * transport_key){
+    // append to keep order of application key list
+    mesh_transport_key_t ** it = mesh_transport_key_aid_bucket(transport_key->netkey_index, transport_key->aid);
+    while (*it != NULL){
+        it = &(*it)->aid_next;
+    }
+    transport_key->aid_next = NULL;
+    *it = transport_key;
+}
+
 void mesh_transport_set_device_key(const uint8_t * device_key){
     mesh_transport_device_key.appkey_index = MESH_DEVICE_KEY_INDEX;
     mesh_transport_device_key.aid   = 0;
@@ -158,11 +242,14 @@ uint16_t mesh_transport_key_get_free_index(void){
 
 void mesh_transport_key_add(mesh_transport_key_t * transport_key){
     mesh_transport_key_used[transport_key->internal_index] = 1;
+    mesh_transport_key_aid_index_remove(transport_key);
+    mesh_transport_key_aid_index_add(transport_key);
     btstack_linked_list_add_tail(&application_keys, (btstack_linked_item_t *) transport_key);
 }
 
 bool mesh_transport_key_remove(mesh_transport_key_t * transport_key){
     mesh_transport_key_used[transport_key->internal_index] = 0;
+    mesh_transport_key_aid_index_remove(transport_key);
     return btstack_linked_list_remove(&application_keys, (btstack_linked_item_t *) transport_key);
 }
 
@@ -204,14 +291,15 @@ mesh_transport_key_t * mesh_transport_key_iterator_get_next(mesh_transport_key_i
 
 void
 mesh_transport_key_aid_iterator_init(mesh_transport_key_iterator_t *it, uint16_t netkey_index, uint8_t akf, uint8_t aid) {
-    btstack_linked_list_iterator_init(&it->it, &application_keys);
     it->netkey_index = netkey_index;
     it->aid      = aid;
     it->akf      = akf;
     if (it->akf){
         it->key = NULL;
+        it->aid_next = *mesh_transport_key_aid_bucket(netkey_index, aid);
     } else {
         it->key = &mesh_transport_device_key;
+        it->aid_next = NULL;
     }
 }
 
@@ -219,11 +307,12 @@ int mesh_transport_key_aid_iterator_has_more(mesh_transport_key_iterator_t *it){
     if (it->akf == 0){
         return it->key != NULL;
     }
-    // find next matching key
+    // find next matching key in bucket
     while (true){
         if (it->key && it->key->aid == it->aid && it->key->netkey_index == it->netkey_index) return 1;
-        if (!btstack_linked_list_iterator_has_next(&it->it)) break;
-        it->key = (mesh_transport_key_t *) btstack_linked_list_iterator_next(&it->it);
+        if (it->aid_next == NULL) break;
+        it->key = it->aid_next;
+        it->aid_next = it->key->aid_next;
     }
     return 0;
 }
@@ -51,9 +51,12 @@ extern "C"
 
 #define MESH_KEYS_INVALID_INDEX 0xffff
 
-typedef struct {
+typedef struct mesh_network_key {
     btstack_linked_item_t item;
 
+    // next key in NID bucket
+    struct mesh_network_key * nid_next;
+
     // internal index [0..MAX_NR_MESH_NETWORK_KEYS-1]
     uint16_t internal_index;
 
@@ -85,12 +88,17 @@ typedef struct {
 typedef struct {
     btstack_linked_list_iterator_t it;
     mesh_network_key_t * key;
+    // next candidate for nid iterator
+    mesh_network_key_t * nid_next;
     uint8_t nid;
 } mesh_network_key_iterator_t;
 
-typedef struct {
+typedef struct mesh_transport_key {
     btstack_linked_item_t item;
 
+    // next key in (netkey_index, aid) bucket
+    struct mesh_transport_key * aid_next;
+
     // internal index [0..MAX_NR_MESH_TRANSPORT_KEYS-1]
     uint16_t internal_index;
 
@@ -123,6 +131,8 @@ typedef struct {
 typedef struct {
     btstack_linked_list_iterator_t it;
     mesh_transport_key_t * key;
+    // next candidate for aid iterator
+    mesh_transport_key_t * aid_next;
     uint16_t netkey_index;
     uint8_t  akf;
     uint8_t  aid;
@@ -209,6 +219,12 @@ int mesh_network_key_nid_iterator_has_more(mesh_network_key_iterator_t *it);
  */
 mesh_network_key_t * mesh_network_key_nid_iterator_get_next(mesh_network_key_iterator_t *it);
 
+/**
+ * @brief Mark network_key as last one that matched a Network PDU, it is returned first by NID iterator
+ * @param network_key
+ */
+void mesh_network_key_nid_set_last_used(mesh_network_key_t * network_key);
+
 /**
  * Transport Keys = Application Keys + Device Key
  */
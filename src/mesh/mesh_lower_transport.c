@@ -55,34 +55,32 @@
 
 #define LOG_LOWER_TRANSPORT
 
+// max number of segments of outgoing segmented messages queued at network layer
+#ifndef MESH_LOWER_TRANSPORT_SEGMENT_WINDOW
+#define MESH_LOWER_TRANSPORT_SEGMENT_WINDOW 2
+#endif
+
 // prototypes
 static void mesh_lower_transport_run(void);
 static void mesh_lower_transport_outgoing_complete(mesh_segmented_pdu_t * segmented_pdu, mesh_transport_status_t status);
+static void mesh_lower_transport_outgoing_stop_acknowledgment_timer(mesh_segmented_pdu_t *segmented_pdu);
 static void mesh_lower_transport_outgoing_segment_transmission_timeout(btstack_timer_source_t * ts);
 
 
 // lower transport outgoing state
 
 // queued mesh_segmented_pdu_t or mesh_network_pdu_t
+// - mesh_segmented_pdu_t with segments left to send are queued again after each segment to interleave messages
 static btstack_linked_list_t lower_transport_outgoing_ready;
 
 // mesh_segmented_pdu_t to unicast address, segment transmission timer is active
+// or mesh_segmented_pdu_t completed/aborted while segments are still queued at network layer
 static btstack_linked_list_t lower_transport_outgoing_waiting;
 
-// active outgoing segmented message
-static mesh_segmented_pdu_t * lower_transport_outgoing_message;
-// index of outgoing segment
-static uint16_t               lower_transport_outgoing_seg_o;
-// network pdu with outgoing segment
-static mesh_network_pdu_t   * lower_transport_outgoing_segment;
-// segment currently queued at network layer (only valid for lower_transport_outgoing_message)
-static bool                    lower_transport_outgoing_segment_at_network_layer;
-// transmission timeout occurred (while outgoing segment queued at network layer)
-static bool                    lower_transport_outgoing_transmission_timeout;
-// transmission completed fully ack'ed (while outgoing segment queued at network layer)
-static bool                    lower_transport_outgoing_transmission_complete;
-// transmission aborted by remote (while outgoing segment queued at network layer)
-static bool                    lower_transport_outgoing_transmission_aborted;
+// network pdus for outgoing segments, allocated on demand
+static mesh_network_pdu_t   * lower_transport_outgoing_segments[MESH_LOWER_TRANSPORT_SEGMENT_WINDOW];
+// segmented message of network pdu while queued at network layer, NULL if unused
+static mesh_segmented_pdu_t * lower_transport_outgoing_segment_messages[MESH_LOWER_TRANSPORT_SEGMENT_WINDOW];
 
 // active outgoing unsegmented message
 static mesh_network_pdu_t *   lower_transport_outgoing_network_pdu;
@@ -467,11 +465,15 @@ void mesh_lower_transport_message_processed_by_higher_layer(mesh_pdu_t * pdu){
 
 // OUTGOING //
 
-static void mesh_lower_transport_outgoing_setup_block_ack(mesh_segmented_pdu_t *message_pdu){
-    // setup block ack - set bit for segment to send, will be cleared on ack
+static uint8_t mesh_lower_transport_outgoing_seg_n(const mesh_segmented_pdu_t *message_pdu){
     int      ctl = message_pdu->ctl_ttl >> 7;
     uint16_t max_segment_len = ctl ? 8 : 12;    // control 8 bytes (64 bit NetMic), access 12 bytes (32 bit NetMIC)
-    uint8_t  seg_n = (message_pdu->len - 1) / max_segment_len;
+    return (message_pdu->len - 1) / max_segment_len;
+}
+
+static void mesh_lower_transport_outgoing_setup_block_ack(mesh_segmented_pdu_t *message_pdu){
+    // setup block ack - set bit for segment to send, will be cleared on ack
+    uint8_t  seg_n = mesh_lower_transport_outgoing_seg_n(message_pdu);
     if (seg_n < 31){
         message_pdu->block_ack = (1 << (seg_n+1)) - 1;
     } else {
@@ -479,20 +481,54 @@ static void mesh_lower_transport_outgoing_setup_block_ack(mesh_segmented_pdu_t *
     }
 }
 
-static mesh_segmented_pdu_t * mesh_lower_transport_outgoing_message_for_dst(uint16_t dst){
-    if (lower_transport_outgoing_message != NULL && lower_transport_outgoing_message->dst == dst){
-        return lower_transport_outgoing_message;
+static mesh_segmented_pdu_t * mesh_lower_transport_outgoing_message_in_list_for_dst(btstack_linked_list_t * list, uint16_t dst){
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, list);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        mesh_pdu_t * pdu = (mesh_pdu_t *) btstack_linked_list_iterator_next(&it);
+        if (pdu->pdu_type != MESH_PDU_TYPE_SEGMENTED) continue;
+        mesh_segmented_pdu_t * segmented_pdu = (mesh_segmented_pdu_t *) pdu;
+        if (segmented_pdu->dst != dst) continue;
+        // ignore messages that are already complete or aborted
+        if ((segmented_pdu->flags & (MESH_TRANSPORT_FLAG_SEND_COMPLETE | MESH_TRANSPORT_FLAG_SEND_ABORTED)) != 0) continue;
+        return segmented_pdu;
     }
     return NULL;
 }
 
+static mesh_segmented_pdu_t * mesh_lower_transport_outgoing_message_for_dst(uint16_t dst){
+    mesh_segmented_pdu_t * segmented_pdu = mesh_lower_transport_outgoing_message_in_list_for_dst(&lower_transport_outgoing_ready, dst);
+    if (segmented_pdu != NULL){
+        return segmented_pdu;
+    }
+    return mesh_lower_transport_outgoing_message_in_list_for_dst(&lower_transport_outgoing_waiting, dst);
+}
+
+static void mesh_lower_transport_outgoing_finish(mesh_segmented_pdu_t * segmented_pdu, mesh_transport_status_t status){
+    if (segmented_pdu->segments_at_network_layer == 0){
+        mesh_lower_transport_outgoing_complete(segmented_pdu, status);
+        return;
+    }
+    // stop sending and wait until network layer is done with all segments
+    mesh_lower_transport_outgoing_stop_acknowledgment_timer(segmented_pdu);
+    btstack_linked_list_remove(&lower_transport_outgoing_ready, (btstack_linked_item_t *) segmented_pdu);
+    btstack_linked_list_remove(&lower_transport_outgoing_waiting, (btstack_linked_item_t *) segmented_pdu);
+    btstack_linked_list_add(&lower_transport_outgoing_waiting, (btstack_linked_item_t *) segmented_pdu);
+    segmented_pdu->flags &= ~MESH_TRANSPORT_FLAG_SEND_TIMEOUT;
+    if (status == MESH_TRANSPORT_STATUS_SUCCESS){
+        segmented_pdu->flags |= MESH_TRANSPORT_FLAG_SEND_COMPLETE;
+    } else {
+        segmented_pdu->flags |= MESH_TRANSPORT_FLAG_SEND_ABORTED;
+    }
+}
+
 static void mesh_lower_transport_outgoing_process_segment_acknowledgement_message(mesh_network_pdu_t *network_pdu){
     mesh_segmented_pdu_t * segmented_pdu = mesh_lower_transport_outgoing_message_for_dst( mesh_network_src(network_pdu));
     if (segmented_pdu == NULL) return;
 
     uint8_t * lower_transport_pdu     = mesh_network_pdu_data(network_pdu);
     uint16_t seq_zero_pdu = big_endian_read_16(lower_transport_pdu, 1) >> 2;
-    uint16_t seq_zero_out = lower_transport_outgoing_message->seq & 0x1fff;
+    uint16_t seq_zero_out = segmented_pdu->seq & 0x1fff;
     uint32_t block_ack = big_endian_read_32(lower_transport_pdu, 3);
 
 #ifdef LOG_LOWER_TRANSPORT
@@ -507,12 +543,7 @@ static void mesh_lower_transport_outgoing_process_segment_acknowledgement_messag
 #ifdef LOG_LOWER_TRANSPORT
         printf("[+] Block Ack == 0 => Abort\n");
 #endif
-        // current?
-        if ((lower_transport_outgoing_message == segmented_pdu) && lower_transport_outgoing_segment_at_network_layer){
-            lower_transport_outgoing_transmission_aborted = true;
-        } else {
-            mesh_lower_transport_outgoing_complete(segmented_pdu, MESH_TRANSPORT_STATUS_SEND_ABORT_BY_REMOTE);
-        }
+        mesh_lower_transport_outgoing_finish(segmented_pdu, MESH_TRANSPORT_STATUS_SEND_ABORT_BY_REMOTE);
         return;
     }
     if (seq_zero_pdu != seq_zero_out){
@@ -532,12 +563,7 @@ static void mesh_lower_transport_outgoing_process_segment_acknowledgement_messag
 #ifdef LOG_LOWER_TRANSPORT
         printf("[+] Sent complete\n");
 #endif
-
-        if ((lower_transport_outgoing_message == segmented_pdu) && lower_transport_outgoing_segment_at_network_layer){
-            lower_transport_outgoing_transmission_complete = true;
-        } else {
-            mesh_lower_transport_outgoing_complete(segmented_pdu, MESH_TRANSPORT_STATUS_SUCCESS);
-        }
+        mesh_lower_transport_outgoing_finish(segmented_pdu, MESH_TRANSPORT_STATUS_SUCCESS);
     }
 }
 
@@ -552,8 +578,9 @@ static void mesh_lower_transport_outgoing_restart_segment_transmission_timer(mes
     // - "This timer shall be set to a minimum of 200 + 50 * TTL milliseconds."
     uint32_t timeout = 200 + 50 * (segmented_pdu->ctl_ttl & 0x7f);
     if ((segmented_pdu->flags & MESH_TRANSPORT_FLAG_ACK_TIMER) != 0){
-        btstack_run_loop_remove_timer(&lower_transport_outgoing_message->acknowledgement_timer);
+        btstack_run_loop_remove_timer(&segmented_pdu->acknowledgement_timer);
     }
+    segmented_pdu->flags &= ~MESH_TRANSPORT_FLAG_SEND_TIMEOUT;
 
 #ifdef LOG_LOWER_TRANSPORT
     printf("[+] Lower transport, segmented pdu %p, seq %06" PRIx32 ": setup transmission timeout %u ms\n", segmented_pdu,
@@ -562,27 +589,25 @@ static void mesh_lower_transport_outgoing_restart_segment_transmission_timer(mes
 
     btstack_run_loop_set_timer(&segmented_pdu->acknowledgement_timer, timeout);
     btstack_run_loop_set_timer_handler(&segmented_pdu->acknowledgement_timer, &mesh_lower_transport_outgoing_segment_transmission_timeout);
-    btstack_run_loop_set_timer_context(&segmented_pdu->acknowledgement_timer, lower_transport_outgoing_message);
+    btstack_run_loop_set_timer_context(&segmented_pdu->acknowledgement_timer, segmented_pdu);
     btstack_run_loop_add_timer(&segmented_pdu->acknowledgement_timer);
     segmented_pdu->flags |= MESH_TRANSPORT_FLAG_ACK_TIMER;
 }
 
 static void mesh_lower_transport_outgoing_complete(mesh_segmented_pdu_t * segmented_pdu, mesh_transport_status_t status){
     btstack_assert(segmented_pdu != NULL);
+    btstack_assert(segmented_pdu->segments_at_network_layer == 0);
 #ifdef LOG_LOWER_TRANSPORT
     printf("[+] outgoing_complete %p, ack timer active %u, incomplete active %u\n", segmented_pdu,
            ((segmented_pdu->flags & MESH_TRANSPORT_FLAG_ACK_TIMER) != 0), ((segmented_pdu->flags & MESH_TRANSPORT_FLAG_INCOMPLETE_TIMER) != 0));
 #endif
     // stop timers
     mesh_lower_transport_outgoing_stop_acknowledgment_timer(segmented_pdu);
+    segmented_pdu->flags &= ~(MESH_TRANSPORT_FLAG_SEND_COMPLETE | MESH_TRANSPORT_FLAG_SEND_ABORTED | MESH_TRANSPORT_FLAG_SEND_TIMEOUT);
 
     // remove from lists
-    if (lower_transport_outgoing_message == segmented_pdu){
-        lower_transport_outgoing_message = NULL;
-    } else {
-        btstack_linked_list_remove(&lower_transport_outgoing_waiting, (btstack_linked_item_t *) segmented_pdu);
-        btstack_linked_list_remove(&lower_transport_outgoing_ready, (btstack_linked_item_t *) segmented_pdu);
-    }
+    btstack_linked_list_remove(&lower_transport_outgoing_waiting, (btstack_linked_item_t *) segmented_pdu);
+    btstack_linked_list_remove(&lower_transport_outgoing_ready, (btstack_linked_item_t *) segmented_pdu);
 
     // notify upper transport
     higher_layer_handler(MESH_TRANSPORT_PDU_SENT, status, (mesh_pdu_t *) segmented_pdu);
@@ -623,7 +648,7 @@ static void mesh_lower_transport_outgoing_setup_segment(mesh_segmented_pdu_t *me
     uint16_t lower_transport_pdu_len = 4 + segment_len;
 
     // find network-pdu with chunk for seg_offset
-    mesh_network_pdu_t * chunk = (mesh_network_pdu_t *) lower_transport_outgoing_message->segments;
+    mesh_network_pdu_t * chunk = (mesh_network_pdu_t *) message_pdu->segments;
     uint16_t chunk_start = 0;
     while ((chunk_start + MESH_NETWORK_PAYLOAD_MAX) <= seg_offset){
         chunk = (mesh_network_pdu_t *) chunk->pdu_header.item.next;
@@ -645,91 +670,106 @@ static void mesh_lower_transport_outgoing_setup_segment(mesh_segmented_pdu_t *me
     mesh_network_setup_pdu(network_pdu, message_pdu->netkey_index, nid, 0, ttl, seq, src, dest, lower_transport_pdu_data, lower_transport_pdu_len);
 }
 
-static void mesh_lower_transport_outgoing_send_next_segment(void){
-    btstack_assert(lower_transport_outgoing_message != NULL);
+static void mesh_lower_transport_outgoing_queue_segmented_pdu(mesh_segmented_pdu_t *segmented_pdu) {
+    printf("[+] Lower Transport, segmented pdu %p, seq %06" PRIx32 ": send retry count %u\n", segmented_pdu, segmented_pdu->seq, segmented_pdu->retry_count);
+
+    segmented_pdu->retry_count--;
+    segmented_pdu->seg_o = 0;
+    btstack_linked_list_add_tail(&lower_transport_outgoing_ready, (btstack_linked_item_t *) segmented_pdu);
+}
 
+// skip acknowledged segments, returns false if all segments have been sent
+static bool mesh_lower_transport_outgoing_find_next_segment(mesh_segmented_pdu_t *segmented_pdu){
+    uint8_t seg_n = mesh_lower_transport_outgoing_seg_n(segmented_pdu);
+    while ((segmented_pdu->seg_o <= seg_n) && ((segmented_pdu->block_ack & (1u << segmented_pdu->seg_o)) == 0u)){
+        segmented_pdu->seg_o++;
+    }
+    return segmented_pdu->seg_o <= seg_n;
+}
+
+static void mesh_lower_transport_outgoing_all_segments_sent(mesh_segmented_pdu_t *segmented_pdu){
 #ifdef LOG_LOWER_TRANSPORT
-    printf("[+] Lower Transport, segmented pdu %p, seq %06" PRIx32 ": send next segment\n", lower_transport_outgoing_message,
-           lower_transport_outgoing_message->seq);
+    printf("[+] Lower Transport, segmented pdu %p, seq %06" PRIx32 ": send complete (dst %x)\n", segmented_pdu,
+           segmented_pdu->seq, segmented_pdu->dst);
 #endif
 
-    int ctl = lower_transport_outgoing_message->ctl_ttl >> 7;
-    uint16_t max_segment_len = ctl ? 8 : 12;    // control 8 bytes (64 bit NetMic), access 12 bytes (32 bit NetMIC)
-    uint8_t  seg_n = (lower_transport_outgoing_message->len - 1) / max_segment_len;
-
-    // find next unacknowledged segment
-    while ((lower_transport_outgoing_seg_o <= seg_n) && ((lower_transport_outgoing_message->block_ack & (1 << lower_transport_outgoing_seg_o)) == 0)){
-        lower_transport_outgoing_seg_o++;
+    // done for unicast, wait for ack
+    if (mesh_network_address_unicast(segmented_pdu->dst)) {
+        mesh_lower_transport_outgoing_restart_segment_transmission_timer(segmented_pdu);
+        btstack_linked_list_add(&lower_transport_outgoing_waiting, (btstack_linked_item_t *) segmented_pdu);
+        return;
     }
 
-    if (lower_transport_outgoing_seg_o > seg_n){
+    // done for group/virtual, no more retries?
+    if (segmented_pdu->retry_count == 0){
 #ifdef LOG_LOWER_TRANSPORT
-        printf("[+] Lower Transport, segmented pdu %p, seq %06" PRIx32 ": send complete (dst %x)\n", lower_transport_outgoing_message,
-               lower_transport_outgoing_message->seq,
-               lower_transport_outgoing_message->dst);
+        printf("[+] Lower Transport, message unacknowledged -> free\n");
 #endif
-        lower_transport_outgoing_seg_o   = 0;
-
-        // done for unicast, ack timer already set, too
-        if (mesh_network_address_unicast(lower_transport_outgoing_message->dst)) {
-            btstack_linked_list_add(&lower_transport_outgoing_waiting, (btstack_linked_item_t *) lower_transport_outgoing_message);
-            lower_transport_outgoing_message = NULL;
-            return;
-        }
+        // notify upper transport
+        mesh_lower_transport_outgoing_finish(segmented_pdu, MESH_TRANSPORT_STATUS_SUCCESS);
+        return;
+    }
 
-        // done for group/virtual, no more retries?
-        if (lower_transport_outgoing_message->retry_count == 0){
+    // re-queue mssage
 #ifdef LOG_LOWER_TRANSPORT
-            printf("[+] Lower Transport, message unacknowledged -> free\n");
+    printf("[+] Lower Transport, message unacknowledged retry count %u\n", segmented_pdu->retry_count);
 #endif
-            // notify upper transport
-            mesh_lower_transport_outgoing_complete(lower_transport_outgoing_message, MESH_TRANSPORT_STATUS_SUCCESS);
-            return;
+    segmented_pdu->retry_count--;
+    mesh_lower_transport_outgoing_queue_segmented_pdu(segmented_pdu);
+}
+
+static int mesh_lower_transport_outgoing_get_free_segment_slot(void){
+    int i;
+    for (i = 0; i < MESH_LOWER_TRANSPORT_SEGMENT_WINDOW; i++){
+        if (lower_transport_outgoing_segment_messages[i] != NULL) continue;
+        // allocate network pdu on demand
+        if (lower_transport_outgoing_segments[i] == NULL){
+            lower_transport_outgoing_segments[i] = mesh_network_pdu_get();
+            if (lower_transport_outgoing_segments[i] == NULL) continue;
         }
+        return i;
+    }
+    return -1;
+}
+
+static void mesh_lower_transport_outgoing_send_next_segment(mesh_segmented_pdu_t *segmented_pdu, int slot){
 
-        // re-queue mssage
 #ifdef LOG_LOWER_TRANSPORT
-        printf("[+] Lower Transport, message unacknowledged retry count %u\n", lower_transport_outgoing_message->retry_count);
+    printf("[+] Lower Transport, segmented pdu %p, seq %06" PRIx32 ": send next segment\n", segmented_pdu,
+           segmented_pdu->seq);
 #endif
-        lower_transport_outgoing_message->retry_count--;
-        btstack_linked_list_add(&lower_transport_outgoing_ready, (btstack_linked_item_t *) lower_transport_outgoing_message);
-        lower_transport_outgoing_message = NULL;
-        mesh_lower_transport_run();
-        return;
-    }
 
-    // restart segment transmission timer for unicast dst
-    if (mesh_network_address_unicast(lower_transport_outgoing_message->dst)){
-        mesh_lower_transport_outgoing_restart_segment_transmission_timer(lower_transport_outgoing_message);
+    // all remaining segments acknowledged in the meantime
+    if (!mesh_lower_transport_outgoing_find_next_segment(segmented_pdu)){
+        mesh_lower_transport_outgoing_all_segments_sent(segmented_pdu);
+        return;
     }
 
-    mesh_lower_transport_outgoing_setup_segment(lower_transport_outgoing_message, lower_transport_outgoing_seg_o,
-                                                lower_transport_outgoing_segment);
+    mesh_network_pdu_t * network_pdu = lower_transport_outgoing_segments[slot];
+    mesh_lower_transport_outgoing_setup_segment(segmented_pdu, segmented_pdu->seg_o, network_pdu);
 
 #ifdef LOG_LOWER_TRANSPORT
-    printf("[+] Lower Transport, segmented pdu %p, seq %06" PRIx32 ": send seg_o %x, seg_n %x\n", lower_transport_outgoing_message,
-           lower_transport_outgoing_message->seq, lower_transport_outgoing_seg_o, seg_n);
-    mesh_print_hex("LowerTransportPDU", &lower_transport_outgoing_segment->data[9], lower_transport_outgoing_segment->len-9);
+    printf("[+] Lower Transport, segmented pdu %p, seq %06" PRIx32 ": send seg_o %x, seg_n %x\n", segmented_pdu,
+           segmented_pdu->seq, segmented_pdu->seg_o, mesh_lower_transport_outgoing_seg_n(segmented_pdu));
+    mesh_print_hex("LowerTransportPDU", &network_pdu->data[9], network_pdu->len-9);
 #endif
 
     // next segment
-    lower_transport_outgoing_seg_o++;
+    segmented_pdu->seg_o++;
 
-    // send network pdu
-    lower_transport_outgoing_segment_at_network_layer = true;
-    mesh_network_send_pdu(lower_transport_outgoing_segment);
-}
-
-static void mesh_lower_transport_outgoing_setup_sending_segmented_pdus(mesh_segmented_pdu_t *segmented_pdu) {
-    printf("[+] Lower Transport, segmented pdu %p, seq %06" PRIx32 ": send retry count %u\n", segmented_pdu, segmented_pdu->seq, segmented_pdu->retry_count);
+    // segment queued at network layer
+    lower_transport_outgoing_segment_messages[slot] = segmented_pdu;
+    segmented_pdu->segments_at_network_layer++;
 
-    segmented_pdu->retry_count--;
-    lower_transport_outgoing_seg_o   = 0;
-    lower_transport_outgoing_transmission_timeout  = false;
-    lower_transport_outgoing_transmission_complete = false;
-    lower_transport_outgoing_transmission_aborted  = false;
+    // queue again to interleave with segments of other messages, or wait for ack
+    if (mesh_lower_transport_outgoing_find_next_segment(segmented_pdu)){
+        btstack_linked_list_add_tail(&lower_transport_outgoing_ready, (btstack_linked_item_t *) segmented_pdu);
+    } else {
+        mesh_lower_transport_outgoing_all_segments_sent(segmented_pdu);
+    }
 
-    lower_transport_outgoing_message = segmented_pdu;
+    // send network pdu
+    mesh_network_send_pdu(network_pdu);
 }
 
 static void mesh_lower_transport_outgoing_segment_transmission_fired(mesh_segmented_pdu_t *segmented_pdu) {
@@ -746,12 +786,9 @@ static void mesh_lower_transport_outgoing_segment_transmission_fired(mesh_segmen
 #endif
 
     // re-queue message for sending remaining segments
-    if (lower_transport_outgoing_message == segmented_pdu){
-        lower_transport_outgoing_message = NULL;
-    } else {
-        btstack_linked_list_remove(&lower_transport_outgoing_waiting, (btstack_linked_item_t *) segmented_pdu);
-    }
-    btstack_linked_list_add_tail(&lower_transport_outgoing_ready, (btstack_linked_item_t *) segmented_pdu);
+    btstack_linked_list_remove(&lower_transport_outgoing_waiting, (btstack_linked_item_t *) segmented_pdu);
+    btstack_linked_list_remove(&lower_transport_outgoing_ready, (btstack_linked_item_t *) segmented_pdu);
+    mesh_lower_transport_outgoing_queue_segmented_pdu(segmented_pdu);
 
     // continue
     mesh_lower_transport_run();
@@ -765,13 +802,42 @@ static void mesh_lower_transport_outgoing_segment_transmission_timeout(btstack_t
 #endif
     segmented_pdu->flags &= ~MESH_TRANSPORT_FLAG_ACK_TIMER;
 
-    if ((segmented_pdu == lower_transport_outgoing_message) && lower_transport_outgoing_segment_at_network_layer){
-        lower_transport_outgoing_transmission_timeout = true;
+    if (segmented_pdu->segments_at_network_layer > 0){
+        segmented_pdu->flags |= MESH_TRANSPORT_FLAG_SEND_TIMEOUT;
     } else {
         mesh_lower_transport_outgoing_segment_transmission_fired(segmented_pdu);
     }
 }
 
+static void mesh_lower_transport_outgoing_segment_sent(int slot){
+    mesh_segmented_pdu_t * segmented_pdu = lower_transport_outgoing_segment_messages[slot];
+    lower_transport_outgoing_segment_messages[slot] = NULL;
+
+#ifdef LOG_LOWER_TRANSPORT
+    printf("[+] Lower transport, segmented pdu %p, seq %06" PRIx32 ": network pdu %p sent\n", segmented_pdu,
+           segmented_pdu->seq, lower_transport_outgoing_segments[slot]);
+#endif
+
+    segmented_pdu->segments_at_network_layer--;
+    if (segmented_pdu->segments_at_network_layer == 0){
+        if ((segmented_pdu->flags & MESH_TRANSPORT_FLAG_SEND_COMPLETE) != 0){
+            // handle success
+            mesh_lower_transport_outgoing_complete(segmented_pdu, MESH_TRANSPORT_STATUS_SUCCESS);
+        } else if ((segmented_pdu->flags & MESH_TRANSPORT_FLAG_SEND_ABORTED) != 0){
+            // handle abort
+            mesh_lower_transport_outgoing_complete(segmented_pdu, MESH_TRANSPORT_STATUS_SEND_ABORT_BY_REMOTE);
+        } else if ((segmented_pdu->flags & MESH_TRANSPORT_FLAG_SEND_TIMEOUT) != 0){
+            // handle timeout
+            segmented_pdu->flags &= ~MESH_TRANSPORT_FLAG_SEND_TIMEOUT;
+            mesh_lower_transport_outgoing_segment_transmission_fired(segmented_pdu);
+            return;
+        }
+    }
+
+    // send next segment
+    mesh_lower_transport_run();
+}
+
 // GENERAL //
 
 static void mesh_lower_transport_network_pdu_sent(mesh_network_pdu_t *network_pdu){
@@ -783,41 +849,13 @@ static void mesh_lower_transport_network_pdu_sent(mesh_network_pdu_t *network_pd
         return;
     }
 
-    // single segment?
-    if (lower_transport_outgoing_segment == network_pdu){
-        btstack_assert(lower_transport_outgoing_message != NULL);
-
-        // of segmented message
-#ifdef LOG_LOWER_TRANSPORT
-        printf("[+] Lower transport, segmented pdu %p, seq %06" PRIx32 ": network pdu %p sent\n", lower_transport_outgoing_message,
-               lower_transport_outgoing_message->seq, network_pdu);
-#endif
-
-        lower_transport_outgoing_segment_at_network_layer = false;
-        if (lower_transport_outgoing_transmission_complete){
-            // handle success
-            lower_transport_outgoing_transmission_complete = false;
-            lower_transport_outgoing_transmission_timeout  = false;
-            mesh_lower_transport_outgoing_complete(lower_transport_outgoing_message, MESH_TRANSPORT_STATUS_SUCCESS);
-            return;
-        }
-        if (lower_transport_outgoing_transmission_aborted){
-            // handle abort
-            lower_transport_outgoing_transmission_complete = false;
-            lower_transport_outgoing_transmission_timeout  = false;
-            mesh_lower_transport_outgoing_complete(lower_transport_outgoing_message, MESH_TRANSPORT_STATUS_SEND_ABORT_BY_REMOTE);
-            return;
-        }
-        if (lower_transport_outgoing_transmission_timeout){
-            // handle timeout
-            lower_transport_outgoing_transmission_timeout = false;
-            mesh_lower_transport_outgoing_segment_transmission_fired(lower_transport_outgoing_message);
+    // segment of segmented message?
+    int i;
+    for (i = 0; i < MESH_LOWER_TRANSPORT_SEGMENT_WINDOW; i++){
+        if ((lower_transport_outgoing_segments[i] == network_pdu) && (lower_transport_outgoing_segment_messages[i] != NULL)){
+            mesh_lower_transport_outgoing_segment_sent(i);
             return;
         }
-
-        // send next segment
-        mesh_lower_transport_outgoing_send_next_segment();
-        return;
     }
 
     // other
@@ -829,7 +867,7 @@ static void mesh_lower_transport_process_unsegmented_control_message(mesh_networ
     uint8_t  opcode = lower_transport_pdu[0];
 
 #ifdef LOG_LOWER_TRANSPORT
-    printf("Unsegmented Control message, outgoing message %p, opcode %x\n", lower_transport_outgoing_message, opcode);
+    printf("Unsegmented Control message, opcode %x\n", opcode);
 #endif
 
     switch (opcode){
@@ -909,28 +947,27 @@ void mesh_lower_transport_received_message(mesh_network_callback_type_t callback
 
 static void mesh_lower_transport_run(void){
 
-    // check if outgoing segmented pdu is active
-    if (lower_transport_outgoing_message) return;
-
     while(!btstack_linked_list_empty(&lower_transport_outgoing_ready)) {
         // get next message
         mesh_segmented_pdu_t   * message_pdu;
-        mesh_pdu_t * pdu = (mesh_pdu_t *) btstack_linked_list_pop(&lower_transport_outgoing_ready);
+        int slot;
+        mesh_pdu_t * pdu = (mesh_pdu_t *) btstack_linked_list_get_first_item(&lower_transport_outgoing_ready);
         switch (pdu->pdu_type) {
             case MESH_PDU_TYPE_UPPER_UNSEGMENTED_ACCESS:
             case MESH_PDU_TYPE_UPPER_UNSEGMENTED_CONTROL:
+                (void) btstack_linked_list_pop(&lower_transport_outgoing_ready);
                 printf("[+] Lower transport, unsegmented pdu, sending now %p\n", pdu);
                 lower_transport_outgoing_network_pdu = (mesh_network_pdu_t *) pdu;
                 mesh_network_send_pdu(lower_transport_outgoing_network_pdu);
                 break;
             case MESH_PDU_TYPE_SEGMENTED:
+                // wait until a network pdu for the segment is available
+                slot = mesh_lower_transport_outgoing_get_free_segment_slot();
+                if (slot < 0) return;
+                (void) btstack_linked_list_pop(&lower_transport_outgoing_ready);
                 message_pdu = (mesh_segmented_pdu_t *) pdu;
-                //
-                printf("[+] Lower transport, segmented pdu %p, seq %06" PRIx32 ": run start sending now\n", message_pdu,
-                       message_pdu->seq);
-                // start sending segmented pdu
-                mesh_lower_transport_outgoing_setup_sending_segmented_pdus(message_pdu);
-                mesh_lower_transport_outgoing_send_next_segment();
+                // send next segment of segmented pdu
+                mesh_lower_transport_outgoing_send_next_segment(message_pdu, slot);
                 break;
             default:
                 btstack_assert(false);
@@ -950,8 +987,11 @@ void mesh_lower_transport_send_pdu(mesh_pdu_t *pdu){
             // set num retries, set of segments to send
             segmented_pdu = (mesh_segmented_pdu_t *) pdu;
             segmented_pdu->retry_count = 3;
+            segmented_pdu->segments_at_network_layer = 0;
             mesh_lower_transport_outgoing_setup_block_ack(segmented_pdu);
-            break;
+            mesh_lower_transport_outgoing_queue_segmented_pdu(segmented_pdu);
+            mesh_lower_transport_run();
+            return;
         default:
             btstack_assert(false);
             break;
@@ -978,17 +1018,19 @@ void mesh_lower_transport_reset_network_pdus(btstack_linked_list_t *list){
 }
 
 bool mesh_lower_transport_can_send_to_dest(uint16_t dest){
-    UNUSED(dest);
-    // check current
     uint16_t num_messages = 0;
-    if (lower_transport_outgoing_message != NULL) {
-        if (lower_transport_outgoing_message->dst == dest) {
+    // check ready
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &lower_transport_outgoing_ready);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        mesh_pdu_t * pdu = (mesh_pdu_t *) btstack_linked_list_iterator_next(&it);
+        if (pdu->pdu_type != MESH_PDU_TYPE_SEGMENTED) continue;
+        num_messages++;
+        if (((mesh_segmented_pdu_t *) pdu)->dst == dest){
             return false;
         }
-        num_messages++;
     }
     // check waiting
-    btstack_linked_list_iterator_t it;
     btstack_linked_list_iterator_init(&it, &lower_transport_outgoing_waiting);
     while (btstack_linked_list_iterator_has_next(&it)){
         mesh_segmented_pdu_t * segmented_pdu = (mesh_segmented_pdu_t *) btstack_linked_list_iterator_next(&it);
@@ -1010,28 +1052,43 @@ void mesh_lower_transport_reserve_slot(void){
 }
 
 void mesh_lower_transport_reset(void){
-    if (lower_transport_outgoing_message){
-        while (!btstack_linked_list_empty(&lower_transport_outgoing_message->segments)){
-            mesh_network_pdu_t * network_pdu = (mesh_network_pdu_t *) btstack_linked_list_pop(&lower_transport_outgoing_message->segments);
+    // drop segments of segmented pdus that have been started
+    btstack_linked_list_iterator_t it;
+    btstack_linked_list_iterator_init(&it, &lower_transport_outgoing_ready);
+    while (btstack_linked_list_iterator_has_next(&it)){
+        mesh_pdu_t * pdu = (mesh_pdu_t *) btstack_linked_list_iterator_next(&it);
+        if (pdu->pdu_type != MESH_PDU_TYPE_SEGMENTED) continue;
+        mesh_segmented_pdu_t * segmented_pdu = (mesh_segmented_pdu_t *) pdu;
+        if ((segmented_pdu->seg_o == 0) && (segmented_pdu->segments_at_network_layer == 0)) continue;
+        btstack_linked_list_iterator_remove(&it);
+        mesh_lower_transport_outgoing_stop_acknowledgment_timer(segmented_pdu);
+        while (!btstack_linked_list_empty(&segmented_pdu->segments)){
+            mesh_network_pdu_t * network_pdu = (mesh_network_pdu_t *) btstack_linked_list_pop(&segmented_pdu->segments);
             mesh_network_pdu_free(network_pdu);
         }
-        lower_transport_outgoing_message = NULL;
     }
     while (!btstack_linked_list_empty(&lower_transport_outgoing_waiting)){
         mesh_segmented_pdu_t * segmented_pdu = (mesh_segmented_pdu_t *) btstack_linked_list_pop(&lower_transport_outgoing_waiting);
+        mesh_lower_transport_outgoing_stop_acknowledgment_timer(segmented_pdu);
         btstack_memory_mesh_segmented_pdu_free(segmented_pdu);
     }
-    mesh_network_pdu_free(lower_transport_outgoing_segment);
-    lower_transport_outgoing_segment_at_network_layer = false;
-    lower_transport_outgoing_segment = NULL;
+    int i;
+    for (i = 0; i < MESH_LOWER_TRANSPORT_SEGMENT_WINDOW; i++){
+        // network pdus queued at network layer are freed by mesh_network_reset
+        if ((lower_transport_outgoing_segments[i] != NULL) && (lower_transport_outgoing_segment_messages[i] == NULL)){
+            mesh_network_pdu_free(lower_transport_outgoing_segments[i]);
+        }
+        lower_transport_outgoing_segments[i] = NULL;
+        lower_transport_outgoing_segment_messages[i] = NULL;
+    }
 }
 
 void mesh_lower_transport_init(){
     // register with network layer
     mesh_network_set_higher_layer_handler(&mesh_lower_transport_received_message);
-    // allocate network_pdu for segmentation
-    lower_transport_outgoing_segment_at_network_layer = false;
-    lower_transport_outgoing_segment = mesh_network_pdu_get();
+    // allocate first network_pdu for segmentation, others are allocated on demand
+    (void) memset(lower_transport_outgoing_segment_messages, 0, sizeof(lower_transport_outgoing_segment_messages));
+    lower_transport_outgoing_segments[0] = mesh_network_pdu_get();
 }
 
 void mesh_lower_transport_set_higher_layer_handler(void (*pdu_handler)( mesh_transport_callback_type_t callback_type, mesh_transport_status_t status, mesh_pdu_t * pdu)){
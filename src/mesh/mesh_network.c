@@ -64,7 +64,15 @@
 #endif
 
 // configuration
-#define MESH_NETWORK_CACHE_SIZE 2
+#ifndef MESH_NETWORK_CACHE_SIZE
+#define MESH_NETWORK_CACHE_SIZE 16
+#endif
+
+#if MESH_NETWORK_CACHE_SIZE >= 0xffff
+#error "MESH_NETWORK_CACHE_SIZE must be less than 0xffff"
+#endif
+
+#define MESH_NETWORK_CACHE_INDEX_INVALID 0xffffu
 
 // debug config
 #define LOG_NETWORK
@@ -91,7 +99,7 @@ static union {
     btstack_crypto_aes128_t      aes128;
 } mesh_network_crypto_request;
 
-static const mesh_network_key_t *  current_network_key;
+static mesh_network_key_t *  current_network_key;
 
 // PECB calculation 
 static uint8_t encryption_block[16];
@@ -137,8 +145,17 @@ static mesh_network_pdu_t * adv_bearer_network_pdu;
 
 
 // mesh network cache - we use 32-bit 'hashes'
+// - entries are replaced in FIFO order, mesh_network_cache_index points to the oldest one
+// - for lookup, entries are chained into MESH_NETWORK_CACHE_SIZE buckets
 static uint32_t mesh_network_cache[MESH_NETWORK_CACHE_SIZE];
-static int      mesh_network_cache_index;
+static uint16_t mesh_network_cache_next[MESH_NETWORK_CACHE_SIZE];
+static uint16_t mesh_network_cache_buckets[MESH_NETWORK_CACHE_SIZE];
+static uint16_t mesh_network_cache_index;
+static uint16_t mesh_network_cache_count;
+static mesh_network_cache_statistics_t mesh_network_cache_statistics;
+
+// decryption of incoming network pdus
+static mesh_network_decryption_statistics_t mesh_network_decryption_statistics;
 
 // register for freed network pdu
 void (*mesh_network_free_pdu_callback)(void);
@@ -160,23 +177,76 @@ static uint32_t mesh_network_cache_hash(mesh_network_pdu_t * network_pdu){
     return (src << 16) | (ivi << 15) | (seq & 0x7fff);
 }
 
+static void mesh_network_cache_init(void){
+    uint16_t i;
+    for (i = 0; i < MESH_NETWORK_CACHE_SIZE; i++){
+        mesh_network_cache_buckets[i] = MESH_NETWORK_CACHE_INDEX_INVALID;
+    }
+    mesh_network_cache_index = 0;
+    mesh_network_cache_count = 0;
+}
+
+static uint16_t * mesh_network_cache_bucket(uint32_t hash){
+    // SEQ is in the lower bits, but SRC might only differ in the upper bits
+    uint32_t mixed = (hash ^ (hash >> 16)) * 0x9e3779b1u;
+    return &mesh_network_cache_buckets[(mixed >> 16) % MESH_NETWORK_CACHE_SIZE];
+}
+
 static int mesh_network_cache_find(uint32_t hash){
-    int i;
-    for (i = 0; i < MESH_NETWORK_CACHE_SIZE; i++) {
-        if (mesh_network_cache[i] == hash) {
+    uint16_t index = *mesh_network_cache_bucket(hash);
+    while (index != MESH_NETWORK_CACHE_INDEX_INVALID){
+        if (mesh_network_cache[index] == hash) {
+            mesh_network_cache_statistics.hits++;
             return 1;
         }
+        index = mesh_network_cache_next[index];
     }
+    mesh_network_cache_statistics.misses++;
     return 0;
 }
 
 static void mesh_network_cache_add(uint32_t hash){
-    mesh_network_cache[mesh_network_cache_index++] = hash;
+    uint16_t index = mesh_network_cache_index;
+
+    // evict oldest entry
+    if (mesh_network_cache_count == MESH_NETWORK_CACHE_SIZE){
+        uint16_t * link = mesh_network_cache_bucket(mesh_network_cache[index]);
+        while (*link != index){
+            link = &mesh_network_cache_next[*link];
+        }
+        *link = mesh_network_cache_next[index];
+        mesh_network_cache_statistics.evictions++;
+    } else {
+        mesh_network_cache_count++;
+    }
+
+    uint16_t * bucket = mesh_network_cache_bucket(hash);
+    mesh_network_cache[index] = hash;
+    mesh_network_cache_next[index] = *bucket;
+    *bucket = index;
+
+    mesh_network_cache_index++;
     if (mesh_network_cache_index >= MESH_NETWORK_CACHE_SIZE){
         mesh_network_cache_index = 0;
     }
 }
 
+void mesh_network_cache_get_statistics(mesh_network_cache_statistics_t * statistics){
+    *statistics = mesh_network_cache_statistics;
+}
+
+void mesh_network_cache_reset_statistics(void){
+    memset(&mesh_network_cache_statistics, 0, sizeof(mesh_network_cache_statistics));
+}
+
+void mesh_network_decryption_get_statistics(mesh_network_decryption_statistics_t * statistics){
+    *statistics = mesh_network_decryption_statistics;
+}
+
+void mesh_network_decryption_reset_statistics(void){
+    memset(&mesh_network_decryption_statistics, 0, sizeof(mesh_network_decryption_statistics));
+}
+
 // common helper
 int mesh_network_address_unicast(uint16_t addr){
     return addr != MESH_ADDRESS_UNSASSIGNED && (addr < 0x8000);
@@ -519,6 +589,7 @@ static void process_network_pdu_validate_d(void * arg){
     if (memcmp(net_mic, &incoming_pdu_raw->data[incoming_pdu_decoded->len-net_mic_len], net_mic_len) != 0){
         // fail
         printf("RX-NetMIC mismatch, try next key (%p)\n", incoming_pdu_decoded);
+        mesh_network_decryption_statistics.failed_attempts++;
         process_network_pdu_validate();
         return;
     }    
@@ -535,6 +606,9 @@ static void process_network_pdu_validate_d(void * arg){
     // set netkey_index
     incoming_pdu_decoded->netkey_index = current_network_key->netkey_index;
 
+    // try this key first for next network pdu with same NID
+    mesh_network_key_nid_set_last_used(current_network_key);
+
     if (incoming_pdu_decoded->flags & MESH_NETWORK_PDU_FLAGS_PROXY_CONFIGURATION){
 
         mesh_network_pdu_t * decoded_pdu = incoming_pdu_decoded;
@@ -659,6 +733,7 @@ static void process_network_pdu_validate_b(void * arg){
 static void process_network_pdu_validate(void){
     if (!mesh_network_key_nid_iterator_has_more(&validation_network_key_it)){
         printf("No valid network key found\n");
+        mesh_network_decryption_statistics.no_key_found++;
         btstack_memory_mesh_network_pdu_free(incoming_pdu_decoded);
         incoming_pdu_decoded = NULL;
         process_network_pdu_done();
@@ -666,6 +741,7 @@ static void process_network_pdu_validate(void){
     }
 
     current_network_key = mesh_network_key_nid_iterator_get_next(&validation_network_key_it);
+    mesh_network_decryption_statistics.attempts++;
 
     // calc PECB
     uint32_t iv_index = iv_index_for_pdu(incoming_pdu_raw);
@@ -689,6 +765,7 @@ static void process_network_pdu(void){
     uint8_t nid = nid_ivi & 0x7f;
     // uint8_t iv_index = network_pdu_data[0] >> 7;
     mesh_network_key_nid_iterator_init(&validation_network_key_it, nid);
+    mesh_network_decryption_statistics.pdus++;
 
     process_network_pdu_validate();
 }
@@ -998,6 +1075,7 @@ static void mesh_netework_gatt_bearer_handle_proxy_configuration(uint8_t packet_
 #endif
 
 void mesh_network_init(void){
+    mesh_network_cache_init();
 #ifdef ENABLE_MESH_ADV_BEARER
     adv_bearer_register_for_network_pdu(&mesh_adv_bearer_handle_network_event);
 #endif
@@ -112,6 +112,9 @@ typedef struct mesh_network_pdu {
 #define MESH_TRANSPORT_FLAG_TRANSMIC_64       4
 #define MESH_TRANSPORT_FLAG_ACK_TIMER         8
 #define MESH_TRANSPORT_FLAG_INCOMPLETE_TIMER 16
+#define MESH_TRANSPORT_FLAG_SEND_COMPLETE    32
+#define MESH_TRANSPORT_FLAG_SEND_ABORTED     64
+#define MESH_TRANSPORT_FLAG_SEND_TIMEOUT    128
 
 typedef struct {
     mesh_pdu_t pdu_header;
@@ -136,6 +139,10 @@ typedef struct {
     uint16_t              flags;
     // retry count
     uint8_t               retry_count;
+    // outgoing: next segment to send
+    uint8_t               seg_o;
+    // outgoing: number of segments queued at network layer
+    uint8_t               segments_at_network_layer;
     // pdu segments
     uint16_t              len;
     btstack_linked_list_t segments;
@@ -269,11 +276,53 @@ typedef struct {
     btstack_linked_list_iterator_t it;
 } mesh_subnet_iterator_t;
 
+typedef struct {
+    // received Network PDUs found in network message cache and dropped
+    uint32_t hits;
+    // received Network PDUs not found in cache
+    uint32_t misses;
+    // entries replaced by newer ones
+    uint32_t evictions;
+} mesh_network_cache_statistics_t;
+
+typedef struct {
+    // received Network PDUs
+    uint32_t pdus;
+    // de-obfuscation and decryption with a network key with matching NID
+    uint32_t attempts;
+    // attempts that failed NetMIC check
+    uint32_t failed_attempts;
+    // received Network PDUs without any matching network key
+    uint32_t no_key_found;
+} mesh_network_decryption_statistics_t;
+
 /**
  * @brief Init Mesh Network Layer
  */
 void mesh_network_init(void);
 
+/**
+ * @brief Get network message cache statistics, size of cache can be set via MESH_NETWORK_CACHE_SIZE
+ * @param statistics
+ */
+void mesh_network_cache_get_statistics(mesh_network_cache_statistics_t * statistics);
+
+/**
+ * @brief Reset network message cache statistics
+ */
+void mesh_network_cache_reset_statistics(void);
+
+/**
+ * @brief Get statistics for decryption of received Network PDUs, failed attempts indicate wasted work
+ * @param statistics
+ */
+void mesh_network_decryption_get_statistics(mesh_network_decryption_statistics_t * statistics);
+
+/**
+ * @brief Reset statistics for decryption of received Network PDUs
+ */
+void mesh_network_decryption_reset_statistics(void);
+
 /** 
  * @brief Set higher layer Network PDU handler
  * @param packet_handler
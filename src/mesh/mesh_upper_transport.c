@@ -62,20 +62,37 @@
 // MESH_ACCESS_MESH_NETWORK_PAYLOAD_MAX (384) / MESH_NETWORK_PAYLOAD_MAX (29) = 13.24.. < 14
 #define MESSAGE_BUILDER_MAX_NUM_NETWORK_PDUS (14)
 
+// number of source addresses for which the last matching application key and virtual address are stored
+#ifndef MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE
+#define MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE 8
+#endif
+
 // combined key x address iterator for upper transport decryption
 
 typedef struct {
     // state
     mesh_transport_key_iterator_t  key_it;
     mesh_virtual_address_iterator_t address_it;
+    // current key for virtual addresses
+    const mesh_transport_key_t *   address_key;
     // elements
     const mesh_transport_key_t *   key;
     const mesh_virtual_address_t * address;
     // address - might be virtual
     uint16_t dst;
-    // key info
+    // last match for source address - provided first and skipped afterwards
+    const mesh_transport_key_t *   preferred_key;
+    const mesh_virtual_address_t * preferred_address;
+    bool preferred_pending;
 } mesh_transport_key_and_virtual_address_iterator_t;
 
+typedef struct {
+    uint16_t src;
+    // only used for comparison, as key or address might have been removed in the meantime
+    const mesh_transport_key_t *   key;
+    const mesh_virtual_address_t * address;
+} mesh_upper_transport_key_cache_entry_t;
+
 static void mesh_upper_transport_run(void);
 static void mesh_upper_transport_schedule_send_requests(void);
 static void mesh_upper_transport_validate_access_message(void);
@@ -90,6 +107,12 @@ static uint8_t application_nonce[13];
 static btstack_crypto_ccm_t ccm;
 static mesh_transport_key_and_virtual_address_iterator_t mesh_transport_key_it;
 
+// last matching application key per source address, most recently used first
+static mesh_upper_transport_key_cache_entry_t mesh_upper_transport_key_cache[MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE];
+static uint8_t mesh_upper_transport_key_cache_count;
+
+static mesh_upper_transport_decryption_statistics_t mesh_upper_transport_decryption_statistics;
+
 // incoming segmented (mesh_segmented_pdu_t) or unsegmented (network_pdu_t)
 static mesh_pdu_t *          incoming_access_encrypted;
 
@@ -141,15 +164,87 @@ static void mesh_print_hex(const char * name, const uint8_t * data, uint16_t len
 //     printf("%20s: 0x%x", name, (int) value);
 // }
 
+static mesh_upper_transport_key_cache_entry_t * mesh_upper_transport_key_cache_get(uint16_t src){
+    uint8_t i;
+    for (i = 0; i < mesh_upper_transport_key_cache_count; i++){
+        if (mesh_upper_transport_key_cache[i].src == src) return &mesh_upper_transport_key_cache[i];
+    }
+    return NULL;
+}
+
+void mesh_upper_transport_decryption_get_statistics(mesh_upper_transport_decryption_statistics_t * statistics){
+    *statistics = mesh_upper_transport_decryption_statistics;
+}
+
+void mesh_upper_transport_decryption_reset_statistics(void){
+    memset(&mesh_upper_transport_decryption_statistics, 0, sizeof(mesh_upper_transport_decryption_statistics));
+}
+
+static void mesh_upper_transport_key_cache_store(uint16_t src, const mesh_transport_key_t * key, const mesh_virtual_address_t * address){
+    mesh_upper_transport_key_cache_entry_t * entry = mesh_upper_transport_key_cache_get(src);
+    uint8_t pos;
+    if (entry != NULL){
+        pos = (uint8_t) (entry - mesh_upper_transport_key_cache);
+    } else if (mesh_upper_transport_key_cache_count < MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE){
+        pos = mesh_upper_transport_key_cache_count++;
+    } else {
+        // replace least recently used entry
+        pos = MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE - 1;
+    }
+    // move to front
+    (void)memmove(&mesh_upper_transport_key_cache[1], &mesh_upper_transport_key_cache[0], pos * sizeof(mesh_upper_transport_key_cache_entry_t));
+    mesh_upper_transport_key_cache[0].src     = src;
+    mesh_upper_transport_key_cache[0].key     = key;
+    mesh_upper_transport_key_cache[0].address = address;
+}
+
 static void mesh_transport_key_and_virtual_address_iterator_init(mesh_transport_key_and_virtual_address_iterator_t *it,
                                                                  uint16_t dst, uint16_t netkey_index, uint8_t akf,
-                                                                 uint8_t aid) {
+                                                                 uint8_t aid, uint16_t src) {
     printf("KEY_INIT: dst %04x, akf %x, aid %x\n", dst, akf, aid);
     // config
     it->dst   = dst;
     // init elements
     it->key     = NULL;
     it->address = NULL;
+    it->address_key = NULL;
+    it->preferred_key = NULL;
+    it->preferred_address = NULL;
+    it->preferred_pending = false;
+
+    // check if last match for source address is still a valid candidate
+    const mesh_upper_transport_key_cache_entry_t * entry = NULL;
+    if (akf != 0u){
+        entry = mesh_upper_transport_key_cache_get(src);
+    }
+    if (entry != NULL){
+        bool key_valid = false;
+        mesh_transport_key_aid_iterator_init(&it->key_it, netkey_index, akf, aid);
+        while (mesh_transport_key_aid_iterator_has_more(&it->key_it)){
+            if (mesh_transport_key_aid_iterator_get_next(&it->key_it) == entry->key){
+                key_valid = true;
+                break;
+            }
+        }
+        bool address_valid = true;
+        if (mesh_network_address_virtual(dst)){
+            address_valid = false;
+            mesh_virtual_address_iterator_init(&it->address_it, dst);
+            while (mesh_virtual_address_iterator_has_more(&it->address_it)){
+                if (mesh_virtual_address_iterator_get_next(&it->address_it) == entry->address){
+                    address_valid = true;
+                    break;
+                }
+            }
+        }
+        if (key_valid && address_valid){
+            mesh_upper_transport_decryption_statistics.cache_hits++;
+            it->preferred_key     = entry->key;
+            it->preferred_address = mesh_network_address_virtual(dst) ? entry->address : NULL;
+            it->preferred_pending = true;
+        }
+    }
+
     // init element iterators
     mesh_transport_key_aid_iterator_init(&it->key_it, netkey_index, akf, aid);
     // init address iterator
@@ -157,29 +252,52 @@ static void mesh_transport_key_and_virtual_address_iterator_init(mesh_transport_
         mesh_virtual_address_iterator_init(&it->address_it, dst);
         // get first key
         if (mesh_transport_key_aid_iterator_has_more(&it->key_it)) {
-            it->key = mesh_transport_key_aid_iterator_get_next(&it->key_it);
+            it->address_key = mesh_transport_key_aid_iterator_get_next(&it->key_it);
         }
     }
 }
 
-// cartesian product: keys x addressses
+// cartesian product: keys x addressses, starting with preferred key and address
 static int mesh_transport_key_and_virtual_address_iterator_has_more(mesh_transport_key_and_virtual_address_iterator_t * it){
+    if (it->preferred_pending) return 1;
     if (mesh_network_address_virtual(it->dst)) {
         // find next valid entry
         while (true){
-            if (mesh_virtual_address_iterator_has_more(&it->address_it)) return 1;
+            if (mesh_virtual_address_iterator_has_more(&it->address_it)) {
+                // skip already checked combination
+                if ((it->address_key == it->preferred_key) && (it->address_it.address == it->preferred_address)){
+                    (void) mesh_virtual_address_iterator_get_next(&it->address_it);
+                    continue;
+                }
+                return 1;
+            }
             if (!mesh_transport_key_aid_iterator_has_more(&it->key_it)) return 0;
             // get next key
-            it->key = mesh_transport_key_aid_iterator_get_next(&it->key_it);
+            it->address_key = mesh_transport_key_aid_iterator_get_next(&it->key_it);
             mesh_virtual_address_iterator_init(&it->address_it, it->dst);
         }
     } else {
-        return mesh_transport_key_aid_iterator_has_more(&it->key_it);
+        while (mesh_transport_key_aid_iterator_has_more(&it->key_it)){
+            // skip already checked key
+            if (it->key_it.key == it->preferred_key){
+                (void) mesh_transport_key_aid_iterator_get_next(&it->key_it);
+                continue;
+            }
+            return 1;
+        }
+        return 0;
     }
 }
 
 static void mesh_transport_key_and_virtual_address_iterator_next(mesh_transport_key_and_virtual_address_iterator_t * it){
+    if (it->preferred_pending){
+        it->preferred_pending = false;
+        it->key     = it->preferred_key;
+        it->address = it->preferred_address;
+        return;
+    }
     if (mesh_network_address_virtual(it->dst)) {
+        it->key     = it->address_key;
         it->address = mesh_virtual_address_iterator_get_next(&it->address_it);
     } else {
         it->key = mesh_transport_key_aid_iterator_get_next(&it->key_it);
@@ -279,6 +397,7 @@ void mesh_upper_transport_dump(void){
 
 void mesh_upper_transport_reset(void){
     crypto_active = 0;
+    mesh_upper_transport_key_cache_count = 0;
     mesh_upper_transport_reset_pdus(&upper_transport_incoming);
     mesh_upper_transport_reset_pdus(&upper_transport_outgoing);
     message_builder_num_network_pdus_reserved = 0;
@@ -491,6 +610,11 @@ static void mesh_upper_transport_validate_access_message_ccm(void * arg){
         // remove TransMIC from payload
         incoming_access_decrypted->len -= transmic_len;
 
+        // try application key and virtual address first for next message from this source
+        if (mesh_transport_key_it.key->akf != 0u){
+            mesh_upper_transport_key_cache_store(incoming_access_decrypted->src, mesh_transport_key_it.key, mesh_transport_key_it.address);
+        }
+
         // if virtual address, update dst to pseudo_dst
         if (mesh_network_address_virtual(incoming_access_decrypted->dst)){
             incoming_access_decrypted->dst = mesh_transport_key_it.address->pseudo_dst;
@@ -501,6 +625,7 @@ static void mesh_upper_transport_validate_access_message_ccm(void * arg){
         mesh_upper_transport_schedule_send_requests();
 
     } else {
+        mesh_upper_transport_decryption_statistics.failed_attempts++;
         uint8_t akf = incoming_access_decrypted->akf_aid_control & 0x40;
         if (akf){
             printf("TransMIC does not match, try next key\n");
@@ -554,6 +679,7 @@ static void mesh_upper_transport_validate_access_message(void){
     }
     mesh_transport_key_and_virtual_address_iterator_next(&mesh_transport_key_it);
     const mesh_transport_key_t * message_key = mesh_transport_key_it.key;
+    mesh_upper_transport_decryption_statistics.attempts++;
 
     if (message_key->akf){
         transport_segmented_setup_application_nonce(application_nonce, (mesh_pdu_t *) incoming_access_decrypted);
@@ -596,7 +722,9 @@ static void mesh_upper_transport_process_access_message(void){
     printf("AID: %02x\n", aid);
 
     mesh_transport_key_and_virtual_address_iterator_init(&mesh_transport_key_it, incoming_access_decrypted->dst,
-                                                         incoming_access_decrypted->netkey_index, akf, aid);
+                                                         incoming_access_decrypted->netkey_index, akf, aid,
+                                                         incoming_access_decrypted->src);
+    mesh_upper_transport_decryption_statistics.pdus++;
     mesh_upper_transport_validate_access_message();
 }
 
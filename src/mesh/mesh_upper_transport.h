@@ -54,6 +54,17 @@ typedef struct {
     mesh_network_pdu_t * segment;
 } mesh_upper_transport_builder_t;
 
+typedef struct {
+    // received Access PDUs
+    uint32_t pdus;
+    // decryption with a matching application key / device key and virtual address
+    uint32_t attempts;
+    // attempts that failed TransMIC check
+    uint32_t failed_attempts;
+    // received Access PDUs where last matching key for source address was valid and tried first
+    uint32_t cache_hits;
+} mesh_upper_transport_decryption_statistics_t;
+
 /*
  * @brief reserve 1 x mesh_upper_transport_pdu_t and 14 x mesh_network_pdu_t to allow composition of max access/control message
  * @return true if enough buffer allocated
@@ -110,6 +121,17 @@ mesh_upper_transport_pdu_t * mesh_upper_transport_message_finalize(mesh_upper_tr
  */
 void mesh_upper_transport_init(void);
 
+/**
+ * @brief Get statistics for decryption of received Access PDUs, size of key cache can be set via MESH_UPPER_TRANSPORT_KEY_CACHE_SIZE
+ * @param statistics
+ */
+void mesh_upper_transport_decryption_get_statistics(mesh_upper_transport_decryption_statistics_t * statistics);
+
+/**
+ * @brief Reset statistics for decryption of received Access PDUs
+ */
+void mesh_upper_transport_decryption_reset_statistics(void);
+
 /**
  * @brief Register for control messages and events
  * @param callback
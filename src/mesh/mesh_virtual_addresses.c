@@ -51,6 +51,28 @@
 static btstack_linked_list_t mesh_virtual_addresses;
 static uint8_t mesh_virtual_addresses_used[MAX_NR_MESH_VIRTUAL_ADDRESSES];
 
+// virtual addresses indexed by hash to find label uuids for incoming messages
+#define MESH_VIRTUAL_ADDRESS_HASH_BUCKETS 8
+static mesh_virtual_address_t * mesh_virtual_addresses_by_hash[MESH_VIRTUAL_ADDRESS_HASH_BUCKETS];
+
+static mesh_virtual_address_t ** mesh_virtual_address_hash_bucket(uint16_t hash){
+    return &mesh_virtual_addresses_by_hash[hash & (MESH_VIRTUAL_ADDRESS_HASH_BUCKETS - 1)];
+}
+
+static void mesh_virtual_address_hash_index_remove(const mesh_virtual_address_t * virtual_address){
+    // hash might have been modified since it was added, check all buckets
+    uint8_t i;
+    for (i = 0; i < MESH_VIRTUAL_ADDRESS_HASH_BUCKETS; i++){
+        mesh_virtual_address_t ** it;
+        for (it = &mesh_virtual_addresses_by_hash[i]; *it != NULL; it = &(*it)->hash_next){
+            if (*it == virtual_address){
+                *it = virtual_address->hash_next;
+                return;
+            }
+        }
+    }
+}
+
 uint16_t mesh_virtual_addresses_get_free_pseudo_dst(void){
     uint16_t i;
     for (i=0;i < MAX_NR_MESH_VIRTUAL_ADDRESSES ; i++){
@@ -65,9 +87,15 @@ void mesh_virtual_address_add(mesh_virtual_address_t * virtual_address){
     mesh_virtual_addresses_used[virtual_address->pseudo_dst-0x8000] = 1;
     virtual_address->ref_count = 0;
     btstack_linked_list_add(&mesh_virtual_addresses, (void *) virtual_address);
+    // add to front of hash bucket, same order as list
+    mesh_virtual_address_hash_index_remove(virtual_address);
+    mesh_virtual_address_t ** bucket = mesh_virtual_address_hash_bucket(virtual_address->hash);
+    virtual_address->hash_next = *bucket;
+    *bucket = virtual_address;
 }
 
 void mesh_virtual_address_remove(mesh_virtual_address_t * virtual_address){
+    mesh_virtual_address_hash_index_remove(virtual_address);
     btstack_linked_list_remove(&mesh_virtual_addresses, (void *) virtual_address);
     mesh_virtual_addresses_used[virtual_address->pseudo_dst-0x8000] = 0;
 }
@@ -109,18 +137,18 @@ mesh_virtual_address_t * mesh_virtual_address_for_label_uuid(uint8_t * label_uui
 // virtual address iterator
 
 void mesh_virtual_address_iterator_init(mesh_virtual_address_iterator_t * it, uint16_t hash){
-    btstack_linked_list_iterator_init(&it->it, &mesh_virtual_addresses);
     it->hash = hash;
     it->address = NULL;
+    it->hash_next = *mesh_virtual_address_hash_bucket(hash);
 }
 
 int mesh_virtual_address_iterator_has_more(mesh_virtual_address_iterator_t * it){
-    // find next matching key
+    // find next matching address in bucket
     while (true){
-        printf("check %p\n", it->address);
         if (it->address && it->address->hash == it->hash) return 1;
-        if (!btstack_linked_list_iterator_has_next(&it->it)) break;
-        it->address = (mesh_virtual_address_t *) btstack_linked_list_iterator_next(&it->it);
+        if (it->hash_next == NULL) break;
+        it->address = it->hash_next;
+        it->hash_next = it->address->hash_next;
     }
     return 0;
 }
@@ -47,8 +47,10 @@ extern "C"
 {
 #endif
 
-typedef struct {
+typedef struct mesh_virtual_address_item {
 	btstack_linked_item_t item;
+    // next address in hash bucket
+    struct mesh_virtual_address_item * hash_next;
     uint16_t pseudo_dst;
     uint16_t hash;
     uint16_t ref_count;
@@ -56,9 +58,10 @@ typedef struct {
 } mesh_virtual_address_t;
 
 typedef struct {
-	btstack_linked_list_iterator_t it;
 	uint16_t hash;
 	mesh_virtual_address_t * address;
+	// next candidate in hash bucket
+	mesh_virtual_address_t * hash_next;
 } mesh_virtual_address_iterator_t;
 
 // virtual address management
@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// ATT DB micro-benchmark
+//
+// - builds a database with GAP, GATT, several HID services and custom 128-bit
+//   services using att_db_util
+// - runs ATT requests and GATT server lookups over all handles and services
+// - reports time per operation and a checksum over all responses, which has to
+//   be identical with and without ENABLE_ATT_DB_INDEX
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ble/att_db.h"
+#include "ble/att_db_util.h"
+#include "bluetooth_gatt.h"
+#include "btstack_crypto.h"
+#include "btstack_util.h"
+
+#define NUM_HID_SERVICES     4
+#define NUM_HID_REPORTS      8
+#define NUM_CUSTOM_SERVICES  8
+#define NUM_CUSTOM_CHARACTERISTICS 6
+#define NUM_ITERATIONS       200
+
+static att_connection_t att_connection;
+static uint8_t att_request[32];
+static uint8_t att_response[512];
+static uint32_t checksum;
+static uint16_t num_handles;
+
+static uint16_t att_read_callback(hci_con_handle_t con_handle, uint16_t attribute_handle, uint16_t offset, uint8_t * buffer, uint16_t buffer_size){
+    UNUSED(con_handle);
+    uint8_t value[2];
+    little_endian_store_16(value, 0, attribute_handle);
+    return att_read_callback_handle_blob(value, sizeof(value), offset, buffer, buffer_size);
+}
+
+// not used
+void btstack_crypto_aes128_cmac_generator(btstack_crypto_aes128_cmac_t * request, const uint8_t * key, uint16_t size, uint8_t (*get_byte_callback)(uint16_t pos), uint8_t * hash, void (* callback)(void * arg), void * callback_arg){
+    UNUSED(request);
+    UNUSED(key);
+    UNUSED(size);
+    UNUSED(get_byte_callback);
+    UNUSED(hash);
+    UNUSED(callback);
+    UNUSED(callback_arg);
+}
+
+static void setup_db(void){
+    uint8_t value[16];
+    uint8_t uuid128[16];
+    int i;
+    int j;
+    att_db_util_init();
+    att_db_util_add_service_uuid16(ORG_BLUETOOTH_SERVICE_GENERIC_ACCESS);
+    att_db_util_add_characteristic_uuid16(ORG_BLUETOOTH_CHARACTERISTIC_GAP_DEVICE_NAME, ATT_PROPERTY_READ, ATT_SECURITY_NONE, ATT_SECURITY_NONE, (uint8_t *) "ATT DB Bench", 12);
+    att_db_util_add_service_uuid16(ORG_BLUETOOTH_SERVICE_GENERIC_ATTRIBUTE);
+    att_db_util_add_characteristic_uuid16(ORG_BLUETOOTH_CHARACTERISTIC_GATT_SERVICE_CHANGED, ATT_PROPERTY_READ, ATT_SECURITY_NONE, ATT_SECURITY_NONE, value, 0);
+    for (i = 0; i < NUM_HID_SERVICES; i++){
+        att_db_util_add_service_uuid16(ORG_BLUETOOTH_SERVICE_HUMAN_INTERFACE_DEVICE);
+        att_db_util_add_characteristic_uuid16(ORG_BLUETOOTH_CHARACTERISTIC_PROTOCOL_MODE, ATT_PROPERTY_DYNAMIC | ATT_PROPERTY_READ | ATT_PROPERTY_WRITE_WITHOUT_RESPONSE, ATT_SECURITY_NONE, ATT_SECURITY_NONE, value, 0);
+        for (j = 0; j < NUM_HID_REPORTS; j++){
+            att_db_util_add_characteristic_uuid16(ORG_BLUETOOTH_CHARACTERISTIC_REPORT, ATT_PROPERTY_DYNAMIC | ATT_PROPERTY_READ | ATT_PROPERTY_WRITE | ATT_PROPERTY_NOTIFY, ATT_SECURITY_NONE, ATT_SECURITY_NONE, value, 0);
+            value[0] = (uint8_t) j;
+            value[1] = 1;
+            att_db_util_add_descriptor_uuid16(ORG_BLUETOOTH_DESCRIPTOR_REPORT_REFERENCE, ATT_PROPERTY_READ, ATT_SECURITY_NONE, ATT_SECURITY_NONE, value, 2);
+        }
+        att_db_util_add_characteristic_uuid16(ORG_BLUETOOTH_CHARACTERISTIC_REPORT_MAP, ATT_PROPERTY_DYNAMIC | ATT_PROPERTY_READ, ATT_SECURITY_NONE, ATT_SECURITY_NONE, value, 0);
+        att_db_util_add_characteristic_uuid16(ORG_BLUETOOTH_CHARACTERISTIC_HID_INFORMATION, ATT_PROPERTY_READ, ATT_SECURITY_NONE, ATT_SECURITY_NONE, value, 4);
+        att_db_util_add_characteristic_uuid16(ORG_BLUETOOTH_CHARACTERISTIC_HID_CONTROL_POINT, ATT_PROPERTY_DYNAMIC | ATT_PROPERTY_WRITE_WITHOUT_RESPONSE, ATT_SECURITY_NONE, ATT_SECURITY_NONE, value, 0);
+    }
+    for (i = 0; i < NUM_CUSTOM_SERVICES; i++){
+        for (j = 0; j < 16; j++){
+            uuid128[j] = (uint8_t) (0x10 * i + j);
+        }
+        att_db_util_add_service_uuid128(uuid128);
+        for (j = 0; j < NUM_CUSTOM_CHARACTERISTICS; j++){
+            uuid128[15] = (uint8_t) (0x80 + j);
+            att_db_util_add_characteristic_uuid128(uuid128, ATT_PROPERTY_DYNAMIC | ATT_PROPERTY_READ | ATT_PROPERTY_NOTIFY, ATT_SECURITY_NONE, ATT_SECURITY_NONE, value, 0);
+        }
+    }
+    att_db_util_add_service_uuid16(ORG_BLUETOOTH_SERVICE_BATTERY_SERVICE);
+    value[0] = 100;
+    uint16_t value_handle = att_db_util_add_characteristic_uuid16(ORG_BLUETOOTH_CHARACTERISTIC_BATTERY_LEVEL, ATT_PROPERTY_READ | ATT_PROPERTY_NOTIFY, ATT_SECURITY_NONE, ATT_SECURITY_NONE, value, 1);
+    // last attribute is Client Characteristic Configuration
+    num_handles = value_handle + 1u;
+
+    att_set_db(att_db_util_get_address());
+    att_set_read_callback(&att_read_callback);
+}
+
+static void request(uint16_t request_len){
+    uint16_t response_len = att_handle_request(&att_connection, att_request, request_len, att_response);
+    uint16_t i;
+    for (i = 0; i < response_len; i++){
+        checksum = (checksum * 31u) + att_response[i];
+    }
+}
+
+static uint16_t request_range(uint8_t opcode, uint16_t start_handle, uint16_t end_handle, uint16_t uuid16){
+    att_request[0] = opcode;
+    little_endian_store_16(att_request, 1, start_handle);
+    little_endian_store_16(att_request, 3, end_handle);
+    little_endian_store_16(att_request, 5, uuid16);
+    return 7;
+}
+
+static void bench_read(void){
+    uint16_t handle;
+    for (handle = 1; handle <= num_handles; handle++){
+        att_request[0] = ATT_READ_REQUEST;
+        little_endian_store_16(att_request, 1, handle);
+        request(3);
+    }
+}
+
+static void bench_find_information(void){
+    uint16_t handle;
+    for (handle = 1; handle <= num_handles; handle++){
+        request(request_range(ATT_FIND_INFORMATION_REQUEST, handle, 0xffff, 0) - 2u);
+    }
+}
+
+static void bench_read_by_type(void){
+    uint16_t handle;
+    for (handle = 1; handle <= num_handles; handle++){
+        request(request_range(ATT_READ_BY_TYPE_REQUEST, handle, 0xffff, GATT_CHARACTERISTICS_UUID));
+        request(request_range(ATT_READ_BY_TYPE_REQUEST, handle, handle + 10u, ORG_BLUETOOTH_CHARACTERISTIC_REPORT));
+    }
+}
+
+static void bench_read_by_group_type(void){
+    uint16_t handle;
+    for (handle = 1; handle <= num_handles; handle++){
+        request(request_range(ATT_READ_BY_GROUP_TYPE_REQUEST, handle, 0xffff, GATT_PRIMARY_SERVICE_UUID));
+        request(request_range(ATT_READ_BY_GROUP_TYPE_REQUEST, 1, handle, GATT_PRIMARY_SERVICE_UUID));
+    }
+}
+
+static void bench_find_by_type_value(void){
+    uint16_t handle;
+    for (handle = 1; handle <= num_handles; handle++){
+        uint16_t request_len = request_range(ATT_FIND_BY_TYPE_VALUE_REQUEST, handle, 0xffff, GATT_PRIMARY_SERVICE_UUID);
+        little_endian_store_16(att_request, 7, ORG_BLUETOOTH_SERVICE_HUMAN_INTERFACE_DEVICE);
+        request(request_len + 2u);
+        request_range(ATT_FIND_BY_TYPE_VALUE_REQUEST, 1, handle, GATT_PRIMARY_SERVICE_UUID);
+        request(request_len + 2u);
+    }
+}
+
+static void bench_gatt_server_lookups(void){
+    uint16_t start_handle = 1;
+    uint16_t end_handle = 0xffff;
+    while (gatt_server_get_handle_range_for_service_with_uuid16(ORG_BLUETOOTH_SERVICE_HUMAN_INTERFACE_DEVICE, &start_handle, &end_handle)){
+        checksum = (checksum * 31u) + start_handle + end_handle;
+        uint16_t handle = start_handle;
+        while (true){
+            handle = gatt_server_get_value_handle_for_characteristic_with_uuid16(handle, end_handle, ORG_BLUETOOTH_CHARACTERISTIC_REPORT);
+            if (handle == 0u) break;
+            checksum = (checksum * 31u) + handle;
+            checksum = (checksum * 31u) + gatt_server_get_client_configuration_handle_for_characteristic_with_uuid16(handle - 1u, end_handle, ORG_BLUETOOTH_CHARACTERISTIC_REPORT);
+            handle++;
+        }
+        start_handle = end_handle + 1u;
+        end_handle = 0xffff;
+    }
+    checksum = (checksum * 31u) + att_is_persistent_ccc(num_handles);
+}
+
+typedef struct {
+    const char * name;
+    void (*function)(void);
+} bench_t;
+
+static const bench_t benchmarks[] = {
+    { "read",               &bench_read },
+    { "find information",   &bench_find_information },
+    { "read by type",       &bench_read_by_type },
+    { "read by group type", &bench_read_by_group_type },
+    { "find by type value", &bench_find_by_type_value },
+    { "gatt server lookup", &bench_gatt_server_lookups },
+};
+
+static double time_ms(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+int main(void){
+
+    memset(&att_connection, 0, sizeof(att_connection));
+    att_connection.mtu = 185;
+    att_connection.max_mtu = 185;
+
+    setup_db();
+#ifdef ENABLE_ATT_DB_INDEX
+    printf("ATT DB with index, %u attributes\n", num_handles);
+#else
+    printf("ATT DB without index, %u attributes\n", num_handles);
+#endif
+
+    unsigned int i;
+    for (i = 0; i < sizeof(benchmarks) / sizeof(bench_t); i++){
+        checksum = 0;
+        double start = time_ms();
+        int iteration;
+        for (iteration = 0; iteration < NUM_ITERATIONS; iteration++){
+            (*benchmarks[i].function)();
+        }
+        double duration = time_ms() - start;
+        printf("%-20s %8.3f ms, checksum %08x\n", benchmarks[i].name, duration / NUM_ITERATIONS, checksum);
+    }
+    return 0;
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// AES-CCM / AES-CMAC micro-benchmark
+//
+// - measures per-message latency of btstack_crypto CCM encrypt/decrypt and CMAC
+//   for Mesh Network PDUs, segmented Upper Transport PDUs and GATT Database Hash
+//   sized messages
+// - built with software AES128 (bulk processing), with AES instructions
+//   (ENABLE_SOFTWARE_AES128_ACCELERATION), and with AES_BENCH_CONTROLLER_AES128,
+//   which uses the block-stepped HCI LE Encrypt state machine with a mock Controller
+//   that answers with the rijndael implementation
+// - reports a checksum over all outputs, which has to be identical for all builds
+//
+// *****************************************************************************
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "btstack_config.h"
+#include "btstack_crypto.h"
+#include "btstack_util.h"
+#include "hci.h"
+#include "rijndael.h"
+
+#define NUM_ITERATIONS 20000
+
+static const uint8_t key[16]  = { 0x63, 0x96, 0x47, 0x71, 0x73, 0x4f, 0xbd, 0x76, 0xe3, 0xb4, 0x05, 0x19, 0xd1, 0xd9, 0x4a, 0x48 };
+static const uint8_t nonce[13] = { 0x01, 0x80, 0x07, 0x08, 0x0d, 0x12, 0x34, 0x97, 0x36, 0x12, 0x34, 0x56, 0x77 };
+static uint8_t label_uuid[16] = { 0xf4, 0xa0, 0x02, 0xc7, 0xfb, 0x1e, 0x4c, 0xa0, 0xa4, 0x69, 0xa0, 0x21, 0xde, 0x0d, 0xb8, 0x75 };
+
+static uint8_t message[512];
+static uint8_t output[512];
+static uint8_t auth_value[16];
+static uint32_t checksum;
+
+static btstack_crypto_ccm_t ccm_request;
+static btstack_crypto_aes128_cmac_t cmac_request;
+
+// mock HCI: LE Encrypt result is reported from main loop
+static btstack_packet_callback_registration_t * crypto_event_handler;
+static uint8_t le_encrypt_result[6 + 16];
+static bool    le_encrypt_pending;
+
+void hci_add_event_handler(btstack_packet_callback_registration_t * callback_handler){
+    crypto_event_handler = callback_handler;
+}
+
+bool hci_can_send_command_packet_now(void){
+    return !le_encrypt_pending;
+}
+
+HCI_STATE hci_get_state(void){
+    return HCI_STATE_WORKING;
+}
+
+void hci_halting_defer(void){
+}
+
+uint8_t hci_send_cmd(const hci_cmd_t * cmd, ...){
+    if (cmd->opcode != hci_le_encrypt.opcode) return ERROR_CODE_UNKNOWN_HCI_COMMAND;
+    va_list argptr;
+    va_start(argptr, cmd);
+    const uint8_t * key_flipped       = va_arg(argptr, const uint8_t *);
+    const uint8_t * plaintext_flipped = va_arg(argptr, const uint8_t *);
+    va_end(argptr);
+    uint8_t key_be[16];
+    uint8_t plaintext_be[16];
+    uint8_t ciphertext_be[16];
+    reverse_128(key_flipped, key_be);
+    reverse_128(plaintext_flipped, plaintext_be);
+    uint32_t rk[RKLENGTH(KEYBITS)];
+    int nrounds = rijndaelSetupEncrypt(rk, key_be, KEYBITS);
+    rijndaelEncrypt(rk, nrounds, plaintext_be, ciphertext_be);
+    le_encrypt_result[0] = HCI_EVENT_COMMAND_COMPLETE;
+    le_encrypt_result[1] = sizeof(le_encrypt_result) - 2u;
+    le_encrypt_result[2] = 1;
+    little_endian_store_16(le_encrypt_result, 3, hci_le_encrypt.opcode);
+    le_encrypt_result[5] = ERROR_CODE_SUCCESS;
+    reverse_128(ciphertext_be, &le_encrypt_result[6]);
+    le_encrypt_pending = true;
+    return ERROR_CODE_SUCCESS;
+}
+
+static void crypto_done(void * arg){
+    UNUSED(arg);
+}
+
+static void crypto_wait(void){
+    while (le_encrypt_pending){
+        le_encrypt_pending = false;
+        (*crypto_event_handler->callback)(HCI_EVENT_PACKET, 0, le_encrypt_result, sizeof(le_encrypt_result));
+    }
+}
+
+static void update_checksum(const uint8_t * data, uint16_t len){
+    uint16_t i;
+    for (i = 0; i < len; i++){
+        checksum = (checksum * 31u) + data[i];
+    }
+}
+
+static void ccm_encrypt(uint16_t len, uint16_t aad_len, uint8_t auth_len){
+    btstack_crypto_ccm_init(&ccm_request, key, nonce, len, aad_len, auth_len);
+    if (aad_len > 0u){
+        btstack_crypto_ccm_digest(&ccm_request, label_uuid, aad_len, &crypto_done, NULL);
+        crypto_wait();
+    }
+    btstack_crypto_ccm_encrypt_block(&ccm_request, len, message, output, &crypto_done, NULL);
+    crypto_wait();
+    btstack_crypto_ccm_get_authentication_value(&ccm_request, auth_value);
+}
+
+static void ccm_decrypt(uint16_t len, uint16_t aad_len, uint8_t auth_len){
+    btstack_crypto_ccm_init(&ccm_request, key, nonce, len, aad_len, auth_len);
+    if (aad_len > 0u){
+        btstack_crypto_ccm_digest(&ccm_request, label_uuid, aad_len, &crypto_done, NULL);
+        crypto_wait();
+    }
+    btstack_crypto_ccm_decrypt_block(&ccm_request, len, message, output, &crypto_done, NULL);
+    crypto_wait();
+    btstack_crypto_ccm_get_authentication_value(&ccm_request, auth_value);
+}
+
+static void cmac(uint16_t len){
+    btstack_crypto_aes128_cmac_message(&cmac_request, key, len, message, auth_value, &crypto_done, NULL);
+    crypto_wait();
+}
+
+// Network PDU: 16 byte payload, 32-bit NetMIC
+static void bench_ccm_network_pdu(void){
+    ccm_encrypt(16, 0, 4);
+    update_checksum(output, 16);
+    update_checksum(auth_value, 4);
+}
+
+// Upper Transport PDU with virtual address: max. size, label uuid as aad, 64-bit TransMIC
+static void bench_ccm_upper_transport_encrypt(void){
+    ccm_encrypt(376, 16, 8);
+    update_checksum(output, 376);
+    update_checksum(auth_value, 8);
+}
+
+static void bench_ccm_upper_transport_decrypt(void){
+    ccm_decrypt(376, 16, 8);
+    update_checksum(output, 376);
+    update_checksum(auth_value, 8);
+}
+
+static void bench_cmac_16(void){
+    cmac(16);
+    update_checksum(auth_value, 16);
+}
+
+static void bench_cmac_64(void){
+    cmac(64);
+    update_checksum(auth_value, 16);
+}
+
+static void bench_cmac_512(void){
+    cmac(512);
+    update_checksum(auth_value, 16);
+}
+
+typedef struct {
+    const char * name;
+    void (*function)(void);
+} bench_t;
+
+static const bench_t benchmarks[] = {
+    { "ccm encrypt 16",  &bench_ccm_network_pdu },
+    { "ccm encrypt 376", &bench_ccm_upper_transport_encrypt },
+    { "ccm decrypt 376", &bench_ccm_upper_transport_decrypt },
+    { "cmac 16",         &bench_cmac_16 },
+    { "cmac 64",         &bench_cmac_64 },
+    { "cmac 512",        &bench_cmac_512 },
+};
+
+static double time_us(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000000.0) + (ts.tv_nsec / 1000.0);
+}
+
+int main(void){
+    uint16_t i;
+    for (i = 0; i < sizeof(message); i++){
+        message[i] = (uint8_t) (i * 7 + 3);
+    }
+
+    btstack_crypto_init();
+
+#if defined(AES_BENCH_CONTROLLER_AES128)
+    printf("AES128 via HCI LE Encrypt, block-stepped\n");
+#elif defined(ENABLE_SOFTWARE_AES128_ACCELERATION)
+    printf("Software AES128 with AES instructions, bulk\n");
+#else
+    printf("Software AES128, bulk\n");
+#endif
+
+    unsigned int j;
+    for (j = 0; j < sizeof(benchmarks) / sizeof(bench_t); j++){
+        checksum = 0;
+        double start = time_us();
+        int iteration;
+        for (iteration = 0; iteration < NUM_ITERATIONS; iteration++){
+            (*benchmarks[j].function)();
+        }
+        double duration = time_us() - start;
+        printf("%-16s %8.3f us, checksum %08x\n", benchmarks[j].name, duration / NUM_ITERATIONS, checksum);
+    }
+    return 0;
+}
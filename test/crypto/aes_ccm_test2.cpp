@@ -0,0 +1,232 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "hci.h"
+#include "btstack_util.h"
+#include "bluetooth.h"
+#include "btstack_crypto.h"
+
+extern "C" {
+#include "aes_ccm.h"
+void aes128_calc_cyphertext(const uint8_t key[16], const uint8_t plaintext[16], uint8_t cyphertext[16]);
+void aes_cmac(sm_key_t aes_cmac, const sm_key_t key, const uint8_t * data, int sm_cmac_message_len);
+}
+
+// CCM and CMAC of btstack_crypto checked against reference implementations for all message sizes
+// used by Mesh, with the message passed in one or more blocks
+
+#define MAX_MESSAGE_LEN 384
+
+static const uint8_t key[16]  = { 0x63, 0x96, 0x47, 0x71, 0x73, 0x4f, 0xbd, 0x76, 0xe3, 0xb4, 0x05, 0x19, 0xd1, 0xd9, 0x4a, 0x48 };
+static uint8_t nonce[13]      = { 0x01, 0x80, 0x07, 0x08, 0x0d, 0x12, 0x34, 0x97, 0x36, 0x12, 0x34, 0x56, 0x77 };
+static const uint8_t aad[16]  = { 0xf4, 0xa0, 0x02, 0xc7, 0xfb, 0x1e, 0x4c, 0xa0, 0xa4, 0x69, 0xa0, 0x21, 0xde, 0x0d, 0xb8, 0x75 };
+
+static uint8_t message[MAX_MESSAGE_LEN];
+static uint8_t expected[MAX_MESSAGE_LEN + 8];
+static uint8_t actual[MAX_MESSAGE_LEN];
+static uint8_t mic[8];
+static int callback_count;
+
+static btstack_crypto_ccm_t ccm_request;
+static btstack_crypto_aes128_cmac_t cmac_request;
+
+static void crypto_done(void * arg){
+    UNUSED(arg);
+    callback_count++;
+}
+
+static uint8_t get_message_byte(uint16_t pos){
+    return message[pos];
+}
+
+// mock
+extern "C" {
+    void hci_add_event_handler(btstack_packet_callback_registration_t * callback_handler){
+    }
+    bool hci_can_send_command_packet_now(void){
+        return true;
+    }
+    HCI_STATE hci_get_state(void){
+        return HCI_STATE_WORKING;
+    }
+    void hci_halting_defer(void){
+    }
+    uint8_t hci_send_cmd(const hci_cmd_t *cmd, ...){
+        printf("hci_send_cmd opcode %04x\n", cmd->opcode);
+        return ERROR_CODE_SUCCESS;
+    }
+}
+
+static void ccm_encrypt(uint16_t len, uint16_t aad_len, uint8_t mic_len, uint16_t block_size){
+    btstack_crypto_ccm_init(&ccm_request, key, nonce, len, aad_len, mic_len);
+    if (aad_len > 0){
+        btstack_crypto_ccm_digest(&ccm_request, (uint8_t *) aad, aad_len, &crypto_done, NULL);
+    }
+    uint16_t offset = 0;
+    while (offset < len){
+        uint16_t block_len = btstack_min(block_size, len - offset);
+        btstack_crypto_ccm_encrypt_block(&ccm_request, block_len, &message[offset], &actual[offset], &crypto_done, NULL);
+        offset += block_len;
+    }
+    btstack_crypto_ccm_get_authentication_value(&ccm_request, mic);
+}
+
+static void ccm_decrypt(uint16_t len, uint16_t aad_len, uint8_t mic_len, uint16_t block_size){
+    btstack_crypto_ccm_init(&ccm_request, key, nonce, len, aad_len, mic_len);
+    if (aad_len > 0){
+        btstack_crypto_ccm_digest(&ccm_request, (uint8_t *) aad, aad_len, &crypto_done, NULL);
+    }
+    uint16_t offset = 0;
+    while (offset < len){
+        uint16_t block_len = btstack_min(block_size, len - offset);
+        btstack_crypto_ccm_decrypt_block(&ccm_request, block_len, &expected[offset], &actual[offset], &crypto_done, NULL);
+        offset += block_len;
+    }
+    btstack_crypto_ccm_get_authentication_value(&ccm_request, mic);
+}
+
+static void check_ccm(uint16_t len, uint16_t aad_len, uint8_t mic_len, uint16_t block_size){
+    bt_mesh_ccm_encrypt(key, nonce, message, len, aad_len ? aad : NULL, aad_len, expected, mic_len);
+
+    memset(actual, 0, sizeof(actual));
+    callback_count = 0;
+    ccm_encrypt(len, aad_len, mic_len, block_size);
+    CHECK_EQUAL(0, memcmp(expected, actual, len));
+    CHECK_EQUAL(0, memcmp(&expected[len], mic, mic_len));
+    CHECK_EQUAL((aad_len ? 1 : 0) + ((len + block_size - 1) / block_size), callback_count);
+
+    memset(actual, 0, sizeof(actual));
+    ccm_decrypt(len, aad_len, mic_len, block_size);
+    CHECK_EQUAL(0, memcmp(message, actual, len));
+    CHECK_EQUAL(0, memcmp(&expected[len], mic, mic_len));
+
+    CHECK_TRUE(btstack_crypto_idle() != 0);
+}
+
+TEST_GROUP(AES_CCM){
+    void setup(void){
+        btstack_crypto_init();
+        uint16_t i;
+        for (i = 0; i < MAX_MESSAGE_LEN; i++){
+            message[i] = (uint8_t) (i * 7 + 3);
+        }
+    }
+};
+
+TEST(AES_CCM, NetworkPDU){
+    uint16_t len;
+    for (len = 1; len <= 20; len++){
+        check_ccm(len, 0, 4, len);
+        check_ccm(len, 0, 8, len);
+    }
+}
+
+TEST(AES_CCM, UpperTransportPDU){
+    uint16_t len;
+    for (len = 1; len <= MAX_MESSAGE_LEN; len += 13){
+        check_ccm(len, 0, 4, len);
+        check_ccm(len, 16, 8, len);
+    }
+}
+
+TEST(AES_CCM, Blocks){
+    uint16_t len;
+    for (len = 1; len <= 100; len += 3){
+        check_ccm(len, 16, 8, 16);
+        check_ccm(len, 0,  4, 32);
+    }
+}
+
+TEST(AES_CCM, InPlace){
+    uint16_t len = 100;
+    bt_mesh_ccm_encrypt(key, nonce, message, len, aad, sizeof(aad), expected, 8);
+    memcpy(actual, message, len);
+    btstack_crypto_ccm_init(&ccm_request, key, nonce, len, sizeof(aad), 8);
+    btstack_crypto_ccm_digest(&ccm_request, (uint8_t *) aad, sizeof(aad), &crypto_done, NULL);
+    btstack_crypto_ccm_encrypt_block(&ccm_request, len, actual, actual, &crypto_done, NULL);
+    btstack_crypto_ccm_get_authentication_value(&ccm_request, mic);
+    CHECK_EQUAL(0, memcmp(expected, actual, len));
+    CHECK_EQUAL(0, memcmp(&expected[len], mic, 8));
+}
+
+TEST_GROUP(AES_CMAC){
+    void setup(void){
+        btstack_crypto_init();
+        uint16_t i;
+        for (i = 0; i < MAX_MESSAGE_LEN; i++){
+            message[i] = (uint8_t) (i * 13 + 5);
+        }
+    }
+};
+
+TEST(AES_CMAC, MessageAndGenerator){
+    uint16_t len;
+    sm_key_t cmac_expected;
+    sm_key_t cmac_actual;
+    for (len = 0; len <= 100; len++){
+        aes_cmac(cmac_expected, key, message, len);
+        btstack_crypto_aes128_cmac_message(&cmac_request, key, len, message, cmac_actual, &crypto_done, NULL);
+        CHECK_EQUAL(0, memcmp(cmac_expected, cmac_actual, 16));
+        memset(cmac_actual, 0, 16);
+        btstack_crypto_aes128_cmac_generator(&cmac_request, key, len, &get_message_byte, cmac_actual, &crypto_done, NULL);
+        CHECK_EQUAL(0, memcmp(cmac_expected, cmac_actual, 16));
+    }
+}
+
+TEST(AES_CMAC, AES128){
+    uint8_t ciphertext[16];
+    uint8_t reference[16];
+    uint16_t i;
+    for (i = 0; i < 16; i++){
+        btstack_aes128_calc(key, &message[i * 16], ciphertext);
+        aes128_calc_cyphertext(key, &message[i * 16], reference);
+        CHECK_EQUAL(0, memcmp(reference, ciphertext, 16));
+    }
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
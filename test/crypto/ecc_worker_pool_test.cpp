@@ -0,0 +1,337 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// ECC P-256 operations on POSIX worker pool, requires ENABLE_MICRO_ECC_P256 and ENABLE_ECC_P256_WORKER_POOL for btstack_crypto.c
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "hci.h"
+#include "btstack_util.h"
+#include "btstack_run_loop.h"
+#include "btstack_run_loop_posix.h"
+#include "btstack_crypto.h"
+#include "btstack_crypto_worker_pool_posix.h"
+#include "uECC.h"
+
+// P256 Set 1
+static const char * set1_private_a_string = "3f49f6d4a3c55f3874c9b3e3d2103f504aff607beb40b7995899b8a6cd3c1abd";
+static const char * set1_private_b_string = "55188b3d32f6bb9a900afcfbeed4e72a59cb9ac2f19d7cfb6b4fdd49f47fc5fd";
+static const char * set1_public_a_string = \
+    "20b003d2f297be2c5e2c83a7e9f9a5b9eff49111acf4fddbcc0301480e359de6" \
+    "dc809c49652aeb6d63329abf5a52155c766345c28fed3024741c8ed01589d28b";
+static const char * set1_public_b_string = \
+    "1ea1f0f01faf1d9609592284f19e4c0047b58afd8615a69f559077b22faaa190" \
+    "4c55f33e429dad377356703a9ab85160472d1130e28e36765f89aff915b1214a";
+static const char * set1_dh_key_string    = "ec0234a357c8ad05341010a60a397d9b99796b13b4f866f1868d34f373bfa698";
+
+#define NUM_REQUESTS 6
+
+static btstack_crypto_ecc_p256_t ecc_requests[NUM_REQUESTS];
+static uint8_t  dhkeys[NUM_REQUESTS][32];
+static uint8_t  generated_public_key[64];
+static int      num_callbacks;
+static int      num_expected_callbacks;
+static bool     callbacks_on_main_thread;
+static pthread_t main_thread;
+
+static btstack_packet_handler_t crypto_event_handler;
+static btstack_context_callback_registration_t le_rand_complete_registration;
+static uint8_t  le_rand_counter;
+
+static int parse_hex(uint8_t * buffer, const char * hex_string){
+    int len = 0;
+    while (*hex_string){
+        int high_nibble = nibble_for_char(*hex_string++);
+        int low_nibble = nibble_for_char(*hex_string++);
+        *buffer++ = (high_nibble << 4) | low_nibble;
+        len++;
+    }
+    return len;
+}
+
+static void CHECK_EQUAL_ARRAY(const uint8_t * expected, const uint8_t * actual, int size){
+    for (int i=0; i<size; i++){
+        BYTES_EQUAL(expected[i], actual[i]);
+    }
+}
+
+static void ecc_operation_complete(void * arg){
+    UNUSED(arg);
+    if (pthread_equal(pthread_self(), main_thread) == 0){
+        callbacks_on_main_thread = false;
+    }
+    num_callbacks++;
+    if (num_callbacks == num_expected_callbacks){
+        btstack_run_loop_trigger_exit();
+    }
+}
+
+// deliver HCI LE Rand Command Complete with counter as random data
+static void le_rand_complete(void * context){
+    UNUSED(context);
+    uint8_t event[] = { HCI_EVENT_COMMAND_COMPLETE, 12, 1, 0x18, 0x20, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    uint8_t i;
+    for (i = 0; i < 8; i++){
+        event[6 + i] = le_rand_counter++;
+    }
+    (*crypto_event_handler)(HCI_EVENT_PACKET, 0, event, sizeof(event));
+}
+
+// mock
+extern "C" {
+    void hci_add_event_handler(btstack_packet_callback_registration_t * callback_handler){
+        crypto_event_handler = callback_handler->callback;
+    }
+    bool hci_can_send_command_packet_now(void){
+        return true;
+    }
+    HCI_STATE hci_get_state(void){
+        return HCI_STATE_WORKING;
+    }
+    void hci_halting_defer(void){
+    }
+    uint8_t hci_send_cmd(const hci_cmd_t *cmd, ...){
+        if (cmd->opcode == hci_le_rand.opcode){
+            le_rand_complete_registration.callback = &le_rand_complete;
+            btstack_run_loop_execute_on_main_thread(&le_rand_complete_registration);
+        }
+        return ERROR_CODE_SUCCESS;
+    }
+}
+
+TEST_GROUP(ECC_WORKER_POOL){
+    const btstack_crypto_worker_pool_t * worker_pool;
+    void setup(void){
+        main_thread = pthread_self();
+        num_callbacks = 0;
+        num_expected_callbacks = 0;
+        callbacks_on_main_thread = true;
+        le_rand_counter = 0;
+        memset(dhkeys, 0, sizeof(dhkeys));
+        btstack_run_loop_init(btstack_run_loop_posix_get_instance());
+        btstack_crypto_init();
+        worker_pool = btstack_crypto_worker_pool_posix_init_instance(3);
+        CHECK(worker_pool != NULL);
+        btstack_crypto_ecc_p256_set_worker_pool(worker_pool);
+    }
+    void teardown(void){
+        btstack_crypto_ecc_p256_set_worker_pool(NULL);
+        btstack_crypto_worker_pool_posix_deinit();
+        btstack_crypto_deinit();
+        btstack_run_loop_deinit();
+    }
+};
+
+TEST(ECC_WORKER_POOL, NumWorkers){
+    CHECK_EQUAL(3, (*worker_pool->get_num_workers)());
+}
+
+TEST(ECC_WORKER_POOL, DHKeyParallel){
+    uint8_t private_a[32];
+    uint8_t public_a[64];
+    uint8_t public_b[64];
+    uint8_t dhkey[32];
+    parse_hex(private_a, set1_private_a_string);
+    parse_hex(public_a,  set1_public_a_string);
+    parse_hex(public_b,  set1_public_b_string);
+    parse_hex(dhkey,     set1_dh_key_string);
+    btstack_crypto_ecc_p256_set_key(public_a, private_a);
+
+    // more requests than workers
+    num_expected_callbacks = NUM_REQUESTS;
+    for (int i = 0; i < NUM_REQUESTS; i++){
+        btstack_crypto_ecc_p256_calculate_dhkey(&ecc_requests[i], public_b, dhkeys[i], &ecc_operation_complete, NULL);
+    }
+    // results are reported on main thread
+    CHECK_EQUAL(0, num_callbacks);
+    btstack_run_loop_execute();
+
+    CHECK_EQUAL(NUM_REQUESTS, num_callbacks);
+    CHECK_TRUE(callbacks_on_main_thread);
+    for (int i = 0; i < NUM_REQUESTS; i++){
+        CHECK_EQUAL_ARRAY(dhkey, dhkeys[i], 32);
+    }
+}
+
+TEST(ECC_WORKER_POOL, DHKeyOnMainThread){
+    uint8_t private_a[32];
+    uint8_t public_a[64];
+    uint8_t public_b[64];
+    uint8_t dhkey[32];
+    parse_hex(private_a, set1_private_a_string);
+    parse_hex(public_a,  set1_public_a_string);
+    parse_hex(public_b,  set1_public_b_string);
+    parse_hex(dhkey,     set1_dh_key_string);
+    btstack_crypto_ecc_p256_set_key(public_a, private_a);
+
+    // without worker pool, DH Key is calculated synchronously
+    btstack_crypto_ecc_p256_set_worker_pool(NULL);
+    btstack_crypto_ecc_p256_calculate_dhkey(&ecc_requests[0], public_b, dhkeys[0], &ecc_operation_complete, NULL);
+    CHECK_EQUAL(1, num_callbacks);
+    CHECK_EQUAL_ARRAY(dhkey, dhkeys[0], 32);
+}
+
+TEST(ECC_WORKER_POOL, GenerateKeyThenDHKey){
+    uint8_t private_b[32];
+    uint8_t public_b[64];
+    uint8_t expected_dhkey[32];
+    parse_hex(private_b, set1_private_b_string);
+    parse_hex(public_b,  set1_public_b_string);
+
+    // DH Key calculations are queued until key pair is ready
+    num_expected_callbacks = NUM_REQUESTS;
+    btstack_crypto_ecc_p256_generate_key(&ecc_requests[0], generated_public_key, &ecc_operation_complete, NULL);
+    for (int i = 1; i < NUM_REQUESTS; i++){
+        btstack_crypto_ecc_p256_calculate_dhkey(&ecc_requests[i], public_b, dhkeys[i], &ecc_operation_complete, NULL);
+    }
+    btstack_run_loop_execute();
+
+    CHECK_EQUAL(NUM_REQUESTS, num_callbacks);
+    CHECK_TRUE(callbacks_on_main_thread);
+    CHECK_EQUAL(0, btstack_crypto_ecc_p256_validate_public_key(generated_public_key));
+
+    // remote side calculates same DH Key
+    uECC_shared_secret(generated_public_key, private_b, expected_dhkey);
+    for (int i = 1; i < NUM_REQUESTS; i++){
+        CHECK_EQUAL_ARRAY(expected_dhkey, dhkeys[i], 32);
+    }
+}
+
+TEST(ECC_WORKER_POOL, GenerateKeyWaitsForDHKey){
+    uint8_t private_a[32];
+    uint8_t public_a[64];
+    uint8_t public_b[64];
+    uint8_t dhkey[32];
+    parse_hex(private_a, set1_private_a_string);
+    parse_hex(public_a,  set1_public_a_string);
+    parse_hex(public_b,  set1_public_b_string);
+    parse_hex(dhkey,     set1_dh_key_string);
+    btstack_crypto_ecc_p256_set_key(public_a, private_a);
+
+    // new key pair does not affect ongoing DH Key calculations
+    num_expected_callbacks = 3;
+    btstack_crypto_ecc_p256_calculate_dhkey(&ecc_requests[0], public_b, dhkeys[0], &ecc_operation_complete, NULL);
+    btstack_crypto_ecc_p256_calculate_dhkey(&ecc_requests[1], public_b, dhkeys[1], &ecc_operation_complete, NULL);
+    btstack_crypto_ecc_p256_generate_key(&ecc_requests[2], generated_public_key, &ecc_operation_complete, NULL);
+    btstack_run_loop_execute();
+
+    CHECK_EQUAL(3, num_callbacks);
+    CHECK_EQUAL_ARRAY(dhkey, dhkeys[0], 32);
+    CHECK_EQUAL_ARRAY(dhkey, dhkeys[1], 32);
+    CHECK(memcmp(public_a, generated_public_key, 64) != 0);
+}
+
+static volatile bool blocking_job_released;
+static int num_jobs_done;
+
+static void blocking_job_work(btstack_crypto_worker_job_t * job){
+    UNUSED(job);
+    while (blocking_job_released == false){
+        usleep(1000);
+    }
+}
+
+static void job_work(btstack_crypto_worker_job_t * job){
+    UNUSED(job);
+}
+
+static void job_done(void * context){
+    UNUSED(context);
+    num_jobs_done++;
+    if (num_jobs_done == 2){
+        btstack_run_loop_trigger_exit();
+    }
+}
+
+static void * release_blocking_job(void * context){
+    UNUSED(context);
+    // deinit has stopped the pool by now
+    usleep(20000);
+    blocking_job_released = true;
+    return NULL;
+}
+
+static void run_loop_timeout(btstack_timer_source_t * ts){
+    UNUSED(ts);
+    btstack_run_loop_trigger_exit();
+}
+
+TEST(ECC_WORKER_POOL, DeinitCompletesPendingJobs){
+    btstack_crypto_ecc_p256_set_worker_pool(NULL);
+    btstack_crypto_worker_pool_posix_deinit();
+    worker_pool = btstack_crypto_worker_pool_posix_init_instance(1);
+    CHECK(worker_pool != NULL);
+
+    // second job is pending while the only worker is busy
+    static btstack_crypto_worker_job_t jobs[2];
+    memset(jobs, 0, sizeof(jobs));
+    jobs[0].work = &blocking_job_work;
+    jobs[1].work = &job_work;
+    for (int i = 0; i < 2; i++){
+        jobs[i].done.callback = &job_done;
+    }
+    blocking_job_released = false;
+    num_jobs_done = 0;
+    (*worker_pool->execute)(&jobs[0]);
+    (*worker_pool->execute)(&jobs[1]);
+
+    pthread_t release_thread;
+    pthread_create(&release_thread, NULL, &release_blocking_job, NULL);
+    btstack_crypto_worker_pool_posix_deinit();
+    pthread_join(release_thread, NULL);
+
+    // both jobs report done on main thread
+    static btstack_timer_source_t timeout;
+    btstack_run_loop_set_timer_handler(&timeout, &run_loop_timeout);
+    btstack_run_loop_set_timer(&timeout, 1000);
+    btstack_run_loop_add_timer(&timeout);
+    btstack_run_loop_execute();
+    btstack_run_loop_remove_timer(&timeout);
+    CHECK_EQUAL(2, num_jobs_done);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
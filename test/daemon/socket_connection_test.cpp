@@ -0,0 +1,310 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "socket_connection.h"
+
+#include "btstack_defines.h"
+#include "btstack_run_loop.h"
+#include "btstack_util.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#define TEST_SOCKET "/tmp/btstack_socket_connection_test"
+
+#define MAX_CLIENTS      2
+#define PACKET_SIZE      1000
+#define HEADER_SIZE      6
+#define MAX_DATA_SOURCES 8
+
+static connection_t * connections[MAX_CLIENTS];
+static int            client_fds[MAX_CLIENTS];
+static int            num_connections_opened;
+static int            num_connections_closed;
+static int            num_packets_received;
+
+static uint8_t packet[PACKET_SIZE];
+static uint8_t receive_buffer[MAX_CLIENTS][600 * (HEADER_SIZE + PACKET_SIZE)];
+static size_t  receive_len[MAX_CLIENTS];
+static bool    receive_eof[MAX_CLIENTS];
+
+// run loop driven by test using poll
+
+static uint32_t test_run_loop_get_time_ms(void){
+    return 0;
+}
+
+static void test_run_loop_set_timer(btstack_timer_source_t * ts, uint32_t timeout_in_ms){
+    ts->timeout = timeout_in_ms;
+}
+
+static void test_run_loop_poll_data_sources_from_irq(void){
+}
+
+static const btstack_run_loop_t test_run_loop = {
+    &btstack_run_loop_base_init,
+    &btstack_run_loop_base_add_data_source,
+    &btstack_run_loop_base_remove_data_source,
+    &btstack_run_loop_base_enable_data_source_callbacks,
+    &btstack_run_loop_base_disable_data_source_callbacks,
+    &test_run_loop_set_timer,
+    &btstack_run_loop_base_add_timer,
+    &btstack_run_loop_base_remove_timer,
+    NULL, // execute
+    &btstack_run_loop_base_dump_timer,
+    &test_run_loop_get_time_ms,
+    &test_run_loop_poll_data_sources_from_irq,
+    NULL, // execute_on_main_thread
+    NULL, // trigger_exit
+};
+
+static void test_run_loop_process(int timeout_ms){
+    struct pollfd fds[MAX_DATA_SOURCES];
+    btstack_data_source_t * data_sources[MAX_DATA_SOURCES];
+    int num_fds = 0;
+    btstack_linked_item_t * it;
+    for (it = (btstack_linked_item_t *) btstack_run_loop_base_data_sources; it != NULL; it = it->next){
+        btstack_data_source_t * ds = (btstack_data_source_t *) it;
+        if (num_fds == MAX_DATA_SOURCES) break;
+        fds[num_fds].fd = ds->source.fd;
+        fds[num_fds].events = 0;
+        if (ds->flags & DATA_SOURCE_CALLBACK_READ){
+            fds[num_fds].events |= POLLIN;
+        }
+        if (ds->flags & DATA_SOURCE_CALLBACK_WRITE){
+            fds[num_fds].events |= POLLOUT;
+        }
+        data_sources[num_fds] = ds;
+        num_fds++;
+    }
+    if (poll(fds, num_fds, timeout_ms) <= 0) return;
+    int i;
+    for (i = 0; i < num_fds; i++){
+        btstack_data_source_t * ds = data_sources[i];
+        if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)){
+            if ((ds->flags & DATA_SOURCE_CALLBACK_READ) != 0){
+                // connection might get freed
+                btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_READ);
+                continue;
+            }
+        }
+        if ((fds[i].revents & POLLOUT) && (ds->flags & DATA_SOURCE_CALLBACK_WRITE)){
+            btstack_run_loop_base_process_data_source(ds, DATA_SOURCE_CALLBACK_WRITE);
+        }
+    }
+}
+
+static int packet_handler(connection_t * connection, uint16_t packet_type, uint16_t channel, uint8_t * data, uint16_t length){
+    UNUSED(channel);
+    UNUSED(length);
+    if (packet_type != DAEMON_EVENT_PACKET){
+        num_packets_received++;
+        return 0;
+    }
+    switch (data[0]){
+        case DAEMON_EVENT_CONNECTION_OPENED:
+            connections[num_connections_opened++] = connection;
+            break;
+        case DAEMON_EVENT_CONNECTION_CLOSED:
+            num_connections_closed++;
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
+
+static void client_connect(int index){
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    CHECK(fd >= 0);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, TEST_SOCKET);
+    CHECK_EQUAL(0, connect(fd, (struct sockaddr *) &addr, sizeof(addr)));
+    client_fds[index] = fd;
+    int i;
+    for (i = 0; (i < 100) && (num_connections_opened <= index); i++){
+        test_run_loop_process(10);
+    }
+    CHECK_EQUAL(index + 1, num_connections_opened);
+}
+
+// read available data from client sockets
+static void clients_receive(int num_clients){
+    int i;
+    for (i = 0; i < num_clients; i++){
+        if (receive_eof[i]) continue;
+        while (receive_len[i] < sizeof(receive_buffer[i])){
+            ssize_t res = recv(client_fds[i], &receive_buffer[i][receive_len[i]], sizeof(receive_buffer[i]) - receive_len[i], MSG_DONTWAIT);
+            if (res == 0){
+                receive_eof[i] = true;
+            }
+            if (res <= 0) break;
+            receive_len[i] += (size_t) res;
+        }
+    }
+}
+
+// process run loop and read from clients until all clients received num_bytes or eof
+static void clients_receive_all(int num_clients, size_t num_bytes){
+    int iterations;
+    for (iterations = 0; iterations < 10000; iterations++){
+        test_run_loop_process(1);
+        clients_receive(num_clients);
+        int i;
+        bool done = true;
+        for (i = 0; i < num_clients; i++){
+            if ((receive_len[i] < num_bytes) && (receive_eof[i] == false)){
+                done = false;
+            }
+        }
+        if (done) break;
+    }
+}
+
+static void send_packets(connection_t * connection, uint16_t num_packets){
+    uint16_t i;
+    for (i = 0; i < num_packets; i++){
+        little_endian_store_16(packet, 0, i);
+        if (connection == NULL){
+            socket_connection_send_packet_all(HCI_EVENT_PACKET, 0, packet, sizeof(packet));
+        } else {
+            socket_connection_send_packet(connection, HCI_EVENT_PACKET, 0, packet, sizeof(packet));
+        }
+    }
+}
+
+// returns number of packets received by client in order
+static uint16_t check_packets(int index){
+    size_t pos = 0;
+    uint16_t i = 0;
+    while ((pos + HEADER_SIZE + PACKET_SIZE) <= receive_len[index]){
+        if (little_endian_read_16(receive_buffer[index], pos) != HCI_EVENT_PACKET) break;
+        if (little_endian_read_16(receive_buffer[index], pos + 4) != PACKET_SIZE) break;
+        if (little_endian_read_16(receive_buffer[index], pos + HEADER_SIZE) != i) break;
+        pos += HEADER_SIZE + PACKET_SIZE;
+        i++;
+    }
+    return i;
+}
+
+TEST_GROUP(SocketConnection){
+    int num_clients;
+    void setup(void){
+        memset(connections, 0, sizeof(connections));
+        memset(receive_len, 0, sizeof(receive_len));
+        memset(receive_eof, 0, sizeof(receive_eof));
+        memset(packet, 0x55, sizeof(packet));
+        num_connections_opened = 0;
+        num_connections_closed = 0;
+        num_packets_received = 0;
+        num_clients = 0;
+        btstack_run_loop_init(&test_run_loop);
+        socket_connection_register_packet_callback(&packet_handler);
+        socket_connection_set_tx_limits(64 * 1024, 4 * 1024 * 1024);
+        socket_connection_create_unix((char *) TEST_SOCKET);
+    }
+    void connect_clients(int count){
+        int i;
+        for (i = 0; i < count; i++){
+            client_connect(i);
+        }
+        num_clients = count;
+    }
+    void teardown(void){
+        // close connections
+        int i;
+        for (i = 0; i < num_clients; i++){
+            close(client_fds[i]);
+        }
+        for (i = 0; (i < 100) && (num_connections_closed < num_connections_opened); i++){
+            test_run_loop_process(10);
+        }
+        CHECK_EQUAL(num_connections_opened, num_connections_closed);
+        // only listening socket is left, created by socket_connection_create_unix
+        btstack_data_source_t * ds = (btstack_data_source_t *) btstack_run_loop_base_data_sources;
+        btstack_run_loop_remove_data_source(ds);
+        close(ds->source.fd);
+        free(ds);
+        btstack_run_loop_deinit();
+        unlink(TEST_SOCKET);
+    }
+};
+
+TEST(SocketConnection, SendPacket){
+    connect_clients(1);
+    send_packets(connections[0], 1);
+    clients_receive_all(1, HEADER_SIZE + PACKET_SIZE);
+    CHECK_EQUAL(HEADER_SIZE + PACKET_SIZE, receive_len[0]);
+    CHECK_EQUAL(1, check_packets(0));
+}
+
+TEST(SocketConnection, QueueAndDrainInOrder){
+    // disable throttling
+    socket_connection_set_tx_limits(0, 4 * 1024 * 1024);
+    connect_clients(1);
+    // more than fits into socket buffer
+    const uint16_t num_packets = 500;
+    send_packets(connections[0], num_packets);
+    clients_receive_all(1, num_packets * (HEADER_SIZE + PACKET_SIZE));
+    CHECK_EQUAL(num_packets * (HEADER_SIZE + PACKET_SIZE), receive_len[0]);
+    CHECK_EQUAL(num_packets, check_packets(0));
+}
+
+TEST(SocketConnection, ThrottleReadingAboveHighWaterMark){
+    socket_connection_set_tx_limits(16 * 1024, 4 * 1024 * 1024);
+    connect_clients(1);
+    const uint16_t num_packets = 500;
+    send_packets(connections[0], num_packets);
+
+    // packet from client is not read while outgoing queue is above high water mark
+    uint8_t client_packet[HEADER_SIZE + 4];
+    memset(client_packet, 0, sizeof(client_packet));
+    little_endian_store_16(client_packet, 0, HCI_COMMAND_DATA_PACKET);
+    little_endian_store_16(client_packet, 4, 4);
+    CHECK_EQUAL(sizeof(client_packet), (size_t) write(client_fds[0], client_packet, sizeof(client_packet)));
+    int i;
+    for (i = 0; i < 10; i++){
+        test_run_loop_process(1);
+    }
+    CHECK_EQUAL(0, num_packets_received);
+
+    // reading is resumed after client received queued packets
+    clients_receive_all(1, num_packets * (HEADER_SIZE + PACKET_SIZE));
+    CHECK_EQUAL(num_packets, check_packets(0));
+    for (i = 0; (i < 10) && (num_packets_received == 0); i++){
+        test_run_loop_process(1);
+    }
+    CHECK_EQUAL(1, num_packets_received);
+}
+
+TEST(SocketConnection, OverflowClosesConnection){
+    socket_connection_set_tx_limits(0, 64 * 1024);
+    connect_clients(1);
+    const uint16_t num_packets = 500;
+    send_packets(connections[0], num_packets);
+    clients_receive_all(1, num_packets * (HEADER_SIZE + PACKET_SIZE));
+    CHECK_TRUE(receive_eof[0]);
+    CHECK_TRUE(receive_len[0] < num_packets * (HEADER_SIZE + PACKET_SIZE));
+    CHECK_EQUAL(1, num_connections_closed);
+}
+
+TEST(SocketConnection, SendPacketAll){
+    socket_connection_set_tx_limits(0, 4 * 1024 * 1024);
+    connect_clients(2);
+    const uint16_t num_packets = 500;
+    send_packets(NULL, num_packets);
+    clients_receive_all(2, num_packets * (HEADER_SIZE + PACKET_SIZE));
+    CHECK_EQUAL(num_packets, check_packets(0));
+    CHECK_EQUAL(num_packets, check_packets(1));
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
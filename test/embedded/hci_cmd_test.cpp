@@ -2,8 +2,12 @@
 #include "CppUTest/CommandLineTestRunner.h"
 
 #include "hci_cmd.h"
+#include "hci_cmd_encoder.h"
 #include "btstack_util.h"
 
+#include <stdio.h>
+#include <time.h>
+
 static uint8_t hci_cmd_buffer[350];
 static uint8_t input_buffer[350];
 
@@ -15,6 +19,22 @@ static uint16_t create_hci_cmd(const hci_cmd_t *cmd, ...){
     return len - 3;
 }
 
+static uint8_t encoder_buffer[350];
+
+static uint16_t create_hci_cmd_packet(const hci_cmd_t *cmd, ...){
+    va_list argptr;
+    va_start(argptr, cmd);
+    uint16_t len = hci_cmd_create_from_template(hci_cmd_buffer, cmd, argptr);
+    va_end(argptr);
+    return len;
+}
+
+static uint32_t time_us(void){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t) ((now.tv_sec * 1000000) + (now.tv_nsec / 1000));
+}
+
 const hci_cmd_t cmd_1 = {0x1234, "1"};
 const hci_cmd_t cmd_2 = {0x1234, "2"};
 const hci_cmd_t cmd_3 = {0x1234, "3"};
@@ -33,6 +53,9 @@ const hci_cmd_t cmd_number_12 = {0x1234, "a[12]"};
 const hci_cmd_t cmd_bits_12 = {0x1234, "b[12]"};
 const hci_cmd_t cmd_INVALID = {0x1234, "!"};
 
+// hci_write_local_name is only available with ENABLE_CLASSIC
+const hci_cmd_t cmd_write_local_name = {HCI_OPCODE_HCI_WRITE_LOCAL_NAME, "N"};
+
 TEST_GROUP(HCI_Command){
     void setup(void){
     }
@@ -234,6 +257,122 @@ TEST(HCI_Command, format_INVALID){
     CHECK_EQUAL(expected_size, size);
 }
 
+TEST_GROUP(HCI_Command_Encoder){
+    void setup(void){
+        memset(hci_cmd_buffer, 0x55, sizeof(hci_cmd_buffer));
+        memset(encoder_buffer, 0xaa, sizeof(encoder_buffer));
+        uint16_t i;
+        for (i = 0; i < sizeof(input_buffer); i++){
+            input_buffer[i] = (uint8_t) (i + 1);
+        }
+    }
+    void check_equal(uint16_t template_size, uint16_t encoder_size){
+        CHECK_EQUAL(template_size, encoder_size);
+        MEMCMP_EQUAL(hci_cmd_buffer, encoder_buffer, template_size);
+    }
+};
+
+TEST(HCI_Command_Encoder, no_parameters){
+    check_equal(create_hci_cmd_packet(&hci_reset), hci_cmd_encode_reset(encoder_buffer));
+}
+
+TEST(HCI_Command_Encoder, create_connection){
+    bd_addr_t addr = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 };
+    check_equal(create_hci_cmd_packet(&hci_create_connection, addr, 0xcc18, 1, 0, 0x8123, 1),
+                hci_cmd_encode_create_connection(encoder_buffer, addr, 0xcc18, 1, 0, 0x8123, 1));
+}
+
+TEST(HCI_Command_Encoder, remote_oob_data_request_reply){
+    bd_addr_t addr = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 };
+    check_equal(create_hci_cmd_packet(&hci_remote_oob_data_request_reply, addr, &input_buffer[0], &input_buffer[16]),
+                hci_cmd_encode_remote_oob_data_request_reply(encoder_buffer, addr, &input_buffer[0], &input_buffer[16]));
+}
+
+TEST(HCI_Command_Encoder, write_local_name){
+    const char * name = "BTstack 00:00:00:00:00:00";
+    check_equal(create_hci_cmd_packet(&cmd_write_local_name, name), hci_cmd_encode_write_local_name(encoder_buffer, name));
+    char long_name[300];
+    memset(long_name, 'A', sizeof(long_name) - 1);
+    long_name[sizeof(long_name) - 1] = 0;
+    check_equal(create_hci_cmd_packet(&cmd_write_local_name, long_name), hci_cmd_encode_write_local_name(encoder_buffer, long_name));
+}
+
+TEST(HCI_Command_Encoder, le_set_scan_parameters){
+    check_equal(create_hci_cmd_packet(&hci_le_set_scan_parameters, 1, 0x01e0, 0x0030, 0, 0),
+                hci_cmd_encode_le_set_scan_parameters(encoder_buffer, 1, 0x01e0, 0x0030, 0, 0));
+}
+
+TEST(HCI_Command_Encoder, le_set_extended_scan_parameters){
+    const uint8_t  scan_types[]     = { 1, 0 };
+    const uint16_t scan_intervals[] = { 0x01e0, 0x1234 };
+    const uint16_t scan_windows[]   = { 0x0030, 0x5678 };
+    check_equal(create_hci_cmd_packet(&hci_le_set_extended_scan_parameters, 0, 0, 0x05, scan_types, scan_intervals, scan_windows),
+                hci_cmd_encode_le_set_extended_scan_parameters(encoder_buffer, 0, 0, 0x05, scan_types, scan_intervals, scan_windows));
+}
+
+TEST(HCI_Command_Encoder, le_set_extended_advertising_data){
+    check_equal(create_hci_cmd_packet(&hci_le_set_extended_advertising_data, 1, 3, 1, 251, input_buffer),
+                hci_cmd_encode_le_set_extended_advertising_data(encoder_buffer, 1, 3, 1, 251, input_buffer));
+}
+
+TEST(HCI_Command_Encoder, le_set_extended_advertising_enable){
+    const uint8_t  advertising_handles[] = { 1, 2 };
+    const uint16_t durations[]           = { 0x1234, 0 };
+    const uint8_t  max_events[]          = { 0xfe, 0x01 };
+    const uint8_t expected[] = {
+        0x39, 0x20, 10, 1, 2,
+        0x01, 0x34, 0x12, 0xfe,
+        0x02, 0x00, 0x00, 0x01,
+    };
+    uint16_t size = hci_cmd_encode_le_set_extended_advertising_enable(encoder_buffer, 1, 2, advertising_handles, durations, max_events);
+    CHECK_EQUAL(sizeof(expected), size);
+    MEMCMP_EQUAL(expected, encoder_buffer, sizeof(expected));
+    // buffer after packet untouched
+    CHECK_EQUAL(0xaa, encoder_buffer[sizeof(expected)]);
+    check_equal(create_hci_cmd_packet(&hci_le_set_extended_advertising_enable, 1, 2, advertising_handles, durations, max_events), size);
+}
+
+TEST(HCI_Command_Encoder, le_set_cig_parameters){
+    const uint8_t  cis_id[]  = { 1, 2 };
+    const uint16_t max_sdu[] = { 100, 0x0203 };
+    const uint8_t  phy[]     = { 2, 1 };
+    const uint8_t  rtn[]     = { 3, 4 };
+    check_equal(create_hci_cmd_packet(&hci_le_set_cig_parameters, 1, 10000, 0x123456, 0, 0, 0, 10, 20, 2, cis_id, max_sdu, max_sdu, phy, phy, rtn, rtn),
+                hci_cmd_encode_le_set_cig_parameters(encoder_buffer, 1, 10000, 0x123456, 0, 0, 0, 10, 20, 2, cis_id, max_sdu, max_sdu, phy, phy, rtn, rtn));
+}
+
+TEST(HCI_Command_Encoder, encode_cost){
+    const uint32_t num_iterations = 100000;
+    const uint8_t  scan_types[]     = { 1, 0 };
+    const uint16_t scan_intervals[] = { 0x01e0, 0x1234 };
+    const uint16_t scan_windows[]   = { 0x0030, 0x5678 };
+    uint32_t checksum_template = 0;
+    uint32_t checksum_encoder = 0;
+    uint32_t i;
+
+    uint32_t start = time_us();
+    for (i = 0; i < num_iterations; i++){
+        checksum_template += create_hci_cmd_packet(&hci_le_set_scan_parameters, 1, (uint16_t) i, 0x0030, 0, 0);
+        checksum_template += create_hci_cmd_packet(&hci_le_set_extended_scan_parameters, 0, 0, 0x05, scan_types, scan_intervals, scan_windows);
+        checksum_template += create_hci_cmd_packet(&hci_le_set_extended_advertising_data, 1, 3, 1, 31, input_buffer);
+        checksum_template += hci_cmd_buffer[4];
+    }
+    uint32_t template_us = time_us() - start;
+
+    start = time_us();
+    for (i = 0; i < num_iterations; i++){
+        checksum_encoder += hci_cmd_encode_le_set_scan_parameters(encoder_buffer, 1, (uint16_t) i, 0x0030, 0, 0);
+        checksum_encoder += hci_cmd_encode_le_set_extended_scan_parameters(encoder_buffer, 0, 0, 0x05, scan_types, scan_intervals, scan_windows);
+        checksum_encoder += hci_cmd_encode_le_set_extended_advertising_data(encoder_buffer, 1, 3, 1, 31, input_buffer);
+        checksum_encoder += encoder_buffer[4];
+    }
+    uint32_t encoder_us = time_us() - start;
+
+    printf("\nHCI Command encode cost for %u x 3 commands: template %u us, encoder %u us\n",
+           (unsigned int) num_iterations, (unsigned int) template_us, (unsigned int) encoder_us);
+    CHECK_EQUAL(checksum_template, checksum_encoder);
+}
+
 int main (int argc, const char * argv[]){
     return CommandLineTestRunner::RunAllTests(argc, argv);
 }
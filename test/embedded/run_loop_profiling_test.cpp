@@ -0,0 +1,185 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_run_loop.h"
+
+// built with ENABLE_RUN_LOOP_PROFILING and MAX_NR_RUN_LOOP_PROFILING_ENTRIES = 4, see Makefile
+
+static btstack_timer_source_t timer_1;
+static btstack_timer_source_t timer_2;
+static btstack_data_source_t  data_source;
+
+static uint32_t profiling_time_us;
+static uint32_t profiling_handler_duration_us;
+
+static uint32_t profiling_get_time_us(void){
+    return profiling_time_us;
+}
+static void profiling_timer_handler(btstack_timer_source_t * ts){
+    UNUSED(ts);
+    profiling_time_us += profiling_handler_duration_us;
+}
+static void profiling_data_source_handler(btstack_data_source_t * ds, btstack_data_source_callback_type_t callback_type){
+    UNUSED(ds);
+    UNUSED(callback_type);
+    profiling_time_us += profiling_handler_duration_us;
+}
+static void profiling_callback_1(void * context){
+    UNUSED(context);
+    profiling_time_us += profiling_handler_duration_us;
+}
+static void profiling_callback_2(void * context){
+    UNUSED(context);
+}
+static void profiling_callback_3(void * context){
+    UNUSED(context);
+}
+
+TEST_GROUP(RunLoopProfiling){
+        void setup(void){
+            btstack_run_loop_base_init();
+            btstack_run_loop_profiling_set_time_us_callback(&profiling_get_time_us);
+            profiling_time_us = 1000;
+            profiling_handler_duration_us = 0;
+        }
+        void teardown(void){
+            btstack_run_loop_profiling_set_time_us_callback(NULL);
+        }
+};
+
+TEST(RunLoopProfiling, Timer){
+    btstack_run_loop_set_timer_handler(&timer_1, &profiling_timer_handler);
+    timer_1.timeout = 10;
+    btstack_run_loop_set_timer_handler(&timer_2, &profiling_timer_handler);
+    timer_2.timeout = 12;
+    btstack_run_loop_base_add_timer(&timer_1);
+    btstack_run_loop_base_add_timer(&timer_2);
+
+    profiling_handler_duration_us = 100;
+    btstack_run_loop_base_process_timers(15);
+
+    CHECK_EQUAL(1, btstack_run_loop_profiling_get_num_entries());
+    const btstack_run_loop_profiling_entry_t * entry = btstack_run_loop_profiling_get_entry(0);
+    CHECK(entry->handler == (btstack_run_loop_profiling_handler_t) &profiling_timer_handler);
+    CHECK_EQUAL(BTSTACK_RUN_LOOP_PROFILING_TYPE_TIMER, entry->type);
+    CHECK_EQUAL(2, entry->count);
+    CHECK_EQUAL(200, entry->total_us);
+    CHECK_EQUAL(100, entry->max_us);
+    CHECK_EQUAL(5, entry->max_lateness);
+    // 100 us in [64, 128)
+    CHECK_EQUAL(2, entry->histogram[3]);
+
+    const btstack_run_loop_profiling_stats_t * stats = btstack_run_loop_profiling_get_stats();
+    CHECK_EQUAL(5, stats->max_timer_lateness);
+    // lateness 3 in [2,4), lateness 5 in [4,8)
+    CHECK_EQUAL(1, stats->timer_lateness_histogram[2]);
+    CHECK_EQUAL(1, stats->timer_lateness_histogram[3]);
+    CHECK_EQUAL(2, stats->max_timers);
+    CHECK_EQUAL(2, stats->max_expired_timers);
+
+    POINTERS_EQUAL(NULL, btstack_run_loop_profiling_get_entry(1));
+    btstack_run_loop_profiling_dump();
+}
+
+TEST(RunLoopProfiling, DataSource){
+    btstack_run_loop_set_data_source_handler(&data_source, &profiling_data_source_handler);
+    btstack_run_loop_base_enable_data_source_callbacks(&data_source, DATA_SOURCE_CALLBACK_POLL);
+    btstack_run_loop_base_add_data_source(&data_source);
+
+    profiling_handler_duration_us = 10;
+    btstack_run_loop_base_poll_data_sources();
+    profiling_handler_duration_us = 20000;
+    btstack_run_loop_base_process_data_source(&data_source, DATA_SOURCE_CALLBACK_READ);
+    btstack_run_loop_base_remove_data_source(&data_source);
+
+    CHECK_EQUAL(1, btstack_run_loop_profiling_get_num_entries());
+    const btstack_run_loop_profiling_entry_t * entry = btstack_run_loop_profiling_get_entry(0);
+    CHECK_EQUAL(BTSTACK_RUN_LOOP_PROFILING_TYPE_DATA_SOURCE, entry->type);
+    CHECK_EQUAL(2, entry->count);
+    CHECK_EQUAL(20000, entry->max_us);
+    CHECK_EQUAL(1, entry->histogram[0]);
+    CHECK_EQUAL(1, entry->histogram[BTSTACK_RUN_LOOP_PROFILING_NUM_BUCKETS - 1]);
+    CHECK_EQUAL(1, btstack_run_loop_profiling_get_stats()->max_data_sources);
+}
+
+TEST(RunLoopProfiling, Callbacks){
+    btstack_context_callback_registration_t registrations[3];
+    registrations[0].callback = &profiling_callback_1;
+    registrations[1].callback = &profiling_callback_1;
+    registrations[2].callback = &profiling_callback_2;
+    int i;
+    for (i = 0; i < 3; i++){
+        registrations[i].context = NULL;
+        btstack_run_loop_base_add_callback(&registrations[i]);
+    }
+    profiling_handler_duration_us = 40;
+    btstack_run_loop_base_execute_callbacks();
+
+    CHECK_EQUAL(3, btstack_run_loop_profiling_get_stats()->max_callbacks);
+    CHECK_EQUAL(2, btstack_run_loop_profiling_get_num_entries());
+    const btstack_run_loop_profiling_entry_t * entry = btstack_run_loop_profiling_get_entry(0);
+    CHECK(entry->handler == (btstack_run_loop_profiling_handler_t) &profiling_callback_1);
+    CHECK_EQUAL(BTSTACK_RUN_LOOP_PROFILING_TYPE_CALLBACK, entry->type);
+    CHECK_EQUAL(2, entry->count);
+    CHECK_EQUAL(80, entry->total_us);
+    entry = btstack_run_loop_profiling_get_entry(1);
+    CHECK(entry->handler == (btstack_run_loop_profiling_handler_t) &profiling_callback_2);
+    CHECK_EQUAL(0, entry->max_us);
+
+    btstack_run_loop_profiling_reset();
+    CHECK_EQUAL(0, btstack_run_loop_profiling_get_num_entries());
+    CHECK_EQUAL(0, btstack_run_loop_profiling_get_stats()->max_callbacks);
+}
+
+TEST(RunLoopProfiling, SingleTimer){
+    // run loops with native timers, e.g. CoreFoundation
+    btstack_run_loop_set_timer_handler(&timer_1, &profiling_timer_handler);
+    timer_1.timeout = 10;
+    profiling_handler_duration_us = 20;
+    btstack_run_loop_base_process_timer(&timer_1, 12);
+
+    CHECK_EQUAL(1, btstack_run_loop_profiling_get_num_entries());
+    const btstack_run_loop_profiling_entry_t * entry = btstack_run_loop_profiling_get_entry(0);
+    CHECK_EQUAL(BTSTACK_RUN_LOOP_PROFILING_TYPE_TIMER, entry->type);
+    CHECK_EQUAL(1, entry->count);
+    CHECK_EQUAL(20, entry->max_us);
+    CHECK_EQUAL(2, entry->max_lateness);
+}
+
+TEST(RunLoopProfiling, TableFull){
+    // MAX_NR_RUN_LOOP_PROFILING_ENTRIES = 4, 5 handlers
+    btstack_context_callback_registration_t registrations[3];
+    registrations[0].callback = &profiling_callback_1;
+    registrations[1].callback = &profiling_callback_2;
+    registrations[2].callback = &profiling_callback_3;
+    int i;
+    for (i = 0; i < 3; i++){
+        registrations[i].context = NULL;
+        btstack_run_loop_base_execute_callback(&registrations[i]);
+    }
+    btstack_run_loop_set_timer_handler(&timer_1, &profiling_timer_handler);
+    timer_1.timeout = 0;
+    btstack_run_loop_base_add_timer(&timer_1);
+    btstack_run_loop_base_process_timers(0);
+    btstack_run_loop_set_data_source_handler(&data_source, &profiling_data_source_handler);
+    btstack_run_loop_base_process_data_source(&data_source, DATA_SOURCE_CALLBACK_READ);
+    btstack_run_loop_base_process_data_source(&data_source, DATA_SOURCE_CALLBACK_READ);
+
+    // last handler in table keeps its entry
+    CHECK_EQUAL(5, btstack_run_loop_profiling_get_num_entries());
+    const btstack_run_loop_profiling_entry_t * entry = btstack_run_loop_profiling_get_entry(3);
+    CHECK_EQUAL(BTSTACK_RUN_LOOP_PROFILING_TYPE_TIMER, entry->type);
+    CHECK(entry->handler == (btstack_run_loop_profiling_handler_t) &profiling_timer_handler);
+    CHECK_EQUAL(1, entry->count);
+
+    // data source collected in additional entry
+    entry = btstack_run_loop_profiling_get_entry(4);
+    CHECK_EQUAL(BTSTACK_RUN_LOOP_PROFILING_TYPE_OTHER, entry->type);
+    CHECK(entry->handler == NULL);
+    CHECK_EQUAL(2, entry->count);
+    CHECK(btstack_run_loop_profiling_get_entry(5) == NULL);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -0,0 +1,46 @@
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "btstack_util.h"
+#include "classic/hfp.h"
+
+// hfp_parse_data has to result in the same connection state as byte-wise hfp_parse
+static hfp_connection_t hfp_connection_byte_wise;
+static hfp_connection_t hfp_connection_data;
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    // first byte: role, second byte: packet boundary
+    if (size < 2) return 0;
+    if (size > 1000) return 0;
+
+    int is_handsfree = data[0] & 1;
+    uint16_t split = data[1];
+    data += 2;
+    uint16_t len = (uint16_t) (size - 2);
+
+    memset(&hfp_connection_byte_wise, 0, sizeof(hfp_connection_t));
+    memset(&hfp_connection_data, 0, sizeof(hfp_connection_t));
+
+    uint16_t i;
+    for (i = 0; i < len; i++){
+        hfp_parse(&hfp_connection_byte_wise, data[i], is_handsfree);
+    }
+
+    uint16_t chunk_start = 0;
+    while (chunk_start < len){
+        uint16_t chunk_end = (chunk_start < split) ? btstack_min(split, len) : len;
+        uint16_t pos = chunk_start;
+        while (pos < chunk_end){
+            pos += hfp_parse_data(&hfp_connection_data, &data[pos], chunk_end - pos, is_handsfree);
+        }
+        chunk_start = chunk_end;
+    }
+
+    if (memcmp(&hfp_connection_byte_wise, &hfp_connection_data, sizeof(hfp_connection_t)) != 0){
+        abort();
+    }
+
+    return 0;
+}
@@ -13,6 +13,8 @@
 
 // BTstack features that can be enabled
 #define ENABLE_BLE
+#define ENABLE_HCI_ACL_TX_BUFFER_POOL
+#define ENABLE_HCI_CONNECTION_INDEX
 #define ENABLE_LE_CENTRAL
 #define ENABLE_LE_PERIPHERAL
 #define ENABLE_LE_SIGNED_WRITE
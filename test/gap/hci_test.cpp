@@ -233,6 +233,131 @@ TEST(HCI, hci_connection_for_bd_addr_and_type){
     CHECK_EQUAL(NULL, con);
 }
 
+static void simulate_le_connection_complete(hci_con_handle_t con_handle, const bd_addr_t addr){
+    uint8_t event[21];
+    memset(event, 0, sizeof(event));
+    event[0] = HCI_EVENT_LE_META;
+    event[1] = sizeof(event) - 2;
+    event[2] = HCI_SUBEVENT_LE_CONNECTION_COMPLETE;
+    event[3] = ERROR_CODE_SUCCESS;
+    little_endian_store_16(event, 4, con_handle);
+    event[6] = HCI_ROLE_MASTER;
+    event[7] = BD_ADDR_TYPE_LE_RANDOM;
+    reverse_bd_addr(addr, &event[8]);
+    little_endian_store_16(event, 14, 0x0028);
+    little_endian_store_16(event, 18, 0x01f4);
+    packet_handler(HCI_EVENT_PACKET, event, sizeof(event));
+    transport_count_packets = 0;
+}
+
+static void simulate_disconnection_complete(hci_con_handle_t con_handle){
+    uint8_t event[6] = { HCI_EVENT_DISCONNECTION_COMPLETE, 4, ERROR_CODE_SUCCESS, 0, 0, 0x13};
+    little_endian_store_16(event, 3, con_handle);
+    packet_handler(HCI_EVENT_PACKET, event, sizeof(event));
+    transport_count_packets = 0;
+}
+
+TEST(HCI, hci_connection_index){
+    // more connections than slots in the index
+    const uint16_t num_connections = HCI_CONNECTION_INDEX_SIZE + 8;
+    bd_addr_t addr = { 0xc0, 0x11, 0x22, 0x33, 0x00, 0x00 };
+    uint16_t i;
+    for (i = 0; i < num_connections; i++){
+        little_endian_store_16(addr, 4, i);
+        simulate_le_connection_complete(0x40 + i, addr);
+    }
+    for (i = 0; i < num_connections; i++){
+        little_endian_store_16(addr, 4, i);
+        hci_connection_t * conn = hci_connection_for_handle(0x40 + i);
+        CHECK(conn != NULL);
+        CHECK_EQUAL(0x40 + i, conn->con_handle);
+        CHECK(conn == hci_connection_for_bd_addr_and_type(addr, BD_ADDR_TYPE_LE_RANDOM));
+    }
+    // fuzz connections are still found
+    CHECK_EQUAL(0x05, hci_connection_for_handle(0x05)->con_handle);
+    // drop every other connection
+    for (i = 0; i < num_connections; i += 2){
+        simulate_disconnection_complete(0x40 + i);
+    }
+    for (i = 0; i < num_connections; i++){
+        little_endian_store_16(addr, 4, i);
+        hci_connection_t * conn = hci_connection_for_handle(0x40 + i);
+        if ((i & 1) == 0){
+            CHECK(conn == NULL);
+            CHECK(hci_connection_for_bd_addr_and_type(addr, BD_ADDR_TYPE_LE_RANDOM) == NULL);
+        } else {
+            CHECK(conn != NULL);
+            CHECK_EQUAL(0x40 + i, conn->con_handle);
+            CHECK(conn == hci_connection_for_bd_addr_and_type(addr, BD_ADDR_TYPE_LE_RANDOM));
+        }
+    }
+    CHECK(hci_connection_for_handle(0x30) == NULL);
+}
+
+#ifdef ENABLE_HCI_ACL_TX_BUFFER_POOL
+static void simulate_le_read_buffer_size(uint16_t le_data_packets_length, uint8_t le_acl_packets_total_num){
+    uint8_t event[] = { HCI_EVENT_COMMAND_COMPLETE, 7, 1, 0, 0, ERROR_CODE_SUCCESS, 0, 0, 0};
+    little_endian_store_16(event, 3, HCI_OPCODE_HCI_LE_READ_BUFFER_SIZE);
+    little_endian_store_16(event, 6, le_data_packets_length);
+    event[8] = le_acl_packets_total_num;
+    packet_handler(HCI_EVENT_PACKET, event, sizeof(event));
+}
+
+static void simulate_number_of_completed_packets(hci_con_handle_t con_handle, uint16_t num_packets){
+    uint8_t event[] = { HCI_EVENT_NUMBER_OF_COMPLETED_PACKETS, 5, 1, 0, 0, 0, 0};
+    little_endian_store_16(event, 3, con_handle);
+    little_endian_store_16(event, 5, num_packets);
+    packet_handler(HCI_EVENT_PACKET, event, sizeof(event));
+}
+
+static void send_acl_packet(hci_con_handle_t con_handle, uint16_t len, uint8_t pattern){
+    CHECK_EQUAL(true, hci_can_send_acl_packet_now(con_handle));
+    hci_reserve_packet_buffer();
+    uint8_t * packet = hci_get_outgoing_packet_buffer();
+    little_endian_store_16(packet, 0, con_handle | (0x02 << 12));
+    little_endian_store_16(packet, 2, len);
+    uint16_t i;
+    for (i = 0; i < len; i++){
+        packet[4 + i] = pattern + i;
+    }
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_send_acl_packet_buffer(4 + len));
+}
+
+TEST(HCI, hci_acl_tx_buffer_pool){
+    // LE: 27 byte fragments, 2 controller buffers
+    simulate_le_read_buffer_size(27, 2);
+    transport_count_packets = 0;
+
+    // 100 bytes -> 27, 27, 27, 19, only two fragments sent
+    send_acl_packet(0x05, 100, 0x10);
+    CHECK_EQUAL(2, transport_count_packets);
+    CHECK_EQUAL(0x2005, little_endian_read_16(transport_packets[0].buffer, 0));
+    CHECK_EQUAL(0x1005, little_endian_read_16(transport_packets[1].buffer, 0));
+
+    // remaining fragments wait in tx buffer, hci_packet_buffer is free for others
+    CHECK_EQUAL(false, hci_can_send_acl_packet_now(0x05));
+    CHECK_EQUAL(false, hci_is_packet_buffer_reserved());
+    send_acl_packet(0x03, 10, 0x80);
+    CHECK_EQUAL(3, transport_count_packets);
+    CHECK_EQUAL(0x2003, little_endian_read_16(transport_packets[2].buffer, 0));
+
+    // controller buffers available -> remaining fragments
+    simulate_number_of_completed_packets(0x05, 2);
+    CHECK_EQUAL(5, transport_count_packets);
+    CHECK_EQUAL(0x1005, little_endian_read_16(transport_packets[3].buffer, 0));
+    CHECK_EQUAL(27, little_endian_read_16(transport_packets[3].buffer, 2));
+    CHECK_EQUAL(0x10 + 54, transport_packets[3].buffer[4]);
+    CHECK_EQUAL(0x1005, little_endian_read_16(transport_packets[4].buffer, 0));
+    CHECK_EQUAL(19, little_endian_read_16(transport_packets[4].buffer, 2));
+    CHECK_EQUAL(0x10 + 81, transport_packets[4].buffer[4]);
+    CHECK_EQUAL(0x10 + 99, transport_packets[4].buffer[4 + 18]);
+
+    // all fragments sent
+    simulate_number_of_completed_packets(0x05, 2);
+    CHECK_EQUAL(true, hci_can_send_acl_packet_now(0x05));
+}
+#endif
+
 TEST(HCI, hci_number_free_acl_slots_for_handle){
     int free_acl_slots_num = hci_number_free_acl_slots_for_handle(HCI_CON_HANDLE_INVALID);
     CHECK_EQUAL(0, free_acl_slots_num);
@@ -0,0 +1,28 @@
+//
+// btstack_config.h for HCI USB Transport benchmark and test
+//
+
+#ifndef BTSTACK_CONFIG_H
+#define BTSTACK_CONFIG_H
+
+// Port related features
+#define HAVE_MALLOC
+#define HAVE_POSIX_TIME
+
+// BTstack features that can be enabled
+#define ENABLE_BLE
+#define ENABLE_CLASSIC
+#define ENABLE_HCI_ACL_TX_BUFFER_POOL
+#define ENABLE_LE_CENTRAL
+#define ENABLE_LE_ISOCHRONOUS_STREAMS
+#define ENABLE_LE_PERIPHERAL
+
+// BTstack configuration. buffers, sizes, ...
+#define HCI_ACL_PAYLOAD_SIZE 1021
+#define HCI_INCOMING_PRE_BUFFER_SIZE 14
+
+// use simulated device from libusb_mock.c
+#define USB_VENDOR_ID  0x0a12
+#define USB_PRODUCT_ID 0x0001
+
+#endif
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "hci_transport_usb_bench.c"
+
+// *****************************************************************************
+//
+// HCI USB Transport loopback benchmark
+//
+// - runs hci_transport_h2_libusb.c against a simulated dongle (libusb_mock.c)
+//   that sends every ACL/ISO packet received on bulk out back on bulk in
+// - bulk transfers share a USB Full Speed bus (19 x 64 bytes per 1 ms frame)
+// - the host side behaves like HCI: a single outgoing packet buffer that can
+//   be re-used after HCI_EVENT_TRANSPORT_PACKET_SENT, ISO Data has priority
+// - simulated run loop with virtual time, libusb is polled every 1 ms
+// - reports loopback throughput for ACL packets and, optionally, the latency
+//   of ISO packets queued every 10 ms while ACL is streaming
+//
+// usage: hci_transport_usb_bench <label>
+//
+// *****************************************************************************
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "btstack_config.h"
+#include "btstack_debug.h"
+#include "btstack_defines.h"
+#include "btstack_event.h"
+#include "btstack_run_loop.h"
+#include "btstack_util.h"
+#include "hci.h"
+#include "hci_transport.h"
+#include "hci_transport_usb.h"
+
+#include "libusb_mock.h"
+
+#define BUS_BYTES_PER_MS     (19 * 64)
+#define ACL_PACKETS          2000
+#define ACL_CON_HANDLE       0x0001
+#define ISO_CON_HANDLE       0x0060
+#define ISO_INTERVAL_MS      10
+#define ISO_SDU_LEN          155
+#define SIMULATION_TIMEOUT_MS (60 * 1000)
+
+static const uint16_t acl_payload_lengths[] = { 27, 251, 1021 };
+
+static uint64_t sim_time_us;
+
+static const hci_transport_t * transport;
+
+// host state
+static uint8_t  host_packet_buffer[HCI_OUTGOING_PACKET_BUFFER_SIZE];
+static bool     host_packet_buffer_reserved;
+static uint16_t acl_payload_len;
+static uint32_t acl_packets_sent;
+static uint32_t acl_packets_received;
+static uint64_t acl_bytes_received;
+
+static btstack_timer_source_t iso_timer;
+static bool     iso_enabled;
+static bool     iso_pending;
+static uint64_t iso_pending_time_us;
+static uint32_t iso_packets_received;
+static uint64_t iso_latency_sum_us;
+static uint64_t iso_latency_max_us;
+
+// simulated run loop
+
+static uint32_t bench_run_loop_get_time_ms(void){
+    return (uint32_t) (sim_time_us / 1000u);
+}
+
+static void bench_run_loop_set_timer(btstack_timer_source_t * ts, uint32_t timeout_in_ms){
+    ts->timeout = bench_run_loop_get_time_ms() + timeout_in_ms;
+}
+
+static void bench_run_loop_poll_data_sources_from_irq(void){
+    // data sources are polled on every iteration
+}
+
+static const btstack_run_loop_t bench_run_loop = {
+    &btstack_run_loop_base_init,
+    &btstack_run_loop_base_add_data_source,
+    &btstack_run_loop_base_remove_data_source,
+    &btstack_run_loop_base_enable_data_source_callbacks,
+    &btstack_run_loop_base_disable_data_source_callbacks,
+    &bench_run_loop_set_timer,
+    &btstack_run_loop_base_add_timer,
+    &btstack_run_loop_base_remove_timer,
+    NULL, // execute
+    &btstack_run_loop_base_dump_timer,
+    &bench_run_loop_get_time_ms,
+    &bench_run_loop_poll_data_sources_from_irq,
+    NULL, // execute_on_main_thread
+    NULL, // trigger_exit
+};
+
+// host
+
+static void host_send_iso_packet(void){
+    uint16_t pos = 0;
+    little_endian_store_16(host_packet_buffer, pos, ISO_CON_HANDLE | 0x2000);
+    pos += 2;
+    little_endian_store_16(host_packet_buffer, pos, 4 + ISO_SDU_LEN);
+    pos += 2;
+    little_endian_store_16(host_packet_buffer, pos, 0);
+    pos += 2;
+    little_endian_store_16(host_packet_buffer, pos, ISO_SDU_LEN);
+    pos += 2;
+    // SDU contains time when it was queued
+    memset(&host_packet_buffer[pos], 0, ISO_SDU_LEN);
+    memcpy(&host_packet_buffer[pos], &iso_pending_time_us, sizeof(iso_pending_time_us));
+    pos += ISO_SDU_LEN;
+    host_packet_buffer_reserved = true;
+    iso_pending = false;
+    int err = transport->send_packet(HCI_ISO_DATA_PACKET, host_packet_buffer, pos);
+    btstack_assert(err == 0);
+    UNUSED(err);
+}
+
+static void host_send_acl_packet(void){
+    little_endian_store_16(host_packet_buffer, 0, ACL_CON_HANDLE | 0x2000);
+    little_endian_store_16(host_packet_buffer, 2, acl_payload_len);
+    memset(&host_packet_buffer[4], (uint8_t) acl_packets_sent, acl_payload_len);
+    host_packet_buffer_reserved = true;
+    acl_packets_sent++;
+    int err = transport->send_packet(HCI_ACL_DATA_PACKET, host_packet_buffer, 4 + acl_payload_len);
+    btstack_assert(err == 0);
+    UNUSED(err);
+}
+
+static void host_run(void){
+    if (host_packet_buffer_reserved) return;
+    if (iso_pending && transport->can_send_packet_now(HCI_ISO_DATA_PACKET)){
+        host_send_iso_packet();
+        return;
+    }
+    if ((acl_packets_sent < ACL_PACKETS) && transport->can_send_packet_now(HCI_ACL_DATA_PACKET)){
+        host_send_acl_packet();
+    }
+}
+
+static void host_packet_handler(uint8_t packet_type, uint8_t *packet, uint16_t size){
+    hci_con_handle_t con_handle;
+    switch (packet_type){
+        case HCI_EVENT_PACKET:
+            if (hci_event_packet_get_type(packet) != HCI_EVENT_TRANSPORT_PACKET_SENT) break;
+            host_packet_buffer_reserved = false;
+            host_run();
+            break;
+        case HCI_ACL_DATA_PACKET:
+            // ISO Data is received over the ACL bulk endpoint
+            con_handle = little_endian_read_16(packet, 0) & 0x0fff;
+            if (con_handle == ISO_CON_HANDLE){
+                uint64_t queued_us;
+                btstack_assert(size >= (8 + sizeof(queued_us)));
+                memcpy(&queued_us, &packet[8], sizeof(queued_us));
+                uint64_t latency_us = sim_time_us - queued_us;
+                iso_packets_received++;
+                iso_latency_sum_us += latency_us;
+                iso_latency_max_us = btstack_max(iso_latency_max_us, latency_us);
+            } else {
+                btstack_assert(size == (4 + acl_payload_len));
+                acl_packets_received++;
+                acl_bytes_received += acl_payload_len;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void iso_timer_handler(btstack_timer_source_t * ts){
+    iso_pending = true;
+    iso_pending_time_us = sim_time_us;
+    btstack_run_loop_set_timer(ts, ISO_INTERVAL_MS);
+    btstack_run_loop_add_timer(ts);
+    host_run();
+}
+
+static void simulation_run(uint16_t payload_len, bool with_iso, const char * label){
+    acl_payload_len = payload_len;
+    acl_packets_sent = 0;
+    acl_packets_received = 0;
+    acl_bytes_received = 0;
+    host_packet_buffer_reserved = false;
+    iso_enabled = with_iso;
+    iso_pending = false;
+    iso_packets_received = 0;
+    iso_latency_sum_us = 0;
+    iso_latency_max_us = 0;
+    sim_time_us = 0;
+
+    btstack_run_loop_init(&bench_run_loop);
+    libusb_mock_init(BUS_BYTES_PER_MS);
+    libusb_mock_set_time_us(sim_time_us);
+
+    transport = hci_transport_usb_instance();
+    transport->register_packet_handler(&host_packet_handler);
+    int err = transport->open();
+    btstack_assert(err == 0);
+    UNUSED(err);
+
+    if (iso_enabled){
+        btstack_run_loop_set_timer_handler(&iso_timer, &iso_timer_handler);
+        btstack_run_loop_set_timer(&iso_timer, ISO_INTERVAL_MS);
+        btstack_run_loop_add_timer(&iso_timer);
+    }
+
+    host_run();
+
+    while (acl_packets_received < ACL_PACKETS){
+        libusb_mock_set_time_us(sim_time_us);
+        btstack_run_loop_base_poll_data_sources();
+        btstack_run_loop_base_process_timers(bench_run_loop_get_time_ms());
+        btstack_run_loop_base_poll_data_sources();
+        host_run();
+
+        int32_t time_until_timeout_ms = btstack_run_loop_base_get_time_until_timeout(bench_run_loop_get_time_ms());
+        btstack_assert(time_until_timeout_ms >= 0);
+        sim_time_us = ((sim_time_us / 1000u) + btstack_max(1, (uint32_t) time_until_timeout_ms)) * 1000u;
+        if (sim_time_us > (SIMULATION_TIMEOUT_MS * 1000u)) break;
+    }
+
+    if (iso_enabled){
+        btstack_run_loop_remove_timer(&iso_timer);
+    }
+    transport->close();
+    btstack_run_loop_deinit();
+
+    uint64_t duration_ms = sim_time_us / 1000u;
+    printf("%-10s %7u %5s %10" PRIu64 " %12" PRIu64 " %10u %7u%%",
+           label, payload_len, with_iso ? "yes" : "no", duration_ms,
+           (acl_bytes_received * 1000u) / btstack_max(1, (uint32_t) duration_ms),
+           libusb_mock_get_max_bulk_out_in_flight(),
+           (uint32_t) ((libusb_mock_get_bus_busy_us() * 100u) / btstack_max(1, (uint32_t) sim_time_us)));
+    if (with_iso && (iso_packets_received > 0)){
+        printf(" %9.1f %9.1f", (double) iso_latency_sum_us / iso_packets_received / 1000.0, (double) iso_latency_max_us / 1000.0);
+    }
+    printf("\n");
+}
+
+int main(int argc, const char * argv[]){
+    const char * label = (argc > 1) ? argv[1] : "usb";
+    uint16_t i;
+    printf("%-10s %7s %5s %10s %12s %10s %8s %9s %9s\n", "transport", "acl_len", "iso", "time_ms", "bytes/s", "in_flight", "bus", "iso_avg", "iso_max");
+    for (i = 0; i < sizeof(acl_payload_lengths) / sizeof(acl_payload_lengths[0]); i++){
+        simulation_run(acl_payload_lengths[i], false, label);
+    }
+    simulation_run(1021, true, label);
+    return 0;
+}
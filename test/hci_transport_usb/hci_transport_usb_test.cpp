@@ -0,0 +1,205 @@
+// *****************************************************************************
+//
+// HCI USB Transport test
+//
+// - runs hci.c on top of hci_transport_h2_libusb.c and a simulated dongle
+//   (libusb_mock.c) that sends every ACL packet received on bulk out back on bulk in
+// - ACL packets larger than the controller buffer are fragmented by HCI,
+//   the looped back fragments are reassembled by HCI again
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_config.h"
+#include "btstack_debug.h"
+#include "btstack_defines.h"
+#include "btstack_memory.h"
+#include "btstack_run_loop.h"
+#include "btstack_util.h"
+#include "hci.h"
+#include "hci_cmd.h"
+#include "hci_transport_usb.h"
+
+#include "libusb_mock.h"
+
+#define BUS_BYTES_PER_MS        (19 * 64)
+#define TEST_TIMEOUT_MS         1000
+// LE ACL connection from hci_setup_test_connections_fuzz
+#define LE_CON_HANDLE           0x0005
+#define LE_ACL_BUFFER_SIZE      27
+#define LE_ACL_BUFFER_NUM       8
+#define L2CAP_PAYLOAD_LEN       96
+// 4 byte L2CAP header + payload in 27 byte fragments
+#define NUM_FRAGMENTS           4
+
+static uint64_t sim_time_us;
+
+static uint8_t  received_packets[2][HCI_ACL_BUFFER_SIZE];
+static uint16_t received_sizes[2];
+static uint16_t num_received_packets;
+
+// simulated run loop
+
+static uint32_t test_run_loop_get_time_ms(void){
+    return (uint32_t) (sim_time_us / 1000u);
+}
+
+static void test_run_loop_set_timer(btstack_timer_source_t * ts, uint32_t timeout_in_ms){
+    ts->timeout = test_run_loop_get_time_ms() + timeout_in_ms;
+}
+
+static void test_run_loop_poll_data_sources_from_irq(void){
+    // data sources are polled on every iteration
+}
+
+static const btstack_run_loop_t test_run_loop = {
+    &btstack_run_loop_base_init,
+    &btstack_run_loop_base_add_data_source,
+    &btstack_run_loop_base_remove_data_source,
+    &btstack_run_loop_base_enable_data_source_callbacks,
+    &btstack_run_loop_base_disable_data_source_callbacks,
+    &test_run_loop_set_timer,
+    &btstack_run_loop_base_add_timer,
+    &btstack_run_loop_base_remove_timer,
+    NULL, // execute
+    &btstack_run_loop_base_dump_timer,
+    &test_run_loop_get_time_ms,
+    &test_run_loop_poll_data_sources_from_irq,
+    NULL, // execute_on_main_thread
+    NULL, // trigger_exit
+};
+
+static void test_run_loop_step(void){
+    libusb_mock_set_time_us(sim_time_us);
+    btstack_run_loop_base_poll_data_sources();
+    btstack_run_loop_base_process_timers(test_run_loop_get_time_ms());
+    btstack_run_loop_base_poll_data_sources();
+    sim_time_us += 1000u;
+}
+
+static void test_run_until_received(uint16_t num_packets){
+    while (num_received_packets < num_packets){
+        CHECK(sim_time_us < (TEST_TIMEOUT_MS * 1000u));
+        test_run_loop_step();
+    }
+}
+
+static void test_run_until_le_buffer_size_known(void){
+    while (hci_number_free_acl_slots_for_connection_type(BD_ADDR_TYPE_LE_PUBLIC) != LE_ACL_BUFFER_NUM){
+        CHECK(sim_time_us < (TEST_TIMEOUT_MS * 1000u));
+        test_run_loop_step();
+    }
+}
+
+static void test_run_until_packet_buffer_free(void){
+    while (!hci_can_send_acl_packet_now(LE_CON_HANDLE)){
+        CHECK(sim_time_us < (TEST_TIMEOUT_MS * 1000u));
+        test_run_loop_step();
+    }
+}
+
+static void test_acl_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size){
+    UNUSED(packet_type);
+    UNUSED(channel);
+    btstack_assert(num_received_packets < 2);
+    memcpy(received_packets[num_received_packets], packet, size);
+    received_sizes[num_received_packets] = size;
+    num_received_packets++;
+}
+
+static void test_le_read_buffer_size_complete(void){
+    uint8_t event[] = { HCI_EVENT_COMMAND_COMPLETE, 7, 1, 0, 0, ERROR_CODE_SUCCESS, 0, 0, LE_ACL_BUFFER_NUM };
+    little_endian_store_16(event, 3, hci_le_read_buffer_size.opcode);
+    little_endian_store_16(event, 6, LE_ACL_BUFFER_SIZE);
+    libusb_mock_send_event(event, sizeof(event));
+}
+
+static uint16_t test_setup_l2cap_packet(uint8_t * buffer, uint8_t seed){
+    little_endian_store_16(buffer, 0, LE_CON_HANDLE | 0x2000);
+    little_endian_store_16(buffer, 2, 4 + L2CAP_PAYLOAD_LEN);
+    little_endian_store_16(buffer, 4, L2CAP_PAYLOAD_LEN);
+    little_endian_store_16(buffer, 6, 0x0004);
+    uint16_t i;
+    for (i = 0; i < L2CAP_PAYLOAD_LEN; i++){
+        buffer[8 + i] = (uint8_t) (seed + i);
+    }
+    return 8 + L2CAP_PAYLOAD_LEN;
+}
+
+static void test_send_l2cap_packet(uint8_t * expected, uint8_t seed){
+    CHECK(hci_reserve_packet_buffer());
+    uint8_t * buffer = hci_get_outgoing_packet_buffer();
+    uint16_t size = test_setup_l2cap_packet(buffer, seed);
+    memcpy(expected, buffer, size);
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, hci_send_acl_packet_buffer(size));
+}
+
+TEST_GROUP(HCITransportUSB){
+    const hci_transport_t * transport;
+    void setup(void){
+        sim_time_us = 0;
+        num_received_packets = 0;
+        btstack_memory_init();
+        btstack_run_loop_init(&test_run_loop);
+        libusb_mock_init(BUS_BYTES_PER_MS);
+        libusb_mock_set_time_us(sim_time_us);
+        transport = hci_transport_usb_instance();
+        hci_init(transport, NULL);
+        hci_register_acl_packet_handler(&test_acl_packet_handler);
+        CHECK_EQUAL(0, transport->open());
+        hci_simulate_working_fuzz();
+        hci_setup_test_connections_fuzz();
+        // LE ACL packets larger than controller buffer get fragmented
+        test_le_read_buffer_size_complete();
+        test_run_until_le_buffer_size_known();
+    }
+    void teardown(void){
+        transport->close();
+        hci_free_connections_fuzz();
+        hci_deinit();
+        btstack_run_loop_deinit();
+        btstack_memory_deinit();
+    }
+};
+
+TEST(HCITransportUSB, MultiFragmentAclPacket){
+    uint8_t expected[HCI_ACL_BUFFER_SIZE];
+    test_send_l2cap_packet(expected, 0);
+    test_run_until_received(1);
+    CHECK_EQUAL(NUM_FRAGMENTS, libusb_mock_get_num_bulk_out());
+    CHECK_EQUAL(8 + L2CAP_PAYLOAD_LEN, received_sizes[0]);
+    MEMCMP_EQUAL(expected, received_packets[0], received_sizes[0]);
+}
+
+TEST(HCITransportUSB, MultiFragmentAclPacketsBackToBack){
+    uint8_t expected[2][HCI_ACL_BUFFER_SIZE];
+    test_send_l2cap_packet(expected[0], 0);
+    // next packet as soon as HCI packet buffer is released
+    test_run_until_packet_buffer_free();
+    test_send_l2cap_packet(expected[1], 0x80);
+    test_run_until_received(2);
+    CHECK_EQUAL(2 * NUM_FRAGMENTS, libusb_mock_get_num_bulk_out());
+    uint8_t i;
+    for (i = 0; i < 2; i++){
+        CHECK_EQUAL(8 + L2CAP_PAYLOAD_LEN, received_sizes[i]);
+        MEMCMP_EQUAL(expected[i], received_packets[i], received_sizes[i]);
+    }
+}
+
+#ifdef ENABLE_HCI_USB_ZERO_COPY
+TEST(HCITransportUSB, ZeroCopySingleTransferInFlight){
+    uint8_t expected[HCI_ACL_BUFFER_SIZE];
+    test_send_l2cap_packet(expected, 0);
+    test_run_until_received(1);
+    CHECK_EQUAL(1, libusb_mock_get_max_bulk_out_in_flight());
+}
+#endif
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -0,0 +1,537 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "libusb_mock.c"
+
+/*
+ *  libusb_mock.c
+ *
+ *  Simulated Bluetooth USB dongle with a single configuration and interface:
+ *  - 0x81 interrupt in for HCI Events, completes only for libusb_mock_send_event
+ *  - 0x02 bulk out for ACL/ISO Data, echoed back by the device on 0x82 bulk in
+ *  - control transfers for HCI Commands complete immediately
+ *
+ *  Bulk transfers share a half-duplex bus with fixed bandwidth. Transfers submitted by
+ *  the host are picked up at the next USB frame, the device NAKs bulk out if all of its
+ *  packet buffers are waiting to be sent back.
+ */
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libusb.h"
+#include "libusb_mock.h"
+
+#include "btstack_debug.h"
+
+#define MOCK_FRAME_US          1000
+#define MOCK_FIFO_SIZE           64
+#define MOCK_DEVICE_BUFFERS       8
+#define MOCK_MAX_PACKET_SIZE   1100
+
+#define MOCK_MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define MOCK_MAX(a, b) (((a) > (b)) ? (a) : (b))
+
+#define EP_EVENT_IN   0x81
+#define EP_ACL_IN     0x82
+#define EP_ACL_OUT    0x02
+
+typedef struct {
+    struct libusb_transfer * transfer;
+    uint64_t time_us;
+} mock_transfer_entry_t;
+
+typedef struct {
+    mock_transfer_entry_t entries[MOCK_FIFO_SIZE];
+    uint16_t head;
+    uint16_t count;
+} mock_transfer_fifo_t;
+
+typedef struct {
+    uint8_t  data[MOCK_MAX_PACKET_SIZE];
+    uint16_t len;
+    uint64_t ready_us;
+} mock_packet_t;
+
+struct libusb_device {
+    uint8_t dummy;
+};
+
+struct libusb_device_handle {
+    libusb_device * device;
+};
+
+static const struct libusb_endpoint_descriptor mock_endpoints[] = {
+    { EP_EVENT_IN, LIBUSB_TRANSFER_TYPE_INTERRUPT, 16, 1 },
+    { EP_ACL_IN,   LIBUSB_TRANSFER_TYPE_BULK,      64, 0 },
+    { EP_ACL_OUT,  LIBUSB_TRANSFER_TYPE_BULK,      64, 0 },
+};
+static const struct libusb_interface_descriptor mock_interface_descriptor = { 0, 0, 3, mock_endpoints };
+static const struct libusb_interface mock_interface = { &mock_interface_descriptor, 1 };
+static struct libusb_config_descriptor mock_config_descriptor = { 1, 1, &mock_interface };
+
+static libusb_device        mock_device;
+static libusb_device_handle mock_device_handle = { &mock_device };
+
+static uint64_t mock_now_us;
+static uint32_t mock_bus_bytes_per_ms;
+
+// submitted transfers
+static mock_transfer_fifo_t mock_bulk_out;
+static mock_transfer_fifo_t mock_bulk_in;
+static mock_transfer_fifo_t mock_interrupt_in;
+static mock_transfer_fifo_t mock_completed;
+
+// device packet buffers with data to send back
+static mock_packet_t mock_device_packets[MOCK_DEVICE_BUFFERS];
+static uint16_t      mock_device_packets_head;
+static uint16_t      mock_device_packets_count;
+
+// bus
+static bool                      mock_bus_active;
+static bool                      mock_bus_last_out;
+static struct libusb_transfer *  mock_bus_transfer;
+static uint64_t                  mock_bus_end_us;
+static uint64_t                  mock_bus_free_us;
+static uint64_t                  mock_bus_busy_us;
+
+static uint32_t mock_bulk_out_num;
+static uint32_t mock_bulk_out_in_flight;
+static uint32_t mock_bulk_out_in_flight_max;
+
+static void mock_fifo_init(mock_transfer_fifo_t * fifo){
+    fifo->head  = 0;
+    fifo->count = 0;
+}
+
+static void mock_fifo_push(mock_transfer_fifo_t * fifo, struct libusb_transfer * transfer, uint64_t time_us){
+    btstack_assert(fifo->count < MOCK_FIFO_SIZE);
+    mock_transfer_entry_t * entry = &fifo->entries[(fifo->head + fifo->count) % MOCK_FIFO_SIZE];
+    entry->transfer = transfer;
+    entry->time_us  = time_us;
+    fifo->count++;
+}
+
+static mock_transfer_entry_t * mock_fifo_peek(mock_transfer_fifo_t * fifo){
+    if (fifo->count == 0) return NULL;
+    return &fifo->entries[fifo->head];
+}
+
+static struct libusb_transfer * mock_fifo_pop(mock_transfer_fifo_t * fifo){
+    struct libusb_transfer * transfer = fifo->entries[fifo->head].transfer;
+    fifo->head = (fifo->head + 1) % MOCK_FIFO_SIZE;
+    fifo->count--;
+    return transfer;
+}
+
+static bool mock_fifo_remove(mock_transfer_fifo_t * fifo, struct libusb_transfer * transfer){
+    uint16_t i;
+    for (i = 0; i < fifo->count; i++){
+        if (fifo->entries[(fifo->head + i) % MOCK_FIFO_SIZE].transfer != transfer) continue;
+        for (; (i + 1) < fifo->count; i++){
+            fifo->entries[(fifo->head + i) % MOCK_FIFO_SIZE] = fifo->entries[(fifo->head + i + 1) % MOCK_FIFO_SIZE];
+        }
+        fifo->count--;
+        return true;
+    }
+    return false;
+}
+
+static uint64_t mock_next_frame_us(void){
+    return ((mock_now_us / MOCK_FRAME_US) + 1) * MOCK_FRAME_US;
+}
+
+static void mock_complete(struct libusb_transfer * transfer, enum libusb_transfer_status status, uint64_t time_us){
+    transfer->status = status;
+    mock_fifo_push(&mock_completed, transfer, time_us);
+}
+
+static void mock_bus_complete(void){
+    struct libusb_transfer * transfer = mock_bus_transfer;
+    mock_bus_active  = false;
+    mock_bus_free_us = mock_bus_end_us;
+    if (transfer->endpoint == EP_ACL_OUT){
+        // loopback
+        mock_packet_t * packet = &mock_device_packets[(mock_device_packets_head + mock_device_packets_count) % MOCK_DEVICE_BUFFERS];
+        btstack_assert(transfer->length <= MOCK_MAX_PACKET_SIZE);
+        memcpy(packet->data, transfer->buffer, transfer->length);
+        packet->len      = (uint16_t) transfer->length;
+        packet->ready_us = mock_bus_end_us;
+        mock_device_packets_count++;
+        transfer->actual_length = transfer->length;
+    } else {
+        mock_packet_t * packet = &mock_device_packets[mock_device_packets_head];
+        uint16_t len = (uint16_t) MOCK_MIN(packet->len, transfer->length);
+        memcpy(transfer->buffer, packet->data, len);
+        transfer->actual_length = len;
+        mock_device_packets_head = (mock_device_packets_head + 1) % MOCK_DEVICE_BUFFERS;
+        mock_device_packets_count--;
+    }
+    mock_complete(transfer, LIBUSB_TRANSFER_COMPLETED, mock_bus_end_us);
+}
+
+static void mock_bus_start(struct libusb_transfer * transfer, uint64_t start_us, uint16_t len){
+    uint64_t duration_us = ((uint64_t) len * 1000u + mock_bus_bytes_per_ms - 1u) / mock_bus_bytes_per_ms;
+    mock_bus_active   = true;
+    mock_bus_last_out = transfer->endpoint == EP_ACL_OUT;
+    mock_bus_transfer = transfer;
+    mock_bus_end_us   = start_us + duration_us;
+    mock_bus_busy_us += duration_us;
+}
+
+static void mock_bus_process(void){
+    while (true){
+        if (mock_bus_active){
+            if (mock_bus_end_us > mock_now_us) break;
+            mock_bus_complete();
+        }
+
+        uint64_t out_us = UINT64_MAX;
+        mock_transfer_entry_t * out = mock_fifo_peek(&mock_bulk_out);
+        if ((out != NULL) && (mock_device_packets_count < MOCK_DEVICE_BUFFERS)){
+            out_us = MOCK_MAX(mock_bus_free_us, out->time_us);
+        }
+
+        uint64_t in_us = UINT64_MAX;
+        mock_transfer_entry_t * in = mock_fifo_peek(&mock_bulk_in);
+        if ((in != NULL) && (mock_device_packets_count > 0)){
+            in_us = MOCK_MAX(mock_bus_free_us, MOCK_MAX(in->time_us, mock_device_packets[mock_device_packets_head].ready_us));
+        }
+
+        // alternate between directions if both are ready
+        bool use_out;
+        if (out_us == in_us){
+            if (out_us == UINT64_MAX) break;
+            use_out = !mock_bus_last_out;
+        } else {
+            use_out = out_us < in_us;
+        }
+
+        uint64_t start_us = use_out ? out_us : in_us;
+        if (start_us > mock_now_us) break;
+
+        if (use_out){
+            struct libusb_transfer * transfer = mock_fifo_pop(&mock_bulk_out);
+            mock_bus_start(transfer, start_us, (uint16_t) transfer->length);
+        } else {
+            struct libusb_transfer * transfer = mock_fifo_pop(&mock_bulk_in);
+            mock_bus_start(transfer, start_us, mock_device_packets[mock_device_packets_head].len);
+        }
+    }
+}
+
+void libusb_mock_init(uint32_t bus_bytes_per_ms){
+    mock_bus_bytes_per_ms = bus_bytes_per_ms;
+    mock_now_us = 0;
+    mock_fifo_init(&mock_bulk_out);
+    mock_fifo_init(&mock_bulk_in);
+    mock_fifo_init(&mock_interrupt_in);
+    mock_fifo_init(&mock_completed);
+    mock_device_packets_head  = 0;
+    mock_device_packets_count = 0;
+    mock_bus_active   = false;
+    mock_bus_last_out = false;
+    mock_bus_free_us  = 0;
+    mock_bus_busy_us  = 0;
+    mock_bulk_out_num           = 0;
+    mock_bulk_out_in_flight     = 0;
+    mock_bulk_out_in_flight_max = 0;
+}
+
+void libusb_mock_set_time_us(uint64_t now_us){
+    mock_now_us = now_us;
+}
+
+void libusb_mock_send_event(const uint8_t * packet, uint16_t size){
+    btstack_assert(mock_interrupt_in.count > 0);
+    struct libusb_transfer * transfer = mock_fifo_pop(&mock_interrupt_in);
+    btstack_assert(size <= transfer->length);
+    memcpy(transfer->buffer, packet, size);
+    transfer->actual_length = size;
+    mock_complete(transfer, LIBUSB_TRANSFER_COMPLETED, mock_now_us);
+}
+
+uint32_t libusb_mock_get_num_bulk_out(void){
+    return mock_bulk_out_num;
+}
+
+uint32_t libusb_mock_get_max_bulk_out_in_flight(void){
+    return mock_bulk_out_in_flight_max;
+}
+
+uint64_t libusb_mock_get_bus_busy_us(void){
+    return mock_bus_busy_us;
+}
+
+// libusb API
+
+int libusb_init(libusb_context **ctx){
+    UNUSED(ctx);
+    return LIBUSB_SUCCESS;
+}
+
+void libusb_exit(libusb_context *ctx){
+    UNUSED(ctx);
+}
+
+int libusb_set_option(libusb_context *ctx, enum libusb_option option, ...){
+    UNUSED(ctx);
+    UNUSED(option);
+    return LIBUSB_SUCCESS;
+}
+
+const char * libusb_error_name(int errcode){
+    UNUSED(errcode);
+    return "LIBUSB_ERROR";
+}
+
+libusb_device_handle * libusb_open_device_with_vid_pid(libusb_context *ctx, uint16_t vendor_id, uint16_t product_id){
+    UNUSED(ctx);
+    UNUSED(vendor_id);
+    UNUSED(product_id);
+    return &mock_device_handle;
+}
+
+int libusb_open(libusb_device *dev, libusb_device_handle **dev_handle){
+    UNUSED(dev);
+    *dev_handle = &mock_device_handle;
+    return LIBUSB_SUCCESS;
+}
+
+void libusb_close(libusb_device_handle *dev_handle){
+    UNUSED(dev_handle);
+}
+
+int libusb_reset_device(libusb_device_handle *dev_handle){
+    UNUSED(dev_handle);
+    return LIBUSB_SUCCESS;
+}
+
+libusb_device * libusb_get_device(libusb_device_handle *dev_handle){
+    return dev_handle->device;
+}
+
+ssize_t libusb_get_device_list(libusb_context *ctx, libusb_device ***list){
+    UNUSED(ctx);
+    UNUSED(list);
+    return LIBUSB_ERROR_NOT_FOUND;
+}
+
+void libusb_free_device_list(libusb_device **list, int unref_devices){
+    UNUSED(list);
+    UNUSED(unref_devices);
+}
+
+int libusb_get_device_descriptor(libusb_device *dev, struct libusb_device_descriptor *desc){
+    UNUSED(dev);
+    memset(desc, 0, sizeof(struct libusb_device_descriptor));
+    desc->bDeviceClass    = 0xE0;
+    desc->bDeviceSubClass = 0x01;
+    desc->bDeviceProtocol = 0x01;
+    return LIBUSB_SUCCESS;
+}
+
+uint8_t libusb_get_bus_number(libusb_device *dev){
+    UNUSED(dev);
+    return 1;
+}
+
+uint8_t libusb_get_device_address(libusb_device *dev){
+    UNUSED(dev);
+    return 1;
+}
+
+int libusb_get_port_numbers(libusb_device *dev, uint8_t *port_numbers, int port_numbers_len){
+    UNUSED(dev);
+    if (port_numbers_len < 1) return LIBUSB_ERROR_INVALID_PARAM;
+    port_numbers[0] = 1;
+    return 1;
+}
+
+int libusb_get_active_config_descriptor(libusb_device *dev, struct libusb_config_descriptor **config){
+    UNUSED(dev);
+    *config = &mock_config_descriptor;
+    return LIBUSB_SUCCESS;
+}
+
+void libusb_free_config_descriptor(struct libusb_config_descriptor *config){
+    UNUSED(config);
+}
+
+int libusb_kernel_driver_active(libusb_device_handle *dev_handle, int interface_number){
+    UNUSED(dev_handle);
+    UNUSED(interface_number);
+    return 0;
+}
+
+int libusb_detach_kernel_driver(libusb_device_handle *dev_handle, int interface_number){
+    UNUSED(dev_handle);
+    UNUSED(interface_number);
+    return LIBUSB_SUCCESS;
+}
+
+int libusb_attach_kernel_driver(libusb_device_handle *dev_handle, int interface_number){
+    UNUSED(dev_handle);
+    UNUSED(interface_number);
+    return LIBUSB_SUCCESS;
+}
+
+int libusb_set_configuration(libusb_device_handle *dev_handle, int configuration){
+    UNUSED(dev_handle);
+    UNUSED(configuration);
+    return LIBUSB_SUCCESS;
+}
+
+int libusb_claim_interface(libusb_device_handle *dev_handle, int interface_number){
+    UNUSED(dev_handle);
+    return (interface_number == 0) ? LIBUSB_SUCCESS : LIBUSB_ERROR_NOT_FOUND;
+}
+
+int libusb_release_interface(libusb_device_handle *dev_handle, int interface_number){
+    UNUSED(dev_handle);
+    UNUSED(interface_number);
+    return LIBUSB_SUCCESS;
+}
+
+int libusb_set_interface_alt_setting(libusb_device_handle *dev_handle, int interface_number, int alternate_setting){
+    UNUSED(dev_handle);
+    UNUSED(interface_number);
+    UNUSED(alternate_setting);
+    return LIBUSB_ERROR_NOT_FOUND;
+}
+
+int libusb_clear_halt(libusb_device_handle *dev_handle, unsigned char endpoint){
+    UNUSED(dev_handle);
+    UNUSED(endpoint);
+    return LIBUSB_SUCCESS;
+}
+
+struct libusb_transfer * libusb_alloc_transfer(int iso_packets){
+    size_t size = sizeof(struct libusb_transfer) + (size_t) iso_packets * sizeof(struct libusb_iso_packet_descriptor);
+    struct libusb_transfer * transfer = (struct libusb_transfer *) malloc(size);
+    if (transfer == NULL) return NULL;
+    memset(transfer, 0, size);
+    transfer->num_iso_packets = iso_packets;
+    return transfer;
+}
+
+void libusb_free_transfer(struct libusb_transfer *transfer){
+    free(transfer);
+}
+
+int libusb_submit_transfer(struct libusb_transfer *transfer){
+    mock_bus_process();
+    switch (transfer->endpoint){
+        case 0:
+            transfer->actual_length = transfer->length;
+            mock_complete(transfer, LIBUSB_TRANSFER_COMPLETED, mock_now_us);
+            break;
+        case EP_EVENT_IN:
+            mock_fifo_push(&mock_interrupt_in, transfer, mock_next_frame_us());
+            break;
+        case EP_ACL_IN:
+            mock_fifo_push(&mock_bulk_in, transfer, mock_next_frame_us());
+            break;
+        case EP_ACL_OUT:
+            mock_fifo_push(&mock_bulk_out, transfer, mock_next_frame_us());
+            mock_bulk_out_num++;
+            mock_bulk_out_in_flight++;
+            mock_bulk_out_in_flight_max = MOCK_MAX(mock_bulk_out_in_flight_max, mock_bulk_out_in_flight);
+            break;
+        default:
+            return LIBUSB_ERROR_INVALID_PARAM;
+    }
+    return LIBUSB_SUCCESS;
+}
+
+int libusb_cancel_transfer(struct libusb_transfer *transfer){
+    if (mock_fifo_remove(&mock_bulk_out, transfer) || mock_fifo_remove(&mock_bulk_in, transfer) || mock_fifo_remove(&mock_interrupt_in, transfer)){
+        mock_complete(transfer, LIBUSB_TRANSFER_CANCELLED, mock_now_us);
+        return LIBUSB_SUCCESS;
+    }
+    // transfer on the bus or already completed
+    return LIBUSB_ERROR_NOT_FOUND;
+}
+
+int libusb_handle_events_timeout_completed(libusb_context *ctx, struct timeval *tv, int *completed){
+    UNUSED(ctx);
+    UNUSED(tv);
+    UNUSED(completed);
+    mock_bus_process();
+    while (true){
+        mock_transfer_entry_t * entry = mock_fifo_peek(&mock_completed);
+        if (entry == NULL) break;
+        if (entry->time_us > mock_now_us) break;
+        struct libusb_transfer * transfer = mock_fifo_pop(&mock_completed);
+        if (transfer->endpoint == EP_ACL_OUT){
+            mock_bulk_out_in_flight--;
+        }
+        (*transfer->callback)(transfer);
+    }
+    return LIBUSB_SUCCESS;
+}
+
+int libusb_handle_events_timeout(libusb_context *ctx, struct timeval *tv){
+    // deliver everything that is on the bus right now, e.g. during shutdown
+    if (mock_bus_active){
+        mock_now_us = MOCK_MAX(mock_now_us, mock_bus_end_us);
+    }
+    return libusb_handle_events_timeout_completed(ctx, tv, NULL);
+}
+
+int libusb_pollfds_handle_timeouts(libusb_context *ctx){
+    UNUSED(ctx);
+    return 0;
+}
+
+const struct libusb_pollfd ** libusb_get_pollfds(libusb_context *ctx){
+    UNUSED(ctx);
+    return NULL;
+}
+
+void libusb_free_pollfds(const struct libusb_pollfd **pollfds){
+    UNUSED(pollfds);
+}
+
+void libusb_set_pollfd_notifiers(libusb_context *ctx, libusb_pollfd_added_cb added_cb, libusb_pollfd_removed_cb removed_cb, void *user_data){
+    UNUSED(ctx);
+    UNUSED(added_cb);
+    UNUSED(removed_cb);
+    UNUSED(user_data);
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/*
+ *  libusb_mock.h
+ *
+ *  Simulated Bluetooth USB dongle for hci_transport_h2_libusb.c
+ */
+
+#ifndef LIBUSB_MOCK_H_
+#define LIBUSB_MOCK_H_
+
+#include <stdint.h>
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Init simulated device with ACL loopback
+ * @param bus_bytes_per_ms shared (half-duplex) bus bandwidth used by bulk transfers
+ */
+void libusb_mock_init(uint32_t bus_bytes_per_ms);
+
+/**
+ * @brief Set virtual time, transfers that complete until then are reported by libusb_handle_events_*
+ * @param now_us
+ */
+void libusb_mock_set_time_us(uint64_t now_us);
+
+/**
+ * @brief Complete next interrupt in transfer with HCI Event, e.g. Command Complete
+ * @param packet
+ * @param size
+ */
+void libusb_mock_send_event(const uint8_t * packet, uint16_t size);
+
+/**
+ * @brief Number of bulk out transfers submitted since init
+ */
+uint32_t libusb_mock_get_num_bulk_out(void);
+
+/**
+ * @brief Max number of bulk out transfers submitted at the same time
+ */
+uint32_t libusb_mock_get_max_bulk_out_in_flight(void);
+
+/**
+ * @brief Time the bus was used by bulk transfers
+ */
+uint64_t libusb_mock_get_bus_busy_us(void);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif // LIBUSB_MOCK_H_
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// HFP AT parser micro-benchmark
+//
+// - parses typical AG and HF traffic with byte-wise hfp_parse and with
+//   hfp_parse_data, which processes whole RFCOMM payloads
+// - reports time per line and a checksum over the parsed commands, which has to
+//   be identical for both
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "classic/hfp.h"
+
+#define NUM_ITERATIONS 100000
+
+// received by AG
+static const char * ag_packets[] = {
+    "AT+BIEV=2,42\r",
+    "AT+CLCC\r",
+    "AT+VGS=12\r",
+    "AT+BIA=0,1,1,1,0,0,0\r",
+    "AT+CMER=3,0,0,1\r",
+    "AT+BAC=1,2\r",
+};
+
+// received by HF
+static const char * hf_packets[] = {
+    "\r\n+CIEV: 2,1\r\n",
+    "\r\n+CIEV: 5,3\r\n\r\nOK\r\n",
+    "\r\n+CLCC: 1,1,4,0,0,\"+491234567\",145\r\n\r\nOK\r\n",
+    "\r\n+CIND: 1,0,0,3,5,0,0\r\n",
+    "\r\n+VGS:12\r\n",
+    "\r\nRING\r\n\r\n+CLIP: \"+491234567\",145\r\n",
+};
+
+typedef struct {
+    const char *  name;
+    const char ** packets;
+    uint16_t      num_packets;
+    int           is_handsfree;
+} bench_t;
+
+static const bench_t benchmarks[] = {
+    { "AG", ag_packets, sizeof(ag_packets) / sizeof(const char *), 0 },
+    { "HF", hf_packets, sizeof(hf_packets) / sizeof(const char *), 1 },
+};
+
+static hfp_connection_t hfp_connection;
+static uint32_t checksum;
+static uint32_t num_lines;
+
+static void parse_byte_wise(const bench_t * bench){
+    uint16_t i;
+    for (i = 0; i < bench->num_packets; i++){
+        const uint8_t * packet = (const uint8_t *) bench->packets[i];
+        uint16_t size = (uint16_t) strlen(bench->packets[i]);
+        uint16_t pos;
+        for (pos = 0; pos < size; pos++){
+            hfp_parse(&hfp_connection, packet[pos], bench->is_handsfree);
+            if ((packet[pos] != '\r') && (packet[pos] != '\n')) continue;
+            checksum = (checksum * 31u) + hfp_connection.command;
+            num_lines++;
+        }
+    }
+}
+
+static void parse_data(const bench_t * bench){
+    uint16_t i;
+    for (i = 0; i < bench->num_packets; i++){
+        const uint8_t * packet = (const uint8_t *) bench->packets[i];
+        uint16_t size = (uint16_t) strlen(bench->packets[i]);
+        uint16_t pos = 0;
+        while (pos < size){
+            pos += hfp_parse_data(&hfp_connection, &packet[pos], size - pos, bench->is_handsfree);
+            if ((packet[pos - 1] != '\r') && (packet[pos - 1] != '\n')) continue;
+            checksum = (checksum * 31u) + hfp_connection.command;
+            num_lines++;
+        }
+    }
+}
+
+static double time_ms(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+static void run(const char * name, const bench_t * bench, void (*function)(const bench_t * bench)){
+    memset(&hfp_connection, 0, sizeof(hfp_connection_t));
+    checksum = 0;
+    num_lines = 0;
+    double start = time_ms();
+    int iteration;
+    for (iteration = 0; iteration < NUM_ITERATIONS; iteration++){
+        (*function)(bench);
+    }
+    double duration = time_ms() - start;
+    printf("%s %-10s %8.1f ns per line, checksum %08x\n", bench->name, name, (duration * 1000000.0) / num_lines, checksum);
+}
+
+int main(void){
+    hfp_init();
+    unsigned int i;
+    for (i = 0; i < sizeof(benchmarks) / sizeof(bench_t); i++){
+        run("byte-wise", &benchmarks[i], &parse_byte_wise);
+        run("data",      &benchmarks[i], &parse_data);
+    }
+    return 0;
+}
@@ -651,6 +651,103 @@ TEST(HFPParser, custom_command_hf_with_assignment){
     hfp_at_parser_test_dump_line_buffer();
 }
 
+// compare hfp_parse_data with byte-wise hfp_parse for all positions of a packet boundary
+static const char * parse_data_ag_packets[] = {
+    "\r\nAT+BRSF=438\r\n",
+    "AT+BAC=1,2\rAT+CIND=?\rAT+CIND?\r",
+    "AT+CMER=3,0,0,1\r\nAT+CHLD=?\r\n",
+    "AT+BIND=1,2\rAT+BIND=?\rAT+BIND?\r",
+    "AT+BIEV=2,42\r",
+    "AT+VTS=#\rATD1234567;\rATD>1;\r",
+    "AT+COPS=3,0\rAT+COPS?\r",
+    "AT+BVRA=1\rAT+CHLD=2\rAT+BTRH?\r",
+    "AT+FOO==1\rAT+BAR=\"A,B\"\rAT+\"X\"=1\r",
+    ";;AT+NREC=0;AT+VGS=5\r",
+    "AT+FOO?\rAT+TEST=ABCDE\rATA\r",
+    "AT+CLIP=1,  2 \rAT+CCWA=1\r\n\r\n",
+    "AT+BIA=,1,,0,1\r",
+    "\rA-?T;18VT,S,-;(",
+    "AT+UNKNOWN=0123456789012345678901234567890123456789012345678901234567890123456789012345678901234567890123456789\r",
+};
+
+static const char * parse_data_hf_packets[] = {
+    "\r\nOK\r\n\r\n+BRSF: 224\r\n",
+    "\r\n+CIND: (\"service\",(0,1)),(\"call\",(0,1)),(\"callsetup\",(0-3))\r\n",
+    "\r\n+CIND: 1,0,0,3,5,0,0\r\n",
+    "\r\n+CIEV: 3,1\r\n\r\nRING\r\n\r\n+CLIP: \"+49123\",145\r\n",
+    "\r\n+COPS: 0,0,\"operator name\"\r\n",
+    "\r\n+CME ERROR: 30\r\nERROR\r\n",
+    "\r\n+BIND: (1,2)\r\n+BIND: 1,1\r\n",
+    "\r\n+BVRA: 1,1,12AF,1,1,\"message\"\r\n",
+    "\r\n+VGS=5\r\n+VGM:9\r\n+BCS: 2\r\n",
+    "\r\n+CLCC: 1,1,0,0,0,\"1234\",129\r\n+CNUM: ,\"5551212\",129,,4\r\n",
+    "\r\n+TEST:ABC,1\r\n+FOO: 1\r\n",
+};
+
+static void parse_data_compare(const char * packet, int isHandsFree, uint16_t split){
+    static hfp_connection_t byte_wise;
+    static hfp_connection_t data_wise;
+    memset(&byte_wise, 0, sizeof(hfp_connection_t));
+    memset(&data_wise, 0, sizeof(hfp_connection_t));
+    uint16_t size = (uint16_t) strlen(packet);
+    uint16_t pos;
+    for (pos = 0; pos < size; pos++){
+        hfp_parse(&byte_wise, packet[pos], isHandsFree);
+    }
+    const uint8_t * data = (const uint8_t *) packet;
+    uint16_t chunk_start = 0;
+    while (chunk_start < size){
+        uint16_t chunk_end = (chunk_start < split) ? btstack_min(split, size) : size;
+        pos = chunk_start;
+        while (pos < chunk_end){
+            pos += hfp_parse_data(&data_wise, &data[pos], chunk_end - pos, isHandsFree);
+        }
+        chunk_start = chunk_end;
+    }
+    CHECK_EQUAL(byte_wise.command, data_wise.command);
+    CHECK_EQUAL(byte_wise.parser_state, data_wise.parser_state);
+    CHECK_EQUAL(byte_wise.line_size, data_wise.line_size);
+    MEMCMP_EQUAL(&byte_wise, &data_wise, sizeof(hfp_connection_t));
+}
+
+static void parse_data_compare_all_splits(const char * packet, int isHandsFree){
+    uint16_t split;
+    for (split = 0; split <= strlen(packet); split++){
+        parse_data_compare(packet, isHandsFree, split);
+    }
+}
+
+TEST(HFPParser, parse_data_ag){
+    hfp_custom_at_command_t custom_ag_command = {
+        .command = "AT+TEST=",
+        .command_id = 3
+    };
+    hfp_register_custom_ag_command(&custom_ag_command);
+    for (uint16_t i = 0; i < sizeof(parse_data_ag_packets) / sizeof(const char *); i++){
+        parse_data_compare_all_splits(parse_data_ag_packets[i], 0);
+    }
+}
+
+TEST(HFPParser, parse_data_hf){
+    hfp_custom_at_command_t custom_hf_command = {
+        .command = "+TEST:",
+        .command_id = 2
+    };
+    hfp_register_custom_hf_command(&custom_hf_command);
+    for (uint16_t i = 0; i < sizeof(parse_data_hf_packets) / sizeof(const char *); i++){
+        parse_data_compare_all_splits(parse_data_hf_packets[i], 1);
+    }
+}
+
+TEST(HFPParser, parse_data_stops_after_end_of_line){
+    const char * packet = "\r\nOK\r\n";
+    uint16_t consumed = hfp_parse_data(&context, (const uint8_t *) packet, (uint16_t) strlen(packet), 1);
+    CHECK_EQUAL(1, consumed);
+    consumed = hfp_parse_data(&context, (const uint8_t *) &packet[2], (uint16_t) strlen(&packet[2]), 1);
+    CHECK_EQUAL(3, consumed);
+    CHECK_EQUAL(HFP_CMD_OK, context.command);
+}
+
 int main (int argc, const char * argv[]){
     return CommandLineTestRunner::RunAllTests(argc, argv);
 }
@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// HID Parser micro-benchmark
+//
+// - decodes gaming mouse and keyboard input reports with btstack_hid_parser
+//   and with the btstack_hid_report_decoder using a compiled field table
+// - reports time per report and a checksum over all fields, which has to
+//   be identical for both
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "btstack_hid_parser.h"
+#include "btstack_util.h"
+
+#define NUM_ITERATIONS  200000
+#define MAX_FIELDS      16
+
+static const uint8_t gaming_mouse_descriptor[] = {
+    0x05, 0x01, 0x09, 0x02, 0xa1, 0x01, 0x85, 0x02, 0x09, 0x01, 0xa1, 0x00, 0x05, 0x09, 0x19, 0x01,
+    0x29, 0x10, 0x15, 0x00, 0x25, 0x01, 0x95, 0x10, 0x75, 0x01, 0x81, 0x02, 0x05, 0x01, 0x16, 0x01,
+    0xf8, 0x26, 0xff, 0x07, 0x75, 0x0c, 0x95, 0x02, 0x09, 0x30, 0x09, 0x31, 0x81, 0x06, 0x15, 0x81,
+    0x25, 0x7f, 0x75, 0x08, 0x95, 0x01, 0x09, 0x38, 0x81, 0x06, 0xc0, 0x06, 0x00, 0xff, 0x85, 0x03,
+    0x09, 0x01, 0x15, 0x00, 0x26, 0xff, 0x00, 0x75, 0x08, 0x95, 0x04, 0xb1, 0x02, 0xc0
+};
+static const uint8_t gaming_mouse_report[] = { 0x02, 0x05, 0x80, 0xff, 0x17, 0x80, 0xfe };
+
+static const uint8_t keyboard_descriptor[] = {
+    0x05, 0x01, 0x09, 0x06, 0xa1, 0x01, 0x75, 0x01, 0x95, 0x08, 0x05, 0x07, 0x19, 0xe0, 0x29, 0xe7,
+    0x15, 0x00, 0x25, 0x01, 0x81, 0x02, 0x75, 0x01, 0x95, 0x08, 0x81, 0x03, 0x95, 0x05, 0x75, 0x01,
+    0x05, 0x08, 0x19, 0x01, 0x29, 0x05, 0x91, 0x02, 0x95, 0x01, 0x75, 0x03, 0x91, 0x03, 0x95, 0x06,
+    0x75, 0x08, 0x15, 0x00, 0x25, 0xff, 0x05, 0x07, 0x19, 0x00, 0x29, 0xff, 0x81, 0x00, 0xc0
+};
+static const uint8_t keyboard_report[] = { 0x01, 0x00, 0x04, 0x05, 0x06, 0x00, 0x00, 0x00 };
+
+typedef struct {
+    const char    * name;
+    const uint8_t * descriptor;
+    uint16_t        descriptor_len;
+    const uint8_t * report;
+    uint16_t        report_len;
+} bench_t;
+
+static const bench_t benchmarks[] = {
+    { "gaming mouse", gaming_mouse_descriptor, sizeof(gaming_mouse_descriptor), gaming_mouse_report, sizeof(gaming_mouse_report) },
+    { "keyboard",     keyboard_descriptor,     sizeof(keyboard_descriptor),     keyboard_report,     sizeof(keyboard_report) },
+};
+
+static btstack_hid_field_t fields[MAX_FIELDS];
+static uint32_t checksum;
+
+static void update_checksum(uint16_t usage_page, uint16_t usage, int32_t value){
+    checksum = (checksum * 31u) + usage_page;
+    checksum = (checksum * 31u) + usage;
+    checksum = (checksum * 31u) + (uint32_t) value;
+}
+
+static void decode_with_parser(const bench_t * bench){
+    btstack_hid_parser_t parser;
+    btstack_hid_parser_init(&parser, bench->descriptor, bench->descriptor_len, HID_REPORT_TYPE_INPUT, bench->report, bench->report_len);
+    while (btstack_hid_parser_has_more(&parser)){
+        uint16_t usage_page;
+        uint16_t usage;
+        int32_t  value;
+        btstack_hid_parser_get_field(&parser, &usage_page, &usage, &value);
+        update_checksum(usage_page, usage, value);
+    }
+}
+
+static void decode_with_decoder(const btstack_hid_field_table_t * table, const bench_t * bench){
+    btstack_hid_report_decoder_t decoder;
+    btstack_hid_report_decoder_init(&decoder, table, HID_REPORT_TYPE_INPUT, bench->report, bench->report_len);
+    while (btstack_hid_report_decoder_has_more(&decoder)){
+        uint16_t usage_page;
+        uint16_t usage;
+        int32_t  value;
+        btstack_hid_report_decoder_get_field(&decoder, &usage_page, &usage, &value);
+        update_checksum(usage_page, usage, value);
+    }
+}
+
+static double time_ms(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+int main(void){
+    unsigned int i;
+    for (i = 0; i < sizeof(benchmarks) / sizeof(bench_t); i++){
+        const bench_t * bench = &benchmarks[i];
+        int iteration;
+
+        checksum = 0;
+        double start = time_ms();
+        for (iteration = 0; iteration < NUM_ITERATIONS; iteration++){
+            decode_with_parser(bench);
+        }
+        double duration = time_ms() - start;
+        printf("%-14s parser  %8.3f us, checksum %08x\n", bench->name, (duration * 1000.0) / NUM_ITERATIONS, checksum);
+
+        btstack_hid_field_table_t table;
+        table.fields = fields;
+        table.num_fields = btstack_hid_descriptor_compile(bench->descriptor, bench->descriptor_len, fields, MAX_FIELDS);
+        if (table.num_fields > MAX_FIELDS){
+            printf("%-14s field table too small, %u fields required\n", bench->name, table.num_fields);
+            return 1;
+        }
+
+        checksum = 0;
+        start = time_ms();
+        for (iteration = 0; iteration < NUM_ITERATIONS; iteration++){
+            decode_with_decoder(&table, bench);
+        }
+        duration = time_ms() - start;
+        printf("%-14s decoder %8.3f us, checksum %08x\n", bench->name, (duration * 1000.0) / NUM_ITERATIONS, checksum);
+    }
+    return 0;
+}
@@ -220,6 +220,51 @@ const uint8_t combo_report1[]    = { 0x01, 0x03, 0x02, 0x03 };
 const uint8_t combo_report2[]    = { 0x02, 0x01, 0x00,  0x04, 0x05, 0x06, 0x00, 0x00, 0x00 };
 
 
+// gaming mouse with 16 buttons, 12-bit X/Y packed into 3 bytes, wheel, and vendor feature report with a single usage
+const uint8_t gaming_mouse_descriptor[] = {
+    0x05, 0x01,                    // Usage Page (Generic Desktop)
+    0x09, 0x02,                    // Usage (Mouse)
+    0xa1, 0x01,                    // Collection (Application)
+    0x85, 0x02,                    //   Report ID (2)
+    0x09, 0x01,                    //   Usage (Pointer)
+    0xa1, 0x00,                    //   Collection (Physical)
+    0x05, 0x09,                    //     Usage Page (Button)
+    0x19, 0x01,                    //     Usage Minimum (1)
+    0x29, 0x10,                    //     Usage Maximum (16)
+    0x15, 0x00,                    //     Logical Minimum (0)
+    0x25, 0x01,                    //     Logical Maximum (1)
+    0x95, 0x10,                    //     Report Count (16)
+    0x75, 0x01,                    //     Report Size (1)
+    0x81, 0x02,                    //     Input (Data, Variable, Absolute)
+    0x05, 0x01,                    //     Usage Page (Generic Desktop)
+    0x16, 0x01, 0xf8,              //     Logical Minimum (-2047)
+    0x26, 0xff, 0x07,              //     Logical Maximum (2047)
+    0x75, 0x0c,                    //     Report Size (12)
+    0x95, 0x02,                    //     Report Count (2)
+    0x09, 0x30,                    //     Usage (X)
+    0x09, 0x31,                    //     Usage (Y)
+    0x81, 0x06,                    //     Input (Data, Variable, Relative)
+    0x15, 0x81,                    //     Logical Minimum (-127)
+    0x25, 0x7f,                    //     Logical Maximum (127)
+    0x75, 0x08,                    //     Report Size (8)
+    0x95, 0x01,                    //     Report Count (1)
+    0x09, 0x38,                    //     Usage (Wheel)
+    0x81, 0x06,                    //     Input (Data, Variable, Relative)
+    0xc0,                          //   End Collection
+    0x06, 0x00, 0xff,              //   Usage Page (Vendor Defined)
+    0x85, 0x03,                    //   Report ID (3)
+    0x09, 0x01,                    //   Usage (Vendor Usage 1)
+    0x15, 0x00,                    //   Logical Minimum (0)
+    0x26, 0xff, 0x00,              //   Logical Maximum (255)
+    0x75, 0x08,                    //   Report Size (8)
+    0x95, 0x04,                    //   Report Count (4)
+    0xb1, 0x02,                    //   Feature (Data, Variable, Absolute)
+    0xc0                           // End Collection
+};
+
+const uint8_t gaming_mouse_report[] = { 0x02, 0x05, 0x80, 0xff, 0x17, 0x80, 0xfe };
+const uint8_t gaming_mouse_feature_report[] = { 0x03, 0x11, 0x22, 0x33, 0x44 };
+
 
 static void expect_field(btstack_hid_parser_t * parser, uint16_t expected_usage_page, uint16_t expected_usage, int32_t expected_value){
     // printf("expected - usage page %02x, usage %04x, value %02x (bit pos %u)\n", expected_usage_page, expected_usage, expected_value, parser->report_pos_in_bit);
@@ -345,6 +390,132 @@ TEST(HID, GetReportSize){
 }
 
 
+// compiled descriptor
+
+static btstack_hid_field_t hid_fields[32];
+
+static void compile_descriptor(btstack_hid_field_table_t * field_table, const uint8_t * hid_descriptor, uint16_t hid_descriptor_len){
+    uint16_t num_fields = btstack_hid_descriptor_compile(hid_descriptor, hid_descriptor_len, hid_fields, sizeof(hid_fields) / sizeof(btstack_hid_field_t));
+    CHECK_TRUE(num_fields <= sizeof(hid_fields) / sizeof(btstack_hid_field_t));
+    field_table->fields = hid_fields;
+    field_table->num_fields = num_fields;
+}
+
+static void expect_decoder_field(btstack_hid_report_decoder_t * decoder, uint16_t expected_usage_page, uint16_t expected_usage, int32_t expected_value){
+    CHECK_TRUE(btstack_hid_report_decoder_has_more(decoder));
+    uint16_t usage_page;
+    uint16_t usage;
+    int32_t value;
+    btstack_hid_report_decoder_get_field(decoder, &usage_page, &usage, &value);
+    CHECK_EQUAL(expected_usage_page, usage_page);
+    CHECK_EQUAL(expected_usage, usage);
+    CHECK_EQUAL(expected_value, value);
+}
+
+// decode report with parser and decoder and compare all fields
+static void compare_with_parser(const uint8_t * hid_descriptor, uint16_t hid_descriptor_len, hid_report_type_t report_type, const uint8_t * report, uint16_t report_len){
+    btstack_hid_field_table_t field_table;
+    compile_descriptor(&field_table, hid_descriptor, hid_descriptor_len);
+    btstack_hid_parser_t parser;
+    btstack_hid_parser_init(&parser, hid_descriptor, hid_descriptor_len, report_type, report, report_len);
+    btstack_hid_report_decoder_t decoder;
+    btstack_hid_report_decoder_init(&decoder, &field_table, report_type, report, report_len);
+    int num_fields = 0;
+    while (btstack_hid_parser_has_more(&parser)){
+        uint16_t usage_page;
+        uint16_t usage;
+        int32_t value;
+        btstack_hid_parser_get_field(&parser, &usage_page, &usage, &value);
+        expect_decoder_field(&decoder, usage_page, usage, value);
+        num_fields++;
+    }
+    CHECK_FALSE(btstack_hid_report_decoder_has_more(&decoder));
+    CHECK_TRUE(num_fields > 0);
+}
+
+TEST(HID, CompiledMatchesParser){
+    compare_with_parser(mouse_descriptor_without_report_id, sizeof(mouse_descriptor_without_report_id), HID_REPORT_TYPE_INPUT, mouse_report_without_id_positive_xy, sizeof(mouse_report_without_id_positive_xy));
+    compare_with_parser(mouse_descriptor_without_report_id, sizeof(mouse_descriptor_without_report_id), HID_REPORT_TYPE_INPUT, mouse_report_without_id_negative_xy, sizeof(mouse_report_without_id_negative_xy));
+    compare_with_parser(mouse_descriptor_with_report_id, sizeof(mouse_descriptor_with_report_id), HID_REPORT_TYPE_INPUT, mouse_report_with_id_1, sizeof(mouse_report_with_id_1));
+    compare_with_parser(hid_descriptor_keyboard_boot_mode, sizeof(hid_descriptor_keyboard_boot_mode), HID_REPORT_TYPE_INPUT, keyboard_report1, sizeof(keyboard_report1));
+    compare_with_parser(combo_descriptor_with_report_ids, sizeof(combo_descriptor_with_report_ids), HID_REPORT_TYPE_INPUT, combo_report1, sizeof(combo_report1));
+    compare_with_parser(combo_descriptor_with_report_ids, sizeof(combo_descriptor_with_report_ids), HID_REPORT_TYPE_INPUT, combo_report2, sizeof(combo_report2));
+    compare_with_parser(gaming_mouse_descriptor, sizeof(gaming_mouse_descriptor), HID_REPORT_TYPE_INPUT, gaming_mouse_report, sizeof(gaming_mouse_report));
+}
+
+TEST(HID, CompiledGamingMouse){
+    btstack_hid_field_table_t field_table;
+    compile_descriptor(&field_table, gaming_mouse_descriptor, sizeof(gaming_mouse_descriptor));
+    // buttons, X/Y, wheel, vendor feature with first usage and repeated last usage
+    CHECK_EQUAL(5, field_table.num_fields);
+    CHECK_EQUAL(6, btstack_hid_field_table_get_report_size_for_id(&field_table, 2, HID_REPORT_TYPE_INPUT));
+    CHECK_EQUAL(4, btstack_hid_field_table_get_report_size_for_id(&field_table, 3, HID_REPORT_TYPE_FEATURE));
+    CHECK_EQUAL(0, btstack_hid_field_table_get_report_size_for_id(&field_table, 3, HID_REPORT_TYPE_INPUT));
+
+    btstack_hid_report_decoder_t decoder;
+    btstack_hid_report_decoder_init(&decoder, &field_table, HID_REPORT_TYPE_INPUT, gaming_mouse_report, sizeof(gaming_mouse_report));
+    uint16_t button;
+    for (button = 1; button <= 16; button++){
+        int32_t pressed = ((button == 1) || (button == 3) || (button == 16)) ? 1 : 0;
+        expect_decoder_field(&decoder, 9, button, pressed);
+    }
+    expect_decoder_field(&decoder, 1, 0x30, 2047);
+    expect_decoder_field(&decoder, 1, 0x31, -2047);
+    expect_decoder_field(&decoder, 1, 0x38, -2);
+    CHECK_FALSE(btstack_hid_report_decoder_has_more(&decoder));
+
+    // feature report: all values use last usage
+    btstack_hid_report_decoder_init(&decoder, &field_table, HID_REPORT_TYPE_FEATURE, gaming_mouse_feature_report, sizeof(gaming_mouse_feature_report));
+    expect_decoder_field(&decoder, 0xff00, 1, 0x11);
+    expect_decoder_field(&decoder, 0xff00, 1, 0x22);
+    expect_decoder_field(&decoder, 0xff00, 1, 0x33);
+    expect_decoder_field(&decoder, 0xff00, 1, 0x44);
+    CHECK_FALSE(btstack_hid_report_decoder_has_more(&decoder));
+}
+
+TEST(HID, CompiledShortReport){
+    btstack_hid_field_table_t field_table;
+    compile_descriptor(&field_table, gaming_mouse_descriptor, sizeof(gaming_mouse_descriptor));
+    btstack_hid_report_decoder_t decoder;
+    // report id and buttons only
+    btstack_hid_report_decoder_init(&decoder, &field_table, HID_REPORT_TYPE_INPUT, gaming_mouse_report, 3);
+    uint16_t button;
+    for (button = 1; button <= 16; button++){
+        CHECK_TRUE(btstack_hid_report_decoder_has_more(&decoder));
+        uint16_t usage_page;
+        uint16_t usage;
+        int32_t value;
+        btstack_hid_report_decoder_get_field(&decoder, &usage_page, &usage, &value);
+    }
+    CHECK_FALSE(btstack_hid_report_decoder_has_more(&decoder));
+    // unknown report id
+    const uint8_t unknown_report[] = { 0x07, 0x00 };
+    btstack_hid_report_decoder_init(&decoder, &field_table, HID_REPORT_TYPE_INPUT, unknown_report, sizeof(unknown_report));
+    CHECK_FALSE(btstack_hid_report_decoder_has_more(&decoder));
+}
+
+TEST(HID, CompiledStorageTooSmall){
+    btstack_hid_field_t fields[2];
+    uint16_t num_fields = btstack_hid_descriptor_compile(combo_descriptor_with_report_ids, sizeof(combo_descriptor_with_report_ids), fields, 2);
+    CHECK_TRUE(num_fields > 2);
+    CHECK_EQUAL(num_fields, btstack_hid_descriptor_compile(combo_descriptor_with_report_ids, sizeof(combo_descriptor_with_report_ids), hid_fields, sizeof(hid_fields) / sizeof(btstack_hid_field_t)));
+}
+
+TEST(HID, CompiledGetReportSize){
+    btstack_hid_field_table_t field_table;
+    compile_descriptor(&field_table, combo_descriptor_with_report_ids, sizeof(combo_descriptor_with_report_ids));
+    CHECK_EQUAL(btstack_hid_get_report_size_for_id(1, HID_REPORT_TYPE_INPUT, sizeof(combo_descriptor_with_report_ids), combo_descriptor_with_report_ids),
+                btstack_hid_field_table_get_report_size_for_id(&field_table, 1, HID_REPORT_TYPE_INPUT));
+    CHECK_EQUAL(btstack_hid_get_report_size_for_id(2, HID_REPORT_TYPE_INPUT, sizeof(combo_descriptor_with_report_ids), combo_descriptor_with_report_ids),
+                btstack_hid_field_table_get_report_size_for_id(&field_table, 2, HID_REPORT_TYPE_INPUT));
+    CHECK_EQUAL(btstack_hid_get_report_size_for_id(2, HID_REPORT_TYPE_OUTPUT, sizeof(combo_descriptor_with_report_ids), combo_descriptor_with_report_ids),
+                btstack_hid_field_table_get_report_size_for_id(&field_table, 2, HID_REPORT_TYPE_OUTPUT));
+    compile_descriptor(&field_table, hid_descriptor_keyboard_boot_mode, sizeof(hid_descriptor_keyboard_boot_mode));
+    CHECK_EQUAL(1, btstack_hid_field_table_get_report_size_for_id(&field_table, 0, HID_REPORT_TYPE_OUTPUT));
+    CHECK_EQUAL(8, btstack_hid_field_table_get_report_size_for_id(&field_table, 0, HID_REPORT_TYPE_INPUT));
+}
+
+
 int main (int argc, const char * argv[]){
     // log into file using HCI_DUMP_PACKETLOGGER format
     const char * pklg_path = "hci_dump.pklg";
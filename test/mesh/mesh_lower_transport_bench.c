@@ -0,0 +1,431 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// Mesh Lower Transport segmented message simulation
+//
+// - sends one segmented Access message to each of N destinations in parallel
+//   and, as reference, to each destination one after the other
+// - simulated run loop with virtual time, network layer is replaced by a single
+//   bearer that transmits one Network PDU every BEARER_PDU_TIME_MS
+// - destinations acknowledge received segments when complete or when their
+//   acknowledgment timer fires, segments are lost with a fixed probability
+// - reports time until all messages have been acknowledged and number of
+//   segments sent
+//
+// *****************************************************************************
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "btstack_config.h"
+#include "btstack_debug.h"
+#include "btstack_linked_list.h"
+#include "btstack_memory.h"
+#include "btstack_run_loop.h"
+#include "btstack_util.h"
+
+#include "mesh/mesh_iv_index_seq_number.h"
+#include "mesh/mesh_keys.h"
+#include "mesh/mesh_lower_transport.h"
+#include "mesh/mesh_network.h"
+#include "mesh/mesh_node.h"
+#include "mesh/mesh_peer.h"
+
+#define BEARER_PDU_TIME_MS     30
+#define MESSAGE_TTL             3
+#define MESSAGE_LEN           120
+#define MAX_DESTINATIONS       16
+#define SIMULATION_TIMEOUT_MS  (10 * 60 * 1000)
+
+#define SRC_ADDRESS        0x0001
+#define FIRST_DST_ADDRESS  0x0100
+
+// simulated destination
+typedef struct {
+    mesh_peer_t peer;
+    uint16_t    seq_zero;
+    uint32_t    block_ack;
+    uint32_t    seq;
+    bool        complete;
+    btstack_timer_source_t ack_timer;
+} destination_t;
+
+static destination_t destinations[MAX_DESTINATIONS];
+static uint16_t      num_destinations;
+
+static uint32_t sim_time_ms;
+static btstack_linked_list_t timers;
+
+static btstack_linked_list_t  bearer_queue;
+static btstack_timer_source_t bearer_timer;
+static bool                   bearer_active;
+
+static void (*network_higher_layer_handler)(mesh_network_callback_type_t callback_type, mesh_network_pdu_t * network_pdu);
+
+static uint32_t sequence_number;
+static uint32_t lfsr_random = 0x12345678;
+static uint8_t  loss_percent;
+
+static uint16_t num_messages_pending;
+static uint32_t num_segments_sent;
+static uint32_t num_segments_lost;
+static uint32_t num_acks_sent;
+static uint32_t num_failed;
+
+static FILE * report;
+
+/* taps: 32 31 29 1; characteristic polynomial: x^32 + x^31 + x^29 + x + 1 */
+#define LFSR(a) ((a >> 1) ^ (uint32_t)((0 - (a & 1u)) & 0xd0000001u))
+
+// simulated run loop
+
+void btstack_run_loop_set_timer(btstack_timer_source_t * ts, uint32_t timeout_in_ms){
+    ts->timeout = sim_time_ms + timeout_in_ms;
+}
+
+void btstack_run_loop_set_timer_handler(btstack_timer_source_t * ts, void (*process)(btstack_timer_source_t * _ts)){
+    ts->process = process;
+}
+
+void btstack_run_loop_set_timer_context(btstack_timer_source_t * ts, void * context){
+    ts->context = context;
+}
+
+void * btstack_run_loop_get_timer_context(btstack_timer_source_t * ts){
+    return ts->context;
+}
+
+void btstack_run_loop_add_timer(btstack_timer_source_t * ts){
+    btstack_linked_item_t * it;
+    for (it = (btstack_linked_item_t *) &timers; it->next != NULL; it = it->next){
+        btstack_timer_source_t * next = (btstack_timer_source_t *) it->next;
+        btstack_assert(next != ts);
+        if (next->timeout > ts->timeout) break;
+    }
+    ts->item.next = it->next;
+    it->next = (btstack_linked_item_t *) ts;
+}
+
+int btstack_run_loop_remove_timer(btstack_timer_source_t * ts){
+    return btstack_linked_list_remove(&timers, (btstack_linked_item_t *) ts);
+}
+
+static void simulation_run(void){
+    while (!btstack_linked_list_empty(&timers) && (num_messages_pending > 0)){
+        btstack_timer_source_t * ts = (btstack_timer_source_t *) btstack_linked_list_pop(&timers);
+        sim_time_ms = ts->timeout;
+        if (sim_time_ms > SIMULATION_TIMEOUT_MS) break;
+        ts->process(ts);
+    }
+}
+
+// stubs
+
+uint32_t mesh_sequence_number_next(void){
+    return sequence_number++;
+}
+
+uint16_t mesh_node_get_primary_element_address(void){
+    return SRC_ADDRESS;
+}
+
+mesh_network_key_t * mesh_network_key_list_get(uint16_t netkey_index){
+    UNUSED(netkey_index);
+    return NULL;
+}
+
+mesh_peer_t * mesh_peer_for_addr(uint16_t address){
+    if (address < FIRST_DST_ADDRESS) return NULL;
+    if (address >= (FIRST_DST_ADDRESS + num_destinations)) return NULL;
+    return &destinations[address - FIRST_DST_ADDRESS].peer;
+}
+
+// simulated network layer
+
+mesh_network_pdu_t * mesh_network_pdu_get(void){
+    mesh_network_pdu_t * network_pdu = btstack_memory_mesh_network_pdu_get();
+    if (network_pdu != NULL){
+        network_pdu->pdu_header.pdu_type = MESH_PDU_TYPE_NETWORK;
+    }
+    return network_pdu;
+}
+
+void mesh_network_pdu_free(mesh_network_pdu_t * network_pdu){
+    btstack_memory_mesh_network_pdu_free(network_pdu);
+}
+
+void mesh_network_set_higher_layer_handler(void (*packet_handler)(mesh_network_callback_type_t callback_type, mesh_network_pdu_t * network_pdu)){
+    network_higher_layer_handler = packet_handler;
+}
+
+void mesh_network_message_processed_by_higher_layer(mesh_network_pdu_t * network_pdu){
+    mesh_network_pdu_free(network_pdu);
+}
+
+void mesh_network_setup_pdu(mesh_network_pdu_t * network_pdu, uint16_t netkey_index, uint8_t nid, uint8_t ctl, uint8_t ttl, uint32_t seq, uint16_t src, uint16_t dest, const uint8_t * transport_pdu_data, uint8_t transport_pdu_len){
+    network_pdu->netkey_index = netkey_index;
+    network_pdu->data[0] = nid;
+    network_pdu->data[1] = (ctl << 7) | (ttl & 0x7f);
+    big_endian_store_24(network_pdu->data, 2, seq);
+    big_endian_store_16(network_pdu->data, 5, src);
+    big_endian_store_16(network_pdu->data, 7, dest);
+    (void)memcpy(&network_pdu->data[9], transport_pdu_data, transport_pdu_len);
+    network_pdu->len = 9 + transport_pdu_len;
+}
+
+int mesh_network_address_unicast(uint16_t addr){
+    return ((addr != MESH_ADDRESS_UNSASSIGNED) && (addr < 0x8000u)) ? 1 : 0;
+}
+
+uint16_t mesh_network_control(mesh_network_pdu_t * network_pdu){
+    return network_pdu->data[1] & 0x80;
+}
+
+uint8_t mesh_network_ttl(mesh_network_pdu_t * network_pdu){
+    return network_pdu->data[1] & 0x7f;
+}
+
+uint32_t mesh_network_seq(mesh_network_pdu_t * network_pdu){
+    return big_endian_read_24(network_pdu->data, 2);
+}
+
+uint16_t mesh_network_src(mesh_network_pdu_t * network_pdu){
+    return big_endian_read_16(network_pdu->data, 5);
+}
+
+int mesh_network_segmented(mesh_network_pdu_t * network_pdu){
+    return network_pdu->data[9] & 0x80;
+}
+
+uint8_t * mesh_network_pdu_data(mesh_network_pdu_t * network_pdu){
+    return &network_pdu->data[9];
+}
+
+uint8_t mesh_network_pdu_len(mesh_network_pdu_t * network_pdu){
+    return network_pdu->len - 9;
+}
+
+static void destination_send_ack(destination_t * destination){
+    uint16_t address = FIRST_DST_ADDRESS + (uint16_t) (destination - destinations);
+    uint8_t ack[7];
+    ack[0] = 0;
+    big_endian_store_16(ack, 1, destination->seq_zero << 2);
+    big_endian_store_32(ack, 3, destination->block_ack);
+
+    mesh_network_pdu_t * network_pdu = mesh_network_pdu_get();
+    btstack_assert(network_pdu != NULL);
+    mesh_network_setup_pdu(network_pdu, 0, 0, 1, MESSAGE_TTL, ++destination->seq, address, SRC_ADDRESS, ack, sizeof(ack));
+    num_acks_sent++;
+    (*network_higher_layer_handler)(MESH_NETWORK_PDU_RECEIVED, network_pdu);
+}
+
+static void destination_ack_timeout(btstack_timer_source_t * ts){
+    destination_send_ack((destination_t *) btstack_run_loop_get_timer_context(ts));
+}
+
+static void destination_receive_segment(const mesh_network_pdu_t * network_pdu){
+    uint16_t dst = big_endian_read_16(network_pdu->data, 7);
+    destination_t * destination = &destinations[dst - FIRST_DST_ADDRESS];
+    uint32_t header = big_endian_read_24(network_pdu->data, 10);
+    uint16_t seq_zero = (header >> 10) & 0x1fff;
+    uint8_t  seg_o    = (header >> 5) & 0x1f;
+    uint8_t  seg_n    = header & 0x1f;
+
+    if (destination->seq_zero != seq_zero){
+        destination->seq_zero = seq_zero;
+        destination->block_ack = 0;
+        destination->complete = false;
+    }
+    destination->block_ack |= 1u << seg_o;
+
+    // ack complete message right away, resend ack for duplicate segments
+    uint32_t all_segments = (seg_n < 31) ? ((1u << (seg_n + 1)) - 1u) : 0xffffffffu;
+    if (destination->block_ack == all_segments){
+        destination->complete = true;
+        btstack_run_loop_remove_timer(&destination->ack_timer);
+        destination_send_ack(destination);
+        return;
+    }
+
+    // start acknowledgment timer - "set to a minimum of 150 + 50 * TTL milliseconds"
+    if (btstack_linked_list_remove(&timers, (btstack_linked_item_t *) &destination->ack_timer) == false){
+        btstack_run_loop_set_timer(&destination->ack_timer, 150 + 50 * MESSAGE_TTL);
+    }
+    btstack_run_loop_set_timer_handler(&destination->ack_timer, &destination_ack_timeout);
+    btstack_run_loop_set_timer_context(&destination->ack_timer, destination);
+    btstack_run_loop_add_timer(&destination->ack_timer);
+}
+
+static void bearer_start(void){
+    if (bearer_active) return;
+    if (btstack_linked_list_empty(&bearer_queue)) return;
+    bearer_active = true;
+    btstack_run_loop_set_timer(&bearer_timer, BEARER_PDU_TIME_MS);
+    btstack_run_loop_add_timer(&bearer_timer);
+}
+
+static void bearer_pdu_sent(btstack_timer_source_t * ts){
+    UNUSED(ts);
+    bearer_active = false;
+    mesh_network_pdu_t * network_pdu = (mesh_network_pdu_t *) btstack_linked_list_pop(&bearer_queue);
+    num_segments_sent++;
+    lfsr_random = LFSR(lfsr_random);
+    if ((lfsr_random % 100u) < loss_percent){
+        num_segments_lost++;
+    } else {
+        destination_receive_segment(network_pdu);
+    }
+    (*network_higher_layer_handler)(MESH_NETWORK_PDU_SENT, network_pdu);
+    bearer_start();
+}
+
+void mesh_network_send_pdu(mesh_network_pdu_t * network_pdu){
+    btstack_linked_list_add_tail(&bearer_queue, (btstack_linked_item_t *) network_pdu);
+    bearer_start();
+}
+
+// simulated upper transport
+
+static void upper_transport_handler(mesh_transport_callback_type_t callback_type, mesh_transport_status_t status, mesh_pdu_t * pdu){
+    if (callback_type != MESH_TRANSPORT_PDU_SENT) return;
+    btstack_assert(pdu->pdu_type == MESH_PDU_TYPE_SEGMENTED);
+    mesh_segmented_pdu_t * segmented_pdu = (mesh_segmented_pdu_t *) pdu;
+    if (status != MESH_TRANSPORT_STATUS_SUCCESS){
+        num_failed++;
+    }
+    while (!btstack_linked_list_empty(&segmented_pdu->segments)){
+        mesh_network_pdu_free((mesh_network_pdu_t *) btstack_linked_list_pop(&segmented_pdu->segments));
+    }
+    btstack_memory_mesh_segmented_pdu_free(segmented_pdu);
+    num_messages_pending--;
+}
+
+static void send_message(uint16_t dst){
+    mesh_segmented_pdu_t * segmented_pdu = btstack_memory_mesh_segmented_pdu_get();
+    btstack_assert(segmented_pdu != NULL);
+    segmented_pdu->pdu_header.pdu_type = MESH_PDU_TYPE_SEGMENTED;
+    segmented_pdu->ivi_nid = 0x68;
+    segmented_pdu->ctl_ttl = MESSAGE_TTL;
+    segmented_pdu->src = SRC_ADDRESS;
+    segmented_pdu->dst = dst;
+    segmented_pdu->seq = mesh_sequence_number_next();
+    segmented_pdu->flags = MESH_TRANSPORT_FLAG_SEQ_RESERVED;
+    segmented_pdu->akf_aid_control = 0x40 | 0x26;
+    segmented_pdu->len = MESSAGE_LEN;
+    uint16_t offset;
+    for (offset = 0; offset < MESSAGE_LEN; offset += MESH_NETWORK_PAYLOAD_MAX){
+        mesh_network_pdu_t * chunk = mesh_network_pdu_get();
+        btstack_assert(chunk != NULL);
+        memset(chunk->data, (uint8_t) offset, sizeof(chunk->data));
+        chunk->len = btstack_min(MESSAGE_LEN - offset, MESH_NETWORK_PAYLOAD_MAX);
+        btstack_linked_list_add_tail(&segmented_pdu->segments, (btstack_linked_item_t *) chunk);
+    }
+    num_messages_pending++;
+    mesh_lower_transport_send_pdu((mesh_pdu_t *) segmented_pdu);
+}
+
+static void simulation_init(uint16_t destination_count, uint8_t loss){
+    memset(destinations, 0, sizeof(destinations));
+    num_destinations = destination_count;
+    loss_percent = loss;
+    sim_time_ms = 0;
+    timers = NULL;
+    bearer_queue = NULL;
+    bearer_active = false;
+    btstack_run_loop_set_timer_handler(&bearer_timer, &bearer_pdu_sent);
+    num_segments_sent = 0;
+    num_segments_lost = 0;
+    num_acks_sent = 0;
+    num_failed = 0;
+    mesh_lower_transport_init();
+    mesh_lower_transport_set_higher_layer_handler(&upper_transport_handler);
+}
+
+static void simulate(uint16_t destination_count, uint8_t loss){
+    // all destinations in parallel
+    simulation_init(destination_count, loss);
+    uint16_t i;
+    for (i = 0; i < destination_count; i++){
+        send_message(FIRST_DST_ADDRESS + i);
+    }
+    simulation_run();
+    uint32_t parallel_ms = sim_time_ms;
+    uint32_t parallel_segments = num_segments_sent;
+    uint32_t parallel_failed = num_failed + num_messages_pending;
+    mesh_lower_transport_reset();
+
+    // one destination after the other
+    simulation_init(destination_count, loss);
+    uint32_t sequential_ms = 0;
+    for (i = 0; i < destination_count; i++){
+        send_message(FIRST_DST_ADDRESS + i);
+        simulation_run();
+        sequential_ms = sim_time_ms;
+    }
+    uint32_t sequential_failed = num_failed + num_messages_pending;
+    mesh_lower_transport_reset();
+
+    fprintf(report, "%12u %7u%% %13" PRIu32 " %10" PRIu32 " %15" PRIu32 " %8" PRIu32 "\n",
+            destination_count, loss, parallel_ms, parallel_segments, sequential_ms, parallel_failed + sequential_failed);
+}
+
+int main(void){
+    // lower transport logs every segment, only show report
+    report = fdopen(dup(STDOUT_FILENO), "w");
+    if (freopen("/dev/null", "w", stdout) == NULL) return 1;
+
+    btstack_memory_init();
+
+    fprintf(report, "Mesh Lower Transport: %u byte Access message, %u ms per Network PDU, TTL %u\n", MESSAGE_LEN, BEARER_PDU_TIME_MS, MESSAGE_TTL);
+    fprintf(report, "destinations     loss   parallel ms   segments   sequential ms   failed\n");
+    static const uint16_t destination_counts[] = { 1, 2, 4, 8, 16 };
+    static const uint8_t  losses[] = { 0, 10 };
+    unsigned int i;
+    unsigned int j;
+    for (j = 0; j < sizeof(losses); j++){
+        for (i = 0; i < (sizeof(destination_counts) / sizeof(uint16_t)); i++){
+            simulate(destination_counts[i], losses[j]);
+        }
+    }
+    fclose(report);
+    return 0;
+}
@@ -196,6 +196,18 @@ static void mesh_application_key_set(uint16_t netkey_index, uint16_t appkey_inde
     mesh_transport_key_add(&test_application_key);
 }
 
+static mesh_transport_key_t   test_other_application_key;
+static mesh_transport_key_t   test_refreshed_application_key;
+static void mesh_other_application_key_set(mesh_transport_key_t * transport_key, uint16_t appkey_index, uint8_t aid, const char * application_key_string) {
+    transport_key->internal_index = mesh_transport_key_get_free_index();
+    transport_key->netkey_index = 0;
+    transport_key->appkey_index = appkey_index;
+    transport_key->aid   = aid;
+    transport_key->akf   = 1;
+    btstack_parse_hex(application_key_string, 16, transport_key->key);
+    mesh_transport_key_add(transport_key);
+}
+
 static void load_network_key_nid_68(void){
     mesh_network_key_t * network_key = btstack_memory_mesh_network_key_get();
     network_key->nid = 0x68;
@@ -562,6 +574,26 @@ TEST(MessageTest, Message1Receive){
     mesh_set_iv_index(0x12345678);
     test_receive_network_pdus(1, message1_network_pdus, message1_lower_transport_pdus, message1_upper_transport_pdu);
 }
+TEST(MessageTest, Message1ReceiveDuplicate){
+    load_network_key_nid_68();
+    mesh_set_iv_index(0x12345678);
+    mesh_network_cache_reset_statistics();
+    test_receive_network_pdus(1, message1_network_pdus, message1_lower_transport_pdus, message1_upper_transport_pdu);
+
+    // same Network PDU again is dropped by network message cache
+    mesh_network_received_message(test_network_pdu_data, test_network_pdu_len, 0);
+    int i;
+    for (i = 0; i < 10; i++){
+        mock_process_hci_cmd();
+    }
+    CHECK(received_network_pdu == NULL);
+
+    mesh_network_cache_statistics_t statistics;
+    mesh_network_cache_get_statistics(&statistics);
+    CHECK_EQUAL(1, statistics.hits);
+    CHECK_EQUAL(1, statistics.misses);
+    CHECK_EQUAL(0, statistics.evictions);
+}
 TEST(MessageTest, Message1Send){
     uint16_t netkey_index = 0;
     uint8_t  ttl          = 0;
@@ -587,6 +619,33 @@ TEST(MessageTest, Message2Receive){
     mesh_set_iv_index(0x12345678);
     test_receive_network_pdus(1, message2_network_pdus, message2_lower_transport_pdus, message2_upper_transport_pdu);
 }
+TEST(MessageTest, Message2ReceiveOtherKeySameNID){
+    // other network key with same NID is checked first
+    mesh_network_key_t * network_key = btstack_memory_mesh_network_key_get();
+    network_key->netkey_index = 1;
+    network_key->nid = 0x68;
+    memset(network_key->encryption_key, 0x11, 16);
+    memset(network_key->privacy_key, 0x22, 16);
+    mesh_network_key_add(network_key);
+    load_network_key_nid_68();
+    mesh_set_iv_index(0x12345678);
+    mesh_network_decryption_reset_statistics();
+    test_receive_network_pdus(1, message1_network_pdus, message1_lower_transport_pdus, message1_upper_transport_pdu);
+
+    mesh_network_decryption_statistics_t statistics;
+    mesh_network_decryption_get_statistics(&statistics);
+    CHECK_EQUAL(1, statistics.pdus);
+    CHECK_EQUAL(2, statistics.attempts);
+    CHECK_EQUAL(1, statistics.failed_attempts);
+
+    // last matching key is checked first
+    test_receive_network_pdus(1, message2_network_pdus, message2_lower_transport_pdus, message2_upper_transport_pdu);
+    mesh_network_decryption_get_statistics(&statistics);
+    CHECK_EQUAL(2, statistics.pdus);
+    CHECK_EQUAL(3, statistics.attempts);
+    CHECK_EQUAL(1, statistics.failed_attempts);
+    CHECK_EQUAL(0, statistics.no_key_found);
+}
 TEST(MessageTest, Message2Send){
     uint16_t netkey_index = 0;
     uint8_t  ttl          = 0;
@@ -936,6 +995,34 @@ TEST(MessageTest, Message19Send){
     mesh_sequence_number_set(seq);
     test_send_access_message(netkey_index, appkey_index, ttl, src, dest, szmic, message19_upper_transport_pdu, 1, message19_lower_transport_pdus, message19_network_pdus);
 }
+TEST(MessageTest, Message18ReceiveOtherAppKeySameAID){
+    // other application key with same AID is checked first
+    mesh_transport_key_remove(&test_application_key);
+    mesh_other_application_key_set(&test_other_application_key, 1, 0x26, "00112233445566778899aabbccddeeff");
+    mesh_transport_key_add(&test_application_key);
+    load_network_key_nid_68();
+    mesh_set_iv_index(0x12345678);
+    mesh_upper_transport_decryption_reset_statistics();
+    test_receive_network_pdus(1, message18_network_pdus, message18_lower_transport_pdus, message18_upper_transport_pdu);
+
+    mesh_upper_transport_decryption_statistics_t statistics;
+    mesh_upper_transport_decryption_get_statistics(&statistics);
+    CHECK_EQUAL(1, statistics.pdus);
+    CHECK_EQUAL(2, statistics.attempts);
+    CHECK_EQUAL(1, statistics.failed_attempts);
+    CHECK_EQUAL(0, statistics.cache_hits);
+
+    recv_upper_transport_pdu_len = 0;
+    // last matching key for source address is checked first
+    test_receive_network_pdus(1, message19_network_pdus, message19_lower_transport_pdus, message19_upper_transport_pdu);
+    mesh_upper_transport_decryption_get_statistics(&statistics);
+    CHECK_EQUAL(2, statistics.pdus);
+    CHECK_EQUAL(3, statistics.attempts);
+    CHECK_EQUAL(1, statistics.failed_attempts);
+    CHECK_EQUAL(1, statistics.cache_hits);
+
+    mesh_transport_key_remove(&test_other_application_key);
+}
 
 // Message 20
 char * message20_network_pdus[] = {
@@ -993,6 +1080,53 @@ TEST(MessageTest, Message21Send){
     mesh_sequence_number_set(seq);
     test_send_access_message(netkey_index, appkey_index, ttl, src, dest, szmic, message21_upper_transport_pdu, 1, message21_lower_transport_pdus, message21_network_pdus);
 }
+TEST(MessageTest, Message20ReceiveAppKeyCacheAfterKeyDeleted){
+    load_network_key_nid_68();
+    mesh_set_iv_index(0x12345677);
+    mesh_upper_transport_decryption_reset_statistics();
+    test_receive_network_pdus(1, message20_network_pdus, message20_lower_transport_pdus, message20_upper_transport_pdu);
+
+    // delete cached key, add same key again as new key after other key with same AID
+    recv_upper_transport_pdu_len = 0;
+    mesh_transport_key_remove(&test_application_key);
+    mesh_other_application_key_set(&test_other_application_key, 1, 0x26, "00112233445566778899aabbccddeeff");
+    mesh_other_application_key_set(&test_refreshed_application_key, 2, 0x26, "63964771734fbd76e3b40519d1d94a48");
+    test_receive_network_pdus(1, message21_network_pdus, message21_lower_transport_pdus, message21_upper_transport_pdu);
+
+    mesh_upper_transport_decryption_statistics_t statistics;
+    mesh_upper_transport_decryption_get_statistics(&statistics);
+    CHECK_EQUAL(2, statistics.pdus);
+    CHECK_EQUAL(3, statistics.attempts);
+    CHECK_EQUAL(1, statistics.failed_attempts);
+    CHECK_EQUAL(0, statistics.cache_hits);
+
+    mesh_transport_key_remove(&test_other_application_key);
+    mesh_transport_key_remove(&test_refreshed_application_key);
+}
+TEST(MessageTest, Message20ReceiveAppKeyCacheAfterKeyRefreshed){
+    load_network_key_nid_68();
+    mesh_set_iv_index(0x12345677);
+    mesh_upper_transport_decryption_reset_statistics();
+    test_receive_network_pdus(1, message20_network_pdus, message20_lower_transport_pdus, message20_upper_transport_pdu);
+
+    recv_upper_transport_pdu_len = 0;
+    // cached key gets different AID, new key with same AID added after other key
+    test_application_key.aid = 0x27;
+    mesh_transport_key_add(&test_application_key);
+    mesh_other_application_key_set(&test_other_application_key, 1, 0x26, "00112233445566778899aabbccddeeff");
+    mesh_other_application_key_set(&test_refreshed_application_key, 2, 0x26, "63964771734fbd76e3b40519d1d94a48");
+    test_receive_network_pdus(1, message21_network_pdus, message21_lower_transport_pdus, message21_upper_transport_pdu);
+
+    mesh_upper_transport_decryption_statistics_t statistics;
+    mesh_upper_transport_decryption_get_statistics(&statistics);
+    CHECK_EQUAL(2, statistics.pdus);
+    CHECK_EQUAL(3, statistics.attempts);
+    CHECK_EQUAL(1, statistics.failed_attempts);
+    CHECK_EQUAL(0, statistics.cache_hits);
+
+    mesh_transport_key_remove(&test_other_application_key);
+    mesh_transport_key_remove(&test_refreshed_application_key);
+}
 
 // Message 22
 char * message22_network_pdus[] = {
@@ -1105,6 +1239,51 @@ TEST(MessageTest, Message24Send){
     test_send_access_message(netkey_index, appkey_index, ttl, src, pseudo_dst, szmic, message24_upper_transport_pdu, 2, message24_lower_transport_pdus, message24_network_pdus);
 }
 
+static void test_virtual_addresses_remove(uint16_t hash){
+    // virtual addresses registered by other tests are not removed in teardown
+    mesh_virtual_address_iterator_t it;
+    while (true){
+        mesh_virtual_address_iterator_init(&it, hash);
+        if (!mesh_virtual_address_iterator_has_more(&it)) break;
+        uint16_t pseudo_dst = mesh_virtual_address_iterator_get_next(&it)->pseudo_dst;
+        mesh_virtual_address_remove(mesh_virtual_address_for_pseudo_dst(pseudo_dst));
+    }
+}
+TEST(MessageTest, Message23ReceiveOtherVirtualAddressSameHash){
+    load_network_key_nid_68();
+    mesh_set_iv_index(0x12345677);
+    test_virtual_addresses_remove(0x9736);
+    uint8_t label_uuid[16];
+    btstack_parse_hex(message23_label_string, 16, label_uuid);
+    mesh_virtual_address_t * virtual_address = mesh_virtual_address_register(label_uuid, 0x9736);
+    // other label uuid with same hash is checked first
+    btstack_parse_hex("00112233445566778899aabbccddeeff", 16, label_uuid);
+    mesh_virtual_address_t * other_virtual_address = mesh_virtual_address_register(label_uuid, 0x9736);
+    mesh_upper_transport_decryption_reset_statistics();
+    test_receive_network_pdus(1, message23_network_pdus, message23_lower_transport_pdus, message23_upper_transport_pdu);
+
+    mesh_upper_transport_decryption_statistics_t statistics;
+    mesh_upper_transport_decryption_get_statistics(&statistics);
+    CHECK_EQUAL(1, statistics.pdus);
+    CHECK_EQUAL(2, statistics.attempts);
+    CHECK_EQUAL(1, statistics.failed_attempts);
+    CHECK_EQUAL(0, statistics.cache_hits);
+
+    recv_upper_transport_pdu_len = 0;
+    // last matching key and virtual address for source address are checked first
+    test_receive_network_pdus(2, message24_network_pdus, message24_lower_transport_pdus, message24_upper_transport_pdu);
+    mesh_upper_transport_decryption_get_statistics(&statistics);
+    CHECK_EQUAL(2, statistics.pdus);
+    CHECK_EQUAL(3, statistics.attempts);
+    CHECK_EQUAL(1, statistics.failed_attempts);
+    CHECK_EQUAL(1, statistics.cache_hits);
+
+    mesh_virtual_address_remove(other_virtual_address);
+    btstack_memory_mesh_virtual_address_free(other_virtual_address);
+    mesh_virtual_address_remove(virtual_address);
+    btstack_memory_mesh_virtual_address_free(virtual_address);
+}
+
 // Proxy Configuration Test
 char * proxy_config_pdus[] = {
     (char *) "0210386bd60efbbb8b8c28512e792d3711f4b526",
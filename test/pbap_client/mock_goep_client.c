@@ -0,0 +1,401 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+#define BTSTACK_FILE__ "mock_goep_client.c"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "btstack_debug.h"
+#include "btstack_defines.h"
+#include "btstack_util.h"
+#include "classic/goep_client.h"
+#include "classic/obex.h"
+#include "classic/obex_message_builder.h"
+#include "classic/obex_parser.h"
+
+#include "mock_goep_client.h"
+
+#define MOCK_GOEP_CID 1
+#define MOCK_CONNECTION_ID 0x12345678
+
+static mock_pse_config_t     mock_pse_config;
+static mock_pse_statistics_t mock_pse_statistics;
+static const uint8_t * mock_pse_object;
+static uint32_t        mock_pse_object_len;
+
+static btstack_packet_handler_t mock_goep_handler;
+static uint8_t  mock_goep_request[1000];
+static uint8_t  mock_goep_response[0xffff];
+
+static bool mock_goep_connection_opened_pending;
+static bool mock_goep_connection_closed_pending;
+static bool mock_goep_can_send_now_pending;
+static bool mock_goep_response_pending;
+
+// current request
+static uint8_t mock_request_opcode;
+static bool    mock_request_srm;
+static bool    mock_request_srmp_wait;
+static bool    mock_request_type;
+
+// get operation
+static bool     mock_get_active;
+static bool     mock_get_first_response;
+static bool     mock_get_srm;
+static bool     mock_get_client_wait;
+static uint32_t mock_get_object_pos;
+
+static void mock_goep_emit_event(uint8_t subevent, uint8_t status){
+    uint8_t event[15];
+    int pos = 0;
+    event[pos++] = HCI_EVENT_GOEP_META;
+    pos++;
+    event[pos++] = subevent;
+    little_endian_store_16(event, pos, MOCK_GOEP_CID);
+    pos += 2;
+    if (subevent == GOEP_SUBEVENT_CONNECTION_OPENED){
+        event[pos++] = status;
+        memset(&event[pos], 0, 6);
+        pos += 6;
+        little_endian_store_16(event, pos, 0x0001);
+        pos += 2;
+        event[pos++] = 0;
+    }
+    event[1] = pos - 2;
+    (*mock_goep_handler)(HCI_EVENT_PACKET, MOCK_GOEP_CID, event, pos);
+}
+
+static void mock_pse_request_callback(void * user_data, uint8_t header_id, uint16_t total_len, uint16_t data_offset, const uint8_t * data_buffer, uint16_t data_len){
+    UNUSED(user_data);
+    UNUSED(total_len);
+    UNUSED(data_offset);
+    switch (header_id){
+        case OBEX_HEADER_SINGLE_RESPONSE_MODE:
+            mock_request_srm = (data_len > 0) && (data_buffer[0] == OBEX_SRM_ENABLE);
+            break;
+        case OBEX_HEADER_SINGLE_RESPONSE_MODE_PARAMETER:
+            mock_request_srmp_wait = (data_len > 0) && (data_buffer[0] == OBEX_SRMP_WAIT);
+            break;
+        case OBEX_HEADER_TYPE:
+            mock_request_type = true;
+            break;
+        default:
+            break;
+    }
+}
+
+static uint64_t mock_pse_transfer_time_us(uint32_t num_bytes){
+    return ((uint64_t) num_bytes * 1000000u) / mock_pse_config.link_bytes_per_second;
+}
+
+static uint64_t mock_pse_response_time_us(uint32_t num_bytes){
+    uint64_t time_us = mock_pse_transfer_time_us(num_bytes);
+    if (mock_pse_config.ertm_window_bytes > 0u){
+        // wait for acknowledgement after each full receive window
+        uint64_t window_time_us = ((uint64_t) num_bytes * mock_pse_config.request_turnaround_us) / mock_pse_config.ertm_window_bytes;
+        if (window_time_us > time_us){
+            time_us = window_time_us;
+        }
+    }
+    return time_us;
+}
+
+static void mock_pse_send_response(void){
+    uint16_t pos = 3;
+    uint8_t response_code = OBEX_RESP_SUCCESS;
+    switch (mock_request_opcode){
+        case OBEX_OPCODE_CONNECT:
+            obex_message_builder_response_create_connect(mock_goep_response, sizeof(mock_goep_response), OBEX_VERSION, 0, mock_pse_config.max_packet_size, MOCK_CONNECTION_ID);
+            pos = big_endian_read_16(mock_goep_response, 1);
+            break;
+        case OBEX_OPCODE_GET: {
+            if (mock_get_first_response && mock_get_srm){
+                mock_goep_response[pos++] = OBEX_HEADER_SINGLE_RESPONSE_MODE;
+                mock_goep_response[pos++] = OBEX_SRM_ENABLE;
+            }
+            mock_get_first_response = false;
+            uint32_t remaining = mock_pse_object_len - mock_get_object_pos;
+            uint32_t body_len = btstack_min(remaining, mock_pse_config.max_packet_size - pos - 3);
+            bool last = body_len == remaining;
+            mock_goep_response[pos++] = last ? OBEX_HEADER_END_OF_BODY : OBEX_HEADER_BODY;
+            big_endian_store_16(mock_goep_response, pos, (uint16_t) (body_len + 3));
+            pos += 2;
+            memcpy(&mock_goep_response[pos], &mock_pse_object[mock_get_object_pos], body_len);
+            pos += body_len;
+            mock_get_object_pos += body_len;
+            mock_pse_statistics.num_body_bytes += body_len;
+            if (last){
+                mock_get_active = false;
+            } else {
+                response_code = OBEX_RESP_CONTINUE;
+                // stream next response unless client asked to wait
+                mock_goep_response_pending = mock_get_srm && !mock_get_client_wait;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    if (mock_request_opcode != OBEX_OPCODE_CONNECT){
+        mock_goep_response[0] = response_code;
+        big_endian_store_16(mock_goep_response, 1, pos);
+    }
+    mock_pse_statistics.num_responses++;
+    mock_pse_statistics.time_us += mock_pse_response_time_us(pos);
+    (*mock_goep_handler)(GOEP_DATA_PACKET, MOCK_GOEP_CID, mock_goep_response, pos);
+}
+
+void mock_pse_init(const mock_pse_config_t * config, const uint8_t * object, uint32_t object_len){
+    mock_pse_config = *config;
+    mock_pse_object = object;
+    mock_pse_object_len = object_len;
+    memset(&mock_pse_statistics, 0, sizeof(mock_pse_statistics));
+    mock_goep_connection_opened_pending = false;
+    mock_goep_connection_closed_pending = false;
+    mock_goep_can_send_now_pending = false;
+    mock_goep_response_pending = false;
+    mock_get_active = false;
+}
+
+void mock_pse_run(void){
+    while (true){
+        if (mock_goep_connection_opened_pending){
+            mock_goep_connection_opened_pending = false;
+            mock_goep_emit_event(GOEP_SUBEVENT_CONNECTION_OPENED, ERROR_CODE_SUCCESS);
+            continue;
+        }
+        if (mock_goep_connection_closed_pending){
+            mock_goep_connection_closed_pending = false;
+            mock_goep_emit_event(GOEP_SUBEVENT_CONNECTION_CLOSED, 0);
+            continue;
+        }
+        if (mock_goep_response_pending){
+            mock_goep_response_pending = false;
+            mock_pse_send_response();
+            continue;
+        }
+        if (mock_goep_can_send_now_pending){
+            mock_goep_can_send_now_pending = false;
+            mock_goep_emit_event(GOEP_SUBEVENT_CAN_SEND_NOW, 0);
+            continue;
+        }
+        break;
+    }
+}
+
+const mock_pse_statistics_t * mock_pse_get_statistics(void){
+    return &mock_pse_statistics;
+}
+
+uint32_t mock_pse_create_phonebook(uint8_t * buffer, uint32_t buffer_size, uint32_t num_cards){
+    uint32_t pos = 0;
+    uint32_t i;
+    for (i = 0; i < num_cards; i++){
+        char card[400];
+        int len;
+        if ((i % 10u) == 9u){
+            len = snprintf(card, sizeof(card),
+                           "BEGIN:VCARD\r\nVERSION:2.1\r\n"
+                           "N;CHARSET=UTF-8;ENCODING=QUOTED-PRINTABLE:M=C3=BCller;J=C3=B6rg=\r\n %u;;\r\n"
+                           "FN;CHARSET=UTF-8;ENCODING=QUOTED-PRINTABLE:J=C3=B6rg M=C3=BCller=\r\n %u\r\n"
+                           "TEL;CELL:+49 30 %07u\r\n"
+                           "END:VCARD\r\n", (unsigned int) i, (unsigned int) i, (unsigned int) i);
+        } else {
+            len = snprintf(card, sizeof(card),
+                           "BEGIN:VCARD\r\nVERSION:3.0\r\n"
+                           "N:Contact;Number %u;;;\r\n"
+                           "FN:Number %u Contact\r\n"
+                           "item1.TEL;TYPE=CELL:+1 555 %07u\r\n"
+                           "TEL;TYPE=HOME:+1 555 %07u\r\n"
+                           "EMAIL;TYPE=INTERNET:contact%u@example.com\r\n"
+                           "NOTE:This note is folded over two lines to exercise the continu\r\n ation handling\r\n"
+                           "X-BT-UID:A1A2A3A4B1B2C1C2D1D2E1E2E3E4E5E6\r\n"
+                           "END:VCARD\r\n", (unsigned int) i, (unsigned int) i, (unsigned int) i,
+                           (unsigned int) (i + 1000000u), (unsigned int) i);
+        }
+        if ((pos + (uint32_t) len) > buffer_size){
+            break;
+        }
+        memcpy(&buffer[pos], card, len);
+        pos += len;
+    }
+    return pos;
+}
+
+// GOEP Client API
+
+uint8_t goep_client_create_connection(btstack_packet_handler_t handler, bd_addr_t addr, uint16_t uuid, uint16_t * out_cid){
+    (void) addr;
+    UNUSED(uuid);
+    mock_goep_handler = handler;
+    mock_goep_connection_opened_pending = true;
+    *out_cid = MOCK_GOEP_CID;
+    return ERROR_CODE_SUCCESS;
+}
+
+uint8_t goep_client_disconnect(uint16_t goep_cid){
+    UNUSED(goep_cid);
+    mock_goep_connection_closed_pending = true;
+    return ERROR_CODE_SUCCESS;
+}
+
+void goep_client_request_can_send_now(uint16_t goep_cid){
+    UNUSED(goep_cid);
+    mock_goep_can_send_now_pending = true;
+}
+
+uint32_t goep_client_get_pbap_supported_features(uint16_t goep_cid){
+    UNUSED(goep_cid);
+    return PBAP_FEATURES_NOT_PRESENT;
+}
+
+bool goep_client_version_20_or_higher(uint16_t goep_cid){
+    UNUSED(goep_cid);
+    return mock_pse_config.l2cap;
+}
+
+void goep_client_set_connection_id(uint16_t goep_cid, uint32_t connection_id){
+    UNUSED(goep_cid);
+    btstack_assert(connection_id == MOCK_CONNECTION_ID);
+}
+
+void goep_client_request_create_connect(uint16_t goep_cid, uint8_t obex_version_number, uint8_t flags, uint16_t maximum_obex_packet_length){
+    UNUSED(goep_cid);
+    obex_message_builder_request_create_connect(mock_goep_request, sizeof(mock_goep_request), obex_version_number, flags, maximum_obex_packet_length);
+}
+
+void goep_client_request_create_disconnect(uint16_t goep_cid){
+    UNUSED(goep_cid);
+    obex_message_builder_request_create_disconnect(mock_goep_request, sizeof(mock_goep_request), MOCK_CONNECTION_ID);
+}
+
+void goep_client_request_create_get(uint16_t goep_cid){
+    UNUSED(goep_cid);
+    obex_message_builder_request_create_get(mock_goep_request, sizeof(mock_goep_request), MOCK_CONNECTION_ID);
+}
+
+void goep_client_request_create_abort(uint16_t goep_cid){
+    UNUSED(goep_cid);
+    obex_message_builder_request_create_abort(mock_goep_request, sizeof(mock_goep_request), MOCK_CONNECTION_ID);
+}
+
+void goep_client_request_create_set_path(uint16_t goep_cid, uint8_t flags){
+    UNUSED(goep_cid);
+    obex_message_builder_request_create_set_path(mock_goep_request, sizeof(mock_goep_request), flags, MOCK_CONNECTION_ID);
+}
+
+void goep_client_header_add_srm_enable(uint16_t goep_cid){
+    UNUSED(goep_cid);
+    obex_message_builder_header_add_srm_enable(mock_goep_request, sizeof(mock_goep_request));
+}
+
+void goep_client_header_add_byte(uint16_t goep_cid, uint8_t header_type, uint8_t value){
+    UNUSED(goep_cid);
+    obex_message_builder_header_add_byte(mock_goep_request, sizeof(mock_goep_request), header_type, value);
+}
+
+void goep_client_header_add_name(uint16_t goep_cid, const char * name){
+    UNUSED(goep_cid);
+    obex_message_builder_header_add_name(mock_goep_request, sizeof(mock_goep_request), name);
+}
+
+void goep_client_header_add_name_prefix(uint16_t goep_cid, const char * name, uint16_t name_len){
+    UNUSED(goep_cid);
+    obex_message_builder_header_add_name_prefix(mock_goep_request, sizeof(mock_goep_request), name, name_len);
+}
+
+void goep_client_header_add_target(uint16_t goep_cid, const uint8_t * target, uint16_t length){
+    UNUSED(goep_cid);
+    obex_message_builder_header_add_target(mock_goep_request, sizeof(mock_goep_request), target, length);
+}
+
+void goep_client_header_add_type(uint16_t goep_cid, const char * type){
+    UNUSED(goep_cid);
+    obex_message_builder_header_add_type(mock_goep_request, sizeof(mock_goep_request), type);
+}
+
+void goep_client_header_add_application_parameters(uint16_t goep_cid, const uint8_t * data, uint16_t length){
+    UNUSED(goep_cid);
+    obex_message_builder_header_add_application_parameters(mock_goep_request, sizeof(mock_goep_request), data, length);
+}
+
+void goep_client_header_add_challenge_response(uint16_t goep_cid, const uint8_t * data, uint16_t length){
+    UNUSED(goep_cid);
+    obex_message_builder_header_add_challenge_response(mock_goep_request, sizeof(mock_goep_request), data, length);
+}
+
+int goep_client_execute(uint16_t goep_cid){
+    UNUSED(goep_cid);
+    obex_parser_t parser;
+    obex_parser_operation_info_t op_info;
+    uint16_t request_len = big_endian_read_16(mock_goep_request, 1);
+    mock_request_srm = false;
+    mock_request_srmp_wait = false;
+    mock_request_type = false;
+    obex_parser_init_for_request(&parser, &mock_pse_request_callback, NULL);
+    obex_parser_object_state_t state = obex_parser_process_data(&parser, mock_goep_request, request_len);
+    btstack_assert(state == OBEX_PARSER_OBJECT_STATE_COMPLETE);
+    UNUSED(state);
+    obex_parser_get_operation_info(&parser, &op_info);
+    mock_request_opcode = op_info.opcode;
+
+    mock_pse_statistics.num_requests++;
+    mock_pse_statistics.time_us += mock_pse_config.request_turnaround_us + mock_pse_transfer_time_us(request_len);
+    if (mock_request_srm){
+        mock_pse_statistics.num_srm_requests++;
+    }
+    if (mock_request_srmp_wait){
+        mock_pse_statistics.num_srmp_wait_requests++;
+    }
+
+    if ((mock_request_opcode & ~OBEX_OPCODE_FINAL_BIT_MASK) == OBEX_OPCODE_GET){
+        mock_request_opcode = OBEX_OPCODE_GET;
+        mock_pse_statistics.num_get_requests++;
+        if (mock_request_type || (mock_get_active == false)){
+            mock_get_active = true;
+            mock_get_first_response = true;
+            mock_get_object_pos = 0;
+            mock_get_srm = mock_pse_config.l2cap && mock_request_srm;
+        }
+        mock_get_client_wait = mock_request_srmp_wait;
+    } else if (mock_request_opcode == OBEX_OPCODE_ABORT){
+        mock_get_active = false;
+    }
+    mock_goep_response_pending = true;
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/*
+ * mock_goep_client.h
+ *
+ * GOEP Client mock with a scripted PBAP Server (PSE) that serves a single object for GET requests.
+ * Virtual time is accounted based on a simple link model to report transfer times.
+ */
+
+#ifndef MOCK_GOEP_CLIENT_H
+#define MOCK_GOEP_CLIENT_H
+
+#include <stdint.h>
+
+#include "btstack_bool.h"
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    // GOEP 2.0 over L2CAP: SRM supported
+    bool     l2cap;
+    // max OBEX packet size used by PSE, i.e. L2CAP MTU with GOEP 2.0
+    uint16_t max_packet_size;
+    // link model
+    uint32_t link_bytes_per_second;
+    uint32_t request_turnaround_us;
+    // L2CAP ERTM receive window (num rx buffers * MPS), limits throughput to one window per turnaround, 0 = unlimited
+    uint32_t ertm_window_bytes;
+} mock_pse_config_t;
+
+typedef struct {
+    uint32_t num_requests;
+    uint32_t num_get_requests;
+    uint32_t num_srm_requests;
+    uint32_t num_srmp_wait_requests;
+    uint32_t num_responses;
+    uint32_t num_body_bytes;
+    uint64_t time_us;
+} mock_pse_statistics_t;
+
+void mock_pse_init(const mock_pse_config_t * config, const uint8_t * object, uint32_t object_len);
+
+// process pending events, requests and responses until idle
+void mock_pse_run(void);
+
+const mock_pse_statistics_t * mock_pse_get_statistics(void);
+
+// create vCard 3.0 phonebook with folded lines and Quoted-Printable names, returns size
+uint32_t mock_pse_create_phonebook(uint8_t * buffer, uint32_t buffer_size, uint32_t num_cards);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif
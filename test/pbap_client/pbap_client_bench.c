@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// benchmark PBAP phonebook pull against scripted PSE: transfer time in virtual
+// time based on link model and client CPU throughput
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "btstack_defines.h"
+#include "btstack_event.h"
+#include "classic/pbap_client.h"
+
+#include "mock_goep_client.h"
+
+#define NUM_CARDS   10000
+#define NUM_ROUNDS  10
+
+// 10000 cards with about 300 bytes
+static uint8_t  phonebook[4000000];
+static uint32_t phonebook_len;
+
+static uint16_t pbap_cid;
+static bool     connected;
+static bool     operation_complete;
+static uint32_t num_received_bytes;
+static uint32_t num_vcard_results;
+
+static double now(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void packet_handler(uint8_t packet_type, uint16_t channel, uint8_t * packet, uint16_t size){
+    (void) channel;
+    switch (packet_type){
+        case PBAP_DATA_PACKET:
+            num_received_bytes += size;
+            break;
+        case HCI_EVENT_PACKET:
+            if (hci_event_packet_get_type(packet) != HCI_EVENT_PBAP_META) break;
+            switch (hci_event_pbap_meta_get_subevent_code(packet)){
+                case PBAP_SUBEVENT_CONNECTION_OPENED:
+                    connected = pbap_subevent_connection_opened_get_status(packet) == ERROR_CODE_SUCCESS;
+                    break;
+                case PBAP_SUBEVENT_OPERATION_COMPLETED:
+                    operation_complete = true;
+                    break;
+                case PBAP_SUBEVENT_VCARD_RESULT:
+                    num_vcard_results++;
+                    break;
+                default:
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void pull_phonebook(const mock_pse_config_t * config, bool flow_control, bool vcard_parsing){
+    bd_addr_t addr = { 1, 2, 3, 4, 5, 6};
+    pbap_client_init();
+    mock_pse_init(config, phonebook, phonebook_len);
+    connected = false;
+    pbap_connect(&packet_handler, addr, &pbap_cid);
+    mock_pse_run();
+    if (!connected){
+        printf("connection failed\n");
+        exit(EXIT_FAILURE);
+    }
+    pbap_set_flow_control_mode(pbap_cid, flow_control ? 1 : 0);
+    pbap_set_vcard_parsing(pbap_cid, vcard_parsing ? 1 : 0);
+    operation_complete = false;
+    num_received_bytes = 0;
+    num_vcard_results = 0;
+    pbap_pull_phonebook(pbap_cid, "telecom/pb.vcf");
+    mock_pse_run();
+    while (!operation_complete){
+        pbap_next_packet(pbap_cid);
+        mock_pse_run();
+    }
+    if (num_received_bytes != phonebook_len){
+        printf("received %u of %u bytes\n", num_received_bytes, phonebook_len);
+        exit(EXIT_FAILURE);
+    }
+    pbap_client_deinit();
+}
+
+static void bench_transfer(const char * name, const mock_pse_config_t * config, bool flow_control){
+    pull_phonebook(config, flow_control, false);
+    const mock_pse_statistics_t * statistics = mock_pse_get_statistics();
+    double seconds = statistics->time_us * 1e-6;
+    printf("%-36s %6u requests %6u responses %8.2f s %8.1f kB/s\n", name,
+           statistics->num_get_requests, statistics->num_responses, seconds, phonebook_len / seconds / 1000.0);
+}
+
+static void bench_cpu(const char * name, const mock_pse_config_t * config, bool vcard_parsing){
+    double start = now();
+    int i;
+    for (i = 0; i < NUM_ROUNDS; i++){
+        pull_phonebook(config, false, vcard_parsing);
+    }
+    double seconds = now() - start;
+    printf("%-36s %8.1f MB/s, %u cards\n", name, NUM_ROUNDS * (phonebook_len / seconds) / 1000000.0, num_vcard_results);
+}
+
+int main(void){
+    phonebook_len = mock_pse_create_phonebook(phonebook, sizeof(phonebook), NUM_CARDS);
+    printf("Pull phonebook with %u cards, %u bytes\n", NUM_CARDS, phonebook_len);
+    printf("Link 200 kB/s, turnaround 20 ms\n\n");
+
+    mock_pse_config_t config;
+    config.link_bytes_per_second = 200000;
+    config.request_turnaround_us = 20000;
+
+    // GOEP 1.x over RFCOMM
+    config.l2cap = false;
+    config.max_packet_size = 1000;
+    config.ertm_window_bytes = 0;
+    bench_transfer("RFCOMM, 1000 byte packets", &config, false);
+
+    // GOEP 2.x over L2CAP ERTM, default GOEP_CLIENT_L2CAP_ERTM_* config: MPS ~100, 2 rx buffers
+    config.l2cap = true;
+    config.max_packet_size = 512;
+    config.ertm_window_bytes = 200;
+    bench_transfer("L2CAP default ERTM, SRM", &config, false);
+    bench_transfer("L2CAP default ERTM, SRMP wait", &config, true);
+
+    // MTU 1000, buffer 10000, 8 rx buffers: MPS ~880
+    config.max_packet_size = 1000;
+    config.ertm_window_bytes = 8 * 880;
+    bench_transfer("L2CAP larger ERTM, SRM", &config, false);
+    bench_transfer("L2CAP larger ERTM, SRMP wait", &config, true);
+
+    printf("\nClient CPU throughput\n");
+    bench_cpu("body only", &config, false);
+    bench_cpu("vCard parsing", &config, true);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,183 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_defines.h"
+#include "btstack_event.h"
+#include "btstack_util.h"
+#include "classic/pbap_client.h"
+
+#include "mock_goep_client.h"
+
+#define TEST_NUM_CARDS 50
+
+static uint8_t  test_phonebook[30000];
+static uint32_t test_phonebook_len;
+
+static uint8_t  test_received[30000];
+static uint32_t test_received_len;
+static bool     test_connected;
+static bool     test_operation_complete;
+static uint8_t  test_operation_status;
+static uint16_t test_num_vcard_results;
+static char     test_last_name[PBAP_MAX_NAME_LEN + 1];
+static char     test_last_number[PBAP_MAX_PHONE_NUMBER_LEN + 1];
+
+static void test_packet_handler(uint8_t packet_type, uint16_t channel, uint8_t * packet, uint16_t size){
+    (void) channel;
+    switch (packet_type){
+        case PBAP_DATA_PACKET:
+            memcpy(&test_received[test_received_len], packet, size);
+            test_received_len += size;
+            break;
+        case HCI_EVENT_PACKET:
+            if (hci_event_packet_get_type(packet) != HCI_EVENT_PBAP_META) break;
+            switch (hci_event_pbap_meta_get_subevent_code(packet)){
+                case PBAP_SUBEVENT_CONNECTION_OPENED:
+                    test_connected = pbap_subevent_connection_opened_get_status(packet) == ERROR_CODE_SUCCESS;
+                    break;
+                case PBAP_SUBEVENT_OPERATION_COMPLETED:
+                    test_operation_complete = true;
+                    test_operation_status = pbap_subevent_operation_completed_get_status(packet);
+                    break;
+                case PBAP_SUBEVENT_VCARD_RESULT:
+                    CHECK_EQUAL(test_num_vcard_results, pbap_subevent_vcard_result_get_card_index(packet));
+                    test_num_vcard_results++;
+                    memcpy(test_last_name, pbap_subevent_vcard_result_get_name(packet), pbap_subevent_vcard_result_get_name_len(packet));
+                    test_last_name[pbap_subevent_vcard_result_get_name_len(packet)] = 0;
+                    memcpy(test_last_number, pbap_subevent_vcard_result_get_number(packet), pbap_subevent_vcard_result_get_number_len(packet));
+                    test_last_number[pbap_subevent_vcard_result_get_number_len(packet)] = 0;
+                    break;
+                default:
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+TEST_GROUP(PBAP_CLIENT){
+    uint16_t pbap_cid;
+    mock_pse_config_t config;
+
+    void setup(void){
+        test_received_len = 0;
+        test_connected = false;
+        test_operation_complete = false;
+        test_num_vcard_results = 0;
+        test_phonebook_len = mock_pse_create_phonebook(test_phonebook, sizeof(test_phonebook), TEST_NUM_CARDS);
+        config.l2cap = true;
+        config.max_packet_size = 1000;
+        config.link_bytes_per_second = 100000;
+        config.request_turnaround_us = 20000;
+        config.ertm_window_bytes = 0;
+        pbap_client_init();
+    }
+
+    void teardown(void){
+        pbap_client_deinit();
+    }
+
+    void connect(void){
+        bd_addr_t addr = { 1, 2, 3, 4, 5, 6};
+        mock_pse_init(&config, test_phonebook, test_phonebook_len);
+        CHECK_EQUAL(ERROR_CODE_SUCCESS, pbap_connect(&test_packet_handler, addr, &pbap_cid));
+        mock_pse_run();
+        CHECK_TRUE(test_connected);
+    }
+
+    void pull_phonebook(void){
+        CHECK_EQUAL(ERROR_CODE_SUCCESS, pbap_pull_phonebook(pbap_cid, "telecom/pb.vcf"));
+        mock_pse_run();
+    }
+
+    void check_phonebook_received(void){
+        CHECK_TRUE(test_operation_complete);
+        CHECK_EQUAL(ERROR_CODE_SUCCESS, test_operation_status);
+        CHECK_EQUAL(test_phonebook_len, test_received_len);
+        MEMCMP_EQUAL(test_phonebook, test_received, test_phonebook_len);
+    }
+};
+
+TEST(PBAP_CLIENT, PullPhonebookSRM){
+    connect();
+    const mock_pse_statistics_t * statistics = mock_pse_get_statistics();
+    pull_phonebook();
+    check_phonebook_received();
+    // single GET request with SRM, all responses streamed
+    CHECK_EQUAL(1, statistics->num_get_requests);
+    CHECK_EQUAL(1, statistics->num_srm_requests);
+    CHECK_EQUAL(0, statistics->num_srmp_wait_requests);
+    CHECK_TRUE(statistics->num_responses > 10);
+}
+
+TEST(PBAP_CLIENT, PullPhonebookTwiceSRM){
+    connect();
+    const mock_pse_statistics_t * statistics = mock_pse_get_statistics();
+    pull_phonebook();
+    check_phonebook_received();
+    test_received_len = 0;
+    test_operation_complete = false;
+    pull_phonebook();
+    check_phonebook_received();
+    CHECK_EQUAL(2, statistics->num_get_requests);
+    CHECK_EQUAL(2, statistics->num_srm_requests);
+}
+
+TEST(PBAP_CLIENT, PullPhonebookRFCOMM){
+    config.l2cap = false;
+    connect();
+    const mock_pse_statistics_t * statistics = mock_pse_get_statistics();
+    pull_phonebook();
+    check_phonebook_received();
+    // one GET request per response
+    CHECK_EQUAL(0, statistics->num_srm_requests);
+    CHECK_EQUAL(statistics->num_responses - 1, statistics->num_get_requests);
+}
+
+TEST(PBAP_CLIENT, PullPhonebookFlowControlSRMP){
+    connect();
+    const mock_pse_statistics_t * statistics = mock_pse_get_statistics();
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, pbap_set_flow_control_mode(pbap_cid, 1));
+    pull_phonebook();
+    // PSE waits for next GET after each response
+    uint32_t num_responses = statistics->num_responses;
+    mock_pse_run();
+    CHECK_EQUAL(num_responses, statistics->num_responses);
+    CHECK_FALSE(test_operation_complete);
+    uint32_t num_rounds = 0;
+    while (test_operation_complete == false){
+        CHECK_TRUE(num_rounds++ < 1000);
+        pbap_next_packet(pbap_cid);
+        mock_pse_run();
+    }
+    check_phonebook_received();
+    CHECK_EQUAL(1, statistics->num_srm_requests);
+    CHECK_EQUAL(statistics->num_get_requests, statistics->num_srmp_wait_requests);
+}
+
+TEST(PBAP_CLIENT, VCardResults){
+    connect();
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, pbap_set_vcard_parsing(pbap_cid, 1));
+    pull_phonebook();
+    check_phonebook_received();
+    CHECK_EQUAL(TEST_NUM_CARDS, test_num_vcard_results);
+    // last card uses Quoted-Printable with soft line break
+    char expected_name[PBAP_MAX_NAME_LEN + 1];
+    snprintf(expected_name, sizeof(expected_name), "J\xC3\xB6rg M\xC3\xBCller %u", TEST_NUM_CARDS - 1);
+    STRCMP_EQUAL(expected_name, test_last_name);
+    char expected_number[PBAP_MAX_PHONE_NUMBER_LEN + 1];
+    snprintf(expected_number, sizeof(expected_number), "+49 30 %07u", TEST_NUM_CARDS - 1);
+    STRCMP_EQUAL(expected_number, test_last_number);
+}
+
+TEST(PBAP_CLIENT, VCardResultsDisabled){
+    connect();
+    pull_phonebook();
+    check_phonebook_received();
+    CHECK_EQUAL(0, test_num_vcard_results);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
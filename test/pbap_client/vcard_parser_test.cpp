@@ -0,0 +1,125 @@
+#include <string>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "classic/vcard_parser.h"
+#include "btstack_util.h"
+
+#include "mock_goep_client.h"
+
+// log of parser events: '{' card begin, NAME;params[qp]=value\n, '}' card end
+static std::string test_log;
+
+static void test_vcard_parser_callback(void * user_data, vcard_parser_event_t event, const vcard_parser_property_t * property, const uint8_t * data_buffer, uint16_t data_len){
+    (void) user_data;
+    switch (event){
+        case VCARD_PARSER_EVENT_CARD_BEGIN:
+            test_log += "{";
+            break;
+        case VCARD_PARSER_EVENT_PROPERTY_VALUE:
+            if (property->value_len == 0){
+                test_log += property->name;
+                if (property->params[0] != 0){
+                    test_log += ";";
+                    test_log += property->params;
+                }
+                if (property->quoted_printable){
+                    test_log += "[qp]";
+                }
+                test_log += "=";
+            }
+            test_log.append((const char *) data_buffer, data_len);
+            break;
+        case VCARD_PARSER_EVENT_PROPERTY_END:
+            test_log += "\n";
+            break;
+        case VCARD_PARSER_EVENT_CARD_END:
+            test_log += "}";
+            break;
+        default:
+            break;
+    }
+}
+
+TEST_GROUP(VCARD_PARSER){
+    vcard_parser_t parser;
+
+    void setup(void){
+        test_log.clear();
+        vcard_parser_init(&parser, &test_vcard_parser_callback, NULL);
+    }
+
+    void process(const char * text, uint16_t chunk_size){
+        uint16_t len = (uint16_t) strlen(text);
+        uint16_t pos = 0;
+        while (pos < len){
+            uint16_t chunk_len = btstack_min(chunk_size, len - pos);
+            vcard_parser_process_data(&parser, (const uint8_t *) &text[pos], chunk_len);
+            pos += chunk_len;
+        }
+    }
+};
+
+TEST(VCARD_PARSER, Simple){
+    process("BEGIN:VCARD\r\nVERSION:3.0\r\nFN:John Doe\r\nTEL;TYPE=CELL:+123\r\nEND:VCARD\r\n", 1000);
+    STRCMP_EQUAL("{VERSION=3.0\nFN=John Doe\nTEL;TYPE=CELL=+123\n}", test_log.c_str());
+    CHECK_EQUAL(1, vcard_parser_get_num_cards(&parser));
+}
+
+TEST(VCARD_PARSER, LineFeedOnly){
+    process("BEGIN:VCARD\nFN:John Doe\nEND:VCARD\n", 1000);
+    STRCMP_EQUAL("{FN=John Doe\n}", test_log.c_str());
+}
+
+TEST(VCARD_PARSER, CaseAndGroup){
+    process("begin:vcard\r\nitem1.tel:+123\r\nEnd:VCard\r\n", 1000);
+    STRCMP_EQUAL("{TEL=+123\n}", test_log.c_str());
+}
+
+TEST(VCARD_PARSER, Folding){
+    // line break and the single leading white space are removed
+    process("BEGIN:VCARD\r\nNOTE:first\r\n  second\r\n\tthird\r\nEND:VCARD\r\n", 1000);
+    STRCMP_EQUAL("{NOTE=first secondthird\n}", test_log.c_str());
+}
+
+TEST(VCARD_PARSER, QuotedPrintableSoftLineBreak){
+    process("BEGIN:VCARD\r\nFN;ENCODING=QUOTED-PRINTABLE:J=C3=B6=\r\nrg\r\nN;QUOTED-PRINTABLE:a=3D\r\nEND:VCARD\r\n", 1000);
+    STRCMP_EQUAL("{FN;ENCODING=QUOTED-PRINTABLE[qp]=J=C3=B6rg\nN;QUOTED-PRINTABLE[qp]=a=3D\n}", test_log.c_str());
+}
+
+TEST(VCARD_PARSER, QuotedParams){
+    process("BEGIN:VCARD\r\nX-TEST;LABEL=\"a:b;c\":value\r\nEND:VCARD\r\n", 1000);
+    STRCMP_EQUAL("{X-TEST;LABEL=\"a:b;c\"=value\n}", test_log.c_str());
+}
+
+TEST(VCARD_PARSER, NestedCard){
+    process("BEGIN:VCARD\r\nFN:outer\r\nBEGIN:VCARD\r\nFN:inner\r\nEND:VCARD\r\nTEL:1\r\nEND:VCARD\r\n", 1000);
+    STRCMP_EQUAL("{FN=outer\nTEL=1\n}", test_log.c_str());
+    CHECK_EQUAL(1, vcard_parser_get_num_cards(&parser));
+}
+
+TEST(VCARD_PARSER, EmptyValue){
+    process("BEGIN:VCARD\r\nNOTE:\r\nFN:a\r\nEND:VCARD\r\n", 1000);
+    // no value chunk for empty value
+    STRCMP_EQUAL("{\nFN=a\n}", test_log.c_str());
+}
+
+TEST(VCARD_PARSER, ChunkingEquivalence){
+    static uint8_t phonebook[20000];
+    uint32_t phonebook_len = mock_pse_create_phonebook(phonebook, sizeof(phonebook) - 1, 30);
+    phonebook[phonebook_len] = 0;
+    process((const char *) phonebook, 0xffff);
+    std::string reference = test_log;
+    CHECK_EQUAL(30, vcard_parser_get_num_cards(&parser));
+    uint16_t chunk_size;
+    for (chunk_size = 1; chunk_size < 80; chunk_size++){
+        setup();
+        process((const char *) phonebook, chunk_size);
+        STRCMP_EQUAL(reference.c_str(), test_log.c_str());
+    }
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// test polyphase resampler: THD+N, streaming and SIMD vs C
+//
+// *****************************************************************************
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_resample.h"
+#include "btstack_resample_polyphase.h"
+
+#define NUM_INPUT_FRAMES  8192
+#define MAX_OUTPUT_FRAMES 10000
+#define SKIP_FRAMES       128
+#define AMPLITUDE         16384.0
+
+// factors as used by btstack_sample_rate_compensation
+#define FACTOR_44100_TO_48000 ((uint32_t)((44100.0 / 48000.0) * 0x10000 + 0.5))
+#define FACTOR_48000_TO_44100 ((uint32_t)((48000.0 / 44100.0) * 0x10000 + 0.5))
+#define FACTOR_DRIFT          (0x10000 + 100)
+
+static int16_t input_buffer[NUM_INPUT_FRAMES * 2];
+static int16_t output_buffer[MAX_OUTPUT_FRAMES * 2];
+static int16_t reference_buffer[MAX_OUTPUT_FRAMES * 2];
+
+static void generate_sine(double frequency, double sample_rate, int num_channels){
+    for (int i = 0; i < NUM_INPUT_FRAMES; i++){
+        int16_t sample = (int16_t) lround(AMPLITUDE * sin(2.0 * M_PI * frequency * i / sample_rate));
+        for (int c = 0; c < num_channels; c++){
+            input_buffer[i * num_channels + c] = sample;
+        }
+    }
+}
+
+// THD+N in dB: fit a*sin + b*cos + dc at the expected frequency, treat remainder as distortion and noise
+static double thd_n(const int16_t * samples, int num_channels, int channel, int num_frames, double radians_per_frame){
+    double s_ss = 0, s_cc = 0, s_sc = 0, s_s = 0, s_c = 0, s_xs = 0, s_xc = 0, s_x = 0;
+    int n = 0;
+    for (int i = SKIP_FRAMES; i < num_frames - SKIP_FRAMES; i++){
+        double s = sin(radians_per_frame * i);
+        double c = cos(radians_per_frame * i);
+        double x = samples[i * num_channels + channel];
+        s_ss += s * s; s_cc += c * c; s_sc += s * c; s_s += s; s_c += c;
+        s_xs += x * s; s_xc += x * c; s_x += x;
+        n++;
+    }
+    // solve 3x3 normal equations with Cramer's rule
+    double m[3][3] = { { s_ss, s_sc, s_s }, { s_sc, s_cc, s_c }, { s_s, s_c, (double) n } };
+    double r[3] = { s_xs, s_xc, s_x };
+    double det = m[0][0] * (m[1][1] * m[2][2] - m[1][2] * m[2][1])
+               - m[0][1] * (m[1][0] * m[2][2] - m[1][2] * m[2][0])
+               + m[0][2] * (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+    double p[3];
+    for (int k = 0; k < 3; k++){
+        double t[3][3];
+        memcpy(t, m, sizeof(t));
+        for (int j = 0; j < 3; j++) t[j][k] = r[j];
+        p[k] = (t[0][0] * (t[1][1] * t[2][2] - t[1][2] * t[2][1])
+              - t[0][1] * (t[1][0] * t[2][2] - t[1][2] * t[2][0])
+              + t[0][2] * (t[1][0] * t[2][1] - t[1][1] * t[2][0])) / det;
+    }
+    double signal = 0, residual = 0;
+    for (int i = SKIP_FRAMES; i < num_frames - SKIP_FRAMES; i++){
+        double fit = p[0] * sin(radians_per_frame * i) + p[1] * cos(radians_per_frame * i);
+        double e = samples[i * num_channels + channel] - fit - p[2];
+        signal   += fit * fit;
+        residual += e * e;
+    }
+    return 10.0 * log10(residual / signal);
+}
+
+static uint16_t resample_polyphase(btstack_resample_polyphase_quality_t quality, uint32_t factor, int num_channels, bool simd, int16_t * output){
+    btstack_resample_polyphase_t resample;
+    btstack_resample_polyphase_init(&resample, num_channels, quality);
+    btstack_resample_polyphase_set_factor(&resample, factor);
+    btstack_resample_polyphase_set_simd(&resample, simd);
+    return btstack_resample_polyphase_block(&resample, input_buffer, NUM_INPUT_FRAMES, output);
+}
+
+static double measure_polyphase(btstack_resample_polyphase_quality_t quality, double frequency, double sample_rate, uint32_t factor){
+    generate_sine(frequency, sample_rate, 1);
+    uint16_t num_frames = resample_polyphase(quality, factor, 1, false, output_buffer);
+    return thd_n(output_buffer, 1, 0, num_frames, 2.0 * M_PI * frequency / sample_rate * factor / 65536.0);
+}
+
+static double measure_linear(double frequency, double sample_rate, uint32_t factor){
+    btstack_resample_t resample;
+    generate_sine(frequency, sample_rate, 1);
+    btstack_resample_init(&resample, 1);
+    btstack_resample_set_factor(&resample, factor);
+    uint16_t num_frames = btstack_resample_block(&resample, input_buffer, NUM_INPUT_FRAMES, output_buffer);
+    return thd_n(output_buffer, 1, 0, num_frames, 2.0 * M_PI * frequency / sample_rate * factor / 65536.0);
+}
+
+typedef struct {
+    const char * name;
+    double   sample_rate;
+    uint32_t factor;
+} conversion_t;
+
+static const conversion_t conversions[] = {
+    { "44.1 -> 48 kHz", 44100.0, FACTOR_44100_TO_48000 },
+    { "48 -> 44.1 kHz", 48000.0, FACTOR_48000_TO_44100 },
+    { "48 kHz drift",   48000.0, FACTOR_DRIFT },
+};
+
+static const double frequencies[] = { 1000.0, 10000.0 };
+
+// maximal THD+N in dB per quality for 1 kHz and 10 kHz, high is limited by Q15 coefficients
+static const double thd_n_limits[3][2] = {
+    { -58.0, -57.0 },
+    { -76.0, -75.0 },
+    { -78.0, -78.0 },
+};
+
+static const char * quality_names[] = { "low", "medium", "high" };
+
+TEST_GROUP(ResamplePolyphase){
+};
+
+TEST(ResamplePolyphase, THD_N){
+    for (unsigned int c = 0; c < sizeof(conversions) / sizeof(conversion_t); c++){
+        for (unsigned int f = 0; f < 2; f++){
+            double linear = measure_linear(frequencies[f], conversions[c].sample_rate, conversions[c].factor);
+            printf("%s, %5.0f Hz: linear %6.1f dB", conversions[c].name, frequencies[f], linear);
+            for (int q = BTSTACK_RESAMPLE_POLYPHASE_QUALITY_LOW; q <= BTSTACK_RESAMPLE_POLYPHASE_QUALITY_HIGH; q++){
+                double result = measure_polyphase((btstack_resample_polyphase_quality_t) q, frequencies[f], conversions[c].sample_rate, conversions[c].factor);
+                printf(", %s %6.1f dB", quality_names[q], result);
+                CHECK(result < thd_n_limits[q][f]);
+                // linear interpolation is only acceptable for low frequencies
+                if (frequencies[f] > 5000.0){
+                    CHECK(result < linear);
+                }
+            }
+            printf("\n");
+        }
+    }
+}
+
+TEST(ResamplePolyphase, Alignment){
+    // factor 1.0 neither delays nor attenuates the signal
+    generate_sine(1000.0, 48000.0, 2);
+    for (int q = BTSTACK_RESAMPLE_POLYPHASE_QUALITY_LOW; q <= BTSTACK_RESAMPLE_POLYPHASE_QUALITY_HIGH; q++){
+        uint16_t num_frames = resample_polyphase((btstack_resample_polyphase_quality_t) q, 0x10000, 2, false, output_buffer);
+        CHECK(num_frames > NUM_INPUT_FRAMES - 64);
+        int max_error = 0;
+        // skip start where the filter sees the silence before the first frame
+        for (int i = SKIP_FRAMES * 2; i < num_frames * 2; i++){
+            int error = abs(output_buffer[i] - input_buffer[i]);
+            if (error > max_error){
+                max_error = error;
+            }
+        }
+        CHECK(max_error < 32);
+    }
+}
+
+TEST(ResamplePolyphase, Streaming){
+    // random block sizes yield the same output as a single block
+    generate_sine(1000.0, 44100.0, 2);
+    for (int q = BTSTACK_RESAMPLE_POLYPHASE_QUALITY_LOW; q <= BTSTACK_RESAMPLE_POLYPHASE_QUALITY_HIGH; q++){
+        uint16_t reference_frames = resample_polyphase((btstack_resample_polyphase_quality_t) q, FACTOR_44100_TO_48000, 2, false, reference_buffer);
+        btstack_resample_polyphase_t resample;
+        btstack_resample_polyphase_init(&resample, 2, (btstack_resample_polyphase_quality_t) q);
+        btstack_resample_polyphase_set_factor(&resample, FACTOR_44100_TO_48000);
+        btstack_resample_polyphase_set_simd(&resample, false);
+        uint32_t input_pos = 0;
+        uint32_t output_frames = 0;
+        while (input_pos < NUM_INPUT_FRAMES){
+            uint32_t num_frames = 1 + (rand() % 500);
+            if (num_frames > NUM_INPUT_FRAMES - input_pos){
+                num_frames = NUM_INPUT_FRAMES - input_pos;
+            }
+            output_frames += btstack_resample_polyphase_block(&resample, &input_buffer[input_pos * 2], num_frames, &output_buffer[output_frames * 2]);
+            input_pos += num_frames;
+        }
+        CHECK_EQUAL(reference_frames, output_frames);
+        MEMCMP_EQUAL(reference_buffer, output_buffer, output_frames * 2 * sizeof(int16_t));
+    }
+}
+
+TEST(ResamplePolyphase, SIMD){
+    // SIMD kernels are bit-exact to C, including full-scale input
+    if (!btstack_resample_polyphase_simd_available()){
+        printf("SIMD not available\n");
+        return;
+    }
+    for (int i = 0; i < NUM_INPUT_FRAMES * 2; i++){
+        input_buffer[i] = (i & 0x100) ? (int16_t) (rand() - (RAND_MAX / 2)) : ((i & 1) ? INT16_MAX : INT16_MIN);
+    }
+    for (int q = BTSTACK_RESAMPLE_POLYPHASE_QUALITY_LOW; q <= BTSTACK_RESAMPLE_POLYPHASE_QUALITY_HIGH; q++){
+        for (unsigned int c = 0; c < sizeof(conversions) / sizeof(conversion_t); c++){
+            uint16_t reference_frames = resample_polyphase((btstack_resample_polyphase_quality_t) q, conversions[c].factor, 2, false, reference_buffer);
+            uint16_t num_frames = resample_polyphase((btstack_resample_polyphase_quality_t) q, conversions[c].factor, 2, true, output_buffer);
+            CHECK_EQUAL(reference_frames, num_frames);
+            MEMCMP_EQUAL(reference_buffer, output_buffer, num_frames * 2 * sizeof(int16_t));
+        }
+    }
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// benchmark resamplers: throughput per channel relative to realtime
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "btstack_resample.h"
+#include "btstack_resample_polyphase.h"
+
+#define NUM_CHANNELS   2
+#define BLOCK_FRAMES   128
+#define AUDIO_SECONDS  60
+
+static int16_t input_buffer[BLOCK_FRAMES * NUM_CHANNELS];
+static int16_t output_buffer[2 * BLOCK_FRAMES * NUM_CHANNELS];
+
+static double now(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// returns processed channel seconds per second
+static double bench(int quality, bool simd, uint32_t sample_rate, uint32_t factor){
+    btstack_resample_t linear;
+    btstack_resample_polyphase_t polyphase;
+    btstack_resample_init(&linear, NUM_CHANNELS);
+    btstack_resample_set_factor(&linear, factor);
+    if (quality >= 0){
+        btstack_resample_polyphase_init(&polyphase, NUM_CHANNELS, (btstack_resample_polyphase_quality_t) quality);
+        btstack_resample_polyphase_set_factor(&polyphase, factor);
+        btstack_resample_polyphase_set_simd(&polyphase, simd);
+    }
+    uint32_t num_blocks = (AUDIO_SECONDS * sample_rate) / BLOCK_FRAMES;
+    uint32_t checksum = 0;
+    double start = now();
+    uint32_t i;
+    for (i = 0; i < num_blocks; i++){
+        uint16_t num_frames;
+        if (quality < 0){
+            num_frames = btstack_resample_block(&linear, input_buffer, BLOCK_FRAMES, output_buffer);
+        } else {
+            num_frames = btstack_resample_polyphase_block(&polyphase, input_buffer, BLOCK_FRAMES, output_buffer);
+        }
+        checksum += num_frames + (uint16_t) output_buffer[0];
+    }
+    double elapsed = now() - start;
+    if (checksum == 0){
+        printf("\n");
+    }
+    double audio_seconds = ((double) num_blocks * BLOCK_FRAMES) / sample_rate;
+    return (audio_seconds * NUM_CHANNELS) / elapsed;
+}
+
+int main(int argc, const char * argv[]){
+    (void) argc;
+    (void) argv;
+    static const char * quality_names[] = { "low (16 taps)", "medium (32 taps)", "high (64 taps)" };
+    const uint32_t factor_44100_to_48000 = (uint32_t)((44100.0 / 48000.0) * 0x10000 + 0.5);
+    const uint32_t factor_48000_to_44100 = (uint32_t)((48000.0 / 44100.0) * 0x10000 + 0.5);
+    int i;
+    for (i = 0; i < BLOCK_FRAMES * NUM_CHANNELS; i++){
+        input_buffer[i] = (int16_t) rand();
+    }
+
+    printf("Throughput per channel as multiple of realtime, %u channels, %u frames per block\n", NUM_CHANNELS, BLOCK_FRAMES);
+    printf("%-30s %16s %16s\n", "Resampler", "44.1 -> 48 kHz", "48 -> 44.1 kHz");
+    printf("%-30s %15.0fx %15.0fx\n", "linear",
+           bench(-1, false, 44100, factor_44100_to_48000),
+           bench(-1, false, 48000, factor_48000_to_44100));
+    int quality;
+    for (quality = BTSTACK_RESAMPLE_POLYPHASE_QUALITY_LOW; quality <= BTSTACK_RESAMPLE_POLYPHASE_QUALITY_HIGH; quality++){
+        char name[40];
+        snprintf(name, sizeof(name), "polyphase %s C", quality_names[quality]);
+        printf("%-30s %15.0fx %15.0fx\n", name,
+               bench(quality, false, 44100, factor_44100_to_48000),
+               bench(quality, false, 48000, factor_48000_to_44100));
+        if (!btstack_resample_polyphase_simd_available()) continue;
+        snprintf(name, sizeof(name), "polyphase %s SIMD", quality_names[quality]);
+        printf("%-30s %15.0fx %15.0fx\n", name,
+               bench(quality, true, 44100, factor_44100_to_48000),
+               bench(quality, true, 48000, factor_48000_to_44100));
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+#include "btstack_mpsc_ring.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+
+typedef struct {
+    uint32_t producer;
+    uint32_t value;
+} test_element_t;
+
+#define NUM_SLOTS 4
+
+static uint8_t  storage[NUM_SLOTS * sizeof(test_element_t)];
+static uint32_t sequences[NUM_SLOTS];
+
+TEST_GROUP(MPSCRing){
+    btstack_mpsc_ring_t ring;
+
+    void setup(void){
+        btstack_mpsc_ring_init(&ring, storage, sequences, NUM_SLOTS, sizeof(test_element_t));
+    }
+};
+
+TEST(MPSCRing, EmptyRing){
+    test_element_t element;
+    POINTERS_EQUAL(NULL, btstack_mpsc_ring_peek(&ring));
+    CHECK_FALSE(btstack_mpsc_ring_pop(&ring, &element));
+}
+
+TEST(MPSCRing, PushPop){
+    test_element_t element = { 1, 2 };
+    test_element_t result;
+    CHECK_TRUE(btstack_mpsc_ring_push(&ring, &element));
+    CHECK_TRUE(btstack_mpsc_ring_pop(&ring, &result));
+    CHECK_EQUAL(1, result.producer);
+    CHECK_EQUAL(2, result.value);
+    CHECK_FALSE(btstack_mpsc_ring_pop(&ring, &result));
+}
+
+TEST(MPSCRing, PushFull){
+    test_element_t element = { 0, 0 };
+    test_element_t result;
+    uint32_t round;
+    for (round = 0; round < 3; round++){
+        uint32_t i;
+        for (i = 0; i < NUM_SLOTS; i++){
+            element.value = i;
+            CHECK_TRUE(btstack_mpsc_ring_push(&ring, &element));
+        }
+        CHECK_FALSE(btstack_mpsc_ring_push(&ring, &element));
+        for (i = 0; i < NUM_SLOTS; i++){
+            CHECK_TRUE(btstack_mpsc_ring_pop(&ring, &result));
+            CHECK_EQUAL(i, result.value);
+        }
+        CHECK_FALSE(btstack_mpsc_ring_pop(&ring, &result));
+    }
+}
+
+TEST(MPSCRing, PeekConsume){
+    test_element_t element = { 3, 4 };
+    CHECK_TRUE(btstack_mpsc_ring_push(&ring, &element));
+    const test_element_t * next = (const test_element_t *) btstack_mpsc_ring_peek(&ring);
+    CHECK_TRUE(next != NULL);
+    CHECK_EQUAL(4, next->value);
+    POINTERS_EQUAL(next, btstack_mpsc_ring_peek(&ring));
+    btstack_mpsc_ring_consume(&ring);
+    POINTERS_EQUAL(NULL, btstack_mpsc_ring_peek(&ring));
+}
+
+// producers push increasing values, consumer verifies order per producer
+#define NUM_STRESS_PRODUCERS 4
+#define NUM_STRESS_ELEMENTS  100000u
+#define NUM_STRESS_SLOTS     64
+
+static btstack_mpsc_ring_t stress_ring;
+static uint8_t             stress_storage[NUM_STRESS_SLOTS * sizeof(test_element_t)];
+static uint32_t            stress_sequences[NUM_STRESS_SLOTS];
+
+static void * stress_producer(void * arg){
+    test_element_t element;
+    element.producer = (uint32_t) (uintptr_t) arg;
+    for (element.value = 0; element.value < NUM_STRESS_ELEMENTS; element.value++){
+        while (!btstack_mpsc_ring_push(&stress_ring, &element)){
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+TEST(MPSCRing, ConcurrentProducers){
+    btstack_mpsc_ring_init(&stress_ring, stress_storage, stress_sequences, NUM_STRESS_SLOTS, sizeof(test_element_t));
+    pthread_t producers[NUM_STRESS_PRODUCERS];
+    uint32_t next_value[NUM_STRESS_PRODUCERS];
+    uintptr_t i;
+    for (i = 0; i < NUM_STRESS_PRODUCERS; i++){
+        next_value[i] = 0;
+        pthread_create(&producers[i], NULL, &stress_producer, (void *) i);
+    }
+
+    uint32_t errors = 0;
+    uint32_t received = 0;
+    while (received < (NUM_STRESS_PRODUCERS * NUM_STRESS_ELEMENTS)){
+        test_element_t element;
+        if (!btstack_mpsc_ring_pop(&stress_ring, &element)){
+            sched_yield();
+            continue;
+        }
+        if ((element.producer >= NUM_STRESS_PRODUCERS) || (element.value != next_value[element.producer])){
+            errors++;
+        } else {
+            next_value[element.producer]++;
+        }
+        received++;
+    }
+    for (i = 0; i < NUM_STRESS_PRODUCERS; i++){
+        pthread_join(producers[i], NULL);
+    }
+    CHECK_EQUAL(0, errors);
+    POINTERS_EQUAL(NULL, btstack_mpsc_ring_peek(&stress_ring));
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
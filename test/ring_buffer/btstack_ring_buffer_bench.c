@@ -0,0 +1,303 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+/*
+ * btstack_ring_buffer_bench.c
+ *
+ * Contention benchmark for passing data between threads:
+ * - SPSC: one producer streams bytes in 512 byte blocks to one consumer, using btstack_ring_buffer with a
+ *   mutex, btstack_spsc_ring write/read and btstack_spsc_ring reserve/commit + peek/consume
+ * - MPSC: 1, 2 and 4 producers post 16 byte messages to one consumer, using btstack_ring_buffer with a
+ *   mutex and btstack_mpsc_ring
+ * Producers and consumer yield when the ring is full/empty. Checksums must match between variants.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "btstack_mpsc_ring.h"
+#include "btstack_ring_buffer.h"
+#include "btstack_spsc_ring.h"
+#include "btstack_util.h"
+
+#define SPSC_RING_SIZE   4096
+#define SPSC_BLOCK_SIZE   512
+#define SPSC_NUM_BLOCKS  (64 * 1024)
+
+#define MPSC_NUM_SLOTS   256
+#define MPSC_MAX_PRODUCERS 4
+#define MPSC_NUM_MESSAGES  (1024 * 1024)
+
+typedef enum {
+    VARIANT_MUTEX,
+    VARIANT_COPY,
+    VARIANT_ZERO_COPY,
+} variant_t;
+
+typedef struct {
+    uint32_t producer;
+    uint32_t sequence_nr;
+    uint32_t payload[2];
+} message_t;
+
+static variant_t variant;
+
+static pthread_mutex_t       mutex = PTHREAD_MUTEX_INITIALIZER;
+static btstack_ring_buffer_t ring_buffer;
+static uint8_t               ring_buffer_storage[SPSC_RING_SIZE];
+
+static btstack_spsc_ring_t   spsc_ring;
+static uint8_t               spsc_storage[SPSC_RING_SIZE];
+
+static btstack_mpsc_ring_t   mpsc_ring;
+static uint8_t               mpsc_storage[MPSC_NUM_SLOTS * sizeof(message_t)];
+static uint32_t              mpsc_sequences[MPSC_NUM_SLOTS];
+
+static uint32_t mpsc_num_messages;
+
+static double time_ms(void){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec * 1000.0) + (now.tv_nsec / 1000000.0);
+}
+
+static void fill_block(uint8_t * block, uint32_t block_nr){
+    uint32_t i;
+    for (i = 0; i < SPSC_BLOCK_SIZE; i++){
+        block[i] = (uint8_t) (block_nr + i);
+    }
+}
+
+static uint32_t checksum_block(uint32_t checksum, const uint8_t * block, uint32_t len){
+    uint32_t i;
+    for (i = 0; i < len; i++){
+        checksum = (checksum ^ block[i]) * 16777619u;
+    }
+    return checksum;
+}
+
+// SPSC
+
+static void * spsc_producer(void * arg){
+    (void) arg;
+    uint8_t block[SPSC_BLOCK_SIZE];
+    uint32_t block_nr = 0;
+    while (block_nr < SPSC_NUM_BLOCKS){
+        bool stored = false;
+        uint32_t span_size;
+        uint8_t * span;
+        switch (variant){
+            case VARIANT_MUTEX:
+                fill_block(block, block_nr);
+                pthread_mutex_lock(&mutex);
+                if (btstack_ring_buffer_bytes_free(&ring_buffer) >= SPSC_BLOCK_SIZE){
+                    btstack_ring_buffer_write(&ring_buffer, block, SPSC_BLOCK_SIZE);
+                    stored = true;
+                }
+                pthread_mutex_unlock(&mutex);
+                break;
+            case VARIANT_COPY:
+                fill_block(block, block_nr);
+                stored = btstack_spsc_ring_write(&spsc_ring, block, SPSC_BLOCK_SIZE);
+                break;
+            case VARIANT_ZERO_COPY:
+                // ring size is multiple of block size, span does not wrap
+                span = btstack_spsc_ring_reserve(&spsc_ring, &span_size);
+                if (span_size >= SPSC_BLOCK_SIZE){
+                    fill_block(span, block_nr);
+                    btstack_spsc_ring_commit(&spsc_ring, SPSC_BLOCK_SIZE);
+                    stored = true;
+                }
+                break;
+            default:
+                break;
+        }
+        if (stored){
+            block_nr++;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static uint32_t spsc_consumer(void){
+    uint8_t block[SPSC_BLOCK_SIZE];
+    uint32_t bytes_total = SPSC_BLOCK_SIZE * SPSC_NUM_BLOCKS;
+    uint32_t bytes_received = 0;
+    uint32_t checksum = 2166136261u;
+    while (bytes_received < bytes_total){
+        uint32_t len = 0;
+        const uint8_t * span;
+        switch (variant){
+            case VARIANT_MUTEX:
+                pthread_mutex_lock(&mutex);
+                btstack_ring_buffer_read(&ring_buffer, block, sizeof(block), &len);
+                pthread_mutex_unlock(&mutex);
+                checksum = checksum_block(checksum, block, len);
+                break;
+            case VARIANT_COPY:
+                len = btstack_spsc_ring_read(&spsc_ring, block, sizeof(block));
+                checksum = checksum_block(checksum, block, len);
+                break;
+            case VARIANT_ZERO_COPY:
+                span = btstack_spsc_ring_peek(&spsc_ring, &len);
+                checksum = checksum_block(checksum, span, len);
+                btstack_spsc_ring_consume(&spsc_ring, len);
+                break;
+            default:
+                break;
+        }
+        if (len == 0){
+            sched_yield();
+        }
+        bytes_received += len;
+    }
+    return checksum;
+}
+
+static void bench_spsc(const char * name, variant_t spsc_variant){
+    variant = spsc_variant;
+    btstack_ring_buffer_init(&ring_buffer, ring_buffer_storage, sizeof(ring_buffer_storage));
+    btstack_spsc_ring_init(&spsc_ring, spsc_storage, sizeof(spsc_storage));
+
+    double start = time_ms();
+    pthread_t producer;
+    pthread_create(&producer, NULL, &spsc_producer, NULL);
+    uint32_t checksum = spsc_consumer();
+    pthread_join(producer, NULL);
+    double duration = time_ms() - start;
+
+    double megabytes = (SPSC_BLOCK_SIZE * (double) SPSC_NUM_BLOCKS) / (1024.0 * 1024.0);
+    printf("SPSC %-24s %8.1f ms, %8.1f MB/s, checksum %08x\n", name, duration, megabytes * 1000.0 / duration, checksum);
+}
+
+// MPSC
+
+static void * mpsc_producer(void * arg){
+    message_t message;
+    memset(&message, 0, sizeof(message));
+    message.producer = (uint32_t) (uintptr_t) arg;
+    for (message.sequence_nr = 0; message.sequence_nr < mpsc_num_messages; message.sequence_nr++){
+        message.payload[0] = message.sequence_nr * 2654435761u;
+        bool stored = false;
+        while (!stored){
+            if (variant == VARIANT_MUTEX){
+                pthread_mutex_lock(&mutex);
+                if (btstack_ring_buffer_bytes_free(&ring_buffer) >= sizeof(message)){
+                    btstack_ring_buffer_write(&ring_buffer, (uint8_t *) &message, sizeof(message));
+                    stored = true;
+                }
+                pthread_mutex_unlock(&mutex);
+            } else {
+                stored = btstack_mpsc_ring_push(&mpsc_ring, &message);
+            }
+            if (!stored){
+                sched_yield();
+            }
+        }
+    }
+    return NULL;
+}
+
+static void bench_mpsc(const char * name, variant_t mpsc_variant, uint32_t num_producers){
+    variant = mpsc_variant;
+    mpsc_num_messages = MPSC_NUM_MESSAGES / num_producers;
+    btstack_ring_buffer_init(&ring_buffer, ring_buffer_storage, sizeof(ring_buffer_storage));
+    btstack_mpsc_ring_init(&mpsc_ring, mpsc_storage, mpsc_sequences, MPSC_NUM_SLOTS, sizeof(message_t));
+
+    double start = time_ms();
+    pthread_t producers[MPSC_MAX_PRODUCERS];
+    uintptr_t i;
+    for (i = 0; i < num_producers; i++){
+        pthread_create(&producers[i], NULL, &mpsc_producer, (void *) i);
+    }
+
+    uint32_t next_sequence_nr[MPSC_MAX_PRODUCERS] = { 0 };
+    uint32_t messages_total = mpsc_num_messages * num_producers;
+    uint32_t messages_received = 0;
+    uint32_t errors = 0;
+    uint32_t checksum = 0;
+    while (messages_received < messages_total){
+        message_t message;
+        bool received;
+        if (variant == VARIANT_MUTEX){
+            uint32_t len = 0;
+            pthread_mutex_lock(&mutex);
+            if (btstack_ring_buffer_bytes_available(&ring_buffer) >= sizeof(message)){
+                btstack_ring_buffer_read(&ring_buffer, (uint8_t *) &message, sizeof(message), &len);
+            }
+            pthread_mutex_unlock(&mutex);
+            received = len == sizeof(message);
+        } else {
+            received = btstack_mpsc_ring_pop(&mpsc_ring, &message);
+        }
+        if (!received){
+            sched_yield();
+            continue;
+        }
+        if (message.sequence_nr != next_sequence_nr[message.producer]){
+            errors++;
+        }
+        next_sequence_nr[message.producer] = message.sequence_nr + 1;
+        checksum += message.payload[0];
+        messages_received++;
+    }
+
+    for (i = 0; i < num_producers; i++){
+        pthread_join(producers[i], NULL);
+    }
+    double duration = time_ms() - start;
+    printf("MPSC %-19s %u prod %8.1f ms, %8.2f M msg/s, checksum %08x, errors %u\n", name, num_producers, duration,
+           messages_total / (duration * 1000.0), checksum, errors);
+}
+
+int main(void){
+    bench_spsc("ring buffer + mutex", VARIANT_MUTEX);
+    bench_spsc("write/read", VARIANT_COPY);
+    bench_spsc("reserve/commit", VARIANT_ZERO_COPY);
+
+    uint32_t num_producers;
+    for (num_producers = 1; num_producers <= MPSC_MAX_PRODUCERS; num_producers *= 2){
+        bench_mpsc("ring buffer + mutex", VARIANT_MUTEX, num_producers);
+        bench_mpsc("mpsc ring", VARIANT_COPY, num_producers);
+    }
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+#include "btstack_spsc_ring.h"
+#include "btstack_util.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stddef.h>
+#include <string.h>
+
+static uint8_t storage[16];
+
+uint32_t btstack_min(uint32_t a, uint32_t b){
+    return a < b ? a : b;
+}
+
+TEST_GROUP(SPSCRing){
+    btstack_spsc_ring_t ring;
+
+    void setup(void){
+        memset(storage, 0, sizeof(storage));
+        btstack_spsc_ring_init(&ring, storage, sizeof(storage));
+    }
+};
+
+TEST(SPSCRing, EmptyRing){
+    uint32_t span_size;
+    CHECK_EQUAL(0, btstack_spsc_ring_bytes_available(&ring));
+    CHECK_EQUAL(sizeof(storage), btstack_spsc_ring_bytes_free(&ring));
+    (void) btstack_spsc_ring_peek(&ring, &span_size);
+    CHECK_EQUAL(0, span_size);
+}
+
+TEST(SPSCRing, ProducerConsumerOnSeparateCacheLines){
+    // last producer byte and first consumer byte are more than one cache line apart
+    size_t producer_end   = offsetof(btstack_spsc_ring_t, read_index_cached) + sizeof(uint32_t);
+    size_t consumer_start = offsetof(btstack_spsc_ring_t, read_index);
+    CHECK(consumer_start - producer_end >= BTSTACK_SPSC_RING_CACHE_LINE_SIZE);
+    size_t shared_end     = offsetof(btstack_spsc_ring_t, size) + sizeof(uint32_t);
+    CHECK(offsetof(btstack_spsc_ring_t, write_index) - shared_end >= BTSTACK_SPSC_RING_CACHE_LINE_SIZE);
+}
+
+TEST(SPSCRing, WriteRead){
+    const uint8_t data[] = { 1, 2, 3, 4, 5 };
+    uint8_t buffer[8];
+    CHECK_TRUE(btstack_spsc_ring_write(&ring, data, sizeof(data)));
+    CHECK_EQUAL(sizeof(data), btstack_spsc_ring_bytes_available(&ring));
+    CHECK_EQUAL(sizeof(data), btstack_spsc_ring_read(&ring, buffer, sizeof(buffer)));
+    MEMCMP_EQUAL(data, buffer, sizeof(data));
+    CHECK_EQUAL(0, btstack_spsc_ring_bytes_available(&ring));
+}
+
+TEST(SPSCRing, WriteFull){
+    uint8_t data[17];
+    memset(data, 0, sizeof(data));
+    CHECK_FALSE(btstack_spsc_ring_write(&ring, data, sizeof(data)));
+    CHECK_TRUE(btstack_spsc_ring_write(&ring, data, 16));
+    CHECK_EQUAL(0, btstack_spsc_ring_bytes_free(&ring));
+    CHECK_FALSE(btstack_spsc_ring_write(&ring, data, 1));
+}
+
+TEST(SPSCRing, WriteReadWrapAround){
+    uint8_t data[12];
+    uint8_t buffer[12];
+    uint8_t i;
+    for (i = 0; i < sizeof(data); i++){
+        data[i] = i;
+    }
+    uint8_t round;
+    for (round = 0; round < 5; round++){
+        CHECK_TRUE(btstack_spsc_ring_write(&ring, data, sizeof(data)));
+        CHECK_EQUAL(sizeof(data), btstack_spsc_ring_read(&ring, buffer, sizeof(buffer)));
+        MEMCMP_EQUAL(data, buffer, sizeof(data));
+    }
+}
+
+TEST(SPSCRing, ReserveCommitPeekConsume){
+    uint32_t span_size;
+    uint8_t * span = btstack_spsc_ring_reserve(&ring, &span_size);
+    CHECK_EQUAL(16, span_size);
+    memset(span, 0x11, 12);
+    btstack_spsc_ring_commit(&ring, 12);
+
+    const uint8_t * data = btstack_spsc_ring_peek(&ring, &span_size);
+    CHECK_EQUAL(12, span_size);
+    CHECK_EQUAL(0x11, data[11]);
+    btstack_spsc_ring_consume(&ring, 8);
+
+    // free span ends at end of storage
+    span = btstack_spsc_ring_reserve(&ring, &span_size);
+    CHECK_EQUAL(4, span_size);
+    memset(span, 0x22, 4);
+    btstack_spsc_ring_commit(&ring, 4);
+    span = btstack_spsc_ring_reserve(&ring, &span_size);
+    CHECK_EQUAL(8, span_size);
+    POINTERS_EQUAL(storage, span);
+    memset(span, 0x33, 8);
+    btstack_spsc_ring_commit(&ring, 8);
+    CHECK_EQUAL(0, btstack_spsc_ring_bytes_free(&ring));
+
+    // available span ends at end of storage
+    data = btstack_spsc_ring_peek(&ring, &span_size);
+    CHECK_EQUAL(8, span_size);
+    CHECK_EQUAL(0x22, data[7]);
+    btstack_spsc_ring_consume(&ring, span_size);
+    data = btstack_spsc_ring_peek(&ring, &span_size);
+    CHECK_EQUAL(8, span_size);
+    CHECK_EQUAL(0x33, data[0]);
+    btstack_spsc_ring_consume(&ring, span_size);
+    CHECK_EQUAL(0, btstack_spsc_ring_bytes_available(&ring));
+}
+
+// producer thread writes counter in chunks of varying size, consumer verifies sequence
+#define NUM_STRESS_BYTES 1000000u
+
+static btstack_spsc_ring_t stress_ring;
+static uint8_t             stress_storage[256];
+
+static void * stress_producer(void * arg){
+    (void) arg;
+    uint32_t counter = 0;
+    uint32_t chunk = 1;
+    while (counter < NUM_STRESS_BYTES){
+        uint32_t span_size;
+        uint8_t * span = btstack_spsc_ring_reserve(&stress_ring, &span_size);
+        if (span_size == 0){
+            sched_yield();
+            continue;
+        }
+        uint32_t len = btstack_min(btstack_min(span_size, chunk), NUM_STRESS_BYTES - counter);
+        uint32_t i;
+        for (i = 0; i < len; i++){
+            span[i] = (uint8_t) counter++;
+        }
+        btstack_spsc_ring_commit(&stress_ring, len);
+        chunk = (chunk % 97) + 1;
+    }
+    return NULL;
+}
+
+TEST(SPSCRing, ConcurrentProducerConsumer){
+    btstack_spsc_ring_init(&stress_ring, stress_storage, sizeof(stress_storage));
+    pthread_t producer;
+    pthread_create(&producer, NULL, &stress_producer, NULL);
+
+    uint32_t counter = 0;
+    uint32_t errors = 0;
+    uint8_t buffer[64];
+    while (counter < NUM_STRESS_BYTES){
+        uint32_t len = btstack_spsc_ring_read(&stress_ring, buffer, (counter % 63) + 1);
+        if (len == 0){
+            sched_yield();
+            continue;
+        }
+        uint32_t i;
+        for (i = 0; i < len; i++){
+            if (buffer[i] != (uint8_t) counter) errors++;
+            counter++;
+        }
+    }
+    pthread_join(producer, NULL);
+    CHECK_EQUAL(0, errors);
+    CHECK_EQUAL(0, btstack_spsc_ring_bytes_available(&stress_ring));
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -0,0 +1,143 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "btstack_run_loop.h"
+#include "btstack_run_loop_epoll.h"
+#include "btstack_util.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+static btstack_timer_source_t timer;
+static btstack_timer_source_t exit_timer;
+static btstack_data_source_t  data_source;
+static btstack_context_callback_registration_t callback_registration;
+
+static int  fds[2];
+static int  timer_count;
+static int  data_source_count;
+static int  callback_count;
+
+static void exit_timer_handler(btstack_timer_source_t * ts){
+    UNUSED(ts);
+    btstack_run_loop_trigger_exit();
+}
+
+static void timer_handler(btstack_timer_source_t * ts){
+    UNUSED(ts);
+    timer_count++;
+    btstack_run_loop_trigger_exit();
+}
+
+static void data_source_handler(btstack_data_source_t * ds, btstack_data_source_callback_type_t callback_type){
+    UNUSED(callback_type);
+    uint8_t buffer[4];
+    ssize_t bytes_read = read(ds->source.fd, buffer, sizeof(buffer));
+    UNUSED(bytes_read);
+    data_source_count++;
+    btstack_run_loop_trigger_exit();
+}
+
+static void callback_handler(void * context){
+    UNUSED(context);
+    callback_count++;
+    btstack_run_loop_trigger_exit();
+}
+
+static void * trigger_exit_thread(void * arg){
+    UNUSED(arg);
+    usleep(20000);
+    btstack_run_loop_trigger_exit();
+    return NULL;
+}
+
+static void * execute_on_main_thread_thread(void * arg){
+    UNUSED(arg);
+    usleep(20000);
+    callback_registration.callback = &callback_handler;
+    callback_registration.context  = NULL;
+    btstack_run_loop_execute_on_main_thread(&callback_registration);
+    return NULL;
+}
+
+// fail safe: stop run loop if expected event does not occur
+static void start_exit_timer(uint32_t timeout_ms){
+    btstack_run_loop_set_timer_handler(&exit_timer, &exit_timer_handler);
+    btstack_run_loop_set_timer(&exit_timer, timeout_ms);
+    btstack_run_loop_add_timer(&exit_timer);
+}
+
+TEST_GROUP(RunLoopEpoll){
+    void setup(void){
+        timer_count = 0;
+        data_source_count = 0;
+        callback_count = 0;
+        btstack_run_loop_init(btstack_run_loop_epoll_get_instance());
+    }
+    void teardown(void){
+        btstack_run_loop_deinit();
+    }
+};
+
+TEST(RunLoopEpoll, Timer){
+    btstack_run_loop_set_timer_handler(&timer, &timer_handler);
+    btstack_run_loop_set_timer(&timer, 10);
+    btstack_run_loop_add_timer(&timer);
+    uint32_t start_ms = btstack_run_loop_get_time_ms();
+    btstack_run_loop_execute();
+    CHECK_EQUAL(1, timer_count);
+    CHECK(btstack_run_loop_get_time_ms() - start_ms >= 10);
+}
+
+TEST(RunLoopEpoll, DataSource){
+    CHECK_EQUAL(0, pipe(fds));
+    btstack_run_loop_set_data_source_fd(&data_source, fds[0]);
+    btstack_run_loop_set_data_source_handler(&data_source, &data_source_handler);
+    btstack_run_loop_enable_data_source_callbacks(&data_source, DATA_SOURCE_CALLBACK_READ);
+    btstack_run_loop_add_data_source(&data_source);
+    start_exit_timer(1000);
+    const uint8_t value = 0x55;
+    CHECK_EQUAL(1, (int) write(fds[1], &value, 1));
+    btstack_run_loop_execute();
+    CHECK_EQUAL(1, data_source_count);
+    btstack_run_loop_remove_timer(&exit_timer);
+    btstack_run_loop_remove_data_source(&data_source);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST(RunLoopEpoll, ExecuteOnMainThread){
+    pthread_t thread;
+    start_exit_timer(1000);
+    CHECK_EQUAL(0, pthread_create(&thread, NULL, &execute_on_main_thread_thread, NULL));
+    btstack_run_loop_execute();
+    pthread_join(thread, NULL);
+    CHECK_EQUAL(1, callback_count);
+    btstack_run_loop_remove_timer(&exit_timer);
+}
+
+TEST(RunLoopEpoll, TriggerExitWakesUpEpollWait){
+    // no timers or data sources: epoll_wait blocks until trigger exit
+    pthread_t thread;
+    CHECK_EQUAL(0, pthread_create(&thread, NULL, &trigger_exit_thread, NULL));
+    btstack_run_loop_execute();
+    pthread_join(thread, NULL);
+}
+
+TEST(RunLoopEpoll, ExecuteAfterReInit){
+    // exit first run
+    btstack_run_loop_trigger_exit();
+    btstack_run_loop_execute();
+    // second init must reset exit request
+    btstack_run_loop_deinit();
+    btstack_run_loop_init(btstack_run_loop_epoll_get_instance());
+    btstack_run_loop_set_timer_handler(&timer, &timer_handler);
+    btstack_run_loop_set_timer(&timer, 10);
+    btstack_run_loop_add_timer(&timer);
+    btstack_run_loop_execute();
+    CHECK_EQUAL(1, timer_count);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
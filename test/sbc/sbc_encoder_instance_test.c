@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+ 
+ 
+// *****************************************************************************
+//
+// SBC encoder instance tests
+//
+// - encodes two files with different configurations using one encoder
+//   instance each as reference
+// - encodes both files again with two encoder instances that are configured
+//   up front and used in turns, checks that each SBC frame matches the
+//   single instance reference
+//
+// *****************************************************************************
+
+#include "btstack_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "btstack_sbc.h"
+#include "btstack_sbc_bluedroid.h"
+#include "wav_util.h"
+
+#define MAX_PCM_FRAMES 1000000
+#define MAX_SBC_FRAME_LEN 512
+
+typedef struct {
+    const char * wav_filename;
+    btstack_sbc_mode_t mode;
+    int blocks;
+    int subbands;
+    btstack_sbc_allocation_method_t allocation_method;
+    uint16_t sampling_frequency;
+    int bitpool;
+    btstack_sbc_channel_mode_t channel_mode;
+} test_configuration_t;
+
+static const test_configuration_t test_configurations[] = {
+    { "data/fanfare-stereo.wav", SBC_MODE_STANDARD, 16, 8, SBC_ALLOCATION_METHOD_LOUDNESS, 44100, 53, SBC_CHANNEL_MODE_JOINT_STEREO },
+    { "data/sine-mono.wav",      SBC_MODE_mSBC,     15, 8, SBC_ALLOCATION_METHOD_LOUDNESS, 16000, 26, SBC_CHANNEL_MODE_MONO },
+};
+#define NUM_ENCODERS (sizeof(test_configurations) / sizeof(test_configurations[0]))
+
+typedef struct {
+    const test_configuration_t * config;
+    btstack_sbc_encoder_state_t     state;
+    btstack_sbc_encoder_bluedroid_t context;
+    int16_t * pcm_samples;
+    int       pcm_num_frames;
+    int       pcm_num_channels;
+    int       num_channels;
+    int       num_frames_per_sbc_frame;
+    int       pcm_pos;
+    // reference output
+    uint8_t * sbc_frames;
+    uint16_t  sbc_frame_len;
+    int       num_sbc_frames;
+} test_encoder_t;
+
+static test_encoder_t encoders[NUM_ENCODERS];
+
+static int read_wav_file(test_encoder_t * encoder){
+    if (wav_reader_open(encoder->config->wav_filename) != 0) return -1;
+    encoder->pcm_num_channels = wav_reader_get_num_channels();
+    encoder->pcm_samples = malloc(MAX_PCM_FRAMES * encoder->pcm_num_channels * sizeof(int16_t));
+    encoder->pcm_num_frames = 0;
+    while (encoder->pcm_num_frames < MAX_PCM_FRAMES){
+        if (wav_reader_read_int16(encoder->pcm_num_channels, &encoder->pcm_samples[encoder->pcm_num_frames * encoder->pcm_num_channels]) != 0) break;
+        encoder->pcm_num_frames++;
+    }
+    wav_reader_close();
+    return 0;
+}
+
+static void encoder_init(test_encoder_t * encoder){
+    const test_configuration_t * config = encoder->config;
+    btstack_sbc_encoder_bluedroid_init_instance(&encoder->state, &encoder->context);
+    btstack_sbc_encoder_instance_configure(&encoder->state, config->mode, config->blocks, config->subbands,
+                                           config->allocation_method, config->sampling_frequency, config->bitpool, config->channel_mode);
+    encoder->num_channels = (config->channel_mode == SBC_CHANNEL_MODE_MONO) ? 1 : 2;
+    encoder->num_frames_per_sbc_frame = btstack_sbc_encoder_instance_num_audio_frames(&encoder->state);
+    encoder->pcm_pos = 0;
+}
+
+// encode next SBC frame, returns 0 if end of file is reached
+static int encoder_process(test_encoder_t * encoder){
+    int16_t pcm_frame[16 * 8 * 2];
+    if ((encoder->pcm_pos + encoder->num_frames_per_sbc_frame) > encoder->pcm_num_frames) return 0;
+    int i;
+    for (i = 0; i < encoder->num_frames_per_sbc_frame * encoder->num_channels; i++){
+        int frame = encoder->pcm_pos + (i / encoder->num_channels);
+        int channel = (i % encoder->num_channels) % encoder->pcm_num_channels;
+        pcm_frame[i] = encoder->pcm_samples[frame * encoder->pcm_num_channels + channel];
+    }
+    encoder->pcm_pos += encoder->num_frames_per_sbc_frame;
+    btstack_sbc_encoder_instance_process_data(&encoder->state, pcm_frame);
+    return 1;
+}
+
+static void encode_reference(test_encoder_t * encoder){
+    encoder_init(encoder);
+    int max_sbc_frames = encoder->pcm_num_frames / encoder->num_frames_per_sbc_frame;
+    encoder->sbc_frames = malloc(max_sbc_frames * MAX_SBC_FRAME_LEN);
+    encoder->num_sbc_frames = 0;
+    while (encoder_process(encoder)){
+        encoder->sbc_frame_len = btstack_sbc_encoder_instance_sbc_buffer_length(&encoder->state);
+        memcpy(&encoder->sbc_frames[encoder->num_sbc_frames * MAX_SBC_FRAME_LEN],
+               btstack_sbc_encoder_instance_sbc_buffer(&encoder->state), encoder->sbc_frame_len);
+        encoder->num_sbc_frames++;
+    }
+}
+
+static int check_frame(test_encoder_t * encoder, int frame){
+    uint16_t len = btstack_sbc_encoder_instance_sbc_buffer_length(&encoder->state);
+    if ((len != encoder->sbc_frame_len) ||
+        (memcmp(btstack_sbc_encoder_instance_sbc_buffer(&encoder->state), &encoder->sbc_frames[frame * MAX_SBC_FRAME_LEN], len) != 0)){
+        printf("%s: SBC frame %u differs from single instance reference\n", encoder->config->wav_filename, frame);
+        return -1;
+    }
+    return 0;
+}
+
+int main (int argc, const char * argv[]){
+    (void) argc;
+    (void) argv;
+    unsigned int i;
+    for (i = 0; i < NUM_ENCODERS; i++){
+        encoders[i].config = &test_configurations[i];
+        if (read_wav_file(&encoders[i]) != 0){
+            printf("Can't read %s\n", test_configurations[i].wav_filename);
+            return -1;
+        }
+        encode_reference(&encoders[i]);
+    }
+
+    // configure all instances before encoding, then encode one SBC frame per instance in turns
+    for (i = 0; i < NUM_ENCODERS; i++){
+        encoder_init(&encoders[i]);
+    }
+    int errors = 0;
+    int frame = 0;
+    int active = 1;
+    while (active && (errors == 0)){
+        active = 0;
+        for (i = 0; i < NUM_ENCODERS; i++){
+            if (encoder_process(&encoders[i]) == 0) continue;
+            active = 1;
+            if (check_frame(&encoders[i], frame) != 0){
+                errors++;
+            }
+        }
+        frame++;
+    }
+
+    for (i = 0; i < NUM_ENCODERS; i++){
+        if (errors == 0){
+            printf("%s: %u frames match single instance reference\n", encoders[i].config->wav_filename, encoders[i].num_sbc_frames);
+        }
+        free(encoders[i].pcm_samples);
+        free(encoders[i].sbc_frames);
+    }
+    if (errors){
+        printf("Interleaved encoding failed\n");
+        return 1;
+    }
+    printf("Done\n");
+    return 0;
+}
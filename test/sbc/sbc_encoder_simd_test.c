@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+ 
+// *****************************************************************************
+//
+// SBC encoder SIMD tests
+//
+// - encodes the test/sbc wav files with the configuration of the reference
+//   sbc files using every available analysis filter implementation and checks
+//   that the output is bit-exact to the C implementation
+// - 'bench' argument: report encoder throughput in frames/sec
+//
+// *****************************************************************************
+
+#include "btstack_config.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "btstack_sbc.h"
+#include "btstack_sbc_bluedroid.h"
+#include "wav_util.h"
+
+typedef struct {
+    const char * wav_filename;
+    const char * sbc_filename;      // used for configuration only, NULL for mSBC
+    btstack_sbc_channel_mode_t channel_mode;
+} test_vector_t;
+
+static const test_vector_t test_vectors[] = {
+    { "data/fanfare-mono.wav",   "data/fanfare-4sb-mono.sbc",   SBC_CHANNEL_MODE_MONO },
+    { "data/fanfare-mono.wav",   "data/fanfare-8sb-mono.sbc",   SBC_CHANNEL_MODE_MONO },
+    { "data/fanfare-stereo.wav", "data/fanfare-4sb-stereo.sbc", SBC_CHANNEL_MODE_STEREO },
+    { "data/fanfare-stereo.wav", "data/fanfare-8sb-stereo.sbc", SBC_CHANNEL_MODE_STEREO },
+    { "data/fanfare-stereo.wav", "data/fanfare-4sb-stereo.sbc", SBC_CHANNEL_MODE_JOINT_STEREO },
+    { "data/fanfare-stereo.wav", "data/fanfare-8sb-stereo.sbc", SBC_CHANNEL_MODE_DUAL_CHANNEL },
+    { "data/sine-mono.wav",      "data/sine-8sb-mono.sbc",      SBC_CHANNEL_MODE_MONO },
+    { "data/sine-stereo.wav",    "data/sine-4sb-stereo.sbc",    SBC_CHANNEL_MODE_STEREO },
+    { "data/sine-stereo.wav",    "data/sine-8sb-stereo.sbc",    SBC_CHANNEL_MODE_STEREO },
+    { "data/sine-stereo.wav",    "data/sine-stereo.sbc",        SBC_CHANNEL_MODE_JOINT_STEREO },
+    { "data/sine-mono.wav",      NULL,                          SBC_CHANNEL_MODE_MONO },
+};
+
+static const struct {
+    uint8_t impl;
+    const char * name;
+} implementations[] = {
+    { SBC_ANALYSIS_IMPL_C,    "C"    },
+    { SBC_ANALYSIS_IMPL_SSE2, "SSE2" },
+    { SBC_ANALYSIS_IMPL_AVX2, "AVX2" },
+};
+#define NUM_IMPLEMENTATIONS (sizeof(implementations) / sizeof(implementations[0]))
+
+typedef struct {
+    btstack_sbc_mode_t mode;
+    int blocks;
+    int subbands;
+    btstack_sbc_allocation_method_t allocation_method;
+    int bitpool;
+    btstack_sbc_channel_mode_t channel_mode;
+} sbc_configuration_t;
+
+static int16_t * pcm_samples;
+static int       pcm_num_frames;
+static int       pcm_num_channels;
+
+static int read_configuration(const test_vector_t * vector, sbc_configuration_t * config){
+    config->channel_mode = vector->channel_mode;
+    if (vector->sbc_filename == NULL){
+        config->mode = SBC_MODE_mSBC;
+        config->blocks = 15;
+        config->subbands = 8;
+        config->allocation_method = SBC_ALLOCATION_METHOD_LOUDNESS;
+        config->bitpool = 26;
+        return 0;
+    }
+    FILE * sbc_file = fopen(vector->sbc_filename, "rb");
+    if (sbc_file == NULL) return -1;
+    uint8_t header[3];
+    size_t bytes_read = fread(header, 1, sizeof(header), sbc_file);
+    fclose(sbc_file);
+    if (bytes_read != sizeof(header)) return -1;
+    config->mode = SBC_MODE_STANDARD;
+    config->blocks = 4 * (((header[1] >> 4) & 3) + 1);
+    config->subbands = (header[1] & 1) ? 8 : 4;
+    config->allocation_method = (btstack_sbc_allocation_method_t) ((header[1] >> 1) & 1);
+    config->bitpool = header[2];
+    return 0;
+}
+
+static int read_wav_file(const char * wav_filename){
+    if (wav_reader_open(wav_filename) != 0) return -1;
+    pcm_num_channels = wav_reader_get_num_channels();
+    int max_frames = 1000000;
+    pcm_samples = malloc(max_frames * pcm_num_channels * sizeof(int16_t));
+    pcm_num_frames = 0;
+    while (pcm_num_frames < max_frames){
+        if (wav_reader_read_int16(pcm_num_channels, &pcm_samples[pcm_num_frames * pcm_num_channels]) != 0) break;
+        pcm_num_frames++;
+    }
+    wav_reader_close();
+    return 0;
+}
+
+static void encoder_configure(btstack_sbc_encoder_state_t * state, const sbc_configuration_t * config){
+    btstack_sbc_encoder_instance_configure(state, config->mode, config->blocks, config->subbands,
+                                           config->allocation_method, 44100, config->bitpool, config->channel_mode);
+}
+
+// encode with reference C implementation and implementation under test, compare each SBC frame
+static int test_vector(const test_vector_t * vector, const sbc_configuration_t * config, uint8_t impl, const char * impl_name){
+    static btstack_sbc_encoder_state_t        state_reference;
+    static btstack_sbc_encoder_bluedroid_t    context_reference;
+    static btstack_sbc_encoder_state_t        state_test;
+    static btstack_sbc_encoder_bluedroid_t    context_test;
+
+    btstack_sbc_encoder_bluedroid_init_instance(&state_reference, &context_reference);
+    btstack_sbc_encoder_bluedroid_init_instance(&state_test, &context_test);
+    encoder_configure(&state_reference, config);
+    encoder_configure(&state_test, config);
+    SBC_Encoder_SelectAnalysisImpl(&context_reference.params, SBC_ANALYSIS_IMPL_C);
+    SBC_Encoder_SelectAnalysisImpl(&context_test.params, impl);
+
+    // mono encoder consumes interleaved stereo input as consecutive samples, use first channel only
+    int num_channels = (config->channel_mode == SBC_CHANNEL_MODE_MONO) ? 1 : 2;
+    int num_frames_per_sbc_frame = btstack_sbc_encoder_instance_num_audio_frames(&state_reference);
+    int16_t pcm_frame[16 * 8 * 2];
+    int num_sbc_frames = 0;
+    int pos;
+    for (pos = 0; (pos + num_frames_per_sbc_frame) <= pcm_num_frames; pos += num_frames_per_sbc_frame){
+        int i;
+        for (i = 0; i < num_frames_per_sbc_frame * num_channels; i++){
+            int frame = pos + (i / num_channels);
+            int channel = (i % num_channels) % pcm_num_channels;
+            pcm_frame[i] = pcm_samples[frame * pcm_num_channels + channel];
+        }
+
+        btstack_sbc_encoder_instance_process_data(&state_reference, pcm_frame);
+        btstack_sbc_encoder_instance_process_data(&state_test, pcm_frame);
+
+        uint16_t len_reference = btstack_sbc_encoder_instance_sbc_buffer_length(&state_reference);
+        uint16_t len_test      = btstack_sbc_encoder_instance_sbc_buffer_length(&state_test);
+        if ((len_reference != len_test) ||
+            (memcmp(btstack_sbc_encoder_instance_sbc_buffer(&state_reference), btstack_sbc_encoder_instance_sbc_buffer(&state_test), len_reference) != 0)){
+            printf("%s: %s (%s, channel mode %u): SBC frame %u differs from C implementation\n",
+                   impl_name, vector->wav_filename, vector->sbc_filename ? vector->sbc_filename : "mSBC", config->channel_mode, num_sbc_frames);
+            return -1;
+        }
+        num_sbc_frames++;
+    }
+    printf("%s: %s (%s, channel mode %u): %u frames bit-exact\n",
+           impl_name, vector->wav_filename, vector->sbc_filename ? vector->sbc_filename : "mSBC", config->channel_mode, num_sbc_frames);
+    return 0;
+}
+
+static int implementation_supported(uint8_t impl){
+    static SBC_ENC_PARAMS params;
+    return SBC_Encoder_SelectAnalysisImpl(&params, impl);
+}
+
+static double benchmark_vector(const sbc_configuration_t * config, uint8_t impl){
+    static btstack_sbc_encoder_state_t     state;
+    static btstack_sbc_encoder_bluedroid_t context;
+    btstack_sbc_encoder_bluedroid_init_instance(&state, &context);
+    encoder_configure(&state, config);
+    SBC_Encoder_SelectAnalysisImpl(&context.params, impl);
+
+    int num_channels = (config->channel_mode == SBC_CHANNEL_MODE_MONO) ? 1 : 2;
+    int num_frames_per_sbc_frame = btstack_sbc_encoder_instance_num_audio_frames(&state);
+    int16_t pcm_frame[16 * 8 * 2];
+    memset(pcm_frame, 0, sizeof(pcm_frame));
+
+    const int num_sbc_frames = 20000;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int frame;
+    for (frame = 0; frame < num_sbc_frames; frame++){
+        int pos = (frame * num_frames_per_sbc_frame) % (pcm_num_frames - num_frames_per_sbc_frame);
+        int i;
+        for (i = 0; i < num_frames_per_sbc_frame * num_channels; i++){
+            pcm_frame[i] = pcm_samples[(pos + (i / num_channels)) * pcm_num_channels + ((i % num_channels) % pcm_num_channels)];
+        }
+        btstack_sbc_encoder_instance_process_data(&state, pcm_frame);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+    return num_sbc_frames / seconds;
+}
+
+int main (int argc, const char * argv[]){
+    int benchmark = (argc > 1) && (strcmp(argv[1], "bench") == 0);
+    int errors = 0;
+    unsigned int i;
+    for (i = 0; i < sizeof(test_vectors) / sizeof(test_vectors[0]); i++){
+        const test_vector_t * vector = &test_vectors[i];
+        sbc_configuration_t config;
+        if (read_configuration(vector, &config) != 0 || read_wav_file(vector->wav_filename) != 0){
+            printf("Can't read %s / %s\n", vector->wav_filename, vector->sbc_filename);
+            return -1;
+        }
+        unsigned int j;
+        double c_frames_per_second = 0;
+        for (j = 0; j < NUM_IMPLEMENTATIONS; j++){
+            if (implementation_supported(implementations[j].impl) == 0) continue;
+            if (benchmark){
+                double frames_per_second = benchmark_vector(&config, implementations[j].impl);
+                if (implementations[j].impl == SBC_ANALYSIS_IMPL_C){
+                    c_frames_per_second = frames_per_second;
+                }
+                printf("%-4s: %2u blocks, %u subbands, channel mode %u: %9.0f frames/sec (%.2fx)\n",
+                       implementations[j].name, config.blocks, config.subbands, config.channel_mode,
+                       frames_per_second, frames_per_second / c_frames_per_second);
+            } else if (implementations[j].impl != SBC_ANALYSIS_IMPL_C){
+                if (test_vector(vector, &config, implementations[j].impl, implementations[j].name) != 0){
+                    errors++;
+                }
+            }
+        }
+        free(pcm_samples);
+    }
+    if (errors){
+        printf("%u test vectors failed\n", errors);
+        return 1;
+    }
+    printf("Done\n");
+    return 0;
+}
@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL MATTHIAS
+ * RINGWALD OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at 
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+
+// *****************************************************************************
+//
+// SDP Server micro-benchmark
+//
+// - registers SPP, Device ID and custom 128-bit service records
+// - runs ServiceSearch, ServiceAttribute and ServiceSearchAttribute requests
+//   incl. all continuation requests for a small and a large MTU
+// - reports time per operation and a checksum over all responses, which has to
+//   be identical with and without ENABLE_SDP_SERVER_INDEX
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bluetooth_sdp.h"
+#include "btstack_util.h"
+#include "classic/device_id_server.h"
+#include "classic/sdp_server.h"
+#include "classic/sdp_util.h"
+#include "classic/spp_server.h"
+#include "l2cap.h"
+
+#define NUM_SPP_SERVICES     50
+#define NUM_CUSTOM_SERVICES  8
+#define NUM_RECORDS          (NUM_SPP_SERVICES + NUM_CUSTOM_SERVICES + 1)
+#define NUM_ITERATIONS       200
+
+static uint8_t  records[NUM_RECORDS][200];
+static uint16_t num_records;
+static uint8_t  sdp_request[100];
+static uint32_t checksum;
+static uint16_t mtu;
+
+// not used
+uint8_t l2cap_register_service(btstack_packet_handler_t packet_handler, uint16_t psm, uint16_t mtu, gap_security_level_t security_level){
+    UNUSED(packet_handler);
+    UNUSED(psm);
+    UNUSED(mtu);
+    UNUSED(security_level);
+    return ERROR_CODE_SUCCESS;
+}
+void l2cap_accept_connection(uint16_t local_cid){
+    UNUSED(local_cid);
+}
+void l2cap_decline_connection(uint16_t local_cid){
+    UNUSED(local_cid);
+}
+uint16_t l2cap_get_remote_mtu_for_local_cid(uint16_t local_cid){
+    UNUSED(local_cid);
+    return 0;
+}
+uint8_t l2cap_request_can_send_now_event(uint16_t local_cid){
+    UNUSED(local_cid);
+    return ERROR_CODE_SUCCESS;
+}
+uint8_t l2cap_send(uint16_t local_cid, const uint8_t *data, uint16_t len){
+    UNUSED(local_cid);
+    UNUSED(data);
+    UNUSED(len);
+    return ERROR_CODE_SUCCESS;
+}
+
+static void create_custom_record(uint8_t * service, uint32_t service_record_handle, uint8_t index){
+    uint8_t uuid128[16];
+    uint8_t i;
+    for (i = 0; i < 16; i++){
+        uuid128[i] = (uint8_t) (0x10 * index + i);
+    }
+    de_create_sequence(service);
+    de_add_number(service, DE_UINT, DE_SIZE_16, BLUETOOTH_ATTRIBUTE_SERVICE_RECORD_HANDLE);
+    de_add_number(service, DE_UINT, DE_SIZE_32, service_record_handle);
+    de_add_number(service, DE_UINT, DE_SIZE_16, BLUETOOTH_ATTRIBUTE_SERVICE_CLASS_ID_LIST);
+    uint8_t * attribute = de_push_sequence(service);
+    {
+        de_add_uuid128(attribute, uuid128);
+    }
+    de_pop_sequence(service, attribute);
+    de_add_number(service, DE_UINT, DE_SIZE_16, BLUETOOTH_ATTRIBUTE_PROTOCOL_DESCRIPTOR_LIST);
+    attribute = de_push_sequence(service);
+    {
+        uint8_t * l2cap_protocol = de_push_sequence(attribute);
+        {
+            de_add_number(l2cap_protocol, DE_UUID, DE_SIZE_16, BLUETOOTH_PROTOCOL_L2CAP);
+            de_add_number(l2cap_protocol, DE_UINT, DE_SIZE_16, 0x1001 + 2 * index);
+        }
+        de_pop_sequence(attribute, l2cap_protocol);
+    }
+    de_pop_sequence(service, attribute);
+    de_add_number(service, DE_UINT, DE_SIZE_16, 0x0100);
+    de_add_data(service, DE_STRING, 14, (uint8_t *) "Custom Service");
+}
+
+static void setup_records(void){
+    uint32_t handle = 0x10001;
+    uint16_t i;
+    for (i = 0; i < NUM_SPP_SERVICES; i++){
+        char name[20];
+        snprintf(name, sizeof(name), "SPP Service %u", i);
+        spp_create_sdp_record(records[num_records++], handle++, (uint8_t) (1 + (i % 30)), name);
+    }
+    device_id_create_sdp_record(records[num_records++], handle++, DEVICE_ID_VENDOR_ID_SOURCE_BLUETOOTH, 0x48, 0x1234, 0x0100);
+    for (i = 0; i < NUM_CUSTOM_SERVICES; i++){
+        create_custom_record(records[num_records++], handle++, (uint8_t) i);
+    }
+    for (i = 0; i < num_records; i++){
+        sdp_register_service(records[i]);
+    }
+}
+
+static uint16_t create_pattern(uint8_t * buffer, uint16_t uuid16){
+    de_create_sequence(buffer);
+    de_add_number(buffer, DE_UUID, DE_SIZE_16, uuid16);
+    return de_get_len(buffer);
+}
+
+static uint16_t create_pattern_uuid128(uint8_t * buffer, uint8_t index){
+    uint8_t uuid128[16];
+    uint8_t i;
+    for (i = 0; i < 16; i++){
+        uuid128[i] = (uint8_t) (0x10 * index + i);
+    }
+    de_create_sequence(buffer);
+    de_add_uuid128(buffer, uuid128);
+    return de_get_len(buffer);
+}
+
+static uint16_t create_attribute_list(uint8_t * buffer, uint16_t attribute_id, uint16_t range_start, uint16_t range_end){
+    de_create_sequence(buffer);
+    de_add_number(buffer, DE_UINT, DE_SIZE_16, attribute_id);
+    de_add_number(buffer, DE_UINT, DE_SIZE_32, (((uint32_t) range_start) << 16) | range_end);
+    return de_get_len(buffer);
+}
+
+// executes request incl. all continuation requests, parameters are stored in sdp_request at offset 5
+static void request(sdp_pdu_id_t pdu_id, uint16_t params_len){
+    uint8_t continuation_len = 0;
+    sdp_request[5u + params_len] = 0;
+    while (true){
+        sdp_request[0] = (uint8_t) pdu_id;
+        big_endian_store_16(sdp_request, 1, 0x1234);
+        big_endian_store_16(sdp_request, 3, params_len + 1u + continuation_len);
+        int response_len = 0;
+        switch (pdu_id){
+            case SDP_ServiceSearchRequest:
+                response_len = sdp_handle_service_search_request(sdp_request, mtu);
+                break;
+            case SDP_ServiceAttributeRequest:
+                response_len = sdp_handle_service_attribute_request(sdp_request, mtu);
+                break;
+            case SDP_ServiceSearchAttributeRequest:
+                response_len = sdp_handle_service_search_attribute_request(sdp_request, mtu);
+                break;
+            default:
+                return;
+        }
+        if (response_len == 0) return;
+        const uint8_t * response = sdp_get_response_buffer();
+        int i;
+        for (i = 0; i < response_len; i++){
+            checksum = (checksum * 31u) + response[i];
+        }
+        // continuation state is last element in response
+        uint16_t continuation_pos;
+        if (pdu_id == SDP_ServiceSearchRequest){
+            continuation_pos = 9u + 4u * big_endian_read_16(response, 7);
+        } else {
+            continuation_pos = 7u + big_endian_read_16(response, 5);
+        }
+        continuation_len = response[continuation_pos];
+        memcpy(&sdp_request[5u + params_len], &response[continuation_pos], 1u + continuation_len);
+        if (continuation_len == 0u) break;
+    }
+}
+
+static uint16_t service_search_params(uint16_t pattern_len){
+    big_endian_store_16(sdp_request, 5u + pattern_len, 0xffff);
+    return pattern_len + 2u;
+}
+
+static uint16_t service_search_attribute_params(uint16_t pattern_len, uint16_t attribute_id, uint16_t range_start, uint16_t range_end){
+    big_endian_store_16(sdp_request, 5u + pattern_len, 0xffff);
+    uint16_t attribute_list_len = create_attribute_list(&sdp_request[5u + pattern_len + 2u], attribute_id, range_start, range_end);
+    return pattern_len + 2u + attribute_list_len;
+}
+
+static void bench_service_search(void){
+    request(SDP_ServiceSearchRequest, service_search_params(create_pattern(&sdp_request[5], BLUETOOTH_SERVICE_CLASS_SERIAL_PORT)));
+    request(SDP_ServiceSearchRequest, service_search_params(create_pattern(&sdp_request[5], BLUETOOTH_PROTOCOL_L2CAP)));
+    request(SDP_ServiceSearchRequest, service_search_params(create_pattern(&sdp_request[5], BLUETOOTH_SERVICE_CLASS_HANDSFREE)));
+    request(SDP_ServiceSearchRequest, service_search_params(create_pattern_uuid128(&sdp_request[5], NUM_CUSTOM_SERVICES - 1)));
+}
+
+static void bench_service_attribute(void){
+    uint16_t i;
+    for (i = 0; i < num_records; i++){
+        big_endian_store_32(sdp_request, 5, sdp_get_service_record_handle(records[i]));
+        big_endian_store_16(sdp_request, 9, 0xffff);
+        uint16_t attribute_list_len = create_attribute_list(&sdp_request[11], BLUETOOTH_ATTRIBUTE_SERVICE_CLASS_ID_LIST, 0x0004, 0x0004);
+        request(SDP_ServiceAttributeRequest, 6u + attribute_list_len);
+        attribute_list_len = create_attribute_list(&sdp_request[11], 0x0000, 0x0000, 0xffff);
+        request(SDP_ServiceAttributeRequest, 6u + attribute_list_len);
+    }
+}
+
+static void bench_service_search_attribute_all(void){
+    request(SDP_ServiceSearchAttributeRequest, service_search_attribute_params(create_pattern(&sdp_request[5], BLUETOOTH_PROTOCOL_L2CAP), 0x0000, 0x0000, 0xffff));
+}
+
+static void bench_service_search_attribute_some(void){
+    request(SDP_ServiceSearchAttributeRequest, service_search_attribute_params(create_pattern(&sdp_request[5], BLUETOOTH_SERVICE_CLASS_SERIAL_PORT), BLUETOOTH_ATTRIBUTE_PROTOCOL_DESCRIPTOR_LIST, 0x0100, 0x0100));
+    request(SDP_ServiceSearchAttributeRequest, service_search_attribute_params(create_pattern(&sdp_request[5], BLUETOOTH_SERVICE_CLASS_PNP_INFORMATION), 0x0000, 0x0200, 0x0205));
+    request(SDP_ServiceSearchAttributeRequest, service_search_attribute_params(create_pattern_uuid128(&sdp_request[5], 3), 0x0000, 0x0004, 0x0004));
+}
+
+typedef struct {
+    const char * name;
+    void (*function)(void);
+} bench_t;
+
+static const bench_t benchmarks[] = {
+    { "search",              &bench_service_search },
+    { "attribute",           &bench_service_attribute },
+    { "search attribute all",  &bench_service_search_attribute_all },
+    { "search attribute some", &bench_service_search_attribute_some },
+};
+
+static const uint16_t mtus[] = { 48, 672 };
+
+static double time_ms(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec * 1000.0) + (ts.tv_nsec / 1000000.0);
+}
+
+int main(void){
+
+    setup_records();
+#ifdef ENABLE_SDP_SERVER_INDEX
+    printf("SDP Server with index, %u records\n", num_records);
+#else
+    printf("SDP Server without index, %u records\n", num_records);
+#endif
+
+    unsigned int m;
+    for (m = 0; m < sizeof(mtus) / sizeof(uint16_t); m++){
+        mtu = mtus[m];
+        printf("MTU %u\n", mtu);
+        unsigned int i;
+        for (i = 0; i < sizeof(benchmarks) / sizeof(bench_t); i++){
+            checksum = 0;
+            double start = time_ms();
+            int iteration;
+            for (iteration = 0; iteration < NUM_ITERATIONS; iteration++){
+                (*benchmarks[i].function)();
+            }
+            double duration = time_ms() - start;
+            printf("%-22s %8.3f ms, checksum %08x\n", benchmarks[i].name, duration / NUM_ITERATIONS, checksum);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,433 @@
+// *****************************************************************************
+//
+// test SDP Server responses against sdp_util reference, with and without ENABLE_SDP_SERVER_INDEX
+//
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "bluetooth_sdp.h"
+#include "btstack_util.h"
+#include "classic/a2dp_source.h"
+#include "classic/avrcp_target.h"
+#include "classic/device_id_server.h"
+#include "classic/hfp_hf.h"
+#include "classic/hsp_ag.h"
+#include "classic/sdp_server.h"
+#include "classic/sdp_util.h"
+#include "classic/spp_server.h"
+
+#define NUM_SPP_SERVICES 40
+#define NUM_RECORDS (NUM_SPP_SERVICES + 8)
+
+static uint8_t  records[NUM_RECORDS][400];
+static uint16_t num_records;
+
+static const uint8_t custom_uuid128[] = { 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0, 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0 };
+
+static uint8_t  request[300];
+static uint16_t response_len;
+
+static void create_custom_record(uint8_t * service, uint32_t service_record_handle, uint16_t num_attributes){
+    de_create_sequence(service);
+    de_add_number(service, DE_UINT, DE_SIZE_16, BLUETOOTH_ATTRIBUTE_SERVICE_RECORD_HANDLE);
+    de_add_number(service, DE_UINT, DE_SIZE_32, service_record_handle);
+    de_add_number(service, DE_UINT, DE_SIZE_16, BLUETOOTH_ATTRIBUTE_SERVICE_CLASS_ID_LIST);
+    uint8_t * attribute = de_push_sequence(service);
+    {
+        de_add_uuid128(attribute, (uint8_t *) custom_uuid128);
+        de_add_number(attribute, DE_UUID, DE_SIZE_16, BLUETOOTH_SERVICE_CLASS_SERIAL_PORT);
+    }
+    de_pop_sequence(service, attribute);
+    uint16_t i;
+    for (i = 0; i < num_attributes; i++){
+        de_add_number(service, DE_UINT, DE_SIZE_16, 0x0200 + i);
+        de_add_number(service, DE_UINT, DE_SIZE_32, i);
+    }
+}
+
+static void register_record(void){
+    CHECK_EQUAL(ERROR_CODE_SUCCESS, sdp_register_service(records[num_records]));
+    num_records++;
+}
+
+static void create_database(void){
+    uint32_t handle = 0x10001;
+    uint16_t i;
+    for (i = 0; i < NUM_SPP_SERVICES; i++){
+        char name[20];
+        snprintf(name, sizeof(name), "SPP %u", i);
+        spp_create_sdp_record(records[num_records], handle++, 1 + (i % 30), name);
+        register_record();
+    }
+    a2dp_source_create_sdp_record(records[num_records], handle++, 0, "A2DP Source", "BlueKitchen");
+    register_record();
+    avrcp_target_create_sdp_record(records[num_records], handle++, 0, "AVRCP Target", "BlueKitchen");
+    register_record();
+    hfp_hf_create_sdp_record(records[num_records], handle++, 2, "HFP HF", 0, 1);
+    register_record();
+    hsp_ag_create_sdp_record(records[num_records], handle++, 3, "HSP AG");
+    register_record();
+    device_id_create_sdp_record(records[num_records], handle++, DEVICE_ID_VENDOR_ID_SOURCE_BLUETOOTH, 0x48, 0x1234, 0x0100);
+    register_record();
+    create_custom_record(records[num_records], handle++, 2);
+    register_record();
+    // more attributes than index supports
+    create_custom_record(records[num_records], handle++, 40);
+    register_record();
+    create_custom_record(records[num_records], handle++, 0);
+    register_record();
+}
+
+static uint16_t create_uuid16_pattern(uint8_t * buffer, const uint16_t * uuids, uint16_t num_uuids){
+    de_create_sequence(buffer);
+    uint16_t i;
+    for (i = 0; i < num_uuids; i++){
+        de_add_number(buffer, DE_UUID, DE_SIZE_16, uuids[i]);
+    }
+    return de_get_len(buffer);
+}
+
+static uint16_t create_uuid128_pattern(uint8_t * buffer, const uint8_t * uuid128){
+    de_create_sequence(buffer);
+    de_add_uuid128(buffer, (uint8_t *) uuid128);
+    return de_get_len(buffer);
+}
+
+static uint16_t create_attribute_list(uint8_t * buffer, uint16_t single_id, uint16_t range_start, uint16_t range_end){
+    de_create_sequence(buffer);
+    de_add_number(buffer, DE_UINT, DE_SIZE_16, single_id);
+    de_add_number(buffer, DE_UINT, DE_SIZE_32, (((uint32_t) range_start) << 16) | range_end);
+    return de_get_len(buffer);
+}
+
+static void execute(uint16_t param_len, uint16_t mtu){
+    big_endian_store_16(request, 1, 0x1234);
+    big_endian_store_16(request, 3, param_len);
+    int len = 0;
+    switch (request[0]){
+        case SDP_ServiceSearchRequest:
+            len = sdp_handle_service_search_request(request, mtu);
+            break;
+        case SDP_ServiceAttributeRequest:
+            len = sdp_handle_service_attribute_request(request, mtu);
+            break;
+        case SDP_ServiceSearchAttributeRequest:
+            len = sdp_handle_service_search_attribute_request(request, mtu);
+            break;
+        default:
+            break;
+    }
+    CHECK_TRUE(len > 0);
+    CHECK_TRUE(len <= mtu);
+    response_len = (uint16_t) len;
+    CHECK_EQUAL((uint16_t) (response_len - 5), big_endian_read_16(sdp_get_response_buffer(), 3));
+}
+
+// get matching record handles from reference
+static uint16_t reference_search(const uint8_t * pattern, uint32_t * handles){
+    uint16_t num_handles = 0;
+    uint16_t i;
+    // records are served in reverse registration order
+    for (i = num_records; i > 0; i--){
+        if (sdp_record_matches_service_search_pattern(records[i-1], (uint8_t *) pattern)){
+            handles[num_handles++] = sdp_get_service_record_handle(records[i-1]);
+        }
+    }
+    return num_handles;
+}
+
+static uint16_t reference_attributes(uint8_t * record, const uint8_t * attribute_list, uint8_t * buffer){
+    uint16_t size = spd_get_filtered_size(record, (uint8_t *) attribute_list);
+    de_store_descriptor_with_len(buffer, DE_DES, DE_SIZE_VAR_16, size);
+    uint16_t used_bytes;
+    int complete = sdp_filter_attributes_in_attributeIDList(record, (uint8_t *) attribute_list, 0, 0xffff, &used_bytes, &buffer[3]);
+    CHECK_TRUE(complete);
+    CHECK_EQUAL(size, used_bytes);
+    return 3 + size;
+}
+
+// reassemble handles over continuation requests
+static uint16_t service_search(const uint8_t * pattern, uint16_t pattern_len, uint16_t max_count, uint16_t mtu, uint32_t * handles){
+    uint8_t continuation[17] = { 0 };
+    uint16_t num_handles = 0;
+    uint16_t num_requests = 0;
+    while (true){
+        request[0] = SDP_ServiceSearchRequest;
+        uint16_t pos = 5;
+        memcpy(&request[pos], pattern, pattern_len);
+        pos += pattern_len;
+        big_endian_store_16(request, pos, max_count);
+        pos += 2;
+        memcpy(&request[pos], continuation, 1 + continuation[0]);
+        pos += 1 + continuation[0];
+        execute(pos - 5, mtu);
+        num_requests++;
+        const uint8_t * buffer = sdp_get_response_buffer();
+        CHECK_EQUAL(SDP_ServiceSearchResponse, buffer[0]);
+        uint16_t current_count = big_endian_read_16(buffer, 7);
+        uint16_t i;
+        for (i = 0; i < current_count; i++){
+            handles[num_handles++] = big_endian_read_32(buffer, 9 + 4 * i);
+        }
+        uint16_t continuation_pos = 9 + 4 * current_count;
+        memcpy(continuation, &buffer[continuation_pos], 1 + buffer[continuation_pos]);
+        if (continuation[0] == 0) break;
+        CHECK_TRUE(num_requests < 100);
+    }
+    return num_handles;
+}
+
+// reassemble AttributeLists over continuation requests
+static uint16_t service_search_attribute(const uint8_t * pattern, uint16_t pattern_len, const uint8_t * attribute_list, uint16_t attribute_list_len,
+                                         uint16_t mtu, uint8_t * attribute_lists, uint16_t * num_requests){
+    uint8_t continuation[17] = { 0 };
+    uint16_t attribute_lists_len = 0;
+    *num_requests = 0;
+    while (true){
+        request[0] = SDP_ServiceSearchAttributeRequest;
+        uint16_t pos = 5;
+        memcpy(&request[pos], pattern, pattern_len);
+        pos += pattern_len;
+        big_endian_store_16(request, pos, 0xffff);
+        pos += 2;
+        memcpy(&request[pos], attribute_list, attribute_list_len);
+        pos += attribute_list_len;
+        memcpy(&request[pos], continuation, 1 + continuation[0]);
+        pos += 1 + continuation[0];
+        execute(pos - 5, mtu);
+        (*num_requests)++;
+        const uint8_t * buffer = sdp_get_response_buffer();
+        CHECK_EQUAL(SDP_ServiceSearchAttributeResponse, buffer[0]);
+        uint16_t byte_count = big_endian_read_16(buffer, 5);
+        memcpy(&attribute_lists[attribute_lists_len], &buffer[7], byte_count);
+        attribute_lists_len += byte_count;
+        uint16_t continuation_pos = 7 + byte_count;
+        memcpy(continuation, &buffer[continuation_pos], 1 + buffer[continuation_pos]);
+        if (continuation[0] == 0) break;
+        CHECK_TRUE(*num_requests < 1000);
+    }
+    return attribute_lists_len;
+}
+
+static uint16_t service_attribute(uint32_t handle, const uint8_t * attribute_list, uint16_t attribute_list_len, uint16_t mtu, uint8_t * attribute_list_out){
+    uint8_t continuation[17] = { 0 };
+    uint16_t len = 0;
+    uint16_t num_requests = 0;
+    while (true){
+        request[0] = SDP_ServiceAttributeRequest;
+        uint16_t pos = 5;
+        big_endian_store_32(request, pos, handle);
+        pos += 4;
+        big_endian_store_16(request, pos, 0xffff);
+        pos += 2;
+        memcpy(&request[pos], attribute_list, attribute_list_len);
+        pos += attribute_list_len;
+        memcpy(&request[pos], continuation, 1 + continuation[0]);
+        pos += 1 + continuation[0];
+        execute(pos - 5, mtu);
+        num_requests++;
+        const uint8_t * buffer = sdp_get_response_buffer();
+        CHECK_EQUAL(SDP_ServiceAttributeResponse, buffer[0]);
+        uint16_t byte_count = big_endian_read_16(buffer, 5);
+        memcpy(&attribute_list_out[len], &buffer[7], byte_count);
+        len += byte_count;
+        uint16_t continuation_pos = 7 + byte_count;
+        memcpy(continuation, &buffer[continuation_pos], 1 + buffer[continuation_pos]);
+        if (continuation[0] == 0) break;
+        CHECK_TRUE(num_requests < 1000);
+    }
+    return len;
+}
+static uint16_t reference_search_attributes(const uint8_t * pattern, const uint8_t * attribute_list, uint8_t * buffer){
+    uint16_t pos = 3;
+    uint16_t i;
+    for (i = num_records; i > 0; i--){
+        if (sdp_record_matches_service_search_pattern(records[i-1], (uint8_t *) pattern)){
+            pos += reference_attributes(records[i-1], attribute_list, &buffer[pos]);
+        }
+    }
+    de_store_descriptor_with_len(buffer, DE_DES, DE_SIZE_VAR_16, pos - 3);
+    return pos;
+}
+
+static const uint16_t test_mtus[] = { 48, 100, 672 };
+static const uint16_t num_test_mtus = sizeof(test_mtus) / sizeof(uint16_t);
+
+TEST_GROUP(SDPServer){
+    uint8_t pattern[100];
+    uint8_t attribute_list[20];
+    uint8_t expected[12000];
+    uint8_t actual[12000];
+
+    void setup(void){
+        num_records = 0;
+        create_database();
+    }
+    void teardown(void){
+        uint16_t i;
+        for (i = 0; i < num_records; i++){
+            sdp_unregister_service(sdp_get_service_record_handle(records[i]));
+        }
+        sdp_deinit();
+    }
+
+    void check_service_search(uint16_t pattern_len, uint16_t max_count){
+        uint32_t expected_handles[NUM_RECORDS];
+        uint32_t actual_handles[NUM_RECORDS];
+        uint16_t num_expected = reference_search(pattern, expected_handles);
+        if (num_expected > max_count){
+            num_expected = max_count;
+        }
+        uint16_t m;
+        for (m = 0; m < num_test_mtus; m++){
+            uint16_t num_actual = service_search(pattern, pattern_len, max_count, test_mtus[m], actual_handles);
+            CHECK_EQUAL(num_expected, num_actual);
+            MEMCMP_EQUAL(expected_handles, actual_handles, num_expected * sizeof(uint32_t));
+        }
+    }
+
+    void check_service_search_attribute(uint16_t pattern_len, uint16_t attribute_list_len){
+        uint16_t expected_len = reference_search_attributes(pattern, attribute_list, expected);
+        uint16_t m;
+        for (m = 0; m < num_test_mtus; m++){
+            uint16_t num_requests;
+            uint16_t actual_len = service_search_attribute(pattern, pattern_len, attribute_list, attribute_list_len, test_mtus[m], actual, &num_requests);
+            CHECK_EQUAL(expected_len, actual_len);
+            MEMCMP_EQUAL(expected, actual, expected_len);
+        }
+    }
+};
+
+TEST(SDPServer, ServiceSearch){
+    const uint16_t spp[]        = { BLUETOOTH_SERVICE_CLASS_SERIAL_PORT };
+    const uint16_t l2cap[]      = { BLUETOOTH_PROTOCOL_L2CAP };
+    const uint16_t a2dp[]       = { BLUETOOTH_PROTOCOL_L2CAP, BLUETOOTH_SERVICE_CLASS_AUDIO_SOURCE };
+    const uint16_t rfcomm_hf[]  = { BLUETOOTH_PROTOCOL_RFCOMM, BLUETOOTH_SERVICE_CLASS_HANDSFREE };
+    const uint16_t unknown[]    = { 0x9999 };
+    const uint16_t none[]       = { BLUETOOTH_PROTOCOL_RFCOMM, 0x9999 };
+    check_service_search(create_uuid16_pattern(pattern, spp, 1), 0xffff);
+    check_service_search(create_uuid16_pattern(pattern, spp, 1), 5);
+    check_service_search(create_uuid16_pattern(pattern, l2cap, 1), 0xffff);
+    check_service_search(create_uuid16_pattern(pattern, a2dp, 2), 0xffff);
+    check_service_search(create_uuid16_pattern(pattern, rfcomm_hf, 2), 0xffff);
+    check_service_search(create_uuid16_pattern(pattern, unknown, 1), 0xffff);
+    check_service_search(create_uuid16_pattern(pattern, none, 2), 0xffff);
+}
+
+TEST(SDPServer, ServiceSearchUUID128){
+    uint8_t spp_uuid128[16];
+    uuid_add_bluetooth_prefix(spp_uuid128, BLUETOOTH_SERVICE_CLASS_SERIAL_PORT);
+    check_service_search(create_uuid128_pattern(pattern, spp_uuid128), 0xffff);
+    check_service_search(create_uuid128_pattern(pattern, custom_uuid128), 0xffff);
+    uint8_t unknown_uuid128[16];
+    memcpy(unknown_uuid128, custom_uuid128, 16);
+    unknown_uuid128[15] ^= 0xff;
+    check_service_search(create_uuid128_pattern(pattern, unknown_uuid128), 0xffff);
+}
+
+TEST(SDPServer, ServiceSearchAttribute){
+    const uint16_t spp[]    = { BLUETOOTH_SERVICE_CLASS_SERIAL_PORT };
+    const uint16_t l2cap[]  = { BLUETOOTH_PROTOCOL_L2CAP };
+    const uint16_t hsp[]    = { BLUETOOTH_SERVICE_CLASS_HEADSET_AUDIO_GATEWAY_AG };
+    const uint16_t unknown[] = { 0x9999 };
+    uint16_t pattern_len = create_uuid16_pattern(pattern, spp, 1);
+    check_service_search_attribute(pattern_len, create_attribute_list(attribute_list, 0x0000, 0x0000, 0xffff));
+    check_service_search_attribute(pattern_len, create_attribute_list(attribute_list, 0x0001, 0x0004, 0x0009));
+    check_service_search_attribute(pattern_len, create_attribute_list(attribute_list, 0x0100, 0x0205, 0x0220));
+    pattern_len = create_uuid16_pattern(pattern, l2cap, 1);
+    check_service_search_attribute(pattern_len, create_attribute_list(attribute_list, 0x0000, 0x0000, 0xffff));
+    check_service_search_attribute(pattern_len, create_attribute_list(attribute_list, 0x0004, 0x0100, 0x0100));
+    pattern_len = create_uuid16_pattern(pattern, hsp, 1);
+    check_service_search_attribute(pattern_len, create_attribute_list(attribute_list, 0x0000, 0x0000, 0xffff));
+    pattern_len = create_uuid16_pattern(pattern, unknown, 1);
+    check_service_search_attribute(pattern_len, create_attribute_list(attribute_list, 0x0000, 0x0000, 0xffff));
+    pattern_len = create_uuid128_pattern(pattern, custom_uuid128);
+    check_service_search_attribute(pattern_len, create_attribute_list(attribute_list, 0x0000, 0x0000, 0xffff));
+    check_service_search_attribute(pattern_len, create_attribute_list(attribute_list, 0x0001, 0x0210, 0x0227));
+}
+
+TEST(SDPServer, ServiceAttribute){
+    uint16_t attribute_list_len[3];
+    uint8_t  attribute_lists[3][20];
+    attribute_list_len[0] = create_attribute_list(attribute_lists[0], 0x0000, 0x0000, 0xffff);
+    attribute_list_len[1] = create_attribute_list(attribute_lists[1], 0x0001, 0x0004, 0x0009);
+    attribute_list_len[2] = create_attribute_list(attribute_lists[2], 0x0100, 0x0205, 0x0220);
+    uint16_t i;
+    for (i = 0; i < num_records; i++){
+        uint32_t handle = sdp_get_service_record_handle(records[i]);
+        uint16_t l;
+        for (l = 0; l < 3; l++){
+            uint16_t expected_len = reference_attributes(records[i], attribute_lists[l], expected);
+            uint16_t m;
+            for (m = 0; m < num_test_mtus; m++){
+                uint16_t actual_len = service_attribute(handle, attribute_lists[l], attribute_list_len[l], test_mtus[m], actual);
+                CHECK_EQUAL(expected_len, actual_len);
+                MEMCMP_EQUAL(expected, actual, expected_len);
+            }
+        }
+    }
+}
+
+TEST(SDPServer, ServiceSearchAttributeInterleaved){
+    // start request for SPP records, then handle a different request before continuing
+    const uint16_t spp[]   = { BLUETOOTH_SERVICE_CLASS_SERIAL_PORT };
+    const uint16_t l2cap[] = { BLUETOOTH_PROTOCOL_L2CAP };
+    uint16_t pattern_len = create_uuid16_pattern(pattern, spp, 1);
+    uint16_t attribute_list_len = create_attribute_list(attribute_list, 0x0000, 0x0000, 0xffff);
+    uint16_t expected_len = reference_search_attributes(pattern, attribute_list, expected);
+
+    request[0] = SDP_ServiceSearchAttributeRequest;
+    uint16_t pos = 5;
+    memcpy(&request[pos], pattern, pattern_len);
+    pos += pattern_len;
+    big_endian_store_16(request, pos, 0xffff);
+    pos += 2;
+    memcpy(&request[pos], attribute_list, attribute_list_len);
+    pos += attribute_list_len;
+    request[pos++] = 0;
+    execute(pos - 5, 100);
+    const uint8_t * buffer = sdp_get_response_buffer();
+    uint16_t byte_count = big_endian_read_16(buffer, 5);
+    uint16_t actual_len = byte_count;
+    memcpy(actual, &buffer[7], byte_count);
+    uint8_t continuation[17];
+    memcpy(continuation, &buffer[7 + byte_count], 1 + buffer[7 + byte_count]);
+    CHECK_TRUE(continuation[0] > 0);
+
+    // other request
+    uint8_t other_pattern[20];
+    uint8_t other_lists[12000];
+    uint16_t num_requests;
+    uint16_t other_pattern_len = create_uuid16_pattern(other_pattern, l2cap, 1);
+    service_search_attribute(other_pattern, other_pattern_len, attribute_list, attribute_list_len, 100, other_lists, &num_requests);
+
+    // continue first request
+    while (continuation[0] != 0){
+        pos = 5 + pattern_len + 2 + attribute_list_len;
+        memcpy(&request[5], pattern, pattern_len);
+        big_endian_store_16(request, 5 + pattern_len, 0xffff);
+        memcpy(&request[5 + pattern_len + 2], attribute_list, attribute_list_len);
+        memcpy(&request[pos], continuation, 1 + continuation[0]);
+        pos += 1 + continuation[0];
+        request[0] = SDP_ServiceSearchAttributeRequest;
+        execute(pos - 5, 100);
+        buffer = sdp_get_response_buffer();
+        byte_count = big_endian_read_16(buffer, 5);
+        memcpy(&actual[actual_len], &buffer[7], byte_count);
+        actual_len += byte_count;
+        memcpy(continuation, &buffer[7 + byte_count], 1 + buffer[7 + byte_count]);
+    }
+    CHECK_EQUAL(expected_len, actual_len);
+    MEMCMP_EQUAL(expected, actual, expected_len);
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
@@ -25,6 +25,8 @@
 #include "hci_dump_posix_fs.h"
 #include "l2cap.h"
 #include "ble/sm.h"
+#include "ble/le_device_db.h"
+#include "btstack_event.h"
 
 uint8_t test_command_packet_sc_read_public_key[] = { 0x25, 0x20, 0x00 };
 
@@ -122,6 +124,9 @@ extern "C" {
     void mock_clear_packet_buffer(void);
 }
 
+static int identity_resolving_index;
+static int identity_resolving_failed;
+
 void app_packet_handler (uint8_t packet_type, uint16_t channel, uint8_t *packet, uint16_t size){
     uint16_t aHandle;
     bd_addr_t event_address;
@@ -153,6 +158,14 @@ void app_packet_handler (uint8_t packet_type, uint16_t channel, uint8_t *packet,
                     sm_authorization_grant(little_endian_read_16(packet, 2));
                     break;
 
+                case SM_EVENT_IDENTITY_RESOLVING_SUCCEEDED:
+                    identity_resolving_index = sm_event_identity_resolving_succeeded_get_index(packet);
+                    break;
+
+                case SM_EVENT_IDENTITY_RESOLVING_FAILED:
+                    identity_resolving_failed++;
+                    break;
+
                 default:
                     break;
             }
@@ -412,6 +425,76 @@ TEST(SecurityManager, MainTest){
     CHECK_ACL_PACKET(test_acl_packet_22);
 }
 
+// Core 5.3, Vol 3, Part H, D.7: ah random address hash function
+static const char * ah_irk_string = "ec0234a3 57c8ad05 341010a6 0a397d9b";
+static bd_addr_t ah_rpa = { 0x70, 0x81, 0x94, 0x0d, 0xfb, 0xaa };
+
+TEST(SecurityManager, AddressResolution){
+    mock_init();
+    mock_simulate_hci_state_working();
+
+#ifdef ENABLE_MICRO_ECC_FOR_LE_SECURE_CONNECTIONS
+    // provide random data for ECC Key generation, which blocks crypto engine otherwise
+    int j;
+    for (j=0;j<8;j++){
+        uint8_t rand_sc_1_data_event[] = { 0x0e, 0x0c, 0x01, 0x18, 0x20, 0x00, 0x2f, 0x04, 0x82, 0x84, 0x72, 0x46, 0x9c, 0x93 };
+        mock_simulate_hci_event(&rand_sc_1_data_event[0], sizeof(rand_sc_1_data_event));
+    }
+#endif
+    btstack_run_loop_embedded_execute_once();
+
+    // bonded devices with different IRKs, matching device is last
+    int i;
+    for (i = 0; i < 3; i++){
+        sm_key_t irk;
+        bd_addr_t identity_address = { 0xc0, 0x11, 0x22, 0x33, 0x44, (uint8_t) i };
+        memset(irk, 0x11 * (i + 1), 16);
+        if (i == 2){
+            parse_hex(irk, ah_irk_string);
+        }
+        CHECK_EQUAL(i, le_device_db_add(BD_ADDR_TYPE_LE_RANDOM, identity_address, irk));
+    }
+
+    sm_address_resolution_statistics_t statistics;
+    sm_address_resolution_reset_statistics();
+    identity_resolving_index = -1;
+    identity_resolving_failed = 0;
+
+    // resolve with all IRKs
+    CHECK_EQUAL(0, sm_address_resolution_lookup(BD_ADDR_TYPE_LE_RANDOM, ah_rpa));
+    btstack_run_loop_embedded_execute_once();
+    CHECK_EQUAL(2, identity_resolving_index);
+    sm_address_resolution_get_statistics(&statistics);
+    CHECK_EQUAL(1, statistics.lookups);
+    CHECK_EQUAL(1, statistics.resolved);
+    CHECK_EQUAL(0, statistics.cache_hits);
+#ifdef ENABLE_SOFTWARE_AES128
+    CHECK_EQUAL(3, statistics.ah_calculations);
+#endif
+
+    // resolved address is cached
+    identity_resolving_index = -1;
+    CHECK_EQUAL(0, sm_address_resolution_lookup(BD_ADDR_TYPE_LE_RANDOM, ah_rpa));
+    btstack_run_loop_embedded_execute_once();
+    CHECK_EQUAL(2, identity_resolving_index);
+    sm_address_resolution_get_statistics(&statistics);
+    CHECK_EQUAL(2, statistics.resolved);
+    CHECK_EQUAL(1, statistics.cache_hits);
+#ifdef ENABLE_SOFTWARE_AES128
+    CHECK_EQUAL(4, statistics.ah_calculations);
+#endif
+
+    // cached device was removed
+    le_device_db_remove(2);
+    CHECK_EQUAL(0, sm_address_resolution_lookup(BD_ADDR_TYPE_LE_RANDOM, ah_rpa));
+    btstack_run_loop_embedded_execute_once();
+    CHECK_EQUAL(1, identity_resolving_failed);
+    sm_address_resolution_get_statistics(&statistics);
+    CHECK_EQUAL(3, statistics.lookups);
+    CHECK_EQUAL(2, statistics.resolved);
+    CHECK_EQUAL(1, statistics.cache_hits);
+}
+
 int main (int argc, const char * argv[]){
     // log into file using HCI_DUMP_PACKETLOGGER format
     const char * log_path = "hci_dump.pklg";
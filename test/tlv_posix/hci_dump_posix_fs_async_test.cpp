@@ -0,0 +1,194 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTest/CommandLineTestRunner.h"
+
+#include "hci_dump.h"
+#include "hci_dump_posix_fs.h"
+#include "hci_dump_posix_fs_async.h"
+#include "btstack_util.h"
+#include "btstack_config.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TEST_LOG       "/tmp/hci_dump_async_test.log"
+#define TEST_LOG_SYNC  "/tmp/hci_dump_async_test_sync.log"
+#define TEST_LOG_1     TEST_LOG ".1"
+#define TEST_LOG_2     TEST_LOG ".2"
+
+#define BTSNOOP_FILE_HEADER_SIZE 16
+#define MAX_FILE_SIZE (64 * 1024)
+
+static uint8_t file_buffer[MAX_FILE_SIZE];
+static uint8_t file_buffer_sync[MAX_FILE_SIZE];
+
+static size_t read_file(const char * path, uint8_t * buffer, size_t size){
+    FILE * file = fopen(path, "rb");
+    if (file == NULL) return 0;
+    size_t len = fread(buffer, 1, size, file);
+    fclose(file);
+    return len;
+}
+
+// packet i has length 3 + (i % 37) and is filled with i
+static void log_test_packets(uint16_t num_packets){
+    uint8_t packet[40];
+    uint16_t i;
+    for (i = 0; i < num_packets; i++){
+        uint8_t  value = (uint8_t) i;
+        uint16_t len = 3 + (value % 37);
+        memset(packet, value, len);
+        uint8_t packet_type = (value & 1) ? HCI_EVENT_PACKET : HCI_ACL_DATA_PACKET;
+        hci_dump_packet(packet_type, value & 1, packet, len);
+    }
+}
+
+// verifies BTSnoop file with consecutive packets logged by log_test_packets, returns number of packets
+static uint16_t check_btsnoop_records(const uint8_t * buffer, size_t len, uint8_t * first_value){
+    if (len < BTSNOOP_FILE_HEADER_SIZE) return 0;
+    if (memcmp(buffer, "btsnoop", 8) != 0) return 0;
+    uint16_t num_packets = 0;
+    size_t pos = BTSNOOP_FILE_HEADER_SIZE;
+    uint8_t value = 0;
+    while ((pos + HCI_DUMP_HEADER_SIZE_BTSNOOP + 2) <= len){
+        uint32_t original_len = big_endian_read_32(buffer, pos);
+        uint32_t included_len = big_endian_read_32(buffer, pos + 4);
+        uint32_t dropped      = big_endian_read_32(buffer, pos + 12);
+        if (original_len != included_len) return 0;
+        if (dropped != 0) return 0;
+        pos += HCI_DUMP_HEADER_SIZE_BTSNOOP;
+        if (num_packets == 0){
+            value = buffer[pos + 1];
+            *first_value = value;
+        }
+        uint8_t packet_type = (value & 1) ? HCI_EVENT_PACKET : HCI_ACL_DATA_PACKET;
+        if (included_len != (uint32_t) (4 + (value % 37))) return 0;
+        if (buffer[pos] != packet_type) return 0;
+        if (buffer[pos + 1] != value) return 0;
+        if (buffer[pos + included_len - 1] != value) return 0;
+        pos += included_len;
+        num_packets++;
+        value++;
+    }
+    if (pos != len) return 0;
+    return num_packets;
+}
+
+TEST_GROUP(HCI_DUMP_POSIX_FS_ASYNC){
+    void setup(void){
+        unlink(TEST_LOG);
+        unlink(TEST_LOG_1);
+        unlink(TEST_LOG_2);
+        unlink(TEST_LOG_SYNC);
+        // log messages would be logged as packets
+        hci_dump_enable_log_level(HCI_DUMP_LOG_LEVEL_DEBUG, 0);
+        hci_dump_enable_log_level(HCI_DUMP_LOG_LEVEL_INFO, 0);
+        hci_dump_enable_log_level(HCI_DUMP_LOG_LEVEL_ERROR, 0);
+        hci_dump_posix_fs_async_set_max_file_size(0, 0);
+    }
+    void teardown(void){
+        hci_dump_posix_fs_async_close();
+        hci_dump_init(NULL);
+    }
+};
+
+TEST(HCI_DUMP_POSIX_FS_ASYNC, BTSnoop){
+    CHECK_EQUAL(0, hci_dump_posix_fs_async_open(TEST_LOG, HCI_DUMP_BTSNOOP));
+    hci_dump_init(hci_dump_posix_fs_async_get_instance());
+    log_test_packets(500);
+    hci_dump_posix_fs_async_close();
+    CHECK_EQUAL(0, hci_dump_posix_fs_async_get_dropped_packets());
+    size_t len = read_file(TEST_LOG, file_buffer, sizeof(file_buffer));
+    uint8_t first_value;
+    CHECK_EQUAL(500, check_btsnoop_records(file_buffer, len, &first_value));
+    CHECK_EQUAL(0, first_value);
+}
+
+TEST(HCI_DUMP_POSIX_FS_ASYNC, RecordLenTooLarge){
+    static uint8_t large_packet[0xffff];
+    CHECK_EQUAL(0, hci_dump_posix_fs_async_open(TEST_LOG, HCI_DUMP_BTSNOOP));
+    hci_dump_init(hci_dump_posix_fs_async_get_instance());
+    // record length 0xffff and 0x10000 collide with padding and reset marker
+    uint16_t record_header_len = HCI_DUMP_HEADER_SIZE_BTSNOOP + 1;
+    hci_dump_packet(HCI_ACL_DATA_PACKET, 0, large_packet, 0xffff - record_header_len);
+    hci_dump_packet(HCI_ACL_DATA_PACKET, 0, large_packet, 0x10000 - record_header_len);
+    log_test_packets(10);
+    hci_dump_posix_fs_async_close();
+    CHECK_EQUAL(2, hci_dump_posix_fs_async_get_dropped_packets());
+    size_t expected_len = BTSNOOP_FILE_HEADER_SIZE;
+    uint16_t i;
+    for (i = 0; i < 10; i++){
+        expected_len += HCI_DUMP_HEADER_SIZE_BTSNOOP + 4 + (i % 37);
+    }
+    size_t len = read_file(TEST_LOG, file_buffer, sizeof(file_buffer));
+    CHECK_EQUAL(expected_len, len);
+    CHECK_EQUAL(0, file_buffer[BTSNOOP_FILE_HEADER_SIZE + HCI_DUMP_HEADER_SIZE_BTSNOOP + 1]);
+}
+
+TEST(HCI_DUMP_POSIX_FS_ASYNC, PacketLoggerMatchesSync){
+    CHECK_EQUAL(0, hci_dump_posix_fs_open(TEST_LOG_SYNC, HCI_DUMP_PACKETLOGGER));
+    hci_dump_init(hci_dump_posix_fs_get_instance());
+    log_test_packets(100);
+    hci_dump_posix_fs_close();
+
+    CHECK_EQUAL(0, hci_dump_posix_fs_async_open(TEST_LOG, HCI_DUMP_PACKETLOGGER));
+    hci_dump_init(hci_dump_posix_fs_async_get_instance());
+    log_test_packets(100);
+    hci_dump_posix_fs_async_close();
+
+    size_t len_sync = read_file(TEST_LOG_SYNC, file_buffer_sync, sizeof(file_buffer_sync));
+    size_t len      = read_file(TEST_LOG, file_buffer, sizeof(file_buffer));
+    CHECK_TRUE(len_sync > 0);
+    CHECK_EQUAL(len_sync, len);
+
+    // compare records without timestamps
+    size_t pos = 0;
+    while (pos < len){
+        uint32_t record_len = big_endian_read_32(file_buffer, pos);
+        CHECK_EQUAL(big_endian_read_32(file_buffer_sync, pos), record_len);
+        MEMCMP_EQUAL(&file_buffer_sync[pos + 12], &file_buffer[pos + 12], record_len - 8);
+        pos += 4 + record_len;
+    }
+    CHECK_EQUAL(len, pos);
+}
+
+TEST(HCI_DUMP_POSIX_FS_ASYNC, MaxPacketsTruncatesInOrder){
+    CHECK_EQUAL(0, hci_dump_posix_fs_async_open(TEST_LOG, HCI_DUMP_BTSNOOP));
+    hci_dump_init(hci_dump_posix_fs_async_get_instance());
+    hci_dump_set_max_packets(100);
+    log_test_packets(250);
+    hci_dump_posix_fs_async_close();
+    // file truncated after packet 200, new file header and remaining 50 packets
+    size_t len = read_file(TEST_LOG, file_buffer, sizeof(file_buffer));
+    uint8_t first_value;
+    CHECK_EQUAL(50, check_btsnoop_records(file_buffer, len, &first_value));
+    CHECK_EQUAL(200, first_value);
+}
+
+TEST(HCI_DUMP_POSIX_FS_ASYNC, RotateFiles){
+    const uint32_t max_file_size = 2000;
+    hci_dump_posix_fs_async_set_max_file_size(max_file_size, 2);
+    CHECK_EQUAL(0, hci_dump_posix_fs_async_open(TEST_LOG, HCI_DUMP_BTSNOOP));
+    hci_dump_init(hci_dump_posix_fs_async_get_instance());
+    log_test_packets(300);
+    hci_dump_posix_fs_async_close();
+
+    size_t len   = read_file(TEST_LOG,   file_buffer,      sizeof(file_buffer));
+    size_t len_1 = read_file(TEST_LOG_1, file_buffer_sync, sizeof(file_buffer_sync));
+    CHECK_TRUE(len   <= max_file_size);
+    CHECK_TRUE(len_1 <= max_file_size);
+    uint8_t first_value;
+    uint8_t first_value_1;
+    uint16_t num_packets   = check_btsnoop_records(file_buffer, len, &first_value);
+    uint16_t num_packets_1 = check_btsnoop_records(file_buffer_sync, len_1, &first_value_1);
+    CHECK_TRUE(num_packets > 0);
+    CHECK_TRUE(num_packets_1 > 0);
+    // current file ends with last packet, backup file continues with first packet of current file
+    CHECK_EQUAL((uint8_t) (300 - num_packets), first_value);
+    CHECK_EQUAL(first_value, (uint8_t) (first_value_1 + num_packets_1));
+    CHECK_EQUAL(0, access(TEST_LOG_2, F_OK));
+}
+
+int main (int argc, const char * argv[]){
+    return CommandLineTestRunner::RunAllTests(argc, argv);
+}
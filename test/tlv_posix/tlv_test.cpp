@@ -184,6 +184,65 @@ TEST(BSTACK_TLV, TestWriteDeleteResetReadDeleteRead){
     CHECK_EQUAL(size, 0);
 }
 
+TEST(BSTACK_TLV, TestManyTags){
+    uint32_t i;
+    for (i = 0; i < 1000; i++){
+        btstack_tlv_impl->store_tag(&btstack_tlv_context, TAG('t','a','g',0) + i, (const uint8_t *) &i, sizeof(i));
+    }
+    btstack_tlv_impl->delete_tag(&btstack_tlv_context, TAG('t','a','g',0) + 500);
+
+    reopen_db();
+
+    for (i = 0; i < 1000; i++){
+        uint32_t value = 0;
+        int size = btstack_tlv_impl->get_tag(&btstack_tlv_context, TAG('t','a','g',0) + i, (uint8_t *) &value, sizeof(value));
+        if (i == 500){
+            CHECK_EQUAL(0, size);
+        } else {
+            CHECK_EQUAL(sizeof(value), size);
+            CHECK_EQUAL(i, value);
+        }
+    }
+}
+
+TEST(BSTACK_TLV, TestCompaction){
+    uint32_t tag = TAG('a','b','c','d');
+    uint8_t  data[32];
+    uint32_t i;
+    for (i = 0; i < 1000; i++){
+        memset(data, i, sizeof(data));
+        btstack_tlv_impl->store_tag(&btstack_tlv_context, tag, data, sizeof(data));
+    }
+
+    // old entries have been removed from file
+    CHECK(btstack_tlv_context.file_size < 8192);
+    CHECK_EQUAL(ftell(btstack_tlv_context.file), (long) btstack_tlv_context.file_size);
+
+    reopen_db();
+
+    uint8_t buffer[32];
+    int size = btstack_tlv_impl->get_tag(&btstack_tlv_context, tag, buffer, sizeof(buffer));
+    CHECK_EQUAL(sizeof(buffer), size);
+    CHECK_EQUAL(data[0], buffer[0]);
+}
+
+TEST(BSTACK_TLV, TestGroupCommit){
+    uint32_t tag = TAG('a','b','c','d');
+    uint8_t  data = 7;
+    uint8_t  buffer = data;
+    btstack_tlv_posix_set_group_commit(&btstack_tlv_context, true);
+    btstack_tlv_impl->store_tag(&btstack_tlv_context, tag, &buffer, 1);
+    CHECK_EQUAL(1, btstack_tlv_context.pending_writes);
+    btstack_tlv_posix_flush(&btstack_tlv_context);
+    CHECK_EQUAL(0, btstack_tlv_context.pending_writes);
+
+    reopen_db();
+
+    int size = btstack_tlv_impl->get_tag(&btstack_tlv_context, tag, &buffer, 1);
+    CHECK_EQUAL(1, size);
+    CHECK_EQUAL(data, buffer);
+}
+
 
 int main (int argc, const char * argv[]){
     // log into file using HCI_DUMP_PACKETLOGGER format
@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+
+import re
+import sys
+import os
+
+program_info = '''
+BTstack HCI Command Encoder Generator for BTstack
+Copyright 2026, BlueKitchen GmbH
+'''
+
+copyright = """/*
+ * Copyright (C) 2026 BlueKitchen GmbH
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holders nor the names of
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ * 4. Any redistribution, use, or modification is done solely for
+ *    personal benefit and not for any commercial purpose or for
+ *    monetary gain.
+ *
+ * THIS SOFTWARE IS PROVIDED BY BLUEKITCHEN GMBH AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL BLUEKITCHEN
+ * GMBH OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS
+ * OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ * AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+ * THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ * Please inquire about commercial licensing options at
+ * contact@bluekitchen-gmbh.com
+ *
+ */
+"""
+
+hfile_header_begin = """
+/**
+ * HCI Command Encoder
+ *
+ * Typed encoders for the HCI Commands defined in hci_cmd.c. Each encoder stores the complete
+ * HCI Command packet incl. opcode and parameter length in the provided buffer and returns its size.
+ * The result is identical to hci_cmd_create_from_template with the hci_cmd_t format string.
+ *
+ * Note: Don't edit this file. It is generated by tool/btstack_hci_cmd_generator.py
+ *
+ */
+
+#ifndef HCI_CMD_ENCODER_H
+#define HCI_CMD_ENCODER_H
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+#include "bluetooth.h"
+#include "btstack_util.h"
+#include "hci_cmd.h"
+
+#include <stdint.h>
+#include <string.h>
+
+"""
+
+hfile_header_end = """
+#if defined __cplusplus
+}
+#endif
+
+#endif // HCI_CMD_ENCODER_H
+"""
+
+c_prototype = '''/**
+ * @brief Encode {cmd_name}
+ * @param hci_cmd_buffer
+{params_doc} * @return size of HCI Command packet
+ * @note: format {format}
+ */
+static inline uint16_t {fn_name}({args}){{
+{code}
+}}
+
+'''
+
+c_prototype_unsupported = '''/**
+ * @brief Encode {cmd_name}
+ * @note: format {format} not supported
+ */
+//  static inline uint16_t {fn_name}(uint8_t * hci_cmd_buffer, ...){{
+//      not implemented yet
+//  }}
+
+'''
+
+param_types = { '1' : 'uint8_t', '2' : 'uint16_t', '3' : 'uint32_t', '4' : 'uint32_t', 'H' : 'hci_con_handle_t',
+                'B' : 'const bd_addr_t', 'D' : 'const uint8_t *', 'E' : 'const uint8_t *', 'N' : 'const char *',
+                'P' : 'const uint8_t *', 'K' : 'const uint8_t *', 'A' : 'const uint8_t *', 'Q' : 'const uint8_t *',
+                'J' : 'uint8_t', 'V' : 'const uint8_t *', 'a' : 'uint8_t', 'b' : 'uint8_t' }
+
+array_param_types = { '1' : 'const uint8_t *', '2' : 'const uint16_t *' }
+
+# data blocks that are copied or reversed
+block_sizes = { 'D' : 8, 'E' : 240, 'P' : 16, 'A' : 31 }
+reversed_block_sizes = { 'K' : 16, 'Q' : 32 }
+
+def store_bytes(value, num_bytes):
+    code = '    hci_cmd_buffer[pos++] = (uint8_t) %s;\n' % value
+    for i in range(1, num_bytes):
+        code += '    hci_cmd_buffer[pos++] = (uint8_t) (%s >> %u);\n' % (value, 8 * i)
+    return code
+
+def parse_commands(path):
+    with open(path, 'rt') as fin:
+        source = fin.read()
+    # drop disabled code
+    source = re.sub(r'\n#if 0\n.*?\n#endif', '\n', source, flags=re.S)
+    commands = []
+    pattern = re.compile(r'(/\*\*((?:(?!\*/).)*)\*/\s*)?const hci_cmd_t (\w+)\s*=\s*\{\s*(\w+)\s*,\s*"([^"]*)"[^}]*\};', re.S)
+    for match in pattern.finditer(source):
+        doc = match.group(2) or ''
+        # only use doc comment directly preceding the definition
+        if doc.find('const hci_cmd_t') >= 0:
+            doc = ''
+        params = [re.sub(r'\W', '', re.sub(r'\[\w*\]', '', p)).lower() for p in re.findall(r'@param\s+(\S+)', doc)]
+        commands.append((match.group(3), match.group(4), match.group(5), params))
+    return commands
+
+# documented names that can't be used as C/C++ identifiers
+reserved_names = ['pos', 'hci_cmd_buffer', 'i', 'public', 'private', 'protected', 'class', 'new', 'delete', 'default']
+
+def valid_param_names(params):
+    if len(set(params)) != len(params):
+        return False
+    for name in params:
+        if name in reserved_names or re.fullmatch(r'[a-z_]\w*', name) is None:
+            return False
+    return True
+
+def all_fields_supported(format):
+    return re.fullmatch(r'[1234HBDENPKAQJVab]*(\[[12]+\])?', format) is not None and (('[' in format) == ('a' in format or 'b' in format))
+
+def create_encoder(cmd_name, opcode, format, params):
+    fn_name = 'hci_cmd_encode_' + (cmd_name[4:] if cmd_name.startswith('hci_') else cmd_name)
+    if not all_fields_supported(format):
+        return c_prototype_unsupported.format(cmd_name=cmd_name, fn_name=fn_name, format=format)
+
+    fields = format.replace('[', '').replace(']', '')
+    # use documented parameter names if they match the format
+    if len(params) != len(fields) or not valid_param_names(params):
+        params = ['param_%u' % i for i in range(len(fields))]
+
+    args = ['uint8_t * hci_cmd_buffer']
+    code = '    uint16_t pos = 3;\n'
+    var_len = None
+    num_elements = None
+    array_fields = []
+    for (field, name) in zip(fields, params):
+        if field == 'a' or field == 'b':
+            args.append('%s %s' % (param_types[field], name))
+            code += '    hci_cmd_buffer[pos++] = %s;\n' % name
+            if field == 'a':
+                num_elements = name
+            else:
+                num_elements = 'count_set_bits_uint32(%s)' % name
+            continue
+        if num_elements is not None:
+            # arrayed parameters follow element count
+            args.append('%s %s' % (array_param_types[field], name))
+            array_fields.append((field, name))
+            continue
+        args.append('%s %s' % (param_types[field], name))
+        if field in '1J':
+            code += '    hci_cmd_buffer[pos++] = %s;\n' % name
+            if field == 'J':
+                var_len = name
+        elif field in '2H':
+            code += store_bytes(name, 2)
+        elif field == '3':
+            code += store_bytes(name, 3)
+        elif field == '4':
+            code += store_bytes(name, 4)
+        elif field == 'B':
+            for i in range(6):
+                code += '    hci_cmd_buffer[pos++] = %s[%u];\n' % (name, 5 - i)
+        elif field in block_sizes:
+            code += '    (void) memcpy(&hci_cmd_buffer[pos], %s, %u);\n' % (name, block_sizes[field])
+            code += '    pos += %u;\n' % block_sizes[field]
+        elif field in reversed_block_sizes:
+            code += '    reverse_bytes(%s, &hci_cmd_buffer[pos], %u);\n' % (name, reversed_block_sizes[field])
+            code += '    pos += %u;\n' % reversed_block_sizes[field]
+        elif field == 'N':
+            code += '    uint16_t %s_len = (uint16_t) btstack_min((uint32_t) strlen(%s), 248u);\n' % (name, name)
+            code += '    (void) memcpy(&hci_cmd_buffer[pos], %s, %s_len);\n' % (name, name)
+            code += '    memset(&hci_cmd_buffer[pos + %s_len], 0, 248u - %s_len);\n' % (name, name)
+            code += '    pos += 248;\n'
+        elif field == 'V':
+            assert var_len is not None, cmd_name + ': V without J'
+            code += '    (void) memcpy(&hci_cmd_buffer[pos], %s, %s);\n' % (name, var_len)
+            code += '    pos += %s;\n' % var_len
+            var_len = None
+
+    if len(array_fields) > 0:
+        code += '    uint8_t i;\n'
+        code += '    for (i = 0; i < %s; i++){\n' % num_elements
+        for (field, name) in array_fields:
+            code += '    ' + store_bytes('%s[i]' % name, 1 if field == '1' else 2).replace('\n    ', '\n        ')
+        code += '    }\n'
+
+    code += '    hci_cmd_buffer[0] = (uint8_t) %s;\n' % opcode
+    code += '    hci_cmd_buffer[1] = (uint8_t) (%s >> 8);\n' % opcode
+    code += '    hci_cmd_buffer[2] = (uint8_t) (pos - 3u);\n'
+    code += '    return pos;'
+
+    params_doc = ''.join(' * @param %s\n' % name for name in params)
+    return c_prototype.format(cmd_name=cmd_name, fn_name=fn_name, params_doc=params_doc, args=', '.join(args), code=code, format=format)
+
+def create_encoders(commands):
+    with open(gen_path, 'wt') as fout:
+        fout.write(copyright)
+        fout.write(hfile_header_begin)
+        for (cmd_name, opcode, format, params) in commands:
+            fout.write(create_encoder(cmd_name, opcode, format, params))
+        fout.write(hfile_header_end)
+
+btstack_root = os.path.abspath(os.path.dirname(sys.argv[0]) + '/..')
+gen_path = btstack_root + '/src/hci_cmd_encoder.h'
+
+print(program_info)
+
+commands = parse_commands(btstack_root + '/src/hci_cmd.c')
+create_encoders(commands)
+
+print('Done!')
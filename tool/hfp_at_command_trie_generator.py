@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+#
+# Generates AT command recognizer tables for hfp.c
+#
+# The AT commands received by the Audio Gateway and the result codes received by the Hands-Free
+# are stored in a trie per role. Each node has a character, the index of its first child and
+# the index of its next sibling (0 = none, as the root is never a child), and the command id if
+# a command ends at this node. Nodes are emitted in depth-first order with siblings sorted, so
+# the first child of a node usually directly follows it.
+#
+# Usage: ./hfp_at_command_trie_generator.py > ../src/classic/hfp_at_command_trie.h
+
+# commands received by AG
+hfp_ag_commands = [
+    ('AT+BAC=',   'HFP_CMD_AVAILABLE_CODECS'),
+    ('AT+BCC',    'HFP_CMD_TRIGGER_CODEC_CONNECTION_SETUP'),
+    ('AT+BCS=',   'HFP_CMD_HF_CONFIRMED_CODEC'),
+    ('AT+BIA=',   'HFP_CMD_ENABLE_INDIVIDUAL_AG_INDICATOR_STATUS_UPDATE'),  # +BIA:<enabled>,,<enabled>,,,<enabled>
+    ('AT+BIEV=',  'HFP_CMD_HF_INDICATOR_STATUS'),
+    ('AT+BIND=',  'HFP_CMD_LIST_GENERIC_STATUS_INDICATORS'),
+    ('AT+BIND=?', 'HFP_CMD_RETRIEVE_GENERIC_STATUS_INDICATORS'),
+    ('AT+BIND?',  'HFP_CMD_RETRIEVE_GENERIC_STATUS_INDICATORS_STATE'),
+    ('AT+BINP=',  'HFP_CMD_HF_REQUEST_PHONE_NUMBER'),
+    ('AT+BLDN',   'HFP_CMD_REDIAL_LAST_NUMBER'),
+    ('AT+BRSF=',  'HFP_CMD_SUPPORTED_FEATURES'),
+    ('AT+BTRH=',  'HFP_CMD_RESPONSE_AND_HOLD_COMMAND'),
+    ('AT+BTRH?',  'HFP_CMD_RESPONSE_AND_HOLD_QUERY'),
+    ('AT+BVRA=',  'HFP_CMD_HF_ACTIVATE_VOICE_RECOGNITION'),
+    ('AT+CCWA=',  'HFP_CMD_ENABLE_CALL_WAITING_NOTIFICATION'),
+    ('AT+CHLD=',  'HFP_CMD_CALL_HOLD'),
+    ('AT+CHLD=?', 'HFP_CMD_SUPPORT_CALL_HOLD_AND_MULTIPARTY_SERVICES'),
+    ('AT+CHUP',   'HFP_CMD_HANG_UP_CALL'),
+    ('AT+CIND=?', 'HFP_CMD_RETRIEVE_AG_INDICATORS'),
+    ('AT+CIND?',  'HFP_CMD_RETRIEVE_AG_INDICATORS_STATUS'),
+    ('AT+CLCC',   'HFP_CMD_LIST_CURRENT_CALLS'),
+    ('AT+CLIP=',  'HFP_CMD_ENABLE_CLIP'),
+    ('AT+CMEE=',  'HFP_CMD_ENABLE_EXTENDED_AUDIO_GATEWAY_ERROR'),
+    ('AT+CMER=',  'HFP_CMD_ENABLE_INDICATOR_STATUS_UPDATE'),
+    ('AT+CNUM',   'HFP_CMD_GET_SUBSCRIBER_NUMBER_INFORMATION'),
+    ('AT+COPS=',  'HFP_CMD_QUERY_OPERATOR_SELECTION_NAME_FORMAT'),
+    ('AT+COPS?',  'HFP_CMD_QUERY_OPERATOR_SELECTION_NAME'),
+    ('AT+NREC=',  'HFP_CMD_TURN_OFF_EC_AND_NR'),
+    ('AT+VGM=',   'HFP_CMD_SET_MICROPHONE_GAIN'),
+    ('AT+VGS=',   'HFP_CMD_SET_SPEAKER_GAIN'),
+    ('AT+VTS=',   'HFP_CMD_TRANSMIT_DTMF_CODES'),
+    ('ATA',       'HFP_CMD_CALL_ANSWERED'),
+]
+
+# result codes received by HF
+hfp_hf_commands = [
+    ('+BCS:',       'HFP_CMD_AG_SUGGESTED_CODEC'),
+    ('+BIND:',      'HFP_CMD_SET_GENERIC_STATUS_INDICATOR_STATUS'),
+    ('+BINP:',      'HFP_CMD_AG_SENT_PHONE_NUMBER'),
+    ('+BRSF:',      'HFP_CMD_SUPPORTED_FEATURES'),
+    ('+BSIR:',      'HFP_CMD_CHANGE_IN_BAND_RING_TONE_SETTING'),
+    ('+BTRH:',      'HFP_CMD_RESPONSE_AND_HOLD_STATUS'),
+    ('+BVRA:',      'HFP_CMD_AG_ACTIVATE_VOICE_RECOGNITION'),
+    ('+CCWA:',      'HFP_CMD_AG_SENT_CALL_WAITING_NOTIFICATION_UPDATE'),
+    ('+CHLD:',      'HFP_CMD_SUPPORT_CALL_HOLD_AND_MULTIPARTY_SERVICES'),
+    ('+CIEV:',      'HFP_CMD_TRANSFER_AG_INDICATOR_STATUS'),
+    ('+CIND:',      'HFP_CMD_RETRIEVE_AG_INDICATORS_GENERIC'),
+    ('+CLCC:',      'HFP_CMD_LIST_CURRENT_CALLS'),
+    ('+CLIP:',      'HFP_CMD_AG_SENT_CLIP_INFORMATION'),
+    ('+CME ERROR:', 'HFP_CMD_EXTENDED_AUDIO_GATEWAY_ERROR'),
+    ('+CNUM:',      'HFP_CMD_GET_SUBSCRIBER_NUMBER_INFORMATION'),
+    ('+COPS:',      'HFP_CMD_QUERY_OPERATOR_SELECTION_NAME'),
+    ('+VGM:',       'HFP_CMD_SET_MICROPHONE_GAIN'),
+    ('+VGM=',       'HFP_CMD_SET_MICROPHONE_GAIN'),
+    ('+VGS:',       'HFP_CMD_SET_SPEAKER_GAIN'),
+    ('+VGS=',       'HFP_CMD_SET_SPEAKER_GAIN'),
+    ('ERROR',       'HFP_CMD_ERROR'),
+    ('NOP',         'HFP_CMD_NONE'),  # dummy command used by unit tests
+    ('OK',          'HFP_CMD_OK'),
+    ('RING',        'HFP_CMD_RING'),
+]
+
+MAX_NODES = 255
+
+class Node:
+    def __init__(self, character, prefix):
+        self.character = character
+        self.prefix = prefix
+        self.children = {}
+        self.command = None
+        self.index = 0
+
+def build_trie(commands):
+    root = Node('', '')
+    for (text, command) in commands:
+        node = root
+        for character in text:
+            if character not in node.children:
+                node.children[character] = Node(character, node.prefix + character)
+            node = node.children[character]
+        assert node.command is None, 'duplicate command ' + text
+        node.command = command
+    return root
+
+def flatten(root):
+    nodes = []
+    def visit(node):
+        node.index = len(nodes)
+        nodes.append(node)
+        for character in sorted(node.children):
+            visit(node.children[character])
+    visit(root)
+    assert len(nodes) <= MAX_NODES, 'too many nodes, index does not fit into uint8_t'
+    return nodes
+
+def c_char(character):
+    if character == '':
+        return "   0"
+    if character in "'\\":
+        return "'\\%s'" % character
+    return " '%s'" % character
+
+def generate(name, commands):
+    nodes = flatten(build_trie(commands))
+    command_width = max(len(command) for (_, command) in commands + [('', 'HFP_AT_COMMAND_TRIE_NO_COMMAND')])
+    print('static const hfp_at_command_trie_node_t hfp_at_command_trie_%s[%u] = {' % (name, len(nodes)))
+    for node in nodes:
+        children = [node.children[c] for c in sorted(node.children)]
+        first_child = children[0].index if len(children) > 0 else 0
+        next_sibling = 0
+        if node.prefix != '':
+            parent = nodes[0]
+            for character in node.prefix[:-1]:
+                parent = parent.children[character]
+            siblings = [parent.children[c] for c in sorted(parent.children)]
+            position = siblings.index(node)
+            if position + 1 < len(siblings):
+                next_sibling = siblings[position + 1].index
+        command = node.command if node.command is not None else 'HFP_AT_COMMAND_TRIE_NO_COMMAND'
+        print('    { %s, %3u, %3u, %s }, // %3u "%s"' % (c_char(node.character), first_child, next_sibling, command.ljust(command_width), node.index, node.prefix))
+    print('};')
+    print()
+
+if __name__ == "__main__":
+    print('// hfp_at_command_trie.h generated by tool/hfp_at_command_trie_generator.py - do not edit')
+    print()
+    print('#ifndef HFP_AT_COMMAND_TRIE_H')
+    print('#define HFP_AT_COMMAND_TRIE_H')
+    print()
+    print('#define HFP_AT_COMMAND_TRIE_NO_COMMAND 0xff')
+    print()
+    print('typedef struct {')
+    print('    char    character;')
+    print('    uint8_t first_child;   // 0 = none')
+    print('    uint8_t next_sibling;  // 0 = none')
+    print('    uint8_t command;       // hfp_command_t or HFP_AT_COMMAND_TRIE_NO_COMMAND')
+    print('} hfp_at_command_trie_node_t;')
+    print()
+    print('// AT commands received by AG')
+    generate('ag', hfp_ag_commands)
+    print('// result codes received by HF')
+    generate('hf', hfp_hf_commands)
+    print('#endif // HFP_AT_COMMAND_TRIE_H')
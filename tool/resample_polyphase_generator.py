@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+#
+# Generates coefficient tables for btstack_resample_polyphase.c
+#
+# Each quality preset is a Kaiser windowed sinc low-pass with num_taps taps, sampled at
+# num_phases + 1 fractional positions. Coefficients are Q15, every phase is normalized to
+# unity gain at DC. The SSE2 kernel accumulates every 4th pair of taps in a 32 bit lane.
+# The sum of absolute coefficients of each lane must stay below 2.0 to avoid overflow for
+# full scale input.
+#
+# Usage: ./resample_polyphase_generator.py > ../src/btstack_resample_polyphase_tables.h
+
+import math
+import sys
+
+# name, taps, phase bits, cutoff (relative to input sample rate), kaiser beta
+presets = [
+    ('low',    16, 5, 0.40, 5.0),
+    ('medium', 32, 6, 0.43, 6.5),
+    ('high',   64, 7, 0.455, 8.6),
+]
+
+VALUES_PER_LINE = 16
+
+def bessel_i0(x):
+    s = 1.0
+    t = 1.0
+    k = 1
+    while t > 1e-12 * s:
+        t *= (x / (2.0 * k)) ** 2
+        s += t
+        k += 1
+    return s
+
+def sinc(x):
+    if x == 0.0:
+        return 1.0
+    return math.sin(math.pi * x) / (math.pi * x)
+
+def phase_coefficients(num_taps, t, cutoff, beta):
+    # output at fractional position t between tap num_taps/2-1 and tap num_taps/2
+    center = num_taps / 2 - 1 + t
+    half_width = num_taps / 2
+    values = []
+    for k in range(num_taps):
+        d = k - center
+        w = d / half_width
+        window = bessel_i0(beta * math.sqrt(max(0.0, 1.0 - w * w))) / bessel_i0(beta)
+        values.append(2.0 * cutoff * sinc(2.0 * cutoff * d) * window)
+    gain = sum(values)
+    coefficients = [int(round(v / gain * 32768)) for v in values]
+    # distribute rounding error onto largest tap for exact unity gain
+    largest = max(range(num_taps), key=lambda i: abs(coefficients[i]))
+    coefficients[largest] += 32768 - sum(coefficients)
+    assert max(coefficients) <= 32767 and min(coefficients) >= -32768
+    for lane in range(4):
+        sse2_lane = [c for i, c in enumerate(coefficients) if ((i % 8) >> 1) == lane]
+        assert sum(abs(c) for c in sse2_lane) < 65536
+    return coefficients
+
+def generate(name, num_taps, phase_bits, cutoff, beta):
+    num_phases = 1 << phase_bits
+    print('// %s: %u taps, %u phases, cutoff %.3f, Kaiser beta %.1f' % (name, num_taps, num_phases, cutoff, beta))
+    print('static const int16_t btstack_resample_polyphase_coefficients_%s[%u * %u] = {' % (name, num_phases + 1, num_taps))
+    for phase in range(num_phases + 1):
+        coefficients = phase_coefficients(num_taps, phase / num_phases, cutoff, beta)
+        for i in range(0, num_taps, VALUES_PER_LINE):
+            print('    ' + ' '.join('%6d,' % c for c in coefficients[i:i + VALUES_PER_LINE]))
+    print('};')
+    print()
+
+if __name__ == "__main__":
+    print('// btstack_resample_polyphase_tables.h generated by tool/resample_polyphase_generator.py - do not edit')
+    print()
+    print('#ifndef BTSTACK_RESAMPLE_POLYPHASE_TABLES_H')
+    print('#define BTSTACK_RESAMPLE_POLYPHASE_TABLES_H')
+    print()
+    for preset in presets:
+        generate(*preset)
+    print('#endif')